@@ -56,11 +56,13 @@ void arm_copyarmstate(uint32_t *dest, uint32_t *src)
 
   if (src != dest)
     {
+#ifndef CONFIG_ARMV7M_FPU_LAZYSWITCH
       /* Save the floating point registers: This will initialize the floating
        * registers at indices SW_INT_REGS through (SW_INT_REGS+SW_FPU_REGS-1)
        */
 
       arm_savefpu(dest);
+#endif
 
       /* Save the block of ARM registers that were saved by the interrupt
        * handling logic.  Indices: 0 through (SW_INT_REGS-1).
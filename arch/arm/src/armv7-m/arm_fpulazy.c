@@ -0,0 +1,237 @@
+/****************************************************************************
+ * arch/arm/src/armv7-m/arm_fpulazy.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <errno.h>
+
+#include <nuttx/sched.h>
+#include <arch/irq.h>
+
+#include "sched/sched.h"
+#include "arm_arch.h"
+#include "nvic.h"
+#include "arm_internal.h"
+
+#ifdef CONFIG_ARMV7M_FPU_LAZYSWITCH
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* CPACR bits enabling full access to CP10 and CP11 (the FPU) */
+
+#define CPACR_FPU_ACCESS  ((3 << (2 * 10)) | (3 << (2 * 11)))
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The thread whose floating point context currently resides in the FPU
+ * register file, or NULL if no thread owns the FPU.  The FPU context of
+ * every other thread lives in the FPU area of its saved register array.
+ */
+
+static FAR struct tcb_s *g_fpu_owner;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: arm_fpulazy_select
+ *
+ * Description:
+ *   Called from the exception return path when a context switch is
+ *   pending.  Rather than eagerly restoring the incoming thread's FPU
+ *   registers, access to the FPU is simply disabled (unless the incoming
+ *   thread already owns the FPU register file).  If the incoming thread
+ *   later executes a floating point instruction, the resulting No
+ *   Coprocessor fault will perform the deferred save/restore via
+ *   arm_fpulazy_trap().  Threads that perform no floating point operations
+ *   never pay for the FPU register file transfers.
+ *
+ * Input Parameters:
+ *   regs - The register save area of the thread being switched in
+ *
+ * Returned Value:
+ *   The same regs value passed in.  The assembly language caller depends
+ *   on R0 being preserved across this call.
+ *
+ ****************************************************************************/
+
+uint32_t *arm_fpulazy_select(uint32_t *regs)
+{
+  uint32_t regval;
+
+  regval = getreg32(NVIC_CPACR);
+  if (g_fpu_owner != NULL && regs == g_fpu_owner->xcp.regs)
+    {
+      /* The incoming thread's FPU context is already live in the register
+       * file.  Just make sure that it can access it.
+       */
+
+      regval |= CPACR_FPU_ACCESS;
+    }
+  else
+    {
+      /* Disable FPU access so that the first floating point instruction
+       * executed by the incoming thread (if any) will trap.
+       */
+
+      regval &= ~CPACR_FPU_ACCESS;
+    }
+
+  putreg32(regval, NVIC_CPACR);
+  return regs;
+}
+
+/****************************************************************************
+ * Name: arm_fpulazy_trap
+ *
+ * Description:
+ *   Handle a No Coprocessor (NOCP) fault resulting from a floating point
+ *   instruction executed while FPU access was disabled.  The live FPU
+ *   register file is handed over to the currently running thread:  the
+ *   previous owner's registers are spilled into its saved register array
+ *   and the running thread's registers are loaded.  On return, the
+ *   faulting instruction is re-executed with the FPU enabled.
+ *
+ * Returned Value:
+ *   OK if the fault was a lazy FPU switch and was handled; a negated errno
+ *   value if the FPU was already accessible and the fault must be treated
+ *   as a real error.
+ *
+ ****************************************************************************/
+
+int arm_fpulazy_trap(void)
+{
+  FAR struct tcb_s *rtcb = this_task();
+  uint32_t regval;
+
+  regval = getreg32(NVIC_CPACR);
+  if ((regval & CPACR_FPU_ACCESS) == CPACR_FPU_ACCESS)
+    {
+      /* The FPU was enabled, so this NOCP fault was raised by some other
+       * coprocessor access.  Let normal fault handling deal with it.
+       */
+
+      return -EPERM;
+    }
+
+  /* Enable FPU access.  This must be done before touching the FPU register
+   * file below; CPACR applies in handler mode as well.
+   */
+
+  regval |= CPACR_FPU_ACCESS;
+  putreg32(regval, NVIC_CPACR);
+
+  if (g_fpu_owner != rtcb)
+    {
+      /* Spill the previous owner's FPU context.  The owner has not run
+       * since it lost the CPU (otherwise it would still be this_task()),
+       * so the live register file holds its state.
+       */
+
+      if (g_fpu_owner != NULL)
+        {
+          arm_savefpu(g_fpu_owner->xcp.regs);
+        }
+
+      /* And load the running thread's FPU context.  For a thread that has
+       * never used the FPU, this loads the all-zero initial state set up
+       * by up_initial_state().
+       */
+
+      arm_restorefpu(rtcb->xcp.regs);
+      g_fpu_owner = rtcb;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: arm_fpulazy_spill
+ *
+ * Description:
+ *   Force the indicated thread's FPU context out of the live register file
+ *   and into its saved register array, relinquishing ownership.  This is
+ *   required when a signal handler is scheduled on the thread:  While the
+ *   thread owns the register file, the handler can clobber the live
+ *   registers without trapping, so the pre-signal state must be captured
+ *   in xcp.regs (where the signal trampoline preserves it) first.  After
+ *   the spill, the thread's next floating point instruction traps and
+ *   reloads from the saved register array.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread receiving the signal
+ *
+ ****************************************************************************/
+
+void arm_fpulazy_spill(FAR struct tcb_s *tcb)
+{
+  uint32_t regval;
+
+  if (g_fpu_owner == tcb)
+    {
+      /* Make sure that the FPU is accessible before spilling the register
+       * file; CPACR applies in handler mode as well.  The prior access
+       * setting is restored afterward so that a running non-owner still
+       * traps on its first floating point instruction.
+       */
+
+      regval = getreg32(NVIC_CPACR);
+      putreg32(regval | CPACR_FPU_ACCESS, NVIC_CPACR);
+
+      arm_savefpu(tcb->xcp.regs);
+      g_fpu_owner = NULL;
+
+      putreg32(regval, NVIC_CPACR);
+    }
+}
+
+/****************************************************************************
+ * Name: arm_fpulazy_abandon
+ *
+ * Description:
+ *   The indicated thread is being destroyed.  If it owns the FPU register
+ *   file, forget about it so that a later lazy spill does not write into
+ *   freed memory (or into the register array of an unrelated thread that
+ *   recycled the TCB allocation).
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread being destroyed
+ *
+ ****************************************************************************/
+
+void arm_fpulazy_abandon(FAR struct tcb_s *tcb)
+{
+  if (g_fpu_owner == tcb)
+    {
+      g_fpu_owner = NULL;
+    }
+}
+
+#endif /* CONFIG_ARMV7M_FPU_LAZYSWITCH */
@@ -73,6 +73,25 @@
 
 int arm_hardfault(int irq, FAR void *context, FAR void *arg)
 {
+#ifdef CONFIG_ARMV7M_FPU_LAZYSWITCH
+  /* With the UsageFault exception disabled (the default), the No
+   * Coprocessor fault generated by the first floating point instruction
+   * executed after a lazy FPU context switch escalates to Hard Fault.
+   * Check for that case before treating the fault as a fatal event.
+   */
+
+  if ((getreg32(NVIC_CFAULTS) & NVIC_CFAULTS_NOCP) != 0 &&
+      arm_fpulazy_trap() == OK)
+    {
+      /* The FPU context was switched in.  Clear the fault status and
+       * return to re-execute the trapped floating point instruction.
+       */
+
+      putreg32(NVIC_CFAULTS_NOCP, NVIC_CFAULTS);
+      return OK;
+    }
+#endif
+
   /* Get the value of the program counter where the fault occurred */
 
 #ifndef CONFIG_ARMV7M_USEBASEPRI
@@ -160,6 +160,17 @@ void up_schedule_sigaction(struct tcb_s *tcb, sig_deliver_t sigdeliver)
                */
 
               arm_savestate(tcb->xcp.regs);
+
+#ifdef CONFIG_ARMV7M_FPU_LAZYSWITCH
+              /* If the interrupted thread owns the live FPU register file,
+               * the signal handler could clobber it without ever trapping.
+               * Spill the pre-signal FPU state into the saved context (from
+               * where the signal trampoline preserves and restores it) and
+               * relinquish ownership.
+               */
+
+              arm_fpulazy_spill(tcb);
+#endif
             }
         }
 
@@ -201,6 +212,17 @@ void up_schedule_sigaction(struct tcb_s *tcb, sig_deliver_t sigdeliver)
 #ifdef CONFIG_BUILD_PROTECTED
           tcb->xcp.regs[REG_LR]      = EXC_RETURN_PRIVTHR;
 #endif
+
+#ifdef CONFIG_ARMV7M_FPU_LAZYSWITCH
+          /* The blocked thread may still own the live FPU register file if
+           * no other thread has trapped since it lost the CPU.  Spill the
+           * pre-signal FPU state into the saved context (from where the
+           * signal trampoline preserves and restores it) and relinquish
+           * ownership.
+           */
+
+          arm_fpulazy_spill(tcb);
+#endif
         }
     }
 
@@ -25,6 +25,7 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <string.h>
 #include <sched.h>
 #include <debug.h>
 
@@ -171,6 +172,20 @@ void arm_sigdeliver(void)
 #endif
   rtcb->xcp.sigdeliver = NULL;  /* Allows next handler to be scheduled */
 
+#ifdef CONFIG_ARMV7M_FPU_LAZYSWITCH
+  /* The signal handler may have acquired ownership of the FPU register
+   * file while it ran, leaving the live registers clobbered with its
+   * state.  Relinquish any such ownership and restore the FPU area of the
+   * saved context from the pre-signal copy captured above, so that the
+   * thread's next floating point instruction traps and reloads its
+   * pre-signal state.
+   */
+
+  arm_fpulazy_abandon(rtcb);
+  memcpy(&rtcb->xcp.regs[REG_S0], &regs[REG_S0],
+         SW_FPU_REGS * sizeof(uint32_t));
+#endif
+
 #ifdef CONFIG_SMP
   /* Restore the saved 'irqcount' and recover the critical section
    * spinlocks.
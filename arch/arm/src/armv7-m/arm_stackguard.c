@@ -0,0 +1,132 @@
+/****************************************************************************
+ * arch/arm/src/armv7-m/arm_stackguard.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/sched.h>
+
+#include "arm_arch.h"
+#include "mpu.h"
+
+#ifdef CONFIG_STACK_GUARD
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The guard covers one minimum-sized (32-byte) MPU region at the lowest
+ * 32-byte aligned address within the stack allocation.
+ */
+
+#define STACK_GUARD_SIZE   32
+#define STACK_GUARD_ALIGN(a) \
+  (((a) + (STACK_GUARD_SIZE - 1)) & ~(uintptr_t)(STACK_GUARD_SIZE - 1))
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The MPU region reserved for the stack guard (allocated on first use) */
+
+static unsigned int g_guard_region;
+static bool g_guard_ready;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_stack_guard
+ *
+ * Description:
+ *   Position the MPU stack guard region over the bottom of the indicated
+ *   thread's stack.  This is called when the thread is switched in so that
+ *   the guard follows the running thread.  Any access within the guard --
+ *   i.e., a stack overflow in progress -- then faults immediately instead
+ *   of silently corrupting whatever memory lies below the stack.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread being switched in
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void up_stack_guard(FAR struct tcb_s *tcb)
+{
+  uintptr_t base;
+  uint32_t regval;
+
+  /* Reserve an MPU region for the guard on the first context switch and
+   * make sure that the MPU is enabled with the default memory map as the
+   * background region for privileged accesses.
+   */
+
+  if (!g_guard_ready)
+    {
+      g_guard_region = mpu_allocregion();
+      g_guard_ready  = true;
+
+      if ((getreg32(MPU_CTRL) & MPU_CTRL_ENABLE) == 0)
+        {
+          mpu_control(true, false, true);
+        }
+    }
+
+  /* Select the guard region */
+
+  putreg32(g_guard_region, MPU_RNR);
+
+  /* Threads without stack information (the IDLE thread before nx_start()
+   * completes) get no guard.
+   */
+
+  if (tcb->stack_alloc_ptr == NULL)
+    {
+      putreg32(0, MPU_RASR);
+      return;
+    }
+
+  /* Place the guard over the lowest 32-byte aligned region within the
+   * stack allocation and deny all access to it.
+   */
+
+  base = STACK_GUARD_ALIGN((uintptr_t)tcb->stack_alloc_ptr);
+  putreg32((base & MPU_RBAR_ADDR_MASK) | g_guard_region | MPU_RBAR_VALID,
+           MPU_RBAR);
+
+  regval = MPU_RASR_ENABLE        | /* Enable region */
+           MPU_RASR_SIZE_LOG2(5)  | /* 32 bytes */
+           MPU_RASR_TEX_SO        | /* Strongly ordered */
+           MPU_RASR_AP_NONO       | /* P:None U:None */
+           MPU_RASR_XN;             /* Instruction access disable */
+  putreg32(regval, MPU_RASR);
+}
+
+#endif /* CONFIG_STACK_GUARD */
@@ -179,7 +179,8 @@ int arm_svcall(int irq, FAR void *context, FAR void *arg)
         {
           DEBUGASSERT(regs[REG_R1] != 0);
           memcpy((uint32_t *)regs[REG_R1], regs, XCPTCONTEXT_SIZE);
-#if defined(CONFIG_ARCH_FPU) && defined(CONFIG_ARMV7M_LAZYFPU)
+#if defined(CONFIG_ARCH_FPU) && defined(CONFIG_ARMV7M_LAZYFPU) && \
+   !defined(CONFIG_ARMV7M_FPU_LAZYSWITCH)
           arm_savefpu((uint32_t *)regs[REG_R1]);
 #endif
         }
@@ -229,7 +230,8 @@ int arm_svcall(int irq, FAR void *context, FAR void *arg)
         {
           DEBUGASSERT(regs[REG_R1] != 0 && regs[REG_R2] != 0);
           memcpy((uint32_t *)regs[REG_R1], regs, XCPTCONTEXT_SIZE);
-#if defined(CONFIG_ARCH_FPU) && defined(CONFIG_ARMV7M_LAZYFPU)
+#if defined(CONFIG_ARCH_FPU) && defined(CONFIG_ARMV7M_LAZYFPU) && \
+   !defined(CONFIG_ARMV7M_FPU_LAZYSWITCH)
           arm_savefpu((uint32_t *)regs[REG_R1]);
 #endif
           CURRENT_REGS = (uint32_t *)regs[REG_R2];
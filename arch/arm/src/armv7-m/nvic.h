@@ -575,6 +575,30 @@
 #define NVIC_SYSHCON_BUSFAULTENA        (1 << 17) /* Bit 17: BusFault enabled */
 #define NVIC_SYSHCON_USGFAULTENA        (1 << 18) /* Bit 18: UsageFault enabled */
 
+/* Configurable fault status register (CFAULTS).  Bits 0-7 report MemManage
+ * faults, bits 8-15 report BusFaults, and bits 16-25 report UsageFaults.
+ */
+
+#define NVIC_CFAULTS_IACCVIOL           (1 << 0)  /* Bit 0:  Instruction access violation */
+#define NVIC_CFAULTS_DACCVIOL           (1 << 1)  /* Bit 1:  Data access violation */
+#define NVIC_CFAULTS_MUNSTKERR          (1 << 3)  /* Bit 3:  MemManage fault on unstacking */
+#define NVIC_CFAULTS_MSTKERR            (1 << 4)  /* Bit 4:  MemManage fault on stacking */
+#define NVIC_CFAULTS_MLSPERR            (1 << 5)  /* Bit 5:  MemManage fault on lazy FP state preservation */
+#define NVIC_CFAULTS_MMARVALID          (1 << 7)  /* Bit 7:  MemManage fault address register valid */
+#define NVIC_CFAULTS_IBUSERR            (1 << 8)  /* Bit 8:  Instruction bus error */
+#define NVIC_CFAULTS_PRECISERR          (1 << 9)  /* Bit 9:  Precise data bus error */
+#define NVIC_CFAULTS_IMPRECISERR        (1 << 10) /* Bit 10: Imprecise data bus error */
+#define NVIC_CFAULTS_UNSTKERR           (1 << 11) /* Bit 11: BusFault on unstacking */
+#define NVIC_CFAULTS_STKERR             (1 << 12) /* Bit 12: BusFault on stacking */
+#define NVIC_CFAULTS_LSPERR             (1 << 13) /* Bit 13: BusFault on lazy FP state preservation */
+#define NVIC_CFAULTS_BFARVALID          (1 << 15) /* Bit 15: BusFault address register valid */
+#define NVIC_CFAULTS_UNDEFINSTR         (1 << 16) /* Bit 16: Undefined instruction */
+#define NVIC_CFAULTS_INVSTATE           (1 << 17) /* Bit 17: Invalid EPSR state */
+#define NVIC_CFAULTS_INVPC              (1 << 18) /* Bit 18: Invalid PC load */
+#define NVIC_CFAULTS_NOCP               (1 << 19) /* Bit 19: No coprocessor */
+#define NVIC_CFAULTS_UNALIGNED          (1 << 24) /* Bit 24: Unaligned access */
+#define NVIC_CFAULTS_DIVBYZERO          (1 << 25) /* Bit 25: Divide by zero */
+
 /* Cache Level ID register (Cortex-M7) */
 
 #define NVIC_CLIDR_L1CT_SHIFT           (0)      /* Bits 0-2: Level 1 cache type */
@@ -410,6 +410,14 @@ void arm_restorefpu(const uint32_t *regs);
 #  define arm_restorefpu(regs)
 #endif
 
+#ifdef CONFIG_ARMV7M_FPU_LAZYSWITCH
+struct tcb_s; /* Forward reference */
+uint32_t *arm_fpulazy_select(uint32_t *regs);
+int arm_fpulazy_trap(void);
+void arm_fpulazy_spill(FAR struct tcb_s *tcb);
+void arm_fpulazy_abandon(FAR struct tcb_s *tcb);
+#endif
+
 /* Low level serial output **************************************************/
 
 void arm_lowputc(char ch);
@@ -84,6 +84,14 @@
 
 void up_release_stack(FAR struct tcb_s *dtcb, uint8_t ttype)
 {
+#ifdef CONFIG_ARMV7M_FPU_LAZYSWITCH
+  /* If the defunct thread owns the FPU register file, forget about it so
+   * that a later lazy spill does not write into freed memory.
+   */
+
+  arm_fpulazy_abandon(dtcb);
+#endif
+
   /* Is there a stack allocated? */
 
   if (dtcb->stack_alloc_ptr)
@@ -0,0 +1,91 @@
+/****************************************************************************
+ * arch/arm/src/common/arm_stackwatermark.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/sched.h>
+#include <arch/irq.h>
+
+#include "arm_internal.h"
+
+#ifdef CONFIG_STACK_WATERMARK
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_update_stack_watermark
+ *
+ * Description:
+ *   Update the peak stack usage watermark of the indicated thread from its
+ *   current stack pointer.  This is called when the thread is switched out
+ *   so that the watermark is maintained at every context switch with no
+ *   need to scan stack memory.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread being switched out
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void up_update_stack_watermark(FAR struct tcb_s *tcb)
+{
+  uintptr_t bottom = (uintptr_t)tcb->stack_alloc_ptr;
+  uintptr_t top    = (uintptr_t)tcb->adj_stack_ptr;
+  uintptr_t sp     = arm_getsp();
+  size_t used;
+
+  /* If the thread was preempted from interrupt handling logic, then the
+   * current stack pointer does not lie within the thread's stack.  In
+   * that case, use the stack pointer that was saved when the interrupt
+   * was taken.
+   */
+
+  if ((sp < bottom || sp >= top) && CURRENT_REGS != NULL)
+    {
+      sp = CURRENT_REGS[REG_SP];
+    }
+
+  /* Update the watermark, taking care never to trust a stack pointer that
+   * lies outside of the thread's stack allocation (as is the case for the
+   * IDLE thread before its stack information has been initialized).
+   */
+
+  if (sp >= bottom && sp < top)
+    {
+      used = top - sp;
+      if (used > tcb->stack_peak)
+        {
+          tcb->stack_peak = used;
+        }
+    }
+}
+
+#endif /* CONFIG_STACK_WATERMARK */
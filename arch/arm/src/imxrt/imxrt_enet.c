@@ -2563,6 +2563,14 @@ int imxrt_netinitialize(int intf)
   priv->dev.d_ioctl   = imxrt_ioctl;    /* Support PHY ioctl() calls */
 #endif
   priv->dev.d_private = g_enet;         /* Used to recover private state from dev */
+#ifdef CONFIG_NETDEV_HWCAPS
+  /* The receive accelerator is configured (via ENET_RACC) to discard any
+   * frame with a bad IPv4 header or protocol checksum, so the network
+   * layer need not verify checksums on receive.
+   */
+
+  priv->dev.d_capabilities = NETDEV_CAP_CSUM_RX;
+#endif
 
 #ifdef CONFIG_NET_ETHERNET
   /* Determine a semi-unique MAC address from MCU UID
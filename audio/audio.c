@@ -599,6 +599,50 @@ static int audio_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
         }
         break;
 
+      /* AUDIOIOC_ENQUEUEBUFFERS - Enqueue multiple audio buffers
+       *
+       *   ioctl argument:  pointer to an audio_bufs_desc_s structure
+       */
+
+      case AUDIOIOC_ENQUEUEBUFFERS:
+        {
+          FAR struct audio_bufs_desc_s *bufsdesc;
+          int i;
+
+          audinfo("AUDIOIOC_ENQUEUEBUFFERS\n");
+
+          DEBUGASSERT(lower->ops->enqueuebuffer != NULL);
+
+          bufsdesc = (FAR struct audio_bufs_desc_s *) arg;
+          DEBUGASSERT(bufsdesc->buffers != NULL);
+
+          /* Pass the buffers to the lower half driver in order, stopping
+           * at the first buffer that is refused.
+           */
+
+          ret = OK;
+          for (i = 0; i < bufsdesc->nbuffers; i++)
+            {
+              ret = lower->ops->enqueuebuffer(lower, bufsdesc->buffers[i]);
+              if (ret < 0)
+                {
+                  break;
+                }
+            }
+
+          /* Return the number of buffers enqueued.  The error is reported
+           * only if no buffer could be enqueued; otherwise the caller must
+           * learn of the partial enqueue from the return value and retry
+           * the remainder.
+           */
+
+          if (i > 0)
+            {
+              ret = i;
+            }
+        }
+        break;
+
       /* AUDIOIOC_REGISTERMQ - Register a client Message Queue
        *
        * TODO:  This needs to have multi session support.
@@ -51,6 +51,13 @@ struct audio_comp_priv_s
 
   FAR struct audio_lowerhalf_s **lower;
   int count;
+
+  /* Bitmask of processing components whose process method is currently
+   * bypassed (see AUDIOIOC_BYPASS).  Only the first 32 components can be
+   * bypassed.
+   */
+
+  uint32_t bypass;
 };
 
 /****************************************************************************
@@ -604,9 +611,33 @@ static int audio_comp_enqueuebuffer(FAR struct audio_lowerhalf_s *dev,
   int ret = -ENOTTY;
   int i;
 
+  /* First pass the buffer through each processing component in the chain.
+   * The samples are transformed in place so however long the chain is, no
+   * intermediate copy of the buffer is made.
+   */
+
+  for (i = 0; i < priv->count; i++)
+    {
+      if (lower[i]->ops->process &&
+          (i >= 32 || (priv->bypass & (1ul << i)) == 0))
+        {
+          ret = lower[i]->ops->process(lower[i], apb);
+          if (ret < 0 && ret != -ENOTTY)
+            {
+              return ret;
+            }
+        }
+    }
+
+  /* Then pass ownership of the buffer to the first component that will
+   * accept it.  Pure processing components (those providing a process
+   * method) never take ownership.
+   */
+
+  ret = -ENOTTY;
   for (i = 0; i < priv->count; i++)
     {
-      if (lower[i]->ops->enqueuebuffer)
+      if (lower[i]->ops->enqueuebuffer && !lower[i]->ops->process)
         {
           ret = lower[i]->ops->enqueuebuffer(lower[i], apb);
           if (ret != -ENOTTY)
@@ -664,6 +695,31 @@ static int audio_comp_ioctl(FAR struct audio_lowerhalf_s *dev, int cmd,
   int ret = -ENOTTY;
   int i;
 
+  /* The bypass command is directed at the composite itself */
+
+  if (cmd == AUDIOIOC_BYPASS)
+    {
+      FAR struct audio_comp_bypass_s *bp =
+        (FAR struct audio_comp_bypass_s *)((uintptr_t)arg);
+
+      if (bp == NULL || bp->index >= priv->count || bp->index >= 32 ||
+          lower[bp->index]->ops->process == NULL)
+        {
+          return -EINVAL;
+        }
+
+      if (bp->bypass)
+        {
+          priv->bypass |= (1ul << bp->index);
+        }
+      else
+        {
+          priv->bypass &= ~(1ul << bp->index);
+        }
+
+      return OK;
+    }
+
   for (i = 0; i < priv->count; i++)
     {
       if (lower[i]->ops->ioctl)
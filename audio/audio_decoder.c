@@ -0,0 +1,895 @@
+/****************************************************************************
+ * audio/audio_decoder.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/wqueue.h>
+#include <nuttx/audio/audio.h>
+#include <nuttx/audio/audio_decoder.h>
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes the internal state of one decoder device */
+
+struct audio_decoder_s
+{
+  /* This is is our appearance to the outside world.  This *MUST* be the
+   * first element of the structure so that we can freely cast between
+   * types struct audio_lowerhalf and struct audio_decoder_s.
+   */
+
+  struct audio_lowerhalf_s export;
+
+  /* These are our operations that intervene between the player application
+   * and the lower level driver.
+   */
+
+  struct audio_ops_s ops;
+
+  /* This is the contained, low-level DAC-type device and will receive the
+   * decoded audio data.
+   */
+
+  FAR struct audio_lowerhalf_s *lower;
+
+  /* Session returned from the lower level driver */
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  FAR void *session;
+#endif
+
+  /* The codec plugin selected for the current stream and its context.
+   * When no codec is selected, enqueued buffers pass straight through to
+   * the lower level driver.
+   */
+
+  FAR const struct audio_decoder_ops_s *codec;
+  FAR void *ctx;
+
+  /* Buffers awaiting decode and the work queue entry that drains them */
+
+  dq_queue_t pendq;
+  struct work_s work;
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static FAR const struct audio_decoder_ops_s *adec_findcodec(uint8_t format);
+static void adec_workproc(FAR void *arg);
+
+static int  adec_getcaps(FAR struct audio_lowerhalf_s *dev, int type,
+                         FAR struct audio_caps_s *caps);
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int  adec_configure(FAR struct audio_lowerhalf_s *dev,
+                           FAR void *session,
+                           FAR const struct audio_caps_s *caps);
+#else
+static int  adec_configure(FAR struct audio_lowerhalf_s *dev,
+                           FAR const struct audio_caps_s *caps);
+#endif
+static int  adec_shutdown(FAR struct audio_lowerhalf_s *dev);
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int  adec_start(FAR struct audio_lowerhalf_s *dev, FAR void *session);
+#else
+static int  adec_start(FAR struct audio_lowerhalf_s *dev);
+#endif
+#ifndef CONFIG_AUDIO_EXCLUDE_STOP
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int  adec_stop(FAR struct audio_lowerhalf_s *dev, FAR void *session);
+#else
+static int  adec_stop(FAR struct audio_lowerhalf_s *dev);
+#endif
+#endif
+#ifndef CONFIG_AUDIO_EXCLUDE_PAUSE_RESUME
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int  adec_pause(FAR struct audio_lowerhalf_s *dev, FAR void *session);
+static int  adec_resume(FAR struct audio_lowerhalf_s *dev,
+                        FAR void *session);
+#else
+static int  adec_pause(FAR struct audio_lowerhalf_s *dev);
+static int  adec_resume(FAR struct audio_lowerhalf_s *dev);
+#endif
+#endif
+static int  adec_allocbuffer(FAR struct audio_lowerhalf_s *dev,
+                             FAR struct audio_buf_desc_s *apb);
+static int  adec_freebuffer(FAR struct audio_lowerhalf_s *dev,
+                            FAR struct audio_buf_desc_s *apb);
+static int  adec_enqueuebuffer(FAR struct audio_lowerhalf_s *dev,
+                               FAR struct ap_buffer_s *apb);
+static int  adec_cancelbuffer(FAR struct audio_lowerhalf_s *dev,
+                              FAR struct ap_buffer_s *apb);
+static int  adec_ioctl(FAR struct audio_lowerhalf_s *dev,
+                       int cmd, unsigned long arg);
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int  adec_reserve(FAR struct audio_lowerhalf_s *dev,
+                         FAR void **session);
+static int  adec_release(FAR struct audio_lowerhalf_s *dev,
+                         FAR void *session);
+#else
+static int  adec_reserve(FAR struct audio_lowerhalf_s *dev);
+static int  adec_release(FAR struct audio_lowerhalf_s *dev);
+#endif
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static void adec_callback(FAR void *arg, uint16_t reason,
+                          FAR struct ap_buffer_s *apb, uint16_t status,
+                          FAR void *session);
+#else
+static void adec_callback(FAR void *arg, uint16_t reason,
+                          FAR struct ap_buffer_s *apb, uint16_t status);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The registry of codec plugins */
+
+static FAR const struct audio_decoder_ops_s *
+  g_adec_codecs[CONFIG_AUDIO_DECODER_NCODECS];
+static uint8_t g_adec_ncodecs;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: adec_findcodec
+ *
+ * Description:
+ *   Find the registered codec plugin, if any, for an AUDIO_FMT_* code.
+ *
+ ****************************************************************************/
+
+static FAR const struct audio_decoder_ops_s *adec_findcodec(uint8_t format)
+{
+  int i;
+
+  for (i = 0; i < g_adec_ncodecs; i++)
+    {
+      if (g_adec_codecs[i]->format == format)
+        {
+          return g_adec_codecs[i];
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: adec_workproc
+ *
+ * Description:
+ *   Low-priority work queue callback that drains the pending buffer queue.
+ *   Each buffer is decoded in place by the selected codec plugin and then
+ *   passed to the lower level driver.  Because this runs on the work queue
+ *   rather than on the application's enqueue call, decode proceeds ahead
+ *   of the device's consumption whenever the CPU is otherwise idle.
+ *
+ ****************************************************************************/
+
+static void adec_workproc(FAR void *arg)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)arg;
+  FAR struct ap_buffer_s *apb;
+  irqstate_t flags;
+  int ret;
+
+  DEBUGASSERT(priv && priv->codec);
+
+  for (; ; )
+    {
+      /* Remove the next buffer awaiting decode */
+
+      flags = enter_critical_section();
+      apb   = (FAR struct ap_buffer_s *)dq_remfirst(&priv->pendq);
+      leave_critical_section(flags);
+
+      if (apb == NULL)
+        {
+          break;
+        }
+
+      /* Decode the compressed data directly in the enqueued buffer */
+
+      ret = priv->codec->decode(priv->ctx, apb);
+      if (ret >= 0)
+        {
+          /* Pass the decoded buffer to the lower level driver */
+
+          ret = priv->lower->ops->enqueuebuffer(priv->lower, apb);
+        }
+
+      if (ret < 0)
+        {
+          /* The buffer never reached the device.  Return it to the
+           * application with the failure status.
+           */
+
+          auderr("ERROR: Failed to decode/enqueue buffer: %d\n", ret);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+          priv->export.upper(priv->export.priv, AUDIO_CALLBACK_DEQUEUE,
+                             apb, ret, NULL);
+#else
+          priv->export.upper(priv->export.priv, AUDIO_CALLBACK_DEQUEUE,
+                             apb, ret);
+#endif
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: adec_getcaps
+ *
+ * Description:
+ *   Get the lower-half device capabilities, adding the formats provided
+ *   by the registered codec plugins.
+ *
+ ****************************************************************************/
+
+static int adec_getcaps(FAR struct audio_lowerhalf_s *dev, int type,
+                        FAR struct audio_caps_s *caps)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+  int ret;
+  int i;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->getcaps);
+
+  ret = lower->ops->getcaps(lower, type, caps);
+  if (ret < 0)
+    {
+      auderr("ERROR: Lower getcaps() failed: %d\n", ret);
+      return ret;
+    }
+
+  /* Add the format of each registered codec to those reported by the
+   * lower driver.
+   */
+
+  if (caps->ac_subtype == AUDIO_TYPE_QUERY)
+    {
+      for (i = 0; i < g_adec_ncodecs; i++)
+        {
+          caps->ac_format.hw |= (1 << (g_adec_codecs[i]->format - 1));
+        }
+    }
+
+  return caps->ac_len;
+}
+
+/****************************************************************************
+ * Name: adec_configure
+ *
+ * Description:
+ *   Configure the audio device for the specified mode of operation.  If
+ *   the caller identifies a compressed stream format in ac_format.hw, the
+ *   matching codec plugin is selected for the stream; a zero format (or a
+ *   format with no registered codec) selects transparent pass-through.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int adec_configure(FAR struct audio_lowerhalf_s *dev,
+                          FAR void *session,
+                          FAR const struct audio_caps_s *caps)
+#else
+static int adec_configure(FAR struct audio_lowerhalf_s *dev,
+                          FAR const struct audio_caps_s *caps)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+  FAR const struct audio_decoder_ops_s *codec;
+  int ret;
+
+  DEBUGASSERT(priv && caps);
+
+  /* Does the configuration identify a stream format to be decoded? */
+
+  if (caps->ac_type == AUDIO_TYPE_OUTPUT && caps->ac_format.hw != 0)
+    {
+      codec = adec_findcodec((uint8_t)caps->ac_format.hw);
+      if (codec != priv->codec)
+        {
+          /* Release the context of any previously selected codec */
+
+          if (priv->codec != NULL && priv->codec->uninit != NULL)
+            {
+              priv->codec->uninit(priv->ctx);
+            }
+
+          priv->codec = codec;
+          priv->ctx   = NULL;
+
+          if (codec != NULL && codec->init != NULL)
+            {
+              ret = codec->init(&priv->ctx);
+              if (ret < 0)
+                {
+                  auderr("ERROR: Codec init failed: %d\n", ret);
+                  priv->codec = NULL;
+                  return ret;
+                }
+            }
+        }
+    }
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->configure);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  return lower->ops->configure(lower, session, caps);
+#else
+  return lower->ops->configure(lower, caps);
+#endif
+}
+
+/****************************************************************************
+ * Name: adec_shutdown
+ *
+ * Description:
+ *   Shutdown the decoder device, releasing any codec context.
+ *
+ ****************************************************************************/
+
+static int adec_shutdown(FAR struct audio_lowerhalf_s *dev)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  if (priv->codec != NULL && priv->codec->uninit != NULL)
+    {
+      priv->codec->uninit(priv->ctx);
+    }
+
+  priv->codec = NULL;
+  priv->ctx   = NULL;
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->shutdown);
+
+  return lower->ops->shutdown(lower);
+}
+
+/****************************************************************************
+ * Name: adec_start
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int adec_start(FAR struct audio_lowerhalf_s *dev, FAR void *session)
+#else
+static int adec_start(FAR struct audio_lowerhalf_s *dev)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->start);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  return lower->ops->start(lower, session);
+#else
+  return lower->ops->start(lower);
+#endif
+}
+
+/****************************************************************************
+ * Name: adec_stop
+ *
+ * Description:
+ *   Stop streaming.  Any buffers still awaiting decode are returned to
+ *   the application.
+ *
+ ****************************************************************************/
+
+#ifndef CONFIG_AUDIO_EXCLUDE_STOP
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int adec_stop(FAR struct audio_lowerhalf_s *dev, FAR void *session)
+#else
+static int adec_stop(FAR struct audio_lowerhalf_s *dev)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+  FAR struct ap_buffer_s *apb;
+  irqstate_t flags;
+
+  DEBUGASSERT(priv);
+
+  /* Stop the decode worker and return any undecoded buffers */
+
+  work_cancel(LPWORK, &priv->work);
+
+  for (; ; )
+    {
+      flags = enter_critical_section();
+      apb   = (FAR struct ap_buffer_s *)dq_remfirst(&priv->pendq);
+      leave_critical_section(flags);
+
+      if (apb == NULL)
+        {
+          break;
+        }
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+      priv->export.upper(priv->export.priv, AUDIO_CALLBACK_DEQUEUE,
+                         apb, OK, NULL);
+#else
+      priv->export.upper(priv->export.priv, AUDIO_CALLBACK_DEQUEUE,
+                         apb, OK);
+#endif
+    }
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->stop);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  return lower->ops->stop(lower, session);
+#else
+  return lower->ops->stop(lower);
+#endif
+}
+#endif
+
+/****************************************************************************
+ * Name: adec_pause
+ ****************************************************************************/
+
+#ifndef CONFIG_AUDIO_EXCLUDE_PAUSE_RESUME
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int adec_pause(FAR struct audio_lowerhalf_s *dev, FAR void *session)
+#else
+static int adec_pause(FAR struct audio_lowerhalf_s *dev)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->pause);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  return lower->ops->pause(lower, session);
+#else
+  return lower->ops->pause(lower);
+#endif
+}
+
+/****************************************************************************
+ * Name: adec_resume
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int adec_resume(FAR struct audio_lowerhalf_s *dev, FAR void *session)
+#else
+static int adec_resume(FAR struct audio_lowerhalf_s *dev)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->resume);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  return lower->ops->resume(lower, session);
+#else
+  return lower->ops->resume(lower);
+#endif
+}
+#endif /* CONFIG_AUDIO_EXCLUDE_PAUSE_RESUME */
+
+/****************************************************************************
+ * Name: adec_allocbuffer
+ ****************************************************************************/
+
+static int adec_allocbuffer(FAR struct audio_lowerhalf_s *dev,
+                            FAR struct audio_buf_desc_s *apb)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->allocbuffer);
+
+  return lower->ops->allocbuffer(lower, apb);
+}
+
+/****************************************************************************
+ * Name: adec_freebuffer
+ ****************************************************************************/
+
+static int adec_freebuffer(FAR struct audio_lowerhalf_s *dev,
+                           FAR struct audio_buf_desc_s *apb)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->freebuffer);
+
+  return lower->ops->freebuffer(lower, apb);
+}
+
+/****************************************************************************
+ * Name: adec_enqueuebuffer
+ *
+ * Description:
+ *   Enqueue a buffer for processing.  When a codec is selected, the
+ *   buffer is queued for decode on the low-priority work queue and this
+ *   call returns immediately; otherwise the buffer passes straight
+ *   through to the lower level driver.
+ *
+ ****************************************************************************/
+
+static int adec_enqueuebuffer(FAR struct audio_lowerhalf_s *dev,
+                              FAR struct ap_buffer_s *apb)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  irqstate_t flags;
+
+  DEBUGASSERT(priv && apb);
+
+  /* With no codec selected, the decoder is transparent */
+
+  if (priv->codec == NULL)
+    {
+      return priv->lower->ops->enqueuebuffer(priv->lower, apb);
+    }
+
+  /* Queue the buffer for decode and kick the worker if it is idle */
+
+  flags = enter_critical_section();
+  dq_addlast(&apb->dq_entry, &priv->pendq);
+  leave_critical_section(flags);
+
+  if (work_available(&priv->work))
+    {
+      work_queue(LPWORK, &priv->work, adec_workproc, priv, 0);
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: adec_cancelbuffer
+ *
+ * Description:
+ *   Cancel a previously enqueued buffer.  If the buffer is still awaiting
+ *   decode it is simply removed from the pending queue; otherwise the
+ *   cancellation is deferred to the lower level driver.
+ *
+ ****************************************************************************/
+
+static int adec_cancelbuffer(FAR struct audio_lowerhalf_s *dev,
+                             FAR struct ap_buffer_s *apb)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+  FAR dq_entry_t *entry;
+  irqstate_t flags;
+
+  DEBUGASSERT(priv && apb);
+
+  /* Is the buffer still awaiting decode? */
+
+  flags = enter_critical_section();
+  for (entry = dq_peek(&priv->pendq); entry != NULL; entry = entry->flink)
+    {
+      if (entry == &apb->dq_entry)
+        {
+          dq_rem(entry, &priv->pendq);
+          leave_critical_section(flags);
+          return OK;
+        }
+    }
+
+  leave_critical_section(flags);
+
+  /* No.. defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->cancelbuffer);
+
+  return lower->ops->cancelbuffer(lower, apb);
+}
+
+/****************************************************************************
+ * Name: adec_ioctl
+ ****************************************************************************/
+
+static int adec_ioctl(FAR struct audio_lowerhalf_s *dev, int cmd,
+                      unsigned long arg)
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->ioctl);
+
+  return lower->ops->ioctl(lower, cmd, arg);
+}
+
+/****************************************************************************
+ * Name: adec_reserve
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int adec_reserve(FAR struct audio_lowerhalf_s *dev,
+                        FAR void **session)
+#else
+static int adec_reserve(FAR struct audio_lowerhalf_s *dev)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+  int ret;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->reserve);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  ret = lower->ops->reserve(lower, &priv->session);
+  if (ret == OK)
+    {
+      *session = priv->session;
+    }
+#else
+  ret = lower->ops->reserve(lower);
+#endif
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: adec_release
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static int adec_release(FAR struct audio_lowerhalf_s *dev,
+                        FAR void *session)
+#else
+static int adec_release(FAR struct audio_lowerhalf_s *dev)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)dev;
+  FAR struct audio_lowerhalf_s *lower;
+
+  DEBUGASSERT(priv);
+
+  /* Defer the operation to the lower device driver */
+
+  lower = priv->lower;
+  DEBUGASSERT(lower && lower->ops->release);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  return lower->ops->release(lower, session);
+#else
+  return lower->ops->release(lower);
+#endif
+}
+
+/****************************************************************************
+ * Name: adec_callback
+ *
+ * Description:
+ *   Lower-to-upper level callback for buffer dequeueing.  The buffer
+ *   belongs to an upper level; just forward the event.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+static void adec_callback(FAR void *arg, uint16_t reason,
+                          FAR struct ap_buffer_s *apb, uint16_t status,
+                          FAR void *session)
+#else
+static void adec_callback(FAR void *arg, uint16_t reason,
+                          FAR struct ap_buffer_s *apb, uint16_t status)
+#endif
+{
+  FAR struct audio_decoder_s *priv = (FAR struct audio_decoder_s *)arg;
+
+  DEBUGASSERT(priv && priv->export.upper);
+
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  priv->export.upper(priv->export.priv, reason, apb, status, session);
+#else
+  priv->export.upper(priv->export.priv, reason, apb, status);
+#endif
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: audio_decoder_register
+ *
+ * Description:
+ *   Register one codec plugin with the decoder framework.
+ *
+ ****************************************************************************/
+
+int audio_decoder_register(FAR const struct audio_decoder_ops_s *ops)
+{
+  DEBUGASSERT(ops != NULL && ops->decode != NULL);
+
+  if (adec_findcodec(ops->format) != NULL)
+    {
+      return -EEXIST;
+    }
+
+  if (g_adec_ncodecs >= CONFIG_AUDIO_DECODER_NCODECS)
+    {
+      return -ENOSPC;
+    }
+
+  g_adec_codecs[g_adec_ncodecs++] = ops;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: audio_decoder_initialize
+ *
+ * Description:
+ *   Initialize the decoder device.  The decoder device accepts and
+ *   contains a low-level audio DAC-type device.  It then returns a new
+ *   audio lower half interface that decodes compressed audio buffers
+ *   through a registered codec plugin on the low-priority work queue.
+ *
+ ****************************************************************************/
+
+FAR struct audio_lowerhalf_s *
+  audio_decoder_initialize(FAR struct audio_lowerhalf_s *dev)
+{
+  FAR struct audio_decoder_s *priv;
+  FAR struct audio_ops_s *ops;
+
+  /* Allocate an instance of our private data structure */
+
+  priv = (FAR struct audio_decoder_s *)
+    kmm_zalloc(sizeof(struct audio_decoder_s));
+
+  if (!priv)
+    {
+      auderr("ERROR: Failed to allocate driver structure\n");
+      return NULL;
+    }
+
+  /* Initialize our private data structure.  Since kmm_zalloc() was used
+   * for the allocation, we need to initialize only non-zero, non-NULL,
+   * non-false fields.
+   */
+
+  /* Setup our operations */
+
+  ops                  = &priv->ops;
+  ops->getcaps         = adec_getcaps;
+  ops->configure       = adec_configure;
+  ops->shutdown        = adec_shutdown;
+  ops->start           = adec_start;
+
+#ifndef CONFIG_AUDIO_EXCLUDE_STOP
+  ops->stop            = adec_stop;
+#endif
+
+#ifndef CONFIG_AUDIO_EXCLUDE_PAUSE_RESUME
+  ops->pause           = adec_pause;
+  ops->resume          = adec_resume;
+#endif
+
+  if (dev->ops->allocbuffer)
+    {
+      DEBUGASSERT(dev->ops->freebuffer);
+      ops->allocbuffer = adec_allocbuffer;
+      ops->freebuffer  = adec_freebuffer;
+    }
+
+  ops->enqueuebuffer   = adec_enqueuebuffer;
+  ops->cancelbuffer    = adec_cancelbuffer;
+  ops->ioctl           = adec_ioctl;
+  ops->reserve         = adec_reserve;
+  ops->release         = adec_release;
+
+  /* Set up our struct audio_lower_half that we will register with the
+   * system.  The registration process will fill in the priv->export.upper
+   * and priv fields with the correct callback information.
+   */
+
+  priv->export.ops     = &priv->ops;
+
+  /* Initialize the queue of buffers awaiting decode */
+
+  dq_init(&priv->pendq);
+
+  /* Save the struct audio_lower_half of the low-level audio device.  Set
+   * our callback information for the lower-level audio device.  Our
+   * callback will simply forward to the upper callback.
+   */
+
+  priv->lower          = dev;
+  dev->upper           = adec_callback;
+  dev->priv            = priv;
+
+  return &priv->export;
+}
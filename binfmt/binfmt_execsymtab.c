@@ -39,10 +39,13 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
+#include <string.h>
 #include <assert.h>
 
 #include <nuttx/irq.h>
 #include <nuttx/arch.h>
+#include <nuttx/kmalloc.h>
 #include <nuttx/binfmt/symtab.h>
 
 #ifdef CONFIG_LIBC_EXECFUNCS
@@ -85,6 +88,107 @@ extern int CONFIG_EXECFUNCS_NSYMBOLS_VAR;
 static FAR const struct symtab_s *g_exec_symtab;
 static int g_exec_nsymbols;
 
+#ifdef CONFIG_SYMTAB_HASHTABLE
+/* The hash table over the current symbol table.  The first
+ * CONFIG_SYMTAB_HASHTABLE_NBUCKETS entries are the bucket heads; the
+ * following g_exec_nsymbols entries chain symbols that share a bucket.
+ * Entries are symbol table indices or -1 at the end of a chain.
+ * g_exec_hashed identifies the symbol table that the hash table was
+ * built over.
+ */
+
+static FAR const struct symtab_s *g_exec_hashed;
+static FAR int16_t *g_exec_hashtab;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_SYMTAB_HASHTABLE
+/****************************************************************************
+ * Name: exec_symtab_hash
+ *
+ * Description:
+ *   Return the hash bucket associated with a symbol name.
+ *
+ ****************************************************************************/
+
+static unsigned int exec_symtab_hash(FAR const char *name)
+{
+  uint32_t hash = 5381;
+
+  while (*name != '\0')
+    {
+      hash = hash * 33 + (uint8_t)*name++;
+    }
+
+  return hash % CONFIG_SYMTAB_HASHTABLE_NBUCKETS;
+}
+
+/****************************************************************************
+ * Name: exec_symtab_rehash
+ *
+ * Description:
+ *   Build the hash table over a symbol table and make it the current one.
+ *
+ ****************************************************************************/
+
+static void exec_symtab_rehash(FAR const struct symtab_s *symtab,
+                               int nsymbols)
+{
+  FAR int16_t *hashtab;
+  FAR int16_t *oldtab;
+  irqstate_t flags;
+  unsigned int bucket;
+  int i;
+
+  /* The chains are 16-bit symbol table indices */
+
+  if (nsymbols > INT16_MAX)
+    {
+      return;
+    }
+
+  hashtab = (FAR int16_t *)
+    kmm_malloc((CONFIG_SYMTAB_HASHTABLE_NBUCKETS + nsymbols) *
+               sizeof(int16_t));
+  if (hashtab == NULL)
+    {
+      return;
+    }
+
+  /* Mark all buckets empty, then push each symbol onto the chain of the
+   * bucket selected by its name.
+   */
+
+  for (i = 0; i < CONFIG_SYMTAB_HASHTABLE_NBUCKETS; i++)
+    {
+      hashtab[i] = -1;
+    }
+
+  for (i = 0; i < nsymbols; i++)
+    {
+      bucket = exec_symtab_hash(symtab[i].sym_name);
+      hashtab[CONFIG_SYMTAB_HASHTABLE_NBUCKETS + i] = hashtab[bucket];
+      hashtab[bucket] = i;
+    }
+
+  /* Install the new hash table and free any previous one */
+
+  flags           = enter_critical_section();
+  oldtab          = g_exec_hashtab;
+  g_exec_hashtab  = hashtab;
+  g_exec_hashed   = symtab;
+  leave_critical_section(flags);
+
+  if (oldtab != NULL)
+    {
+      kmm_free(oldtab);
+    }
+}
+#endif /* CONFIG_SYMTAB_HASHTABLE */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -165,7 +269,75 @@ void exec_setsymtab(FAR const struct symtab_s *symtab, int nsymbols)
   flags           = enter_critical_section();
   g_exec_symtab   = symtab;
   g_exec_nsymbols = nsymbols;
+
+#ifdef CONFIG_SYMTAB_HASHTABLE
+  /* Invalidate any hash table built over a previous symbol table.  It
+   * will be rebuilt on the next hashed lookup.
+   */
+
+  g_exec_hashed   = NULL;
+#endif
+
   leave_critical_section(flags);
 }
 
+#ifdef CONFIG_SYMTAB_HASHTABLE
+/****************************************************************************
+ * Name: exec_symtab_lookup
+ *
+ * Description:
+ *   Find a symbol in the currently selected symbol table using the hash
+ *   table, building the hash table first if necessary.  If 'symtab' is
+ *   not the currently selected symbol table (or if the hash table could
+ *   not be allocated), the lookup falls back to a linear search.
+ *
+ * Input Parameters:
+ *   symtab - The symbol table to be searched.
+ *   nsymbols - The number of symbols in the symbol table.
+ *   name - The name of the symbol to find.
+ *
+ * Returned Value:
+ *   A reference to the symbol table entry if an entry with the matching
+ *   name is found; NULL is returned if the entry is not found.
+ *
+ ****************************************************************************/
+
+FAR const struct symtab_s *
+exec_symtab_lookup(FAR const struct symtab_s *symtab, int nsymbols,
+                   FAR const char *name)
+{
+  int i;
+
+  DEBUGASSERT(symtab != NULL && name != NULL);
+
+  /* Build the hash table if it does not describe this symbol table */
+
+  if (g_exec_hashed != symtab)
+    {
+      exec_symtab_rehash(symtab, nsymbols);
+    }
+
+  if (g_exec_hashed == symtab)
+    {
+      /* Walk the chain of the bucket selected by the name */
+
+      for (i = g_exec_hashtab[exec_symtab_hash(name)];
+           i >= 0;
+           i = g_exec_hashtab[CONFIG_SYMTAB_HASHTABLE_NBUCKETS + i])
+        {
+          if (strcmp(name, symtab[i].sym_name) == 0)
+            {
+              return &symtab[i];
+            }
+        }
+
+      return NULL;
+    }
+
+  /* No hash table... fall back to the linear search */
+
+  return symtab_findbyname(symtab, name, nsymbols);
+}
+#endif /* CONFIG_SYMTAB_HASHTABLE */
+
 #endif /* CONFIG_LIBC_EXECFUNCS */
@@ -305,7 +305,10 @@ int elf_symvalue(FAR struct elf_loadinfo_s *loadinfo, FAR Elf_Sym *sym,
 
         /* Check if the base code exports a symbol of this name */
 
-#ifdef CONFIG_SYMTAB_ORDEREDBYNAME
+#if defined(CONFIG_SYMTAB_HASHTABLE)
+        symbol = exec_symtab_lookup(exports, nexports,
+                                    (FAR char *)loadinfo->iobuffer);
+#elif defined(CONFIG_SYMTAB_ORDEREDBYNAME)
         symbol = symtab_findorderedbyname(exports,
                                           (FAR char *)loadinfo->iobuffer,
                                           nexports);
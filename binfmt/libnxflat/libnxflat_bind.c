@@ -35,6 +35,7 @@
 
 #include <arpa/inet.h>
 
+#include <nuttx/kmalloc.h>
 #include <nuttx/binfmt/nxflat.h>
 #include <nuttx/binfmt/symtab.h>
 
@@ -58,10 +59,55 @@
 # define nxflat_dumpbuffer(m,b,n)
 #endif
 
+/* Size of the per-load resolved symbol memo used while binding imports.
+ * Must be a power of two.
+ */
+
+#define NXFLAT_BINDMEMO_NBUCKETS 64
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One entry of the resolved symbol memo:  The name of an imported symbol
+ * that was already looked up and the symbol table entry that it resolved
+ * to.
+ */
+
+struct nxflat_bindmemo_s
+{
+  FAR const char *name;
+  FAR const struct symtab_s *symbol;
+};
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: nxflat_symname_hash
+ *
+ * Description:
+ *   Return a hash of the symbol name suitable for indexing the resolved
+ *   symbol memo.
+ *
+ * Returned Value:
+ *   A bucket index in the range 0..NXFLAT_BINDMEMO_NBUCKETS-1.
+ *
+ ****************************************************************************/
+
+static uint32_t nxflat_symname_hash(FAR const char *name)
+{
+  uint32_t hash = 5381;
+
+  while (*name != '\0')
+    {
+      hash = ((hash << 5) + hash) ^ (uint8_t)*name++;
+    }
+
+  return hash & (NXFLAT_BINDMEMO_NBUCKETS - 1);
+}
+
 /****************************************************************************
  * Name: nxflat_bindrel32i
  *
@@ -378,9 +424,11 @@ static inline int nxflat_bindimports(FAR struct nxflat_loadinfo_s *loadinfo,
   FAR struct nxflat_import_s *imports;
   FAR struct nxflat_hdr_s    *hdr;
   FAR const struct symtab_s  *symbol;
+  FAR struct nxflat_bindmemo_s *memo = NULL;
 
   char    *symname;
   uint32_t offset;
+  uint32_t hash;
   uint16_t nimports;
 #ifdef CONFIG_ARCH_ADDRENV
   int      ret;
@@ -435,6 +483,17 @@ static inline int nxflat_bindimports(FAR struct nxflat_loadinfo_s *loadinfo,
       imports = (FAR struct nxflat_import_s *)
         (offset - loadinfo->isize + loadinfo->dspace->region);
 
+      /* The toolchain emits one import entry per reference so the same
+       * symbol name commonly appears many times in the import list.
+       * Memoize resolved symbols in a small, direct-mapped hash so that
+       * duplicate imports cost a hash probe instead of a full symbol
+       * table lookup.  Binding still works (just more slowly) if this
+       * allocation fails.
+       */
+
+      memo = (FAR struct nxflat_bindmemo_s *)
+        kmm_zalloc(NXFLAT_BINDMEMO_NBUCKETS * sizeof(*memo));
+
       /* Now, traverse the list of imported symbols and attempt to bind
        * each symbol to the value exported by from the exported symbol
        * table.
@@ -459,20 +518,47 @@ static inline int nxflat_bindimports(FAR struct nxflat_loadinfo_s *loadinfo,
           symname = (FAR char *)
             (offset + loadinfo->ispace + sizeof(struct nxflat_hdr_s));
 
-          /* Find the exported symbol value for this symbol name. */
+          /* Was this symbol name already resolved by an earlier import? */
+
+          hash   = nxflat_symname_hash(symname);
+          symbol = NULL;
 
-#ifdef CONFIG_SYMTAB_ORDEREDBYNAME
-          symbol = symtab_findorderedbyname(exports, symname, nexports);
+          if (memo != NULL && memo[hash].name != NULL &&
+              strcmp(memo[hash].name, symname) == 0)
+            {
+              symbol = memo[hash].symbol;
+            }
+
+          if (symbol == NULL)
+            {
+              /* No.. find the exported symbol value for this symbol name. */
+
+#if defined(CONFIG_SYMTAB_HASHTABLE)
+              symbol = exec_symtab_lookup(exports, nexports, symname);
+#elif defined(CONFIG_SYMTAB_ORDEREDBYNAME)
+              symbol = symtab_findorderedbyname(exports, symname, nexports);
 #else
-          symbol = symtab_findbyname(exports, symname, nexports);
+              symbol = symtab_findbyname(exports, symname, nexports);
 #endif
-          if (!symbol)
-            {
-              berr("Exported symbol \"%s\" not found\n", symname);
+              if (!symbol)
+                {
+                  berr("Exported symbol \"%s\" not found\n", symname);
+                  kmm_free(memo);
 #ifdef CONFIG_ARCH_ADDRENV
-              nxflat_addrenv_restore(loadinfo);
+                  nxflat_addrenv_restore(loadinfo);
 #endif
-              return -ENOENT;
+                  return -ENOENT;
+                }
+
+              /* Remember the resolution for later duplicate imports.  On
+               * a collision, the most recently resolved name wins.
+               */
+
+              if (memo != NULL)
+                {
+                  memo[hash].name   = symname;
+                  memo[hash].symbol = symbol;
+                }
             }
 
           /* And put this into the module's import structure. */
@@ -482,6 +568,12 @@ static inline int nxflat_bindimports(FAR struct nxflat_loadinfo_s *loadinfo,
           binfo("Bound import[%d] (%p) to export '%s' (%08" PRIx32 ")\n",
                 i, &imports[i], symname, imports[i].i_funcaddress);
         }
+
+      /* The memo (and the I-Space names that it references) are only
+       * valid during binding.
+       */
+
+      kmm_free(memo);
     }
 
   /* Dump the relocation import table */
@@ -43,13 +43,10 @@
 
 #include <debug.h>
 
+#include <nuttx/arch.h>
 #include <nuttx/board.h>
 #include <arch/board/board.h>
 
-#include "arm_arch.h"
-#include "nvic.h"
-#include "itm.h"
-
 #include "stm32.h"
 #include "omnibusf4.h"
 
@@ -70,17 +67,13 @@
 
 void stm32_boardinitialize(void)
 {
-#ifdef CONFIG_SCHED_CRITMONITOR
-  /* Enable ITM and DWT resources, if not left enabled by debugger. */
-
-  modifyreg32(NVIC_DEMCR, 0, NVIC_DEMCR_TRCENA);
-
-  /* Make sure the high speed cycle counter is running.  It will be started
-   * automatically only if a debugger is connected.
+#ifdef CONFIG_ARCH_PERF_EVENTS
+  /* Start the DWT cycle counter as the perf counter timebase.  This also
+   * enables the ITM and DWT resources if they were not left enabled by a
+   * debugger.
    */
 
-  putreg32(0xc5acce55, ITM_LAR);
-  modifyreg32(DWT_CTRL, 0, DWT_CTRL_CYCCNTENA_MASK);
+  up_perf_init((FAR void *)STM32_SYSCLK_FREQUENCY);
 #endif
 
 #if defined(CONFIG_STM32_SPI1) || defined(CONFIG_STM32_SPI2) || defined(CONFIG_STM32_SPI3)
@@ -77,6 +77,10 @@ static int cryptodev_ioctl(FAR struct file *filep,
                            int cmd,
                            unsigned long arg);
 
+#ifdef CONFIG_CRYPTO_AES
+static int cryptodev_op(FAR struct crypt_op *op);
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -113,6 +117,43 @@ static ssize_t cryptodev_write(FAR struct file *filep,
   return -EACCES;
 }
 
+#ifdef CONFIG_CRYPTO_AES
+static int cryptodev_op(FAR struct crypt_op *op)
+{
+  FAR struct session_op *ses = (FAR struct session_op *)op->ses;
+  int encrypt;
+
+  switch (op->op)
+    {
+    case COP_ENCRYPT:
+      encrypt = 1;
+      break;
+
+    case COP_DECRYPT:
+      encrypt = 0;
+      break;
+
+    default:
+      return -EINVAL;
+    }
+
+  switch (ses->cipher)
+    {
+    case CRYPTO_AES_ECB:
+      return AES_CYPHER(AES_MODE_ECB);
+
+    case CRYPTO_AES_CBC:
+      return AES_CYPHER(AES_MODE_CBC);
+
+    case CRYPTO_AES_CTR:
+      return AES_CYPHER(AES_MODE_CTR);
+
+    default:
+       return -EINVAL;
+    }
+}
+#endif
+
 static int cryptodev_ioctl(FAR struct file *filep,
                            int cmd,
                            unsigned long arg)
@@ -134,38 +175,33 @@ static int cryptodev_ioctl(FAR struct file *filep,
 #ifdef CONFIG_CRYPTO_AES
   case CIOCCRYPT:
     {
-      FAR struct crypt_op *op    = (FAR struct crypt_op *)arg;
-      FAR struct session_op *ses = (FAR struct session_op *)op->ses;
-      int encrypt;
+      return cryptodev_op((FAR struct crypt_op *)arg);
+    }
 
-      switch (op->op)
+  case CIOCNCRYPTM:
+    {
+      FAR struct crypt_mop *mop = (FAR struct crypt_mop *)arg;
+      unsigned count            = mop->count;
+      unsigned i;
+      int ret;
+
+      /* Perform each operation of the batch in order, holding the session
+       * key and cipher state across the whole batch.  Processing stops at
+       * the first failure; mop->count reports how many operations
+       * completed.
+       */
+
+      for (i = 0; i < count; i++)
         {
-        case COP_ENCRYPT:
-          encrypt = 1;
-          break;
-
-        case COP_DECRYPT:
-          encrypt = 0;
-          break;
-
-        default:
-          return -EINVAL;
+          ret = cryptodev_op(&mop->reqs[i]);
+          if (ret < 0)
+            {
+              mop->count = i;
+              return ret;
+            }
         }
 
-      switch (ses->cipher)
-        {
-        case CRYPTO_AES_ECB:
-          return AES_CYPHER(AES_MODE_ECB);
-
-        case CRYPTO_AES_CBC:
-          return AES_CYPHER(AES_MODE_CBC);
-
-        case CRYPTO_AES_CTR:
-          return AES_CYPHER(AES_MODE_CTR);
-
-        default:
-           return -EINVAL;
-        }
+      return OK;
     }
 #endif
 
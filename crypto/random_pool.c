@@ -91,6 +91,10 @@ struct rng_s
   volatile uint16_t rd_prev_irq;
   bool output_initialized;
   struct blake2xs_rng_s blake2xs;
+#if CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE > 0
+  size_t rd_bufpos;  /* Offset of first unconsumed pre-generated byte */
+  uint8_t rd_buf[CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE];
+#endif
 };
 
 enum
@@ -374,6 +378,40 @@ static void rng_buf_internal(FAR void *bytes, size_t nbytes)
     }
 }
 
+#if CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE > 0
+static void rng_buf_buffered(FAR void *bytes, size_t nbytes)
+{
+  size_t avail = CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE - g_rng.rd_bufpos;
+
+  /* Large requests bypass the buffer and are generated directly. */
+
+  if (nbytes >= CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE / 2)
+    {
+      rng_buf_internal(bytes, nbytes);
+      return;
+    }
+
+  /* Refill the whole buffer in one batch when it cannot satisfy the
+   * request.  This amortizes the BLAKE2Xs output function over many
+   * requests; the requests themselves are satisfied with a memcpy.
+   */
+
+  if (avail < nbytes)
+    {
+      rng_buf_internal(g_rng.rd_buf, CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE);
+      g_rng.rd_bufpos = 0;
+    }
+
+  /* Copy out pre-generated bytes and zeroize them so that previously
+   * returned output cannot be recovered from the buffer later.
+   */
+
+  memcpy(bytes, &g_rng.rd_buf[g_rng.rd_bufpos], nbytes);
+  explicit_bzero(&g_rng.rd_buf[g_rng.rd_bufpos], nbytes);
+  g_rng.rd_bufpos += nbytes;
+}
+#endif
+
 static void rng_init(void)
 {
   cryptinfo("Initializing RNG\n");
@@ -381,6 +419,14 @@ static void rng_init(void)
   memset(&g_rng, 0, sizeof(struct rng_s));
   nxsem_init(&g_rng.rd_sem, 0, 1);
 
+#if CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE > 0
+  /* Mark the pre-generated output buffer as fully consumed so that the
+   * first request triggers a batch refill.
+   */
+
+  g_rng.rd_bufpos = CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE;
+#endif
+
   /* We do not initialize output here because this is called
    * quite early in boot and there may not be enough entropy.
    *
@@ -518,6 +564,13 @@ void up_rngreseed(void)
       if (g_rng.rd_newentr >= MIN_SEED_NEW_ENTROPY_WORDS)
         {
           rng_reseed();
+
+#if CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE > 0
+          /* Discard pre-generated output from before the reseed */
+
+          explicit_bzero(g_rng.rd_buf, CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE);
+          g_rng.rd_bufpos = CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE;
+#endif
         }
 
       nxsem_post(&g_rng.rd_sem);
@@ -568,7 +621,11 @@ void getrandom(FAR void *bytes, size_t nbytes)
   ret = nxsem_wait_uninterruptible(&g_rng.rd_sem);
   if (ret >= 0)
     {
+#if CONFIG_CRYPTO_RANDOM_POOL_BUFSIZE > 0
+      rng_buf_buffered(bytes, nbytes);
+#else
       rng_buf_internal(bytes, nbytes);
+#endif
       nxsem_post(&g_rng.rd_sem);
     }
 }
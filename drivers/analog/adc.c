@@ -58,6 +58,7 @@
 #include <nuttx/fs/fs.h>
 #include <nuttx/arch.h>
 #include <nuttx/analog/adc.h>
+#include <nuttx/analog/ioctl.h>
 #include <nuttx/random.h>
 
 #include <nuttx/irq.h>
@@ -73,6 +74,11 @@ static ssize_t adc_read(FAR struct file *fielp, FAR char *buffer,
 static int     adc_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
 static int     adc_receive(FAR struct adc_dev_s *dev, uint8_t ch,
                            int32_t data);
+#ifdef CONFIG_ADC_STREAM
+static int     adc_receive_batch(FAR struct adc_dev_s *dev,
+                                 FAR const struct adc_msg_s *buffer,
+                                 size_t count);
+#endif
 static void    adc_notify(FAR struct adc_dev_s *dev);
 static int     adc_poll(FAR struct file *filep, struct pollfd *fds,
                         bool setup);
@@ -97,7 +103,10 @@ static const struct file_operations g_adc_fops =
 
 static const struct adc_callback_s g_adc_callback =
 {
-  adc_receive   /* au_receive */
+  adc_receive         /* au_receive */
+#ifdef CONFIG_ADC_STREAM
+  , adc_receive_batch /* au_receive_batch */
+#endif
 };
 
 /****************************************************************************
@@ -415,10 +424,70 @@ static int adc_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
   FAR struct adc_dev_s *dev = inode->i_private;
   int ret;
 
+#ifdef CONFIG_ADC_STREAM
+  /* Handle the streaming mode commands in the upper half */
+
+  switch (cmd)
+    {
+      /* ANIOC_STREAM_WATERMARK - Set the notification watermark.
+       *   Argument: The watermark in samples.
+       */
+
+      case ANIOC_STREAM_WATERMARK:
+        {
+          if (arg >= CONFIG_ADC_FIFOSIZE)
+            {
+              return -EINVAL;
+            }
+
+          dev->ad_watermark = (uint16_t)arg;
+          return OK;
+        }
+
+      /* ANIOC_STREAM_CHANMASK - Select the channels retained in the FIFO.
+       *   Argument: A 32-bit channel mask; bit n corresponds to channel n.
+       */
+
+      case ANIOC_STREAM_CHANMASK:
+        {
+          dev->ad_chanmask = (uint32_t)arg;
+          return OK;
+        }
+
+      default:
+        break;
+    }
+#endif
+
   ret = dev->ad_ops->ao_ioctl(dev, cmd, arg);
   return ret;
 }
 
+/****************************************************************************
+ * Name: adc_watermark_reached
+ *
+ * Description:
+ *   Return true if enough samples are buffered to notify readers.  A
+ *   watermark of zero preserves the default behavior of notifying on
+ *   every sample.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ADC_STREAM
+static bool adc_watermark_reached(FAR struct adc_dev_s *dev)
+{
+  int navail;
+
+  navail = (int)dev->ad_recv.af_tail - (int)dev->ad_recv.af_head;
+  if (navail < 0)
+    {
+      navail += CONFIG_ADC_FIFOSIZE;
+    }
+
+  return navail >= (dev->ad_watermark > 0 ? dev->ad_watermark : 1);
+}
+#endif
+
 /****************************************************************************
  * Name: adc_receive
  ****************************************************************************/
@@ -429,6 +498,15 @@ static int adc_receive(FAR struct adc_dev_s *dev, uint8_t ch, int32_t data)
   int                    nexttail;
   int                    errcode = -ENOMEM;
 
+#ifdef CONFIG_ADC_STREAM
+  /* Discard samples from channels that have been masked out */
+
+  if (ch < 32 && (dev->ad_chanmask & (1ul << ch)) == 0)
+    {
+      return OK;
+    }
+#endif
+
   /* Check if adding this new message would over-run the drivers ability to
    * enqueue read data.
    */
@@ -452,14 +530,98 @@ static int adc_receive(FAR struct adc_dev_s *dev, uint8_t ch, int32_t data)
 
       fifo->af_tail = nexttail;
 
+#ifdef CONFIG_ADC_STREAM
+      if (adc_watermark_reached(dev))
+        {
+          adc_notify(dev);
+        }
+#else
       adc_notify(dev);
+#endif
 
       errcode = OK;
     }
+#ifdef CONFIG_ADC_STREAM
+  else
+    {
+      dev->ad_overruns++;
+    }
+#endif
 
   return errcode;
 }
 
+/****************************************************************************
+ * Name: adc_receive_batch
+ *
+ * Description:
+ *   Enqueue a whole buffer of decoded samples -- normally one half of a
+ *   DMA ping-pong buffer -- with a single critical section and at most
+ *   one reader notification.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_ADC_STREAM
+static int adc_receive_batch(FAR struct adc_dev_s *dev,
+                             FAR const struct adc_msg_s *buffer,
+                             size_t count)
+{
+  FAR struct adc_fifo_s *fifo = &dev->ad_recv;
+  irqstate_t             flags;
+  int                    nexttail;
+  int                    nqueued = 0;
+  size_t                 i;
+
+  DEBUGASSERT(buffer != NULL);
+
+  /* This callback is normally invoked from the DMA completion interrupt,
+   * but may also be called from a worker thread by polled lower halves.
+   */
+
+  flags = enter_critical_section();
+
+  for (i = 0; i < count; i++)
+    {
+      uint8_t ch = buffer[i].am_channel;
+
+      /* Discard samples from channels that have been masked out */
+
+      if (ch < 32 && (dev->ad_chanmask & (1ul << ch)) == 0)
+        {
+          continue;
+        }
+
+      /* Refuse the remaining data if the FIFO is full */
+
+      nexttail = fifo->af_tail + 1;
+      if (nexttail >= CONFIG_ADC_FIFOSIZE)
+        {
+          nexttail = 0;
+        }
+
+      if (nexttail == fifo->af_head)
+        {
+          dev->ad_overruns += count - i;
+          break;
+        }
+
+      fifo->af_buffer[fifo->af_tail] = buffer[i];
+      fifo->af_tail = nexttail;
+      nqueued++;
+    }
+
+  /* Notify readers at most once for the whole buffer */
+
+  if (nqueued > 0 && adc_watermark_reached(dev))
+    {
+      adc_notify(dev);
+    }
+
+  leave_critical_section(flags);
+  return nqueued;
+}
+#endif
+
 /****************************************************************************
  * Name: adc_pollnotify
  ****************************************************************************/
@@ -558,7 +720,11 @@ static int adc_poll(FAR struct file *filep, struct pollfd *fds, bool setup)
 
       /* Should we immediately notify on any of the requested events? */
 
+#ifdef CONFIG_ADC_STREAM
+      if (adc_watermark_reached(dev))
+#else
       if (dev->ad_recv.af_head != dev->ad_recv.af_tail)
+#endif
         {
           adc_pollnotify(dev, POLLIN);
         }
@@ -608,6 +774,14 @@ int adc_register(FAR const char *path, FAR struct adc_dev_s *dev)
 
   dev->ad_ocount = 0;
 
+#ifdef CONFIG_ADC_STREAM
+  /* Retain all channels and notify on every sample by default */
+
+  dev->ad_watermark = 0;
+  dev->ad_chanmask  = 0xffffffff;
+  dev->ad_overruns  = 0;
+#endif
+
   /* Initialize semaphores */
 
   nxsem_init(&dev->ad_recv.af_sem, 0, 0);
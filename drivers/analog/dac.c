@@ -56,8 +56,10 @@
 
 #include <nuttx/arch.h>
 #include <nuttx/signal.h>
+#include <nuttx/kmalloc.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/analog/dac.h>
+#include <nuttx/analog/ioctl.h>
 
 #include <nuttx/irq.h>
 
@@ -79,6 +81,13 @@ static ssize_t dac_read(FAR struct file *filep, FAR char *buffer,
 static ssize_t dac_write(FAR struct file *filep, FAR const char *buffer,
                  size_t buflen);
 static int     dac_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
+#ifdef CONFIG_DAC_WAVEFORM
+static void    dac_wavesend(FAR struct dac_dev_s *dev);
+static ssize_t dac_wavewrite(FAR struct file *filep, FAR struct dac_dev_s *dev,
+                 FAR const char *buffer, size_t buflen);
+static int     dac_wavestart(FAR struct dac_dev_s *dev, uint8_t channel);
+static int     dac_wavestop(FAR struct dac_dev_s *dev);
+#endif
 
 /****************************************************************************
  * Private Data
@@ -208,6 +217,12 @@ static int dac_close(FAR struct file *filep)
                nxsig_usleep(HALF_SECOND_USEC);
             }
 
+#ifdef CONFIG_DAC_WAVEFORM
+          /* Drain and stop any waveform playback in progress */
+
+          dac_wavestop(dev);
+#endif
+
           /* Free the IRQ and disable the DAC device */
 
           flags = enter_critical_section();    /* Disable interrupts */
@@ -265,6 +280,257 @@ static int dac_xmit(FAR struct dac_dev_s *dev)
   return ret;
 }
 
+/****************************************************************************
+ * Name: dac_wavesend
+ *
+ * Description:
+ *   If no buffer is currently streaming, hand the buffer at the head of
+ *   the filled queue to the lower half.
+ *
+ * Assumptions:
+ *   Called with interrupts disabled
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DAC_WAVEFORM
+static void dac_wavesend(FAR struct dac_dev_s *dev)
+{
+  FAR struct dac_wavebuffer_s *wb;
+  int ret;
+
+  if (!dev->ad_wavebusy && dev->ad_wavehead != NULL)
+    {
+      /* Remove the buffer at the head of the filled queue */
+
+      wb = dev->ad_wavehead;
+      dev->ad_wavehead = wb->wb_flink;
+      if (dev->ad_wavehead == NULL)
+        {
+          dev->ad_wavetail = NULL;
+        }
+
+      wb->wb_flink = NULL;
+
+      /* And stream it.  The buffer will be recycled by dac_wavedone() */
+
+      dev->ad_wavebusy = true;
+
+      ret = dev->ad_ops->ao_sendbuffer(dev, wb);
+      if (ret < 0)
+        {
+          aerr("ERROR: ao_sendbuffer failed: %d\n", ret);
+
+          /* Streaming failed; recycle the buffer */
+
+          wb->wb_flink     = dev->ad_wavefree;
+          dev->ad_wavefree = wb;
+          dev->ad_wavebusy = false;
+        }
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: dac_wavewrite
+ *
+ * Description:
+ *   The write() logic in waveform playback mode:  The write data is
+ *   treated as an array of left-justified 32-bit samples that is chunked
+ *   into waveform buffers and queued for streaming.  The caller blocks
+ *   only when all buffers are filled and awaiting the hardware.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DAC_WAVEFORM
+static ssize_t dac_wavewrite(FAR struct file *filep,
+                             FAR struct dac_dev_s *dev,
+                             FAR const char *buffer, size_t buflen)
+{
+  FAR const uint32_t *samples = (FAR const uint32_t *)buffer;
+  FAR struct dac_wavebuffer_s *wb;
+  size_t nsamples = buflen / sizeof(uint32_t);
+  size_t nwritten = 0;
+  size_t count;
+  irqstate_t flags;
+  int ret = OK;
+
+  if (nsamples < 1)
+    {
+      return -EINVAL;
+    }
+
+  /* Interrupts must be disabled throughout the following */
+
+  flags = enter_critical_section();
+
+  while (nwritten < nsamples)
+    {
+      /* Wait for a free buffer */
+
+      while (dev->ad_wavefree == NULL)
+        {
+          if (filep->f_oflags & O_NONBLOCK)
+            {
+              ret = -EAGAIN;
+              goto return_with_irqdisabled;
+            }
+
+          dev->ad_wavewaiters++;
+          ret = nxsem_wait_uninterruptible(&dev->ad_wavesem);
+          dev->ad_wavewaiters--;
+          if (ret < 0)
+            {
+              goto return_with_irqdisabled;
+            }
+        }
+
+      /* Fill the buffer from the write data */
+
+      wb = dev->ad_wavefree;
+      dev->ad_wavefree = wb->wb_flink;
+
+      count = nsamples - nwritten;
+      if (count > CONFIG_DAC_WAVEFORM_BUFSIZE)
+        {
+          count = CONFIG_DAC_WAVEFORM_BUFSIZE;
+        }
+
+      memcpy(wb->wb_samples, &samples[nwritten],
+             count * sizeof(uint32_t));
+
+      wb->wb_nsamples = count;
+      wb->wb_channel  = dev->ad_wavechan;
+      wb->wb_flink    = NULL;
+
+      /* Append the buffer to the filled queue */
+
+      if (dev->ad_wavetail != NULL)
+        {
+          dev->ad_wavetail->wb_flink = wb;
+        }
+      else
+        {
+          dev->ad_wavehead = wb;
+        }
+
+      dev->ad_wavetail = wb;
+      nwritten        += count;
+
+      /* Kick off streaming if the hardware is idle */
+
+      dac_wavesend(dev);
+    }
+
+return_with_irqdisabled:
+  leave_critical_section(flags);
+  return nwritten > 0 ? (ssize_t)(nwritten * sizeof(uint32_t)) : ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: dac_wavestart
+ *
+ * Description:
+ *   Allocate the waveform buffer pool and enter waveform playback mode.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DAC_WAVEFORM
+static int dac_wavestart(FAR struct dac_dev_s *dev, uint8_t channel)
+{
+  FAR struct dac_wavebuffer_s *bufs;
+  irqstate_t flags;
+  int i;
+
+  /* Waveform playback requires the ao_sendbuffer method */
+
+  if (dev->ad_ops->ao_sendbuffer == NULL)
+    {
+      return -ENOSYS;
+    }
+
+  if (dev->ad_wavemode)
+    {
+      return -EBUSY;
+    }
+
+  /* Allocate the buffer pool */
+
+  bufs = (FAR struct dac_wavebuffer_s *)
+    kmm_zalloc(CONFIG_DAC_WAVEFORM_NBUFFERS *
+               sizeof(struct dac_wavebuffer_s));
+  if (bufs == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  /* Place all buffers on the free list and enter playback mode */
+
+  flags = enter_critical_section();
+
+  dev->ad_wavebufs = bufs;
+  dev->ad_wavefree = NULL;
+
+  for (i = 0; i < CONFIG_DAC_WAVEFORM_NBUFFERS; i++)
+    {
+      bufs[i].wb_flink = dev->ad_wavefree;
+      dev->ad_wavefree = &bufs[i];
+    }
+
+  dev->ad_wavehead = NULL;
+  dev->ad_wavetail = NULL;
+  dev->ad_wavebusy = false;
+  dev->ad_wavechan = channel;
+  dev->ad_wavemode = true;
+
+  leave_critical_section(flags);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: dac_wavestop
+ *
+ * Description:
+ *   Drain any pending waveform buffers, leave waveform playback mode and
+ *   free the buffer pool.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DAC_WAVEFORM
+static int dac_wavestop(FAR struct dac_dev_s *dev)
+{
+  FAR struct dac_wavebuffer_s *bufs;
+  irqstate_t flags;
+
+  if (!dev->ad_wavemode)
+    {
+      return OK;
+    }
+
+  /* Now we wait for the filled queue to drain */
+
+  while (dev->ad_wavehead != NULL || dev->ad_wavebusy)
+    {
+      nxsig_usleep(HALF_SECOND_USEC);
+    }
+
+  flags = enter_critical_section();
+
+  bufs             = dev->ad_wavebufs;
+  dev->ad_wavemode = false;
+  dev->ad_wavebufs = NULL;
+  dev->ad_wavefree = NULL;
+  dev->ad_wavehead = NULL;
+  dev->ad_wavetail = NULL;
+
+  leave_critical_section(flags);
+
+  kmm_free(bufs);
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: dac_write
  ****************************************************************************/
@@ -283,6 +549,15 @@ static ssize_t dac_write(FAR struct file *filep, FAR const char *buffer,
   int                    msglen;
   int                    ret   = 0;
 
+#ifdef CONFIG_DAC_WAVEFORM
+  /* In waveform playback mode the write data is a stream of samples */
+
+  if (dev->ad_wavemode)
+    {
+      return dac_wavewrite(filep, dev, buffer, buflen);
+    }
+#endif
+
   /* Interrupts must be disabled throughout the following */
 
   flags = enter_critical_section();
@@ -452,6 +727,31 @@ static int dac_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
   FAR struct dac_dev_s *dev = inode->i_private;
   int ret;
 
+#ifdef CONFIG_DAC_WAVEFORM
+  /* Handle the waveform playback commands in the upper half */
+
+  switch (cmd)
+    {
+      /* ANIOC_WAVE_START - Enter waveform playback mode.
+       *   Argument: The DAC channel number.
+       */
+
+      case ANIOC_WAVE_START:
+        return dac_wavestart(dev, (uint8_t)arg);
+
+      /* ANIOC_WAVE_STOP - Drain pending buffers and leave waveform
+       *   playback mode.
+       *   Argument: None.
+       */
+
+      case ANIOC_WAVE_STOP:
+        return dac_wavestop(dev);
+
+      default:
+        break;
+    }
+#endif
+
   ret = dev->ad_ops->ao_ioctl(dev, cmd, arg);
   return ret;
 }
@@ -506,6 +806,51 @@ int dac_txdone(FAR struct dac_dev_s *dev)
   return ret;
 }
 
+/****************************************************************************
+ * Name: dac_wavedone
+ *
+ * Description:
+ *   Called from the DAC interrupt handler -- normally the DMA completion
+ *   interrupt -- when the lower half has consumed a waveform buffer that
+ *   was provided via the ao_sendbuffer() method.  The buffer is recycled
+ *   and the next queued buffer, if any, is streamed.
+ *
+ * Returned Value:
+ *   OK on success; a negated errno on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DAC_WAVEFORM
+int dac_wavedone(FAR struct dac_dev_s *dev, FAR struct dac_wavebuffer_s *wb)
+{
+  irqstate_t flags;
+
+  DEBUGASSERT(dev != NULL && wb != NULL);
+
+  flags = enter_critical_section();
+
+  /* Recycle the consumed buffer */
+
+  wb->wb_flink     = dev->ad_wavefree;
+  dev->ad_wavefree = wb;
+  dev->ad_wavebusy = false;
+
+  /* Stream the next filled buffer, if any */
+
+  dac_wavesend(dev);
+
+  /* And wake up any writer waiting for a free buffer */
+
+  if (dev->ad_wavewaiters > 0)
+    {
+      nxsem_post(&dev->ad_wavesem);
+    }
+
+  leave_critical_section(flags);
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: dac_register
  *
@@ -539,6 +884,13 @@ int dac_register(FAR const char *path, FAR struct dac_dev_s *dev)
 
   nxsem_set_protocol(&dev->ad_xmit.af_sem, SEM_PRIO_NONE);
 
+#ifdef CONFIG_DAC_WAVEFORM
+  /* The waveform semaphore is also used for signaling */
+
+  nxsem_init(&dev->ad_wavesem, 0, 0);
+  nxsem_set_protocol(&dev->ad_wavesem, SEM_PRIO_NONE);
+#endif
+
   dev->ad_ops->ao_reset(dev);
 
   return register_driver(path, &dac_fops, 0222, dev);
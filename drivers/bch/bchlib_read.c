@@ -86,6 +86,9 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset,
   uint16_t sectoffset;
   size_t   nbytes;
   size_t   bytesread;
+#if defined(CONFIG_BCH_ENCRYPTION)
+  size_t   sectndx;
+#endif
   int      ret;
 
   /* Get rid of this special case right away */
@@ -155,6 +158,40 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset,
           nsectors = bch->nsectors - sector;
         }
 
+#if defined(CONFIG_BCH_ENCRYPTION)
+      /* Encrypted data cannot bypass the sector buffer:  each sector must
+       * be staged there so that it can be decrypted before it is copied
+       * to the user buffer.
+       */
+
+      for (sectndx = 0; sectndx < nsectors; sectndx++)
+        {
+          ret = bchlib_readsector(bch, sector + sectndx);
+          if (ret < 0)
+            {
+              ferr("ERROR: Read failed: %d\n", ret);
+              return ret;
+            }
+
+          memcpy(buffer + sectndx * bch->sectsize, bch->buffer,
+                 bch->sectsize);
+        }
+#else
+      /* If the sector buffer holds a dirty sector lying within the span,
+       * flush it first so that the direct read returns current data.
+       */
+
+      if (bch->dirty && bch->sector >= sector &&
+          bch->sector < sector + nsectors)
+        {
+          ret = bchlib_flushsector(bch);
+          if (ret < 0)
+            {
+              ferr("ERROR: Flush failed: %d\n", ret);
+              return ret;
+            }
+        }
+
       ret = bch->inode->u.i_bops->read(bch->inode, (FAR uint8_t *)buffer,
                                        sector, nsectors);
       if (ret < 0)
@@ -162,6 +199,7 @@ ssize_t bchlib_read(FAR void *handle, FAR char *buffer, size_t offset,
           ferr("ERROR: Read failed: %d\n", ret);
           return ret;
         }
+#endif /* CONFIG_BCH_ENCRYPTION */
 
       /* Adjust pointers and counts */
 
@@ -73,6 +73,9 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset,
   uint16_t sectoffset;
   size_t   nbytes;
   size_t   byteswritten;
+#if defined(CONFIG_BCH_ENCRYPTION)
+  size_t   sectndx;
+#endif
   int      ret;
 
   /* Get rid of this special case right away */
@@ -150,6 +153,27 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset,
           return ret;
         }
 
+#if defined(CONFIG_BCH_ENCRYPTION)
+      /* Encrypted data cannot bypass the sector buffer:  each sector must
+       * be staged there so that it can be encrypted before it goes to the
+       * media.
+       */
+
+      for (sectndx = 0; sectndx < nsectors; sectndx++)
+        {
+          memcpy(bch->buffer, buffer + sectndx * bch->sectsize,
+                 bch->sectsize);
+          bch->sector = sector + sectndx;
+          bch->dirty  = true;
+
+          ret = bchlib_flushsector(bch);
+          if (ret < 0)
+            {
+              ferr("ERROR: Write failed: %d\n", ret);
+              return ret;
+            }
+        }
+#else
       /* Write the contiguous sectors */
 
       ret = bch->inode->u.i_bops->write(bch->inode, (FAR uint8_t *)buffer,
@@ -160,6 +184,17 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset,
           return ret;
         }
 
+      /* If the sector buffer holds a (clean) copy of a sector lying
+       * within the span just overwritten, then its contents are now
+       * stale.  Invalidate it.
+       */
+
+      if (bch->sector >= sector && bch->sector < sector + nsectors)
+        {
+          bch->sector = (size_t)-1;
+        }
+#endif /* CONFIG_BCH_ENCRYPTION */
+
       /* Adjust pointers and counts */
 
       sector       += nsectors;
@@ -55,7 +55,12 @@
 #include <errno.h>
 #include <debug.h>
 
+#ifdef CONFIG_CAN_TIMESTAMP
+#  include <sys/time.h>
+#endif
+
 #include <nuttx/arch.h>
+#include <nuttx/clock.h>
 #include <nuttx/signal.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/can/can.h>
@@ -1227,8 +1232,13 @@ int can_register(FAR const char *path, FAR struct can_dev_s *dev)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_CAN_TIMESTAMP
+int can_receive_ts(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
+                   FAR uint8_t *data, FAR const struct timeval *ts)
+#else
 int can_receive(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
                 FAR uint8_t *data)
+#endif
 {
   FAR struct can_rxfifo_s *fifo;
   FAR uint8_t             *dest;
@@ -1271,6 +1281,10 @@ int can_receive(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
 
               memcpy(&msg->cm_hdr, hdr, sizeof(struct can_hdr_s));
 
+#ifdef CONFIG_CAN_TIMESTAMP
+              msg->cm_ts = *ts;
+#endif
+
               nbytes = can_dlc2bytes(hdr->ch_dlc);
               for (i = 0, dest = msg->cm_data; i < nbytes; i++)
                 {
@@ -1320,6 +1334,10 @@ int can_receive(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
           memcpy(&fifo->rx_buffer[fifo->rx_tail].cm_hdr, hdr,
                  sizeof(struct can_hdr_s));
 
+#ifdef CONFIG_CAN_TIMESTAMP
+          fifo->rx_buffer[fifo->rx_tail].cm_ts = *ts;
+#endif
+
           nbytes = can_dlc2bytes(hdr->ch_dlc);
           memcpy(fifo->rx_buffer[fifo->rx_tail].cm_data, data, nbytes);
 
@@ -1370,6 +1388,43 @@ int can_receive(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
   return errcode;
 }
 
+/****************************************************************************
+ * Name: can_receive
+ *
+ * Description:
+ *   Called from the CAN interrupt handler when new read data is available
+ *   but the controller did not capture a hardware timestamp.  The time of
+ *   reception is captured here, in the interrupt handler, before the
+ *   message is queued.
+ *
+ * Input Parameters:
+ *   dev  - CAN driver state structure
+ *   hdr  - CAN message header
+ *   data - CAN message data (if DLC > 0)
+ *
+ * Returned Value:
+ *   OK on success; a negated errno on failure.
+ *
+ * Assumptions:
+ *   CAN interrupts are disabled.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_CAN_TIMESTAMP
+int can_receive(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
+                FAR uint8_t *data)
+{
+  struct timespec tp;
+  struct timeval tv;
+
+  clock_systime_timespec(&tp);
+  tv.tv_sec  = tp.tv_sec;
+  tv.tv_usec = tp.tv_nsec / 1000;
+
+  return can_receive_ts(dev, hdr, data, &tv);
+}
+#endif
+
 /****************************************************************************
  * Name: can_txdone
  *
@@ -0,0 +1,283 @@
+/****************************************************************************
+ * drivers/i2c/i2c_async.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/kthread.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/i2c/i2c_master.h>
+
+#ifdef CONFIG_I2C_ASYNC
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static FAR struct i2c_async_stats_s *
+i2c_async_findstats(FAR struct i2c_master_s *dev);
+static int i2c_async_thread(int argc, FAR char *argv[]);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The queue of pending transfers.  The queue and the statistics table are
+ * protected by g_i2c_async_lock; g_i2c_async_wait counts the transfers in
+ * the queue and wakes the service thread.
+ */
+
+static sq_queue_t g_i2c_async_pending;
+static sem_t g_i2c_async_lock = SEM_INITIALIZER(1);
+static sem_t g_i2c_async_wait = SEM_INITIALIZER(0);
+static bool g_i2c_async_started;
+static struct i2c_async_stats_s g_i2c_async_statstab[CONFIG_I2C_ASYNC_NBUSES];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2c_async_findstats
+ *
+ * Description:
+ *   Find the statistics slot assigned to the I2C bus, assigning a free one
+ *   on first use.  The queue lock must be held by the caller.
+ *
+ ****************************************************************************/
+
+static FAR struct i2c_async_stats_s *
+i2c_async_findstats(FAR struct i2c_master_s *dev)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_I2C_ASYNC_NBUSES; i++)
+    {
+      if (g_i2c_async_statstab[i].dev == dev)
+        {
+          return &g_i2c_async_statstab[i];
+        }
+      else if (g_i2c_async_statstab[i].dev == NULL)
+        {
+          g_i2c_async_statstab[i].dev = dev;
+          return &g_i2c_async_statstab[i];
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: i2c_async_thread
+ *
+ * Description:
+ *   The common I2C service thread.  Each iteration removes the highest
+ *   priority pending transfer, performs it with the normal, synchronous
+ *   transfer method, and invokes the completion callback.
+ *
+ ****************************************************************************/
+
+static int i2c_async_thread(int argc, FAR char *argv[])
+{
+  FAR struct i2c_async_stats_s *stats;
+  FAR struct i2c_async_s *best;
+  FAR struct i2c_async_s *xfr;
+  FAR sq_entry_t *entry;
+  clock_t elapsed;
+  clock_t start;
+  int ret;
+
+  for (; ; )
+    {
+      /* Wait until a transfer has been queued */
+
+      nxsem_wait_uninterruptible(&g_i2c_async_wait);
+      nxsem_wait_uninterruptible(&g_i2c_async_lock);
+
+      /* Remove the highest priority pending transfer.  Transfers of equal
+       * priority are served in FIFO order.
+       */
+
+      best = NULL;
+      for (entry = sq_peek(&g_i2c_async_pending);
+           entry != NULL;
+           entry = sq_next(entry))
+        {
+          xfr = (FAR struct i2c_async_s *)entry;
+          if (best == NULL || xfr->priority > best->priority)
+            {
+              best = xfr;
+            }
+        }
+
+      DEBUGASSERT(best != NULL);
+      sq_rem(&best->link, &g_i2c_async_pending);
+
+      stats   = i2c_async_findstats(best->dev);
+      elapsed = clock_systime_ticks() - best->qtime;
+      if (stats != NULL && elapsed > stats->maxqwait)
+        {
+          stats->maxqwait = elapsed;
+        }
+
+      nxsem_post(&g_i2c_async_lock);
+
+      /* Perform the transfer with the queue unlocked so that more urgent
+       * transfers may be queued while the bus is busy.  The transfer in
+       * progress cannot be preempted; the bus transaction is atomic.
+       */
+
+      start   = clock_systime_ticks();
+      ret     = I2C_TRANSFER(best->dev, best->msgv, best->msgc);
+      elapsed = clock_systime_ticks() - start;
+
+      nxsem_wait_uninterruptible(&g_i2c_async_lock);
+      if (stats != NULL)
+        {
+          stats->ntransfers++;
+          stats->busytime += elapsed;
+          if (ret < 0)
+            {
+              stats->nerrors++;
+            }
+        }
+
+      nxsem_post(&g_i2c_async_lock);
+
+      /* Finally, inform the caller that the transfer has completed.  After
+       * the callback returns, the caller may re-use the transfer structure.
+       */
+
+      if (best->callback != NULL)
+        {
+          best->callback(best, ret);
+        }
+    }
+
+  return OK; /* Won't get here */
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: i2c_transfer_async
+ *
+ * Description:
+ *   Queue a sequence of I2C transfers for asynchronous execution and
+ *   return immediately.  Queued transfers are performed in priority order
+ *   by a common service thread; the completion callback is invoked from
+ *   that thread when the transfer has finished.
+ *
+ * Input Parameters:
+ *   xfr - Describes the transfer to perform.  The caller must initialize
+ *         the dev, msgv, msgc, priority, callback, and arg fields.  The
+ *         structure and the message buffers must persist until the
+ *         callback has been invoked.
+ *
+ * Returned Value:
+ *   0: transfer queued, <0: A negated errno
+ *
+ ****************************************************************************/
+
+int i2c_transfer_async(FAR struct i2c_async_s *xfr)
+{
+  int ret;
+
+  DEBUGASSERT(xfr != NULL && xfr->dev != NULL &&
+              xfr->msgv != NULL && xfr->msgc > 0);
+
+  ret = nxsem_wait(&g_i2c_async_lock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* Start the service thread on the first use of the queue */
+
+  if (!g_i2c_async_started)
+    {
+      nxsem_set_protocol(&g_i2c_async_wait, SEM_PRIO_NONE);
+
+      ret = kthread_create("i2c_async", CONFIG_I2C_ASYNC_PRIORITY,
+                           CONFIG_I2C_ASYNC_STACKSIZE, i2c_async_thread,
+                           NULL);
+      if (ret < 0)
+        {
+          nxsem_post(&g_i2c_async_lock);
+          return ret;
+        }
+
+      g_i2c_async_started = true;
+    }
+
+  xfr->qtime = clock_systime_ticks();
+  sq_addlast(&xfr->link, &g_i2c_async_pending);
+
+  nxsem_post(&g_i2c_async_lock);
+  nxsem_post(&g_i2c_async_wait);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: i2c_async_stats
+ *
+ * Description:
+ *   Return the utilization statistics collected for one I2C bus by the
+ *   asynchronous transfer queue.
+ *
+ * Input Parameters:
+ *   dev - Device-specific state data
+ *
+ * Returned Value:
+ *   A pointer to the statistics, or NULL if no statistics slot could be
+ *   assigned to the bus (see CONFIG_I2C_ASYNC_NBUSES).
+ *
+ ****************************************************************************/
+
+FAR const struct i2c_async_stats_s *
+i2c_async_stats(FAR struct i2c_master_s *dev)
+{
+  FAR const struct i2c_async_stats_s *stats;
+  int ret;
+
+  ret = nxsem_wait(&g_i2c_async_lock);
+  if (ret < 0)
+    {
+      return NULL;
+    }
+
+  stats = i2c_async_findstats(dev);
+  nxsem_post(&g_i2c_async_lock);
+  return stats;
+}
+
+#endif /* CONFIG_I2C_ASYNC */
@@ -0,0 +1,554 @@
+/****************************************************************************
+ * drivers/input/touchscreen_upper.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/input/touchscreen.h>
+
+#ifdef CONFIG_INPUT_TOUCHSCREEN
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes the state of the upper half driver */
+
+struct touch_upperhalf_s
+{
+  sem_t tu_exclsem;  /* Supports exclusive access to the device */
+
+  /* The following is a singly linked list of open references to the
+   * touchscreen device.
+   */
+
+  FAR struct touch_openpriv_s *tu_open;
+};
+
+/* This structure describes the state of one open touchscreen driver
+ * instance.  Each open receives its own event queue so that a slow reader
+ * cannot starve other readers of motion history.
+ */
+
+struct touch_openpriv_s
+{
+  /* Supports a singly linked list */
+
+  FAR struct touch_openpriv_s *to_flink;
+
+  sem_t to_waitsem;            /* Used to wait for the availability of events */
+  uint8_t to_nwaiters;         /* Number of threads waiting for events */
+  volatile uint16_t to_head;   /* Circular buffer head (new events) */
+  volatile uint16_t to_tail;   /* Circular buffer tail (oldest event) */
+  uint16_t to_nlost;           /* Number of events lost to queue overflow */
+
+  /* The following is a list if poll structures of threads waiting for
+   * driver events.
+   */
+
+  FAR struct pollfd *to_fds[CONFIG_INPUT_TOUCHSCREEN_NPOLLWAITERS];
+
+  /* Circular buffer of timestamped touch events */
+
+  struct touch_event_s to_events[CONFIG_INPUT_TOUCHSCREEN_NEVENTS];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static inline int touch_takesem(FAR sem_t *sem);
+#define touch_givesem(s) nxsem_post(s);
+
+/* Character driver methods */
+
+static int     touch_open(FAR struct file *filep);
+static int     touch_close(FAR struct file *filep);
+static ssize_t touch_read(FAR struct file *filep, FAR char *buffer,
+                          size_t buflen);
+static int     touch_poll(FAR struct file *filep, FAR struct pollfd *fds,
+                          bool setup);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct file_operations touch_fops =
+{
+  touch_open,  /* open */
+  touch_close, /* close */
+  touch_read,  /* read */
+  NULL,        /* write */
+  NULL,        /* seek */
+  NULL,        /* ioctl */
+  touch_poll   /* poll */
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+  , NULL       /* unlink */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: touch_takesem
+ ****************************************************************************/
+
+static inline int touch_takesem(FAR sem_t *sem)
+{
+  return nxsem_wait(sem);
+}
+
+/****************************************************************************
+ * Name: touch_open
+ ****************************************************************************/
+
+static int touch_open(FAR struct file *filep)
+{
+  FAR struct inode *inode;
+  FAR struct touch_upperhalf_s *priv;
+  FAR struct touch_openpriv_s *opriv;
+  int ret;
+
+  DEBUGASSERT(filep != NULL && filep->f_inode != NULL);
+  inode = filep->f_inode;
+  DEBUGASSERT(inode->i_private);
+  priv  = (FAR struct touch_upperhalf_s *)inode->i_private;
+
+  /* Get exclusive access to the driver structure */
+
+  ret = touch_takesem(&priv->tu_exclsem);
+  if (ret < 0)
+    {
+      ierr("ERROR: touch_takesem failed: %d\n", ret);
+      return ret;
+    }
+
+  /* Allocate a new open structure */
+
+  opriv = (FAR struct touch_openpriv_s *)
+    kmm_zalloc(sizeof(struct touch_openpriv_s));
+  if (opriv == NULL)
+    {
+      ierr("ERROR: Failed to allocate open structure\n");
+      ret = -ENOMEM;
+      goto errout_with_sem;
+    }
+
+  nxsem_init(&opriv->to_waitsem, 0, 0);
+  nxsem_setprotocol(&opriv->to_waitsem, SEM_PRIO_NONE);
+
+  /* Attach the open structure to the device */
+
+  opriv->to_flink = priv->tu_open;
+  priv->tu_open   = opriv;
+
+  /* Attach the open structure to the file structure */
+
+  filep->f_priv = (FAR void *)opriv;
+  ret = OK;
+
+errout_with_sem:
+  touch_givesem(&priv->tu_exclsem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: touch_close
+ ****************************************************************************/
+
+static int touch_close(FAR struct file *filep)
+{
+  FAR struct inode *inode;
+  FAR struct touch_upperhalf_s *priv;
+  FAR struct touch_openpriv_s *opriv;
+  FAR struct touch_openpriv_s *curr;
+  FAR struct touch_openpriv_s *prev;
+  int ret;
+
+  DEBUGASSERT(filep != NULL && filep->f_priv != NULL &&
+              filep->f_inode != NULL);
+  opriv = filep->f_priv;
+  inode = filep->f_inode;
+  DEBUGASSERT(inode->i_private);
+  priv  = (FAR struct touch_upperhalf_s *)inode->i_private;
+
+  /* Get exclusive access to the driver structure */
+
+  ret = touch_takesem(&priv->tu_exclsem);
+  if (ret < 0)
+    {
+      ierr("ERROR: touch_takesem failed: %d\n", ret);
+      return ret;
+    }
+
+  /* Find the open structure in the list of open structures for the device */
+
+  for (prev = NULL, curr = priv->tu_open;
+       curr != NULL && curr != opriv;
+       prev = curr, curr = curr->to_flink);
+
+  DEBUGASSERT(curr);
+  if (curr == NULL)
+    {
+      ierr("ERROR: Failed to find open entry\n");
+      ret = -ENOENT;
+      goto errout_with_sem;
+    }
+
+  /* Remove the structure from the device */
+
+  if (prev != NULL)
+    {
+      prev->to_flink = opriv->to_flink;
+    }
+  else
+    {
+      priv->tu_open = opriv->to_flink;
+    }
+
+  /* And free the open structure */
+
+  nxsem_destroy(&opriv->to_waitsem);
+  kmm_free(opriv);
+  ret = OK;
+
+errout_with_sem:
+  touch_givesem(&priv->tu_exclsem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: touch_read
+ ****************************************************************************/
+
+static ssize_t touch_read(FAR struct file *filep, FAR char *buffer,
+                          size_t buflen)
+{
+  FAR struct touch_openpriv_s *opriv;
+  FAR struct touch_event_s *event;
+  irqstate_t flags;
+  ssize_t nread;
+  int ret;
+
+  DEBUGASSERT(filep != NULL && filep->f_priv != NULL);
+  opriv = filep->f_priv;
+
+  /* The user buffer must hold at least one event */
+
+  if (buflen < sizeof(struct touch_event_s))
+    {
+      return -EINVAL;
+    }
+
+  /* Events are queued from interrupt level; interrupts must be disabled
+   * while the queue indices are examined and updated.
+   */
+
+  flags = enter_critical_section();
+
+  /* Wait for events to become available */
+
+  while (opriv->to_head == opriv->to_tail)
+    {
+      if ((filep->f_oflags & O_NONBLOCK) != 0)
+        {
+          leave_critical_section(flags);
+          return -EAGAIN;
+        }
+
+      opriv->to_nwaiters++;
+      ret = nxsem_wait(&opriv->to_waitsem);
+      opriv->to_nwaiters--;
+
+      if (ret < 0)
+        {
+          leave_critical_section(flags);
+          return (ssize_t)ret;
+        }
+    }
+
+  /* Copy as many queued events as will fit in the user buffer */
+
+  nread = 0;
+  while (opriv->to_head != opriv->to_tail &&
+         nread + sizeof(struct touch_event_s) <= buflen)
+    {
+      event = &opriv->to_events[opriv->to_tail];
+      memcpy(&buffer[nread], event, sizeof(struct touch_event_s));
+
+      opriv->to_tail = (opriv->to_tail + 1) %
+                       CONFIG_INPUT_TOUCHSCREEN_NEVENTS;
+      nread         += sizeof(struct touch_event_s);
+    }
+
+  leave_critical_section(flags);
+  return nread;
+}
+
+/****************************************************************************
+ * Name: touch_poll
+ ****************************************************************************/
+
+static int touch_poll(FAR struct file *filep, FAR struct pollfd *fds,
+                      bool setup)
+{
+  FAR struct touch_openpriv_s *opriv;
+  irqstate_t flags;
+  int ret = OK;
+  int i;
+
+  DEBUGASSERT(filep != NULL && filep->f_priv != NULL);
+  opriv = filep->f_priv;
+
+  /* The poll slots and the event queue are shared with interrupt level
+   * event reporting.
+   */
+
+  flags = enter_critical_section();
+
+  /* Are we setting up the poll?  Or tearing it down? */
+
+  if (setup)
+    {
+      /* This is a request to set up the poll.  Find an available
+       * slot for the poll structure reference
+       */
+
+      for (i = 0; i < CONFIG_INPUT_TOUCHSCREEN_NPOLLWAITERS; i++)
+        {
+          /* Find an available slot */
+
+          if (!opriv->to_fds[i])
+            {
+              /* Bind the poll structure and this slot */
+
+              opriv->to_fds[i] = fds;
+              fds->priv        = &opriv->to_fds[i];
+              break;
+            }
+        }
+
+      if (i >= CONFIG_INPUT_TOUCHSCREEN_NPOLLWAITERS)
+        {
+          ierr("ERROR: Too many poll waiters\n");
+          fds->priv = NULL;
+          ret       = -EBUSY;
+          goto errout;
+        }
+
+      /* Are there already events in the queue? */
+
+      if (opriv->to_head != opriv->to_tail)
+        {
+          fds->revents |= (fds->events & POLLIN);
+          if (fds->revents != 0)
+            {
+              nxsem_post(fds->sem);
+            }
+        }
+    }
+  else if (fds->priv)
+    {
+      /* This is a request to tear down the poll. */
+
+      FAR struct pollfd **slot = (FAR struct pollfd **)fds->priv;
+
+      /* Remove all memory of the poll setup */
+
+      *slot     = NULL;
+      fds->priv = NULL;
+    }
+
+errout:
+  leave_critical_section(flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: touch_report
+ *
+ * Description:
+ *   Queue one touch sample to all open references of the touchscreen
+ *   device.  This function is intended to be called by the lower half
+ *   driver when a new sample is available -- normally from the interrupt
+ *   handler or from interrupt-scheduled work -- so that the timestamp
+ *   reflects the time of acquisition, not the time of the read().
+ *
+ ****************************************************************************/
+
+void touch_report(FAR struct touch_upperhalf_s *priv,
+                  FAR const struct touch_sample_s *sample)
+{
+  FAR struct touch_openpriv_s *opriv;
+  FAR struct touch_event_s *event;
+  irqstate_t flags;
+  clock_t now;
+  uint16_t next;
+  int i;
+
+  DEBUGASSERT(priv != NULL && sample != NULL);
+
+  /* Capture the timestamp once for all points of the sample */
+
+  now   = clock_systime_ticks();
+  flags = enter_critical_section();
+
+  /* Visit each opened reference to the device */
+
+  for (opriv = priv->tu_open; opriv != NULL; opriv = opriv->to_flink)
+    {
+      /* Queue each touch point as one timestamped event */
+
+      for (i = 0; i < sample->npoints; i++)
+        {
+          next = (opriv->to_head + 1) % CONFIG_INPUT_TOUCHSCREEN_NEVENTS;
+          if (next == opriv->to_tail)
+            {
+              /* The queue is full; drop the oldest event so that the
+               * stream stays current.
+               */
+
+              opriv->to_tail = (opriv->to_tail + 1) %
+                               CONFIG_INPUT_TOUCHSCREEN_NEVENTS;
+              opriv->to_nlost++;
+            }
+
+          event        = &opriv->to_events[opriv->to_head];
+          event->time  = now;
+          event->point = sample->point[i];
+
+          opriv->to_head = next;
+        }
+
+      /* Notify all poll waiters */
+
+      for (i = 0; i < CONFIG_INPUT_TOUCHSCREEN_NPOLLWAITERS; i++)
+        {
+          FAR struct pollfd *fds = opriv->to_fds[i];
+          if (fds != NULL)
+            {
+              fds->revents |= (fds->events & POLLIN);
+              if (fds->revents != 0)
+                {
+                  nxsem_post(fds->sem);
+                }
+            }
+        }
+
+      /* And wake up any threads blocked in read() */
+
+      while (opriv->to_nwaiters > 0)
+        {
+          nxsem_post(&opriv->to_waitsem);
+          opriv->to_nwaiters--;
+        }
+    }
+
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: touch_register
+ *
+ * Description:
+ *   Register the touchscreen event device at the provided device path.
+ *   The returned handle is passed to touch_report() by the lower half
+ *   driver to queue new touch samples.
+ *
+ ****************************************************************************/
+
+FAR struct touch_upperhalf_s *touch_register(FAR const char *devpath)
+{
+  FAR struct touch_upperhalf_s *priv;
+  int ret;
+
+  DEBUGASSERT(devpath != NULL);
+
+  /* Allocate the upper half driver structure */
+
+  priv = (FAR struct touch_upperhalf_s *)
+    kmm_zalloc(sizeof(struct touch_upperhalf_s));
+  if (priv == NULL)
+    {
+      ierr("ERROR: Failed to allocate device structure\n");
+      return NULL;
+    }
+
+  nxsem_init(&priv->tu_exclsem, 0, 1);
+
+  /* Register the character driver */
+
+  ret = register_driver(devpath, &touch_fops, 0444, priv);
+  if (ret < 0)
+    {
+      ierr("ERROR: register_driver failed: %d\n", ret);
+      nxsem_destroy(&priv->tu_exclsem);
+      kmm_free(priv);
+      return NULL;
+    }
+
+  return priv;
+}
+
+/****************************************************************************
+ * Name: touch_unregister
+ *
+ * Description:
+ *   Unregister the touchscreen event device and free its resources.
+ *
+ ****************************************************************************/
+
+void touch_unregister(FAR struct touch_upperhalf_s *priv,
+                      FAR const char *devpath)
+{
+  DEBUGASSERT(priv != NULL && devpath != NULL);
+  DEBUGASSERT(priv->tu_open == NULL);
+
+  unregister_driver(devpath);
+
+  nxsem_destroy(&priv->tu_exclsem);
+  kmm_free(priv);
+}
+
+#endif /* CONFIG_INPUT_TOUCHSCREEN */
@@ -271,6 +271,18 @@ static int pca9538_getbit(FAR struct pca9538_dev_s *pca, uint8_t addr,
       return -ENXIO;
     }
 
+#ifdef CONFIG_PCA9538_SHADOW_INPUT
+  /* Serve input reads from the shadowed input register while it is known
+   * to be current (i.e., no pin change interrupt is pending).
+   */
+
+  if (addr == PCA9538_REG_INPUT && pca->sinput_valid)
+    {
+      *val = (pca->sreg[addr] >> pin) & 1;
+      return OK;
+    }
+#endif
+
   ret = pca9538_writeread(pca, &addr, 1, &buf, 1);
   if (ret < 0)
     {
@@ -503,18 +515,32 @@ static int pca9538_getmultibits(FAR struct pca9538_dev_s *pca, uint8_t addr,
   int index;
   int pin;
 
-  ret = pca9538_writeread(pca, &addr, 1, buf, 2);
-  if (ret < 0)
+#ifdef CONFIG_PCA9538_SHADOW_INPUT
+  /* Serve input reads from the shadowed input register while it is known
+   * to be current (i.e., no pin change interrupt is pending).
+   */
+
+  if (addr == PCA9538_REG_INPUT && pca->sinput_valid)
     {
-      return ret;
+      buf[0] = pca->sreg[addr];
+      buf[1] = pca->sreg[addr + 1];
     }
+  else
+#endif
+    {
+      ret = pca9538_writeread(pca, &addr, 1, buf, 2);
+      if (ret < 0)
+        {
+          return ret;
+        }
 
 #ifdef CONFIG_PCA9538_SHADOW_MODE
-  /* Save the new register value in the shadow register */
+      /* Save the new register value in the shadow register */
 
-  pca->sreg[addr]   = buf[0];
-  pca->sreg[addr + 1] = buf[1];
+      pca->sreg[addr]   = buf[0];
+      pca->sreg[addr + 1] = buf[1];
 #endif
+    }
 
   /* Read the requested bits */
 
@@ -827,6 +853,13 @@ static void pca9538_irqworker(void *arg)
 
       pca->sreg[addr]   = buf[0];
       pca->sreg[addr + 1] = buf[1];
+#endif
+#ifdef CONFIG_PCA9538_SHADOW_INPUT
+      /* The shadowed input registers are current again.  Interrupts are
+       * still disabled here, so no pin change can be pending.
+       */
+
+      pca->sinput_valid = true;
 #endif
       /* Create a 16-bit pinset */
 
@@ -874,6 +907,14 @@ static int pca9538_interrupt(int irq, FAR void *context, FAR void *arg)
 {
   FAR struct pca9538_dev_s *pca = (FAR struct pca9538_dev_s *)arg;
 
+#ifdef CONFIG_PCA9538_SHADOW_INPUT
+  /* A pin just changed:  The shadowed input registers are stale until the
+   * worker has re-read them.
+   */
+
+  pca->sinput_valid = false;
+#endif
+
   /* In complex environments, we cannot do I2C transfers from the interrupt
    * handler because semaphores are probably used to lock the I2C bus.  In
    * this case, we will defer processing to the worker thread.  This is also
@@ -119,6 +119,9 @@ struct pca9538_dev_s
 #ifdef CONFIG_PCA9538_SHADOW_MODE
   uint8_t sreg[8];                      /* Shadowed registers of the PCA9538 */
 #endif
+#ifdef CONFIG_PCA9538_SHADOW_INPUT
+  volatile bool sinput_valid;           /* Shadowed input registers are current */
+#endif
 #ifdef CONFIG_PCA9538_MULTIPLE
   FAR struct pca9538_dev_s    *flink;   /* Supports a singly linked list of drivers */
 #endif
@@ -299,6 +299,19 @@ static int pca9555_getbit(FAR struct pca9555_dev_s *pca, uint8_t addr,
       pin  -= 8;
     }
 
+#ifdef CONFIG_PCA9555_SHADOW_INPUT
+  /* Serve input reads from the shadowed input registers while they are
+   * known to be current (i.e., no pin change interrupt is pending).
+   */
+
+  if ((addr == PCA9555_REG_INPUT || addr == PCA9555_REG_INPUT + 1) &&
+      pca->sinput_valid)
+    {
+      *val = (pca->sreg[addr] >> pin) & 1;
+      return OK;
+    }
+#endif
+
   ret = pca9555_writeread(pca, &addr, 1, &buf, 1);
   if (ret < 0)
     {
@@ -531,18 +544,32 @@ static int pca9555_getmultibits(FAR struct pca9555_dev_s *pca, uint8_t addr,
   int index;
   int pin;
 
-  ret = pca9555_writeread(pca, &addr, 1, buf, 2);
-  if (ret < 0)
+#ifdef CONFIG_PCA9555_SHADOW_INPUT
+  /* Serve input reads from the shadowed input registers while they are
+   * known to be current (i.e., no pin change interrupt is pending).
+   */
+
+  if (addr == PCA9555_REG_INPUT && pca->sinput_valid)
     {
-      return ret;
+      buf[0] = pca->sreg[addr];
+      buf[1] = pca->sreg[addr + 1];
     }
+  else
+#endif
+    {
+      ret = pca9555_writeread(pca, &addr, 1, buf, 2);
+      if (ret < 0)
+        {
+          return ret;
+        }
 
 #ifdef CONFIG_PCA9555_SHADOW_MODE
-  /* Save the new register value in the shadow register */
+      /* Save the new register value in the shadow register */
 
-  pca->sreg[addr]     = buf[0];
-  pca->sreg[addr + 1] = buf[1];
+      pca->sreg[addr]     = buf[0];
+      pca->sreg[addr + 1] = buf[1];
 #endif
+    }
 
   /* Read the requested bits */
 
@@ -865,6 +892,13 @@ static void pca9555_irqworker(void *arg)
 
       pca->sreg[addr]     = buf[0];
       pca->sreg[addr + 1] = buf[1];
+#endif
+#ifdef CONFIG_PCA9555_SHADOW_INPUT
+      /* The shadowed input registers are current again.  Interrupts are
+       * still disabled here, so no pin change can be pending.
+       */
+
+      pca->sinput_valid = true;
 #endif
       /* Create a 16-bit pinset */
 
@@ -912,6 +946,14 @@ static int pca9555_interrupt(int irq, FAR void *context, FAR void *arg)
 {
   FAR struct pca9555_dev_s *pca = (FAR struct pca9555_dev_s *)arg;
 
+#ifdef CONFIG_PCA9555_SHADOW_INPUT
+  /* A pin just changed:  The shadowed input registers are stale until the
+   * worker has re-read them.
+   */
+
+  pca->sinput_valid = false;
+#endif
+
   /* In complex environments, we cannot do I2C transfers from the interrupt
    * handler because semaphores are probably used to lock the I2C bus.  In
    * this case, we will defer processing to the worker thread.  This is also
@@ -143,6 +143,9 @@ struct pca9555_dev_s
 #ifdef CONFIG_PCA9555_SHADOW_MODE
   uint8_t sreg[8];                      /* Shadowed registers of the PCA9555 */
 #endif
+#ifdef CONFIG_PCA9555_SHADOW_INPUT
+  volatile bool sinput_valid;           /* Shadowed input registers are current */
+#endif
 #ifdef CONFIG_PCA9555_MULTIPLE
   FAR struct pca9555_dev_s    *flink;   /* Supports a singly linked list of drivers */
 #endif
@@ -72,6 +72,9 @@ struct lcdfb_dev_s
   FAR struct lcdfb_dev_s *flink;    /* Supports a singly linked list */
   FAR struct lcd_dev_s *lcd;        /* Contained LCD device */
   FAR uint8_t *fbmem;               /* Allocated framebuffer */
+#ifdef CONFIG_LCD_FRAMEBUFFER_SHADOW
+  FAR uint8_t *shadow;              /* Content last written to the LCD */
+#endif
   FAR struct lcd_planeinfo_s pinfo; /* LCD plane info */
   size_t fblen;                     /* Size of the framebuffer in bytes */
   fb_coord_t xres;                  /* Horizontal resolution in pixel columns */
@@ -164,6 +167,105 @@ static FAR struct lcdfb_dev_s *lcdfb_find(int display)
   return NULL;
 }
 
+/****************************************************************************
+ * Name: lcdfb_putshadowrun
+ *
+ * Description:
+ *   Write one scanline of the update rectangle to the LCD, sending only
+ *   the span of pixels that differs from the shadow copy of the
+ *   framebuffer.  The shadow copy is updated to match.  Rows that have
+ *   not changed generate no LCD traffic at all.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_LCD_FRAMEBUFFER_SHADOW
+static int lcdfb_putshadowrun(FAR struct lcdfb_dev_s *priv, fb_coord_t row,
+                              fb_coord_t startx, fb_coord_t width,
+                              FAR uint8_t *run)
+{
+  FAR struct lcd_planeinfo_s *pinfo = &priv->pinfo;
+  FAR uint8_t *shadow;
+  unsigned int nbytes;
+  unsigned int first;
+  unsigned int last;
+  fb_coord_t col;
+  fb_coord_t npixels;
+  int ret;
+
+  /* The shadow buffer parallels the framebuffer; find the matching run */
+
+  shadow = priv->shadow + (run - priv->fbmem);
+
+  /* Number of bytes spanned by the run.  For BPP < 8 the caller has
+   * already aligned startx to a byte boundary.
+   */
+
+  nbytes = ((((unsigned int)startx + width) * pinfo->bpp + 7) >> 3) -
+           (((unsigned int)startx * pinfo->bpp) >> 3);
+
+  /* Find the first and last bytes of the run that changed */
+
+  for (first = 0; first < nbytes && run[first] == shadow[first]; first++)
+    {
+    }
+
+  if (first >= nbytes)
+    {
+      /* This row is unchanged; skip it */
+
+      return OK;
+    }
+
+  for (last = nbytes - 1; last > first && run[last] == shadow[last]; last--)
+    {
+    }
+
+  /* Convert the changed byte range back to a pixel span, rounding out to
+   * pixel boundaries.
+   */
+
+  if (pinfo->bpp < 8)
+    {
+      unsigned int pixperbyte = 8 / pinfo->bpp;
+
+      col     = startx + first * pixperbyte;
+      npixels = (last - first + 1) * pixperbyte;
+      if (col + npixels > startx + width)
+        {
+          npixels = startx + width - col;
+        }
+
+      run    += first;
+    }
+  else
+    {
+      unsigned int pixbytes = pinfo->bpp >> 3;
+      unsigned int firstpix = first / pixbytes;
+      unsigned int lastpix  = last / pixbytes;
+
+      col     = startx + firstpix;
+      npixels = lastpix - firstpix + 1;
+      first   = firstpix * pixbytes;
+      last    = (lastpix + 1) * pixbytes - 1;
+
+      run    += first;
+    }
+
+  /* Write the changed span to the LCD, then bring the shadow copy up to
+   * date.  If the write fails, the shadow copy is left stale so that the
+   * span will be retried on the next update.
+   */
+
+  ret = pinfo->putrun(row, col, run, npixels);
+  if (ret >= 0)
+    {
+      memcpy(shadow + first, run, last - first + 1);
+    }
+
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: lcdfb_updateearea
  *
@@ -239,7 +341,11 @@ static int lcdfb_updateearea(FAR struct fb_vtable_s *vtable,
        * memory.
        */
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_SHADOW
+      ret = lcdfb_putshadowrun(priv, row, startx, width, run);
+#else
       ret = pinfo->putrun(row, startx, run, width);
+#endif
       if (ret < 0)
         {
           return ret;
@@ -574,6 +680,23 @@ int up_fbinitialize(int display)
       goto errout_with_lcd;
     }
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_SHADOW
+  /* Allocate the shadow framebuffer.  It is initialized to the complement
+   * of the (zeroed) framebuffer so that the initial update below writes
+   * the entire display.
+   */
+
+  priv->shadow = (FAR uint8_t *)kmm_malloc(priv->fblen);
+  if (priv->shadow == NULL)
+    {
+      lcderr("ERROR: Failed to allocate shadow buffer memory\n");
+      ret = -ENOMEM;
+      goto errout_with_fbmem;
+    }
+
+  memset(priv->shadow, 0xff, priv->fblen);
+#endif
+
   /* Add the state structure to the list of framebuffer interfaces */
 
   priv->flink = g_lcdfb;
@@ -597,6 +720,11 @@ int up_fbinitialize(int display)
   priv->lcd->setpower(priv->lcd, ((3*CONFIG_LCD_MAXPOWER + 3) / 4));
   return OK;
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_SHADOW
+errout_with_fbmem:
+  kmm_free(priv->fbmem);
+#endif
+
 errout_with_lcd:
 #ifndef CONFIG_LCD_EXTERNINIT
   board_lcd_uninitialize();
@@ -696,6 +824,12 @@ void up_fbuninitialize(int display)
 
           kmm_free(priv->fbmem);
 
+#ifdef CONFIG_LCD_FRAMEBUFFER_SHADOW
+          /* Free the shadow buffer allocation */
+
+          kmm_free(priv->shadow);
+#endif
+
           /* Free the state structure allocation */
 
           kmm_free(priv);
@@ -107,6 +107,9 @@ struct mmcsd_state_s
   uint8_t wrprotect:1;             /* true: Card is write protected (from CSD) */
   uint8_t locked:1;                /* true: Media is locked (from R1) */
   uint8_t dsrimp:1;                /* true: card supports CMD4/DSR setting (from CSD) */
+#ifdef CONFIG_MMCSD_CMD23
+  uint8_t cmd23support:1;          /* true: card supports CMD23 (from SCR or CSD) */
+#endif
 #ifdef CONFIG_SDIO_DMA
   uint8_t dma:1;                   /* true: hardware supports DMA */
 #endif
@@ -574,6 +577,18 @@ static void mmcsd_decode_csd(FAR struct mmcsd_state_s *priv, uint32_t csd[4])
   decoded.transpeed.transferrateunit =  csd[0]        & 7;
 #endif
 
+#ifdef CONFIG_MMCSD_CMD23
+  /* CMD23, SET_BLOCK_COUNT, is mandatory for MMC cards compliant with
+   * specification version 4.x or later.  SD card support is determined
+   * later from the SCR CMD_SUPPORT bits; see mmsd_decode_scr().
+   */
+
+  if (IS_MMC(priv->type))
+    {
+      priv->cmd23support = ((csd[0] >> 26) & 0x0f) >= 4;
+    }
+#endif
+
   /* Word 2: Bits 64:95
    *   CCC                95:84 Card command classes
    *   READ_BL_LEN        83:80 Max. read data block length
@@ -991,6 +1006,19 @@ static void mmsd_decode_scr(FAR struct mmcsd_state_s *priv, uint32_t scr[2])
   priv->buswidth     = (scr[0] >> 8) & 15;
 #endif
 
+#ifdef CONFIG_MMCSD_CMD23
+  /* Word 1, bit 33: CMD_SUPPORT, SET_BLOCK_COUNT (CMD23).  This bit was
+   * reserved (zero) prior to SD physical layer specification version 3.0
+   * so older cards will correctly report no CMD23 support.
+   */
+
+#ifdef CONFIG_ENDIAN_BIG
+  priv->cmd23support = (scr[0] >> 1) & 1;
+#else
+  priv->cmd23support = (scr[0] >> 25) & 1;
+#endif
+#endif
+
 #ifdef CONFIG_DEBUG_FS_INFO
 #ifdef CONFIG_ENDIAN_BIG
   /* Card SCR is big-endian order / CPU also big-endian
@@ -1503,6 +1531,9 @@ static ssize_t mmcsd_readmultiple(FAR struct mmcsd_state_s *priv,
                                   FAR uint8_t *buffer, off_t startblock,
                                   size_t nblocks)
 {
+#ifdef CONFIG_MMCSD_CMD23
+  bool blkcount = false;
+#endif
   size_t nbytes;
   off_t  offset;
   int ret;
@@ -1574,6 +1605,30 @@ static ssize_t mmcsd_readmultiple(FAR struct mmcsd_state_s *priv,
       return ret;
     }
 
+#ifdef CONFIG_MMCSD_CMD23
+  /* If the card supports it, send CMD23, SET_BLOCK_COUNT, so that the
+   * following READ_MULT_BLOCK terminates by itself after 'nblocks' blocks
+   * and no STOP_TRANSMISSION is required.
+   */
+
+  if (priv->cmd23support)
+    {
+      mmcsd_sendcmdpoll(priv, MMC_CMD23, nblocks);
+      ret = mmsd_recv_r1(priv, MMC_CMD23);
+      if (ret == OK)
+        {
+          blkcount = true;
+        }
+      else
+        {
+          /* Fall back to an open-ended transfer, now and in the future */
+
+          ferr("ERROR: mmsd_recv_r1 for CMD23 failed: %d\n", ret);
+          priv->cmd23support = false;
+        }
+    }
+#endif
+
   /* Configure SDIO controller hardware for the read transfer */
 
   SDIO_BLOCKSETUP(priv->dev, priv->blocksize, nblocks);
@@ -1619,9 +1674,18 @@ static ssize_t mmcsd_readmultiple(FAR struct mmcsd_state_s *priv,
       return ret;
     }
 
-  /* Send STOP_TRANSMISSION */
+  /* Send STOP_TRANSMISSION unless the transfer length was pre-defined with
+   * CMD23, in which case the card ended the transfer by itself.
+   */
+
+  ret = OK;
+#ifdef CONFIG_MMCSD_CMD23
+  if (!blkcount)
+#endif
+    {
+      ret = mmcsd_stoptransmission(priv);
+    }
 
-  ret = mmcsd_stoptransmission(priv);
 #ifdef CONFIG_SDIO_DMA
   SDIO_DMADELYDINVLDT(priv->dev, buffer, priv->blocksize * nblocks);
 #endif
@@ -1880,6 +1944,9 @@ static ssize_t mmcsd_writemultiple(FAR struct mmcsd_state_s *priv,
                                    FAR const uint8_t *buffer,
                                    off_t startblock, size_t nblocks)
 {
+#ifdef CONFIG_MMCSD_CMD23
+  bool blkcount = false;
+#endif
   off_t  offset;
   size_t nbytes;
   int ret;
@@ -1985,6 +2052,30 @@ static ssize_t mmcsd_writemultiple(FAR struct mmcsd_state_s *priv,
         }
     }
 
+#ifdef CONFIG_MMCSD_CMD23
+  /* If the card supports it, send CMD23, SET_BLOCK_COUNT, so that the
+   * following WRITE_MULTIPLE_BLOCK terminates by itself after 'nblocks'
+   * blocks and no STOP_TRANSMISSION is required.
+   */
+
+  if (priv->cmd23support)
+    {
+      mmcsd_sendcmdpoll(priv, MMC_CMD23, nblocks);
+      ret = mmsd_recv_r1(priv, MMC_CMD23);
+      if (ret == OK)
+        {
+          blkcount = true;
+        }
+      else
+        {
+          /* Fall back to an open-ended transfer, now and in the future */
+
+          ferr("ERROR: mmsd_recv_r1 for CMD23 failed: %d\n", ret);
+          priv->cmd23support = false;
+        }
+    }
+#endif
+
   /* If Controller does not need DMA setup before the write then send CMD25
    * now.
    */
@@ -2059,9 +2150,20 @@ static ssize_t mmcsd_writemultiple(FAR struct mmcsd_state_s *priv,
        */
     }
 
-  /* Send STOP_TRANSMISSION */
+  /* Send STOP_TRANSMISSION unless the transfer length was pre-defined with
+   * CMD23 and the transfer completed normally; the card then ended the
+   * transfer by itself.  After a failed transfer, STOP_TRANSMISSION is
+   * still sent in an attempt to return the card to Transfer State.
+   */
+
+  ret = OK;
+#ifdef CONFIG_MMCSD_CMD23
+  if (!blkcount || evret != OK)
+#endif
+    {
+      ret = mmcsd_stoptransmission(priv);
+    }
 
-  ret = mmcsd_stoptransmission(priv);
   if (evret != OK)
     {
       return evret;
@@ -3554,6 +3656,9 @@ static int mmcsd_removed(FAR struct mmcsd_state_s *priv)
   priv->type         = MMCSD_CARDTYPE_UNKNOWN;
   priv->rca          = 0;
   priv->selblocklen  = 0;
+#ifdef CONFIG_MMCSD_CMD23
+  priv->cmd23support = false;
+#endif
 
   /* Go back to the default 1-bit data bus. */
 
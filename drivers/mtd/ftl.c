@@ -36,6 +36,7 @@
 #include <debug.h>
 #include <errno.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/fs/ioctl.h>
@@ -58,16 +59,44 @@
 
 #define DEV_NAME_MAX    (NAME_MAX + 5)
 
+/* Increment a statistics counter (no-op if statistics are not enabled) */
+
+#ifdef CONFIG_FTL_STATISTICS
+#  define ftl_stat_increment(dev,field) ((dev)->stats.field++)
+#else
+#  define ftl_stat_increment(dev,field)
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+#ifdef CONFIG_FTL_STATISTICS
+/* FTL wear and latency statistics.  There is no user interface to obtain
+ * these statistics; they are of value with debug instrumentation or a
+ * debugger.
+ */
+
+struct ftl_stats_s
+{
+  uint32_t nreads;        /* Number of block read operations */
+  uint32_t nwrites;       /* Number of block write operations */
+  uint32_t nerases;       /* Number of erase operations performed */
+  uint32_t nskiperase;    /* Number of erase operations avoided */
+  clock_t  maxwrlatency;  /* Longest single flush, in system ticks */
+  clock_t  totwrlatency;  /* Total time spent flushing, in system ticks */
+};
+#endif
+
 struct ftl_struct_s
 {
   FAR struct mtd_dev_s *mtd;      /* Contained MTD interface */
   struct mtd_geometry_s geo;      /* Device geometry */
 #ifdef FTL_HAVE_RWBUFFER
   struct rwbuffer_s     rwb;      /* Read-ahead/write buffer support */
+#endif
+#ifdef CONFIG_FTL_STATISTICS
+  struct ftl_stats_s    stats;    /* Wear and latency statistics */
 #endif
   uint16_t              blkper;   /* R/W blocks per erase block */
   uint16_t              refs;     /* Number of references */
@@ -213,6 +242,7 @@ static ssize_t ftl_read(FAR struct inode *inode, unsigned char *buffer,
   DEBUGASSERT(inode && inode->i_private);
 
   dev = (FAR struct ftl_struct_s *)inode->i_private;
+  ftl_stat_increment(dev, nreads);
 #ifdef FTL_HAVE_RWBUFFER
   return rwb_read(&dev->rwb, start_sector, nsectors, buffer);
 #else
@@ -239,6 +269,23 @@ static int ftl_alloc_eblock(FAR struct ftl_struct_s *dev)
   return dev->eblock != NULL ? OK : -ENOMEM;
 }
 
+#ifdef CONFIG_FTL_SKIP_ERASE
+/* Return true if every byte in the region is still in the erased state */
+
+static bool ftl_iserased(FAR const uint8_t *buffer, size_t nbytes)
+{
+  while (nbytes-- > 0)
+    {
+      if (*buffer++ != CONFIG_FTL_ERASEDSTATE)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+#endif
+
 static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
                          off_t startblock, size_t nblocks)
 {
@@ -252,6 +299,13 @@ static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
   size_t nxfrd;
   int    nbytes;
   int    ret;
+#ifdef CONFIG_FTL_SKIP_ERASE
+  bool   erased;
+#endif
+#ifdef CONFIG_FTL_STATISTICS
+  clock_t start = clock_systime_ticks();
+  clock_t elapsed;
+#endif
 
   /* Get the aligned block.  Here is is assumed: (1) The number of R/W blocks
    * per erase block is a power of 2, and (2) the erase begins with that same
@@ -288,18 +342,7 @@ static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
           return -EIO;
         }
 
-      /* Then erase the erase block */
-
-      eraseblock = rwblock / dev->blkper;
-      ret        = MTD_ERASE(dev->mtd, eraseblock, 1);
-      if (ret < 0)
-        {
-          ferr("ERROR: Erase block=%jd failed: %d\n",
-               (intmax_t)eraseblock, ret);
-          return ret;
-        }
-
-      /* Copy the user data at the end of the buffered erase block */
+      /* Get the offset and size of the modified region of the erase block */
 
       offset = (startblock & mask) * dev->geo.blocksize;
 
@@ -312,19 +355,60 @@ static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
           nbytes = dev->geo.erasesize - offset;
         }
 
-      finfo("Copy %d bytes into erase block=%jd at offset=%jd\n",
-             nbytes, (intmax_t)eraseblock, (intmax_t)offset);
+#ifdef CONFIG_FTL_SKIP_ERASE
+      if (ftl_iserased(dev->eblock + offset, nbytes))
+        {
+          /* The region being overwritten is still in the erased state.
+           * Program just the affected R/W blocks in place and skip the
+           * whole read/erase/re-write cycle.
+           */
+
+          finfo("Write %d bytes at block=%jd without erase\n",
+                nbytes, (intmax_t)startblock);
+
+          nxfrd = MTD_BWRITE(dev->mtd, startblock,
+                             nbytes / dev->geo.blocksize, buffer);
+          if (nxfrd != nbytes / dev->geo.blocksize)
+            {
+              ferr("ERROR: Write block %jd failed: %zu\n",
+                   (intmax_t)startblock, nxfrd);
+              return -EIO;
+            }
+
+          ftl_stat_increment(dev, nskiperase);
+        }
+      else
+#endif
+        {
+          /* Then erase the erase block */
 
-      memcpy(dev->eblock + offset, buffer, nbytes);
+          eraseblock = rwblock / dev->blkper;
+          ret        = MTD_ERASE(dev->mtd, eraseblock, 1);
+          if (ret < 0)
+            {
+              ferr("ERROR: Erase block=%jd failed: %d\n",
+                   (intmax_t)eraseblock, ret);
+              return ret;
+            }
 
-      /* And write the erase block back to flash */
+          ftl_stat_increment(dev, nerases);
 
-      nxfrd = MTD_BWRITE(dev->mtd, rwblock, dev->blkper, dev->eblock);
-      if (nxfrd != dev->blkper)
-        {
-          ferr("ERROR: Write erase block %jd failed: %zu\n",
-               (intmax_t)rwblock, nxfrd);
-          return -EIO;
+          /* Copy the user data at the end of the buffered erase block */
+
+          finfo("Copy %d bytes into erase block=%jd at offset=%jd\n",
+                 nbytes, (intmax_t)eraseblock, (intmax_t)offset);
+
+          memcpy(dev->eblock + offset, buffer, nbytes);
+
+          /* And write the erase block back to flash */
+
+          nxfrd = MTD_BWRITE(dev->mtd, rwblock, dev->blkper, dev->eblock);
+          if (nxfrd != dev->blkper)
+            {
+              ferr("ERROR: Write erase block %jd failed: %zu\n",
+                   (intmax_t)rwblock, nxfrd);
+              return -EIO;
+            }
         }
 
       /* Then update for amount written */
@@ -345,15 +429,40 @@ static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
 
   while (remaining >= dev->blkper)
     {
-      /* Erase the erase block */
+#ifdef CONFIG_FTL_SKIP_ERASE
+      /* If the entire erase block is still in the erased state, then it
+       * can be programmed directly and the slow erase can be skipped.
+       * The verifying read is much cheaper than the erase it may avoid.
+       */
 
-      eraseblock = alignedblock / dev->blkper;
-      ret        = MTD_ERASE(dev->mtd, eraseblock, 1);
-      if (ret < 0)
+      erased = false;
+      if (ftl_alloc_eblock(dev) == OK)
         {
-          ferr("ERROR: Erase block=%jd failed: %d\n",
-               (intmax_t)eraseblock, ret);
-          return ret;
+          nxfrd  = MTD_BREAD(dev->mtd, alignedblock, dev->blkper,
+                             dev->eblock);
+          erased = (nxfrd == dev->blkper &&
+                    ftl_iserased(dev->eblock, dev->geo.erasesize));
+        }
+
+      if (erased)
+        {
+          ftl_stat_increment(dev, nskiperase);
+        }
+      else
+#endif
+        {
+          /* Erase the erase block */
+
+          eraseblock = alignedblock / dev->blkper;
+          ret        = MTD_ERASE(dev->mtd, eraseblock, 1);
+          if (ret < 0)
+            {
+              ferr("ERROR: Erase block=%jd failed: %d\n",
+                   (intmax_t)eraseblock, ret);
+              return ret;
+            }
+
+          ftl_stat_increment(dev, nerases);
         }
 
       /* Write a full erase back to flash */
@@ -397,35 +506,75 @@ static ssize_t ftl_flush(FAR void *priv, FAR const uint8_t *buffer,
           return -EIO;
         }
 
-      /* Then erase the erase block */
+      nbytes = remaining * dev->geo.blocksize;
 
-      eraseblock = alignedblock / dev->blkper;
-      ret        = MTD_ERASE(dev->mtd, eraseblock, 1);
-      if (ret < 0)
+#ifdef CONFIG_FTL_SKIP_ERASE
+      if (ftl_iserased(dev->eblock, nbytes))
         {
-          ferr("ERROR: Erase block=%jd failed: %d\n",
-               (intmax_t)eraseblock, ret);
-          return ret;
+          /* The region being overwritten is still in the erased state.
+           * Program just the affected R/W blocks in place and skip the
+           * whole read/erase/re-write cycle.
+           */
+
+          finfo("Write %d bytes at block=%jd without erase\n",
+                nbytes, (intmax_t)alignedblock);
+
+          nxfrd = MTD_BWRITE(dev->mtd, alignedblock, remaining, buffer);
+          if (nxfrd != remaining)
+            {
+              ferr("ERROR: Write block %jd failed: %zu\n",
+                   (intmax_t)alignedblock, nxfrd);
+              return -EIO;
+            }
+
+          ftl_stat_increment(dev, nskiperase);
         }
-
-      /* Copy the user data at the beginning the buffered erase block */
-
-      nbytes = remaining * dev->geo.blocksize;
-      finfo("Copy %d bytes into erase block=%jd at offset=0\n",
-             nbytes, (intmax_t)alignedblock);
-      memcpy(dev->eblock, buffer, nbytes);
-
-      /* And write the erase back to flash */
-
-      nxfrd = MTD_BWRITE(dev->mtd, alignedblock, dev->blkper, dev->eblock);
-      if (nxfrd != dev->blkper)
+      else
+#endif
         {
-          ferr("ERROR: Write erase block %jd failed: %zu\n",
-               (intmax_t)alignedblock, nxfrd);
-          return -EIO;
+          /* Then erase the erase block */
+
+          eraseblock = alignedblock / dev->blkper;
+          ret        = MTD_ERASE(dev->mtd, eraseblock, 1);
+          if (ret < 0)
+            {
+              ferr("ERROR: Erase block=%jd failed: %d\n",
+                   (intmax_t)eraseblock, ret);
+              return ret;
+            }
+
+          ftl_stat_increment(dev, nerases);
+
+          /* Copy the user data at the beginning the buffered erase block */
+
+          finfo("Copy %d bytes into erase block=%jd at offset=0\n",
+                 nbytes, (intmax_t)alignedblock);
+          memcpy(dev->eblock, buffer, nbytes);
+
+          /* And write the erase back to flash */
+
+          nxfrd = MTD_BWRITE(dev->mtd, alignedblock, dev->blkper,
+                             dev->eblock);
+          if (nxfrd != dev->blkper)
+            {
+              ferr("ERROR: Write erase block %jd failed: %zu\n",
+                   (intmax_t)alignedblock, nxfrd);
+              return -EIO;
+            }
         }
     }
 
+#ifdef CONFIG_FTL_STATISTICS
+  /* Update the write latency statistics */
+
+  elapsed = clock_systime_ticks() - start;
+  dev->stats.totwrlatency += elapsed;
+  if (elapsed > dev->stats.maxwrlatency)
+    {
+      dev->stats.maxwrlatency = elapsed;
+    }
+#endif
+
   return nblocks;
 }
 
@@ -446,6 +595,7 @@ static ssize_t ftl_write(FAR struct inode *inode,
 
   DEBUGASSERT(inode && inode->i_private);
   dev = (struct ftl_struct_s *)inode->i_private;
+  ftl_stat_increment(dev, nwrites);
 #ifdef FTL_HAVE_RWBUFFER
   return rwb_write(&dev->rwb, start_sector, nsectors, buffer);
 #else
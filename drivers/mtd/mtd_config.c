@@ -63,6 +63,11 @@
 #include <nuttx/mtd/mtd.h>
 #include <nuttx/mtd/configdata.h>
 
+#ifdef CONFIG_MTD_CONFIG_IDLE_CONSOLIDATE
+#  include <nuttx/clock.h>
+#  include <nuttx/wqueue.h>
+#endif
+
 #ifdef CONFIG_MTD_CONFIG
 
 /****************************************************************************
@@ -85,6 +90,20 @@
 
 #define MTD_ERASED_FLAGS  CONFIG_MTD_CONFIG_ERASEDVALUE
 
+/* Initial capacity of the in-RAM entry index (grows by doubling) */
+
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+#  define MTDCONFIG_INDEX_INITSIZE      16
+#endif
+
+/* How long to wait before retrying an idle-time consolidation that found
+ * the device busy.
+ */
+
+#ifdef CONFIG_MTD_CONFIG_IDLE_CONSOLIDATE
+#  define MTDCONFIG_CONSOLIDATE_DELAY   MSEC2TICK(500)
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -99,7 +118,35 @@ struct mtdconfig_struct_s
   size_t       neraseblocks;  /* Number of erase blocks available */
   off_t        readoff;       /* Read offset (for hexdump) */
   FAR uint8_t *buffer;        /* Temp block read buffer */
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+  FAR struct mtdconfig_indexentry_s *index; /* In-RAM entry index */
+  off_t        freeoffset;    /* Start of the erased append region */
+  uint16_t     indexcount;    /* Number of entries in the index */
+  uint16_t     indexsize;     /* Allocated index capacity (entries) */
+  bool         indexvalid;    /* Index reflects the FLASH contents */
+#endif
+#ifdef CONFIG_MTD_CONFIG_IDLE_CONSOLIDATE
+  struct work_s work;         /* Supports idle-time consolidation */
+#endif
+};
+
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+/* One entry of the in-RAM index:  the identification and location of an
+ * active item on the FLASH.
+ */
+
+struct mtdconfig_indexentry_s
+{
+#ifdef CONFIG_MTD_CONFIG_NAMED
+  char         name[CONFIG_MTD_CONFIG_NAME_LEN];
+#else
+  uint8_t      instance;      /* Instance of the item */
+  uint16_t     id;            /* ID of the config data item */
+#endif
+  uint16_t     len;           /* Length of the data block */
+  off_t        offset;        /* Offset of the entry header */
 };
+#endif
 
 begin_packed_struct struct mtdconfig_header_s
 {
@@ -325,6 +372,239 @@ errout:
   return ret;
 }
 
+/****************************************************************************
+ * Name: mtdconfig_index_invalidate
+ *
+ *    Discards the in-RAM entry index.  This must be done whenever the
+ *    FLASH layout is rearranged behind the index's back (consolidation).
+ *    The index will be rebuilt lazily on the next access.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+static void mtdconfig_index_invalidate(FAR struct mtdconfig_struct_s *dev)
+{
+  dev->indexvalid = false;
+  dev->indexcount = 0;
+  dev->freeoffset = 0;
+}
+#else
+#  define mtdconfig_index_invalidate(dev)
+#endif
+
+/****************************************************************************
+ * Name: mtdconfig_index_append
+ *
+ *    Adds one active entry to the in-RAM index, growing the index array
+ *    as needed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+static int mtdconfig_index_append(FAR struct mtdconfig_struct_s *dev,
+                                  FAR struct mtdconfig_header_s *phdr,
+                                  off_t offset)
+{
+  FAR struct mtdconfig_indexentry_s *newindex;
+  uint16_t newsize;
+
+  if (dev->indexcount >= dev->indexsize)
+    {
+      /* Grow the index array by doubling */
+
+      newsize  = dev->indexsize > 0 ? dev->indexsize << 1 :
+                 MTDCONFIG_INDEX_INITSIZE;
+      newindex = (FAR struct mtdconfig_indexentry_s *)
+        kmm_realloc(dev->index, newsize * sizeof(*newindex));
+      if (newindex == NULL)
+        {
+          return -ENOMEM;
+        }
+
+      dev->index     = newindex;
+      dev->indexsize = newsize;
+    }
+
+#ifdef CONFIG_MTD_CONFIG_NAMED
+  strcpy(dev->index[dev->indexcount].name, phdr->name);
+#else
+  dev->index[dev->indexcount].id       = phdr->id;
+  dev->index[dev->indexcount].instance = phdr->instance;
+#endif
+  dev->index[dev->indexcount].len    = phdr->len;
+  dev->index[dev->indexcount].offset = offset;
+  dev->indexcount++;
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: mtdconfig_index_find
+ *
+ *    Looks an item up in the in-RAM index.
+ *
+ * Returned Value:
+ *     The index array position of the item, or a negated errno value if
+ *     the item is not in the index.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+static int mtdconfig_index_find(FAR struct mtdconfig_struct_s *dev,
+                                FAR struct config_data_s *pdata)
+{
+  int ndx;
+
+  for (ndx = 0; ndx < dev->indexcount; ndx++)
+    {
+#ifdef CONFIG_MTD_CONFIG_NAMED
+      if (strcmp(pdata->name, dev->index[ndx].name) == 0)
+#else
+      if (pdata->id == dev->index[ndx].id &&
+          pdata->instance == dev->index[ndx].instance)
+#endif
+        {
+          return ndx;
+        }
+    }
+
+  return -ENOENT;
+}
+#endif
+
+/****************************************************************************
+ * Name: mtdconfig_index_build
+ *
+ *    Builds the in-RAM entry index with a single scan of the partition,
+ *    recording the location of every active entry and of the erased
+ *    region at the end of the entry log where new items are appended.
+ *    The scan is performed only once; subsequent calls return
+ *    immediately until the index is invalidated.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+static int mtdconfig_index_build(FAR struct mtdconfig_struct_s *dev)
+{
+  struct mtdconfig_header_s hdr;
+  off_t     offset = CONFIGDATA_BLOCK_HDR_SIZE;
+  off_t     bytes_left_in_block;
+  uint16_t  block;
+  uint16_t  endblock;
+  uint8_t   sig[CONFIGDATA_BLOCK_HDR_SIZE];
+  int       ret;
+
+  if (dev->indexvalid)
+    {
+      return OK;
+    }
+
+  /* Read and validate the signature bytes */
+
+  ret = mtdconfig_readbytes(dev, 0, sig, sizeof(sig));
+  if (ret != OK)
+    {
+      return ret;
+    }
+
+  if (sig[0] != 'C' || sig[1] != 'D' || sig[2] != CONFIGDATA_FORMAT_VERSION)
+    {
+      /* Config Data partition not formatted. */
+
+      return -ENOSYS;
+    }
+
+#ifdef CONFIG_MTD_CONFIG_RAM_CONSOLIDATE
+  endblock = dev->neraseblocks;
+#else
+  if (dev->neraseblocks == 1)
+    {
+      endblock = 1;
+    }
+  else
+    {
+      endblock = dev->neraseblocks - 1;
+    }
+#endif
+
+  dev->indexcount = 0;
+  dev->freeoffset = 0;
+
+  /* Walk every header in the partition exactly once */
+
+  while (offset > 0)
+    {
+      /* Test if too close to the end of the erase block for a header */
+
+      block = offset / dev->erasesize;
+      bytes_left_in_block = (block + 1) * dev->erasesize - offset;
+      if (bytes_left_in_block <= sizeof(hdr))
+        {
+          if (block + 1 >= endblock)
+            {
+              break;
+            }
+
+          offset = (block + 1) * dev->erasesize + CONFIGDATA_BLOCK_HDR_SIZE;
+          continue;
+        }
+
+      ret = mtdconfig_readbytes(dev, offset, (FAR uint8_t *)&hdr,
+                                sizeof(hdr));
+      if (ret != OK)
+        {
+          return ret;
+        }
+
+#ifdef CONFIG_MTD_CONFIG_NAMED
+      if (hdr.name[0] == CONFIG_MTD_CONFIG_ERASEDVALUE)
+#else
+      if (hdr.id == MTD_ERASED_ID)
+#endif
+        {
+          /* An erased header:  free space starts here.  The walk ends at
+           * the erased region following the last written entry; remember
+           * it as the append point.  Continue with the next erase block
+           * since an undersized block tail may have been skipped when an
+           * earlier entry was written.
+           */
+
+          dev->freeoffset = offset;
+
+          if (block + 1 >= endblock)
+            {
+              break;
+            }
+
+          offset = (block + 1) * dev->erasesize + CONFIGDATA_BLOCK_HDR_SIZE;
+          continue;
+        }
+
+      if (hdr.flags == MTD_ERASED_FLAGS)
+        {
+          /* This is an active entry.  Add it to the index. */
+
+          ret = mtdconfig_index_append(dev, &hdr, offset);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+
+      /* Advance past this entry (active or released) */
+
+      offset += sizeof(hdr) + hdr.len;
+      if (offset % dev->erasesize == 0)
+        {
+          offset += CONFIGDATA_BLOCK_HDR_SIZE;
+        }
+    }
+
+  dev->indexvalid = true;
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Name: mtdconfig_findfirstentry
  *
@@ -586,6 +866,12 @@ static off_t mtdconfig_ramconsolidate(FAR struct mtdconfig_struct_s *dev)
   uint8_t     sig[CONFIGDATA_BLOCK_HDR_SIZE];
   int         ret;
 
+  /* The consolidation rearranges the FLASH contents, so any in-RAM index
+   * is stale from here on.
+   */
+
+  mtdconfig_index_invalidate(dev);
+
   /* Allocate a consolidation buffer */
 
   pbuf = (FAR uint8_t *)kmm_malloc(dev->erasesize);
@@ -775,6 +1061,12 @@ static off_t  mtdconfig_consolidate(FAR struct mtdconfig_struct_s *dev)
   uint8_t     sig[CONFIGDATA_BLOCK_HDR_SIZE];
   FAR uint8_t *pbuf;
 
+  /* The consolidation rearranges the FLASH contents, so any in-RAM index
+   * is stale from here on.
+   */
+
+  mtdconfig_index_invalidate(dev);
+
   /* Prepare to copy block 0 to the last block (erase blocks) */
 
   src_block = 0;
@@ -1017,6 +1309,58 @@ errout:
 
 #endif /* CONFIG_MTD_CONFIG_RAM_CONSOLIDATE */
 
+/****************************************************************************
+ * Name: mtdconfig_consolidate_worker
+ *
+ *    Performs consolidation of released entries from the low priority
+ *    work queue so that it happens during idle time rather than
+ *    synchronously on some later save when the partition finally runs
+ *    out of append space.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_CONFIG_IDLE_CONSOLIDATE
+static void mtdconfig_consolidate_worker(FAR void *arg)
+{
+  FAR struct mtdconfig_struct_s *dev =
+    (FAR struct mtdconfig_struct_s *)arg;
+
+  /* The device may be held open (and therefore locked) for a long time.
+   * Do not block the worker thread in that case; just try again later.
+   */
+
+  if (nxsem_trywait(&dev->exclsem) < 0)
+    {
+      work_queue(LPWORK, &dev->work, mtdconfig_consolidate_worker, dev,
+                 MTDCONFIG_CONSOLIDATE_DELAY);
+      return;
+    }
+
+  /* Allocate the temp block buffer used by the consolidate routines */
+
+  dev->buffer = (FAR uint8_t *)kmm_malloc(dev->blocksize);
+  if (dev->buffer != NULL)
+    {
+#ifdef CONFIG_MTD_CONFIG_RAM_CONSOLIDATE
+      mtdconfig_ramconsolidate(dev);
+#else
+      if (dev->neraseblocks == 1)
+        {
+          mtdconfig_ramconsolidate(dev);
+        }
+      else
+        {
+          mtdconfig_consolidate(dev);
+        }
+#endif
+
+      kmm_free(dev->buffer);
+    }
+
+  nxsem_post(&dev->exclsem);
+}
+#endif /* CONFIG_MTD_CONFIG_IDLE_CONSOLIDATE */
+
 /****************************************************************************
  * Name: mtdconfig_open
  ****************************************************************************/
@@ -1161,6 +1505,206 @@ static int mtdconfig_findentry(FAR struct mtdconfig_struct_s *dev,
   return offset;
 }
 
+/****************************************************************************
+ * Name: mtdconfig_setconfig_indexed
+ *
+ *    Saves one config item using the in-RAM index:  the existing entry
+ *    (if any) is released directly at its indexed offset and the new data
+ *    is appended at the cached end of the entry log.  No partition scan
+ *    is performed, so back-to-back saves of many items cost one small
+ *    write each.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+static int mtdconfig_setconfig_indexed(FAR struct mtdconfig_struct_s *dev,
+                                       FAR struct config_data_s *pdata)
+{
+  struct mtdconfig_header_s hdr;
+  char      retrycount = 0;
+  off_t     offset;
+  off_t     bytes;
+  uint16_t  block;
+  uint16_t  endblock;
+  int       ndx;
+  int       ret;
+
+#ifdef CONFIG_MTD_CONFIG_RAM_CONSOLIDATE
+  endblock = dev->neraseblocks;
+#else
+  if (dev->neraseblocks == 1)
+    {
+      endblock = 1;
+    }
+  else
+    {
+      endblock = dev->neraseblocks - 1;
+    }
+#endif
+
+  /* If the config item is already in the database, then it must be marked
+   * as released before the new entry is appended.
+   */
+
+  ndx = mtdconfig_index_find(dev, pdata);
+  if (ndx >= 0)
+    {
+      hdr.flags = (uint8_t)~MTD_ERASED_FLAGS;
+      mtdconfig_writebytes(dev, dev->index[ndx].offset, &hdr.flags,
+                           sizeof(hdr.flags));
+
+      /* Remove the released entry from the index */
+
+      dev->index[ndx] = dev->index[dev->indexcount - 1];
+      dev->indexcount--;
+    }
+
+  /* Test if the new length is zero.  If it is, then we are
+   * deleting the entry.
+   */
+
+  if (pdata->len == 0)
+    {
+      return OK;
+    }
+
+retry_append:
+
+  /* Append the new entry at the cached end of the entry log */
+
+  offset = dev->freeoffset;
+  if (offset >= (off_t)endblock * dev->erasesize)
+    {
+      offset = 0;
+    }
+
+  if (offset > 0)
+    {
+      /* Test if the entry fits in the erase block holding the append
+       * point.  If not, then advance to the next erase block (which is
+       * erased:  it lies beyond the end of the entry log).
+       */
+
+      block = offset / dev->erasesize;
+      if ((block + 1) * dev->erasesize - offset < sizeof(hdr) + pdata->len)
+        {
+          if (block + 1 >= endblock)
+            {
+              offset = 0;
+            }
+          else
+            {
+              offset = (block + 1) * dev->erasesize +
+                       CONFIGDATA_BLOCK_HDR_SIZE;
+            }
+        }
+    }
+
+  if (offset == 0)
+    {
+      /* No free entries left on device!  Consolidate the released
+       * entries, rebuild the index and try one more time.
+       */
+
+      if (retrycount)
+        {
+          /* Out of space! */
+
+          return -ENOMEM;
+        }
+
+#ifdef CONFIG_MTD_CONFIG_RAM_CONSOLIDATE
+      mtdconfig_ramconsolidate(dev);
+#else
+      if (dev->neraseblocks == 1)
+        {
+          mtdconfig_ramconsolidate(dev);
+        }
+      else
+        {
+          mtdconfig_consolidate(dev);
+        }
+#endif
+
+      ret = mtdconfig_index_build(dev);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      retrycount++;
+      goto retry_append;
+    }
+
+  /* Save the data at this entry */
+
+#ifdef CONFIG_MTD_CONFIG_NAMED
+  strcpy(hdr.name, pdata->name);
+#else
+  hdr.id       = pdata->id;
+  hdr.instance = pdata->instance;
+#endif
+  hdr.len   = pdata->len;
+  hdr.flags = MTD_ERASED_FLAGS;
+
+  ret = mtdconfig_writebytes(dev, offset, (FAR uint8_t *)&hdr,
+                             sizeof(hdr));
+  if (ret != sizeof(hdr))
+    {
+      /* Cannot write even header! */
+
+      return -EIO;
+    }
+
+  bytes = mtdconfig_writebytes(dev, offset + sizeof(hdr),
+                               pdata->configdata, pdata->len);
+
+  /* The appended space is consumed whether or not the data write
+   * succeeded.
+   */
+
+  dev->freeoffset = offset + sizeof(hdr) + pdata->len;
+  if (dev->freeoffset % dev->erasesize == 0)
+    {
+      dev->freeoffset += CONFIGDATA_BLOCK_HDR_SIZE;
+    }
+
+  if (bytes != pdata->len)
+    {
+      /* Error writing data!  Mark the half-written entry as released. */
+
+      hdr.flags = (uint8_t)~MTD_ERASED_FLAGS;
+      mtdconfig_writebytes(dev, offset, &hdr.flags, sizeof(hdr.flags));
+      return -EIO;
+    }
+
+  /* Remember the new entry in the index */
+
+  ret = mtdconfig_index_append(dev, &hdr, offset);
+  if (ret < 0)
+    {
+      /* The FLASH contents are valid, but the index no longer is */
+
+      mtdconfig_index_invalidate(dev);
+    }
+
+#ifdef CONFIG_MTD_CONFIG_IDLE_CONSOLIDATE
+  /* If less than one erase block of append space remains, then schedule
+   * consolidation on the low priority work queue so that it happens
+   * during idle time instead of synchronously on some later save.
+   */
+
+  if ((off_t)endblock * dev->erasesize - dev->freeoffset <
+      (off_t)dev->erasesize)
+    {
+      work_queue(LPWORK, &dev->work, mtdconfig_consolidate_worker, dev, 0);
+    }
+#endif
+
+  return OK;
+}
+#endif /* CONFIG_MTD_CONFIG_RAM_INDEX */
+
 /****************************************************************************
  * Name: mtdconfig_setconfig
  ****************************************************************************/
@@ -1186,6 +1730,19 @@ static int mtdconfig_setconfig(FAR struct mtdconfig_struct_s *dev,
       return -ENOMEM;
     }
 
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+  /* Fast path:  save the item using the in-RAM index.  Fall back to the
+   * full partition scan below if the index cannot be built (e.g. the
+   * partition is not yet formatted).
+   */
+
+  if (mtdconfig_index_build(dev) == OK)
+    {
+      ret = mtdconfig_setconfig_indexed(dev, pdata);
+      goto errout;
+    }
+#endif
+
   /* Read and validate the signature bytes */
 
 retry:
@@ -1405,6 +1962,9 @@ static int mtdconfig_getconfig(FAR struct mtdconfig_struct_s *dev,
   off_t  offset;
   off_t  bytes_to_read;
   struct mtdconfig_header_s hdr;
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+  int    ndx;
+#endif
 
   /* Allocate a temp block buffer */
 
@@ -1414,6 +1974,41 @@ static int mtdconfig_getconfig(FAR struct mtdconfig_struct_s *dev,
       return -ENOMEM;
     }
 
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+  /* Fast path:  look the item up in the in-RAM index */
+
+  if (mtdconfig_index_build(dev) == OK)
+    {
+      ndx = mtdconfig_index_find(dev, pdata);
+      if (ndx >= 0)
+        {
+          /* Entry found.  Read the data directly at its indexed offset */
+
+          bytes_to_read = dev->index[ndx].len;
+          if (bytes_to_read > pdata->len)
+            {
+              bytes_to_read = pdata->len;
+            }
+
+          ret = mtdconfig_readbytes(dev, dev->index[ndx].offset +
+                                    sizeof(hdr), pdata->configdata,
+                                    bytes_to_read);
+          if (ret == OK)
+            {
+              /* Set return data length to match the config item length */
+
+              pdata->len = dev->index[ndx].len;
+            }
+          else
+            {
+              ret = -EIO;
+            }
+        }
+
+      goto errout;
+    }
+#endif
+
   /* Get the offset of the first entry.  This will also check
    * the format signature bytes.
    */
@@ -1473,6 +2068,9 @@ static int mtdconfig_deleteconfig(FAR struct mtdconfig_struct_s *dev,
   int    ret = -ENOENT;
   off_t  offset;
   struct mtdconfig_header_s hdr;
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+  int    ndx;
+#endif
 
   /* Allocate a temp block buffer */
 
@@ -1482,6 +2080,31 @@ static int mtdconfig_deleteconfig(FAR struct mtdconfig_struct_s *dev,
       return -ENOMEM;
     }
 
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+  /* Fast path:  release the entry directly at its indexed offset */
+
+  if (mtdconfig_index_build(dev) == OK)
+    {
+      ndx = mtdconfig_index_find(dev, pdata);
+      if (ndx >= 0)
+        {
+          /* Entry found.  Mark this entry as released */
+
+          hdr.flags = (uint8_t)~MTD_ERASED_FLAGS;
+          mtdconfig_writebytes(dev, dev->index[ndx].offset, &hdr.flags,
+                               sizeof(hdr.flags));
+
+          /* And remove it from the index */
+
+          dev->index[ndx] = dev->index[dev->indexcount - 1];
+          dev->indexcount--;
+          ret = OK;
+        }
+
+      goto errout;
+    }
+#endif
+
   /* Get the offset of the first entry.  This will also check
    * the format signature bytes.
    */
@@ -1505,6 +2128,10 @@ static int mtdconfig_deleteconfig(FAR struct mtdconfig_struct_s *dev,
       ret = OK;
     }
 
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+errout:
+#endif
+
   /* Free the buffer */
 
   kmm_free(dev->buffer);
@@ -1716,6 +2343,17 @@ int mtdconfig_register(FAR struct mtd_dev_s *mtd)
       dev->mtd = mtd;
       nxsem_init(&dev->exclsem, 0, 1);
 
+#ifdef CONFIG_MTD_CONFIG_RAM_INDEX
+      dev->index      = NULL;
+      dev->indexcount = 0;
+      dev->indexsize  = 0;
+      dev->freeoffset = 0;
+      dev->indexvalid = false;
+#endif
+#ifdef CONFIG_MTD_CONFIG_IDLE_CONSOLIDATE
+      memset(&dev->work, 0, sizeof(dev->work));
+#endif
+
       /* Get the device geometry. (casting to uintptr_t first eliminates
        * complaints on some architectures where the sizeof long is different
        * from the size of a pointer).
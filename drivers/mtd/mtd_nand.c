@@ -589,6 +589,9 @@ static ssize_t nand_bread(struct mtd_dev_s *dev, off_t startpage,
   FAR struct nand_model_s *model;
   unsigned int pagesperblock;
   unsigned int page;
+#ifdef CONFIG_MTD_NAND_MULTIPAGE
+  unsigned int nrun;
+#endif
   uint16_t pagesize;
   size_t remaining;
   off_t maxblock;
@@ -622,7 +625,8 @@ static ssize_t nand_bread(struct mtd_dev_s *dev, off_t startpage,
 
   /* Then read every page from NAND */
 
-  for (remaining = npages; remaining > 0; remaining--)
+  remaining = npages;
+  while (remaining > 0)
     {
       /* Check for attempt to read beyond the end of NAND */
 
@@ -635,6 +639,64 @@ static ssize_t nand_bread(struct mtd_dev_s *dev, off_t startpage,
           goto errout_with_lock;
         }
 
+#ifdef CONFIG_MTD_NAND_MULTIPAGE
+      /* If the lower half can transfer a run of consecutive pages in a
+       * single operation, then hand it as many pages as remain in the
+       * current erase block.  The run is limited to one block so that the
+       * bad block check is not bypassed.
+       */
+
+      if (raw->multiread != NULL
+#ifdef CONFIG_MTD_NAND_SWECC
+          && raw->ecctype != NANDECC_SWECC
+#endif
+          && remaining > 1)
+        {
+          nrun = pagesperblock - page;
+          if (nrun > remaining)
+            {
+              nrun = remaining;
+            }
+
+          /* Check that the block is not BAD if data is requested */
+
+          if (nand_checkblock(nand, block) != GOODBLOCK)
+            {
+              ferr("ERROR: Block is BAD\n");
+              ret = -EAGAIN;
+              goto errout_with_lock;
+            }
+
+          /* Read the run of pages from NAND */
+
+          ret = NAND_MULTIREAD(raw, block, page, nrun, buffer);
+          if (ret < 0)
+            {
+              ferr("ERROR: NAND_MULTIREAD failed block=%ld page=%d: %d\n",
+                   (long)block, page, ret);
+              goto errout_with_lock;
+            }
+
+          /* Increment the page number by the length of the run.  If we
+           * exhausted the block, then reset the page number and bump up
+           * the block number.
+           */
+
+          page += nrun;
+          if (page >= pagesperblock)
+            {
+              page = 0;
+              block++;
+            }
+
+          /* Increment the buffer pointer by the size of the run */
+
+          buffer    += (size_t)nrun * pagesize;
+          remaining -= nrun;
+          continue;
+        }
+#endif
+
       /* Read the next page from NAND */
 
       ret = nand_readpage(nand, block, page, buffer);
@@ -659,6 +721,7 @@ static ssize_t nand_bread(struct mtd_dev_s *dev, off_t startpage,
       /* Increment the buffer point by the size of one page */
 
       buffer += pagesize;
+      remaining--;
     }
 
   nand_unlock(nand);
@@ -685,6 +748,9 @@ static ssize_t nand_bwrite(struct mtd_dev_s *dev, off_t startpage,
   FAR struct nand_model_s *model;
   unsigned int pagesperblock;
   unsigned int page;
+#ifdef CONFIG_MTD_NAND_MULTIPAGE
+  unsigned int nrun;
+#endif
   uint16_t pagesize;
   size_t remaining;
   off_t maxblock;
@@ -718,7 +784,8 @@ static ssize_t nand_bwrite(struct mtd_dev_s *dev, off_t startpage,
 
   /* Then write every page into NAND */
 
-  for (remaining = npages; remaining > 0; remaining--)
+  remaining = npages;
+  while (remaining > 0)
     {
       /* Check for attempt to write beyond the end of NAND */
 
@@ -731,6 +798,64 @@ static ssize_t nand_bwrite(struct mtd_dev_s *dev, off_t startpage,
           goto errout_with_lock;
         }
 
+#ifdef CONFIG_MTD_NAND_MULTIPAGE
+      /* If the lower half can transfer a run of consecutive pages in a
+       * single operation, then hand it as many pages as remain in the
+       * current erase block.  The run is limited to one block so that the
+       * bad block check is not bypassed.
+       */
+
+      if (raw->multiwrite != NULL
+#ifdef CONFIG_MTD_NAND_SWECC
+          && raw->ecctype != NANDECC_SWECC
+#endif
+          && remaining > 1)
+        {
+          nrun = pagesperblock - page;
+          if (nrun > remaining)
+            {
+              nrun = remaining;
+            }
+
+          /* Check that the block is good */
+
+          if (nand_checkblock(nand, block) != GOODBLOCK)
+            {
+              ferr("ERROR: Block is BAD\n");
+              ret = -EAGAIN;
+              goto errout_with_lock;
+            }
+
+          /* Write the run of pages into NAND */
+
+          ret = NAND_MULTIWRITE(raw, block, page, nrun, buffer);
+          if (ret < 0)
+            {
+              ferr("ERROR: NAND_MULTIWRITE failed block=%ld page=%d: %d\n",
+                   (long)block, page, ret);
+              goto errout_with_lock;
+            }
+
+          /* Increment the page number by the length of the run.  If we
+           * exhausted the block, then reset the page number and bump up
+           * the block number.
+           */
+
+          page += nrun;
+          if (page >= pagesperblock)
+            {
+              page = 0;
+              block++;
+            }
+
+          /* Increment the buffer pointer by the size of the run */
+
+          buffer    += (size_t)nrun * pagesize;
+          remaining -= nrun;
+          continue;
+        }
+#endif
+
       /* Write the next page into NAND */
 
       ret = nand_writepage(nand, block, page, buffer);
@@ -755,6 +880,7 @@ static ssize_t nand_bwrite(struct mtd_dev_s *dev, off_t startpage,
       /* Increment the buffer point by the size of one page */
 
       buffer += pagesize;
+      remaining--;
     }
 
   nand_unlock(nand);
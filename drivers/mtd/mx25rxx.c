@@ -48,6 +48,8 @@
 
 #ifdef CONFIG_MX25RXX_SECTOR512
 #  include <stdlib.h>
+#endif
+#if defined(CONFIG_MX25RXX_SECTOR512) || defined(CONFIG_QSPI_MEMMAP)
 #  include <string.h>
 #endif
 
@@ -186,6 +188,9 @@ struct mx25rxx_dev_s
   uint8_t                pageshift;   /* Log2 of page size */
   uint16_t               nsectors;    /* Number of erase sectors */
 
+#ifdef CONFIG_QSPI_MEMMAP
+  FAR const uint8_t     *mbase;       /* Memory-mapped read window (NULL if unmapped) */
+#endif
 #ifdef CONFIG_MX25RXX_SECTOR512
   uint8_t                flags;       /* Buffered sector flags */
   uint16_t               esectno;     /* Erase sector number in the cache */
@@ -232,6 +237,12 @@ static void mx25rxx_write_enable(FAR struct mx25rxx_dev_s *dev, bool enable);
 
 static int mx25rxx_write_page(struct mx25rxx_dev_s *priv,
                        FAR const uint8_t *buffer, off_t address, size_t buflen);
+#ifdef CONFIG_QSPI_MEMMAP
+static void mx25rxx_memmap(FAR struct mx25rxx_dev_s *priv);
+static void mx25rxx_unmap(FAR struct mx25rxx_dev_s *priv);
+#else
+#  define mx25rxx_unmap(priv)
+#endif
 static int mx25rxx_erase_sector(struct mx25rxx_dev_s *priv, off_t sector);
 #if 0 /* FIXME:  Not used */
 static int mx25rxx_erase_block(struct mx25rxx_dev_s *priv, off_t block);
@@ -370,6 +381,53 @@ int mx25rxx_read_byte(FAR struct mx25rxx_dev_s *dev, FAR uint8_t *buffer,
   return QSPI_MEMORY(dev->qspi, &meminfo);
 }
 
+#ifdef CONFIG_QSPI_MEMMAP
+/* Map the FLASH for memory-mapped read access.  On failure, priv->mbase is
+ * left NULL and command-based reads will be used instead.
+ */
+
+static void mx25rxx_memmap(FAR struct mx25rxx_dev_s *priv)
+{
+  struct qspi_meminfo_s meminfo;
+  FAR const void *mbase;
+  int ret;
+
+  /* Describe the read access that the controller is to perform for accesses
+   * falling in the window.
+   */
+
+  meminfo.flags   = QSPIMEM_READ | QSPIMEM_QUADIO;
+  meminfo.addrlen = 3;
+  meminfo.dummies = 6;
+  meminfo.buflen  = (uint32_t)priv->nsectors << priv->sectorshift;
+  meminfo.cmd     = MX25R_4READ;
+  meminfo.addr    = 0;
+  meminfo.buffer  = NULL;
+
+  ret = QSPI_MEMMAP(priv->qspi, &meminfo, &mbase);
+  if (ret < 0)
+    {
+      finfo("QSPI_MEMMAP not supported: %d\n", ret);
+      mbase = NULL;
+    }
+
+  priv->mbase = (FAR const uint8_t *)mbase;
+}
+
+/* Revert to command mode.  Must be called before any command or memory
+ * transfer if the FLASH is memory-mapped.
+ */
+
+static void mx25rxx_unmap(FAR struct mx25rxx_dev_s *priv)
+{
+  if (priv->mbase != NULL)
+    {
+      QSPI_UNMAP(priv->qspi);
+      priv->mbase = NULL;
+    }
+}
+#endif
+
 int mx25rxx_write_page(struct mx25rxx_dev_s *priv, FAR const uint8_t *buffer,
                        off_t address, size_t buflen)
 {
@@ -565,6 +623,7 @@ int mx25rxx_erase(FAR struct mtd_dev_s *dev, off_t startblock, size_t nblocks)
   /* Lock access to the SPI bus until we complete the erase */
 
   mx25rxx_lock(priv->qspi, false);
+  mx25rxx_unmap(priv);
 
   while (blocksleft-- > 0)
     {
@@ -665,6 +724,7 @@ ssize_t mx25rxx_bwrite(FAR struct mtd_dev_s *dev, off_t startblock,
   /* Lock the QuadSPI bus and write all of the pages to FLASH */
 
   mx25rxx_lock(priv->qspi, false);
+  mx25rxx_unmap(priv);
 
 #if defined(CONFIG_MX25RXX_SECTOR512)
   ret = mx25rxx_write_cache(priv, buf, startblock, nblocks);
@@ -698,7 +758,28 @@ ssize_t mx25rxx_read(FAR struct mtd_dev_s *dev, off_t offset, size_t nbytes,
   /* Lock the QuadSPI bus and select this FLASH part */
 
   mx25rxx_lock(priv->qspi, true);
-  ret = mx25rxx_read_byte(priv, buffer, offset, nbytes);
+
+#ifdef CONFIG_QSPI_MEMMAP
+  /* Map the FLASH for memory-mapped access if it is not already mapped and
+   * then satisfy the read with a simple memcpy from the read window.
+   */
+
+  if (priv->mbase == NULL)
+    {
+      mx25rxx_memmap(priv);
+    }
+
+  if (priv->mbase != NULL)
+    {
+      memcpy(buffer, priv->mbase + offset, nbytes);
+      ret = OK;
+    }
+  else
+#endif
+    {
+      ret = mx25rxx_read_byte(priv, buffer, offset, nbytes);
+    }
+
   mx25rxx_unlock(priv->qspi);
 
   if (ret < 0)
@@ -759,6 +840,7 @@ int mx25rxx_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg)
           /* Erase the entire device */
 
           mx25rxx_lock(priv->qspi, false);
+          mx25rxx_unmap(priv);
           ret = mx25rxx_erase_chip(priv);
           mx25rxx_unlock(priv->qspi);
         }
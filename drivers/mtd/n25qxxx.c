@@ -277,6 +277,9 @@ struct n25qxxx_dev_s
   FAR uint8_t           *cmdbuf;      /* Allocated command buffer */
   FAR uint8_t           *readbuf;     /* Allocated status read buffer */
 
+#ifdef CONFIG_QSPI_MEMMAP
+  FAR const uint8_t     *mbase;       /* Memory-mapped read window (NULL if unmapped) */
+#endif
 #ifdef CONFIG_N25QXXX_SECTOR512
   uint8_t                flags;       /* Buffered sector flags */
   uint16_t               esectno;     /* Erase sector number in the cache */
@@ -322,6 +325,12 @@ static int  n25qxxx_read_byte(FAR struct n25qxxx_dev_s *priv, FAR uint8_t *buffe
               off_t address, size_t nbytes);
 static int  n25qxxx_write_page(FAR struct n25qxxx_dev_s *priv,
               FAR const uint8_t *buffer, off_t address, size_t nbytes);
+#ifdef CONFIG_QSPI_MEMMAP
+static void n25qxxx_memmap(FAR struct n25qxxx_dev_s *priv);
+static void n25qxxx_unmap(FAR struct n25qxxx_dev_s *priv);
+#else
+#  define n25qxxx_unmap(priv)
+#endif
 #ifdef CONFIG_N25QXXX_SECTOR512
 static int  n25qxxx_flush_cache(struct n25qxxx_dev_s *priv);
 static FAR uint8_t *n25qxxx_read_cache(struct n25qxxx_dev_s *priv, off_t sector);
@@ -885,6 +894,65 @@ static int n25qxxx_read_byte(FAR struct n25qxxx_dev_s *priv, FAR uint8_t *buffer
   return QSPI_MEMORY(priv->qspi, &meminfo);
 }
 
+/************************************************************************************
+ * Name: n25qxxx_memmap
+ *
+ * Description:
+ *   Map the FLASH for memory-mapped read access.  On failure, priv->mbase is left
+ *   NULL and command-based reads will be used instead.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_QSPI_MEMMAP
+static void n25qxxx_memmap(FAR struct n25qxxx_dev_s *priv)
+{
+  struct qspi_meminfo_s meminfo;
+  FAR const void *mbase;
+  int ret;
+
+  /* Describe the read access that the controller is to perform for accesses
+   * falling in the window.
+   */
+
+  meminfo.flags   = QSPIMEM_READ | QSPIMEM_QUADIO;
+  meminfo.addrlen = 3;
+  meminfo.dummies = CONFIG_N25QXXX_DUMMIES;
+  meminfo.buflen  = (uint32_t)priv->nsectors << priv->sectorshift;
+  meminfo.cmd     = N25QXXX_FAST_READ_QUADIO;
+  meminfo.addr    = 0;
+  meminfo.buffer  = NULL;
+
+  ret = QSPI_MEMMAP(priv->qspi, &meminfo, &mbase);
+  if (ret < 0)
+    {
+      finfo("QSPI_MEMMAP not supported: %d\n", ret);
+      mbase = NULL;
+    }
+
+  priv->mbase = (FAR const uint8_t *)mbase;
+}
+#endif
+
+/************************************************************************************
+ * Name: n25qxxx_unmap
+ *
+ * Description:
+ *   Revert to command mode.  Must be called before any command or memory transfer
+ *   if the FLASH is memory-mapped.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_QSPI_MEMMAP
+static void n25qxxx_unmap(FAR struct n25qxxx_dev_s *priv)
+{
+  if (priv->mbase != NULL)
+    {
+      QSPI_UNMAP(priv->qspi);
+      priv->mbase = NULL;
+    }
+}
+#endif
+
 /************************************************************************************
  * Name:  n25qxxx_write_page
  ************************************************************************************/
@@ -1166,6 +1234,7 @@ static int n25qxxx_erase(FAR struct mtd_dev_s *dev, off_t startblock, size_t nbl
   /* Lock access to the SPI bus until we complete the erase */
 
   n25qxxx_lock(priv->qspi);
+  n25qxxx_unmap(priv);
 
   while (blocksleft-- > 0)
     {
@@ -1244,6 +1313,7 @@ static ssize_t n25qxxx_bwrite(FAR struct mtd_dev_s *dev, off_t startblock,
   /* Lock the QuadSPI bus and write all of the pages to FLASH */
 
   n25qxxx_lock(priv->qspi);
+  n25qxxx_unmap(priv);
 
 #if defined(CONFIG_N25QXXX_SECTOR512)
   ret = n25qxxx_write_cache(priv, buffer, startblock, nblocks);
@@ -1281,7 +1351,28 @@ static ssize_t n25qxxx_read(FAR struct mtd_dev_s *dev, off_t offset, size_t nbyt
   /* Lock the QuadSPI bus and select this FLASH part */
 
   n25qxxx_lock(priv->qspi);
-  ret = n25qxxx_read_byte(priv, buffer, offset, nbytes);
+
+#ifdef CONFIG_QSPI_MEMMAP
+  /* Map the FLASH for memory-mapped access if it is not already mapped and
+   * then satisfy the read with a simple memcpy from the read window.
+   */
+
+  if (priv->mbase == NULL)
+    {
+      n25qxxx_memmap(priv);
+    }
+
+  if (priv->mbase != NULL)
+    {
+      memcpy(buffer, priv->mbase + offset, nbytes);
+      ret = OK;
+    }
+  else
+#endif
+    {
+      ret = n25qxxx_read_byte(priv, buffer, offset, nbytes);
+    }
+
   n25qxxx_unlock(priv->qspi);
 
   if (ret < 0)
@@ -1345,6 +1436,7 @@ static int n25qxxx_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg)
           /* Erase the entire device */
 
           n25qxxx_lock(priv->qspi);
+          n25qxxx_unmap(priv);
           ret = n25qxxx_erase_chip(priv);
           n25qxxx_unlock(priv->qspi);
         }
@@ -1356,6 +1448,11 @@ static int n25qxxx_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg)
             (FAR const struct mtd_protect_s *)((uintptr_t)arg);
 
           DEBUGASSERT(prot);
+#ifdef CONFIG_QSPI_MEMMAP
+          n25qxxx_lock(priv->qspi);
+          n25qxxx_unmap(priv);
+          n25qxxx_unlock(priv->qspi);
+#endif
           ret = n25qxxx_protect(priv, prot->startblock, prot->nblocks);
         }
         break;
@@ -1366,6 +1463,11 @@ static int n25qxxx_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg)
             (FAR const struct mtd_protect_s *)((uintptr_t)arg);
 
           DEBUGASSERT(prot);
+#ifdef CONFIG_QSPI_MEMMAP
+          n25qxxx_lock(priv->qspi);
+          n25qxxx_unmap(priv);
+          n25qxxx_unlock(priv->qspi);
+#endif
           ret = n25qxxx_unprotect(priv, prot->startblock, prot->nblocks);
         }
         break;
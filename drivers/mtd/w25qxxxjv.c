@@ -309,6 +309,9 @@ struct w25qxxxjv_dev_s
   FAR uint8_t           *cmdbuf;      /* Allocated command buffer */
   FAR uint8_t           *readbuf;     /* Allocated status read buffer */
 
+#ifdef CONFIG_QSPI_MEMMAP
+  FAR const uint8_t     *mbase;       /* Memory-mapped read window (NULL if unmapped) */
+#endif
 #ifdef CONFIG_W25QXXXJV_SECTOR512
   uint8_t                flags;       /* Buffered sector flags */
   uint16_t               esectno;     /* Erase sector number in the cache */
@@ -356,6 +359,12 @@ static int  w25qxxxjv_read_byte(FAR struct w25qxxxjv_dev_s *priv, FAR uint8_t *b
               off_t address, size_t nbytes);
 static int  w25qxxxjv_write_page(FAR struct w25qxxxjv_dev_s *priv,
               FAR const uint8_t *buffer, off_t address, size_t nbytes);
+#ifdef CONFIG_QSPI_MEMMAP
+static void w25qxxxjv_memmap(FAR struct w25qxxxjv_dev_s *priv);
+static void w25qxxxjv_unmap(FAR struct w25qxxxjv_dev_s *priv);
+#else
+#  define w25qxxxjv_unmap(priv)
+#endif
 #ifdef CONFIG_W25QXXXJV_SECTOR512
 static int  w25qxxxjv_flush_cache(struct w25qxxxjv_dev_s *priv);
 static FAR uint8_t *w25qxxxjv_read_cache(struct w25qxxxjv_dev_s *priv, off_t sector);
@@ -867,6 +876,65 @@ static int w25qxxxjv_read_byte(FAR struct w25qxxxjv_dev_s *priv, FAR uint8_t *bu
   return QSPI_MEMORY(priv->qspi, &meminfo);
 }
 
+/************************************************************************************
+ * Name: w25qxxxjv_memmap
+ *
+ * Description:
+ *   Map the FLASH for memory-mapped read access.  On failure, priv->mbase is left
+ *   NULL and command-based reads will be used instead.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_QSPI_MEMMAP
+static void w25qxxxjv_memmap(FAR struct w25qxxxjv_dev_s *priv)
+{
+  struct qspi_meminfo_s meminfo;
+  FAR const void *mbase;
+  int ret;
+
+  /* Describe the read access that the controller is to perform for accesses
+   * falling in the window.
+   */
+
+  meminfo.flags   = QSPIMEM_READ | QSPIMEM_QUADIO;
+  meminfo.addrlen = 3;
+  meminfo.dummies = CONFIG_W25QXXXJV_DUMMIES;
+  meminfo.buflen  = (uint32_t)priv->nsectors << priv->sectorshift;
+  meminfo.cmd     = W25QXXXJV_FAST_READ_QUADIO;
+  meminfo.addr    = 0;
+  meminfo.buffer  = NULL;
+
+  ret = QSPI_MEMMAP(priv->qspi, &meminfo, &mbase);
+  if (ret < 0)
+    {
+      finfo("QSPI_MEMMAP not supported: %d\n", ret);
+      mbase = NULL;
+    }
+
+  priv->mbase = (FAR const uint8_t *)mbase;
+}
+#endif
+
+/************************************************************************************
+ * Name: w25qxxxjv_unmap
+ *
+ * Description:
+ *   Revert to command mode.  Must be called before any command or memory transfer
+ *   if the FLASH is memory-mapped.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_QSPI_MEMMAP
+static void w25qxxxjv_unmap(FAR struct w25qxxxjv_dev_s *priv)
+{
+  if (priv->mbase != NULL)
+    {
+      QSPI_UNMAP(priv->qspi);
+      priv->mbase = NULL;
+    }
+}
+#endif
+
 /************************************************************************************
  * Name:  w25qxxxjv_write_page
  ************************************************************************************/
@@ -1150,6 +1218,7 @@ static int w25qxxxjv_erase(FAR struct mtd_dev_s *dev, off_t startblock,
   /* Lock access to the SPI bus until we complete the erase */
 
   w25qxxxjv_lock(priv->qspi);
+  w25qxxxjv_unmap(priv);
 
   while (blocksleft-- > 0)
     {
@@ -1228,6 +1297,7 @@ static ssize_t w25qxxxjv_bwrite(FAR struct mtd_dev_s *dev, off_t startblock,
   /* Lock the QuadSPI bus and write all of the pages to FLASH */
 
   w25qxxxjv_lock(priv->qspi);
+  w25qxxxjv_unmap(priv);
 
 #if defined(CONFIG_W25QXXXJV_SECTOR512)
   ret = w25qxxxjv_write_cache(priv, buffer, startblock, nblocks);
@@ -1265,7 +1335,28 @@ static ssize_t w25qxxxjv_read(FAR struct mtd_dev_s *dev, off_t offset, size_t nb
   /* Lock the QuadSPI bus and select this FLASH part */
 
   w25qxxxjv_lock(priv->qspi);
-  ret = w25qxxxjv_read_byte(priv, buffer, offset, nbytes);
+
+#ifdef CONFIG_QSPI_MEMMAP
+  /* Map the FLASH for memory-mapped access if it is not already mapped and
+   * then satisfy the read with a simple memcpy from the read window.
+   */
+
+  if (priv->mbase == NULL)
+    {
+      w25qxxxjv_memmap(priv);
+    }
+
+  if (priv->mbase != NULL)
+    {
+      memcpy(buffer, priv->mbase + offset, nbytes);
+      ret = OK;
+    }
+  else
+#endif
+    {
+      ret = w25qxxxjv_read_byte(priv, buffer, offset, nbytes);
+    }
+
   w25qxxxjv_unlock(priv->qspi);
 
   if (ret < 0)
@@ -1330,6 +1421,7 @@ static int w25qxxxjv_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg
           /* Erase the entire device */
 
           w25qxxxjv_lock(priv->qspi);
+          w25qxxxjv_unmap(priv);
           ret = w25qxxxjv_erase_chip(priv);
           w25qxxxjv_unlock(priv->qspi);
         }
@@ -1341,6 +1433,11 @@ static int w25qxxxjv_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg
             (FAR const struct mtd_protect_s *)((uintptr_t)arg);
 
           DEBUGASSERT(prot);
+#ifdef CONFIG_QSPI_MEMMAP
+          w25qxxxjv_lock(priv->qspi);
+          w25qxxxjv_unmap(priv);
+          w25qxxxjv_unlock(priv->qspi);
+#endif
           ret = w25qxxxjv_protect(priv, prot->startblock, prot->nblocks);
         }
         break;
@@ -1351,6 +1448,11 @@ static int w25qxxxjv_ioctl(FAR struct mtd_dev_s *dev, int cmd, unsigned long arg
             (FAR const struct mtd_protect_s *)((uintptr_t)arg);
 
           DEBUGASSERT(prot);
+#ifdef CONFIG_QSPI_MEMMAP
+          w25qxxxjv_lock(priv->qspi);
+          w25qxxxjv_unmap(priv);
+          w25qxxxjv_unlock(priv->qspi);
+#endif
           ret = w25qxxxjv_unprotect(priv, prot->startblock, prot->nblocks);
         }
         break;
@@ -0,0 +1,336 @@
+/****************************************************************************
+ * drivers/net/ethring.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mm/iob.h>
+#include <nuttx/net/ethring.h>
+
+#ifdef CONFIG_NETDEV_ETHRING
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: eth_ring_cacheget
+ *
+ * Description:
+ *   Take one I/O buffer from the ring cache, falling back to the global
+ *   pool (without waiting) if the cache is empty.
+ *
+ * Assumptions:
+ *   May be called from interrupt level.
+ *
+ ****************************************************************************/
+
+static FAR struct iob_s *eth_ring_cacheget(FAR struct eth_ring_s *ring)
+{
+  FAR struct iob_s *iob;
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  iob   = ring->er_cache;
+  if (iob != NULL)
+    {
+      ring->er_cache = iob->io_flink;
+      ring->er_ncache--;
+      leave_critical_section(flags);
+
+      iob->io_flink = NULL;
+      return iob;
+    }
+
+  leave_critical_section(flags);
+
+  /* The cache is empty.  Try the global pool, but never block:  this path
+   * runs at interrupt level in the RX refill logic.
+   */
+
+  return iob_tryalloc(false, ring->er_user);
+}
+
+/****************************************************************************
+ * Name: eth_ring_cacheput
+ *
+ * Description:
+ *   Return one I/O buffer to the ring cache, or to the global pool if the
+ *   cache is full.
+ *
+ * Assumptions:
+ *   May be called from interrupt level.
+ *
+ ****************************************************************************/
+
+static void eth_ring_cacheput(FAR struct eth_ring_s *ring,
+                              FAR struct iob_s *iob)
+{
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  if (ring->er_ncache < ring->er_maxcache)
+    {
+      iob->io_flink  = ring->er_cache;
+      ring->er_cache = iob;
+      ring->er_ncache++;
+      leave_critical_section(flags);
+      return;
+    }
+
+  leave_critical_section(flags);
+  iob_free(iob, ring->er_user);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: eth_ring_setup
+ *
+ * Description:
+ *   Initialize an IOB descriptor ring with 'ndesc' descriptors.  Up to
+ *   'maxcache' free I/O buffers will be cached in the ring for use by
+ *   eth_ring_replenish() so that the RX refill path normally does not
+ *   touch the global IOB pool.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int eth_ring_setup(FAR struct eth_ring_s *ring, uint16_t ndesc,
+                   uint8_t maxcache, enum iob_user_e user)
+{
+  DEBUGASSERT(ring != NULL && ndesc > 0);
+
+  memset(ring, 0, sizeof(struct eth_ring_s));
+
+  ring->er_bufs = (FAR struct iob_s **)
+    kmm_zalloc(ndesc * sizeof(FAR struct iob_s *));
+  if (ring->er_bufs == NULL)
+    {
+      nerr("ERROR: Failed to allocate descriptor bookkeeping\n");
+      return -ENOMEM;
+    }
+
+  ring->er_ndesc    = ndesc;
+  ring->er_maxcache = maxcache;
+  ring->er_user     = (uint8_t)user;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: eth_ring_teardown
+ *
+ * Description:
+ *   Release all buffers attached to the ring, the buffer cache and the
+ *   ring bookkeeping memory.
+ *
+ ****************************************************************************/
+
+void eth_ring_teardown(FAR struct eth_ring_s *ring)
+{
+  FAR struct iob_s *iob;
+  int i;
+
+  DEBUGASSERT(ring != NULL && ring->er_bufs != NULL);
+
+  /* Free any buffers still attached to descriptors */
+
+  for (i = 0; i < ring->er_ndesc; i++)
+    {
+      if (ring->er_bufs[i] != NULL)
+        {
+          iob_free_chain(ring->er_bufs[i], ring->er_user);
+          ring->er_bufs[i] = NULL;
+        }
+    }
+
+  /* Drain the buffer cache */
+
+  while ((iob = ring->er_cache) != NULL)
+    {
+      ring->er_cache = iob->io_flink;
+      iob->io_flink  = NULL;
+      iob_free(iob, ring->er_user);
+    }
+
+  ring->er_ncache = 0;
+
+  kmm_free(ring->er_bufs);
+  ring->er_bufs  = NULL;
+  ring->er_ndesc = 0;
+}
+
+/****************************************************************************
+ * Name: eth_ring_replenish
+ *
+ * Description:
+ *   Attach a fresh I/O buffer to the descriptor at 'index' and return the
+ *   address that the hardware should DMA into.  The buffer comes from the
+ *   ring cache when possible and from the global pool otherwise.
+ *
+ * Returned Value:
+ *   The buffer address on success; NULL if no buffer is available (the
+ *   descriptor is then left empty and should not be given to hardware).
+ *
+ * Assumptions:
+ *   May be called from interrupt level.
+ *
+ ****************************************************************************/
+
+FAR uint8_t *eth_ring_replenish(FAR struct eth_ring_s *ring, uint16_t index)
+{
+  FAR struct iob_s *iob;
+
+  DEBUGASSERT(ring != NULL && index < ring->er_ndesc &&
+              ring->er_bufs[index] == NULL);
+
+  iob = eth_ring_cacheget(ring);
+  if (iob == NULL)
+    {
+      nwarn("WARNING: No free I/O buffer for descriptor %u\n", index);
+      return NULL;
+    }
+
+  /* DMA receptions land at the very beginning of the buffer */
+
+  iob->io_offset = 0;
+  iob->io_len    = 0;
+  iob->io_pktlen = 0;
+
+  ring->er_bufs[index] = iob;
+  return iob->io_data;
+}
+
+/****************************************************************************
+ * Name: eth_ring_harvest
+ *
+ * Description:
+ *   Detach the completed I/O buffer from the RX descriptor at 'index',
+ *   recording that 'len' bytes were received into it.  The caller owns
+ *   the returned buffer and will normally hand it to the network stack,
+ *   then replenish the descriptor.
+ *
+ * Returned Value:
+ *   The received I/O buffer, or NULL if the descriptor was empty.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *eth_ring_harvest(FAR struct eth_ring_s *ring,
+                                   uint16_t index, uint16_t len)
+{
+  FAR struct iob_s *iob;
+
+  DEBUGASSERT(ring != NULL && index < ring->er_ndesc &&
+              len <= CONFIG_IOB_BUFSIZE);
+
+  iob = ring->er_bufs[index];
+  if (iob != NULL)
+    {
+      ring->er_bufs[index] = NULL;
+
+      iob->io_len    = len;
+      iob->io_pktlen = len;
+    }
+
+  return iob;
+}
+
+/****************************************************************************
+ * Name: eth_ring_attach
+ *
+ * Description:
+ *   Attach the outgoing I/O buffer 'iob' to the TX descriptor at 'index'.
+ *   The ring takes ownership of the buffer until the matching
+ *   eth_ring_reclaim() at TX completion.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EBUSY if the descriptor still holds a buffer.
+ *
+ ****************************************************************************/
+
+int eth_ring_attach(FAR struct eth_ring_s *ring, uint16_t index,
+                    FAR struct iob_s *iob)
+{
+  DEBUGASSERT(ring != NULL && index < ring->er_ndesc && iob != NULL);
+
+  if (ring->er_bufs[index] != NULL)
+    {
+      return -EBUSY;
+    }
+
+  ring->er_bufs[index] = iob;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: eth_ring_reclaim
+ *
+ * Description:
+ *   Called at TX completion to release the buffer attached to the
+ *   descriptor at 'index'.  The buffer is returned to the ring cache when
+ *   there is room (where the RX replenish logic will pick it up) and to
+ *   the global pool otherwise.
+ *
+ * Assumptions:
+ *   May be called from interrupt level.
+ *
+ ****************************************************************************/
+
+void eth_ring_reclaim(FAR struct eth_ring_s *ring, uint16_t index)
+{
+  FAR struct iob_s *iob;
+
+  DEBUGASSERT(ring != NULL && index < ring->er_ndesc);
+
+  iob = ring->er_bufs[index];
+  if (iob != NULL)
+    {
+      ring->er_bufs[index] = NULL;
+
+      /* Only single buffers are cached; multi-buffer (scatter/gather)
+       * frames go back to the global pool as a chain.
+       */
+
+      if (iob->io_flink == NULL)
+        {
+          eth_ring_cacheput(ring, iob);
+        }
+      else
+        {
+          iob_free_chain(iob, ring->er_user);
+        }
+    }
+}
+
+#endif /* CONFIG_NETDEV_ETHRING */
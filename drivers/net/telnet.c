@@ -26,15 +26,18 @@
 
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 #include <fcntl.h>
 #include <poll.h>
 #include <errno.h>
 #include <debug.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
 #include <nuttx/kthread.h>
 #include <nuttx/signal.h>
 #include <nuttx/semaphore.h>
+#include <nuttx/wqueue.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/telnet.h>
@@ -55,6 +58,20 @@
 #  define CONFIG_TELNET_TXBUFFER_SIZE 256
 #endif
 
+#ifndef CONFIG_TELNET_TXFLUSH_DELAY
+#  define CONFIG_TELNET_TXFLUSH_DELAY 0
+#endif
+
+/* TX output coalescing requires the low priority work queue for the
+ * delayed flush.
+ */
+
+#undef TELNET_HAVE_TXFLUSH
+#if defined(CONFIG_SCHED_LPWORK) && CONFIG_TELNET_TXFLUSH_DELAY > 0
+#  define TELNET_HAVE_TXFLUSH 1
+#  define TELNET_TXFLUSH_TICKS MSEC2TICK(CONFIG_TELNET_TXFLUSH_DELAY)
+#endif
+
 #ifndef CONFIG_TELNET_MAXLCLIENTS
 #  define CONFIG_TELNET_MAXLCLIENTS 8
 #endif
@@ -134,6 +151,10 @@ struct telnet_dev_s
 #endif
 #ifdef HAVE_SIGNALS
   pid_t             td_pid;
+#endif
+#ifdef TELNET_HAVE_TXFLUSH
+  uint16_t          td_txhead;    /* Number of coalesced bytes in the txbuffer */
+  struct work_s     td_txwork;    /* Supports the delayed TX flush */
 #endif
   struct pollfd     td_fds;
   FAR struct socket td_psock;     /* A clone of the internal socket structure */
@@ -160,6 +181,10 @@ static ssize_t telnet_receive(FAR struct telnet_dev_s *priv,
                  size_t destlen);
 static bool    telnet_putchar(FAR struct telnet_dev_s *priv, uint8_t ch,
                  int *nwritten);
+#ifdef TELNET_HAVE_TXFLUSH
+static void    telnet_txflush(FAR struct telnet_dev_s *priv);
+static void    telnet_txflush_work(FAR void *arg);
+#endif
 static void    telnet_sendopt(FAR struct telnet_dev_s *priv, uint8_t option,
                  uint8_t value);
 static int     telnet_io_main(int argc, FAR char** argv);
@@ -476,7 +501,36 @@ static ssize_t telnet_receive(FAR struct telnet_dev_s *priv,
               }
             else
               {
+                size_t spanlen;
+
                 telnet_getchar(priv, ch, dest, &nread);
+
+                /* Consume any following span of ordinary characters in a
+                 * single copy rather than one state machine iteration per
+                 * character.  The span ends at the next IAC (or carriage
+                 * return, unless in character mode), the end of the source
+                 * data, or the end of the user's buffer.
+                 */
+
+                spanlen = 0;
+                while (spanlen < srclen - 1 &&
+                       nread + spanlen < destlen &&
+                       src[spanlen] != TELNET_IAC
+#ifndef CONFIG_TELNET_CHARACTER_MODE
+                       && src[spanlen] != TELNET_CR
+#endif
+                      )
+                  {
+                    spanlen++;
+                  }
+
+                if (spanlen > 0)
+                  {
+                    memcpy(&dest[nread], src, spanlen);
+                    nread  += spanlen;
+                    src    += spanlen;
+                    srclen -= spanlen;
+                  }
               }
             break;
 
@@ -602,6 +656,59 @@ static bool telnet_putchar(FAR struct telnet_dev_s *priv, uint8_t ch,
   return ret;
 }
 
+/****************************************************************************
+ * Name: telnet_txflush
+ *
+ * Description:
+ *   Send any output coalesced in the TX buffer to the peer.
+ *
+ * Assumptions:
+ *   The caller holds td_exclsem.
+ *
+ ****************************************************************************/
+
+#ifdef TELNET_HAVE_TXFLUSH
+static void telnet_txflush(FAR struct telnet_dev_s *priv)
+{
+  ssize_t ret;
+
+  if (priv->td_txhead > 0)
+    {
+      ret = psock_send(&priv->td_psock, priv->td_txbuffer,
+                       priv->td_txhead, 0);
+      if (ret < 0)
+        {
+          nerr("ERROR: psock_send failed: %zd\n", ret);
+        }
+
+      priv->td_txhead = 0;
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: telnet_txflush_work
+ *
+ * Description:
+ *   Delayed TX flush timeout.  Runs on the low priority work queue.
+ *
+ ****************************************************************************/
+
+#ifdef TELNET_HAVE_TXFLUSH
+static void telnet_txflush_work(FAR void *arg)
+{
+  FAR struct telnet_dev_s *priv = (FAR struct telnet_dev_s *)arg;
+  int ret;
+
+  ret = nxsem_wait_uninterruptible(&priv->td_exclsem);
+  if (ret >= 0)
+    {
+      telnet_txflush(priv);
+      nxsem_post(&priv->td_exclsem);
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: telnet_sendopt
  *
@@ -776,6 +883,15 @@ static int telnet_close(FAR struct file *filep)
 
       nxsem_post(&g_iosem);
 
+#ifdef TELNET_HAVE_TXFLUSH
+      /* Cancel any pending delayed flush and send any remaining coalesced
+       * output before closing the socket.
+       */
+
+      work_cancel(LPWORK, &priv->td_txwork);
+      telnet_txflush(priv);
+#endif
+
       /* Close the socket */
 
       psock_close(&priv->td_psock);
@@ -894,6 +1010,65 @@ static ssize_t telnet_write(FAR struct file *filep, FAR const char *buffer,
 
   ninfo("len: %zd\n", len);
 
+#ifdef TELNET_HAVE_TXFLUSH
+  /* Get exclusive access to the TX buffer.  With output coalescing the TX
+   * buffer state persists across write() calls and is shared with the
+   * delayed flush worker.
+   */
+
+  ret = nxsem_wait(&priv->td_exclsem);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  /* Process each character from the user buffer, appending to any output
+   * already coalesced in the TX buffer.
+   */
+
+  ncopied = priv->td_txhead;
+  for (nsent = 0; nsent < len; nsent++)
+    {
+      /* Get the next character from the user buffer */
+
+      ch = *src++;
+
+      /* Add the character to the TX buffer */
+
+      eol = telnet_putchar(priv, ch, &ncopied);
+      UNUSED(eol);
+
+      /* Is the buffer too full to hold the next largest character
+       * sequence ("\r\n")?  Unlike the non-coalescing logic below, end of
+       * line does NOT force a flush; short lines accumulate until the
+       * buffer fills or the flush delay expires.
+       */
+
+      if (ncopied > CONFIG_TELNET_TXBUFFER_SIZE - 2)
+        {
+          /* Yes... send the data now */
+
+          priv->td_txhead = ncopied;
+          telnet_txflush(priv);
+          ncopied = 0;
+        }
+    }
+
+  /* Leave any remaining output in the TX buffer and schedule a delayed
+   * flush (if one is not already pending) so that the data is not held
+   * indefinitely waiting for more output.
+   */
+
+  priv->td_txhead = ncopied;
+  if (ncopied > 0 && work_available(&priv->td_txwork))
+    {
+      work_queue(LPWORK, &priv->td_txwork, telnet_txflush_work, priv,
+                 TELNET_TXFLUSH_TICKS);
+    }
+
+  nxsem_post(&priv->td_exclsem);
+
+#else
   /* Process each character from the user buffer */
 
   for (nsent = 0, ncopied = 0; nsent < len; nsent++)
@@ -940,6 +1115,7 @@ static ssize_t telnet_write(FAR struct file *filep, FAR const char *buffer,
           return ret;
         }
     }
+#endif /* TELNET_HAVE_TXFLUSH */
 
   /* Notice that we don't actually return the number of bytes sent, but
    * rather, the number of bytes that the caller asked us to send.  We may
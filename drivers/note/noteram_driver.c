@@ -41,17 +41,34 @@
 
 #include <sys/types.h>
 #include <sched.h>
+#include <stddef.h>
 #include <fcntl.h>
 #include <assert.h>
 #include <errno.h>
 #include <string.h>
 
+#include <nuttx/arch.h>
 #include <nuttx/spinlock.h>
 #include <nuttx/sched.h>
 #include <nuttx/sched_note.h>
 #include <nuttx/note/noteram_driver.h>
 #include <nuttx/fs/fs.h>
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* With per-CPU buffering, each CPU appends notes to its own circular
+ * buffer without taking any global lock; the buffers are merged in
+ * timestamp order when they are read.
+ */
+
+#ifdef CONFIG_DRIVER_NOTERAM_PERCPU
+#  define NOTERAM_NBUFFERS CONFIG_SMP_NCPUS
+#else
+#  define NOTERAM_NBUFFERS 1
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -61,7 +78,6 @@ struct noteram_info_s
   volatile unsigned int ni_head;
   volatile unsigned int ni_tail;
   volatile unsigned int ni_read;
-  unsigned int ni_overwrite;
   uint8_t ni_buffer[CONFIG_DRIVER_NOTERAM_BUFSIZE];
 };
 
@@ -107,14 +123,18 @@ static const struct file_operations g_noteram_fops =
 #endif
 };
 
-static struct noteram_info_s g_noteram_info =
-{
+static struct noteram_info_s g_noteram_info[NOTERAM_NBUFFERS];
+
+/* The overwrite mode is a driver-level policy that applies to all of the
+ * circular buffers.
+ */
+
+static unsigned int g_noteram_overwrite =
 #ifdef CONFIG_DRIVER_NOTERAM_DEFAULT_NOOVERWRITE
-  .ni_overwrite = NOTERAM_MODE_OVERWRITE_DISABLE
+  NOTERAM_MODE_OVERWRITE_DISABLE;
 #else
-  .ni_overwrite = NOTERAM_MODE_OVERWRITE_ENABLE
+  NOTERAM_MODE_OVERWRITE_ENABLE;
 #endif
-};
 
 #if CONFIG_DRIVER_NOTERAM_TASKNAME_BUFSIZE > 0
 static struct noteram_taskname_s g_noteram_taskname;
@@ -124,6 +144,19 @@ static struct noteram_taskname_s g_noteram_taskname;
 static volatile spinlock_t g_noteram_lock;
 #endif
 
+/* With per-CPU buffering the global lock is needed only to serialize
+ * updates to the shared task name buffer; each CPU owns its note buffer
+ * outright.
+ */
+
+#if defined(CONFIG_SMP) && !defined(CONFIG_DRIVER_NOTERAM_PERCPU)
+#  define noteram_lock()   spin_lock_wo_note(&g_noteram_lock)
+#  define noteram_unlock() spin_unlock_wo_note(&g_noteram_lock)
+#else
+#  define noteram_lock()
+#  define noteram_unlock()
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -309,15 +342,19 @@ static const char *noteram_get_taskname(pid_t pid)
 static void noteram_buffer_clear(void)
 {
   irqstate_t flags;
+  int i;
 
   flags = enter_critical_section();
 
-  g_noteram_info.ni_tail = g_noteram_info.ni_head;
-  g_noteram_info.ni_read = g_noteram_info.ni_head;
+  for (i = 0; i < NOTERAM_NBUFFERS; i++)
+    {
+      g_noteram_info[i].ni_tail = g_noteram_info[i].ni_head;
+      g_noteram_info[i].ni_read = g_noteram_info[i].ni_head;
+    }
 
-  if (g_noteram_info.ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
+  if (g_noteram_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
     {
-      g_noteram_info.ni_overwrite = NOTERAM_MODE_OVERWRITE_DISABLE;
+      g_noteram_overwrite = NOTERAM_MODE_OVERWRITE_DISABLE;
     }
 
 #if CONFIG_DRIVER_NOTERAM_TASKNAME_BUFSIZE > 0
@@ -369,10 +406,10 @@ static inline unsigned int noteram_next(unsigned int ndx,
  ****************************************************************************/
 
 #ifdef CONFIG_DEBUG_ASSERTIONS
-static unsigned int noteram_length(void)
+static unsigned int noteram_length(FAR struct noteram_info_s *info)
 {
-  unsigned int head = g_noteram_info.ni_head;
-  unsigned int tail = g_noteram_info.ni_tail;
+  unsigned int head = info->ni_head;
+  unsigned int tail = info->ni_tail;
 
   if (tail > head)
     {
@@ -397,10 +434,10 @@ static unsigned int noteram_length(void)
  *
  ****************************************************************************/
 
-static unsigned int noteram_unread_length(void)
+static unsigned int noteram_unread_length(FAR struct noteram_info_s *info)
 {
-  unsigned int head = g_noteram_info.ni_head;
-  unsigned int read = g_noteram_info.ni_read;
+  unsigned int head = info->ni_head;
+  unsigned int read = info->ni_read;
 
   if (read > head)
     {
@@ -427,7 +464,7 @@ static unsigned int noteram_unread_length(void)
  *
  ****************************************************************************/
 
-static void noteram_remove(void)
+static void noteram_remove(FAR struct noteram_info_s *info)
 {
   FAR struct note_common_s *note;
   unsigned int tail;
@@ -435,14 +472,14 @@ static void noteram_remove(void)
 
   /* Get the tail index of the circular buffer */
 
-  tail = g_noteram_info.ni_tail;
+  tail = info->ni_tail;
   DEBUGASSERT(tail < CONFIG_DRIVER_NOTERAM_BUFSIZE);
 
   /* Get the length of the note at the tail index */
 
-  note   = (FAR struct note_common_s *)&g_noteram_info.ni_buffer[tail];
+  note   = (FAR struct note_common_s *)&info->ni_buffer[tail];
   length = note->nc_length;
-  DEBUGASSERT(length <= noteram_length());
+  DEBUGASSERT(length <= noteram_length(info));
 
 #if CONFIG_DRIVER_NOTERAM_TASKNAME_BUFSIZE > 0
   if (note->nc_type == NOTE_STOP)
@@ -459,15 +496,94 @@ static void noteram_remove(void)
    * buffer.
    */
 
-  if (g_noteram_info.ni_read == g_noteram_info.ni_tail)
+  if (info->ni_read == info->ni_tail)
     {
       /* The read index also needs increment. */
 
-      g_noteram_info.ni_read = noteram_next(tail, length);
+      info->ni_read = noteram_next(tail, length);
+    }
+
+  info->ni_tail = noteram_next(tail, length);
+}
+
+/****************************************************************************
+ * Name: noteram_select
+ *
+ * Description:
+ *   Return the circular buffer whose next unread note is the oldest, or
+ *   NULL if all of the circular buffers are empty.  With per-CPU buffering
+ *   this merges the per-CPU streams back into timestamp order as they are
+ *   read.
+ *
+ * Input Parameters:
+ *   None.
+ *
+ * Returned Value:
+ *   The circular buffer to read from next, or NULL.
+ *
+ * Assumptions:
+ *   We are within a critical section.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DRIVER_NOTERAM_PERCPU
+static FAR struct noteram_info_s *noteram_select(void)
+{
+  FAR struct noteram_info_s *selected = NULL;
+  uint32_t selected_time = 0;
+  int i;
+
+  for (i = 0; i < NOTERAM_NBUFFERS; i++)
+    {
+      FAR struct noteram_info_s *info = &g_noteram_info[i];
+      unsigned int read = info->ni_read;
+      uint32_t time;
+      int j;
+
+      if (noteram_unread_length(info) == 0)
+        {
+          continue;
+        }
+
+      /* Reconstruct the note timestamp byte-by-byte since the note may
+       * wrap around the end of the circular buffer.  In the high
+       * resolution case the seconds count alone provides sufficient
+       * ordering fidelity for the merge.
+       */
+
+      time = 0;
+      for (j = 0; j < 4; j++)
+        {
+#ifdef CONFIG_SCHED_INSTRUMENTATION_HIRES
+          unsigned int off = offsetof(struct note_common_s,
+                                      nc_systime_sec) + j;
+#else
+          unsigned int off = offsetof(struct note_common_s,
+                                      nc_systime) + j;
+#endif
+          time |= (uint32_t)info->ni_buffer[noteram_next(read, off)] <<
+                  (8 * j);
+        }
+
+      /* The comparison is performed on the difference so that it remains
+       * correct when the timestamp wraps around.
+       */
+
+      if (selected == NULL || (int32_t)(time - selected_time) < 0)
+        {
+          selected      = info;
+          selected_time = time;
+        }
     }
 
-  g_noteram_info.ni_tail = noteram_next(tail, length);
+  return selected;
+}
+#else
+static inline FAR struct noteram_info_s *noteram_select(void)
+{
+  return &g_noteram_info[0];
 }
+#endif
 
 /****************************************************************************
  * Name: noteram_get
@@ -488,20 +604,20 @@ static void noteram_remove(void)
 
 static ssize_t noteram_get(FAR uint8_t *buffer, size_t buflen)
 {
+  FAR struct noteram_info_s *info;
   FAR struct note_common_s *note;
   irqstate_t flags;
   unsigned int remaining;
   unsigned int read;
   ssize_t notelen;
-  size_t circlen;
 
   DEBUGASSERT(buffer != NULL);
   flags = enter_critical_section();
 
-  /* Verify that the circular buffer is not empty */
+  /* Select the circular buffer holding the oldest unread note */
 
-  circlen = noteram_unread_length();
-  if (circlen <= 0)
+  info = noteram_select();
+  if (info == NULL || noteram_unread_length(info) <= 0)
     {
       notelen = 0;
       goto errout_with_csection;
@@ -509,14 +625,14 @@ static ssize_t noteram_get(FAR uint8_t *buffer, size_t buflen)
 
   /* Get the read index of the circular buffer */
 
-  read    = g_noteram_info.ni_read;
+  read    = info->ni_read;
   DEBUGASSERT(read < CONFIG_DRIVER_NOTERAM_BUFSIZE);
 
   /* Get the length of the note at the read index */
 
-  note    = (FAR struct note_common_s *)&g_noteram_info.ni_buffer[read];
+  note    = (FAR struct note_common_s *)&info->ni_buffer[read];
   notelen = note->nc_length;
-  DEBUGASSERT(notelen <= circlen);
+  DEBUGASSERT(notelen <= noteram_unread_length(info));
 
   /* Is the user buffer large enough to hold the note? */
 
@@ -524,7 +640,7 @@ static ssize_t noteram_get(FAR uint8_t *buffer, size_t buflen)
     {
       /* Skip the large note so that we do not get constipated. */
 
-      g_noteram_info.ni_read = noteram_next(read, notelen);
+      info->ni_read = noteram_next(read, notelen);
 
       /* and return an error */
 
@@ -539,7 +655,7 @@ static ssize_t noteram_get(FAR uint8_t *buffer, size_t buflen)
     {
       /* Copy the next byte at the read index */
 
-      *buffer++ = g_noteram_info.ni_buffer[read];
+      *buffer++ = info->ni_buffer[read];
 
       /* Adjust indices and counts */
 
@@ -547,7 +663,7 @@ static ssize_t noteram_get(FAR uint8_t *buffer, size_t buflen)
       remaining--;
     }
 
-  g_noteram_info.ni_read = read;
+  info->ni_read = read;
 
 errout_with_csection:
   leave_critical_section(flags);
@@ -572,18 +688,18 @@ errout_with_csection:
 
 static ssize_t noteram_size(void)
 {
+  FAR struct noteram_info_s *info;
   FAR struct note_common_s *note;
   irqstate_t flags;
   unsigned int read;
   ssize_t notelen;
-  size_t circlen;
 
   flags = enter_critical_section();
 
-  /* Verify that the circular buffer is not empty */
+  /* Select the circular buffer holding the oldest unread note */
 
-  circlen = noteram_unread_length();
-  if (circlen <= 0)
+  info = noteram_select();
+  if (info == NULL || noteram_unread_length(info) <= 0)
     {
       notelen = 0;
       goto errout_with_csection;
@@ -591,14 +707,14 @@ static ssize_t noteram_size(void)
 
   /* Get the read index of the circular buffer */
 
-  read = g_noteram_info.ni_read;
+  read = info->ni_read;
   DEBUGASSERT(read < CONFIG_DRIVER_NOTERAM_BUFSIZE);
 
   /* Get the length of the note at the read index */
 
-  note    = (FAR struct note_common_s *)&g_noteram_info.ni_buffer[read];
+  note    = (FAR struct note_common_s *)&info->ni_buffer[read];
   notelen = note->nc_length;
-  DEBUGASSERT(notelen <= circlen);
+  DEBUGASSERT(notelen <= noteram_unread_length(info));
 
 errout_with_csection:
   leave_critical_section(flags);
@@ -611,9 +727,14 @@ errout_with_csection:
 
 static int noteram_open(FAR struct file *filep)
 {
-  /* Reset the read index of the circular buffer */
+  int i;
 
-  g_noteram_info.ni_read = g_noteram_info.ni_tail;
+  /* Reset the read index of the circular buffers */
+
+  for (i = 0; i < NOTERAM_NBUFFERS; i++)
+    {
+      g_noteram_info[i].ni_read = g_noteram_info[i].ni_tail;
+    }
 
   return OK;
 }
@@ -712,7 +833,7 @@ static int noteram_ioctl(struct file *filep, int cmd, unsigned long arg)
           }
         else
           {
-            *(unsigned int *)arg = g_noteram_info.ni_overwrite;
+            *(unsigned int *)arg = g_noteram_overwrite;
             ret = OK;
           }
         break;
@@ -729,7 +850,7 @@ static int noteram_ioctl(struct file *filep, int cmd, unsigned long arg)
           }
         else
           {
-            g_noteram_info.ni_overwrite = *(unsigned int *)arg;
+            g_noteram_overwrite = *(unsigned int *)arg;
             ret = OK;
           }
         break;
@@ -801,21 +922,29 @@ static int noteram_ioctl(struct file *filep, int cmd, unsigned long arg)
 
 void sched_note_add(FAR const void *note, size_t notelen)
 {
+  FAR struct noteram_info_s *info;
   FAR const char *buf = note;
   unsigned int head;
   unsigned int next;
   irqstate_t flags;
 
+  /* Interrupts must be disabled so that same-CPU interrupt handlers
+   * cannot add notes concurrently.  With per-CPU buffering, each CPU
+   * appends to its own circular buffer and no cross-CPU lock is needed.
+   */
+
   flags = up_irq_save();
-#ifdef CONFIG_SMP
-  spin_lock_wo_note(&g_noteram_lock);
+  noteram_lock();
+
+#ifdef CONFIG_DRIVER_NOTERAM_PERCPU
+  info = &g_noteram_info[up_cpu_index()];
+#else
+  info = &g_noteram_info[0];
 #endif
 
-  if (g_noteram_info.ni_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
+  if (g_noteram_overwrite == NOTERAM_MODE_OVERWRITE_OVERFLOW)
     {
-#ifdef CONFIG_SMP
-      spin_unlock_wo_note(&g_noteram_lock);
-#endif
+      noteram_unlock();
       up_irq_restore(flags);
       return;
     }
@@ -829,9 +958,17 @@ void sched_note_add(FAR const void *note, size_t notelen)
       note_st = (FAR struct note_start_s *)note;
       if (note_st->nst_cmn.nc_type == NOTE_START)
         {
+#if defined(CONFIG_SMP) && defined(CONFIG_DRIVER_NOTERAM_PERCPU)
+          /* The task name buffer is shared by all CPUs */
+
+          spin_lock_wo_note(&g_noteram_lock);
+#endif
           noteram_record_taskname(note_st->nst_cmn.nc_pid[0] +
                                   (note_st->nst_cmn.nc_pid[1] << 8),
                                   note_st->nst_name);
+#if defined(CONFIG_SMP) && defined(CONFIG_DRIVER_NOTERAM_PERCPU)
+          spin_unlock_wo_note(&g_noteram_lock);
+#endif
         }
     }
 #endif
@@ -839,7 +976,7 @@ void sched_note_add(FAR const void *note, size_t notelen)
   /* Get the index to the head of the circular buffer */
 
   DEBUGASSERT(note != NULL && notelen < CONFIG_DRIVER_NOTERAM_BUFSIZE);
-  head = g_noteram_info.ni_head;
+  head = info->ni_head;
 
   /* Loop until all bytes have been transferred to the circular buffer */
 
@@ -850,39 +987,35 @@ void sched_note_add(FAR const void *note, size_t notelen)
        */
 
       next = noteram_next(head, 1);
-      if (next == g_noteram_info.ni_tail)
+      if (next == info->ni_tail)
         {
-          if (g_noteram_info.ni_overwrite == NOTERAM_MODE_OVERWRITE_DISABLE)
+          if (g_noteram_overwrite == NOTERAM_MODE_OVERWRITE_DISABLE)
             {
               /* Stop recording if not in overwrite mode */
 
-              g_noteram_info.ni_overwrite = NOTERAM_MODE_OVERWRITE_OVERFLOW;
+              g_noteram_overwrite = NOTERAM_MODE_OVERWRITE_OVERFLOW;
 
-#ifdef CONFIG_SMP
-              spin_unlock_wo_note(&g_noteram_lock);
-#endif
+              noteram_unlock();
               up_irq_restore(flags);
               return;
             }
 
           /* Yes, then remove the note at the tail index */
 
-          noteram_remove();
+          noteram_remove(info);
         }
 
       /* Save the next byte at the head index */
 
-      g_noteram_info.ni_buffer[head] = *buf++;
+      info->ni_buffer[head] = *buf++;
 
       head = next;
       notelen--;
     }
 
-  g_noteram_info.ni_head = head;
+  info->ni_head = head;
 
-#ifdef CONFIG_SMP
-  spin_unlock_wo_note(&g_noteram_lock);
-#endif
+  noteram_unlock();
   up_irq_restore(flags);
 }
 
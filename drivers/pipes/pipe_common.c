@@ -399,6 +399,7 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
   FAR uint8_t           *start  = (FAR uint8_t *)buffer;
 #endif
   ssize_t                nread  = 0;
+  pipe_ndx_t             nfree;
   int                    sval;
   int                    ret;
 
@@ -459,24 +460,62 @@ ssize_t pipecommon_read(FAR struct file *filep, FAR char *buffer, size_t len)
     }
 
   /* Then return whatever is available in the pipe (which is at least one
-   * byte).
+   * byte).  The data is copied in at most two contiguous segments:  From
+   * the read index to the end of the circular buffer, then from the
+   * beginning of the buffer.
    */
 
   nread = 0;
   while ((size_t)nread < len && dev->d_wrndx != dev->d_rdndx)
     {
-      *buffer++ = dev->d_buffer[dev->d_rdndx];
-      if (++dev->d_rdndx >= dev->d_bufsize)
+      size_t navail;
+      size_t ncopy;
+
+      /* Get the size of the contiguous segment at the read index */
+
+      if (dev->d_wrndx > dev->d_rdndx)
         {
-          dev->d_rdndx = 0;
+          navail = dev->d_wrndx - dev->d_rdndx;
+        }
+      else
+        {
+          navail = dev->d_bufsize - dev->d_rdndx;
+        }
+
+      ncopy = len - (size_t)nread;
+      if (ncopy > navail)
+        {
+          ncopy = navail;
         }
 
-      nread++;
+      memcpy(buffer, &dev->d_buffer[dev->d_rdndx], ncopy);
+      buffer += ncopy;
+      nread  += ncopy;
+
+      dev->d_rdndx += ncopy;
+      if (dev->d_rdndx >= dev->d_bufsize)
+        {
+          dev->d_rdndx = 0;
+        }
     }
 
-  /* Notify all poll/select waiters that they can write to the FIFO */
+  /* Notify all poll/select waiters that they can write to the FIFO, but
+   * only when the free space exceeds the POLLOUT threshold.
+   */
+
+  if (dev->d_wrndx < dev->d_rdndx)
+    {
+      nfree = dev->d_rdndx - dev->d_wrndx - 1;
+    }
+  else
+    {
+      nfree = dev->d_bufsize + dev->d_rdndx - dev->d_wrndx - 1;
+    }
 
-  pipecommon_pollnotify(dev, POLLOUT);
+  if (nfree > dev->d_polloutthrd)
+    {
+      pipecommon_pollnotify(dev, POLLOUT);
+    }
 
   /* Notify all waiting writers that bytes have been removed from the
    * buffer.
@@ -503,7 +542,7 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer,
   FAR struct pipe_dev_s *dev      = inode->i_private;
   ssize_t                nwritten = 0;
   ssize_t                last;
-  int                    nxtwrndx;
+  pipe_ndx_t             navail;
   int                    sval;
   int                    ret;
 
@@ -560,33 +599,72 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer,
   last = 0;
   for (; ; )
     {
-      /* Calculate the write index AFTER the next byte is written */
+      size_t nfree;
+      size_t ncopy;
+
+      /* Calculate the number of bytes that can be copied to the
+       * contiguous segment at the write index.  One byte is always kept
+       * unused so that a full buffer can be distinguished from an empty
+       * one by comparing the indices.
+       */
 
-      nxtwrndx = dev->d_wrndx + 1;
-      if (nxtwrndx >= dev->d_bufsize)
+      if (dev->d_wrndx < dev->d_rdndx)
         {
-          nxtwrndx = 0;
+          nfree = dev->d_rdndx - dev->d_wrndx - 1;
+        }
+      else
+        {
+          nfree = dev->d_bufsize - dev->d_wrndx;
+          if (dev->d_rdndx == 0)
+            {
+              nfree--;
+            }
         }
 
-      /* Would the next write overflow the circular buffer? */
+      /* Is there room in the circular buffer? */
 
-      if (nxtwrndx != dev->d_rdndx)
+      if (nfree > 0)
         {
-          /* No... copy the byte */
+          /* Yes.. copy as much contiguous data as will fit */
+
+          ncopy = len - (size_t)nwritten;
+          if (ncopy > nfree)
+            {
+              ncopy = nfree;
+            }
 
-          dev->d_buffer[dev->d_wrndx] = *buffer++;
-          dev->d_wrndx = nxtwrndx;
+          memcpy(&dev->d_buffer[dev->d_wrndx], buffer, ncopy);
+          buffer   += ncopy;
+          nwritten += ncopy;
+
+          dev->d_wrndx += ncopy;
+          if (dev->d_wrndx >= dev->d_bufsize)
+            {
+              dev->d_wrndx = 0;
+            }
 
           /* Is the write complete? */
 
-          nwritten++;
           if ((size_t)nwritten >= len)
             {
               /* Notify all poll/select waiters that they can read from the
-               * FIFO.
+               * FIFO, but only when the buffered data exceeds the POLLIN
+               * threshold.
                */
 
-              pipecommon_pollnotify(dev, POLLIN);
+              if (dev->d_wrndx >= dev->d_rdndx)
+                {
+                  navail = dev->d_wrndx - dev->d_rdndx;
+                }
+              else
+                {
+                  navail = dev->d_bufsize + dev->d_wrndx - dev->d_rdndx;
+                }
+
+              if (navail > dev->d_pollinthrd)
+                {
+                  pipecommon_pollnotify(dev, POLLIN);
+                }
 
               /* Yes.. Notify all of the waiting readers that more data is
                * available.
@@ -605,9 +683,7 @@ ssize_t pipecommon_write(FAR struct file *filep, FAR const char *buffer,
         }
       else
         {
-          /* There is not enough room for the next byte.  Was anything
-           * written in this pass?
-           */
+          /* The buffer is full.  Was anything written in this pass? */
 
           if (last < nwritten)
             {
@@ -734,14 +810,15 @@ int pipecommon_poll(FAR struct file *filep, FAR struct pollfd *fds,
        */
 
       eventset = 0;
-      if ((filep->f_oflags & O_WROK) && (nbytes < (dev->d_bufsize - 1)))
+      if ((filep->f_oflags & O_WROK) &&
+          (nbytes < (dev->d_bufsize - 1 - dev->d_polloutthrd)))
         {
           eventset |= POLLOUT;
         }
 
       /* Notify the POLLIN event if the pipe is not empty */
 
-      if ((filep->f_oflags & O_RDOK) && (nbytes > 0))
+      if ((filep->f_oflags & O_RDOK) && (nbytes > dev->d_pollinthrd))
         {
           eventset |= POLLIN;
         }
@@ -834,6 +911,34 @@ int pipecommon_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
         }
         break;
 
+      case PIPEIOC_POLLINTHRD:
+        {
+          if (arg >= dev->d_bufsize)
+            {
+              ret = -EINVAL;
+            }
+          else
+            {
+              dev->d_pollinthrd = (pipe_ndx_t)arg;
+              ret = OK;
+            }
+        }
+        break;
+
+      case PIPEIOC_POLLOUTTHRD:
+        {
+          if (arg >= dev->d_bufsize)
+            {
+              ret = -EINVAL;
+            }
+          else
+            {
+              dev->d_polloutthrd = (pipe_ndx_t)arg;
+              ret = OK;
+            }
+        }
+        break;
+
       case FIONWRITE:  /* Number of bytes waiting in send queue */
       case FIONREAD:   /* Number of bytes available for reading */
         {
@@ -0,0 +1,263 @@
+/****************************************************************************
+ * drivers/power/deadline_governor.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/irq.h>
+#include <nuttx/power/pm.h>
+#include <nuttx/wdog.h>
+
+#include "deadline_governor.h"
+#include "pm.h"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Per-domain governor state */
+
+struct deadline_governor_domain_s
+{
+  struct pm_deadline_stats_s stats;  /* Residency/misprediction counters */
+  enum pm_state_e laststate;         /* State selected most recently */
+  clock_t lasttick;                  /* When that state was entered */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* PM governor methods */
+
+static void            deadline_governor_initialize(void);
+static void            deadline_governor_statechanged(int domain,
+                                                enum pm_state_e newstate);
+static enum pm_state_e deadline_governor_checkstate(int domain);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct pm_governor_s g_deadline_governor_ops =
+{
+  .initialize   = deadline_governor_initialize,   /* initialize */
+  .statechanged = deadline_governor_statechanged, /* statechanged */
+  .checkstate   = deadline_governor_checkstate,   /* checkstate */
+  .activity     = NULL,                           /* activity */
+};
+
+static struct deadline_governor_domain_s
+  g_deadline_governor[CONFIG_PM_NDOMAINS];
+
+/* The wakeup latency of each power state, in microseconds.  A state is
+ * only entered if the next watchdog/timer expiration is farther away than
+ * its wakeup latency.
+ */
+
+static const uint32_t g_deadline_latency[PM_COUNT] =
+{
+  0,                                          /* PM_NORMAL */
+  CONFIG_PM_GOVERNOR_DEADLINE_IDLE_LATENCY,   /* PM_IDLE */
+  CONFIG_PM_GOVERNOR_DEADLINE_STANDBY_LATENCY, /* PM_STANDBY */
+  CONFIG_PM_GOVERNOR_DEADLINE_SLEEP_LATENCY   /* PM_SLEEP */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: deadline_governor_initialize
+ ****************************************************************************/
+
+static void deadline_governor_initialize(void)
+{
+  clock_t now = clock_systime_ticks();
+  int dom;
+
+  /* The counters reside in .bss and were zeroed at boot; only the time
+   * reference needs initialization.
+   */
+
+  for (dom = 0; dom < CONFIG_PM_NDOMAINS; dom++)
+    {
+      g_deadline_governor[dom].laststate = PM_NORMAL;
+      g_deadline_governor[dom].lasttick  = now;
+    }
+}
+
+/****************************************************************************
+ * Name: deadline_governor_statechanged
+ ****************************************************************************/
+
+static void deadline_governor_statechanged(int domain,
+                                           enum pm_state_e newstate)
+{
+  FAR struct deadline_governor_domain_s *dom;
+  irqstate_t flags;
+  uint32_t delta;
+  clock_t now;
+
+  DEBUGASSERT(domain >= 0 && domain < CONFIG_PM_NDOMAINS);
+  dom = &g_deadline_governor[domain];
+
+  /* A wakeup notification returns the domain to normal operation */
+
+  if (newstate == PM_RESTORE)
+    {
+      newstate = PM_NORMAL;
+    }
+
+  flags = enter_critical_section();
+
+  /* Close out the residency of the state just left */
+
+  now   = clock_systime_ticks();
+  delta = (uint32_t)(now - dom->lasttick);
+  dom->stats.residency[dom->laststate] += delta;
+
+  /* A reduced power state that did not even last its own wakeup latency
+   * cost more than it saved:  count it as a misprediction.
+   */
+
+  if (dom->laststate > PM_NORMAL &&
+      (uint64_t)delta * USEC_PER_TICK < g_deadline_latency[dom->laststate])
+    {
+      dom->stats.mispredicts[dom->laststate]++;
+    }
+
+  dom->stats.transitions[newstate]++;
+  dom->laststate = newstate;
+  dom->lasttick  = now;
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: deadline_governor_checkstate
+ ****************************************************************************/
+
+static enum pm_state_e deadline_governor_checkstate(int domain)
+{
+  FAR struct pm_domain_s *pdom;
+  irqstate_t flags;
+  int state;
+  int next;
+
+  pdom  = &g_pmglobals.domain[domain];
+  state = PM_NORMAL;
+
+  /* We disable interrupts since pm_stay()/pm_relax() could be
+   * simultaneously invoked, which modifies the stay count which we are
+   * about to read
+   */
+
+  flags = enter_critical_section();
+
+  /* Find the deepest power level which is not locked.  The stay counts
+   * are the per-driver hard constraints.
+   */
+
+  while (!pdom->stay[state] && state < (PM_COUNT - 1))
+    {
+      state++;
+    }
+
+  /* Then back off to the deepest state whose wakeup latency fits within
+   * the time remaining until the next watchdog/timer expiration.  If no
+   * watchdog is active, then any state fits.
+   */
+
+  next = wd_nextexpiry();
+  if (next >= 0)
+    {
+      uint64_t budget = (uint64_t)next * USEC_PER_TICK;
+
+      while (state > PM_NORMAL && g_deadline_latency[state] > budget)
+        {
+          state--;
+        }
+    }
+
+  leave_critical_section(flags);
+
+  /* Return the found state */
+
+  return state;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pm_deadline_governor_initialize
+ *
+ * Description:
+ *   Return the deadline governor instance.
+ *
+ * Returned Value:
+ *   A pointer to the governor struct. Otherwise NULL is returned on error.
+ *
+ ****************************************************************************/
+
+FAR const struct pm_governor_s *pm_deadline_governor_initialize(void)
+{
+  return &g_deadline_governor_ops;
+}
+
+/****************************************************************************
+ * Name: pm_deadline_governor_statistics
+ *
+ * Description:
+ *   Return a snapshot of the state residency and misprediction statistics
+ *   accumulated by the deadline governor for one PM domain.
+ *
+ * Input Parameters:
+ *   domain - The PM domain to query
+ *   stats  - The location to return the statistics
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pm_deadline_governor_statistics(int domain,
+                                     FAR struct pm_deadline_stats_s *stats)
+{
+  irqstate_t flags;
+
+  DEBUGASSERT(domain >= 0 && domain < CONFIG_PM_NDOMAINS &&
+              stats != NULL);
+
+  flags = enter_critical_section();
+  memcpy(stats, &g_deadline_governor[domain].stats,
+         sizeof(struct pm_deadline_stats_s));
+  leave_critical_section(flags);
+}
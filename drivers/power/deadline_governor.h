@@ -0,0 +1,101 @@
+/****************************************************************************
+ * drivers/power/deadline_governor.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __DRIVERS_POWER_DEADLINE_GOVERNOR_H
+#define __DRIVERS_POWER_DEADLINE_GOVERNOR_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <nuttx/power/pm.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Statistics kept by the deadline governor for one PM domain */
+
+struct pm_deadline_stats_s
+{
+  uint32_t residency[PM_COUNT];   /* Total ticks spent in each state */
+  uint32_t transitions[PM_COUNT]; /* Number of entries into each state */
+  uint32_t mispredicts[PM_COUNT]; /* Residencies shorter than the state's
+                                   * wakeup latency */
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pm_deadline_governor_initialize
+ *
+ * Description:
+ *   Return the deadline governor instance.
+ *
+ * Returned Value:
+ *   A pointer to the governor struct. Otherwise NULL is returned on error.
+ *
+ ****************************************************************************/
+
+FAR const struct pm_governor_s *pm_deadline_governor_initialize(void);
+
+/****************************************************************************
+ * Name: pm_deadline_governor_statistics
+ *
+ * Description:
+ *   Return a snapshot of the state residency and misprediction statistics
+ *   accumulated by the deadline governor for one PM domain.
+ *
+ * Input Parameters:
+ *   domain - The PM domain to query
+ *   stats  - The location to return the statistics
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pm_deadline_governor_statistics(int domain,
+                                     FAR struct pm_deadline_stats_s *stats);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DRIVERS_POWER_DEADLINE_GOVERNOR_H */
@@ -48,6 +48,8 @@
 #  include "activity_governor.h"
 #elif defined(CONFIG_PM_GOVERNOR_GREEDY)
 #  include "greedy_governor.h"
+#elif defined(CONFIG_PM_GOVERNOR_DEADLINE)
+#  include "deadline_governor.h"
 #endif
 
 #ifdef CONFIG_PM
@@ -99,6 +101,8 @@ void pm_initialize(void)
   g_pmglobals.governor = pm_activity_governor_initialize();
 #elif defined(CONFIG_PM_GOVERNOR_GREEDY)
   g_pmglobals.governor = pm_greedy_governor_initialize();
+#elif defined(CONFIG_PM_GOVERNOR_DEADLINE)
+  g_pmglobals.governor = pm_deadline_governor_initialize();
 #elif defined(CONFIG_PM_GOVERNOR_CUSTOM)
   /* TODO: call to board function to retrieve custom governor,
    * such as board_pm_governor_initialize()
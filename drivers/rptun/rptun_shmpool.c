@@ -0,0 +1,199 @@
+/****************************************************************************
+ * drivers/rptun/rptun_shmpool.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/rptun/rptun_shmpool.h>
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: rptun_shmpool_init
+ ****************************************************************************/
+
+int rptun_shmpool_init(FAR struct rptun_shmpool_s *pool, FAR void *base,
+                       size_t size, size_t bufsize)
+{
+  unsigned int nwords;
+
+  DEBUGASSERT(pool != NULL && base != NULL && bufsize > 0);
+
+  pool->base    = (FAR uint8_t *)base;
+  pool->bufsize = bufsize;
+  pool->nbufs   = size / bufsize;
+  pool->next    = 0;
+
+  if (pool->nbufs == 0)
+    {
+      return -EINVAL;
+    }
+
+  /* The allocation map is local to this core; only handles travel through
+   * the vring, so no cross-core locking of the map is required.
+   */
+
+  nwords    = (pool->nbufs + 31) >> 5;
+  pool->map = (FAR uint32_t *)kmm_zalloc(nwords * sizeof(uint32_t));
+  if (pool->map == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  nxsem_init(&pool->exclsem, 0, 1);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: rptun_shmpool_uninit
+ ****************************************************************************/
+
+void rptun_shmpool_uninit(FAR struct rptun_shmpool_s *pool)
+{
+  DEBUGASSERT(pool != NULL);
+
+  nxsem_destroy(&pool->exclsem);
+  kmm_free(pool->map);
+  pool->map = NULL;
+}
+
+/****************************************************************************
+ * Name: rptun_shmpool_alloc
+ ****************************************************************************/
+
+FAR void *rptun_shmpool_alloc(FAR struct rptun_shmpool_s *pool)
+{
+  FAR void *buffer = NULL;
+  unsigned int i;
+  unsigned int n;
+  int ret;
+
+  DEBUGASSERT(pool != NULL && pool->map != NULL);
+
+  ret = nxsem_wait_uninterruptible(&pool->exclsem);
+  if (ret < 0)
+    {
+      return NULL;
+    }
+
+  /* Search the allocation map, starting at the hint left by the previous
+   * allocation so that a mostly full pool is not rescanned from zero.
+   */
+
+  for (n = 0, i = pool->next; n < pool->nbufs; n++, i++)
+    {
+      if (i >= pool->nbufs)
+        {
+          i = 0;
+        }
+
+      if ((pool->map[i >> 5] & (1 << (i & 31))) == 0)
+        {
+          pool->map[i >> 5] |= 1 << (i & 31);
+          pool->next = i + 1;
+          buffer     = pool->base + (size_t)i * pool->bufsize;
+          break;
+        }
+    }
+
+  nxsem_post(&pool->exclsem);
+  return buffer;
+}
+
+/****************************************************************************
+ * Name: rptun_shmpool_free
+ ****************************************************************************/
+
+void rptun_shmpool_free(FAR struct rptun_shmpool_s *pool, FAR void *buffer)
+{
+  unsigned int i;
+  int ret;
+
+  DEBUGASSERT(pool != NULL && pool->map != NULL);
+  DEBUGASSERT((FAR uint8_t *)buffer >= pool->base);
+
+  i = ((FAR uint8_t *)buffer - pool->base) / pool->bufsize;
+  DEBUGASSERT(i < pool->nbufs);
+  DEBUGASSERT((pool->map[i >> 5] & (1 << (i & 31))) != 0);
+
+  ret = nxsem_wait_uninterruptible(&pool->exclsem);
+  if (ret < 0)
+    {
+      return;
+    }
+
+  pool->map[i >> 5] &= ~(1 << (i & 31));
+  nxsem_post(&pool->exclsem);
+}
+
+/****************************************************************************
+ * Name: rptun_shmpool_handle
+ ****************************************************************************/
+
+uint32_t rptun_shmpool_handle(FAR struct rptun_shmpool_s *pool,
+                              FAR void *buffer)
+{
+  size_t offset;
+
+  DEBUGASSERT(pool != NULL);
+
+  if ((FAR uint8_t *)buffer < pool->base)
+    {
+      return RPTUN_SHMPOOL_INVALID;
+    }
+
+  offset = (FAR uint8_t *)buffer - pool->base;
+  if (offset >= (size_t)pool->nbufs * pool->bufsize ||
+      offset % pool->bufsize != 0)
+    {
+      return RPTUN_SHMPOOL_INVALID;
+    }
+
+  return (uint32_t)offset;
+}
+
+/****************************************************************************
+ * Name: rptun_shmpool_buffer
+ ****************************************************************************/
+
+FAR void *rptun_shmpool_buffer(FAR struct rptun_shmpool_s *pool,
+                               uint32_t handle)
+{
+  DEBUGASSERT(pool != NULL);
+
+  if (handle >= (size_t)pool->nbufs * pool->bufsize ||
+      handle % pool->bufsize != 0)
+    {
+      return NULL;
+    }
+
+  return pool->base + handle;
+}
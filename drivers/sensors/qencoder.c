@@ -53,6 +53,8 @@
 #include <nuttx/kmalloc.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/irq.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/sensors/qencoder.h>
 
@@ -77,6 +79,12 @@ struct qe_upperhalf_s
   uint8_t                    crefs;    /* The number of times the device has been opened */
   sem_t                      exclsem;  /* Supports mutual exclusion */
   FAR struct qe_lowerhalf_s *lower;    /* lower-half state */
+
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+  FAR struct qe_upperhalf_s *flink;    /* Supports the QEIOC_SNAPGROUP walk */
+  volatile uint32_t          seq;      /* Odd while a capture is in progress */
+  struct qe_snapshot_s       snapshot; /* The most recent position capture */
+#endif
 };
 
 /****************************************************************************
@@ -106,10 +114,73 @@ static const struct file_operations g_qeops =
   NULL      /* poll */
 };
 
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+/* A singly linked list of all registered encoders, in registration order,
+ * supporting the bulk QEIOC_SNAPGROUP command.
+ */
+
+static FAR struct qe_upperhalf_s *g_qe_snaphead;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/************************************************************************************
+ * Name: qe_capture
+ *
+ * Description:
+ *   Capture callback installed into the lower half driver.  This is called
+ *   from the timer capture interrupt with the new position and updates the
+ *   buffered snapshot.  The sequence counter is odd while the update is in
+ *   progress so that readers can detect a torn snapshot and retry.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+static void qe_capture(FAR void *arg, int32_t position)
+{
+  FAR struct qe_upperhalf_s *upper = (FAR struct qe_upperhalf_s *)arg;
+
+  DEBUGASSERT(upper != NULL);
+
+  upper->seq++;
+
+  upper->snapshot.qs_velocity = position - upper->snapshot.qs_position;
+  upper->snapshot.qs_position = position;
+  upper->snapshot.qs_time     = clock_systime_ticks();
+
+  upper->seq++;
+}
+#endif
+
+/************************************************************************************
+ * Name: qe_snapshot_read
+ *
+ * Description:
+ *   Copy the buffered snapshot without blocking the caller and without
+ *   disabling the capture interrupt.  If a capture occurs while the copy
+ *   is in progress, the copy is simply retried.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+static void qe_snapshot_read(FAR struct qe_upperhalf_s *upper,
+                             FAR struct qe_snapshot_s *snapshot)
+{
+  uint32_t seq1;
+  uint32_t seq2;
+
+  do
+    {
+      seq1      = upper->seq;
+      *snapshot = upper->snapshot;
+      seq2      = upper->seq;
+    }
+  while (seq1 != seq2 || (seq1 & 1) != 0);
+}
+#endif
+
 /************************************************************************************
  * Name: qe_open
  *
@@ -165,6 +236,18 @@ static int qe_open(FAR struct file *filep)
         {
           goto errout_with_sem;
         }
+
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+      /* Install the capture callback so that the lower half feeds the
+       * snapshot buffer from the timer capture interrupt.  The method is
+       * optional.
+       */
+
+      if (lower->ops->setposcb != NULL)
+        {
+          lower->ops->setposcb(lower, qe_capture, upper);
+        }
+#endif
     }
 
   /* Save the new open count on success */
@@ -219,6 +302,15 @@ static int qe_close(FAR struct file *filep)
 
       upper->crefs = 0;
 
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+      /* Remove the capture callback before the device is shut down */
+
+      if (lower->ops->setposcb != NULL)
+        {
+          lower->ops->setposcb(lower, NULL, NULL);
+        }
+#endif
+
       /* Disable the QEncoder device */
 
       DEBUGASSERT(lower->ops->shutdown != NULL);
@@ -285,6 +377,53 @@ static int qe_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
   lower = upper->lower;
   DEBUGASSERT(lower != NULL);
 
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+  /* The snapshot commands are handled lock-free, before the exclusion
+   * semaphore is taken:  They touch only the seqlock-protected snapshot
+   * buffers and must not block high-rate control loops behind slower
+   * ioctl traffic.
+   */
+
+  if (cmd == QEIOC_SNAPSHOT)
+    {
+      /* QEIOC_SNAPSHOT - Get the most recent position snapshot.
+       *   Argument: struct qe_snapshot_s pointer.
+       */
+
+      FAR struct qe_snapshot_s *snapshot =
+        (FAR struct qe_snapshot_s *)((uintptr_t)arg);
+
+      DEBUGASSERT(snapshot != NULL);
+      qe_snapshot_read(upper, snapshot);
+      return OK;
+    }
+  else if (cmd == QEIOC_SNAPGROUP)
+    {
+      /* QEIOC_SNAPGROUP - Get the most recent snapshots of all registered
+       *   encoders in a single call.
+       *   Argument: struct qe_snapgroup_s pointer.
+       */
+
+      FAR struct qe_snapgroup_s *group =
+        (FAR struct qe_snapgroup_s *)((uintptr_t)arg);
+      FAR struct qe_upperhalf_s *entry;
+      uint8_t nfilled = 0;
+
+      DEBUGASSERT(group != NULL);
+
+      for (entry = g_qe_snaphead;
+           entry != NULL && nfilled < group->qg_count;
+           entry = entry->flink)
+        {
+          qe_snapshot_read(entry, &group->qg_snapshot[nfilled]);
+          nfilled++;
+        }
+
+      group->qg_count = nfilled;
+      return OK;
+    }
+#endif
+
   /* Get exclusive access to the device structures */
 
   ret = nxsem_wait(&upper->exclsem);
@@ -378,6 +517,23 @@ int qe_register(FAR const char *devpath, FAR struct qe_lowerhalf_s *lower)
   nxsem_init(&upper->exclsem, 0, 1);
   upper->lower = lower;
 
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+  /* Append the device to the list used by QEIOC_SNAPGROUP.  The list is
+   * kept in registration order so that the position of each encoder in
+   * the returned group is stable.
+   */
+
+    {
+      FAR struct qe_upperhalf_s **tail;
+      irqstate_t flags;
+
+      flags = enter_critical_section();
+      for (tail = &g_qe_snaphead; *tail != NULL; tail = &(*tail)->flink);
+      *tail = upper;
+      leave_critical_section(flags);
+    }
+#endif
+
   /* Register the QEncoder device */
 
   sninfo("Registering %s\n", devpath);
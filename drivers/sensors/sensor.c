@@ -76,6 +76,10 @@ struct sensor_upperhalf_s
   bool               enabled;            /* The status of sensor enable or disable */
   unsigned int       interval;           /* The sample interval for sensor, in us */
   unsigned int       latency;            /* The batch latency for sensor, in us */
+  unsigned int       wmbytes;            /* The poll/read watermark, in bytes */
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+  FAR struct sensor_samplepage_s *samplepage; /* Shared latest-sample page */
+#endif
 };
 
 /****************************************************************************
@@ -283,7 +287,9 @@ static ssize_t sensor_read(FAR struct file *filep, FAR char *buffer,
        * that have just entered the buffer.
        */
 
-      while (circbuf_is_empty(&upper->buffer))
+      while (circbuf_is_empty(&upper->buffer) ||
+             (!(filep->f_oflags & O_NONBLOCK) &&
+              circbuf_used(&upper->buffer) < upper->wmbytes))
         {
           if (filep->f_oflags & O_NONBLOCK)
             {
@@ -410,12 +416,62 @@ static int sensor_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
         }
         break;
 
+      case SNIOC_SET_WATERMARK:
+        {
+          if (lower->ops->fetch)
+            {
+              ret = -ENOTSUP;
+              break;
+            }
+
+          if (*val == 0)
+            {
+              ret = -EINVAL;
+              break;
+            }
+
+          bytes = *val * upper->esize;
+          if (bytes > circbuf_size(&upper->buffer))
+            {
+              /* Grow the buffer so that it can hold the watermark */
+
+              ret = circbuf_resize(&upper->buffer, bytes);
+              if (ret < 0)
+                {
+                  break;
+                }
+
+              if (bytes > lower->buffer_size)
+                {
+                  lower->buffer_size = bytes;
+                }
+            }
+
+          upper->wmbytes = bytes;
+        }
+        break;
+
       case SNIOC_GET_NEVENTBUF:
         {
           *val = lower->buffer_size / upper->esize;
         }
         break;
 
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+      case SNIOC_GET_SAMPLEPAGE:
+        {
+          if (upper->samplepage == NULL)
+            {
+              ret = -ENOTSUP;
+              break;
+            }
+
+          *(FAR struct sensor_samplepage_s **)(uintptr_t)arg =
+            upper->samplepage;
+        }
+        break;
+#endif
+
       case SNIOC_SET_BUFFER_SIZE:
         {
           if (*val != 0)
@@ -504,7 +560,7 @@ static int sensor_poll(FAR struct file *filep,
                 }
             }
         }
-      else if (!circbuf_is_empty(&upper->buffer))
+      else if (circbuf_used(&upper->buffer) >= upper->wmbytes)
         {
           eventset |= (fds->events & POLLIN);
         }
@@ -543,12 +599,35 @@ static void sensor_push_event(FAR void *priv, FAR const void *data,
       return;
     }
 
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+  if (upper->samplepage != NULL && bytes >= upper->esize)
+    {
+      /* Publish the latest event into the shared sample page.  The
+       * sequence counter is odd while the copy is in progress so that a
+       * lock-free reader can detect and retry a torn read.
+       */
+
+      FAR struct sensor_samplepage_s *sp = upper->samplepage;
+
+      sp->sp_sequence++;
+      memcpy(sp->sp_data, (FAR const uint8_t *)data + bytes - upper->esize,
+             upper->esize);
+      sp->sp_sequence++;
+    }
+#endif
+
   circbuf_overwrite(&upper->buffer, data, bytes);
-  sensor_pollnotify(upper, POLLIN);
-  nxsem_get_value(&upper->buffersem, &semcount);
-  if (semcount < 1)
+
+  /* Don't wake up the waiters until the watermark has been reached */
+
+  if (circbuf_used(&upper->buffer) >= upper->wmbytes)
     {
-      nxsem_post(&upper->buffersem);
+      sensor_pollnotify(upper, POLLIN);
+      nxsem_get_value(&upper->buffersem, &semcount);
+      if (semcount < 1)
+        {
+          nxsem_post(&upper->buffersem);
+        }
     }
 
   nxsem_post(&upper->exclsem);
@@ -668,6 +747,7 @@ int sensor_custom_register(FAR struct sensor_lowerhalf_s *lower,
 
   upper->lower = lower;
   upper->esize = esize;
+  upper->wmbytes = esize;
 
   nxsem_init(&upper->exclsem, 0, 1);
   nxsem_init(&upper->buffersem, 0, 0);
@@ -690,6 +770,21 @@ int sensor_custom_register(FAR struct sensor_lowerhalf_s *lower,
         }
 
       lower->push_event = sensor_push_event;
+
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+      /* Allocate the shared latest-sample page from the user heap so that
+       * the application may map and read it directly in all build modes.
+       */
+
+      upper->samplepage = kumm_zalloc(SIZEOF_SENSOR_SAMPLEPAGE(esize));
+      if (upper->samplepage == NULL)
+        {
+          ret = -ENOMEM;
+          goto drv_err;
+        }
+
+      upper->samplepage->sp_esize = esize;
+#endif
     }
   else
     {
@@ -710,6 +805,13 @@ drv_err:
   nxsem_destroy(&upper->exclsem);
   nxsem_destroy(&upper->buffersem);
 
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+  if (upper->samplepage != NULL)
+    {
+      kumm_free(upper->samplepage);
+    }
+#endif
+
   kmm_free(upper);
 
   return ret;
@@ -770,5 +872,12 @@ void sensor_custom_unregister(FAR struct sensor_lowerhalf_s *lower,
   nxsem_destroy(&upper->exclsem);
   nxsem_destroy(&upper->buffersem);
 
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+  if (upper->samplepage != NULL)
+    {
+      kumm_free(upper->samplepage);
+    }
+#endif
+
   kmm_free(upper);
 }
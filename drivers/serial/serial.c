@@ -716,7 +716,9 @@ static ssize_t uart_read(FAR struct file *filep, FAR char *buffer, size_t buflen
   irqstate_t flags;
   ssize_t recvd = 0;
   int16_t tail;
+#ifdef CONFIG_SERIAL_TERMIOS
   char ch;
+#endif
   int ret;
 
   /* Only one user can access rxbuf->tail at a time */
@@ -769,6 +771,59 @@ static ssize_t uart_read(FAR struct file *filep, FAR char *buffer, size_t buflen
       tail = rxbuf->tail;
       if (rxbuf->head != tail)
         {
+#ifdef CONFIG_SERIAL_TERMIOS
+          /* If none of the input character translations are enabled, then
+           * the received data may be copied out of the circular buffer in
+           * contiguous spans.  Otherwise, fall through to the character-
+           * at-a-time logic below so that each character may be inspected.
+           */
+
+          if ((dev->tc_iflag & (INLCR | IGNCR | ICRNL)) == 0)
+#endif
+            {
+              /* Copy the largest contiguous sequence of bytes from the
+               * tail of the circular buffer.  The head index is sampled
+               * only once; the Rx interrupt handling logic may advance it
+               * while the copy is in progress but that data will simply
+               * be picked up on the next pass through the loop.
+               */
+
+              int16_t head = rxbuf->head;
+              size_t nbytes;
+
+              if (head > tail)
+                {
+                  nbytes = head - tail;
+                }
+              else
+                {
+                  nbytes = rxbuf->size - tail;
+                }
+
+              if (nbytes > buflen - (size_t)recvd)
+                {
+                  nbytes = buflen - (size_t)recvd;
+                }
+
+              memcpy(buffer, &rxbuf->buffer[tail], nbytes);
+              buffer += nbytes;
+              recvd  += nbytes;
+
+              /* Update the tail index only once per span so that the
+               * final rxbuf->tail update is atomic.
+               */
+
+              tail += nbytes;
+              if (tail >= rxbuf->size)
+                {
+                  tail = 0;
+                }
+
+              rxbuf->tail = tail;
+              continue;
+            }
+
+#ifdef CONFIG_SERIAL_TERMIOS
           /* Take the next character from the tail of the buffer */
 
           ch = rxbuf->buffer[tail];
@@ -785,7 +840,6 @@ static ssize_t uart_read(FAR struct file *filep, FAR char *buffer, size_t buflen
 
           rxbuf->tail = tail;
 
-#ifdef CONFIG_SERIAL_TERMIOS
           /* Do input processing if any is enabled */
 
           if (dev->tc_iflag & (INLCR | IGNCR | ICRNL))
@@ -817,12 +871,12 @@ static ssize_t uart_read(FAR struct file *filep, FAR char *buffer, size_t buflen
            * IUCLC - Not Posix
            * IXON/OXOFF - no xon/xoff flow control.
            */
-#endif
 
           /* Store the received character */
 
           *buffer++ = ch;
           recvd++;
+#endif
         }
 
 #ifdef CONFIG_DEV_SERIAL_FULLBLOCKS
@@ -1658,9 +1712,31 @@ int uart_register(FAR const char *path, FAR uart_dev_t *dev)
 
 void uart_datareceived(FAR uart_dev_t *dev)
 {
+#if CONFIG_SERIAL_RXPOLL_WATERMARK > 0
+  FAR struct uart_buffer_s *rxbuf = &dev->recv;
+  int nbuffered;
+
+  /* Notify poll/select waiters only after the watermark has been reached
+   * (or when the Rx buffer is about to overflow).  This throttles the rate
+   * of POLLIN wake-ups on high-rate input streams.
+   */
+
+  nbuffered = rxbuf->head - rxbuf->tail;
+  if (nbuffered < 0)
+    {
+      nbuffered += rxbuf->size;
+    }
+
+  if (nbuffered >= CONFIG_SERIAL_RXPOLL_WATERMARK ||
+      nbuffered >= rxbuf->size - 1)
+    {
+      uart_pollnotify(dev, POLLIN);
+    }
+#else
   /* Notify all poll/select waiters that they can read from the recv buffer */
 
   uart_pollnotify(dev, POLLIN);
+#endif
 
   /* Is there a thread waiting for read data?  */
 
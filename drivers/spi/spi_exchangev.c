@@ -0,0 +1,75 @@
+/****************************************************************************
+ * drivers/spi/spi_exchangev.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <assert.h>
+
+#include <nuttx/spi/spi.h>
+
+#ifdef CONFIG_SPI_EXCHANGEV
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: spi_exchangev
+ *
+ * Description:
+ *   Exchange a list of data segments by performing one normal exchange
+ *   per segment.  This is the fall-back used by the SPI_EXCHANGEV macro
+ *   when the driver does not provide a native exchangev method.  The bus
+ *   must be locked and the device selected by the caller; the chip select
+ *   remains asserted across all of the segments.
+ *
+ * Input Parameters:
+ *   dev     - Device-specific state data
+ *   seglist - A list of data segments to exchange in order
+ *   nseg    - The number of segments in the list
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void spi_exchangev(FAR struct spi_dev_s *dev,
+                   FAR const struct spi_sgbuf_s *seglist, size_t nseg)
+{
+  size_t i;
+
+  DEBUGASSERT(dev != NULL && seglist != NULL);
+
+  for (i = 0; i < nseg; i++)
+    {
+      if (seglist[i].nwords > 0)
+        {
+          SPI_EXCHANGE(dev, seglist[i].txbuffer, seglist[i].rxbuffer,
+                       seglist[i].nwords);
+        }
+    }
+}
+
+#endif /* CONFIG_SPI_EXCHANGEV */
@@ -118,7 +118,7 @@ static const struct file_operations g_ramlogfops =
  * for the syslogging function.
  */
 
-#ifdef CONFIG_RAMLOG_SYSLOG
+#if defined(CONFIG_RAMLOG_SYSLOG) || defined(CONFIG_SYSLOG_BOOT_REPLAY)
 static char g_sysbuffer[CONFIG_RAMLOG_BUFSIZE];
 
 /* This is the device structure for the console or syslogging function.  It
@@ -718,7 +718,7 @@ void ramlog_syslog_register(void)
  *
  ****************************************************************************/
 
-#ifdef CONFIG_RAMLOG_SYSLOG
+#if defined(CONFIG_RAMLOG_SYSLOG) || defined(CONFIG_SYSLOG_BOOT_REPLAY)
 int ramlog_putc(int ch)
 {
   FAR struct ramlog_dev_s *priv = &g_sysdev;
@@ -785,4 +785,56 @@ int ramlog_putc(int ch)
 }
 #endif
 
+/****************************************************************************
+ * Name: ramlog_drain
+ *
+ * Description:
+ *   Remove and return buffered characters from the syslog RAM log.  This
+ *   is used by the boot log replay logic to copy the RAM log content to
+ *   the final SYSLOG device once that device is ready.
+ *
+ * Input Parameters:
+ *   buffer - Location to return the drained characters
+ *   buflen - The maximum number of characters to drain
+ *
+ * Returned Value:
+ *   The number of characters returned in buffer.  Zero is returned when
+ *   the RAM log is empty.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_RAMLOG_SYSLOG) || defined(CONFIG_SYSLOG_BOOT_REPLAY)
+ssize_t ramlog_drain(FAR char *buffer, size_t buflen)
+{
+  FAR struct ramlog_dev_s *priv = &g_sysdev;
+  irqstate_t flags;
+  ssize_t nread;
+
+  /* Copy characters out of the circular buffer, advancing the tail index
+   * as each is removed.  Interrupts are disabled briefly to keep the
+   * indices coherent with concurrent ramlog_addchar() calls.
+   */
+
+  flags = enter_critical_section();
+  for (nread = 0; (size_t)nread < buflen; nread++)
+    {
+      if (priv->rl_head == priv->rl_tail)
+        {
+          /* The RAM log is empty */
+
+          break;
+        }
+
+      buffer[nread] = priv->rl_buffer[priv->rl_tail];
+      if (++priv->rl_tail >= priv->rl_bufsize)
+        {
+          priv->rl_tail = 0;
+        }
+    }
+
+  leave_critical_section(flags);
+  return nread;
+}
+#endif
+
 #endif /* CONFIG_RAMLOG */
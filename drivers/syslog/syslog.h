@@ -248,6 +248,58 @@ int syslog_flush_intbuffer(FAR const struct syslog_channel_s *channel,
                            bool force);
 #endif
 
+/****************************************************************************
+ * Name: syslog_add_asyncbuffer
+ *
+ * Description:
+ *   Copy data into the asynchronous buffer and schedule the drain worker.
+ *   In the event that the buffer overflows, excess data is dropped and
+ *   counted; the drain worker will emit a notice with the number of
+ *   dropped bytes.
+ *
+ * Input Parameters:
+ *   buffer - The buffer containing the data to be output
+ *   buflen - The number of bytes in the buffer
+ *
+ * Returned Value:
+ *   The number of bytes accepted (buflen; drops are reported through the
+ *   SYSLOG stream itself).
+ *
+ * Assumptions:
+ *   May be called from any context, including interrupt handlers.  Never
+ *   blocks; the cost is bounded by the buffer copy.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG_ASYNC
+ssize_t syslog_add_asyncbuffer(FAR const char *buffer, size_t buflen);
+#endif
+
+/****************************************************************************
+ * Name: syslog_flush_asyncbuffer
+ *
+ * Description:
+ *   Flush any data that may be pending in the asynchronous buffer to the
+ *   SYSLOG device.  This is called by system crash-handling logic.
+ *
+ * Input Parameters:
+ *   channel - The syslog channel to use in performing the flush operation.
+ *   force   - Use the force() method of the channel vs. the putc() method.
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value is returned on any
+ *   failure.
+ *
+ * Assumptions:
+ *   Interrupts may or may not be disabled.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG_ASYNC
+int syslog_flush_asyncbuffer(FAR const struct syslog_channel_s *channel,
+                             bool force);
+#endif
+
 /****************************************************************************
  * Name: syslog_putc
  *
@@ -355,6 +407,28 @@ int syslog_dev_putc(int ch);
 
 int syslog_dev_flush(void);
 
+/****************************************************************************
+ * Name: syslog_replay_start
+ *
+ * Description:
+ *   Begin background replay of the boot RAM log to the currently selected
+ *   SYSLOG channel.  This is called after the final SYSLOG channel has
+ *   been installed by syslog_initialize().  The replay runs on the low
+ *   priority work queue so that boot never waits on slow console hardware.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned
+ *   on any failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSLOG_BOOT_REPLAY
+int syslog_replay_start(void);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
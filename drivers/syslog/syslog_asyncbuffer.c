@@ -0,0 +1,336 @@
+/****************************************************************************
+ * drivers/syslog/syslog_asyncbuffer.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/wqueue.h>
+#include <nuttx/syslog/syslog.h>
+
+#include "syslog.h"
+
+#ifdef CONFIG_SYSLOG_ASYNC
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The asynchronous buffer is drained on the low priority work queue if it
+ * is available; logging must not delay high priority, time-critical work.
+ */
+
+#if defined(CONFIG_SCHED_LPWORK)
+#  define SYSLOG_ASYNC_WORK LPWORK
+#else
+#  define SYSLOG_ASYNC_WORK HPWORK
+#endif
+
+/* One byte of the circular buffer is always kept unused so that a full
+ * buffer can be distinguished from an empty one.
+ */
+
+#define USABLE_ASYNCBUFSIZE (CONFIG_SYSLOG_ASYNC_BUFSIZE - 1)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure encapsulates the asynchronous buffer state.  The producer
+ * side modifies only sa_inndx and sa_dropped (in a critical section); the
+ * drain worker is the only logic that advances sa_outndx.
+ */
+
+struct g_syslog_asyncbuffer_s
+{
+  volatile uint32_t sa_inndx;
+  volatile uint32_t sa_outndx;
+  volatile uint32_t sa_dropped;   /* Bytes dropped since the last notice */
+  struct work_s sa_work;          /* Supports the deferred drain */
+  uint8_t sa_buffer[CONFIG_SYSLOG_ASYNC_BUFSIZE];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct g_syslog_asyncbuffer_s g_syslog_asyncbuffer;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_async_worker
+ *
+ * Description:
+ *   Drain the asynchronous buffer to the SYSLOG device.  This runs on the
+ *   work queue; the logging caller never waits on the device.
+ *
+ ****************************************************************************/
+
+static void syslog_async_worker(FAR void *arg)
+{
+  irqstate_t flags;
+  uint32_t inndx;
+  uint32_t outndx;
+  uint32_t dropped;
+  uint32_t count;
+  char notice[32];
+
+  DEBUGASSERT(g_syslog_channel != NULL);
+
+  for (; ; )
+    {
+      /* Sample the IN index.  New data added while we are draining will be
+       * picked up on the next pass of the loop.
+       */
+
+      flags  = enter_critical_section();
+      inndx  = g_syslog_asyncbuffer.sa_inndx;
+      outndx = g_syslog_asyncbuffer.sa_outndx;
+      leave_critical_section(flags);
+
+      if (outndx == inndx)
+        {
+          break;
+        }
+
+      /* Emit the contiguous run of data up to the IN index or up to the
+       * end of the circular buffer, whichever comes first.
+       */
+
+      count = (inndx > outndx ? inndx : CONFIG_SYSLOG_ASYNC_BUFSIZE)
+              - outndx;
+
+#ifdef CONFIG_SYSLOG_WRITE
+      if (g_syslog_channel->sc_write)
+        {
+          g_syslog_channel->sc_write(
+            (FAR const char *)&g_syslog_asyncbuffer.sa_buffer[outndx],
+            count);
+        }
+      else
+#endif
+        {
+          uint32_t i;
+
+          DEBUGASSERT(g_syslog_channel->sc_putc != NULL);
+          for (i = 0; i < count; i++)
+            {
+              g_syslog_channel->sc_putc(
+                g_syslog_asyncbuffer.sa_buffer[outndx + i]);
+            }
+        }
+
+      /* Advance the OUT index, handling wrap-around.  Only this worker
+       * modifies the OUT index so no critical section is needed for the
+       * update itself.
+       */
+
+      outndx += count;
+      if (outndx >= CONFIG_SYSLOG_ASYNC_BUFSIZE)
+        {
+          outndx -= CONFIG_SYSLOG_ASYNC_BUFSIZE;
+        }
+
+      g_syslog_asyncbuffer.sa_outndx = outndx;
+    }
+
+  /* The buffer has been drained.  If data was dropped while the buffer
+   * was full, then emit one notice accounting for it.
+   */
+
+  flags   = enter_critical_section();
+  dropped = g_syslog_asyncbuffer.sa_dropped;
+  g_syslog_asyncbuffer.sa_dropped = 0;
+  leave_critical_section(flags);
+
+  if (dropped > 0)
+    {
+      snprintf(notice, sizeof(notice), "[%lu bytes dropped]\n",
+               (unsigned long)dropped);
+      syslog_add_asyncbuffer(notice, strlen(notice));
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_add_asyncbuffer
+ *
+ * Description:
+ *   Copy data into the asynchronous buffer and schedule the drain worker.
+ *   In the event that the buffer overflows, excess data is dropped and
+ *   counted; the drain worker will emit a notice with the number of
+ *   dropped bytes.
+ *
+ * Input Parameters:
+ *   buffer - The buffer containing the data to be output
+ *   buflen - The number of bytes in the buffer
+ *
+ * Returned Value:
+ *   The number of bytes accepted (buflen; drops are reported through the
+ *   SYSLOG stream itself).
+ *
+ * Assumptions:
+ *   May be called from any context, including interrupt handlers.  Never
+ *   blocks; the cost is bounded by the buffer copy.
+ *
+ ****************************************************************************/
+
+ssize_t syslog_add_asyncbuffer(FAR const char *buffer, size_t buflen)
+{
+  irqstate_t flags;
+  uint32_t inndx;
+  uint32_t outndx;
+  uint32_t endndx;
+  uint32_t space;
+  uint32_t count;
+  uint32_t first;
+
+  /* Disable concurrent modification of the IN index */
+
+  flags = enter_critical_section();
+
+  /* How much space is left in the buffer? */
+
+  inndx  = g_syslog_asyncbuffer.sa_inndx;
+  outndx = g_syslog_asyncbuffer.sa_outndx;
+
+  endndx = inndx;
+  if (endndx < outndx)
+    {
+      endndx += CONFIG_SYSLOG_ASYNC_BUFSIZE;
+    }
+
+  space = USABLE_ASYNCBUFSIZE - (endndx - outndx);
+
+  /* Copy as much of the data as will fit, handling index wrap-around.
+   * Anything that does not fit is dropped and counted.
+   */
+
+  count = buflen;
+  if (count > space)
+    {
+      g_syslog_asyncbuffer.sa_dropped += count - space;
+      count = space;
+    }
+
+  first = CONFIG_SYSLOG_ASYNC_BUFSIZE - inndx;
+  if (first > count)
+    {
+      first = count;
+    }
+
+  memcpy(&g_syslog_asyncbuffer.sa_buffer[inndx], buffer, first);
+  if (count > first)
+    {
+      memcpy(g_syslog_asyncbuffer.sa_buffer, buffer + first,
+             count - first);
+    }
+
+  inndx += count;
+  if (inndx >= CONFIG_SYSLOG_ASYNC_BUFSIZE)
+    {
+      inndx -= CONFIG_SYSLOG_ASYNC_BUFSIZE;
+    }
+
+  g_syslog_asyncbuffer.sa_inndx = inndx;
+  leave_critical_section(flags);
+
+  /* Schedule the drain worker if it is not already queued.  If it is
+   * queued (or running), it will pick up this data on its own.
+   */
+
+  if (work_available(&g_syslog_asyncbuffer.sa_work))
+    {
+      work_queue(SYSLOG_ASYNC_WORK, &g_syslog_asyncbuffer.sa_work,
+                 syslog_async_worker, NULL, 0);
+    }
+
+  return buflen;
+}
+
+/****************************************************************************
+ * Name: syslog_flush_asyncbuffer
+ *
+ * Description:
+ *   Flush any data that may be pending in the asynchronous buffer to the
+ *   SYSLOG device.  This is called by system crash-handling logic; the
+ *   drain worker will never run again, so the flush must be performed
+ *   using low-level, non-interrupt driven logic.
+ *
+ * Input Parameters:
+ *   channel - The syslog channel to use in performing the flush operation.
+ *   force   - Use the force() method of the channel vs. the putc() method.
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value is returned on any
+ *   failure.
+ *
+ * Assumptions:
+ *   Interrupts may or may not be disabled.
+ *
+ ****************************************************************************/
+
+int syslog_flush_asyncbuffer(FAR const struct syslog_channel_s *channel,
+                             bool force)
+{
+  syslog_putc_t putfunc;
+  uint32_t inndx;
+  uint32_t outndx;
+  int ret = OK;
+
+  /* Select which putc function to use for this flush */
+
+  putfunc = force ? channel->sc_force : channel->sc_putc;
+  DEBUGASSERT(putfunc != NULL);
+
+  inndx  = g_syslog_asyncbuffer.sa_inndx;
+  outndx = g_syslog_asyncbuffer.sa_outndx;
+
+  while (outndx != inndx && ret >= 0)
+    {
+      ret = putfunc(g_syslog_asyncbuffer.sa_buffer[outndx]);
+
+      if (++outndx >= CONFIG_SYSLOG_ASYNC_BUFSIZE)
+        {
+          outndx -= CONFIG_SYSLOG_ASYNC_BUFSIZE;
+        }
+
+      g_syslog_asyncbuffer.sa_outndx = outndx;
+    }
+
+  return ret;
+}
+
+#endif /* CONFIG_SYSLOG_ASYNC */
@@ -45,7 +45,7 @@
 
 #include <nuttx/syslog/syslog.h>
 
-#ifdef CONFIG_RAMLOG_SYSLOG
+#if defined(CONFIG_RAMLOG_SYSLOG) || defined(CONFIG_SYSLOG_BOOT_REPLAY)
 #  include <nuttx/syslog/ramlog.h>
 #elif defined(CONFIG_SYSLOG_RPMSG)
 #  include <nuttx/syslog/syslog_rpmsg.h>
@@ -77,7 +77,7 @@ static int syslog_default_putc(int ch);
  * Public Data
  ****************************************************************************/
 
-#if defined(CONFIG_RAMLOG_SYSLOG)
+#if defined(CONFIG_RAMLOG_SYSLOG) || defined(CONFIG_SYSLOG_BOOT_REPLAY)
 static const struct syslog_channel_s g_default_channel =
 {
   ramlog_putc,
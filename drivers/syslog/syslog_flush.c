@@ -89,6 +89,14 @@ int syslog_flush(void)
   syslog_flush_intbuffer(g_syslog_channel, true);
 #endif
 
+#ifdef CONFIG_SYSLOG_ASYNC
+  /* Flush any data still pending in the asynchronous buffer.  The drain
+   * worker will never run again.
+   */
+
+  syslog_flush_asyncbuffer(g_syslog_channel, true);
+#endif
+
   /* Then flush all of the buffered output to the SYSLOG device */
 
   if (g_syslog_channel->sc_flush != NULL)
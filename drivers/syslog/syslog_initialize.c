@@ -94,6 +94,18 @@ int syslog_initialize(void)
   ret = syslog_console_channel();
 #endif
 
+#ifdef CONFIG_SYSLOG_BOOT_REPLAY
+  /* Everything logged so far went to the boot RAM log.  Now that the
+   * final channel is installed, replay that content to it in the
+   * background.
+   */
+
+  if (ret == OK)
+    {
+      syslog_replay_start();
+    }
+#endif
+
 #ifdef CONFIG_RAMLOG_SYSLOG
   ramlog_syslog_register();
 #endif
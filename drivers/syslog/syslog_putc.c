@@ -70,8 +70,21 @@
 
 int syslog_putc(int ch)
 {
+#ifdef CONFIG_SYSLOG_ASYNC
+  char c = ch;
+#endif
+
   DEBUGASSERT(g_syslog_channel != NULL);
 
+#ifdef CONFIG_SYSLOG_ASYNC
+  /* Copy the character into the asynchronous buffer from any context.
+   * The buffer is drained to the SYSLOG device by the work queue so that
+   * the caller never waits on the device.
+   */
+
+  syslog_add_asyncbuffer(&c, 1);
+  return ch;
+#else
   /* Is this an attempt to do SYSLOG output from an interrupt handler? */
 
   if (up_interrupt_context() || sched_idletask())
@@ -112,4 +125,5 @@ int syslog_putc(int ch)
 
       return g_syslog_channel->sc_putc(ch);
     }
+#endif /* CONFIG_SYSLOG_ASYNC */
 }
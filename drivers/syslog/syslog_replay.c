@@ -0,0 +1,183 @@
+/****************************************************************************
+ * drivers/syslog/syslog_replay.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stddef.h>
+#include <errno.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/syslog/ramlog.h>
+#include <nuttx/syslog/syslog.h>
+#include <nuttx/wqueue.h>
+
+#include "syslog.h"
+
+#ifdef CONFIG_SYSLOG_BOOT_REPLAY
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Size of the chunks moved from the RAM log to the SYSLOG device.  A
+ * drained chunk is held until the device accepts it, so that characters
+ * are not lost while a late device (e.g. USB CDC/ACM) is still coming up.
+ */
+
+#define SYSLOG_REPLAY_CHUNK 64
+
+/* How long to wait before retrying when the device is not ready */
+
+#define SYSLOG_REPLAY_DELAY MSEC2TICK(100)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure holds the state of the replay operation */
+
+struct syslog_replay_s
+{
+  struct work_s work;               /* Supports deferred replay work */
+  char buffer[SYSLOG_REPLAY_CHUNK]; /* Chunk awaiting output */
+  ssize_t nbytes;                   /* Valid bytes remaining in buffer[] */
+  size_t offset;                    /* Offset of next byte to write */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct syslog_replay_s g_syslog_replay;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_replay_worker
+ *
+ * Description:
+ *   Low priority work queue callback that moves the content of the boot
+ *   RAM log to the current SYSLOG channel.  If the channel cannot accept
+ *   output yet, the pending chunk is retained and the work is rescheduled.
+ *
+ ****************************************************************************/
+
+static void syslog_replay_worker(FAR void *arg)
+{
+  FAR struct syslog_replay_s *replay = (FAR struct syslog_replay_s *)arg;
+  FAR const struct syslog_channel_s *channel;
+  ssize_t nwritten;
+
+  for (; ; )
+    {
+      /* Refill the chunk buffer if the previous chunk was fully written */
+
+      if (replay->nbytes <= 0)
+        {
+          replay->nbytes = ramlog_drain(replay->buffer,
+                                        sizeof(replay->buffer));
+          replay->offset = 0;
+
+          if (replay->nbytes <= 0)
+            {
+              /* The RAM log is empty.  The replay is complete. */
+
+              return;
+            }
+        }
+
+      /* Write the chunk to the current SYSLOG channel.  Prefer the
+       * multi-byte interface when the channel provides one.
+       */
+
+      channel = g_syslog_channel;
+      if (channel->sc_write != NULL)
+        {
+          nwritten = channel->sc_write(&replay->buffer[replay->offset],
+                                       replay->nbytes);
+        }
+      else
+        {
+          nwritten = 0;
+          while (nwritten < replay->nbytes &&
+                 channel->sc_putc(
+                   replay->buffer[replay->offset + nwritten]) >= 0)
+            {
+              nwritten++;
+            }
+
+          if (nwritten == 0)
+            {
+              nwritten = -EAGAIN;
+            }
+        }
+
+      if (nwritten < 0)
+        {
+          /* The device is not ready (for example, a USB console that has
+           * not yet enumerated).  Keep the pending chunk and try again
+           * later.
+           */
+
+          work_queue(LPWORK, &replay->work, syslog_replay_worker,
+                     replay, SYSLOG_REPLAY_DELAY);
+          return;
+        }
+
+      replay->offset += nwritten;
+      replay->nbytes -= nwritten;
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: syslog_replay_start
+ *
+ * Description:
+ *   Begin background replay of the boot RAM log to the currently selected
+ *   SYSLOG channel.  This is called after the final SYSLOG channel has
+ *   been installed by syslog_initialize().  The replay runs on the low
+ *   priority work queue so that boot never waits on slow console
+ *   hardware; if the device is not ready, the replay simply retries
+ *   later.
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned
+ *   on any failure.
+ *
+ ****************************************************************************/
+
+int syslog_replay_start(void)
+{
+  return work_queue(LPWORK, &g_syslog_replay.work, syslog_replay_worker,
+                    &g_syslog_replay, 0);
+}
+
+#endif /* CONFIG_SYSLOG_BOOT_REPLAY */
@@ -130,6 +130,14 @@ static ssize_t syslog_default_write(FAR const char *buffer, size_t buflen)
 
 ssize_t syslog_write(FAR const char *buffer, size_t buflen)
 {
+#ifdef CONFIG_SYSLOG_ASYNC
+  /* Copy the data into the asynchronous buffer from any context.  The
+   * buffer is drained to the SYSLOG device by the work queue so that the
+   * caller never waits on the device.
+   */
+
+  return syslog_add_asyncbuffer(buffer, buflen);
+#else
 #ifdef CONFIG_SYSLOG_INTBUFFER
   if (!up_interrupt_context() && !sched_idletask())
     {
@@ -142,4 +150,5 @@ ssize_t syslog_write(FAR const char *buffer, size_t buflen)
 #endif
 
   return syslog_default_write(buffer, buflen);
+#endif /* CONFIG_SYSLOG_ASYNC */
 }
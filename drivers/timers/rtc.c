@@ -40,9 +40,11 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 #include <errno.h>
 
 #include <nuttx/kmalloc.h>
@@ -89,6 +91,15 @@ struct rtc_upperhalf_s
 
   struct rtc_alarminfo_s periodicinfo;
 #endif
+
+#ifdef CONFIG_RTC_RDTIME_CACHE
+  /* State needed to interpolate RTC_RD_TIME from the monotonic clock */
+
+  time_t  basetime;                   /* RTC time at the last resync */
+  clock_t basetick;                   /* Tick count at the last resync */
+  long    driftppm;                   /* Estimated RTC drift (ppm) */
+  bool    cachevalid;                 /* True: base* hold a valid sample */
+#endif
 };
 
 /****************************************************************************
@@ -109,6 +120,11 @@ static void    rtc_alarm_callback(FAR void *priv, int id);
 static void    rtc_periodic_callback(FAR void *priv, int id);
 #endif
 
+#ifdef CONFIG_RTC_RDTIME_CACHE
+static int     rtc_cache_rdtime(FAR struct rtc_upperhalf_s *upper,
+                                FAR struct rtc_time *rtctime);
+#endif
+
 /* Character driver methods */
 
 #ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
@@ -237,6 +253,94 @@ static void rtc_periodic_callback(FAR void *priv, int alarmid)
 }
 #endif
 
+/****************************************************************************
+ * Name: rtc_cache_rdtime
+ *
+ * Description:
+ *   Satisfy RTC_RD_TIME from a cached hardware sample plus the elapsed
+ *   monotonic time.  The hardware RTC -- which may sit behind a slow bus
+ *   such as I2C -- is read only when the cache is cold or when the
+ *   resynchronization period has passed.  A drift estimate, updated at
+ *   each resynchronization, corrects the interpolation in between.
+ *
+ *   The caller holds the exclsem semaphore.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_RTC_RDTIME_CACHE
+static int rtc_cache_rdtime(FAR struct rtc_upperhalf_s *upper,
+                            FAR struct rtc_time *rtctime)
+{
+  clock_t now;
+  clock_t elapsed;
+  time_t seconds;
+  int ret;
+
+  now = clock_systime_ticks();
+
+  if (upper->cachevalid)
+    {
+      elapsed = now - upper->basetick;
+      if (elapsed < SEC2TICK(CONFIG_RTC_RDTIME_CACHE_RESYNC))
+        {
+          /* Interpolate:  apply the drift correction to the elapsed
+           * monotonic time and add it to the cached hardware sample.
+           */
+
+          elapsed += (clock_t)((int64_t)elapsed * upper->driftppm /
+                               1000000);
+          seconds  = upper->basetime + elapsed / TICK_PER_SEC;
+          gmtime_r(&seconds, (FAR struct tm *)rtctime);
+          return OK;
+        }
+    }
+
+  /* The cache is cold or a resynchronization is due:  read the hardware */
+
+  ret = upper->lower->ops->rdtime(upper->lower, rtctime);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  seconds = timegm((FAR struct tm *)rtctime);
+
+  if (upper->cachevalid)
+    {
+      int64_t monoticks;
+      int64_t rtcticks;
+      long drift;
+
+      /* Update the drift estimate:  the disagreement between the RTC and
+       * the monotonic clock over the whole interval, in parts per million.
+       * A large disagreement means that the RTC was stepped behind our
+       * back; discard the sample in that case.
+       */
+
+      monoticks = (int64_t)(now - upper->basetick);
+      rtcticks  = (int64_t)(seconds - upper->basetime) * TICK_PER_SEC;
+
+      if (monoticks > 0)
+        {
+          drift = (long)((rtcticks - monoticks) * 1000000 / monoticks);
+          if (drift >= -10000 && drift <= 10000)
+            {
+              upper->driftppm = drift;
+            }
+          else
+            {
+              upper->driftppm = 0;
+            }
+        }
+    }
+
+  upper->basetime   = seconds;
+  upper->basetick   = now;
+  upper->cachevalid = true;
+  return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: rtc_open
  ****************************************************************************/
@@ -390,7 +494,11 @@ static int rtc_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 
         if (ops->rdtime)
           {
+#ifdef CONFIG_RTC_RDTIME_CACHE
+            ret = rtc_cache_rdtime(upper, rtctime);
+#else
             ret = ops->rdtime(upper->lower, rtctime);
+#endif
           }
       }
       break;
@@ -411,6 +519,14 @@ static int rtc_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
             ret = ops->settime(upper->lower, rtctime);
             if (ret >= 0)
               {
+#ifdef CONFIG_RTC_RDTIME_CACHE
+                /* The time was stepped; invalidate the cached sample (but
+                 * keep the drift estimate, which is a hardware property).
+                 */
+
+                upper->cachevalid = false;
+#endif
+
                 /* If the RTC time was set successfully, then update the
                  * current system time to match.
                  */
@@ -0,0 +1,476 @@
+/****************************************************************************
+ * drivers/timers/timer_mux.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/timers/timer_mux.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define TIMER_START(l)           ((l)->ops->start(l))
+#define TIMER_STOP(l)            ((l)->ops->stop(l))
+#define TIMER_GETSTATUS(l,s)     ((l)->ops->getstatus(l,s))
+#define TIMER_SETTIMEOUT(l,t)    ((l)->ops->settimeout(l,t))
+#define TIMER_SETCALLBACK(l,c,a) ((l)->ops->setcallback(l,c,a))
+#define TIMER_MAXTIMEOUT(l,t)    ((l)->ops->maxtimeout(l,t))
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct timer_mux_s;
+
+/* This describes the state of one virtual timer channel */
+
+struct timer_mux_chan_s
+{
+  FAR struct timer_mux_s *mux;    /* The parent multiplexer */
+  timer_mux_handler_t handler;    /* Expiration callback */
+  FAR void *arg;                  /* Argument that accompanies the callback */
+  uint64_t deadline;              /* Absolute expiration time (microseconds) */
+  uint32_t interval;              /* Re-arm interval; zero if one-shot */
+  bool active;                    /* True: The channel is running */
+  bool inuse;                     /* True: The channel is allocated */
+};
+
+/* This describes the state of the timer multiplexer */
+
+struct timer_mux_s
+{
+  FAR struct timer_lowerhalf_s *lower;  /* The underlying hardware timer */
+  uint32_t maxtimeout;                  /* Maximum hardware timeout (usec) */
+  uint64_t timebase;                    /* Time at last re-program (usec) */
+  bool running;                         /* True: The hardware timer is on */
+  bool inisr;                           /* True: Executing the callback */
+  struct timer_mux_chan_s chans[CONFIG_TIMER_MUX_NCHANNELS];
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: timer_mux_current
+ *
+ * Description:
+ *   Return the elapsed time since the multiplexer was initialized, in
+ *   microseconds.  Must be called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+static uint64_t timer_mux_current(FAR struct timer_mux_s *mux)
+{
+  struct timer_status_s status;
+
+  if (!mux->running)
+    {
+      return mux->timebase;
+    }
+
+  TIMER_GETSTATUS(mux->lower, &status);
+  return mux->timebase + (status.timeout - status.timeleft);
+}
+
+/****************************************************************************
+ * Name: timer_mux_nearest
+ *
+ * Description:
+ *   Return the nearest deadline of all active channels, or zero if no
+ *   channel is active.  Must be called with interrupts disabled.
+ *
+ ****************************************************************************/
+
+static uint64_t timer_mux_nearest(FAR struct timer_mux_s *mux)
+{
+  FAR struct timer_mux_chan_s *chan;
+  uint64_t nearest = 0;
+  int i;
+
+  for (i = 0; i < CONFIG_TIMER_MUX_NCHANNELS; i++)
+    {
+      chan = &mux->chans[i];
+      if (chan->inuse && chan->active &&
+          (nearest == 0 || chan->deadline < nearest))
+        {
+          nearest = chan->deadline;
+        }
+    }
+
+  return nearest;
+}
+
+/****************************************************************************
+ * Name: timer_mux_delta
+ *
+ * Description:
+ *   Convert an absolute deadline into a hardware timeout measured from
+ *   'now', clamped to the range supported by the hardware timer.
+ *
+ ****************************************************************************/
+
+static uint32_t timer_mux_delta(FAR struct timer_mux_s *mux,
+                                uint64_t nearest, uint64_t now)
+{
+  uint64_t delta;
+
+  if (nearest <= now)
+    {
+      return 1;
+    }
+
+  delta = nearest - now;
+  if (delta > mux->maxtimeout)
+    {
+      delta = mux->maxtimeout;
+    }
+
+  return (uint32_t)delta;
+}
+
+/****************************************************************************
+ * Name: timer_mux_reprogram
+ *
+ * Description:
+ *   Program the hardware timer for the nearest pending deadline, or stop
+ *   it if no channel is active.  Must be called with interrupts disabled
+ *   and never from the hardware timer callback (the callback re-programs
+ *   the timer through its return value instead).
+ *
+ ****************************************************************************/
+
+static void timer_mux_reprogram(FAR struct timer_mux_s *mux, uint64_t now)
+{
+  struct timer_status_s status;
+  uint64_t nearest;
+  uint32_t delta;
+
+  nearest = timer_mux_nearest(mux);
+  if (nearest == 0)
+    {
+      if (mux->running)
+        {
+          mux->timebase = now;
+          TIMER_STOP(mux->lower);
+          mux->running = false;
+        }
+
+      return;
+    }
+
+  delta = timer_mux_delta(mux, nearest, now);
+  if (!mux->running)
+    {
+      TIMER_SETTIMEOUT(mux->lower, delta);
+      TIMER_START(mux->lower);
+      mux->running = true;
+    }
+  else
+    {
+      /* Re-program the hardware timer only if the new deadline is nearer
+       * than the pending expiration.  If it is farther, then the pending
+       * expiration will simply find no expired channel and re-program for
+       * the remaining time.
+       */
+
+      TIMER_GETSTATUS(mux->lower, &status);
+      if (delta < status.timeleft)
+        {
+          /* Re-setting the timeout restarts the hardware timer, so the
+           * time that already elapsed in the current period has to be
+           * folded into the timebase.
+           */
+
+          mux->timebase += status.timeout - status.timeleft;
+          TIMER_SETTIMEOUT(mux->lower, delta);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: timer_mux_callback
+ *
+ * Description:
+ *   Hardware timer expiration handler.  Runs every callback whose
+ *   deadline has been reached directly in interrupt context, then
+ *   re-programs the hardware timer for the nearest remaining deadline.
+ *
+ ****************************************************************************/
+
+static bool timer_mux_callback(FAR uint32_t *next_interval_us,
+                               FAR void *arg)
+{
+  FAR struct timer_mux_s *mux = (FAR struct timer_mux_s *)arg;
+  FAR struct timer_mux_chan_s *chan;
+  uint64_t nearest;
+  int i;
+
+  mux->timebase += *next_interval_us;
+
+  /* Run all expired channels.  A channel callback may re-arm its own or
+   * any other channel via timer_mux_start();  the inisr flag defers the
+   * hardware re-programming to the common path below.
+   */
+
+  mux->inisr = true;
+
+  for (i = 0; i < CONFIG_TIMER_MUX_NCHANNELS; i++)
+    {
+      chan = &mux->chans[i];
+      if (chan->inuse && chan->active && chan->deadline <= mux->timebase)
+        {
+          if (chan->interval > 0)
+            {
+              chan->deadline += chan->interval;
+            }
+          else
+            {
+              chan->active = false;
+            }
+
+          chan->handler(chan->arg);
+        }
+    }
+
+  mux->inisr = false;
+
+  /* Re-program for the nearest remaining deadline (if any) */
+
+  nearest = timer_mux_nearest(mux);
+  if (nearest == 0)
+    {
+      mux->running = false;
+      return false;
+    }
+
+  *next_interval_us = timer_mux_delta(mux, nearest, mux->timebase);
+  return true;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: timer_mux_initialize
+ *
+ * Description:
+ *   Bind a timer multiplexer to one hardware timer.
+ *
+ ****************************************************************************/
+
+FAR void *timer_mux_initialize(FAR struct timer_lowerhalf_s *lower)
+{
+  FAR struct timer_mux_s *mux;
+
+  DEBUGASSERT(lower != NULL && lower->ops != NULL);
+
+  mux = (FAR struct timer_mux_s *)
+    kmm_zalloc(sizeof(struct timer_mux_s));
+  if (mux == NULL)
+    {
+      return NULL;
+    }
+
+  mux->lower = lower;
+  TIMER_MAXTIMEOUT(lower, &mux->maxtimeout);
+  TIMER_SETCALLBACK(lower, timer_mux_callback, mux);
+  return mux;
+}
+
+/****************************************************************************
+ * Name: timer_mux_uninitialize
+ *
+ * Description:
+ *   Stop the hardware timer and free the multiplexer.
+ *
+ ****************************************************************************/
+
+void timer_mux_uninitialize(FAR void *handle)
+{
+  FAR struct timer_mux_s *mux = (FAR struct timer_mux_s *)handle;
+  irqstate_t flags;
+
+  DEBUGASSERT(mux != NULL);
+
+  flags = enter_critical_section();
+  TIMER_SETCALLBACK(mux->lower, NULL, NULL);
+  if (mux->running)
+    {
+      TIMER_STOP(mux->lower);
+      mux->running = false;
+    }
+
+  leave_critical_section(flags);
+  kmm_free(mux);
+}
+
+/****************************************************************************
+ * Name: timer_mux_setup
+ *
+ * Description:
+ *   Allocate one virtual timer channel and attach its callback.
+ *
+ ****************************************************************************/
+
+FAR void *timer_mux_setup(FAR void *handle, timer_mux_handler_t handler,
+                          FAR void *arg)
+{
+  FAR struct timer_mux_s *mux = (FAR struct timer_mux_s *)handle;
+  FAR struct timer_mux_chan_s *chan = NULL;
+  irqstate_t flags;
+  int i;
+
+  DEBUGASSERT(mux != NULL && handler != NULL);
+
+  flags = enter_critical_section();
+  for (i = 0; i < CONFIG_TIMER_MUX_NCHANNELS; i++)
+    {
+      if (!mux->chans[i].inuse)
+        {
+          chan          = &mux->chans[i];
+          chan->mux     = mux;
+          chan->handler = handler;
+          chan->arg     = arg;
+          chan->active  = false;
+          chan->inuse   = true;
+          break;
+        }
+    }
+
+  leave_critical_section(flags);
+  return chan;
+}
+
+/****************************************************************************
+ * Name: timer_mux_start
+ *
+ * Description:
+ *   Start (or re-start) a virtual timer channel.
+ *
+ ****************************************************************************/
+
+int timer_mux_start(FAR void *handle, uint32_t timeout, bool periodic)
+{
+  FAR struct timer_mux_chan_s *chan =
+    (FAR struct timer_mux_chan_s *)handle;
+  FAR struct timer_mux_s *mux;
+  irqstate_t flags;
+  uint64_t now;
+
+  DEBUGASSERT(chan != NULL && chan->inuse);
+
+  if (timeout == 0)
+    {
+      return -EINVAL;
+    }
+
+  mux = chan->mux;
+
+  flags = enter_critical_section();
+  now = timer_mux_current(mux);
+
+  chan->deadline = now + timeout;
+  chan->interval = periodic ? timeout : 0;
+  chan->active   = true;
+
+  /* If this is called from a channel callback, then the expiration
+   * handler will pick up the new deadline when it re-programs the
+   * hardware timer on return.
+   */
+
+  if (!mux->inisr)
+    {
+      timer_mux_reprogram(mux, now);
+    }
+
+  leave_critical_section(flags);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: timer_mux_stop
+ *
+ * Description:
+ *   Stop a virtual timer channel.
+ *
+ ****************************************************************************/
+
+int timer_mux_stop(FAR void *handle)
+{
+  FAR struct timer_mux_chan_s *chan =
+    (FAR struct timer_mux_chan_s *)handle;
+  FAR struct timer_mux_s *mux;
+  irqstate_t flags;
+
+  DEBUGASSERT(chan != NULL && chan->inuse);
+
+  mux = chan->mux;
+
+  flags = enter_critical_section();
+  chan->active = false;
+
+  /* Stop the hardware timer if no active channel remains.  There is no
+   * need to re-program it for a farther deadline:  a premature expiration
+   * is harmless.
+   */
+
+  if (!mux->inisr && timer_mux_nearest(mux) == 0)
+    {
+      timer_mux_reprogram(mux, timer_mux_current(mux));
+    }
+
+  leave_critical_section(flags);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: timer_mux_release
+ *
+ * Description:
+ *   Stop a virtual timer channel and return it to the available pool.
+ *
+ ****************************************************************************/
+
+void timer_mux_release(FAR void *handle)
+{
+  FAR struct timer_mux_chan_s *chan =
+    (FAR struct timer_mux_chan_s *)handle;
+  irqstate_t flags;
+
+  timer_mux_stop(handle);
+
+  flags = enter_critical_section();
+  chan->inuse = false;
+  leave_critical_section(flags);
+}
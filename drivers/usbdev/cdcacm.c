@@ -384,6 +384,10 @@ static int cdcacm_sndpacket(FAR struct cdcacm_dev_s *priv)
   FAR struct usbdev_ep_s *ep;
   FAR struct usbdev_req_s *req;
   FAR struct cdcacm_wrreq_s *wrcontainer;
+#ifdef CONFIG_CDCACM_TXCOMBINE
+  FAR struct uart_buffer_s *xmit;
+  int navail;
+#endif
   uint16_t reqlen;
   irqstate_t flags;
   int len;
@@ -418,6 +422,31 @@ static int cdcacm_sndpacket(FAR struct cdcacm_dev_s *priv)
 
   while (!sq_empty(&priv->txfree))
     {
+#ifdef CONFIG_CDCACM_TXCOMBINE
+      /* If fewer bytes are buffered than fit in one full packet and other
+       * write requests are still in flight, then hold the data back so
+       * that it can be combined with data from subsequent writes.  The
+       * completion of an in-flight request will re-enter this function,
+       * by which time more TX data may have accumulated; the completion
+       * of the last in-flight request flushes any partial packet.
+       */
+
+      if (priv->nwrq < CONFIG_CDCACM_NWRREQS)
+        {
+          xmit   = &priv->serdev.xmit;
+          navail = xmit->head - xmit->tail;
+          if (navail < 0)
+            {
+              navail += xmit->size;
+            }
+
+          if (navail < ep->maxpacket)
+            {
+              break;
+            }
+        }
+#endif
+
       /* Peek at the request in the container at the head of the list */
 
       wrcontainer = (FAR struct cdcacm_wrreq_s *)sq_peek(&priv->txfree);
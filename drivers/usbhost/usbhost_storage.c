@@ -40,6 +40,7 @@
 #include <nuttx/scsi.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/semaphore.h>
+#include <nuttx/drivers/rwbuffer.h>
 
 #include <nuttx/usb/usb.h>
 #include <nuttx/usb/usbhost.h>
@@ -95,6 +96,18 @@
 #define USBHOST_MAX_RETRIES 100        /* Give up after 5 seconds */
 #define USBHOST_MAX_CREFS   INT16_MAX  /* Max cref count before signed overflow */
 
+/* The size of the read-ahead buffer and of the write buffer in blocks.
+ * Buffering pays off on USB mass storage because the CBW/data/CSW sequence
+ * of the Bulk-Only Transport has a large fixed cost per command; reading
+ * ahead turns many small sequential commands into a few large ones.
+ */
+
+#if defined(CONFIG_DRVR_WRITEBUFFER) || defined(CONFIG_DRVR_READAHEAD)
+#  ifndef CONFIG_USBHOST_MSC_RWBLOCKS
+#    define CONFIG_USBHOST_MSC_RWBLOCKS 16
+#  endif
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -123,6 +136,9 @@ struct usbhost_state_s
   size_t                  tbuflen;      /* Size of the allocated transfer buffer */
   usbhost_ep_t            bulkin;       /* Bulk IN endpoint */
   usbhost_ep_t            bulkout;      /* Bulk OUT endpoint */
+#if defined(CONFIG_DRVR_WRITEBUFFER) || defined(CONFIG_DRVR_READAHEAD)
+  struct rwbuffer_s       rwbuffer;     /* Read-ahead/write buffer support */
+#endif
 };
 
 /* This is how struct usbhost_state_s looks to the free list logic */
@@ -226,6 +242,24 @@ static int usbhost_connect(FAR struct usbhost_class_s *usbclass,
                            FAR const uint8_t *configdesc, int desclen);
 static int usbhost_disconnected(FAR struct usbhost_class_s *usbclass);
 
+/* Transfer helpers */
+
+static ssize_t usbhost_readsectors(FAR struct usbhost_state_s *priv,
+                                   FAR uint8_t *buffer, size_t startsector,
+                                   unsigned int nsectors);
+static ssize_t usbhost_writesectors(FAR struct usbhost_state_s *priv,
+                                    FAR const uint8_t *buffer,
+                                    size_t startsector,
+                                    unsigned int nsectors);
+#ifdef CONFIG_DRVR_READAHEAD
+static ssize_t usbhost_reload(FAR void *dev, FAR uint8_t *buffer,
+                              off_t startblock, size_t nblocks);
+#endif
+#ifdef CONFIG_DRVR_WRITEBUFFER
+static ssize_t usbhost_flush(FAR void *dev, FAR const uint8_t *buffer,
+                             off_t startblock, size_t nblocks);
+#endif
+
 /* struct block_operations methods */
 
 static int usbhost_open(FAR struct inode *inode);
@@ -941,6 +975,14 @@ static void usbhost_destroy(FAR void *arg)
   usbhost_mkdevname(priv, devname);
   unregister_blockdriver(devname);
 
+#if defined(CONFIG_DRVR_WRITEBUFFER) || defined(CONFIG_DRVR_READAHEAD)
+  /* Release the read-ahead and write buffers.  Any dirty write buffer
+   * content cannot be flushed because the device has been disconnected.
+   */
+
+  rwb_uninitialize(&priv->rwbuffer);
+#endif
+
   /* Release the device name used by this connection */
 
   usbhost_freedevno(priv);
@@ -1361,6 +1403,32 @@ static inline int usbhost_initvolume(FAR struct usbhost_state_s *priv)
         }
     }
 
+#if defined(CONFIG_DRVR_WRITEBUFFER) || defined(CONFIG_DRVR_READAHEAD)
+  /* Set up the read-ahead and write buffering */
+
+  if (ret >= 0)
+    {
+      priv->rwbuffer.blocksize     = priv->blocksize;
+      priv->rwbuffer.nblocks       = priv->nblocks;
+      priv->rwbuffer.dev           = priv;
+#ifdef CONFIG_DRVR_WRITEBUFFER
+      priv->rwbuffer.wrmaxblocks   = CONFIG_USBHOST_MSC_RWBLOCKS;
+      priv->rwbuffer.wralignblocks = 0;
+      priv->rwbuffer.wrflush       = usbhost_flush;
+#endif
+#ifdef CONFIG_DRVR_READAHEAD
+      priv->rwbuffer.rhmaxblocks   = CONFIG_USBHOST_MSC_RWBLOCKS;
+      priv->rwbuffer.rhreload      = usbhost_reload;
+#endif
+
+      ret = rwb_initialize(&priv->rwbuffer);
+      if (ret < 0)
+        {
+          uerr("ERROR: rwb_initialize() failed: %d\n", ret);
+        }
+    }
+#endif
+
   /* Register the block driver */
 
   if (ret >= 0)
@@ -2015,25 +2083,22 @@ static int usbhost_close(FAR struct inode *inode)
 }
 
 /****************************************************************************
- * Name: usbhost_read
+ * Name: usbhost_readsectors
  *
  * Description:
- *   Read the specified number of sectors from the read-ahead buffer or from
- *   the physical device.
+ *   Read the specified number of sectors from the physical device using
+ *   one READ(10) command.
  *
  ****************************************************************************/
 
-static ssize_t usbhost_read(FAR struct inode *inode, unsigned char *buffer,
-                            size_t startsector, unsigned int nsectors)
+static ssize_t usbhost_readsectors(FAR struct usbhost_state_s *priv,
+                                   FAR uint8_t *buffer, size_t startsector,
+                                   unsigned int nsectors)
 {
-  FAR struct usbhost_state_s *priv;
   FAR struct usbhost_hubport_s *hport;
   ssize_t nbytes = 0;
   int ret;
 
-  DEBUGASSERT(inode && inode->i_private);
-  priv = (FAR struct usbhost_state_s *)inode->i_private;
-
   DEBUGASSERT(priv->usbclass.hport);
   hport = priv->usbclass.hport;
 
@@ -2127,28 +2192,71 @@ static ssize_t usbhost_read(FAR struct inode *inode, unsigned char *buffer,
 }
 
 /****************************************************************************
- * Name: usbhost_write
+ * Name: usbhost_reload
  *
  * Description:
- *   Write the specified number of sectors to the write buffer or to the
- *   physical device.
+ *   Reload the specified number of sectors from the physical device into
+ *   the read-ahead buffer.
  *
  ****************************************************************************/
 
-static ssize_t usbhost_write(FAR struct inode *inode,
-                             FAR const unsigned char *buffer,
-                             size_t startsector, unsigned int nsectors)
+#ifdef CONFIG_DRVR_READAHEAD
+static ssize_t usbhost_reload(FAR void *dev, FAR uint8_t *buffer,
+                              off_t startblock, size_t nblocks)
+{
+  FAR struct usbhost_state_s *priv = (FAR struct usbhost_state_s *)dev;
+
+  DEBUGASSERT(priv != NULL && buffer != NULL && nblocks > 0);
+  return usbhost_readsectors(priv, buffer, startblock, nblocks);
+}
+#endif
+
+/****************************************************************************
+ * Name: usbhost_read
+ *
+ * Description:
+ *   Read the specified number of sectors from the read-ahead buffer or from
+ *   the physical device.
+ *
+ ****************************************************************************/
+
+static ssize_t usbhost_read(FAR struct inode *inode, unsigned char *buffer,
+                            size_t startsector, unsigned int nsectors)
 {
   FAR struct usbhost_state_s *priv;
+
+  DEBUGASSERT(inode && inode->i_private);
+  priv = (FAR struct usbhost_state_s *)inode->i_private;
+
+#ifdef CONFIG_DRVR_READAHEAD
+  /* Get the data from the read-ahead buffer */
+
+  return rwb_read(&priv->rwbuffer, startsector, nsectors, buffer);
+#else
+  return usbhost_readsectors(priv, buffer, startsector, nsectors);
+#endif
+}
+
+/****************************************************************************
+ * Name: usbhost_writesectors
+ *
+ * Description:
+ *   Write the specified number of sectors to the physical device using one
+ *   WRITE(10) command.
+ *
+ ****************************************************************************/
+
+static ssize_t usbhost_writesectors(FAR struct usbhost_state_s *priv,
+                                    FAR const uint8_t *buffer,
+                                    size_t startsector,
+                                    unsigned int nsectors)
+{
   FAR struct usbhost_hubport_s *hport;
   ssize_t nbytes;
   int ret;
 
   uinfo("sector: %zu nsectors: %u\n", startsector, nsectors);
 
-  DEBUGASSERT(inode && inode->i_private);
-  priv = (FAR struct usbhost_state_s *)inode->i_private;
-
   DEBUGASSERT(priv->usbclass.hport);
   hport = priv->usbclass.hport;
 
@@ -2229,6 +2337,53 @@ static ssize_t usbhost_write(FAR struct inode *inode,
   return nbytes < 0 ? (int)nbytes : nsectors;
 }
 
+/****************************************************************************
+ * Name: usbhost_flush
+ *
+ * Description:
+ *   Flush the specified number of sectors from the write buffer to the
+ *   physical device.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DRVR_WRITEBUFFER
+static ssize_t usbhost_flush(FAR void *dev, FAR const uint8_t *buffer,
+                             off_t startblock, size_t nblocks)
+{
+  FAR struct usbhost_state_s *priv = (FAR struct usbhost_state_s *)dev;
+
+  DEBUGASSERT(priv != NULL && buffer != NULL && nblocks > 0);
+  return usbhost_writesectors(priv, buffer, startblock, nblocks);
+}
+#endif
+
+/****************************************************************************
+ * Name: usbhost_write
+ *
+ * Description:
+ *   Write the specified number of sectors to the write buffer or to the
+ *   physical device.
+ *
+ ****************************************************************************/
+
+static ssize_t usbhost_write(FAR struct inode *inode,
+                             FAR const unsigned char *buffer,
+                             size_t startsector, unsigned int nsectors)
+{
+  FAR struct usbhost_state_s *priv;
+
+  DEBUGASSERT(inode && inode->i_private);
+  priv = (FAR struct usbhost_state_s *)inode->i_private;
+
+#ifdef CONFIG_DRVR_WRITEBUFFER
+  /* Write the data to the write buffer */
+
+  return rwb_write(&priv->rwbuffer, startsector, nsectors, buffer);
+#else
+  return usbhost_writesectors(priv, buffer, startsector, nsectors);
+#endif
+}
+
 /****************************************************************************
  * Name: usbhost_geometry
  *
@@ -50,6 +50,9 @@
 #include <nuttx/arch.h>
 #include <nuttx/board.h>
 #include <nuttx/kmalloc.h>
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+#include <nuttx/mm/dma.h>
+#endif
 
 #include <arch/board/board.h>
 
@@ -135,6 +138,13 @@ struct video_type_inf_s
   int32_t              remaining_capnum;
   video_wait_dma_t     wait_dma;
   video_framebuff_t    bufinf;
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+  FAR struct dma_pool_s *pool;        /* DMA pool (V4L2_MEMORY_MMAP) */
+  FAR uint8_t          *poolmem;      /* The memory backing the pool */
+  FAR unsigned long    *pooladdrs;    /* Buffer address of each index */
+  uint32_t             poolbufsize;   /* The size of each pool buffer */
+  uint16_t             poolcount;     /* The number of pool buffers */
+#endif
 };
 
 typedef struct video_type_inf_s video_type_inf_t;
@@ -179,6 +189,12 @@ static bool is_taking_still_picture(FAR video_mng_t *vmng);
 static bool is_bufsize_sufficient(FAR video_mng_t *vmng, uint32_t bufsize);
 static void cleanup_resources(FAR video_mng_t *vmng);
 static bool is_sem_waited(FAR sem_t *sem);
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+static void video_freepool(FAR video_type_inf_t *type_inf);
+static int video_createpool(FAR video_type_inf_t *type_inf,
+                            FAR const char *name,
+                            uint32_t bufsize);
+#endif
 
 /* internal function for each cmds of ioctl */
 
@@ -186,6 +202,10 @@ static int video_reqbufs(FAR struct video_mng_s *vmng,
                          FAR struct v4l2_requestbuffers *reqbufs);
 static int video_qbuf(FAR struct video_mng_s *vmng,
                       FAR struct v4l2_buffer *buf);
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+static int video_querybuf(FAR struct video_mng_s *vmng,
+                          FAR struct v4l2_buffer *buf);
+#endif
 static int video_dqbuf(FAR struct video_mng_s *vmng,
                        FAR struct v4l2_buffer *buf);
 static int video_cancel_dqbuf(FAR struct video_mng_s *vmng,
@@ -403,6 +423,111 @@ static bool is_bufsize_sufficient(FAR video_mng_t *vmng, uint32_t bufsize)
   return true;
 }
 
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+static void video_freepool(FAR video_type_inf_t *type_inf)
+{
+  int i;
+
+  if (type_inf->pool != NULL)
+    {
+      for (i = 0; i < type_inf->poolcount; i++)
+        {
+          if (type_inf->pooladdrs[i] != 0)
+            {
+              dma_free(type_inf->pool,
+                       (FAR void *)type_inf->pooladdrs[i],
+                       type_inf->poolbufsize);
+            }
+        }
+
+      dma_pool_release(type_inf->pool);
+      type_inf->pool = NULL;
+    }
+
+  if (type_inf->pooladdrs != NULL)
+    {
+      kmm_free(type_inf->pooladdrs);
+      type_inf->pooladdrs = NULL;
+    }
+
+  if (type_inf->poolmem != NULL)
+    {
+      kmm_free(type_inf->poolmem);
+      type_inf->poolmem = NULL;
+    }
+
+  type_inf->poolbufsize = 0;
+  type_inf->poolcount   = 0;
+
+  return;
+}
+
+static int video_createpool(FAR video_type_inf_t *type_inf,
+                            FAR const char *name,
+                            uint32_t bufsize)
+{
+  uint8_t log2gran;
+  size_t  gransize;
+  size_t  padded;
+  int     i;
+
+  /* Pick the granule size:  At least one data cache line so that all
+   * buffers are cache maintenance safe, and large enough that one frame
+   * buffer fits into the granule allocator's limit of 32 granules per
+   * allocation.
+   */
+
+  log2gran = CONFIG_MM_DMA_CACHELINE_LOG2;
+  while (((bufsize + ((uint32_t)1 << log2gran) - 1) >> log2gran) > 32)
+    {
+      log2gran++;
+    }
+
+  gransize = (size_t)1 << log2gran;
+  padded   = ((size_t)bufsize + gransize - 1) & ~(gransize - 1);
+
+  type_inf->poolmem = (FAR uint8_t *)
+    kmm_memalign(gransize, padded * type_inf->poolcount);
+  if (type_inf->poolmem == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  type_inf->pooladdrs = (FAR unsigned long *)
+    kmm_zalloc(type_inf->poolcount * sizeof(unsigned long));
+  if (type_inf->pooladdrs == NULL)
+    {
+      video_freepool(type_inf);
+      return -ENOMEM;
+    }
+
+  type_inf->pool = dma_pool_initialize(name,
+                                       type_inf->poolmem,
+                                       padded * type_inf->poolcount,
+                                       log2gran);
+  if (type_inf->pool == NULL)
+    {
+      video_freepool(type_inf);
+      return -ENOMEM;
+    }
+
+  type_inf->poolbufsize = bufsize;
+
+  for (i = 0; i < type_inf->poolcount; i++)
+    {
+      type_inf->pooladdrs[i] = (unsigned long)
+        (uintptr_t)dma_alloc(type_inf->pool, bufsize);
+      if (type_inf->pooladdrs[i] == 0)
+        {
+          video_freepool(type_inf);
+          return -ENOMEM;
+        }
+    }
+
+  return OK;
+}
+#endif /* CONFIG_VIDEO_STREAM_BUFPOOL */
+
 static void initialize_streamresources(FAR video_type_inf_t *type_inf)
 {
   memset(type_inf, 0, sizeof(video_type_inf_t));
@@ -424,6 +549,9 @@ static void initialize_resources(FAR video_mng_t *vmng)
 
 static void cleanup_streamresources(FAR video_type_inf_t *type_inf)
 {
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+  video_freepool(type_inf);
+#endif
   video_framebuff_uninit(&type_inf->bufinf);
   nxsem_destroy(&type_inf->wait_dma.dqbuf_wait_flg);
   nxsem_destroy(&type_inf->lock_state);
@@ -558,9 +686,85 @@ static int video_reqbufs(FAR struct video_mng_s         *vmng,
 
   leave_critical_section(flags);
 
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+  if (ret == OK)
+    {
+      /* Any driver-allocated buffers from a previous REQBUFS are stale.
+       * In the V4L2_MEMORY_MMAP case the new pool is not created until
+       * the first QUERYBUF provides the buffer size.
+       */
+
+      video_freepool(type_inf);
+
+      if (reqbufs->memory == V4L2_MEMORY_MMAP)
+        {
+          type_inf->poolcount =
+            (reqbufs->count > V4L2_REQBUFS_COUNT_MAX) ?
+             V4L2_REQBUFS_COUNT_MAX : reqbufs->count;
+        }
+    }
+#endif
+
   return ret;
 }
 
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+static int video_querybuf(FAR struct video_mng_s *vmng,
+                          FAR struct v4l2_buffer *buf)
+{
+  FAR video_type_inf_t *type_inf;
+  FAR const char       *name;
+  int                  ret;
+
+  if ((vmng == NULL) || (buf == NULL))
+    {
+      return -EINVAL;
+    }
+
+  type_inf = get_video_type_inf(vmng, buf->type);
+  if (type_inf == NULL)
+    {
+      return -EINVAL;
+    }
+
+  if ((buf->memory != V4L2_MEMORY_MMAP) ||
+      (buf->index >= type_inf->poolcount))
+    {
+      return -EINVAL;
+    }
+
+  if (type_inf->pool == NULL)
+    {
+      /* First QUERYBUF after REQBUFS:  The requested length sizes all
+       * of the buffers in the pool.
+       */
+
+      if (buf->length == 0)
+        {
+          return -EINVAL;
+        }
+
+      name = (buf->type == V4L2_BUF_TYPE_VIDEO_CAPTURE) ?
+             "video" : "video.still";
+
+      ret = video_createpool(type_inf, name, buf->length);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+  else if (buf->length > type_inf->poolbufsize)
+    {
+      return -EINVAL;
+    }
+
+  buf->m.userptr = type_inf->pooladdrs[buf->index];
+  buf->length    = type_inf->poolbufsize;
+
+  return OK;
+}
+#endif /* CONFIG_VIDEO_STREAM_BUFPOOL */
+
 static int video_qbuf(FAR struct video_mng_s *vmng,
                       FAR struct v4l2_buffer *buf)
 {
@@ -1252,6 +1456,13 @@ static int video_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 
         break;
 
+#ifdef CONFIG_VIDEO_STREAM_BUFPOOL
+      case VIDIOC_QUERYBUF:
+        ret = video_querybuf(priv, (FAR struct v4l2_buffer *)arg);
+
+        break;
+
+#endif
       case VIDIOC_DQBUF:
         ret = video_dqbuf(priv, (FAR struct v4l2_buffer *)arg);
 
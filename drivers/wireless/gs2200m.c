@@ -173,6 +173,7 @@ struct pkt_ctx_s
   enum pkt_state_e state;
   FAR uint8_t      *ptr;
   FAR uint8_t      *head;
+  FAR uint8_t      *end;
   char             cid;
   uint16_t         dlen;
 };
@@ -201,6 +202,7 @@ struct gs2200m_dev_s
   uint16_t             aip_cid_bits;
   uint32_t             total_bulk;
   uint8_t              tx_buff[MAX_PKT_LEN];
+  uint8_t              rx_buff[MAX_PKT_LEN];
   struct net_driver_s  net_dev;
   uint8_t              op_mode;
   FAR const struct gs2200m_lower_s *lower;
@@ -258,6 +260,13 @@ static struct evt_code_s _evt_table[] =
   {"Serial2WiFi APP", TYPE_BOOT_MSG}
 };
 
+/* Idle characters clocked out during bulk reads (see 3.2.2.1 SPI Byte
+ * Stuffing).  A full-length pattern lets the SPI driver run the whole
+ * exchange as one DMA transfer.  Initialized in gs2200m_register().
+ */
+
+static uint8_t g_idle_pattern[MAX_PKT_LEN];
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -459,14 +468,16 @@ static char _notif_q_pop(FAR struct gs2200m_dev_s *dev)
 }
 
 /****************************************************************************
- * Name: _push_data_to_pkt
+ * Name: _push_span_to_pkt
  ****************************************************************************/
 
-static void _push_data_to_pkt(struct pkt_dat_s *pkt, uint8_t data)
+static void _push_span_to_pkt(struct pkt_dat_s *pkt,
+                              FAR const uint8_t *data, uint16_t n)
 {
-  ASSERT(pkt->len < MAX_PKT_LEN);
+  ASSERT(pkt->len + n <= MAX_PKT_LEN);
 
-  pkt->data[pkt->len++] = data;
+  memcpy(&pkt->data[pkt->len], data, n);
+  pkt->len   += n;
   pkt->remain = pkt->len;
 }
 
@@ -849,12 +860,17 @@ static void _read_data(FAR struct gs2200m_dev_s *dev,
                        FAR uint8_t  *buff,
                        FAR uint16_t len)
 {
-  uint8_t req = 0xf5; /* idle character */
+  DEBUGASSERT(len <= MAX_PKT_LEN);
 
   memset(buff, 0, len);
 
+  /* NOTE: a full-length buffer of idle characters is clocked out so
+   * that the transfer can be handed to a DMA capable SPI driver as a
+   * single bulk exchange.
+   */
+
   SPI_SELECT(dev->spi, SPIDEV_WIRELESS(0), true);
-  SPI_EXCHANGE(dev->spi, &req, buff, len);
+  SPI_EXCHANGE(dev->spi, g_idle_pattern, buff, len);
   SPI_SELECT(dev->spi, SPIDEV_WIRELESS(0), false);
 }
 
@@ -1266,9 +1282,23 @@ static void _parse_pkt_in_s3(FAR struct pkt_ctx_s *pkt_ctx,
     }
   else
     {
-      _push_data_to_pkt(pkt_dat, *(pkt_ctx->ptr));
+      /* Copy the whole span that is available in the buffer in one
+       * operation instead of one byte per state machine step.
+       */
+
+      uint16_t span = pkt_ctx->end - pkt_ctx->ptr;
+
+      if (span > pkt_ctx->dlen)
+        {
+          span = pkt_ctx->dlen;
+        }
+
+      _push_span_to_pkt(pkt_dat, pkt_ctx->ptr, span);
+
+      /* NOTE: the last byte is consumed by the parse loop increment */
 
-      pkt_ctx->dlen--;
+      pkt_ctx->ptr  += span - 1;
+      pkt_ctx->dlen -= span;
 
       if (0 == pkt_ctx->dlen)
         {
@@ -1333,9 +1363,23 @@ static void _parse_pkt_in_s4(FAR struct pkt_ctx_s *pkt_ctx,
     }
   else
     {
-      _push_data_to_pkt(pkt_dat, *(pkt_ctx->ptr));
+      /* Copy the whole span that is available in the buffer in one
+       * operation instead of one byte per state machine step.
+       */
+
+      uint16_t span = pkt_ctx->end - pkt_ctx->ptr;
+
+      if (span > pkt_ctx->dlen)
+        {
+          span = pkt_ctx->dlen;
+        }
+
+      _push_span_to_pkt(pkt_dat, pkt_ctx->ptr, span);
 
-      pkt_ctx->dlen--;
+      /* NOTE: the last byte is consumed by the parse loop increment */
+
+      pkt_ctx->ptr  += span - 1;
+      pkt_ctx->dlen -= span;
 
       if (0 == pkt_ctx->dlen)
         {
@@ -1359,6 +1403,7 @@ static enum pkt_type_e _parse_pkt(FAR uint8_t *p, uint16_t len,
   pkt_ctx.type  = TYPE_UNMATCH;
   pkt_ctx.state = PKT_START;
   pkt_ctx.head  = NULL;
+  pkt_ctx.end   = p + len;
   pkt_ctx.cid   = 'z';
   pkt_ctx.dlen  = 0;
 
@@ -1456,8 +1501,12 @@ static enum pkt_type_e gs2200m_recv_pkt(FAR struct gs2200m_dev_s *dev,
   uint16_t len;
   uint8_t *p;
 
-  p = (uint8_t *)kmm_calloc(MAX_PKT_LEN, 1);
-  ASSERT(p);
+  /* NOTE: the preallocated RX buffer is reused for every packet.  The
+   * caller already holds the device lock, and _read_data() clears the
+   * bytes it is about to fill.
+   */
+
+  p = dev->rx_buff;
 
   s = gs2200m_hal_read(dev, p, &len);
   t = _spi_err_to_pkt_type(s);
@@ -1497,7 +1546,6 @@ static enum pkt_type_e gs2200m_recv_pkt(FAR struct gs2200m_dev_s *dev,
     }
 
 errout:
-  kmm_free(p);
   return t;
 }
 
@@ -3468,6 +3516,10 @@ FAR void *gs2200m_register(FAR const char *devpath,
 
   memset(dev, 0, size);
 
+  /* Fill the idle pattern clocked out during bulk reads */
+
+  memset(g_idle_pattern, 0xf5, sizeof(g_idle_pattern));
+
   dev->spi   = spi;
   dev->path  = strdup(devpath);
   dev->lower = lower;
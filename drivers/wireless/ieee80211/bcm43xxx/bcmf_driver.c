@@ -439,10 +439,19 @@ int bcmf_driver_initialize(FAR struct bcmf_dev_s *priv)
     }
 #endif
 
+#ifdef CONFIG_IEEE80211_BROADCOM_SDIO_AGG
+  /* Enable TX Gloming so that the chip aggregates several received
+   * frames into one superframe per SDIO transaction
+   */
+
+  out_len = 4;
+  *(FAR uint32_t *)tmp_buf = 1;
+#else
   /* Disable TX Gloming feature */
 
   out_len = 4;
   *(FAR uint32_t *)tmp_buf = 0;
+#endif
   ret = bcmf_cdc_iovar_request(priv, interface, true,
                                IOVAR_STR_TX_GLOM, tmp_buf,
                                &out_len);
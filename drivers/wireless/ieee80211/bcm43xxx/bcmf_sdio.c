@@ -832,6 +832,10 @@ int bcmf_sdio_thread(int argc, char **argv)
   FAR struct bcmf_dev_s *priv = g_sdio_priv;
   FAR struct bcmf_sdio_dev_s *sbus = (FAR struct bcmf_sdio_dev_s *)priv->bus;
   int ret;
+#if CONFIG_IEEE80211_BROADCOM_SDIO_HOLDOFF_MS > 0
+  bool busy = false;
+  bool polled;
+#endif
 
   wlinfo(" Enter\n");
 
@@ -843,12 +847,44 @@ int bcmf_sdio_thread(int argc, char **argv)
     {
       /* Wait for event (device interrupt, user request or waitdog timer) */
 
+#if CONFIG_IEEE80211_BROADCOM_SDIO_HOLDOFF_MS > 0
+      polled = false;
+      if (busy)
+        {
+          /* Traffic was serviced in the previous pass:  Hold off and poll
+           * the device again instead of waiting for the next per-frame
+           * interrupt, so that several frames accumulate and are serviced
+           * in one pass.
+           */
+
+          ret = nxsem_tickwait(&sbus->thread_signal, clock_systime_ticks(),
+                     MSEC2TICK(CONFIG_IEEE80211_BROADCOM_SDIO_HOLDOFF_MS));
+          if (ret == -ETIMEDOUT)
+            {
+              polled = true;
+              ret = OK;
+            }
+        }
+      else
+        {
+          ret = nxsem_wait(&sbus->thread_signal);
+        }
+
+      if (ret < 0)
+        {
+          wlerr("Error while waiting for semaphore\n");
+          break;
+        }
+
+      busy = false;
+#else
       ret = nxsem_wait(&sbus->thread_signal);
       if (ret < 0)
         {
           wlerr("Error while waiting for semaphore\n");
           break;
         }
+#endif
 
       /* Restart the waitdog timer */
 
@@ -859,7 +895,11 @@ int bcmf_sdio_thread(int argc, char **argv)
 
       bcmf_sdio_bus_sleep(sbus, false);
 
+#if CONFIG_IEEE80211_BROADCOM_SDIO_HOLDOFF_MS > 0
+      if (sbus->irq_pending || polled)
+#else
       if (sbus->irq_pending)
+#endif
         {
           /* Woken up by interrupt, read device status */
 
@@ -885,6 +925,12 @@ int bcmf_sdio_thread(int argc, char **argv)
           do
             {
               ret = bcmf_sdpcm_readframe(priv);
+#if CONFIG_IEEE80211_BROADCOM_SDIO_HOLDOFF_MS > 0
+              if (ret == OK)
+                {
+                  busy = true;
+                }
+#endif
             }
           while (ret == OK);
 
@@ -901,6 +947,12 @@ int bcmf_sdio_thread(int argc, char **argv)
       do
         {
           ret = bcmf_sdpcm_sendframe(priv);
+#if CONFIG_IEEE80211_BROADCOM_SDIO_HOLDOFF_MS > 0
+          if (ret == OK)
+            {
+              busy = true;
+            }
+#endif
         }
       while (ret == OK);
 
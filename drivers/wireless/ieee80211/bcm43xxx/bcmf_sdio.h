@@ -116,6 +116,11 @@ struct bcmf_sdio_dev_s
   uint8_t tx_seq;                  /* Transmit sequence number (next) */
   uint8_t rx_seq;                  /* Receive sequence number (expected) */
 
+#ifdef CONFIG_IEEE80211_BROADCOM_SDIO_AGG
+  uint16_t rx_nextlen;             /* Advertised length of the next RX
+                                    * frame (16-byte units) */
+#endif
+
   sem_t queue_mutex;               /* Lock for TX/RX/free queues */
   dq_queue_t free_queue;           /* Queue of available frames */
   dq_queue_t tx_queue;             /* Queue of frames to transmit */
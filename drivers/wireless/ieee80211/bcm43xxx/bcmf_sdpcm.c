@@ -68,6 +68,7 @@
 #define SDPCM_CONTROL_CHANNEL 0  /* Control frame id */
 #define SDPCM_EVENT_CHANNEL   1  /* Asynchronous event frame id */
 #define SDPCM_DATA_CHANNEL    2  /* Data frame id */
+#define SDPCM_GLOM_CHANNEL    3  /* Superframe of glommed frames */
 
 /****************************************************************************
  * Private Types
@@ -95,6 +96,14 @@ static int bcmf_sdpcm_rxfail(FAR struct bcmf_sdio_dev_s *sbus, bool retry);
 static int bcmf_sdpcm_process_header(FAR struct bcmf_sdio_dev_s *sbus,
                               struct bcmf_sdpcm_header *header);
 
+static int bcmf_sdpcm_dispatch(FAR struct bcmf_dev_s *priv,
+                               struct bcmf_sdio_frame *sframe);
+
+#ifdef CONFIG_IEEE80211_BROADCOM_SDIO_AGG
+static int bcmf_sdpcm_process_glom(FAR struct bcmf_dev_s *priv,
+                                   struct bcmf_sdio_frame *sframe);
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -143,6 +152,126 @@ int bcmf_sdpcm_process_header(FAR struct bcmf_sdio_dev_s *sbus,
   return OK;
 }
 
+/* Hand a complete, validated frame to the layer that consumes its channel.
+ * The frame is freed here except for data frames, which stay queued until
+ * the network layer collects them.
+ */
+
+static int bcmf_sdpcm_dispatch(FAR struct bcmf_dev_s *priv,
+                               struct bcmf_sdio_frame *sframe)
+{
+  FAR struct bcmf_sdio_dev_s *sbus = (FAR struct bcmf_sdio_dev_s *)priv->bus;
+  struct bcmf_sdpcm_header *header =
+    (struct bcmf_sdpcm_header *)sframe->header.base;
+  int ret;
+
+  switch (header->channel & 0x0f)
+    {
+      case SDPCM_CONTROL_CHANNEL:
+        ret = bcmf_cdc_process_control_frame(priv, &sframe->header);
+        break;
+
+      case SDPCM_EVENT_CHANNEL:
+        if (header->data_offset == header->size)
+          {
+            /* Empty event, ignore */
+
+            ret = OK;
+          }
+        else
+          {
+            ret = bcmf_bdc_process_event_frame(priv, &sframe->header);
+          }
+
+        break;
+
+      case SDPCM_DATA_CHANNEL:
+
+        /* Queue frame and notify network layer frame is available */
+
+        if (nxsem_wait(&sbus->queue_mutex) < 0)
+          {
+            DEBUGPANIC();
+          }
+
+        bcmf_dqueue_push(&sbus->rx_queue, &sframe->list_entry);
+        nxsem_post(&sbus->queue_mutex);
+
+        bcmf_netdev_notify_rx(priv);
+
+        /* Upper layer have to free all received frames */
+
+        return OK;
+
+      default:
+        wlerr("Got unexpected message type %d\n", header->channel);
+        ret = -EINVAL;
+        break;
+    }
+
+  bcmf_sdio_free_frame(priv, sframe);
+  return ret;
+}
+
+#ifdef CONFIG_IEEE80211_BROADCOM_SDIO_AGG
+/* Split a glom superframe into its subframes.  Each subframe carries its
+ * own sdpcm header and is copied into a pool frame of its own before it
+ * is dispatched:  The copy is much cheaper than the SDIO transaction and
+ * the interrupt that the subframe would otherwise have cost.
+ */
+
+static int bcmf_sdpcm_process_glom(FAR struct bcmf_dev_s *priv,
+                                   struct bcmf_sdio_frame *sframe)
+{
+  FAR struct bcmf_sdio_dev_s *sbus = (FAR struct bcmf_sdio_dev_s *)priv->bus;
+  struct bcmf_sdpcm_header *super =
+    (struct bcmf_sdpcm_header *)sframe->header.base;
+  struct bcmf_sdpcm_header *sub;
+  struct bcmf_sdio_frame *subframe;
+  unsigned int offset = super->data_offset;
+
+  while (offset + sizeof(struct bcmf_sdpcm_header) <= super->size)
+    {
+      sub = (struct bcmf_sdpcm_header *)((uint8_t *)super + offset);
+
+      if (((~sub->size & 0xffff) ^ sub->checksum) ||
+          sub->size < sizeof(struct bcmf_sdpcm_header) ||
+          offset + sub->size > super->size)
+        {
+          wlerr("Invalid subframe at %d %x %x\n", offset,
+                sub->size, sub->checksum);
+          return -EINVAL;
+        }
+
+      if (bcmf_sdpcm_process_header(sbus, sub) != OK)
+        {
+          return -EINVAL;
+        }
+
+      subframe = bcmf_sdio_allocate_frame(priv, false, false);
+      if (subframe == NULL)
+        {
+          /* Out of pool frames, the remaining subframes are dropped */
+
+          wlinfo("glom alloc failed\n");
+          return -EAGAIN;
+        }
+
+      memcpy(subframe->data, sub, sub->size);
+      subframe->header.len  = sub->size;
+      subframe->header.data = subframe->data + sub->data_offset;
+
+      bcmf_sdpcm_dispatch(priv, subframe);
+
+      /* Subframes are aligned to 4 bytes within the superframe */
+
+      offset += (sub->size + 3) & ~3;
+    }
+
+  return OK;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -168,6 +297,60 @@ int bcmf_sdpcm_readframe(FAR struct bcmf_dev_s *priv)
 
   header = (struct bcmf_sdpcm_header *)sframe->data;
 
+#ifdef CONFIG_IEEE80211_BROADCOM_SDIO_AGG
+  if (sbus->rx_nextlen > 0)
+    {
+      uint16_t rdlen = sbus->rx_nextlen << 4;
+
+      /* The previous frame advertised the length of this one:  Read the
+       * whole frame with a single transaction instead of the separate
+       * 4-byte header read followed by the body read.
+       */
+
+      sbus->rx_nextlen = 0;
+
+      if (rdlen > sframe->header.len)
+        {
+          wlerr("Advertised frame too large %d\n", rdlen);
+          ret = -ENOMEM;
+          goto exit_abort;
+        }
+
+      ret = bcmf_transfer_bytes(sbus, false, 2, 0, (uint8_t *)header,
+                                rdlen);
+      if (ret != OK)
+        {
+          ret = -EIO;
+          goto exit_abort;
+        }
+
+      len = header->size;
+      checksum = header->checksum;
+
+      /* All zero means no more to read */
+
+      if (!(len | checksum))
+        {
+          ret = -ENODATA;
+          goto exit_free_frame;
+        }
+
+      if (((~len & 0xffff) ^ checksum) ||
+          len < sizeof(struct bcmf_sdpcm_header) || len > rdlen)
+        {
+          /* The advertised length did not match the frame that arrived;
+           * abort and fall back to the header-first read.
+           */
+
+          wlerr("Invalid read-ahead len %x %x %d\n", len, checksum, rdlen);
+          ret = -EINVAL;
+          goto exit_abort;
+        }
+
+      goto process_frame;
+    }
+#endif
+
   /* Read header */
 
   ret = bcmf_transfer_bytes(sbus, false, 2, 0, (uint8_t *)header, 4);
@@ -218,6 +401,10 @@ int bcmf_sdpcm_readframe(FAR struct bcmf_dev_s *priv)
   bcmf_hexdump((uint8_t *)header, header->size, (unsigned int)header);
 #endif
 
+#ifdef CONFIG_IEEE80211_BROADCOM_SDIO_AGG
+process_frame:
+#endif
+
   /* Process and validate header */
 
   ret = bcmf_sdpcm_process_header(sbus, header);
@@ -228,59 +415,30 @@ int bcmf_sdpcm_readframe(FAR struct bcmf_dev_s *priv)
       goto exit_free_frame;
     }
 
-  /* Update frame structure */
-
-  sframe->header.len = header->size;
-  sframe->header.data += header->data_offset;
+#ifdef CONFIG_IEEE80211_BROADCOM_SDIO_AGG
+  /* Remember the advertised length of the following frame so that it can
+   * be read with a single transaction.
+   */
 
-  /* Process received frame content */
+  sbus->rx_nextlen = header->next_length;
 
-  switch (header->channel & 0x0f)
+  if ((header->channel & 0x0f) == SDPCM_GLOM_CHANNEL)
     {
-      case SDPCM_CONTROL_CHANNEL:
-        ret = bcmf_cdc_process_control_frame(priv, &sframe->header);
-        goto exit_free_frame;
+      /* The chip glommed several frames into this superframe */
 
-      case SDPCM_EVENT_CHANNEL:
-        if (header->data_offset == header->size)
-          {
-            /* Empty event, ignore */
-
-            ret = OK;
-          }
-        else
-          {
-            ret = bcmf_bdc_process_event_frame(priv, &sframe->header);
-          }
-
-        goto exit_free_frame;
-
-      case SDPCM_DATA_CHANNEL:
-
-        /* Queue frame and notify network layer frame is available */
-
-        if (nxsem_wait(&sbus->queue_mutex) < 0)
-          {
-            DEBUGPANIC();
-          }
-
-        bcmf_dqueue_push(&sbus->rx_queue, &sframe->list_entry);
-        nxsem_post(&sbus->queue_mutex);
-
-        bcmf_netdev_notify_rx(priv);
+      ret = bcmf_sdpcm_process_glom(priv, sframe);
+      goto exit_free_frame;
+    }
+#endif
 
-        /* Upper layer have to free all received frames */
+  /* Update frame structure */
 
-        ret = OK;
-        break;
+  sframe->header.len = header->size;
+  sframe->header.data += header->data_offset;
 
-      default:
-        wlerr("Got unexpected message type %d\n", header->channel);
-        ret = -EINVAL;
-        goto exit_free_frame;
-    }
+  /* Process received frame content */
 
-  return ret;
+  return bcmf_sdpcm_dispatch(priv, sframe);
 
 exit_abort:
   bcmf_sdpcm_rxfail(sbus, false);
@@ -291,9 +449,12 @@ exit_free_frame:
 
 int bcmf_sdpcm_sendframe(FAR struct bcmf_dev_s *priv)
 {
-  int ret;
-  bool is_txframe;
+  int ret = OK;
+  int nframes = 0;
+  int i;
+  bool is_txframe = false;
   dq_entry_t *entry;
+  struct bcmf_sdio_frame *sent[BCMF_PKT_POOL_SIZE];
   struct bcmf_sdio_frame *sframe;
   struct bcmf_sdpcm_header *header;
   FAR struct bcmf_sdio_dev_s *sbus = (FAR struct bcmf_sdio_dev_s *)priv->bus;
@@ -318,41 +479,67 @@ int bcmf_sdpcm_sendframe(FAR struct bcmf_dev_s *priv)
       DEBUGPANIC();
     }
 
-  entry = sbus->tx_queue.tail;
-  sframe = container_of(entry, struct bcmf_sdio_frame, list_entry);
-  header = (struct bcmf_sdpcm_header *)sframe->header.base;
+  /* Send as many queued frames as the flow-control credit allows in one
+   * write burst:  The frames go out back-to-back while the bus is awake,
+   * the queue lock is taken once and the network layer is notified once.
+   */
+
+  while (sbus->tx_queue.tail != NULL && nframes < BCMF_PKT_POOL_SIZE)
+    {
+      if (sbus->tx_seq == sbus->max_seq)
+        {
+          /* Credit exhausted mid-burst, leave remaining frames queued */
 
-  /* Set frame sequence id */
+          break;
+        }
 
-  header->sequence = sbus->tx_seq++;
+      entry = sbus->tx_queue.tail;
+      sframe = container_of(entry, struct bcmf_sdio_frame, list_entry);
+      header = (struct bcmf_sdpcm_header *)sframe->header.base;
+
+      /* Set frame sequence id */
+
+      header->sequence = sbus->tx_seq++;
 
 #if 0
-  wlinfo("Send frame %p\n", sframe);
+      wlinfo("Send frame %p\n", sframe);
 
-  bcmf_hexdump(sframe->header.base, sframe->header.len,
-               (unsigned long)sframe->header.base);
+      bcmf_hexdump(sframe->header.base, sframe->header.len,
+                   (unsigned long)sframe->header.base);
 #endif
 
-  ret = bcmf_transfer_bytes(sbus, true, 2, 0, sframe->header.base,
-                            sframe->header.len);
-  if (ret != OK)
-    {
-      /* TODO handle retry count and remove frame from queue + abort TX */
+      ret = bcmf_transfer_bytes(sbus, true, 2, 0, sframe->header.base,
+                                sframe->header.len);
+      if (ret != OK)
+        {
+          /* TODO handle retry count and remove frame from queue +
+           * abort TX
+           */
 
-      wlinfo("fail send frame %d\n", ret);
-      ret = -EIO;
-      goto exit_abort;
-    }
+          wlinfo("fail send frame %d\n", ret);
+          ret = -EIO;
+          break;
+        }
 
-  /* Frame sent, remove it from queue */
+      /* Frame sent, remove it from queue */
+
+      bcmf_dqueue_pop_tail(&sbus->tx_queue);
+      sent[nframes++] = sframe;
+    }
 
-  bcmf_dqueue_pop_tail(&sbus->tx_queue);
   nxsem_post(&sbus->queue_mutex);
-  is_txframe = sframe->tx;
 
-  /* Free frame buffer */
+  /* Free the sent frame buffers */
 
-  bcmf_sdio_free_frame(priv, sframe);
+  for (i = 0; i < nframes; i++)
+    {
+      if (sent[i]->tx)
+        {
+          is_txframe = true;
+        }
+
+      bcmf_sdio_free_frame(priv, sent[i]);
+    }
 
   if (is_txframe)
     {
@@ -361,15 +548,12 @@ int bcmf_sdpcm_sendframe(FAR struct bcmf_dev_s *priv)
       bcmf_netdev_notify_tx_done(priv);
     }
 
-  return OK;
-
-exit_abort:
-#if 0
-  bcmf_sdpcm_txfail(sbus, false);
-#endif
+  if (ret != OK)
+    {
+      return ret;
+    }
 
-  nxsem_post(&sbus->queue_mutex);
-  return ret;
+  return (nframes > 0) ? OK : -ENODATA;
 }
 
 int bcmf_sdpcm_queue_frame(FAR struct bcmf_dev_s *priv,
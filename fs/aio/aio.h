@@ -28,6 +28,7 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdbool.h>
 #include <string.h>
 #include <aio.h>
 #include <queue.h>
@@ -49,6 +50,19 @@
 #  define CONFIG_FS_NAIOC 8
 #endif
 
+/* Number of dedicated AIO worker threads.  Zero (the default) means that
+ * asynchronous I/O is performed on the low-priority work queue.
+ */
+
+#ifndef CONFIG_FS_AIO_THREADS
+#  define CONFIG_FS_AIO_THREADS 0
+#endif
+
+#undef AIO_HAVE_THREADPOOL
+#if CONFIG_FS_AIO_THREADS > 0
+#  define AIO_HAVE_THREADPOOL 1
+#endif
+
 #undef AIO_HAVE_PSOCK
 
 #ifdef CONFIG_NET_TCP
@@ -77,7 +91,12 @@ struct aio_container_s
 #endif
     FAR void *ptr;                 /* Generic pointer to FAR data */
   } u;
+#ifdef AIO_HAVE_THREADPOOL
+  worker_t aioc_worker;            /* I/O worker function (NULL until queued) */
+  bool aioc_active;                /* True: I/O is being serviced */
+#else
   struct work_s aioc_work;         /* Used to defer I/O to the work thread */
+#endif
   pid_t aioc_pid;                  /* ID of the waiting task */
 #ifdef CONFIG_PRIORITY_INHERITANCE
   uint8_t aioc_prio;               /* Priority of the waiting task */
@@ -253,6 +272,62 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker);
 
 int aio_signal(pid_t pid, FAR struct aiocb *aiocbp);
 
+#ifdef AIO_HAVE_THREADPOOL
+/****************************************************************************
+ * Name: aio_pool_initialize
+ *
+ * Description:
+ *   Start the dedicated AIO worker threads.  Called once from
+ *   aio_initialize().
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int aio_pool_initialize(void);
+
+/****************************************************************************
+ * Name: aio_pool_queue
+ *
+ * Description:
+ *   Make queued asynchronous I/O available to the AIO worker pool and
+ *   wake one worker thread.  The container must already have been added
+ *   to the pending I/O list by aio_contain().
+ *
+ * Input Parameters:
+ *   aioc   - Pointer to the AIO control block container
+ *   worker - The worker function that will perform the I/O
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int aio_pool_queue(FAR struct aio_container_s *aioc, worker_t worker);
+
+/****************************************************************************
+ * Name: aio_pool_cancel
+ *
+ * Description:
+ *   Attempt to cancel queued asynchronous I/O before a worker thread has
+ *   started it.  The caller must hold the lock on the pending I/O list.
+ *
+ * Input Parameters:
+ *   aioc - Pointer to the AIO control block container
+ *
+ * Returned Value:
+ *   Zero (OK) if the I/O was canceled; -ENOENT if the I/O is already in
+ *   progress and can no longer be canceled.
+ *
+ ****************************************************************************/
+
+int aio_pool_cancel(FAR struct aio_container_s *aioc);
+#endif /* AIO_HAVE_THREADPOOL */
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -124,7 +124,11 @@ int aio_cancel(int fildes, FAR struct aiocb *aiocbp)
                * first case.
                */
 
+#ifdef AIO_HAVE_THREADPOOL
+              status = aio_pool_cancel(aioc);
+#else
               status = work_cancel(LPWORK, &aioc->aioc_work);
+#endif
               if (status >= 0)
                 {
                   /* Remove the container from the list of pending transfers */
@@ -179,7 +183,11 @@ int aio_cancel(int fildes, FAR struct aiocb *aiocbp)
                * first case.
                */
 
+#ifdef AIO_HAVE_THREADPOOL
+              status = aio_pool_cancel(aioc);
+#else
               status = work_cancel(LPWORK, &aioc->aioc_work);
+#endif
               if (status >= 0)
                 {
                   /* Remove the container from the list of pending transfers */
@@ -113,6 +113,12 @@ void aio_initialize(void)
 
       dq_addlast(&g_aioc_alloc[i].aioc_link, &g_aioc_free);
     }
+
+#ifdef AIO_HAVE_THREADPOOL
+  /* Start the dedicated AIO worker threads */
+
+  DEBUGVERIFY(aio_pool_initialize());
+#endif
 }
 
 /****************************************************************************
@@ -0,0 +1,380 @@
+/****************************************************************************
+ * fs/aio/aio_pool.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <sched.h>
+#include <aio.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/sched.h>
+#include <nuttx/kthread.h>
+#include <nuttx/semaphore.h>
+
+#include "aio/aio.h"
+
+#ifdef AIO_HAVE_THREADPOOL
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* This counting semaphore is posted once for each queued I/O, waking one
+ * worker thread to examine the pending I/O list.
+ */
+
+static sem_t g_aio_worksem;
+
+/* Each entry holds the descriptor currently being serviced by one worker
+ * thread, or -1 if that worker is idle.  I/O on a descriptor that appears
+ * in this table may not be started by any other worker.  That is what
+ * serializes I/O on each descriptor in submission order while permitting
+ * I/O on different descriptors to proceed in parallel.
+ */
+
+static int g_aio_active[CONFIG_FS_AIO_THREADS];
+
+/* The next unassigned entry in the active descriptor table */
+
+static uint8_t g_aio_nextslot;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aio_pool_fildes_busy
+ *
+ * Description:
+ *   Check if I/O is currently in progress on the descriptor on any worker
+ *   thread.  The caller must hold the lock on the pending I/O list.
+ *
+ ****************************************************************************/
+
+static bool aio_pool_fildes_busy(int fildes)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_FS_AIO_THREADS; i++)
+    {
+      if (g_aio_active[i] == fildes)
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
+/****************************************************************************
+ * Name: aio_pool_thread
+ *
+ * Description:
+ *   This is the main loop of one AIO worker thread.  Each worker waits
+ *   for I/O to be queued, claims the first queued I/O whose descriptor is
+ *   not being serviced by another worker, and performs it.
+ *
+ ****************************************************************************/
+
+static int aio_pool_thread(int argc, FAR char *argv[])
+{
+  FAR struct aio_container_s *aioc;
+  worker_t worker;
+#ifdef CONFIG_PRIORITY_INHERITANCE
+  struct sched_param param;
+  bool boosted;
+#endif
+  int slot;
+  int ret;
+
+  /* Assign this worker the next entry in the active descriptor table */
+
+  do
+    {
+      ret = aio_lock();
+      DEBUGASSERT(ret == OK || ret == -ECANCELED);
+    }
+  while (ret < 0);
+
+  slot = g_aio_nextslot++;
+  DEBUGASSERT(slot < CONFIG_FS_AIO_THREADS);
+  aio_unlock();
+
+  for (; ; )
+    {
+      /* Wait for I/O to be queued */
+
+      ret = nxsem_wait_uninterruptible(&g_aio_worksem);
+      if (ret < 0)
+        {
+          continue;
+        }
+
+      ret = aio_lock();
+      if (ret < 0)
+        {
+          continue;
+        }
+
+      /* Find the first queued I/O that may be started:  It must have been
+       * made available to the pool, it must not already be being serviced,
+       * and no I/O on the same descriptor may be in progress on another
+       * worker.  Since the pending list is both filled and scanned in FIFO
+       * order, I/O on any one descriptor is performed strictly in
+       * submission order.
+       */
+
+      for (aioc = (FAR struct aio_container_s *)g_aio_pending.head;
+           aioc != NULL;
+           aioc = (FAR struct aio_container_s *)aioc->aioc_link.flink)
+        {
+          if (aioc->aioc_worker != NULL && !aioc->aioc_active &&
+              !aio_pool_fildes_busy(aioc->aioc_aiocbp->aio_fildes))
+            {
+              break;
+            }
+        }
+
+      if (aioc == NULL)
+        {
+          /* Nothing can be started now.  The worker that completes the
+           * blocking I/O will re-post the semaphore.
+           */
+
+          aio_unlock();
+          continue;
+        }
+
+      /* Claim the I/O and its descriptor */
+
+      aioc->aioc_active  = true;
+      g_aio_active[slot] = aioc->aioc_aiocbp->aio_fildes;
+      worker             = aioc->aioc_worker;
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+      /* Perform the I/O at the priority of the submitting thread (but
+       * never below the configured base priority of the pool).
+       */
+
+      boosted = false;
+      if (aioc->aioc_prio > CONFIG_FS_AIO_PRIORITY)
+        {
+          param.sched_priority = aioc->aioc_prio;
+          DEBUGVERIFY(nxsched_set_param(getpid(), &param));
+          boosted = true;
+        }
+#endif
+
+      aio_unlock();
+
+      /* Perform the I/O.  The worker function decants the container and
+       * signals the client when the transfer completes.
+       */
+
+      worker(aioc);
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+      /* Restore the default priority of the pool */
+
+      if (boosted)
+        {
+          param.sched_priority = CONFIG_FS_AIO_PRIORITY;
+          DEBUGVERIFY(nxsched_set_param(getpid(), &param));
+        }
+#endif
+
+      /* Release the descriptor and check for I/O that may have been
+       * deferred because this worker held its descriptor.
+       */
+
+      do
+        {
+          ret = aio_lock();
+          DEBUGASSERT(ret == OK || ret == -ECANCELED);
+        }
+      while (ret < 0);
+
+      g_aio_active[slot] = -1;
+
+      for (aioc = (FAR struct aio_container_s *)g_aio_pending.head;
+           aioc != NULL;
+           aioc = (FAR struct aio_container_s *)aioc->aioc_link.flink)
+        {
+          if (aioc->aioc_worker != NULL && !aioc->aioc_active)
+            {
+              /* There is still queued I/O.  Make sure that some worker
+               * re-examines the pending list.
+               */
+
+              nxsem_post(&g_aio_worksem);
+              break;
+            }
+        }
+
+      aio_unlock();
+    }
+
+  return OK; /* Not reached */
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aio_pool_initialize
+ *
+ * Description:
+ *   Start the dedicated AIO worker threads.  Called once from
+ *   aio_initialize().
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int aio_pool_initialize(void)
+{
+  int pid;
+  int i;
+
+  /* Initialize the worker wakeup semaphore.  The semaphore is used only
+   * for signalling and, hence, should not have priority inheritance
+   * enabled.
+   */
+
+  nxsem_init(&g_aio_worksem, 0, 0);
+  nxsem_set_protocol(&g_aio_worksem, SEM_PRIO_NONE);
+
+  /* All workers begin idle */
+
+  for (i = 0; i < CONFIG_FS_AIO_THREADS; i++)
+    {
+      g_aio_active[i] = -1;
+    }
+
+  /* Start the worker threads */
+
+  for (i = 0; i < CONFIG_FS_AIO_THREADS; i++)
+    {
+      pid = kthread_create("AIO", CONFIG_FS_AIO_PRIORITY,
+                           CONFIG_FS_AIO_STACKSIZE, aio_pool_thread, NULL);
+      if (pid < 0)
+        {
+          ferr("ERROR: kthread_create failed: %d\n", pid);
+          return pid;
+        }
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: aio_pool_queue
+ *
+ * Description:
+ *   Make queued asynchronous I/O available to the AIO worker pool and
+ *   wake one worker thread.  The container must already have been added
+ *   to the pending I/O list by aio_contain().
+ *
+ * Input Parameters:
+ *   aioc   - Pointer to the AIO control block container
+ *   worker - The worker function that will perform the I/O
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int aio_pool_queue(FAR struct aio_container_s *aioc, worker_t worker)
+{
+  int ret;
+
+  DEBUGASSERT(aioc != NULL && worker != NULL);
+
+  /* The container is already visible on the pending I/O list so the
+   * worker function must be set while holding the list lock.
+   */
+
+  ret = aio_lock();
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  aioc->aioc_worker = worker;
+  aioc->aioc_active = false;
+  aio_unlock();
+
+  /* Wake one worker thread */
+
+  return nxsem_post(&g_aio_worksem);
+}
+
+/****************************************************************************
+ * Name: aio_pool_cancel
+ *
+ * Description:
+ *   Attempt to cancel queued asynchronous I/O before a worker thread has
+ *   started it.  The caller must hold the lock on the pending I/O list.
+ *
+ * Input Parameters:
+ *   aioc - Pointer to the AIO control block container
+ *
+ * Returned Value:
+ *   Zero (OK) if the I/O was canceled; -ENOENT if the I/O is already in
+ *   progress and can no longer be canceled.
+ *
+ ****************************************************************************/
+
+int aio_pool_cancel(FAR struct aio_container_s *aioc)
+{
+  DEBUGASSERT(aioc != NULL);
+
+  /* I/O that a worker has already claimed can no longer be canceled */
+
+  if (aioc->aioc_active)
+    {
+      return -ENOENT;
+    }
+
+  /* Make sure that no worker will start the I/O.  The caller will decant
+   * the container, removing it from the pending I/O list.  The wakeup
+   * that was posted for this I/O results only in a harmless re-scan of
+   * the pending list.
+   */
+
+  aioc->aioc_worker = NULL;
+  return OK;
+}
+
+#endif /* AIO_HAVE_THREADPOOL */
@@ -74,6 +74,24 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
 {
   int ret;
 
+#ifdef AIO_HAVE_THREADPOOL
+  /* Make the I/O available to the dedicated AIO worker pool.  The pool
+   * inherits the priority of the submitting thread when it performs the
+   * I/O.
+   */
+
+  ret = aio_pool_queue(aioc, worker);
+  if (ret < 0)
+    {
+      FAR struct aiocb *aiocbp = aioc->aioc_aiocbp;
+      DEBUGASSERT(aiocbp);
+
+      aiocbp->aio_result = ret;
+      set_errno(-ret);
+      ret = ERROR;
+    }
+
+#else
 #ifdef CONFIG_PRIORITY_INHERITANCE
   /* Prohibit context switches until we complete the queuing */
 
@@ -107,6 +125,8 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker)
 
   sched_unlock();
 #endif
+#endif /* AIO_HAVE_THREADPOOL */
+
   return ret;
 }
 
@@ -1056,9 +1056,58 @@ static ssize_t cromfs_read(FAR struct file *filep, FAR char *buffer,
 
 static int cromfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 {
+  FAR const struct cromfs_volume_s *fs;
+  FAR struct cromfs_file_s *ff;
+  FAR void **ppv = (FAR void **)arg;
+
   finfo("cmd: %d arg: %08lx\n", cmd, arg);
+  DEBUGASSERT(filep->f_priv != NULL && filep->f_inode != NULL);
+
+  /* Recover the volume private data from the inode structure and the open
+   * file instance from the file structure.
+   */
+
+  fs = filep->f_inode->i_private;
+  ff = (FAR struct cromfs_file_s *)filep->f_priv;
+  DEBUGASSERT(fs != NULL && ff->ff_node != NULL);
+
+  /* Only one ioctl command is supported */
+
+  if (cmd == FIOC_MMAP && ppv != NULL)
+    {
+      FAR struct lzf_header_s *currhdr;
+
+      /* The CROMFS image is directly addressable, so the file data can be
+       * accessed in place -- supporting mmap() and XIP -- provided that
+       * it is stored as a single, uncompressed block.
+       */
 
-  /* No IOCTL commands yet supported */
+      currhdr = (FAR struct lzf_header_s *)
+                 cromfs_offset2addr(fs, ff->ff_node->u.cn_blocks);
+
+      if (currhdr->lzf_type == LZF_TYPE0_HDR)
+        {
+          FAR struct lzf_type0_header_s *hdr0 =
+            (FAR struct lzf_type0_header_s *)currhdr;
+          uint16_t ulen = (uint16_t)hdr0->lzf_len[0] << 8 |
+                          (uint16_t)hdr0->lzf_len[1];
+
+          if ((uint32_t)ulen >= ff->ff_node->cn_size)
+            {
+              /* Return the address of the file data in the image */
+
+              *ppv = (FAR void *)((FAR uint8_t *)currhdr +
+                                  LZF_TYPE0_HDR_SIZE);
+              return OK;
+            }
+        }
+
+      /* The file is compressed or spans multiple blocks and cannot be
+       * accessed in place.
+       */
+
+      return -ENOTTY;
+    }
 
   return -ENOTTY;
 }
@@ -122,6 +122,27 @@ int find_blockdriver(FAR const char *pathname, int mountflags,
 int block_proxy(FAR const char *blkdev, int oflags);
 #endif
 
+/****************************************************************************
+ * Name: blockcache_stats_read
+ *
+ * Description:
+ *   Format the statistics of all registered block device caches into the
+ *   caller provided buffer.  This is used by the procfs "fs/blockcache"
+ *   file.
+ *
+ * Input Parameters:
+ *   buffer - The caller provided buffer to receive the formatted output
+ *   buflen - The size of the caller provided buffer
+ *
+ * Returned Value:
+ *   The number of characters placed in the buffer.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_BLOCKCACHE
+size_t blockcache_stats_read(FAR char *buffer, size_t buflen);
+#endif
+
 /****************************************************************************
  * Name: mtd_proxy
  *
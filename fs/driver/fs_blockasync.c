@@ -0,0 +1,743 @@
+/****************************************************************************
+ * fs/driver/fs_blockasync.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/mount.h>
+#include <sys/stat.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/kthread.h>
+#include <nuttx/semaphore.h>
+
+#include "driver/driver.h"
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_BLOCKASYNC
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes the state of one block request queue */
+
+struct blockasync_s
+{
+  FAR struct inode *parent;    /* The underlying (parent) block driver */
+  sem_t lock;                  /* Assures mutually exclusive queue access */
+  sem_t waitsem;               /* Counts the requests awaiting service */
+  sem_t stopsem;               /* Signals that the service thread exited */
+  sq_queue_t queue;            /* Pending requests, ascending by sector */
+  size_t sweep;                /* Next sector in the elevator sweep */
+  size_t sectorsize;           /* Sector size of the parent device */
+  bool exiting;                /* true: The service thread must exit */
+};
+
+/* Used by the synchronous read/write methods to wait for a request */
+
+struct blockasync_wait_s
+{
+  sem_t done;                  /* Posted when the request completes */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int     blkaio_open(FAR struct inode *inode);
+static int     blkaio_close(FAR struct inode *inode);
+static ssize_t blkaio_read(FAR struct inode *inode,
+                 FAR unsigned char *buffer, size_t start_sector,
+                 unsigned int nsectors);
+static ssize_t blkaio_write(FAR struct inode *inode,
+                 FAR const unsigned char *buffer, size_t start_sector,
+                 unsigned int nsectors);
+static int     blkaio_geometry(FAR struct inode *inode,
+                 FAR struct geometry *geometry);
+static int     blkaio_ioctl(FAR struct inode *inode, int cmd,
+                 unsigned long arg);
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+static int     blkaio_unlink(FAR struct inode *inode);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct block_operations g_blkaio_bops =
+{
+  blkaio_open,     /* open     */
+  blkaio_close,    /* close    */
+  blkaio_read,     /* read     */
+  blkaio_write,    /* write    */
+  blkaio_geometry, /* geometry */
+  blkaio_ioctl     /* ioctl    */
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+  , blkaio_unlink  /* unlink   */
+#endif
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blkaio_enqueue
+ *
+ * Description:
+ *   Add one request to the pending queue, keeping the queue sorted in
+ *   ascending sector order.  The sort order lets the service thread sweep
+ *   the media in one direction like an elevator so that requests from
+ *   multiple tasks are serviced with minimal head movement (or, for
+ *   managed flash such as SD cards, with minimal erase-group thrash).
+ *
+ * Assumptions:
+ *   The caller holds the queue lock.
+ *
+ ****************************************************************************/
+
+static void blkaio_enqueue(FAR struct blockasync_s *dev,
+                           FAR struct blockasync_req_s *req)
+{
+  FAR sq_entry_t *entry;
+  FAR sq_entry_t *prev = NULL;
+
+  for (entry = sq_peek(&dev->queue); entry != NULL; entry = sq_next(entry))
+    {
+      if (((FAR struct blockasync_req_s *)entry)->sector > req->sector)
+        {
+          break;
+        }
+
+      prev = entry;
+    }
+
+  if (prev == NULL)
+    {
+      sq_addfirst(&req->entry, &dev->queue);
+    }
+  else
+    {
+      sq_addafter(prev, &req->entry, &dev->queue);
+    }
+}
+
+/****************************************************************************
+ * Name: blkaio_dequeue
+ *
+ * Description:
+ *   Remove and return the next request in the elevator sweep:  The first
+ *   pending request at or above the current sweep position or, if the
+ *   sweep has passed all pending requests, the lowest pending request
+ *   (beginning the next sweep).
+ *
+ * Assumptions:
+ *   The caller holds the queue lock.
+ *
+ ****************************************************************************/
+
+static FAR struct blockasync_req_s *
+blkaio_dequeue(FAR struct blockasync_s *dev)
+{
+  FAR sq_entry_t *entry;
+
+  for (entry = sq_peek(&dev->queue); entry != NULL; entry = sq_next(entry))
+    {
+      if (((FAR struct blockasync_req_s *)entry)->sector >= dev->sweep)
+        {
+          break;
+        }
+    }
+
+  if (entry == NULL)
+    {
+      entry = sq_peek(&dev->queue);
+    }
+
+  if (entry != NULL)
+    {
+      sq_rem(entry, &dev->queue);
+    }
+
+  return (FAR struct blockasync_req_s *)entry;
+}
+
+/****************************************************************************
+ * Name: blkaio_merge
+ *
+ * Description:
+ *   Try to merge the pending request that continues exactly where 'req'
+ *   ends into 'req' itself.  The merge is only possible if the adjacent
+ *   request transfers in the same direction and its buffer is contiguous
+ *   with the end of the 'req' buffer so that a single parent driver
+ *   transfer can service both.
+ *
+ * Returned Value:
+ *   The merged request, or NULL if no pending request could be merged.
+ *
+ * Assumptions:
+ *   The caller holds the queue lock.
+ *
+ ****************************************************************************/
+
+static FAR struct blockasync_req_s *
+blkaio_merge(FAR struct blockasync_s *dev, FAR struct blockasync_req_s *req)
+{
+  FAR struct blockasync_req_s *next;
+  FAR sq_entry_t *entry;
+
+  for (entry = sq_peek(&dev->queue); entry != NULL; entry = sq_next(entry))
+    {
+      next = (FAR struct blockasync_req_s *)entry;
+      if (next->sector >= req->sector + req->nsectors)
+        {
+          if (next->sector == req->sector + req->nsectors &&
+              next->write == req->write &&
+              next->buffer == req->buffer +
+                              req->nsectors * dev->sectorsize)
+            {
+              sq_rem(entry, &dev->queue);
+              return next;
+            }
+
+          break;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: blkaio_service
+ *
+ * Description:
+ *   Perform one request (and any requests merged into it) on the parent
+ *   block driver and report the completion to the submitter.
+ *
+ ****************************************************************************/
+
+static void blkaio_service(FAR struct blockasync_s *dev,
+                           FAR struct blockasync_req_s *req,
+                           unsigned int nmerged,
+                           FAR struct blockasync_req_s **merged)
+{
+  FAR struct inode *parent = dev->parent;
+  unsigned int nsectors = req->nsectors;
+  ssize_t nxfrd;
+  unsigned int i;
+
+  for (i = 0; i < nmerged; i++)
+    {
+      nsectors += merged[i]->nsectors;
+    }
+
+  if (req->write)
+    {
+      nxfrd = parent->u.i_bops->write(parent, req->buffer, req->sector,
+                                      nsectors);
+    }
+  else
+    {
+      nxfrd = parent->u.i_bops->read(parent, req->buffer, req->sector,
+                                     nsectors);
+    }
+
+  /* Advance the elevator sweep past the serviced sectors */
+
+  dev->sweep = req->sector + nsectors;
+
+  /* Distribute the result over the merged requests.  On a short or failed
+   * transfer each request reports only its own portion.
+   */
+
+  for (i = 0; i <= nmerged; i++)
+    {
+      FAR struct blockasync_req_s *done = (i == 0) ? req : merged[i - 1];
+
+      if (nxfrd < 0)
+        {
+          done->result = nxfrd;
+        }
+      else if ((size_t)nxfrd >= done->nsectors)
+        {
+          done->result = done->nsectors;
+          nxfrd       -= done->nsectors;
+        }
+      else
+        {
+          done->result = nxfrd;
+          nxfrd        = 0;
+        }
+
+      done->callback(done, done->arg);
+    }
+}
+
+/****************************************************************************
+ * Name: blkaio_thread
+ *
+ * Description:
+ *   The request queue service thread.  Requests are serviced in elevator
+ *   order and adjacent requests are merged into single parent driver
+ *   transfers when possible.
+ *
+ ****************************************************************************/
+
+static int blkaio_thread(int argc, FAR char *argv[])
+{
+  FAR struct blockasync_s *dev;
+  FAR struct blockasync_req_s *merged[CONFIG_FS_BLOCKASYNC_NMERGE];
+  FAR struct blockasync_req_s *req;
+  unsigned int nmerged;
+  int ret;
+
+  dev = (FAR struct blockasync_s *)
+        ((uintptr_t)strtoul(argv[1], NULL, 16));
+  DEBUGASSERT(dev != NULL);
+
+  for (; ; )
+    {
+      ret = nxsem_wait_uninterruptible(&dev->waitsem);
+      if (ret < 0 || dev->exiting)
+        {
+          break;
+        }
+
+      ret = nxsem_wait_uninterruptible(&dev->lock);
+      if (ret < 0)
+        {
+          break;
+        }
+
+      req = blkaio_dequeue(dev);
+      if (req != NULL)
+        {
+          /* Collect the run of pending requests that a single parent
+           * transfer can service together with this one.
+           */
+
+          nmerged = 0;
+          while (nmerged < CONFIG_FS_BLOCKASYNC_NMERGE)
+            {
+              FAR struct blockasync_req_s *tail =
+                (nmerged == 0) ? req : merged[nmerged - 1];
+              FAR struct blockasync_req_s *next;
+
+              next = blkaio_merge(dev, tail);
+              if (next == NULL)
+                {
+                  break;
+                }
+
+              merged[nmerged++] = next;
+            }
+
+          nxsem_post(&dev->lock);
+          blkaio_service(dev, req, nmerged, merged);
+
+          /* Account for the additional waitsem counts of the merged
+           * requests that were serviced without their own wakeup.
+           */
+
+          while (nmerged > 0 && !dev->exiting)
+            {
+              nxsem_wait_uninterruptible(&dev->waitsem);
+              nmerged--;
+            }
+        }
+      else
+        {
+          nxsem_post(&dev->lock);
+        }
+    }
+
+  nxsem_post(&dev->stopsem);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: blkaio_waitcb
+ *
+ * Description:
+ *   Completion callback used by the synchronous read/write methods.
+ *
+ ****************************************************************************/
+
+static void blkaio_waitcb(FAR struct blockasync_req_s *req, FAR void *arg)
+{
+  FAR struct blockasync_wait_s *wait = (FAR struct blockasync_wait_s *)arg;
+
+  nxsem_post(&wait->done);
+}
+
+/****************************************************************************
+ * Name: blkaio_transfer
+ *
+ * Description:
+ *   Submit one synchronous transfer through the request queue and wait
+ *   for its completion.
+ *
+ ****************************************************************************/
+
+static ssize_t blkaio_transfer(FAR struct inode *inode,
+                               FAR unsigned char *buffer,
+                               size_t start_sector, unsigned int nsectors,
+                               bool write)
+{
+  struct blockasync_wait_s wait;
+  struct blockasync_req_s req;
+  int ret;
+
+  nxsem_init(&wait.done, 0, 0);
+  nxsem_set_protocol(&wait.done, SEM_PRIO_NONE);
+
+  req.write    = write;
+  req.buffer   = buffer;
+  req.sector   = start_sector;
+  req.nsectors = nsectors;
+  req.callback = blkaio_waitcb;
+  req.arg      = &wait;
+
+  ret = blockasync_submit(inode, &req);
+  if (ret < 0)
+    {
+      nxsem_destroy(&wait.done);
+      return ret;
+    }
+
+  nxsem_wait_uninterruptible(&wait.done);
+  nxsem_destroy(&wait.done);
+  return req.result;
+}
+
+/****************************************************************************
+ * Name: blkaio_open
+ *
+ * Description: Open the block device
+ *
+ ****************************************************************************/
+
+static int blkaio_open(FAR struct inode *inode)
+{
+  FAR struct blockasync_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  struct geometry geo;
+  int ret = OK;
+
+  if (parent->u.i_bops->open)
+    {
+      ret = parent->u.i_bops->open(parent);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  /* The sector size is needed to recognize merge-able requests.  It is
+   * probed here because the geometry of removable media is not available
+   * until the media is present.
+   */
+
+  ret = parent->u.i_bops->geometry(parent, &geo);
+  if (ret >= 0)
+    {
+      dev->sectorsize = geo.geo_sectorsize;
+    }
+  else if (parent->u.i_bops->close)
+    {
+      parent->u.i_bops->close(parent);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: blkaio_close
+ *
+ * Description: Close the block device
+ *
+ ****************************************************************************/
+
+static int blkaio_close(FAR struct inode *inode)
+{
+  FAR struct blockasync_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  int ret = OK;
+
+  if (parent->u.i_bops->close)
+    {
+      ret = parent->u.i_bops->close(parent);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: blkaio_read
+ *
+ * Description:  Read the specified number of sectors
+ *
+ ****************************************************************************/
+
+static ssize_t blkaio_read(FAR struct inode *inode,
+                           FAR unsigned char *buffer, size_t start_sector,
+                           unsigned int nsectors)
+{
+  return blkaio_transfer(inode, buffer, start_sector, nsectors, false);
+}
+
+/****************************************************************************
+ * Name: blkaio_write
+ *
+ * Description: Write the specified number of sectors
+ *
+ ****************************************************************************/
+
+static ssize_t blkaio_write(FAR struct inode *inode,
+                            FAR const unsigned char *buffer,
+                            size_t start_sector, unsigned int nsectors)
+{
+  return blkaio_transfer(inode, (FAR unsigned char *)buffer, start_sector,
+                         nsectors, true);
+}
+
+/****************************************************************************
+ * Name: blkaio_geometry
+ *
+ * Description: Return device geometry
+ *
+ ****************************************************************************/
+
+static int blkaio_geometry(FAR struct inode *inode,
+                           FAR struct geometry *geometry)
+{
+  FAR struct blockasync_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+
+  return parent->u.i_bops->geometry(parent, geometry);
+}
+
+/****************************************************************************
+ * Name: blkaio_ioctl
+ *
+ * Description: Forward ioctls to the parent block driver
+ *
+ ****************************************************************************/
+
+static int blkaio_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
+{
+  FAR struct blockasync_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+
+  if (parent->u.i_bops->ioctl)
+    {
+      return parent->u.i_bops->ioctl(parent, cmd, arg);
+    }
+
+  return -ENOTTY;
+}
+
+/****************************************************************************
+ * Name: blkaio_unlink
+ ****************************************************************************/
+
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+static int blkaio_unlink(FAR struct inode *inode)
+{
+  FAR struct blockasync_s *dev = inode->i_private;
+
+  /* Stop the service thread and wait until it has exited.  No new
+   * requests can arrive because the inode has been removed.
+   */
+
+  dev->exiting = true;
+  nxsem_post(&dev->waitsem);
+  nxsem_wait_uninterruptible(&dev->stopsem);
+
+  inode_release(dev->parent);
+  nxsem_destroy(&dev->lock);
+  nxsem_destroy(&dev->waitsem);
+  nxsem_destroy(&dev->stopsem);
+  kmm_free(dev);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: blockasync_submit
+ *
+ * Description:
+ *   Submit one asynchronous block transfer request to a request queue
+ *   block driver.  The request is serviced by the queue's service thread
+ *   in elevator order; the caller continues immediately and the request
+ *   callback is invoked when the transfer completes.  The request memory
+ *   must remain valid until the callback is invoked.
+ *
+ * Input Parameters:
+ *   inode - The request queue block driver inode
+ *   req   - The request to be submitted.  The write, buffer, sector,
+ *           nsectors, callback and arg fields must be initialized.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on a failure to
+ *   submit the request.  Transfer errors are reported through the result
+ *   field of the completed request.
+ *
+ ****************************************************************************/
+
+int blockasync_submit(FAR struct inode *inode,
+                      FAR struct blockasync_req_s *req)
+{
+  FAR struct blockasync_s *dev;
+  int ret;
+
+  DEBUGASSERT(inode != NULL && req != NULL && req->callback != NULL);
+  dev = inode->i_private;
+
+  ret = nxsem_wait_uninterruptible(&dev->lock);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  blkaio_enqueue(dev, req);
+  nxsem_post(&dev->lock);
+  nxsem_post(&dev->waitsem);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: register_blockasync
+ *
+ * Description:
+ *   Register a request queue block driver inode in the pseudo file
+ *   system.  The new block device forwards all transfers to the 'source'
+ *   block driver, but from a dedicated service thread:  Requests from
+ *   multiple tasks are queued, serviced in elevator (ascending sector)
+ *   order and merged into single transfers when they are adjacent on the
+ *   media and in memory.  Mount the queue device in place of the source
+ *   device, or submit requests directly with blockasync_submit().
+ *
+ * Input Parameters:
+ *   queuedev - The path to the request queue block driver inode
+ *   mode     - The mode of the new inode
+ *   source   - The path to the source (parent) block driver inode
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on a failure.
+ *
+ ****************************************************************************/
+
+int register_blockasync(FAR const char *queuedev, mode_t mode,
+                        FAR const char *source)
+{
+  FAR struct blockasync_s *dev;
+  FAR char *argv[2];
+  char arg1[32];
+  int ret;
+
+  /* Allocate the request queue state structure */
+
+  dev = kmm_zalloc(sizeof(*dev));
+  if (!dev)
+    {
+      return -ENOMEM;
+    }
+
+  nxsem_init(&dev->lock, 0, 1);
+  nxsem_init(&dev->waitsem, 0, 0);
+  nxsem_init(&dev->stopsem, 0, 0);
+  nxsem_set_protocol(&dev->waitsem, SEM_PRIO_NONE);
+  nxsem_set_protocol(&dev->stopsem, SEM_PRIO_NONE);
+  sq_init(&dev->queue);
+
+  /* Find the source block driver */
+
+  if (mode & (S_IWOTH | S_IWGRP | S_IWUSR))
+    {
+      ret = find_blockdriver(source, 0, &dev->parent);
+    }
+  else
+    {
+      ret = find_blockdriver(source, MS_RDONLY, &dev->parent);
+    }
+
+  if (ret < 0)
+    {
+      goto errout_free;
+    }
+
+  /* Start the request queue service thread */
+
+  snprintf(arg1, sizeof(arg1), "%p", dev);
+  argv[0] = arg1;
+  argv[1] = NULL;
+
+  ret = kthread_create("blkaio", CONFIG_FS_BLOCKASYNC_PRIORITY,
+                       CONFIG_FS_BLOCKASYNC_STACKSIZE, blkaio_thread,
+                       argv);
+  if (ret < 0)
+    {
+      goto errout_release;
+    }
+
+  /* Inode private data is a reference to the request queue structure */
+
+  ret = register_blockdriver(queuedev, &g_blkaio_bops, mode, dev);
+  if (ret < 0)
+    {
+      goto errout_stop;
+    }
+
+  return OK;
+
+errout_stop:
+  dev->exiting = true;
+  nxsem_post(&dev->waitsem);
+  nxsem_wait_uninterruptible(&dev->stopsem);
+errout_release:
+  inode_release(dev->parent);
+errout_free:
+  nxsem_destroy(&dev->lock);
+  nxsem_destroy(&dev->waitsem);
+  nxsem_destroy(&dev->stopsem);
+  kmm_free(dev);
+  return ret;
+}
+
+#endif /* CONFIG_FS_BLOCKASYNC */
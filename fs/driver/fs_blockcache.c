@@ -0,0 +1,828 @@
+/****************************************************************************
+ * fs/driver/fs_blockcache.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/mount.h>
+#include <sys/stat.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/ioctl.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/semaphore.h>
+
+#include "driver/driver.h"
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_BLOCKCACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Transfers of more than this many sectors stream directly between the
+ * parent driver and the caller's buffer; only short transfers (such as the
+ * sector-at-a-time metadata I/O performed by the file systems) populate
+ * the cache.  This keeps large, sequential file transfers from evicting
+ * the hot metadata sectors that the cache exists to retain.
+ */
+
+#define BLOCKCACHE_BURST  CONFIG_FS_BLOCKCACHE_BURST
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One cached sector.  Valid lines are also retained in the LRU list with
+ * the most recently used line at the head of the list.
+ */
+
+struct blockcache_line_s
+{
+  dq_entry_t entry;            /* Supports the LRU list */
+  size_t sector;               /* Sector number held in this line */
+  bool valid;                  /* true: Line holds cached sector data */
+  bool dirty;                  /* true: Line data newer than the media */
+  FAR uint8_t *data;           /* Cached sector data */
+};
+
+/* This structure describes the state of one block device cache */
+
+struct blockcache_s
+{
+  FAR struct blockcache_s *flink; /* Supports the list of caches */
+  FAR struct inode *parent;    /* The cached (parent) block driver */
+  sem_t sem;                   /* Assures mutually exclusive access */
+  size_t sectorsize;           /* Sector size of the parent device */
+  bool bound;                  /* true: Geometry probed, buffer allocated */
+  FAR uint8_t *buffer;         /* Allocated cache line data */
+  dq_queue_t lru;              /* LRU ordering of the valid cache lines */
+  char source[16];             /* Parent device name (for procfs) */
+
+  /* Access statistics (reported via procfs) */
+
+  uint32_t nhits;              /* Number of sectors read from the cache */
+  uint32_t nmisses;            /* Number of sectors read from the media */
+  uint32_t nwrites;            /* Number of sectors written */
+  uint32_t nflushed;           /* Number of dirty sectors written back */
+
+  struct blockcache_line_s lines[CONFIG_FS_BLOCKCACHE_NLINES];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int     bchc_open(FAR struct inode *inode);
+static int     bchc_close(FAR struct inode *inode);
+static ssize_t bchc_read(FAR struct inode *inode, FAR unsigned char *buffer,
+                 size_t start_sector, unsigned int nsectors);
+static ssize_t bchc_write(FAR struct inode *inode,
+                 FAR const unsigned char *buffer, size_t start_sector,
+                 unsigned int nsectors);
+static int     bchc_geometry(FAR struct inode *inode,
+                 FAR struct geometry *geometry);
+static int     bchc_ioctl(FAR struct inode *inode, int cmd,
+                 unsigned long arg);
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+static int     bchc_unlink(FAR struct inode *inode);
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct block_operations g_bchc_bops =
+{
+  bchc_open,     /* open     */
+  bchc_close,    /* close    */
+  bchc_read,     /* read     */
+  bchc_write,    /* write    */
+  bchc_geometry, /* geometry */
+  bchc_ioctl     /* ioctl    */
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+  , bchc_unlink  /* unlink   */
+#endif
+};
+
+/* A list of all block device caches for procfs reporting */
+
+static FAR struct blockcache_s *g_blockcaches;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bchc_lookup
+ *
+ * Description:
+ *   Find the cache line, if any, holding the indicated sector.
+ *
+ ****************************************************************************/
+
+static FAR struct blockcache_line_s *
+bchc_lookup(FAR struct blockcache_s *dev, size_t sector)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_FS_BLOCKCACHE_NLINES; i++)
+    {
+      if (dev->lines[i].valid && dev->lines[i].sector == sector)
+        {
+          return &dev->lines[i];
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: bchc_touch
+ *
+ * Description:
+ *   Move a cache line to the head (most recently used end) of the LRU list.
+ *
+ ****************************************************************************/
+
+static void bchc_touch(FAR struct blockcache_s *dev,
+                       FAR struct blockcache_line_s *line)
+{
+  dq_rem(&line->entry, &dev->lru);
+  dq_addfirst(&line->entry, &dev->lru);
+}
+
+/****************************************************************************
+ * Name: bchc_flushline
+ *
+ * Description:
+ *   Write one dirty cache line back to the parent block driver.
+ *
+ ****************************************************************************/
+
+static int bchc_flushline(FAR struct blockcache_s *dev,
+                          FAR struct blockcache_line_s *line)
+{
+  FAR struct inode *parent = dev->parent;
+  ssize_t nwritten;
+
+  if (line->dirty)
+    {
+      nwritten = parent->u.i_bops->write(parent, line->data,
+                                         line->sector, 1);
+      if (nwritten < 0)
+        {
+          ferr("ERROR: Failed to write back sector %zu: %zd\n",
+               line->sector, nwritten);
+          return (int)nwritten;
+        }
+
+      line->dirty = false;
+      dev->nflushed++;
+    }
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bchc_flush
+ *
+ * Description:
+ *   Write all dirty cache lines back to the parent block driver.
+ *
+ ****************************************************************************/
+
+static int bchc_flush(FAR struct blockcache_s *dev)
+{
+  int ret = OK;
+  int i;
+
+  for (i = 0; i < CONFIG_FS_BLOCKCACHE_NLINES; i++)
+    {
+      if (dev->lines[i].valid)
+        {
+          int status = bchc_flushline(dev, &dev->lines[i]);
+          if (status < 0)
+            {
+              ret = status;
+            }
+        }
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bchc_insert
+ *
+ * Description:
+ *   Add one sector to the cache, evicting the least recently used line
+ *   if the cache is full.  If the evicted line is dirty, then it is first
+ *   written back to the parent block driver.
+ *
+ ****************************************************************************/
+
+static void bchc_insert(FAR struct blockcache_s *dev, size_t sector,
+                        FAR const uint8_t *data, bool dirty)
+{
+  FAR struct blockcache_line_s *line = NULL;
+  int i;
+
+  /* Prefer a line that has never been used */
+
+  for (i = 0; i < CONFIG_FS_BLOCKCACHE_NLINES; i++)
+    {
+      if (!dev->lines[i].valid)
+        {
+          line = &dev->lines[i];
+          break;
+        }
+    }
+
+  /* Otherwise, evict the line at the tail of the LRU list */
+
+  if (line == NULL)
+    {
+      line = (FAR struct blockcache_line_s *)dq_remlast(&dev->lru);
+      DEBUGASSERT(line != NULL);
+
+      if (bchc_flushline(dev, line) < 0)
+        {
+          /* Do not replace data that could not be written back; drop the
+           * new sector instead.  The line remains valid and dirty and
+           * will be retried by a later flush or eviction.
+           */
+
+          dq_addlast(&line->entry, &dev->lru);
+          return;
+        }
+
+      line->valid = false;
+    }
+
+  memcpy(line->data, data, dev->sectorsize);
+  line->sector = sector;
+  line->valid  = true;
+  line->dirty  = dirty;
+  dq_addfirst(&line->entry, &dev->lru);
+}
+
+/****************************************************************************
+ * Name: bchc_bind
+ *
+ * Description:
+ *   Probe the parent geometry and allocate the cache line memory.  This
+ *   is deferred until the device is first opened because the geometry of
+ *   removable media is not available until the media is present.
+ *
+ ****************************************************************************/
+
+static int bchc_bind(FAR struct blockcache_s *dev)
+{
+  FAR struct inode *parent = dev->parent;
+  struct geometry geo;
+  int ret;
+  int i;
+
+  if (dev->bound)
+    {
+      return OK;
+    }
+
+  ret = parent->u.i_bops->geometry(parent, &geo);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  if (!geo.geo_available || geo.geo_sectorsize == 0)
+    {
+      return -ENODEV;
+    }
+
+  dev->sectorsize = geo.geo_sectorsize;
+  dev->buffer     = kmm_malloc(CONFIG_FS_BLOCKCACHE_NLINES *
+                               dev->sectorsize);
+  if (dev->buffer == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  for (i = 0; i < CONFIG_FS_BLOCKCACHE_NLINES; i++)
+    {
+      dev->lines[i].data = &dev->buffer[i * dev->sectorsize];
+    }
+
+  dev->bound = true;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bchc_open
+ *
+ * Description: Open the block device
+ *
+ ****************************************************************************/
+
+static int bchc_open(FAR struct inode *inode)
+{
+  FAR struct blockcache_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  int ret = OK;
+
+  /* Open the parent block device */
+
+  if (parent->u.i_bops->open)
+    {
+      ret = parent->u.i_bops->open(parent);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  /* Then allocate the cache memory, if we have not already done so */
+
+  ret = nxsem_wait_uninterruptible(&dev->sem);
+  if (ret >= 0)
+    {
+      ret = bchc_bind(dev);
+      nxsem_post(&dev->sem);
+    }
+
+  if (ret < 0 && parent->u.i_bops->close)
+    {
+      parent->u.i_bops->close(parent);
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bchc_close
+ *
+ * Description: close the block device
+ *
+ ****************************************************************************/
+
+static int bchc_close(FAR struct inode *inode)
+{
+  FAR struct blockcache_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  int ret;
+
+  /* Make sure that no dirty data outlives the open reference */
+
+  ret = nxsem_wait_uninterruptible(&dev->sem);
+  if (ret >= 0)
+    {
+      ret = bchc_flush(dev);
+      nxsem_post(&dev->sem);
+    }
+
+  if (parent->u.i_bops->close)
+    {
+      int status = parent->u.i_bops->close(parent);
+      if (ret >= 0)
+        {
+          ret = status;
+        }
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bchc_read
+ *
+ * Description:  Read the specified number of sectors
+ *
+ ****************************************************************************/
+
+static ssize_t bchc_read(FAR struct inode *inode, FAR unsigned char *buffer,
+                         size_t start_sector, unsigned int nsectors)
+{
+  FAR struct blockcache_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  FAR struct blockcache_line_s *line;
+  unsigned int nread = 0;
+  ssize_t ret;
+
+  ret = (ssize_t)nxsem_wait_uninterruptible(&dev->sem);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  DEBUGASSERT(dev->bound);
+
+  while (nread < nsectors)
+    {
+      size_t sector = start_sector + nread;
+      FAR uint8_t *dest = &buffer[nread * dev->sectorsize];
+
+      line = bchc_lookup(dev, sector);
+      if (line != NULL)
+        {
+          /* The sector is in the cache (and, if dirty, may be newer than
+           * the copy on the media).
+           */
+
+          memcpy(dest, line->data, dev->sectorsize);
+          bchc_touch(dev, line);
+          dev->nhits++;
+          nread++;
+        }
+      else
+        {
+          /* Read the run of consecutive uncached sectors with a single
+           * parent driver transfer.
+           */
+
+          unsigned int run = 1;
+          unsigned int i;
+
+          while (nread + run < nsectors &&
+                 bchc_lookup(dev, sector + run) == NULL)
+            {
+              run++;
+            }
+
+          ret = parent->u.i_bops->read(parent, dest, sector, run);
+          if (ret < 0)
+            {
+              goto errout;
+            }
+
+          dev->nmisses += ret;
+
+          /* Short transfers only populate the cache; long, streaming
+           * transfers pass through so that they cannot evict hot
+           * metadata sectors.
+           */
+
+          if (nsectors <= BLOCKCACHE_BURST)
+            {
+              for (i = 0; i < (unsigned int)ret; i++)
+                {
+                  bchc_insert(dev, sector + i,
+                              &dest[i * dev->sectorsize], false);
+                }
+            }
+
+          nread += ret;
+          if ((unsigned int)ret < run)
+            {
+              /* The parent driver returned less than was requested */
+
+              break;
+            }
+        }
+    }
+
+  ret = nread;
+
+errout:
+  nxsem_post(&dev->sem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bchc_write
+ *
+ * Description: Write (or buffer) the specified number of sectors
+ *
+ ****************************************************************************/
+
+static ssize_t bchc_write(FAR struct inode *inode,
+                          FAR const unsigned char *buffer,
+                          size_t start_sector, unsigned int nsectors)
+{
+  FAR struct blockcache_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  FAR struct blockcache_line_s *line;
+  unsigned int i;
+  ssize_t ret;
+
+  ret = (ssize_t)nxsem_wait_uninterruptible(&dev->sem);
+  if (ret < 0)
+    {
+      return ret;
+    }
+
+  DEBUGASSERT(dev->bound);
+
+#ifdef CONFIG_FS_BLOCKCACHE_WRITEBACK
+  /* Short writes are absorbed by the cache and written back later when
+   * the line is evicted or the device is flushed (BIOC_FLUSH) or closed.
+   */
+
+  if (nsectors <= BLOCKCACHE_BURST)
+    {
+      for (i = 0; i < nsectors; i++)
+        {
+          FAR const uint8_t *src = &buffer[i * dev->sectorsize];
+
+          line = bchc_lookup(dev, start_sector + i);
+          if (line != NULL)
+            {
+              memcpy(line->data, src, dev->sectorsize);
+              line->dirty = true;
+              bchc_touch(dev, line);
+            }
+          else
+            {
+              bchc_insert(dev, start_sector + i, src, true);
+            }
+        }
+
+      dev->nwrites += nsectors;
+      nxsem_post(&dev->sem);
+      return nsectors;
+    }
+#endif
+
+  /* Write through to the parent block driver */
+
+  ret = parent->u.i_bops->write(parent, buffer, start_sector, nsectors);
+  if (ret > 0)
+    {
+      dev->nwrites += ret;
+
+      /* Keep any cached copies of the written sectors coherent.  The
+       * media now holds the new data so the lines are left clean.
+       */
+
+      for (i = 0; i < (unsigned int)ret; i++)
+        {
+          line = bchc_lookup(dev, start_sector + i);
+          if (line != NULL)
+            {
+              memcpy(line->data, &buffer[i * dev->sectorsize],
+                     dev->sectorsize);
+              line->dirty = false;
+              bchc_touch(dev, line);
+            }
+        }
+    }
+
+  nxsem_post(&dev->sem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bchc_geometry
+ *
+ * Description: Return device geometry
+ *
+ ****************************************************************************/
+
+static int bchc_geometry(FAR struct inode *inode,
+                         FAR struct geometry *geometry)
+{
+  FAR struct blockcache_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+
+  return parent->u.i_bops->geometry(parent, geometry);
+}
+
+/****************************************************************************
+ * Name: bchc_ioctl
+ *
+ * Description: Forward ioctls, flushing the cache when requested
+ *
+ ****************************************************************************/
+
+static int bchc_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
+{
+  FAR struct blockcache_s *dev = inode->i_private;
+  FAR struct inode *parent = dev->parent;
+  int ret = -ENOTTY;
+
+  if (cmd == BIOC_FLUSH)
+    {
+      ret = nxsem_wait_uninterruptible(&dev->sem);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      ret = bchc_flush(dev);
+      nxsem_post(&dev->sem);
+
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  if (parent->u.i_bops->ioctl)
+    {
+      int status = parent->u.i_bops->ioctl(parent, cmd, arg);
+
+      /* The cache handled BIOC_FLUSH; the parent driver need not */
+
+      if (status != -ENOTTY || cmd != BIOC_FLUSH)
+        {
+          ret = status;
+        }
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: bchc_unlink
+ ****************************************************************************/
+
+#ifndef CONFIG_DISABLE_PSEUDOFS_OPERATIONS
+static int bchc_unlink(FAR struct inode *inode)
+{
+  FAR struct blockcache_s *dev = inode->i_private;
+  FAR struct blockcache_s **prev;
+
+  /* Make a best effort to write back any remaining dirty data */
+
+  bchc_flush(dev);
+
+  /* Remove the cache from the list used by procfs */
+
+  for (prev = &g_blockcaches; *prev != NULL; prev = &(*prev)->flink)
+    {
+      if (*prev == dev)
+        {
+          *prev = dev->flink;
+          break;
+        }
+    }
+
+  inode_release(dev->parent);
+  nxsem_destroy(&dev->sem);
+
+  if (dev->buffer != NULL)
+    {
+      kmm_free(dev->buffer);
+    }
+
+  kmm_free(dev);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: register_blockcache
+ *
+ * Description:
+ *   Register a cached block driver inode in the pseudo file system.  The
+ *   new block device forwards all transfers to the 'source' block driver
+ *   but retains recently used sectors in RAM so that hot sectors (such as
+ *   file system metadata) need not be re-read from the media.  Mount the
+ *   cache device in place of the source device to enable caching.
+ *
+ * Input Parameters:
+ *   cachedev - The path to the cache block driver inode to be created
+ *   mode     - The mode of the new inode
+ *   source   - The path to the source (parent) block driver inode
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on a failure.
+ *
+ ****************************************************************************/
+
+int register_blockcache(FAR const char *cachedev, mode_t mode,
+                        FAR const char *source)
+{
+  FAR struct blockcache_s *dev;
+  int ret;
+
+  /* Allocate the cache state structure */
+
+  dev = kmm_zalloc(sizeof(*dev));
+  if (!dev)
+    {
+      return -ENOMEM;
+    }
+
+  nxsem_init(&dev->sem, 0, 1);
+  strncpy(dev->source, source, sizeof(dev->source) - 1);
+
+  /* Find the source block driver */
+
+  if (mode & (S_IWOTH | S_IWGRP | S_IWUSR))
+    {
+      ret = find_blockdriver(source, 0, &dev->parent);
+    }
+  else
+    {
+      ret = find_blockdriver(source, MS_RDONLY, &dev->parent);
+    }
+
+  if (ret < 0)
+    {
+      goto errout_free;
+    }
+
+  /* Inode private data is a reference to the cache state structure */
+
+  ret = register_blockdriver(cachedev, &g_bchc_bops, mode, dev);
+  if (ret < 0)
+    {
+      goto errout_release;
+    }
+
+  /* Add the cache to the list used by procfs */
+
+  dev->flink    = g_blockcaches;
+  g_blockcaches = dev;
+  return OK;
+
+errout_release:
+  inode_release(dev->parent);
+errout_free:
+  nxsem_destroy(&dev->sem);
+  kmm_free(dev);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: blockcache_stats_read
+ *
+ * Description:
+ *   Format the statistics of all registered block device caches into the
+ *   caller provided buffer.  This is used by the procfs "fs/blockcache"
+ *   file.
+ *
+ * Input Parameters:
+ *   buffer - The caller provided buffer to receive the formatted output
+ *   buflen - The size of the caller provided buffer
+ *
+ * Returned Value:
+ *   The number of characters placed in the buffer.
+ *
+ ****************************************************************************/
+
+size_t blockcache_stats_read(FAR char *buffer, size_t buflen)
+{
+  FAR struct blockcache_s *dev;
+  size_t copied;
+  int len;
+
+  len = snprintf(buffer, buflen, "%-16s%6s%8s%11s%11s%11s%11s\n",
+                 "SOURCE", "LINES", "SECTSZ", "HITS", "MISSES",
+                 "WRITES", "FLUSHED");
+  copied = ((size_t)len >= buflen) ? buflen - 1 : (size_t)len;
+
+  for (dev = g_blockcaches; dev != NULL; dev = dev->flink)
+    {
+      len = snprintf(&buffer[copied], buflen - copied,
+                     "%-16s%6d%8zu%11" PRIu32 "%11" PRIu32
+                     "%11" PRIu32 "%11" PRIu32 "\n",
+                     dev->source, CONFIG_FS_BLOCKCACHE_NLINES,
+                     dev->sectorsize, dev->nhits, dev->nmisses,
+                     dev->nwrites, dev->nflushed);
+      if ((size_t)len >= buflen - copied)
+        {
+          copied = buflen - 1;
+          break;
+        }
+
+      copied += (size_t)len;
+    }
+
+  return copied;
+}
+
+#endif /* CONFIG_FS_BLOCKCACHE */
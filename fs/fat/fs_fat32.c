@@ -49,6 +49,11 @@
  * Private Function Prototypes
  ****************************************************************************/
 
+#ifdef CONFIG_FAT_CLUSTER_RUNS
+static unsigned int fat_clusterrun(FAR struct fat_mountpt_s *fs,
+                 FAR struct fat_file_s *ff, unsigned int nsectors);
+#endif
+
 static int     fat_open(FAR struct file *filep, FAR const char *relpath,
                  int oflags, mode_t mode);
 static int     fat_close(FAR struct file *filep);
@@ -139,6 +144,49 @@ const struct mountpt_operations fat_operations =
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: fat_clusterrun
+ *
+ * Description:
+ *   Determine how many of the next 'nsectors' sectors of the file lie in
+ *   physically contiguous clusters, beginning with the current sector.
+ *   Cluster n + 1 always maps to the sectors immediately following
+ *   cluster n, so the chain is contiguous for as long as each FAT entry
+ *   refers to the next cluster number.  The returned sector count can be
+ *   transferred with a single multi-sector read or write.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FAT_CLUSTER_RUNS
+static unsigned int fat_clusterrun(FAR struct fat_mountpt_s *fs,
+                                   FAR struct fat_file_s *ff,
+                                   unsigned int nsectors)
+{
+  unsigned int runsectors = ff->ff_sectorsincluster;
+  int32_t cluster         = ff->ff_currentcluster;
+  int32_t next;
+
+  /* Follow the FAT chain for as long as more sectors are needed and the
+   * clusters remain contiguous.  The FAT sector cache keeps the cost of
+   * each look-up low for sequential chains.
+   */
+
+  while (runsectors < nsectors)
+    {
+      next = fat_getcluster(fs, cluster);
+      if (next != cluster + 1 || next >= fs->fs_nclusters)
+        {
+          break;
+        }
+
+      cluster     = next;
+      runsectors += fs->fs_fatsecperclus;
+    }
+
+  return runsectors < nsectors ? runsectors : nsectors;
+}
+#endif /* CONFIG_FAT_CLUSTER_RUNS */
+
 /****************************************************************************
  * Name: fat_open
  ****************************************************************************/
@@ -609,7 +657,16 @@ fat_read_restart:
 
           if (nsectors > ff->ff_sectorsincluster)
             {
+#ifdef CONFIG_FAT_CLUSTER_RUNS
+              /* Check whether the following clusters of the chain are
+               * physically contiguous so that they can be covered by
+               * this same transfer.
+               */
+
+              nsectors = fat_clusterrun(fs, ff, nsectors);
+#else
               nsectors = ff->ff_sectorsincluster;
+#endif
             }
 
           /* We are not sure of the state of the file buffer so
@@ -644,9 +701,25 @@ fat_read_restart:
               goto errout_with_semaphore;
             }
 
+          bytesread = nsectors * fs->fs_hwsectorsize;
+
+#ifdef CONFIG_FAT_CLUSTER_RUNS
+          /* If the transfer extended into following (contiguous) clusters,
+           * then advance the current cluster past each whole cluster that
+           * was consumed.
+           */
+
+          while (nsectors > ff->ff_sectorsincluster)
+            {
+              nsectors                -= ff->ff_sectorsincluster;
+              ff->ff_currentsector    += ff->ff_sectorsincluster;
+              ff->ff_currentcluster++;
+              ff->ff_sectorsincluster  = fs->fs_fatsecperclus;
+            }
+#endif
+
           ff->ff_sectorsincluster -= nsectors;
           ff->ff_currentsector    += nsectors;
-          bytesread                = nsectors * fs->fs_hwsectorsize;
         }
       else
 #endif /* CONFIG_FAT_FORCE_INDIRECT */
@@ -874,7 +947,18 @@ fat_write_restart:
 
           if (nsectors > ff->ff_sectorsincluster)
             {
+#ifdef CONFIG_FAT_CLUSTER_RUNS
+              /* Check whether the following clusters of the chain are
+               * physically contiguous so that they can be covered by
+               * this same transfer.  Only clusters that are already
+               * allocated to the file are combined; the chain is still
+               * extended one cluster at a time.
+               */
+
+              nsectors = fat_clusterrun(fs, ff, nsectors);
+#else
               nsectors = ff->ff_sectorsincluster;
+#endif
             }
 
           /* We are not sure of the state of the sector cache so the
@@ -910,9 +994,25 @@ fat_write_restart:
               goto errout_with_semaphore;
             }
 
+          writesize = nsectors * fs->fs_hwsectorsize;
+
+#ifdef CONFIG_FAT_CLUSTER_RUNS
+          /* If the transfer extended into following (contiguous) clusters,
+           * then advance the current cluster past each whole cluster that
+           * was consumed.
+           */
+
+          while (nsectors > ff->ff_sectorsincluster)
+            {
+              nsectors                -= ff->ff_sectorsincluster;
+              ff->ff_currentsector    += ff->ff_sectorsincluster;
+              ff->ff_currentcluster++;
+              ff->ff_sectorsincluster  = fs->fs_fatsecperclus;
+            }
+#endif
+
           ff->ff_sectorsincluster -= nsectors;
           ff->ff_currentsector    += nsectors;
-          writesize                = nsectors * fs->fs_hwsectorsize;
           ff->ff_bflags           |= FFBUFF_MODIFIED;
         }
       else
@@ -118,6 +118,17 @@ static int     hostfs_rename(FAR struct inode *mountpt,
 static int     hostfs_stat(FAR struct inode *mountpt,
                         FAR const char *relpath, FAR struct stat *buf);
 
+#ifdef CONFIG_FS_HOSTFS_ATTR_CACHE
+static int     hostfs_attr_lookup(FAR struct hostfs_mountpt_s *fs,
+                        FAR const char *relpath, FAR struct stat *buf);
+static void    hostfs_attr_update(FAR struct hostfs_mountpt_s *fs,
+                        FAR const char *relpath,
+                        FAR const struct stat *buf);
+static void    hostfs_attr_invalidate(FAR struct hostfs_mountpt_s *fs);
+#else
+#  define      hostfs_attr_invalidate(fs)
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -247,6 +258,114 @@ static void hostfs_mkpath(FAR struct hostfs_mountpt_s  *fs,
     }
 }
 
+#ifdef CONFIG_FS_HOSTFS_ATTR_CACHE
+/****************************************************************************
+ * Name: hostfs_attr_lookup
+ *
+ * Description: Return the cached attributes of 'relpath', if any entry for
+ *   that path exists and has not yet expired.  The volume semaphore must be
+ *   held by the caller.
+ *
+ ****************************************************************************/
+
+static int hostfs_attr_lookup(FAR struct hostfs_mountpt_s *fs,
+                              FAR const char *relpath, FAR struct stat *buf)
+{
+  FAR struct hostfs_attrcache_s *ac;
+  int i;
+
+  for (i = 0; i < CONFIG_FS_HOSTFS_ATTR_CACHE_SIZE; i++)
+    {
+      ac = &fs->fs_attrcache[i];
+      if (ac->ac_valid && strcmp(ac->ac_relpath, relpath) == 0)
+        {
+          if ((sclock_t)(clock_systime_ticks() - ac->ac_expires) >= 0)
+            {
+              /* The entry has expired */
+
+              ac->ac_valid = false;
+              return -ENOENT;
+            }
+
+          memcpy(buf, &ac->ac_stat, sizeof(struct stat));
+          return OK;
+        }
+    }
+
+  return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: hostfs_attr_update
+ *
+ * Description: Remember the attributes of 'relpath', replacing any previous
+ *   entry for that path.  The volume semaphore must be held by the caller.
+ *
+ ****************************************************************************/
+
+static void hostfs_attr_update(FAR struct hostfs_mountpt_s *fs,
+                               FAR const char *relpath,
+                               FAR const struct stat *buf)
+{
+  FAR struct hostfs_attrcache_s *ac = NULL;
+  int i;
+
+  if (strlen(relpath) >= HOSTFS_MAX_PATH)
+    {
+      return;
+    }
+
+  /* Re-use an existing entry for this path if there is one.  Otherwise,
+   * replace entries in simple round-robin order.
+   */
+
+  for (i = 0; i < CONFIG_FS_HOSTFS_ATTR_CACHE_SIZE; i++)
+    {
+      if (fs->fs_attrcache[i].ac_valid &&
+          strcmp(fs->fs_attrcache[i].ac_relpath, relpath) == 0)
+        {
+          ac = &fs->fs_attrcache[i];
+          break;
+        }
+    }
+
+  if (ac == NULL)
+    {
+      ac = &fs->fs_attrcache[fs->fs_attrnext];
+      if (++fs->fs_attrnext >= CONFIG_FS_HOSTFS_ATTR_CACHE_SIZE)
+        {
+          fs->fs_attrnext = 0;
+        }
+
+      strcpy(ac->ac_relpath, relpath);
+    }
+
+  memcpy(&ac->ac_stat, buf, sizeof(struct stat));
+  ac->ac_expires = clock_systime_ticks() +
+                   MSEC2TICK(CONFIG_FS_HOSTFS_ATTR_CACHE_TTL_MSEC);
+  ac->ac_valid   = true;
+}
+
+/****************************************************************************
+ * Name: hostfs_attr_invalidate
+ *
+ * Description: Discard all cached attributes.  Called whenever the
+ *   namespace is modified through this mountpoint.  The volume semaphore
+ *   must be held by the caller.
+ *
+ ****************************************************************************/
+
+static void hostfs_attr_invalidate(FAR struct hostfs_mountpt_s *fs)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_FS_HOSTFS_ATTR_CACHE_SIZE; i++)
+    {
+      fs->fs_attrcache[i].ac_valid = false;
+    }
+}
+#endif /* CONFIG_FS_HOSTFS_ATTR_CACHE */
+
 /****************************************************************************
  * Name: hostfs_open
  ****************************************************************************/
@@ -322,6 +441,15 @@ static int hostfs_open(FAR struct file *filep, FAR const char *relpath,
         }
     }
 
+  /* Opening for write access may have created or truncated the file, so
+   * any cached attributes for it are now stale.
+   */
+
+  if ((oflags & O_WROK) != 0)
+    {
+      hostfs_attr_invalidate(fs);
+    }
+
   /* Attach the private date to the struct file instance */
 
   filep->f_priv = hf;
@@ -1172,6 +1300,7 @@ static int hostfs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
   /* Call the host fs to perform the unlink */
 
   ret = host_unlink(path);
+  hostfs_attr_invalidate(fs);
 
   hostfs_semgive(fs);
   return ret;
@@ -1212,6 +1341,7 @@ static int hostfs_mkdir(FAR struct inode *mountpt, FAR const char *relpath,
   /* Call the host FS to do the mkdir */
 
   ret = host_mkdir(path, mode);
+  hostfs_attr_invalidate(fs);
 
   hostfs_semgive(fs);
   return ret;
@@ -1253,6 +1383,7 @@ int hostfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
   /* Call the host FS to do the mkdir */
 
   ret = host_rmdir(path);
+  hostfs_attr_invalidate(fs);
 
   hostfs_semgive(fs);
   return ret;
@@ -1297,6 +1428,7 @@ int hostfs_rename(FAR struct inode *mountpt, FAR const char *oldrelpath,
   /* Call the host FS to do the mkdir */
 
   ret = host_rename(oldpath, newpath);
+  hostfs_attr_invalidate(fs);
 
   hostfs_semgive(fs);
   return ret;
@@ -1330,6 +1462,18 @@ static int hostfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
       return ret;
     }
 
+#ifdef CONFIG_FS_HOSTFS_ATTR_CACHE
+  /* Check for recently cached attributes of this path first so that
+   * repeated stat of the same path does not cost one host call each.
+   */
+
+  if (hostfs_attr_lookup(fs, relpath, buf) == OK)
+    {
+      hostfs_semgive(fs);
+      return OK;
+    }
+#endif
+
   /* Append to the host's root directory */
 
   hostfs_mkpath(fs, relpath, path, sizeof(path));
@@ -1338,6 +1482,13 @@ static int hostfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
 
   ret = host_stat(path, buf);
 
+#ifdef CONFIG_FS_HOSTFS_ATTR_CACHE
+  if (ret >= 0)
+    {
+      hostfs_attr_update(fs, relpath, buf);
+    }
+#endif
+
   hostfs_semgive(fs);
   return ret;
 }
@@ -43,9 +43,11 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <stdint.h>
 #include <stdbool.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/semaphore.h>
 
 /****************************************************************************
@@ -80,6 +82,22 @@ struct hostfs_ofile_s
   int                       fd;
 };
 
+#ifdef CONFIG_FS_HOSTFS_ATTR_CACHE
+/* This structure holds one cached stat result.  Entries expire after a
+ * short, configurable time so that changes made directly on the host side
+ * become visible; entries for paths removed or renamed through this
+ * mountpoint are invalidated immediately.
+ */
+
+struct hostfs_attrcache_s
+{
+  char        ac_relpath[HOSTFS_MAX_PATH]; /* Path the attributes belong to */
+  struct stat ac_stat;                     /* The cached attributes */
+  clock_t     ac_expires;                  /* Expiry time, in system ticks */
+  bool        ac_valid;                    /* True: This entry is in use */
+};
+#endif
+
 /* This structure represents the overall mountpoint state.  An instance of
  * this structure is retained as inode private data on each mountpoint that
  * is mounted with a hostfs filesystem.
@@ -90,6 +108,10 @@ struct hostfs_mountpt_s
   sem_t                      *fs_sem;       /* Used to assure thread-safe access */
   FAR struct hostfs_ofile_s  *fs_head;      /* A singly-linked list of open files */
   char                        fs_root[HOSTFS_MAX_PATH];
+#ifdef CONFIG_FS_HOSTFS_ATTR_CACHE
+  struct hostfs_attrcache_s   fs_attrcache[CONFIG_FS_HOSTFS_ATTR_CACHE_SIZE];
+  uint8_t                     fs_attrnext;  /* Next cache entry to replace */
+#endif
 };
 
 /****************************************************************************
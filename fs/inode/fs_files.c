@@ -349,6 +349,7 @@ int files_allocate(FAR struct inode *inode, int oflags, off_t pos, int minfd)
 int files_close(int fd)
 {
   FAR struct filelist *list;
+  struct file          file;
   int                  ret;
 
   /* Get the thread-specific file list.  It should never be NULL in this
@@ -366,13 +367,26 @@ int files_close(int fd)
       return -EBADF;
     }
 
-  /* Perform the protected close operation */
+  /* Detach the descriptor while holding the list semaphore, but perform
+   * the potentially slow driver close operation on the detached copy
+   * after the semaphore has been released.  Other threads of the task
+   * are then free to open and close unrelated descriptors while the
+   * driver close method is in progress.
+   */
 
   ret = _files_semtake(list);
   if (ret >= 0)
     {
-      ret = _files_close(&list->fl_files[fd]);
+      file = list->fl_files[fd];
+
+      list->fl_files[fd].f_oflags = 0;
+      list->fl_files[fd].f_pos    = 0;
+      list->fl_files[fd].f_priv   = NULL;
+      list->fl_files[fd].f_inode  = NULL;
+
       _files_semgive(list);
+
+      ret = _files_close(&file);
     }
 
   return ret;
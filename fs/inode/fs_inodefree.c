@@ -77,6 +77,10 @@ void inode_free(FAR struct inode *node)
       inode_free(node->i_peer);
       inode_free(node->i_child);
 
+      /* Remove any cached look-up results that refer to this inode */
+
+      inode_namecache_purge(node);
+
 #ifdef CONFIG_PSEUDOFS_SOFTLINKS
       /* If the inode is a symbolic link, the free the path to the linked
        * entity.
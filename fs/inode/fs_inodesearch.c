@@ -51,6 +51,32 @@
 
 #include "inode/inode.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+#  define NAMECACHE_NENTRIES CONFIG_PSEUDOFS_NAMECACHE_SIZE
+#  define NAMECACHE_MASK     (NAMECACHE_NENTRIES - 1)
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+/* One entry of the name cache.  The entry caches the result of one
+ * (parent inode, path component) look-up.  An unused entry is marked by
+ * node == NULL.
+ */
+
+struct inode_namecache_s
+{
+  FAR struct inode *parent;  /* Node "above" the cached node */
+  FAR struct inode *node;    /* The cached look-up result */
+};
+#endif
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -69,10 +95,124 @@ static FAR const char *_inode_getcwd(void);
 
 FAR struct inode *g_root_inode = NULL;
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+/* A small, direct-mapped cache of recent (parent inode, path component)
+ * look-up results.  The cache is protected by the same g_inode_sem that
+ * protects the inode tree itself.
+ */
+
+static struct inode_namecache_s g_namecache[NAMECACHE_NENTRIES];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: _namecache_hash
+ *
+ * Description:
+ *   Map a (parent inode, path component) pair to a name cache index.  The
+ *   component ends with either the '/' separator or the NUL terminator so
+ *   that the same hash results whether the name comes from a search path
+ *   or from an inode's i_name.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+static unsigned int _namecache_hash(FAR struct inode *parent,
+                                    FAR const char *name)
+{
+  uint32_t hash = (uint32_t)(uintptr_t)parent;
+
+  while (*name != '\0' && *name != '/')
+    {
+      hash = 31 * hash + (unsigned char)*name++;
+    }
+
+  hash ^= hash >> 16;
+  return hash & NAMECACHE_MASK;
+}
+
+/****************************************************************************
+ * Name: _namecache_add
+ *
+ * Description:
+ *   Remember that looking up the path component 'name' under 'parent'
+ *   resolved to 'node'.  Any previous occupant of the cache entry is
+ *   silently evicted.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore.
+ *
+ ****************************************************************************/
+
+static void _namecache_add(FAR struct inode *parent, FAR const char *name,
+                           FAR struct inode *node)
+{
+  FAR struct inode_namecache_s *entry;
+
+  entry         = &g_namecache[_namecache_hash(parent, name)];
+  entry->parent = parent;
+  entry->node   = node;
+}
+
+/****************************************************************************
+ * Name: _namecache_lookup
+ *
+ * Description:
+ *   Check if a previous look-up of the path component 'name' under
+ *   'parent' has been cached.  A hit is trusted only after verifying that
+ *   the cached inode still carries the name and is still a member of the
+ *   sibling list beginning at 'first':  The verification walk compares
+ *   only pointers, avoiding the per-peer string compares of the normal
+ *   ordered search, and collects the node to the "left" of the result
+ *   which callers of inode_search() depend upon.
+ *
+ * Returned Value:
+ *   The cached inode with '*left' set to its predecessor peer on a
+ *   verified hit; NULL on a miss.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore.
+ *
+ ****************************************************************************/
+
+static FAR struct inode *_namecache_lookup(FAR struct inode *parent,
+                                           FAR const char *name,
+                                           FAR struct inode *first,
+                                           FAR struct inode **left)
+{
+  FAR struct inode_namecache_s *entry;
+  FAR struct inode *prev;
+  FAR struct inode *curr;
+
+  entry = &g_namecache[_namecache_hash(parent, name)];
+  if (entry->node == NULL || entry->parent != parent ||
+      _inode_compare(name, entry->node) != 0)
+    {
+      return NULL;
+    }
+
+  for (prev = NULL, curr = first; curr != NULL; curr = curr->i_peer)
+    {
+      if (curr == entry->node)
+        {
+          *left = prev;
+          return curr;
+        }
+
+      prev = curr;
+    }
+
+  return NULL;
+}
+#endif /* CONFIG_PSEUDOFS_NAMECACHE */
+
 /****************************************************************************
  * Name: _inode_compare
  *
@@ -239,6 +379,9 @@ static int _inode_search(FAR struct inode_search_s *desc)
   FAR struct inode *left    = NULL;
   FAR struct inode *above   = NULL;
   FAR const char   *relpath = NULL;
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+  FAR struct inode *cached;
+#endif
   int ret = -ENOENT;
 
   /* Get the search path, skipping over the leading '/'.  The leading '/' is
@@ -298,6 +441,12 @@ static int _inode_search(FAR struct inode_search_s *desc)
            *       below this one
            */
 
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+          /* Remember this (parent, component) look-up result */
+
+          _namecache_add(above, name, node);
+#endif
+
           name = inode_nextname(name);
           if (*name == '\0' || INODE_IS_MOUNTPT(node))
             {
@@ -403,6 +552,18 @@ static int _inode_search(FAR struct inode_search_s *desc)
               above = node;
               left  = NULL;
               node  = node->i_child;
+
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+              /* A cached look-up of this component may permit us to skip
+               * the ordered sibling scan entirely.
+               */
+
+              cached = _namecache_lookup(above, name, node, &left);
+              if (cached != NULL)
+                {
+                  node = cached;
+                }
+#endif
             }
         }
     }
@@ -458,6 +619,36 @@ static FAR const char *_inode_getcwd(void)
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: inode_namecache_purge
+ *
+ * Description:
+ *   Remove any name cache entries that refer to 'node', either as the
+ *   cached look-up result or as the parent of one.  This must be called
+ *   before the memory backing 'node' is freed; otherwise a later cache
+ *   look-up could dereference the stale inode pointer.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+void inode_namecache_purge(FAR struct inode *node)
+{
+  int i;
+
+  for (i = 0; i < NAMECACHE_NENTRIES; i++)
+    {
+      if (g_namecache[i].node == node || g_namecache[i].parent == node)
+        {
+          g_namecache[i].parent = NULL;
+          g_namecache[i].node   = NULL;
+        }
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: inode_search
  *
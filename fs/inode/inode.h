@@ -252,6 +252,25 @@ int inode_stat(FAR struct inode *inode, FAR struct stat *buf, int resolve);
 
 void inode_free(FAR struct inode *node);
 
+/****************************************************************************
+ * Name: inode_namecache_purge
+ *
+ * Description:
+ *   Remove any name cache entries that refer to 'node', either as the
+ *   cached look-up result or as the parent of one.  This must be called
+ *   before the memory backing 'node' is freed.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PSEUDOFS_NAMECACHE
+void inode_namecache_purge(FAR struct inode *node);
+#else
+#  define inode_namecache_purge(node)
+#endif
+
 /****************************************************************************
  * Name: inode_nextname
  *
@@ -70,6 +70,11 @@ struct nfsnode
   time_t              n_ctime;      /* File creation time */
   nfsfh_t             n_fhandle;    /* NFS File Handle */
   uint64_t            n_size;       /* Current size of file */
+#ifdef CONFIG_NFS_WRITE_BEHIND
+  FAR uint8_t        *n_wrbuffer;   /* Write-behind cluster buffer */
+  uint64_t            n_wroffset;   /* File offset of the buffered data */
+  size_t              n_wrsize;     /* Number of buffered (dirty) bytes */
+#endif
 };
 
 #endif /* __FS_NFS_NFS_NODE_H */
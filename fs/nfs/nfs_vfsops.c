@@ -121,6 +121,14 @@ static int     nfs_fileopen(FAR struct nfsmount *nmp,
                    FAR struct nfsnode *np, FAR const char *relpath,
                    int oflags, mode_t mode);
 
+static ssize_t nfs_writedata(FAR struct nfsmount *nmp,
+                   FAR struct nfsnode *np, uint64_t offset,
+                   FAR const char *buffer, size_t buflen);
+#ifdef CONFIG_NFS_WRITE_BEHIND
+static int     nfs_flushnode(FAR struct nfsmount *nmp,
+                   FAR struct nfsnode *np);
+#endif
+
 static int     nfs_open(FAR struct file *filep, FAR const char *relpath,
                    int oflags, mode_t mode);
 static int     nfs_close(FAR struct file *filep);
@@ -128,6 +136,9 @@ static ssize_t nfs_read(FAR struct file *filep, FAR char *buffer,
                         size_t buflen);
 static ssize_t nfs_write(FAR struct file *filep, FAR const char *buffer,
                    size_t buflen);
+#ifdef CONFIG_NFS_WRITE_BEHIND
+static int     nfs_sync(FAR struct file *filep);
+#endif
 static int     nfs_dup(FAR const struct file *oldp, FAR struct file *newp);
 static int     nfs_fsinfo(FAR struct nfsmount *nmp);
 static int     nfs_fstat(FAR const struct file *filep, FAR struct stat *buf);
@@ -177,7 +188,11 @@ const struct mountpt_operations nfs_operations =
   NULL,                         /* seek */
   NULL,                         /* ioctl */
 
+#ifdef CONFIG_NFS_WRITE_BEHIND
+  nfs_sync,                     /* sync */
+#else
   NULL,                         /* sync */
+#endif
   nfs_dup,                      /* dup */
   nfs_fstat,                    /* fstat */
   nfs_truncate,                 /* truncate */
@@ -557,6 +572,219 @@ static int nfs_fileopen(FAR struct nfsmount *nmp, FAR struct nfsnode *np,
   return OK;
 }
 
+/****************************************************************************
+ * Name: nfs_writedata
+ *
+ * Description:
+ *   Write a block of data to the file at the provided file offset using
+ *   as many WRITE RPCs as necessary.  The caller must hold the mountpoint
+ *   semaphore.  The cached file attributes (including the file size) are
+ *   updated from the WRITE replies.
+ *
+ * Returned Value:
+ *   The (non-negative) number of bytes written on success; a negated errno
+ *   value on failure.
+ *
+ ****************************************************************************/
+
+static ssize_t nfs_writedata(FAR struct nfsmount *nmp,
+                             FAR struct nfsnode *np, uint64_t offset,
+                             FAR const char *buffer, size_t buflen)
+{
+  ssize_t                writesize;
+  ssize_t                bufsize;
+  ssize_t                byteswritten = 0;
+  size_t                 reqlen;
+  FAR uint32_t          *ptr;
+  uint32_t               tmp;
+  int                    commit = 0;
+  int                    committed = NFSV3WRITE_FILESYNC;
+  int                    ret = 0;
+
+  /* Now loop until we send the entire buffer */
+
+  while ((size_t)byteswritten < buflen)
+    {
+      /* Make sure that the attempted write size does not exceed the RPC
+       * maximum.
+       */
+
+      writesize = buflen - byteswritten;
+      if (writesize > nmp->nm_wsize)
+        {
+          writesize = nmp->nm_wsize;
+        }
+
+      /* Make sure that the attempted read size does not exceed the IO
+       * buffer size.
+       */
+
+      bufsize = SIZEOF_rpc_call_write(writesize);
+      if (bufsize > nmp->nm_buflen)
+        {
+          writesize -= (bufsize - nmp->nm_buflen);
+        }
+
+      /* Initialize the request.  Here we need an offset pointer to the write
+       * arguments, skipping over the RPC header.  Write is unique among the
+       * RPC calls in that the entry RPC calls message lies in the I/O buffer
+       */
+
+      ptr     = (FAR uint32_t *)&((FAR struct rpc_call_write *)
+                  nmp->nm_iobuffer)->write;
+      reqlen  = 0;
+
+      /* Copy the variable length, file handle */
+
+      *ptr++  = txdr_unsigned((uint32_t)np->n_fhsize);
+      reqlen += sizeof(uint32_t);
+
+      memcpy(ptr, &np->n_fhandle, np->n_fhsize);
+      reqlen += uint32_alignup(np->n_fhsize);
+      ptr    += uint32_increment(np->n_fhsize);
+
+      /* Copy the file offset */
+
+      txdr_hyper(offset, ptr);
+      ptr    += 2;
+      reqlen += 2*sizeof(uint32_t);
+
+      /* Copy the count and stable values */
+
+      *ptr++  = txdr_unsigned(writesize);
+      *ptr++  = txdr_unsigned(committed);
+      reqlen += 2*sizeof(uint32_t);
+
+      /* Copy a chunk of the user data into the I/O buffer */
+
+      *ptr++  = txdr_unsigned(writesize);
+      reqlen += sizeof(uint32_t);
+      memcpy(ptr, buffer, writesize);
+      reqlen += uint32_alignup(writesize);
+
+      /* Perform the write */
+
+      nfs_statistics(NFSPROC_WRITE);
+      ret = nfs_request(nmp, NFSPROC_WRITE,
+                        (FAR void *)nmp->nm_iobuffer, reqlen,
+                        (FAR void *)&nmp->nm_msgbuffer.write,
+                        sizeof(struct rpc_reply_write));
+      if (ret)
+        {
+          ferr("ERROR: nfs_request failed: %d\n", ret);
+          goto errout;
+        }
+
+      /* Get a pointer to the WRITE reply data */
+
+      ptr = (FAR uint32_t *)&nmp->nm_msgbuffer.write.write;
+
+      /* Parse file_wcc.  First, check if WCC attributes follow. */
+
+      tmp = *ptr++;
+      if (tmp != 0)
+        {
+          /* Yes.. WCC attributes follow.  But we just skip over them. */
+
+          ptr += uint32_increment(sizeof(struct wcc_attr));
+        }
+
+      /* Check if normal file attributes follow */
+
+      tmp = *ptr++;
+      if (tmp != 0)
+        {
+          /* Yes.. Update the cached file status in the file structure. */
+
+          nfs_attrupdate(np, (FAR struct nfs_fattr *)ptr);
+          ptr += uint32_increment(sizeof(struct nfs_fattr));
+        }
+
+      /* Get the count of bytes actually written */
+
+      tmp = fxdr_unsigned(uint32_t, *ptr);
+      ptr++;
+
+      if (tmp < 1 || tmp > writesize)
+        {
+          ret = -EIO;
+          goto errout;
+        }
+
+      writesize = tmp;
+
+      /* Determine the lowest commitment level obtained by any of the RPCs. */
+
+      commit = *ptr++;
+      if (committed == NFSV3WRITE_FILESYNC)
+        {
+          committed = commit;
+        }
+      else if (committed == NFSV3WRITE_DATASYNC &&
+               commit == NFSV3WRITE_UNSTABLE)
+        {
+          committed = commit;
+        }
+
+      /* Update the write state data */
+
+      offset       += writesize;
+      byteswritten += writesize;
+      buffer       += writesize;
+    }
+
+errout:
+  return byteswritten > 0 ? byteswritten : ret;
+}
+
+#ifdef CONFIG_NFS_WRITE_BEHIND
+/****************************************************************************
+ * Name: nfs_flushnode
+ *
+ * Description:
+ *   Write out any data pending in the write-behind cluster buffer of the
+ *   file node.  The caller must hold the mountpoint semaphore.
+ *
+ * Returned Value:
+ *   0 on success; a negated errno value on failure.  On a partial
+ *   failure, the unwritten portion remains in the cluster buffer.
+ *
+ ****************************************************************************/
+
+static int nfs_flushnode(FAR struct nfsmount *nmp, FAR struct nfsnode *np)
+{
+  ssize_t nwritten;
+
+  if (np->n_wrbuffer == NULL || np->n_wrsize == 0)
+    {
+      return OK;
+    }
+
+  nwritten = nfs_writedata(nmp, np, np->n_wroffset,
+                           (FAR const char *)np->n_wrbuffer, np->n_wrsize);
+  if (nwritten < 0)
+    {
+      return (int)nwritten;
+    }
+
+  if ((size_t)nwritten < np->n_wrsize)
+    {
+      /* Only part of the buffered data was written.  Drop the written
+       * prefix and report the failure.
+       */
+
+      memmove(np->n_wrbuffer, &np->n_wrbuffer[nwritten],
+              np->n_wrsize - nwritten);
+      np->n_wroffset += nwritten;
+      np->n_wrsize   -= nwritten;
+      return -EIO;
+    }
+
+  np->n_wrsize = 0;
+  return OK;
+}
+#endif /* CONFIG_NFS_WRITE_BEHIND */
+
 /****************************************************************************
  * Name: nfs_open
  *
@@ -694,6 +922,9 @@ static int nfs_close(FAR struct file *filep)
   FAR struct nfsnode  *np;
   FAR struct nfsnode  *prev;
   FAR struct nfsnode  *curr;
+#ifdef CONFIG_NFS_WRITE_BEHIND
+  int flush;
+#endif
   int ret;
 
   /* Sanity checks */
@@ -715,6 +946,19 @@ static int nfs_close(FAR struct file *filep)
       return ret;
     }
 
+#ifdef CONFIG_NFS_WRITE_BEHIND
+  /* Write out any buffered write data before the file is closed.  The
+   * close proceeds even if the flush fails; the failure is reported after
+   * the node has been released.
+   */
+
+  flush = nfs_flushnode(nmp, np);
+  if (flush < 0)
+    {
+      ferr("ERROR: nfs_flushnode failed: %d\n", flush);
+    }
+#endif
+
   /* Decrement the reference count.  If the reference count would not
    * decrement to zero, then that is all we have to do.
    */
@@ -763,6 +1007,13 @@ static int nfs_close(FAR struct file *filep)
 
               /* Then deallocate the file structure and return success */
 
+#ifdef CONFIG_NFS_WRITE_BEHIND
+              if (np->n_wrbuffer != NULL)
+                {
+                  kmm_free(np->n_wrbuffer);
+                }
+#endif
+
               kmm_free(np);
               ret = OK;
               break;
@@ -772,6 +1023,14 @@ static int nfs_close(FAR struct file *filep)
 
   filep->f_priv = NULL;
   nfs_semgive(nmp);
+
+#ifdef CONFIG_NFS_WRITE_BEHIND
+  if (ret == OK && flush < 0)
+    {
+      ret = flush;
+    }
+#endif
+
   return ret;
 }
 
@@ -791,7 +1050,7 @@ static ssize_t nfs_read(FAR struct file *filep, FAR char *buffer,
   FAR struct nfsnode        *np;
   ssize_t                    readsize;
   ssize_t                    tmp;
-  ssize_t                    bytesread;
+  ssize_t                    bytesread = 0;
   size_t                     reqlen;
   FAR uint32_t              *ptr;
   int                        ret = 0;
@@ -816,6 +1075,16 @@ static ssize_t nfs_read(FAR struct file *filep, FAR char *buffer,
       return (ssize_t)ret;
     }
 
+#ifdef CONFIG_NFS_WRITE_BEHIND
+  /* Write out any buffered write data so that the read sees it */
+
+  ret = nfs_flushnode(nmp, np);
+  if (ret < 0)
+    {
+      goto errout_with_semaphore;
+    }
+#endif
+
   /* Get the number of bytes left in the file and truncate read count so that
    * it does not exceed the number of bytes left in the file.
    */
@@ -961,15 +1230,8 @@ static ssize_t nfs_write(FAR struct file *filep, FAR const char *buffer,
 {
   FAR struct nfsmount   *nmp;
   FAR struct nfsnode    *np;
-  ssize_t                writesize;
-  ssize_t                bufsize;
   ssize_t                byteswritten = 0;
-  size_t                 reqlen;
-  FAR uint32_t          *ptr;
-  uint32_t               tmp;
-  int                    commit = 0;
-  int                    committed = NFSV3WRITE_FILESYNC;
-  int                    ret;
+  int                    ret = 0;
 
   finfo("Write %zu bytes to offset %jd\n",
         buflen, (intmax_t)filep->f_pos);
@@ -999,142 +1261,141 @@ static ssize_t nfs_write(FAR struct file *filep, FAR const char *buffer,
       goto errout_with_semaphore;
     }
 
-  /* Now loop until we send the entire user buffer */
+#ifdef CONFIG_NFS_WRITE_BEHIND
+  /* Allocate the per-file write-behind cluster buffer on first write.  On
+   * an allocation failure, fall back to writing through directly.
+   */
 
-  for (byteswritten = 0; byteswritten < buflen; )
+  if (np->n_wrbuffer == NULL)
     {
-      /* Make sure that the attempted write size does not exceed the RPC
-       * maximum.
-       */
-
-      writesize = buflen - byteswritten;
-      if (writesize > nmp->nm_wsize)
-        {
-          writesize = nmp->nm_wsize;
-        }
+      np->n_wrbuffer = (FAR uint8_t *)kmm_malloc(nmp->nm_wsize);
+    }
 
-      /* Make sure that the attempted read size does not exceed the IO
-       * buffer size.
+  if (np->n_wrbuffer != NULL)
+    {
+      /* If the new data is not contiguous with the buffered data, then
+       * the buffered data must be written out first.
        */
 
-      bufsize = SIZEOF_rpc_call_write(writesize);
-      if (bufsize > nmp->nm_buflen)
+      if (np->n_wrsize > 0 &&
+          (uint64_t)filep->f_pos != np->n_wroffset + np->n_wrsize)
         {
-          writesize -= (bufsize - nmp->nm_buflen);
+          ret = nfs_flushnode(nmp, np);
+          if (ret < 0)
+            {
+              goto errout_with_semaphore;
+            }
         }
 
-      /* Initialize the request.  Here we need an offset pointer to the write
-       * arguments, skipping over the RPC header.  Write is unique among the
-       * RPC calls in that the entry RPC calls message lies in the I/O buffer
+      /* Then accumulate the new data in the cluster buffer, writing out
+       * one full cluster of nm_wsize bytes whenever the buffer fills.
        */
 
-      ptr     = (FAR uint32_t *)&((FAR struct rpc_call_write *)
-                  nmp->nm_iobuffer)->write;
-      reqlen  = 0;
-
-      /* Copy the variable length, file handle */
-
-      *ptr++  = txdr_unsigned((uint32_t)np->n_fhsize);
-      reqlen += sizeof(uint32_t);
-
-      memcpy(ptr, &np->n_fhandle, np->n_fhsize);
-      reqlen += uint32_alignup(np->n_fhsize);
-      ptr    += uint32_increment(np->n_fhsize);
+      while ((size_t)byteswritten < buflen)
+        {
+          size_t space = nmp->nm_wsize - np->n_wrsize;
+          size_t ncopy;
 
-      /* Copy the file offset */
+          if (space == 0)
+            {
+              ret = nfs_flushnode(nmp, np);
+              if (ret < 0)
+                {
+                  goto errout_with_semaphore;
+                }
 
-      txdr_hyper((uint64_t)filep->f_pos, ptr);
-      ptr    += 2;
-      reqlen += 2*sizeof(uint32_t);
+              space = nmp->nm_wsize;
+            }
 
-      /* Copy the count and stable values */
+          if (np->n_wrsize == 0)
+            {
+              np->n_wroffset = (uint64_t)filep->f_pos;
+            }
 
-      *ptr++  = txdr_unsigned(writesize);
-      *ptr++  = txdr_unsigned(committed);
-      reqlen += 2*sizeof(uint32_t);
+          ncopy = buflen - byteswritten;
+          if (ncopy > space)
+            {
+              ncopy = space;
+            }
 
-      /* Copy a chunk of the user data into the I/O buffer */
+          memcpy(&np->n_wrbuffer[np->n_wrsize], &buffer[byteswritten],
+                 ncopy);
 
-      *ptr++  = txdr_unsigned(writesize);
-      reqlen += sizeof(uint32_t);
-      memcpy(ptr, buffer, writesize);
-      reqlen += uint32_alignup(writesize);
+          np->n_wrsize += ncopy;
+          byteswritten += ncopy;
+          filep->f_pos += ncopy;
 
-      /* Perform the write */
+          /* The buffered data may extend the file */
 
-      nfs_statistics(NFSPROC_WRITE);
-      ret = nfs_request(nmp, NFSPROC_WRITE,
-                        (FAR void *)nmp->nm_iobuffer, reqlen,
-                        (FAR void *)&nmp->nm_msgbuffer.write,
-                        sizeof(struct rpc_reply_write));
-      if (ret)
-        {
-          ferr("ERROR: nfs_request failed: %d\n", ret);
-          goto errout_with_semaphore;
+          if ((uint64_t)filep->f_pos > np->n_size)
+            {
+              np->n_size = (uint64_t)filep->f_pos;
+            }
         }
 
-      /* Get a pointer to the WRITE reply data */
-
-      ptr = (FAR uint32_t *)&nmp->nm_msgbuffer.write.write;
+      goto errout_with_semaphore;
+    }
+#endif /* CONFIG_NFS_WRITE_BEHIND */
 
-      /* Parse file_wcc.  First, check if WCC attributes follow. */
+  /* Write the data directly using as many WRITE RPCs as necessary */
 
-      tmp = *ptr++;
-      if (tmp != 0)
-        {
-          /* Yes.. WCC attributes follow.  But we just skip over them. */
-
-          ptr += uint32_increment(sizeof(struct wcc_attr));
-        }
+  byteswritten = nfs_writedata(nmp, np, (uint64_t)filep->f_pos, buffer,
+                               buflen);
+  if (byteswritten < 0)
+    {
+      ret = (int)byteswritten;
+      byteswritten = 0;
+      goto errout_with_semaphore;
+    }
 
-      /* Check if normal file attributes follow */
+  filep->f_pos += byteswritten;
 
-      tmp = *ptr++;
-      if (tmp != 0)
-        {
-          /* Yes.. Update the cached file status in the file structure. */
-
-          nfs_attrupdate(np, (FAR struct nfs_fattr *)ptr);
-          ptr += uint32_increment(sizeof(struct nfs_fattr));
-        }
+errout_with_semaphore:
+  nfs_semgive(nmp);
+  return byteswritten > 0 ? byteswritten : ret;
+}
 
-      /* Get the count of bytes actually written */
+#ifdef CONFIG_NFS_WRITE_BEHIND
+/****************************************************************************
+ * Name: nfs_sync
+ *
+ * Description:
+ *   Flush any buffered write data for the open file to the server.
+ *
+ * Returned Value:
+ *   0 on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
 
-      tmp = fxdr_unsigned(uint32_t, *ptr);
-      ptr++;
+static int nfs_sync(FAR struct file *filep)
+{
+  FAR struct nfsmount *nmp;
+  FAR struct nfsnode  *np;
+  int ret;
 
-      if (tmp < 1 || tmp > writesize)
-        {
-          ret = -EIO;
-          goto errout_with_semaphore;
-        }
+  /* Sanity checks */
 
-      writesize = tmp;
+  DEBUGASSERT(filep->f_priv != NULL && filep->f_inode != NULL);
 
-      /* Determine the lowest commitment level obtained by any of the RPCs. */
+  /* Recover our private data from the struct file instance */
 
-      commit = *ptr++;
-      if (committed == NFSV3WRITE_FILESYNC)
-        {
-          committed = commit;
-        }
-      else if (committed == NFSV3WRITE_DATASYNC &&
-               commit == NFSV3WRITE_UNSTABLE)
-        {
-          committed = commit;
-        }
+  nmp = (FAR struct nfsmount *)filep->f_inode->i_private;
+  np  = (FAR struct nfsnode *)filep->f_priv;
 
-      /* Update the read state data */
+  DEBUGASSERT(nmp != NULL);
 
-      filep->f_pos += writesize;
-      byteswritten += writesize;
-      buffer       += writesize;
+  ret = nfs_semtake(nmp);
+  if (ret < 0)
+    {
+      return ret;
     }
 
-errout_with_semaphore:
+  ret = nfs_flushnode(nmp, np);
+
   nfs_semgive(nmp);
-  return byteswritten > 0 ? byteswritten : ret;
+  return ret;
 }
+#endif /* CONFIG_NFS_WRITE_BEHIND */
 
 /****************************************************************************
  * Name: nfs_dup
@@ -1261,6 +1522,17 @@ static int nfs_truncate(FAR struct file *filep, off_t length)
   ret = nfs_semtake(nmp);
   if (ret >= 0)
     {
+#ifdef CONFIG_NFS_WRITE_BEHIND
+      /* Write out any buffered write data before changing the file size */
+
+      ret = nfs_flushnode(nmp, np);
+      if (ret < 0)
+        {
+          nfs_semgive(nmp);
+          return ret;
+        }
+#endif
+
       /* Then perform the SETATTR RPC to set the new file size */
 
       ret = nfs_filetruncate(nmp, np, length);
@@ -65,9 +65,15 @@ extern const struct procfs_operations proc_operations;
 extern const struct procfs_operations irq_operations;
 extern const struct procfs_operations cpuload_operations;
 extern const struct procfs_operations critmon_operations;
+extern const struct procfs_operations csection_operations;
 extern const struct procfs_operations meminfo_operations;
+extern const struct procfs_operations mempool_procfsoperations;
 extern const struct procfs_operations iobinfo_operations;
 extern const struct procfs_operations module_operations;
+extern const struct procfs_operations pthreadcache_operations;
+extern const struct procfs_operations semboost_operations;
+extern const struct procfs_operations semload_operations;
+extern const struct procfs_operations syscall_operations;
 extern const struct procfs_operations uptime_operations;
 extern const struct procfs_operations version_operations;
 
@@ -82,6 +88,7 @@ extern const struct procfs_operations net_procfs_routeoperations;
 extern const struct procfs_operations part_procfsoperations;
 extern const struct procfs_operations mount_procfsoperations;
 extern const struct procfs_operations smartfs_procfsoperations;
+extern const struct procfs_operations blockcache_procfsoperations;
 
 /****************************************************************************
  * Private Types
@@ -108,7 +115,14 @@ static const struct procfs_entry_s g_procfs_entries[] =
   { "critmon",       &critmon_operations,         PROCFS_FILE_TYPE   },
 #endif
 
+#if defined(CONFIG_SCHED_CSECTION_MONITOR)
+  { "csection",      &csection_operations,        PROCFS_FILE_TYPE   },
+#endif
+
 #ifdef CONFIG_SCHED_IRQMONITOR
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  { "irqhist",       &irq_operations,             PROCFS_FILE_TYPE   },
+#endif
   { "irqs",          &irq_operations,             PROCFS_FILE_TYPE   },
 #endif
 
@@ -116,6 +130,10 @@ static const struct procfs_entry_s g_procfs_entries[] =
   { "meminfo",       &meminfo_operations,         PROCFS_FILE_TYPE   },
 #endif
 
+#ifdef CONFIG_MM_MEMPOOL
+  { "mempool",       &mempool_procfsoperations,   PROCFS_FILE_TYPE   },
+#endif
+
 #if defined(CONFIG_MM_IOB) && !defined(CONFIG_FS_PROCFS_EXCLUDE_IOBINFO)
   { "iobinfo",       &iobinfo_operations,         PROCFS_FILE_TYPE   },
 #endif
@@ -128,6 +146,11 @@ static const struct procfs_entry_s g_procfs_entries[] =
   { "fs/blocks",     &mount_procfsoperations,     PROCFS_FILE_TYPE   },
 #endif
 
+#if defined(CONFIG_FS_BLOCKCACHE) && \
+   !defined(CONFIG_FS_PROCFS_EXCLUDE_BLOCKCACHE)
+  { "fs/blockcache", &blockcache_procfsoperations, PROCFS_FILE_TYPE  },
+#endif
+
 #ifndef CONFIG_FS_PROCFS_EXCLUDE_MOUNT
   { "fs/mount",      &mount_procfsoperations,     PROCFS_FILE_TYPE   },
 #endif
@@ -153,11 +176,27 @@ static const struct procfs_entry_s g_procfs_entries[] =
   { "partitions",    &part_procfsoperations,      PROCFS_FILE_TYPE   },
 #endif
 
+#if defined(CONFIG_PTHREAD_CACHE)
+  { "pthreadcache",  &pthreadcache_operations,    PROCFS_FILE_TYPE   },
+#endif
+
 #ifndef CONFIG_FS_PROCFS_EXCLUDE_PROCESS
   { "self",          &proc_operations,            PROCFS_DIR_TYPE    },
   { "self/**",       &proc_operations,            PROCFS_UNKOWN_TYPE },
 #endif
 
+#if defined(CONFIG_SEM_BOOST_STATS)
+  { "semboost",      &semboost_operations,        PROCFS_FILE_TYPE   },
+#endif
+
+#if defined(CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE)
+  { "semload",       &semload_operations,         PROCFS_FILE_TYPE   },
+#endif
+
+#if defined(CONFIG_SYSCALL_PERF)
+  { "syscalls",      &syscall_operations,         PROCFS_FILE_TYPE   },
+#endif
+
 #if !defined(CONFIG_FS_PROCFS_EXCLUDE_UPTIME)
   { "uptime",        &uptime_operations,          PROCFS_FILE_TYPE   },
 #endif
@@ -278,6 +278,9 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
 {
   FAR struct iobinfo_file_s *iobfile;
   FAR struct iob_userstats_s *userstats;
+#ifdef CONFIG_IOB_OWNER_TRACKING
+  struct iob_ownerinfo_s ownerinfo;
+#endif
   size_t linesize;
   size_t copysize;
   size_t totalsize;
@@ -296,8 +299,14 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
 
   /* The first line is the headers */
 
+#ifdef CONFIG_IOB_OWNER_TRACKING
+  linesize  = snprintf(iobfile->line, IOBINFO_LINELEN,
+                       "                           TOTAL           TOTAL"
+                       "    LIVE      OLDEST\n");
+#else
   linesize  = snprintf(iobfile->line, IOBINFO_LINELEN,
                        "                           TOTAL           TOTAL\n");
+#endif
 
   copysize  = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
                             &offset);
@@ -308,9 +317,15 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
       buffer    += copysize;
       buflen    -= copysize;
 
+#ifdef CONFIG_IOB_OWNER_TRACKING
+      linesize  = snprintf(iobfile->line, IOBINFO_LINELEN,
+                           "        USER            CONSUMED        "
+                           "PRODUCED    HELD   AGE TICKS\n");
+#else
       linesize  = snprintf(iobfile->line, IOBINFO_LINELEN,
                            "        USER            CONSUMED        "
                            "PRODUCED\n");
+#endif
 
       copysize  = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
                                 &offset);
@@ -327,11 +342,22 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
           buflen    -= copysize;
 
           userstats  = iob_getuserstats(i);
+#ifdef CONFIG_IOB_OWNER_TRACKING
+          iob_owner_getinfo(i, &ownerinfo);
+          linesize   = snprintf(iobfile->line, IOBINFO_LINELEN,
+                                "%-16s%16lu%16lu%8u%12lu\n",
+                                g_iob_user_names[i],
+                                (unsigned long)userstats->totalconsumed,
+                                (unsigned long)userstats->totalproduced,
+                                (unsigned int)ownerinfo.live,
+                                (unsigned long)ownerinfo.oldest);
+#else
           linesize   = snprintf(iobfile->line, IOBINFO_LINELEN,
                                 "%-16s%16lu%16lu\n",
                                 g_iob_user_names[i],
                                 (unsigned long)userstats->totalconsumed,
                                 (unsigned long)userstats->totalproduced);
+#endif
 
           copysize   = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
                                      &offset);
@@ -345,11 +371,22 @@ static ssize_t iobinfo_read(FAR struct file *filep, FAR char *buffer,
       buflen    -= copysize;
 
       userstats  = iob_getuserstats(IOBUSER_GLOBAL);
+#ifdef CONFIG_IOB_OWNER_TRACKING
+      iob_owner_getinfo(IOBUSER_GLOBAL, &ownerinfo);
+      linesize   = snprintf(iobfile->line, IOBINFO_LINELEN,
+                            "\n%-16s%16lu%16lu%8u%12lu\n",
+                            g_iob_user_names[IOBUSER_GLOBAL],
+                            (unsigned long)userstats->totalconsumed,
+                            (unsigned long)userstats->totalproduced,
+                            (unsigned int)ownerinfo.live,
+                            (unsigned long)ownerinfo.oldest);
+#else
       linesize   = snprintf(iobfile->line, IOBINFO_LINELEN,
                             "\n%-16s%16lu%16lu\n",
                             g_iob_user_names[IOBUSER_GLOBAL],
                             (unsigned long)userstats->totalconsumed,
                             (unsigned long)userstats->totalproduced);
+#endif
 
       copysize   = procfs_memcpy(iobfile->line, linesize, buffer, buflen,
                                  &offset);
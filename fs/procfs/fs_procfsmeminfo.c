@@ -87,6 +87,11 @@ struct progmem_info_s
 #if defined(CONFIG_ARCH_HAVE_PROGMEM) && defined(CONFIG_FS_PROCFS_INCLUDE_PROGMEM)
 static void    meminfo_progmem(FAR struct progmem_info_s *progmem);
 #endif
+#ifdef CONFIG_MM_HEAP_STATS
+static size_t  meminfo_heapstats(FAR struct meminfo_file_s *procfile,
+                 FAR const char *label, FAR struct mm_heap_s *heap,
+                 FAR char *buffer, size_t buflen, FAR off_t *offset);
+#endif
 
 /* File system methods */
 
@@ -188,6 +193,99 @@ static void meminfo_progmem(FAR struct progmem_info_s *progmem)
 }
 #endif
 
+/****************************************************************************
+ * Name: meminfo_heapstats
+ *
+ * Description:
+ *   Output the incrementally maintained telemetry of one heap:  the free
+ *   byte count, the largest-free-chunk estimate, the allocation size
+ *   histogram and, if enabled, the sampled allocation call sites.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MM_HEAP_STATS
+static size_t meminfo_heapstats(FAR struct meminfo_file_s *procfile,
+                                FAR const char *label,
+                                FAR struct mm_heap_s *heap,
+                                FAR char *buffer, size_t buflen,
+                                FAR off_t *offset)
+{
+  struct mm_stats_s stats;
+  size_t linesize;
+  size_t copysize;
+  size_t totalsize = 0;
+  int i;
+
+  mm_stats(heap, &stats);
+
+  linesize   = snprintf(procfile->line, MEMINFO_LINELEN,
+                        "%s: free %10lu largest <= %10lu\n", label,
+                        (unsigned long)stats.mm_freebytes,
+                        (unsigned long)stats.mm_maxfree);
+  copysize   = procfs_memcpy(procfile->line, linesize, buffer, buflen,
+                             offset);
+  totalsize += copysize;
+  buffer    += copysize;
+  buflen    -= copysize;
+
+  /* The allocation size histogram, one line per non-empty size class */
+
+  for (i = 0; i < MM_NNODES && totalsize < buflen; i++)
+    {
+      if (stats.mm_nallocs[i] == 0)
+        {
+          continue;
+        }
+
+      linesize   = snprintf(procfile->line, MEMINFO_LINELEN,
+                            "%s: <= %10lu: %10lu allocs\n", label,
+                            (unsigned long)1 << (i + MM_MIN_SHIFT + 1),
+                            (unsigned long)stats.mm_nallocs[i]);
+      copysize   = procfs_memcpy(procfile->line, linesize, buffer, buflen,
+                                 offset);
+      totalsize += copysize;
+      buffer    += copysize;
+      buflen    -= copysize;
+    }
+
+#ifdef CONFIG_MM_HEAP_STATS_PROFILER
+  /* The sampled allocation call sites */
+
+  for (i = 0; i < CONFIG_MM_HEAP_STATS_NSITES && totalsize < buflen; i++)
+    {
+      if (stats.mm_sites[i].ms_callsite == NULL)
+        {
+          continue;
+        }
+
+      linesize   = snprintf(procfile->line, MEMINFO_LINELEN,
+                            "%s: site %p %8lu allocs %10lu\n", label,
+                            stats.mm_sites[i].ms_callsite,
+                            (unsigned long)stats.mm_sites[i].ms_count,
+                            (unsigned long)stats.mm_sites[i].ms_bytes);
+      copysize   = procfs_memcpy(procfile->line, linesize, buffer, buflen,
+                                 offset);
+      totalsize += copysize;
+      buffer    += copysize;
+      buflen    -= copysize;
+    }
+
+  if (stats.mm_othercount > 0 && totalsize < buflen)
+    {
+      linesize   = snprintf(procfile->line, MEMINFO_LINELEN,
+                            "%s: other   %10lu allocs %10lu\n", label,
+                            (unsigned long)stats.mm_othercount,
+                            (unsigned long)stats.mm_otherbytes);
+      copysize   = procfs_memcpy(procfile->line, linesize, buffer, buflen,
+                                 offset);
+      totalsize += copysize;
+    }
+#endif
+
+  return totalsize;
+}
+#endif
+
 /****************************************************************************
  * Name: meminfo_open
  ****************************************************************************/
@@ -333,6 +431,34 @@ static ssize_t meminfo_read(FAR struct file *filep, FAR char *buffer,
     }
 #endif
 
+#if defined(CONFIG_MM_HEAP_STATS) && defined(CONFIG_MM_KERNEL_HEAP)
+  if (totalsize < buflen)
+    {
+      buffer    += copysize;
+      buflen    -= copysize;
+
+      /* Show the kernel heap telemetry (first arena) */
+
+      copysize   = meminfo_heapstats(procfile, "KStat", &g_kmmheap[0],
+                                     buffer, buflen, &offset);
+      totalsize += copysize;
+    }
+#endif
+
+#if defined(CONFIG_MM_HEAP_STATS) && defined(CONFIG_BUILD_FLAT)
+  if (totalsize < buflen)
+    {
+      buffer    += copysize;
+      buflen    -= copysize;
+
+      /* Show the user heap telemetry */
+
+      copysize   = meminfo_heapstats(procfile, "UStat", &g_mmheap,
+                                     buffer, buflen, &offset);
+      totalsize += copysize;
+    }
+#endif
+
 #ifdef CONFIG_MM_PGALLOC
   if (totalsize < buflen)
     {
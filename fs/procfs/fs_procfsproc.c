@@ -127,6 +127,10 @@ struct proc_file_s
   struct procfs_file_s base;          /* Base open file structure */
   FAR const struct proc_node_s *node; /* Describes the file node */
   pid_t pid;                          /* Task/thread ID */
+#ifdef CONFIG_FS_PROCFS_SNAPSHOT
+  FAR char *snapshot;                 /* Cached file content (or NULL) */
+  size_t snaplen;                     /* Number of valid snapshot bytes */
+#endif
   char line[STATUS_LINELEN];          /* Pre-allocated buffer for formatted lines */
 };
 
@@ -199,6 +203,9 @@ static ssize_t proc_groupenv(FAR struct proc_file_s *procfile,
                  FAR struct tcb_s *tcb, FAR char *buffer, size_t buflen,
                  off_t offset);
 #endif
+static ssize_t proc_generate(FAR struct proc_file_s *procfile,
+                 FAR struct tcb_s *tcb, FAR char *buffer, size_t buflen,
+                 off_t offset);
 
 /* File system methods */
 
@@ -445,6 +452,7 @@ static FAR const struct proc_node_s *proc_findnode(FAR const char *relpath)
  *   Priority:   nnn                Decimal, 0-255
  *   Scheduler:  xxxxxxxxxxxxxx     {SCHED_FIFO, SCHED_RR, SCHED_SPORADIC,
  *                                   SCHED_OTHER}
+ *   BudgetEx:   nnnn               Budget exhaustions (SCHED_SPORADIC only)
  *   Sigmask:    nnnnnnnn           Hexadecimal, 32-bit
  *
  ****************************************************************************/
@@ -631,6 +639,29 @@ static ssize_t proc_status(FAR struct proc_file_s *procfile,
       return totalsize;
     }
 
+#ifdef CONFIG_SCHED_SPORADIC
+  /* Show the number of budget exhaustions of a sporadic thread */
+
+  if ((tcb->flags & TCB_FLAG_POLICY_MASK) == TCB_FLAG_SCHED_SPORADIC)
+    {
+      DEBUGASSERT(tcb->sporadic != NULL);
+      linesize   = snprintf(procfile->line, STATUS_LINELEN,
+                            "%-12s%" PRIu32 "\n", "BudgetEx:",
+                            tcb->sporadic->exhaustions);
+      copysize   = procfs_memcpy(procfile->line, linesize, buffer,
+                                 remaining, &offset);
+
+      totalsize += copysize;
+      buffer    += copysize;
+      remaining -= copysize;
+
+      if (totalsize >= buflen)
+        {
+          return totalsize;
+        }
+    }
+#endif
+
   /* Show the signal mask. Note: sigset_t is uint32_t on NuttX. */
 
   linesize = snprintf(procfile->line, STATUS_LINELEN, "%-12s%08" PRIx32 "\n",
@@ -802,7 +833,7 @@ static ssize_t proc_critmon(FAR struct proc_file_s *procfile,
 
   if (tcb->premp_max > 0)
     {
-      up_critmon_convert(tcb->premp_max, &maxtime);
+      up_perf_convert(tcb->premp_max, &maxtime);
     }
   else
     {
@@ -835,7 +866,7 @@ static ssize_t proc_critmon(FAR struct proc_file_s *procfile,
 
   if (tcb->crit_max > 0)
     {
-      up_critmon_convert(tcb->crit_max, &maxtime);
+      up_perf_convert(tcb->crit_max, &maxtime);
     }
   else
     {
@@ -1277,6 +1308,54 @@ static ssize_t proc_groupenv(FAR struct proc_file_s *procfile,
 }
 #endif
 
+/****************************************************************************
+ * Name: proc_generate
+ *
+ * Description:
+ *   Generate the content of the selected file node, beginning at the given
+ *   offset within the file.
+ *
+ ****************************************************************************/
+
+static ssize_t proc_generate(FAR struct proc_file_s *procfile,
+                             FAR struct tcb_s *tcb, FAR char *buffer,
+                             size_t buflen, off_t offset)
+{
+  switch (procfile->node->node)
+    {
+    case PROC_STATUS: /* Task/thread status */
+      return proc_status(procfile, tcb, buffer, buflen, offset);
+
+    case PROC_CMDLINE: /* Task command line */
+      return proc_cmdline(procfile, tcb, buffer, buflen, offset);
+
+#ifdef CONFIG_SCHED_CPULOAD
+    case PROC_LOADAVG: /* Average CPU utilization */
+      return proc_loadavg(procfile, tcb, buffer, buflen, offset);
+#endif
+#ifdef CONFIG_SCHED_CRITMONITOR
+    case PROC_CRITMON: /* Critical section monitor */
+      return proc_critmon(procfile, tcb, buffer, buflen, offset);
+#endif
+    case PROC_STACK: /* Task stack info */
+      return proc_stack(procfile, tcb, buffer, buflen, offset);
+
+    case PROC_GROUP_STATUS: /* Task group status */
+      return proc_groupstatus(procfile, tcb, buffer, buflen, offset);
+
+    case PROC_GROUP_FD: /* Group file descriptors */
+      return proc_groupfd(procfile, tcb, buffer, buflen, offset);
+
+#if !defined(CONFIG_DISABLE_ENVIRON) && !defined(CONFIG_FS_PROCFS_EXCLUDE_ENVIRON)
+    case PROC_GROUP_ENV: /* Group environment variables */
+      return proc_groupenv(procfile, tcb, buffer, buflen, offset);
+#endif
+
+    default:
+      return -EINVAL;
+    }
+}
+
 /****************************************************************************
  * Name: proc_open
  ****************************************************************************/
@@ -1407,6 +1486,13 @@ static int proc_close(FAR struct file *filep)
 
   /* Release the file container structure */
 
+#ifdef CONFIG_FS_PROCFS_SNAPSHOT
+  if (procfile->snapshot != NULL)
+    {
+      kmm_free(procfile->snapshot);
+    }
+#endif
+
   kmm_free(procfile);
   filep->f_priv = NULL;
   return OK;
@@ -1439,51 +1525,69 @@ static ssize_t proc_read(FAR struct file *filep, FAR char *buffer,
       return -ENODEV;
     }
 
-  /* Provide the requested data */
+#ifdef CONFIG_FS_PROCFS_SNAPSHOT
+  /* On the first read of the open file, generate the full file content once
+   * into a per-open snapshot buffer.  Subsequent reads are then satisfied
+   * with a simple copy from the snapshot instead of re-running the full
+   * formatting logic for every chunk.
+   */
 
-  switch (procfile->node->node)
+  if (procfile->snapshot == NULL && filep->f_pos == 0)
     {
-    case PROC_STATUS: /* Task/thread status */
-      ret = proc_status(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
+      FAR char *snapshot;
 
-    case PROC_CMDLINE: /* Task command line */
-      ret = proc_cmdline(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
+      snapshot = (FAR char *)
+        kmm_malloc(CONFIG_FS_PROCFS_SNAPSHOT_BUFSIZE);
+      if (snapshot != NULL)
+        {
+          ret = proc_generate(procfile, tcb, snapshot,
+                              CONFIG_FS_PROCFS_SNAPSHOT_BUFSIZE, 0);
+          if (ret < 0)
+            {
+              kmm_free(snapshot);
+              return ret;
+            }
 
-#ifdef CONFIG_SCHED_CPULOAD
-    case PROC_LOADAVG: /* Average CPU utilization */
-      ret = proc_loadavg(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
-#endif
-#ifdef CONFIG_SCHED_CRITMONITOR
-    case PROC_CRITMON: /* Critical section monitor */
-      ret = proc_critmon(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
-#endif
-    case PROC_STACK: /* Task stack info */
-      ret = proc_stack(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
+          procfile->snapshot = snapshot;
+          procfile->snaplen  = (size_t)ret;
+        }
+    }
 
-    case PROC_GROUP_STATUS: /* Task group status */
-      ret = proc_groupstatus(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
+  /* Serve the read from the snapshot unless the snapshot may have been
+   * truncated (it filled the entire buffer) and the read begins beyond
+   * the cached content.
+   */
 
-    case PROC_GROUP_FD: /* Group file descriptors */
-      ret = proc_groupfd(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
+  if (procfile->snapshot != NULL &&
+      ((size_t)filep->f_pos < procfile->snaplen ||
+       procfile->snaplen < CONFIG_FS_PROCFS_SNAPSHOT_BUFSIZE))
+    {
+      size_t copysize = 0;
 
-#if !defined(CONFIG_DISABLE_ENVIRON) && !defined(CONFIG_FS_PROCFS_EXCLUDE_ENVIRON)
-    case PROC_GROUP_ENV: /* Group environment variables */
-      ret = proc_groupenv(procfile, tcb, buffer, buflen, filep->f_pos);
-      break;
-#endif
+      if ((size_t)filep->f_pos < procfile->snaplen)
+        {
+          copysize = procfile->snaplen - (size_t)filep->f_pos;
+          if (copysize > buflen)
+            {
+              copysize = buflen;
+            }
 
-     default:
-      ret = -EINVAL;
-      break;
+          memcpy(buffer, &procfile->snapshot[filep->f_pos], copysize);
+        }
+
+      filep->f_pos += copysize;
+      return copysize;
     }
 
+  /* Otherwise (the snapshot was truncated or could not be allocated),
+   * fall back to generating the content for this read directly.
+   */
+#endif
+
+  /* Provide the requested data */
+
+  ret = proc_generate(procfile, tcb, buffer, buflen, filep->f_pos);
+
   /* Update the file offset */
 
   if (ret > 0)
@@ -1527,6 +1631,15 @@ static int proc_dup(FAR const struct file *oldp, FAR struct file *newp)
 
   memcpy(newfile, oldfile, sizeof(struct proc_file_s));
 
+#ifdef CONFIG_FS_PROCFS_SNAPSHOT
+  /* The snapshot buffer is not shared; the duplicated file will generate
+   * its content on demand.
+   */
+
+  newfile->snapshot = NULL;
+  newfile->snaplen  = 0;
+#endif
+
   /* Save the new container in the new file structure */
 
   newp->f_priv = (FAR void *)newfile;
@@ -0,0 +1,305 @@
+/****************************************************************************
+ * fs/procfs/fs_procfssemboost.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS) && \
+     defined(CONFIG_SEM_BOOST_STATS)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic.
+ */
+
+#define SEMBOOST_LINELEN 40
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct semboost_file_s
+{
+  struct procfs_file_s base;     /* Base open file structure */
+  unsigned int linesize;         /* Number of valid characters in line[] */
+  char line[SEMBOOST_LINELEN];   /* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int     semboost_open(FAR struct file *filep,
+                 FAR const char *relpath, int oflags, mode_t mode);
+static int     semboost_close(FAR struct file *filep);
+static ssize_t semboost_read(FAR struct file *filep, FAR char *buffer,
+                 size_t buflen);
+static int     semboost_dup(FAR const struct file *oldp,
+                 FAR struct file *newp);
+static int     semboost_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations semboost_operations =
+{
+  semboost_open,      /* open */
+  semboost_close,     /* close */
+  semboost_read,      /* read */
+  NULL,               /* write */
+
+  semboost_dup,       /* dup */
+
+  NULL,               /* opendir */
+  NULL,               /* closedir */
+  NULL,               /* readdir */
+  NULL,               /* rewinddir */
+
+  semboost_stat       /* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: semboost_open
+ ****************************************************************************/
+
+static int semboost_open(FAR struct file *filep, FAR const char *relpath,
+                         int oflags, mode_t mode)
+{
+  FAR struct semboost_file_s *attr;
+
+  finfo("Open '%s'\n", relpath);
+
+  /* PROCFS is read-only.  Any attempt to open with any kind of write
+   * access is not permitted.
+   */
+
+  if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0)
+    {
+      ferr("ERROR: Only O_RDONLY supported\n");
+      return -EACCES;
+    }
+
+  /* "semboost" is the only acceptable value for the relpath */
+
+  if (strcmp(relpath, "semboost") != 0)
+    {
+      ferr("ERROR: relpath is '%s'\n", relpath);
+      return -ENOENT;
+    }
+
+  /* Allocate a container to hold the file attributes */
+
+  attr = kmm_zalloc(sizeof(struct semboost_file_s));
+  if (!attr)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* Save the attributes as the open-specific state in filep->f_priv */
+
+  filep->f_priv = (FAR void *)attr;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: semboost_close
+ ****************************************************************************/
+
+static int semboost_close(FAR struct file *filep)
+{
+  FAR struct semboost_file_s *attr;
+
+  /* Recover our private data from the struct file instance */
+
+  attr = (FAR struct semboost_file_s *)filep->f_priv;
+  DEBUGASSERT(attr);
+
+  /* Release the file attributes structure */
+
+  kmm_free(attr);
+  filep->f_priv = NULL;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: semboost_read
+ *
+ * Description:
+ *   Report the priority boost statistics accumulated by the priority
+ *   inheritance logic.
+ *
+ ****************************************************************************/
+
+static ssize_t semboost_read(FAR struct file *filep, FAR char *buffer,
+                             size_t buflen)
+{
+  FAR struct semboost_file_s *attr;
+  size_t linesize;
+  size_t copysize;
+  size_t totalsize;
+  off_t offset;
+
+  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+  /* Recover our private data from the struct file instance */
+
+  attr = (FAR struct semboost_file_s *)filep->f_priv;
+  DEBUGASSERT(attr);
+
+  offset    = filep->f_pos;
+  totalsize = 0;
+
+  linesize  = snprintf(attr->line, SEMBOOST_LINELEN,
+                       "BOOSTS:   %10" PRIu32 "\n",
+                       g_sem_boost_stats.nboosts);
+  copysize  = procfs_memcpy(attr->line, linesize, buffer, buflen, &offset);
+  totalsize += copysize;
+
+  linesize  = snprintf(attr->line, SEMBOOST_LINELEN,
+                       "CHAINED:  %10" PRIu32 "\n",
+                       g_sem_boost_stats.nchains);
+  copysize  = procfs_memcpy(attr->line, linesize, buffer + totalsize,
+                            buflen - totalsize, &offset);
+  totalsize += copysize;
+
+  linesize  = snprintf(attr->line, SEMBOOST_LINELEN,
+                       "MAXDEPTH: %10u\n",
+                       (unsigned int)g_sem_boost_stats.maxdepth);
+  copysize  = procfs_memcpy(attr->line, linesize, buffer + totalsize,
+                            buflen - totalsize, &offset);
+  totalsize += copysize;
+
+  /* Update the file offset */
+
+  if (totalsize > 0)
+    {
+      filep->f_pos += totalsize;
+    }
+
+  return totalsize;
+}
+
+/****************************************************************************
+ * Name: semboost_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int semboost_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+  FAR struct semboost_file_s *oldattr;
+  FAR struct semboost_file_s *newattr;
+
+  finfo("Dup %p->%p\n", oldp, newp);
+
+  /* Recover our private data from the old struct file instance */
+
+  oldattr = (FAR struct semboost_file_s *)oldp->f_priv;
+  DEBUGASSERT(oldattr);
+
+  /* Allocate a new container to hold the task and attribute selection */
+
+  newattr = kmm_malloc(sizeof(struct semboost_file_s));
+  if (!newattr)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* The copy the file attributes from the old attributes to the new */
+
+  memcpy(newattr, oldattr, sizeof(struct semboost_file_s));
+
+  /* Save the new attributes in the new file structure */
+
+  newp->f_priv = (FAR void *)newattr;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: semboost_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int semboost_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+  /* "semboost" is the only acceptable value for the relpath */
+
+  if (strcmp(relpath, "semboost") != 0)
+    {
+      ferr("ERROR: relpath is '%s'\n", relpath);
+      return -ENOENT;
+    }
+
+  /* "semboost" is the name for a read-only file */
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS &&
+        * CONFIG_SEM_BOOST_STATS */
@@ -0,0 +1,351 @@
+/****************************************************************************
+ * fs/procfs/fs_procfssemload.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+#include <nuttx/sched_note.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic (and the size of the
+ * whole report, which is generated when the file is first read).
+ */
+
+#define SEMLOAD_LINELEN 64
+#define SEMLOAD_BUFLEN \
+  ((CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE_NENTRIES + 1) * SEMLOAD_LINELEN)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct semload_file_s
+{
+  struct procfs_file_s base;    /* Base open file structure */
+  unsigned int linesize;        /* Number of valid characters in line[] */
+  char line[SEMLOAD_BUFLEN];    /* Pre-allocated buffer for the report */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int     semload_open(FAR struct file *filep, FAR const char *relpath,
+                 int oflags, mode_t mode);
+static int     semload_close(FAR struct file *filep);
+static ssize_t semload_read(FAR struct file *filep, FAR char *buffer,
+                 size_t buflen);
+static int     semload_dup(FAR const struct file *oldp,
+                 FAR struct file *newp);
+static int     semload_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations semload_operations =
+{
+  semload_open,      /* open */
+  semload_close,     /* close */
+  semload_read,      /* read */
+  NULL,              /* write */
+
+  semload_dup,       /* dup */
+
+  NULL,              /* opendir */
+  NULL,              /* closedir */
+  NULL,              /* readdir */
+  NULL,              /* rewinddir */
+
+  semload_stat       /* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: semload_open
+ ****************************************************************************/
+
+static int semload_open(FAR struct file *filep, FAR const char *relpath,
+                        int oflags, mode_t mode)
+{
+  FAR struct semload_file_s *attr;
+
+  finfo("Open '%s'\n", relpath);
+
+  /* PROCFS is read-only.  Any attempt to open with any kind of write
+   * access is not permitted.
+   */
+
+  if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0)
+    {
+      ferr("ERROR: Only O_RDONLY supported\n");
+      return -EACCES;
+    }
+
+  /* "semload" is the only acceptable value for the relpath */
+
+  if (strcmp(relpath, "semload") != 0)
+    {
+      ferr("ERROR: relpath is '%s'\n", relpath);
+      return -ENOENT;
+    }
+
+  /* Allocate a container to hold the file attributes */
+
+  attr = kmm_zalloc(sizeof(struct semload_file_s));
+  if (!attr)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* Save the attributes as the open-specific state in filep->f_priv */
+
+  filep->f_priv = (FAR void *)attr;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: semload_close
+ ****************************************************************************/
+
+static int semload_close(FAR struct file *filep)
+{
+  FAR struct semload_file_s *attr;
+
+  /* Recover our private data from the struct file instance */
+
+  attr = (FAR struct semload_file_s *)filep->f_priv;
+  DEBUGASSERT(attr);
+
+  /* Release the file attributes structure */
+
+  kmm_free(attr);
+  filep->f_priv = NULL;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: semload_read
+ ****************************************************************************/
+
+static ssize_t semload_read(FAR struct file *filep, FAR char *buffer,
+                            size_t buflen)
+{
+  FAR struct semload_file_s *attr;
+  size_t linesize;
+  off_t offset;
+  ssize_t ret;
+
+  finfo("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+  /* Recover our private data from the struct file instance */
+
+  attr = (FAR struct semload_file_s *)filep->f_priv;
+  DEBUGASSERT(attr);
+
+  /* If f_pos is zero, then generate the report.  Otherwise, use the
+   * report generated by the previous read() so that the report remains
+   * stable even if the user reads it one byte at a time.
+   */
+
+  if (filep->f_pos == 0)
+    {
+      struct note_semstat_s
+        stats[CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE_NENTRIES];
+      int nstats;
+      int best;
+      int i;
+      int j;
+
+      /* Snapshot the contention summary */
+
+      for (nstats = 0; ; nstats++)
+        {
+          if (sched_note_semstats(nstats, &stats[nstats]) < 0 ||
+              stats[nstats].sem == NULL)
+            {
+              break;
+            }
+        }
+
+      /* Report the most contended semaphores first (simple selection
+       * sort by total blocked time; the table is small).
+       */
+
+      linesize = snprintf(attr->line, SEMLOAD_BUFLEN,
+                          "%-*s %10s %10s %10s\n",
+                          (int)(2 * sizeof(uintptr_t)), "SEMAPHORE",
+                          "BLOCKS", "TICKS", "MAXTICKS");
+
+      for (i = 0; i < nstats; i++)
+        {
+          struct note_semstat_s tmp;
+
+          best = i;
+          for (j = i + 1; j < nstats; j++)
+            {
+              if (stats[j].ticks > stats[best].ticks)
+                {
+                  best = j;
+                }
+            }
+
+          tmp          = stats[i];
+          stats[i]     = stats[best];
+          stats[best]  = tmp;
+
+          linesize += snprintf(&attr->line[linesize],
+                               SEMLOAD_BUFLEN - linesize,
+                               "%0*" PRIxPTR " %10" PRIu32 " %10" PRIu32
+                               " %10" PRIu32 "\n",
+                               (int)(2 * sizeof(uintptr_t)),
+                               (uintptr_t)stats[i].sem,
+                               stats[i].nblocked, stats[i].ticks,
+                               stats[i].maxticks);
+        }
+
+      /* Save the line size in case we are re-entered with f_pos > 0 */
+
+      attr->linesize = linesize;
+    }
+
+  /* Transfer the report to the user receive buffer */
+
+  offset = filep->f_pos;
+  ret = procfs_memcpy(attr->line, attr->linesize, buffer, buflen, &offset);
+
+  /* Update the file offset */
+
+  if (ret > 0)
+    {
+      filep->f_pos += ret;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: semload_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int semload_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+  FAR struct semload_file_s *oldattr;
+  FAR struct semload_file_s *newattr;
+
+  finfo("Dup %p->%p\n", oldp, newp);
+
+  /* Recover our private data from the old struct file instance */
+
+  oldattr = (FAR struct semload_file_s *)oldp->f_priv;
+  DEBUGASSERT(oldattr);
+
+  /* Allocate a new container to hold the task and attribute selection */
+
+  newattr = kmm_malloc(sizeof(struct semload_file_s));
+  if (!newattr)
+    {
+      ferr("ERROR: Failed to allocate file attributes\n");
+      return -ENOMEM;
+    }
+
+  /* The copy the file attributes from the old attributes to the new */
+
+  memcpy(newattr, oldattr, sizeof(struct semload_file_s));
+
+  /* Save the new attributes in the new file structure */
+
+  newp->f_priv = (FAR void *)newattr;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: semload_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int semload_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+  /* "semload" is the only acceptable value for the relpath */
+
+  if (strcmp(relpath, "semload") != 0)
+    {
+      ferr("ERROR: relpath is '%s'\n", relpath);
+      return -ENOENT;
+    }
+
+  /* "semload" is the name for a read-only file */
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+  return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#endif /* CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE */
+#endif /* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
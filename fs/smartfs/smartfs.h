@@ -319,6 +319,22 @@ struct smartfs_ofile_s
                                            */
 };
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+/* This structure defines one cached directory entry location.  The cache
+ * does not retain the entry itself, only the logical sector of the
+ * directory sector that contains it.  The sector is re-read and the name
+ * verified before a cached location is trusted, so a stale entry costs at
+ * most one extra sector read and can never return bad data.
+ */
+
+struct smartfs_centry_s
+{
+  uint16_t          dfirst;       /* 1st sector of the parent directory */
+  uint16_t          dsector;      /* Directory sector containing the entry */
+  char              name[CONFIG_SMARTFS_MAXNAMLEN + 1]; /* Entry name */
+};
+#endif
+
 /* This structure represents the overall mountpoint state.  An instance of
  * this structure is retained as inode private data on each mountpoint that
  * is mounted with a smartfs filesystem.
@@ -337,6 +353,10 @@ struct smartfs_mountpt_s
   char                       *fs_rwbuffer;   /* Read/Write working buffer */
   char                       *fs_workbuffer; /* Working buffer */
   uint8_t                     fs_rootsector; /* Root directory sector num */
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+  FAR struct smartfs_centry_s *fs_entrycache; /* Entry location cache */
+  uint16_t                    fs_centnext;   /* Next cache slot to replace */
+#endif
 };
 
 /****************************************************************************
@@ -398,6 +418,17 @@ uint32_t smartfs_rdle32(FAR const void *val);
 
 void smartfs_wrle32(uint8_t *dest, uint32_t val);
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+uint16_t smartfs_centry_lookup(FAR struct smartfs_mountpt_s *fs,
+        uint16_t dfirst, FAR const char *name);
+
+void smartfs_centry_add(FAR struct smartfs_mountpt_s *fs, uint16_t dfirst,
+        FAR const char *name, uint16_t dsector);
+
+void smartfs_centry_remove(FAR struct smartfs_mountpt_s *fs,
+        uint16_t dfirst, FAR const char *name);
+#endif
+
 #if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SMARTFS)
 struct smartfs_mountpt_s *smartfs_get_first_mount(void);
 #endif
@@ -1990,6 +1990,15 @@ int smartfs_rename(struct inode *mountpt, const char *oldrelpath,
                ret, readwrite.logsector);
           goto errout_with_semaphore;
         }
+
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+      /* Forget any cached location for the old entry */
+
+      if (oldentry.name != NULL)
+        {
+          smartfs_centry_remove(fs, oldentry.dfirst, oldentry.name);
+        }
+#endif
     }
   else
     {
@@ -178,6 +178,148 @@ void smartfs_wrle32(uint8_t *dest, uint32_t val)
   smartfs_wrle16(dest + 2, (uint16_t)(val >> 16));
 }
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+/****************************************************************************
+ * Name: smartfs_centry_lookup
+ *
+ * Description:
+ *   Search the entry location cache for the named entry in the directory
+ *   whose first sector is dfirst.
+ *
+ * Input Parameters:
+ *   fs     - Pointer to smartfs mountpoint structure.
+ *   dfirst - First logical sector of the parent directory.
+ *   name   - Name of the entry to look up.
+ *
+ * Returned Value:
+ *   The logical sector number where the entry was last seen, or 0xffff if
+ *   there is no cached location for the entry.
+ *
+ ****************************************************************************/
+
+uint16_t smartfs_centry_lookup(FAR struct smartfs_mountpt_s *fs,
+                               uint16_t dfirst, FAR const char *name)
+{
+  FAR struct smartfs_centry_s *centry;
+  int i;
+
+  if (fs->fs_entrycache == NULL)
+    {
+      return 0xffff;
+    }
+
+  for (i = 0; i < CONFIG_SMARTFS_ENTRY_CACHE_ENTRIES; i++)
+    {
+      centry = &fs->fs_entrycache[i];
+      if (centry->dfirst == dfirst && strcmp(centry->name, name) == 0)
+        {
+          return centry->dsector;
+        }
+    }
+
+  return 0xffff;
+}
+
+/****************************************************************************
+ * Name: smartfs_centry_add
+ *
+ * Description:
+ *   Record the directory sector in which the named entry was found or
+ *   created.  If the cache is full, the oldest slot is recycled.
+ *
+ * Input Parameters:
+ *   fs      - Pointer to smartfs mountpoint structure.
+ *   dfirst  - First logical sector of the parent directory.
+ *   name    - Name of the entry.
+ *   dsector - Logical sector of the directory sector holding the entry.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void smartfs_centry_add(FAR struct smartfs_mountpt_s *fs, uint16_t dfirst,
+                        FAR const char *name, uint16_t dsector)
+{
+  FAR struct smartfs_centry_s *centry;
+  int i;
+
+  if (fs->fs_entrycache == NULL ||
+      strlen(name) > CONFIG_SMARTFS_MAXNAMLEN)
+    {
+      return;
+    }
+
+  /* If the entry is already cached, just update it in place */
+
+  for (i = 0; i < CONFIG_SMARTFS_ENTRY_CACHE_ENTRIES; i++)
+    {
+      centry = &fs->fs_entrycache[i];
+      if (centry->dfirst == dfirst && strcmp(centry->name, name) == 0)
+        {
+          centry->dsector = dsector;
+          return;
+        }
+    }
+
+  /* Not cached.  Replace the next victim slot (simple round robin) */
+
+  centry = &fs->fs_entrycache[fs->fs_centnext];
+  if (++fs->fs_centnext >= CONFIG_SMARTFS_ENTRY_CACHE_ENTRIES)
+    {
+      fs->fs_centnext = 0;
+    }
+
+  centry->dfirst  = dfirst;
+  centry->dsector = dsector;
+  strncpy(centry->name, name, CONFIG_SMARTFS_MAXNAMLEN);
+  centry->name[CONFIG_SMARTFS_MAXNAMLEN] = '\0';
+}
+
+/****************************************************************************
+ * Name: smartfs_centry_remove
+ *
+ * Description:
+ *   Remove any cached location for the named entry.  Called when an entry
+ *   is deleted or renamed so that the slot can be reused immediately.
+ *
+ * Input Parameters:
+ *   fs     - Pointer to smartfs mountpoint structure.
+ *   dfirst - First logical sector of the parent directory.
+ *   name   - Name of the entry.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void smartfs_centry_remove(FAR struct smartfs_mountpt_s *fs,
+                           uint16_t dfirst, FAR const char *name)
+{
+  FAR struct smartfs_centry_s *centry;
+  int i;
+
+  if (fs->fs_entrycache == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < CONFIG_SMARTFS_ENTRY_CACHE_ENTRIES; i++)
+    {
+      centry = &fs->fs_entrycache[i];
+      if (centry->dfirst == dfirst && strcmp(centry->name, name) == 0)
+        {
+          /* Sector 0 is the format sector and is never a directory, so it
+           * marks the slot as unused.
+           */
+
+          centry->dfirst  = 0;
+          centry->name[0] = '\0';
+        }
+    }
+}
+#endif /* CONFIG_SMARTFS_ENTRY_CACHE */
+
 /****************************************************************************
  * Name: smartfs_mount
  *
@@ -303,6 +445,17 @@ int smartfs_mount(struct smartfs_mountpt_s *fs, bool writeable)
 
 #endif /* CONFIG_SMARTFS_MULTI_ROOT_DIRS */
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+  /* Allocate the (bounded) directory entry location cache.  The cache is
+   * only an accelerator, so the mount proceeds if the allocation fails.
+   */
+
+  fs->fs_entrycache = (FAR struct smartfs_centry_s *)
+    kmm_zalloc(CONFIG_SMARTFS_ENTRY_CACHE_ENTRIES *
+               sizeof(struct smartfs_centry_s));
+  fs->fs_centnext = 0;
+#endif
+
   /* We did it! */
 
   fs->fs_mounted = TRUE;
@@ -455,6 +608,16 @@ int smartfs_unmount(struct smartfs_mountpt_s *fs)
   kmm_free(fs->fs_workbuffer);
 #endif
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+  /* The entry location cache is per-mount and is never shared */
+
+  if (fs->fs_entrycache != NULL)
+    {
+      kmm_free(fs->fs_entrycache);
+      fs->fs_entrycache = NULL;
+    }
+#endif
+
   return ret;
 }
 
@@ -490,6 +653,10 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
   struct      smartfs_chain_header_s *header;
   struct      smart_read_write_s readwrite;
   struct      smartfs_entry_header_s *entry;
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+  bool        usehint = false;
+  uint16_t    hintsector;
+#endif
 
   /* Set the initial value of the output */
 
@@ -591,6 +758,22 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
 
           offset = 0xffff;
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+          /* Check for a cached location of this name in this directory.
+           * The hint only selects the first sector to scan; the name must
+           * still be found there, so a stale hint is harmless.
+           */
+
+          usehint    = false;
+          hintsector = smartfs_centry_lookup(fs, dirstack[depth],
+                                             fs->fs_workbuffer);
+          if (hintsector != 0xffff)
+            {
+              dirsector = hintsector;
+              usehint   = true;
+            }
+#endif
+
 #if CONFIG_SMARTFS_ERASEDSTATE == 0xff
           while (dirsector != 0xffff)
 #else
@@ -606,6 +789,20 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
               ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long) &readwrite);
               if (ret < 0)
                 {
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+                  if (usehint)
+                    {
+                      /* The cached sector is gone.  Drop the hint and
+                       * restart with a full scan of the directory chain.
+                       */
+
+                      smartfs_centry_remove(fs, dirstack[depth],
+                                            fs->fs_workbuffer);
+                      dirsector = dirstack[depth];
+                      usehint   = false;
+                      continue;
+                    }
+#endif
                   goto errout;
                 }
 
@@ -737,6 +934,14 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
                                 }
                             }
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+                          /* Remember where we found this entry */
+
+                          smartfs_centry_add(fs, dirstack[depth],
+                                             fs->fs_workbuffer,
+                                             direntry->dsector);
+#endif
+
                           *parentdirsector = dirstack[depth];
                           *filename = segment;
                           ret = OK;
@@ -771,6 +976,14 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
                               goto errout;
                             }
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+                          /* Remember where we found this directory */
+
+                          smartfs_centry_add(fs, dirstack[depth],
+                                             fs->fs_workbuffer,
+                                             readwrite.logsector);
+#endif
+
 #ifdef CONFIG_SMARTFS_ALIGNED_ACCESS
                           dirstack[++depth] =
                             smartfs_rdle16(&entry->firstsector);
@@ -795,6 +1008,20 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs,
                 {
                   break;
                 }
+
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+              /* A hinted sector that no longer contains the name is stale.
+               * Drop the hint and restart with a full scan of the chain.
+               */
+
+              if (usehint)
+                {
+                  smartfs_centry_remove(fs, dirstack[depth],
+                                        fs->fs_workbuffer);
+                  dirsector = dirstack[depth];
+                  usehint   = false;
+                }
+#endif
             }
 
           /* If we found a dir entry, then continue searching */
@@ -1111,6 +1338,12 @@ int smartfs_createentry(FAR struct smartfs_mountpt_s *fs,
   memset(direntry->name, 0, fs->fs_llformat.namesize + 1);
   strncpy(direntry->name, filename, fs->fs_llformat.namesize);
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+  /* Remember where the new entry was created */
+
+  smartfs_centry_add(fs, parentdirsector, filename, psector);
+#endif
+
   ret = OK;
 
 errout:
@@ -1225,6 +1458,15 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs,
       goto errout;
     }
 
+#ifdef CONFIG_SMARTFS_ENTRY_CACHE
+  /* Forget any cached location for this entry */
+
+  if (entry->name != NULL)
+    {
+      smartfs_centry_remove(fs, entry->dfirst, entry->name);
+    }
+#endif
+
   /* Test if any entries in this sector are being used */
 
   if ((entry->dsector != fs->fs_rootsector) &&
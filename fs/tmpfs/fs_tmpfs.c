@@ -51,9 +51,11 @@
 #  warning CONFIG_FS_TMPFS_DIRECTORY_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
+#ifndef CONFIG_FS_TMPFS_CHUNKED
 #if CONFIG_FS_TMPFS_FILE_FREEGUARD <= CONFIG_FS_TMPFS_FILE_ALLOCGUARD
 #  warning CONFIG_FS_TMPFS_FILE_FREEGUARD needs to be > ALLOCGUARD
 #endif
+#endif
 
 #define tmpfs_lock_file(tfo) \
            (tmpfs_lock_object((FAR struct tmpfs_object_s *)tfo))
@@ -80,6 +82,13 @@ static int  tmpfs_realloc_directory(FAR struct tmpfs_directory_s **tdo,
               unsigned int nentries);
 static int  tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo,
               size_t newsize);
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+static void tmpfs_read_data(FAR struct tmpfs_file_s *tfo, off_t offset,
+              FAR uint8_t *dest, size_t len);
+static void tmpfs_write_data(FAR struct tmpfs_file_s *tfo, off_t offset,
+              FAR const uint8_t *src, size_t len);
+#endif
+static void tmpfs_free_file(FAR struct tmpfs_file_s *tfo);
 static void tmpfs_release_lockedobject(FAR struct tmpfs_object_s *to);
 static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo);
 static int  tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo,
@@ -348,6 +357,120 @@ static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s **tdo,
  * Name: tmpfs_realloc_file
  ****************************************************************************/
 
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+static int tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo,
+                              size_t newsize)
+{
+  FAR struct tmpfs_file_s *oldtfo = *tfo;
+  FAR uint8_t **table;
+  size_t newblocks = TMPFS_NBLOCKS(newsize);
+  size_t oldblocks = oldtfo->tfo_nblocks;
+  size_t newcap;
+  size_t i;
+
+  /* Are we growing or shrinking the file?  NOTE that in either case the
+   * file object itself is not reallocated:  The object address is stable
+   * and existing file data is never moved or copied.
+   */
+
+  if (newblocks > oldblocks)
+    {
+      /* Growing.. First extend the chunk table (if necessary).  The table
+       * is sized in granules of TMPFS_BLKTABLE_GUARD entries to account
+       * for frequent reallocations.
+       */
+
+      if (newblocks > oldtfo->tfo_blkcap)
+        {
+          newcap = TMPFS_BLKTABLE_CAP(newblocks);
+          table  = (FAR uint8_t **)
+            kmm_realloc(oldtfo->tfo_blocks, newcap * sizeof(FAR uint8_t *));
+          if (table == NULL)
+            {
+              return -ENOMEM;
+            }
+
+          oldtfo->tfo_alloc +=
+            (newcap - oldtfo->tfo_blkcap) * sizeof(FAR uint8_t *);
+          oldtfo->tfo_blocks = table;
+          oldtfo->tfo_blkcap = newcap;
+        }
+
+      /* Then allocate the new data chunks */
+
+      for (i = oldblocks; i < newblocks; i++)
+        {
+          oldtfo->tfo_blocks[i] =
+            (FAR uint8_t *)kmm_malloc(CONFIG_FS_TMPFS_CHUNKSIZE);
+          if (oldtfo->tfo_blocks[i] == NULL)
+            {
+              /* Free any chunks that we just added and fail the resize */
+
+              while (i > oldblocks)
+                {
+                  kmm_free(oldtfo->tfo_blocks[--i]);
+                  oldtfo->tfo_alloc -= CONFIG_FS_TMPFS_CHUNKSIZE;
+                }
+
+              return -ENOMEM;
+            }
+
+          oldtfo->tfo_alloc += CONFIG_FS_TMPFS_CHUNKSIZE;
+        }
+
+      oldtfo->tfo_nblocks = newblocks;
+    }
+  else if (newblocks < oldblocks)
+    {
+      /* Shrinking.. Free the chunks that lie beyond the new end of the
+       * file.
+       */
+
+      for (i = newblocks; i < oldblocks; i++)
+        {
+          kmm_free(oldtfo->tfo_blocks[i]);
+          oldtfo->tfo_alloc -= CONFIG_FS_TMPFS_CHUNKSIZE;
+        }
+
+      oldtfo->tfo_nblocks = newblocks;
+
+      /* Shrink the chunk table too if it has a lot of excess capacity.
+       * Failure to shrink the table is not an error; we just keep the
+       * larger table.
+       */
+
+      if (oldtfo->tfo_blkcap - newblocks >= 2 * TMPFS_BLKTABLE_GUARD)
+        {
+          newcap = TMPFS_BLKTABLE_CAP(newblocks);
+          if (newcap > 0)
+            {
+              table = (FAR uint8_t **)
+                kmm_realloc(oldtfo->tfo_blocks,
+                            newcap * sizeof(FAR uint8_t *));
+              if (table != NULL)
+                {
+                  oldtfo->tfo_alloc -=
+                    (oldtfo->tfo_blkcap - newcap) * sizeof(FAR uint8_t *);
+                  oldtfo->tfo_blocks = table;
+                  oldtfo->tfo_blkcap = newcap;
+                }
+            }
+          else
+            {
+              kmm_free(oldtfo->tfo_blocks);
+              oldtfo->tfo_alloc -=
+                oldtfo->tfo_blkcap * sizeof(FAR uint8_t *);
+              oldtfo->tfo_blocks = NULL;
+              oldtfo->tfo_blkcap = 0;
+            }
+        }
+    }
+
+  oldtfo->tfo_size = newsize;
+  return OK;
+}
+
+#else
 static int tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo,
                               size_t newsize)
 {
@@ -412,6 +535,110 @@ static int tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo,
   *tfo              = newtfo;
   return OK;
 }
+#endif /* CONFIG_FS_TMPFS_CHUNKED */
+
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+/****************************************************************************
+ * Name: tmpfs_read_data
+ ****************************************************************************/
+
+static void tmpfs_read_data(FAR struct tmpfs_file_s *tfo, off_t offset,
+                            FAR uint8_t *dest, size_t len)
+{
+  size_t blkno;
+  size_t blkoff;
+  size_t ncopy;
+
+  /* Copy the data from the file chunks, one chunk at a time */
+
+  while (len > 0)
+    {
+      blkno  = offset / CONFIG_FS_TMPFS_CHUNKSIZE;
+      blkoff = offset % CONFIG_FS_TMPFS_CHUNKSIZE;
+
+      ncopy  = CONFIG_FS_TMPFS_CHUNKSIZE - blkoff;
+      if (ncopy > len)
+        {
+          ncopy = len;
+        }
+
+      memcpy(dest, &tfo->tfo_blocks[blkno][blkoff], ncopy);
+
+      dest   += ncopy;
+      offset += ncopy;
+      len    -= ncopy;
+    }
+}
+
+/****************************************************************************
+ * Name: tmpfs_write_data
+ ****************************************************************************/
+
+static void tmpfs_write_data(FAR struct tmpfs_file_s *tfo, off_t offset,
+                             FAR const uint8_t *src, size_t len)
+{
+  size_t blkno;
+  size_t blkoff;
+  size_t ncopy;
+
+  /* Copy the data into the file chunks, one chunk at a time.  A NULL
+   * source buffer zero-fills the file region instead.
+   */
+
+  while (len > 0)
+    {
+      blkno  = offset / CONFIG_FS_TMPFS_CHUNKSIZE;
+      blkoff = offset % CONFIG_FS_TMPFS_CHUNKSIZE;
+
+      ncopy  = CONFIG_FS_TMPFS_CHUNKSIZE - blkoff;
+      if (ncopy > len)
+        {
+          ncopy = len;
+        }
+
+      if (src != NULL)
+        {
+          memcpy(&tfo->tfo_blocks[blkno][blkoff], src, ncopy);
+          src += ncopy;
+        }
+      else
+        {
+          memset(&tfo->tfo_blocks[blkno][blkoff], 0, ncopy);
+        }
+
+      offset += ncopy;
+      len    -= ncopy;
+    }
+}
+#endif /* CONFIG_FS_TMPFS_CHUNKED */
+
+/****************************************************************************
+ * Name: tmpfs_free_file
+ ****************************************************************************/
+
+static void tmpfs_free_file(FAR struct tmpfs_file_s *tfo)
+{
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+  size_t i;
+
+  /* Free the file data chunks and the chunk table */
+
+  for (i = 0; i < tfo->tfo_nblocks; i++)
+    {
+      kmm_free(tfo->tfo_blocks[i]);
+    }
+
+  if (tfo->tfo_blocks != NULL)
+    {
+      kmm_free(tfo->tfo_blocks);
+    }
+#endif
+
+  /* Then free the file object itself */
+
+  nxsem_destroy(&tfo->tfo_exclsem.ts_sem);
+  kmm_free(tfo);
+}
 
 /****************************************************************************
  * Name: tmpfs_release_lockedobject
@@ -448,8 +675,7 @@ static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo)
 
   if (tfo->tfo_refs == 1 && (tfo->tfo_flags & TFO_FLAG_UNLINKED) != 0)
     {
-      nxsem_destroy(&tfo->tfo_exclsem.ts_sem);
-      kmm_free(tfo);
+      tmpfs_free_file(tfo);
     }
 
   /* Otherwise, just decrement the reference count on the file object */
@@ -491,6 +717,7 @@ static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
 {
   int index;
   int last;
+  int i;
 
   /* Search the list of directory entries for a match */
 
@@ -507,27 +734,21 @@ static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
       kmm_free(tdo->tdo_entry[index].tde_name);
     }
 
-  /* Remove by replacing this entry with the final directory entry */
+  /* Remove by compacting the following directory entries down over the
+   * removed entry.  This preserves the ascending sequence number order
+   * of the entries on which readdir() positioning depends.
+   */
 
   last = tdo->tdo_nentries - 1;
-  if (index != last)
+  for (i = index; i < last; i++)
     {
-      FAR struct tmpfs_dirent_s *newtde;
-      FAR struct tmpfs_dirent_s *oldtde;
-      FAR struct tmpfs_object_s *to;
-
       /* Move the directory entry */
 
-      newtde             = &tdo->tdo_entry[index];
-      oldtde             = &tdo->tdo_entry[last];
-      to                 = oldtde->tde_object;
-
-      newtde->tde_object = to;
-      newtde->tde_name   = oldtde->tde_name;
+      tdo->tdo_entry[i] = tdo->tdo_entry[i + 1];
 
       /* Reset the backward link to the directory entry */
 
-      to->to_dirent      = newtde;
+      tdo->tdo_entry[i].tde_object->to_dirent = &tdo->tdo_entry[i];
     }
 
   /* And decrement the count of directory entries */
@@ -581,6 +802,7 @@ static int tmpfs_add_dirent(FAR struct tmpfs_directory_s **tdo,
   tde             = &newtdo->tdo_entry[index];
   tde->tde_object = to;
   tde->tde_name   = newname;
+  tde->tde_seq    = newtdo->tdo_seq++;
 
   /* Add backward link to the directory entry to the object */
 
@@ -599,7 +821,11 @@ static FAR struct tmpfs_file_s *tmpfs_alloc_file(void)
 
   /* Create a new zero length file object */
 
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+  allocsize = sizeof(struct tmpfs_file_s);
+#else
   allocsize = SIZEOF_TMPFS_FILE(CONFIG_FS_TMPFS_FILE_ALLOCGUARD);
+#endif
   tfo = (FAR struct tmpfs_file_s *)kmm_malloc(allocsize);
   if (tfo == NULL)
     {
@@ -616,6 +842,12 @@ static FAR struct tmpfs_file_s *tmpfs_alloc_file(void)
   tfo->tfo_flags = 0;
   tfo->tfo_size  = 0;
 
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+  tfo->tfo_nblocks = 0;
+  tfo->tfo_blkcap  = 0;
+  tfo->tfo_blocks  = NULL;
+#endif
+
   tfo->tfo_exclsem.ts_holder = getpid();
   tfo->tfo_exclsem.ts_count  = 1;
   nxsem_init(&tfo->tfo_exclsem.ts_sem, 0, 0);
@@ -781,6 +1013,7 @@ static FAR struct tmpfs_directory_s *tmpfs_alloc_directory(void)
   tdo->tdo_type     = TMPFS_DIRECTORY;
   tdo->tdo_refs     = 0;
   tdo->tdo_nentries = 0;
+  tdo->tdo_seq      = 0;
 
   tdo->tdo_exclsem.ts_holder = TMPFS_NO_HOLDER;
   tdo->tdo_exclsem.ts_count  = 0;
@@ -1232,28 +1465,24 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
       kmm_free(tdo->tdo_entry[index].tde_name);
     }
 
-  /* Remove by replacing this entry with the final directory entry */
+  /* Remove by compacting the following directory entries down over the
+   * removed entry.  This preserves the ascending sequence number order
+   * of the entries on which readdir() positioning depends.
+   */
 
   tde  = &tdo->tdo_entry[index];
   to   = tde->tde_object;
   last = tdo->tdo_nentries - 1;
 
-  if (index != last)
+  for (; index < last; index++)
     {
-      FAR struct tmpfs_dirent_s *oldtde;
-      FAR struct tmpfs_object_s *oldto;
-
       /* Move the directory entry */
 
-      oldtde           = &tdo->tdo_entry[last];
-      oldto            = oldtde->tde_object;
-
-      tde->tde_object  = oldto;
-      tde->tde_name    = oldtde->tde_name;
+      tdo->tdo_entry[index] = tdo->tdo_entry[index + 1];
 
       /* Reset the backward link to the directory entry */
 
-      oldto->to_dirent = tde;
+      tdo->tdo_entry[index].tde_object->to_dirent = &tdo->tdo_entry[index];
     }
 
   /* And decrement the count of directory entries */
@@ -1275,9 +1504,14 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
           tfo->tfo_flags |= TFO_FLAG_UNLINKED;
           return TMPFS_UNLINKED;
         }
+
+      /* Free the file object now */
+
+      tmpfs_free_file(tfo);
+      return TMPFS_DELETED;
     }
 
-  /* Free the object now */
+  /* Free the directory object now */
 
   nxsem_destroy(&to->to_exclsem.ts_sem);
   kmm_free(to);
@@ -1561,7 +1795,7 @@ static int tmpfs_close(FAR struct file *filep)
        * have any other references.
        */
 
-      kmm_free(tfo);
+      tmpfs_free_file(tfo);
       return OK;
     }
 
@@ -1614,7 +1848,11 @@ static ssize_t tmpfs_read(FAR struct file *filep, FAR char *buffer,
 
   /* Copy data from the memory object to the user buffer */
 
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+  tmpfs_read_data(tfo, startpos, (FAR uint8_t *)buffer, nread);
+#else
   memcpy(buffer, &tfo->tfo_data[startpos], nread);
+#endif
   filep->f_pos += nread;
 
   /* Release the lock on the file */
@@ -1671,9 +1909,13 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
       filep->f_priv = tfo;
     }
 
-  /* Copy data from the memory object to the user buffer */
+  /* Copy data from the user buffer to the memory object */
 
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+  tmpfs_write_data(tfo, startpos, (FAR const uint8_t *)buffer, nwritten);
+#else
   memcpy(&tfo->tfo_data[startpos], buffer, nwritten);
+#endif
   filep->f_pos += nwritten;
 
   /* Release the lock on the file */
@@ -1768,12 +2010,20 @@ static int tmpfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 
   if (cmd == FIOC_MMAP && ppv != NULL)
     {
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+      /* Chunked file data is not contiguous in memory so there is no
+       * single base address that could be mapped.
+       */
+
+      return -ENOSYS;
+#else
       /* Return the address on the media corresponding to the start of
        * the file.
        */
 
       *ppv = (FAR void *)tfo->tfo_data;
       return OK;
+#endif
     }
 
   ferr("ERROR: Invalid cmd: %d\n", cmd);
@@ -1906,7 +2156,11 @@ static int tmpfs_truncate(FAR struct file *filep, off_t length)
 
       if (length > oldsize)
         {
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+          tmpfs_write_data(tfo, oldsize, NULL, length - oldsize);
+#else
           memset(&tfo->tfo_data[oldsize], 0, length - oldsize);
+#endif
         }
 
       ret = OK;
@@ -1961,8 +2215,8 @@ static int tmpfs_opendir(FAR struct inode *mountpt, FAR const char *relpath,
   ret = tmpfs_find_directory(fs, relpath, &tdo, NULL);
   if (ret >= 0)
     {
-      dir->u.tmpfs.tf_tdo   = tdo;
-      dir->u.tmpfs.tf_index = 0;
+      dir->u.tmpfs.tf_tdo = tdo;
+      dir->u.tmpfs.tf_seq = 0;
 
       tmpfs_unlock_directory(tdo);
     }
@@ -2019,9 +2273,20 @@ static int tmpfs_readdir(FAR struct inode *mountpt,
 
   tmpfs_lock_directory(tdo);
 
+  /* Find the first entry that has not yet been returned, i.e., the first
+   * entry with a sequence number at or beyond the read position.  The
+   * entries are in ascending sequence number order so entries removed by
+   * a concurrent directory modification are simply passed over and
+   * entries that have already been returned can never re-appear.
+   */
+
+  for (index = 0;
+       index < tdo->tdo_nentries &&
+       tdo->tdo_entry[index].tde_seq < dir->u.tmpfs.tf_seq;
+       index++);
+
   /* Have we reached the end of the directory? */
 
-  index = dir->u.tmpfs.tf_index;
   if (index >= tdo->tdo_nentries)
     {
       /* We signal the end of the directory by returning the special error:
@@ -2059,9 +2324,9 @@ static int tmpfs_readdir(FAR struct inode *mountpt,
 
       strncpy(dir->fd_dir.d_name, tde->tde_name, NAME_MAX + 1);
 
-      /* Increment the index for next time */
+      /* Advance the read position past this entry for next time */
 
-      dir->u.tmpfs.tf_index = index + 1;
+      dir->u.tmpfs.tf_seq = tde->tde_seq + 1;
       ret = OK;
     }
 
@@ -2079,9 +2344,9 @@ static int tmpfs_rewinddir(FAR struct inode *mountpt,
   finfo("mountpt: %p dir: %p\n",  mountpt, dir);
   DEBUGASSERT(mountpt != NULL && dir != NULL);
 
-  /* Set the readdir index to zero */
+  /* Rewind to the beginning of the directory */
 
-  dir->u.tmpfs.tf_index = 0;
+  dir->u.tmpfs.tf_seq = 0;
   return OK;
 }
 
@@ -2333,8 +2598,7 @@ static int tmpfs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
 
   else
     {
-      nxsem_destroy(&tfo->tfo_exclsem.ts_sem);
-      kmm_free(tfo);
+      tmpfs_free_file(tfo);
     }
 
   /* Release the reference and lock on the parent directory */
@@ -90,12 +90,21 @@ struct tmpfs_sem_s
   uint16_t ts_count;     /* Number of counts held */
 };
 
-/* The form of one directory entry */
+/* The form of one directory entry.
+ *
+ * Each entry carries the sequence number that was assigned when it was
+ * added to its parent directory.  Sequence numbers increase monotonically
+ * so that the entries of a directory are always in ascending sequence
+ * order.  readdir() positions are expressed as sequence numbers rather
+ * than array indices so that directory modifications do not cause
+ * in-progress directory scans to skip or repeat entries.
+ */
 
 struct tmpfs_dirent_s
 {
   FAR struct tmpfs_object_s *tde_object;
   FAR char *tde_name;
+  uint32_t tde_seq;      /* Sequence number of this entry */
 };
 
 /* The generic form of a TMPFS memory object */
@@ -126,6 +135,7 @@ struct tmpfs_directory_s
   /* Remaining fields are unique to a directory object */
 
   uint16_t tdo_nentries; /* Number of directory entries */
+  uint32_t tdo_seq;      /* Sequence number for the next entry added */
   struct tmpfs_dirent_s tdo_entry[1];
 };
 
@@ -155,10 +165,31 @@ struct tmpfs_file_s
 
   uint8_t  tfo_flags;    /* See TFO_FLAG_* definitions */
   size_t   tfo_size;     /* Valid file size */
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+  size_t   tfo_nblocks;  /* Number of allocated data chunks */
+  size_t   tfo_blkcap;   /* Capacity of the chunk table */
+  FAR uint8_t **tfo_blocks; /* Table of file data chunks */
+#else
   uint8_t  tfo_data[1];  /* File data starts here */
+#endif
 };
 
-#define SIZEOF_TMPFS_FILE(n) (sizeof(struct tmpfs_file_s) + (n) - 1)
+#ifdef CONFIG_FS_TMPFS_CHUNKED
+/* The number of data chunks needed to hold a file of size 'n' */
+
+#  define TMPFS_NBLOCKS(n) \
+     (((n) + CONFIG_FS_TMPFS_CHUNKSIZE - 1) / CONFIG_FS_TMPFS_CHUNKSIZE)
+
+/* The chunk table is sized in granules of this many entries in order to
+ * avoid frequent reallocations as the file grows or shrinks.
+ */
+
+#  define TMPFS_BLKTABLE_GUARD 16
+#  define TMPFS_BLKTABLE_CAP(n) \
+     (((n) + TMPFS_BLKTABLE_GUARD - 1) & ~(size_t)(TMPFS_BLKTABLE_GUARD - 1))
+#else
+#  define SIZEOF_TMPFS_FILE(n) (sizeof(struct tmpfs_file_s) + (n) - 1)
+#endif
 
 /* This structure represents one instance of a TMPFS file system */
 
@@ -59,6 +59,12 @@
 #define MIN(a,b) (((a) < (b)) ? (a) : (b))
 #define MAX(a,b) (((a) > (b)) ? (a) : (b))
 
+/* Lookup cache index value meaning that the path is on neither file
+ * system
+ */
+
+#define UNIONFS_NOLAYER (-1)
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -71,6 +77,20 @@ struct unionfs_mountpt_s
   FAR char *um_prefix;               /* Path prefix to filesystem */
 };
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+/* This structure describes one cached path lookup result.  The index is
+ * the index of the file system that owns the path, or UNIONFS_NOLAYER if
+ * the path was found on neither file system (a negative entry).  Unused
+ * entries have a NULL path.
+ */
+
+struct unionfs_cache_s
+{
+  FAR char *uc_relpath;              /* Looked-up relative path */
+  int8_t uc_ndx;                     /* Owning file system index */
+};
+#endif
+
 /* This structure describes the union file system */
 
 struct unionfs_inode_s
@@ -79,6 +99,10 @@ struct unionfs_inode_s
   sem_t ui_exclsem;                  /* Enforces mutually exclusive access */
   int16_t ui_nopen;                  /* Number of open references */
   bool ui_unmounted;                 /* File system has been unmounted */
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+  struct unionfs_cache_s ui_cache[CONFIG_FS_UNIONFS_LOOKUP_CACHE_SIZE];
+  uint8_t ui_cachenext;              /* Round-robin replacement index */
+#endif
 };
 
 /* This structure descries one opened file */
@@ -98,6 +122,16 @@ struct unionfs_file_s
 static int     unionfs_semtake(FAR struct unionfs_inode_s *ui, bool noint);
 #define        unionfs_semgive(ui) (void)nxsem_post(&(ui)->ui_exclsem)
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+static bool    unionfs_cache_lookup(FAR struct unionfs_inode_s *ui,
+                 FAR const char *relpath, FAR int *ndx);
+static void    unionfs_cache_update(FAR struct unionfs_inode_s *ui,
+                 FAR const char *relpath, int ndx);
+static void    unionfs_cache_invalidate(FAR struct unionfs_inode_s *ui);
+#else
+#  define      unionfs_cache_invalidate(ui)
+#endif
+
 static FAR const char *unionfs_offsetpath(FAR const char *relpath,
                  FAR const char *prefix);
 static bool    unionfs_ispartprefix(FAR const char *partprefix,
@@ -249,6 +283,127 @@ static int unionfs_semtake(FAR struct unionfs_inode_s *ui, bool noint)
     }
 }
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+/****************************************************************************
+ * Name: unionfs_cache_lookup
+ *
+ * Description:
+ *   Check if the result of a previous lookup of 'relpath' has been
+ *   cached.  If so, return true with 'ndx' set to the index of the file
+ *   system that owns the path, or to UNIONFS_NOLAYER if the path was
+ *   previously found on neither file system.
+ *
+ *   The caller must hold the exclusive access semaphore.
+ *
+ ****************************************************************************/
+
+static bool unionfs_cache_lookup(FAR struct unionfs_inode_s *ui,
+                                 FAR const char *relpath, FAR int *ndx)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_FS_UNIONFS_LOOKUP_CACHE_SIZE; i++)
+    {
+      if (ui->ui_cache[i].uc_relpath != NULL &&
+          strcmp(ui->ui_cache[i].uc_relpath, relpath) == 0)
+        {
+          *ndx = ui->ui_cache[i].uc_ndx;
+          return true;
+        }
+    }
+
+  return false;
+}
+
+/****************************************************************************
+ * Name: unionfs_cache_update
+ *
+ * Description:
+ *   Record the result of a full lookup of 'relpath':  Either the index of
+ *   the file system that owns the path or UNIONFS_NOLAYER if the path
+ *   exists on neither file system.  An existing entry for the path is
+ *   updated in place; otherwise the oldest entry is replaced.
+ *
+ *   The caller must hold the exclusive access semaphore.
+ *
+ ****************************************************************************/
+
+static void unionfs_cache_update(FAR struct unionfs_inode_s *ui,
+                                 FAR const char *relpath, int ndx)
+{
+  FAR struct unionfs_cache_s *uc;
+  FAR char *copy;
+  int i;
+
+  /* Is there already an entry for this path?  If so, just update the
+   * owning file system index.
+   */
+
+  for (i = 0; i < CONFIG_FS_UNIONFS_LOOKUP_CACHE_SIZE; i++)
+    {
+      if (ui->ui_cache[i].uc_relpath != NULL &&
+          strcmp(ui->ui_cache[i].uc_relpath, relpath) == 0)
+        {
+          ui->ui_cache[i].uc_ndx = ndx;
+          return;
+        }
+    }
+
+  /* No.. copy the path so that it persists as long as the cache entry.
+   * If the copy fails we simply do not cache this lookup.
+   */
+
+  copy = strdup(relpath);
+  if (copy == NULL)
+    {
+      return;
+    }
+
+  /* Replace the oldest entry (round-robin) */
+
+  uc = &ui->ui_cache[ui->ui_cachenext];
+  ui->ui_cachenext = (ui->ui_cachenext + 1) %
+                     CONFIG_FS_UNIONFS_LOOKUP_CACHE_SIZE;
+
+  if (uc->uc_relpath != NULL)
+    {
+      kmm_free(uc->uc_relpath);
+    }
+
+  uc->uc_relpath = copy;
+  uc->uc_ndx     = ndx;
+}
+
+/****************************************************************************
+ * Name: unionfs_cache_invalidate
+ *
+ * Description:
+ *   Discard all cached lookups.  This is done whenever the name space of
+ *   the union is modified (file or directory created, removed, or
+ *   renamed) since any such modification may change which file system
+ *   owns a cached path or may expose an occluded file.
+ *
+ *   The caller must hold the exclusive access semaphore.
+ *
+ ****************************************************************************/
+
+static void unionfs_cache_invalidate(FAR struct unionfs_inode_s *ui)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_FS_UNIONFS_LOOKUP_CACHE_SIZE; i++)
+    {
+      if (ui->ui_cache[i].uc_relpath != NULL)
+        {
+          kmm_free(ui->ui_cache[i].uc_relpath);
+          ui->ui_cache[i].uc_relpath = NULL;
+        }
+    }
+
+  ui->ui_cachenext = 0;
+}
+#endif /* CONFIG_FS_UNIONFS_LOOKUP_CACHE */
+
 /****************************************************************************
  * Name: unionfs_offsetpath
  ****************************************************************************/
@@ -807,6 +962,10 @@ static void unionfs_destroy(FAR struct unionfs_inode_s *ui)
       kmm_free(ui->ui_fs[1].um_prefix);
     }
 
+  /* Free any cached lookup results */
+
+  unionfs_cache_invalidate(ui);
+
   /* And finally free the allocated unionfs state structure as well */
 
   nxsem_destroy(&ui->ui_exclsem);
@@ -823,6 +982,9 @@ static int unionfs_open(FAR struct file *filep, FAR const char *relpath,
   FAR struct unionfs_inode_s *ui;
   FAR struct unionfs_file_s *uf;
   FAR struct unionfs_mountpt_s *um;
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+  int ndx;
+#endif
   int ret;
 
   /* Recover the open file data from the struct file instance */
@@ -850,6 +1012,56 @@ static int unionfs_open(FAR struct file *filep, FAR const char *relpath,
       goto errout_with_semaphore;
     }
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+  /* Creating a file may change which file system owns this path and may
+   * expose or occlude a file on the other file system, so any cached
+   * lookup results are then stale.
+   */
+
+  if ((oflags & O_CREAT) != 0)
+    {
+      unionfs_cache_invalidate(ui);
+    }
+
+  /* Otherwise, a previous lookup may already have determined which file
+   * system owns this path so that the other file system need not be
+   * probed at all.
+   */
+
+  else if (unionfs_cache_lookup(ui, relpath, &ndx))
+    {
+      if (ndx == UNIONFS_NOLAYER)
+        {
+          /* A previous lookup found this path on neither file system */
+
+          kmm_free(uf);
+          ret = -ENOENT;
+          goto errout_with_semaphore;
+        }
+
+      um = &ui->ui_fs[ndx];
+      DEBUGASSERT(um != NULL && um->um_node != NULL &&
+                  um->um_node->u.i_mops != NULL);
+
+      uf->uf_file.f_oflags = filep->f_oflags;
+      uf->uf_file.f_pos    = 0;
+      uf->uf_file.f_inode  = um->um_node;
+      uf->uf_file.f_priv   = NULL;
+
+      ret = unionfs_tryopen(&uf->uf_file, relpath, um->um_prefix, oflags,
+                            mode);
+      if (ret >= 0)
+        {
+          /* Successfully opened on the cached file system */
+
+          uf->uf_ndx = ndx;
+          goto opened;
+        }
+
+      /* The cached result is stale.  Fall through to the full search. */
+    }
+#endif
+
   /* Try to open the file on file system 1 */
 
   um = &ui->ui_fs[0];
@@ -891,6 +1103,16 @@ static int unionfs_open(FAR struct file *filep, FAR const char *relpath,
       uf->uf_ndx = 1;
     }
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+  /* Remember which file system owns this path so that the next lookup
+   * of the same path can skip the failed probe.
+   */
+
+  unionfs_cache_update(ui, relpath, uf->uf_ndx);
+
+opened:
+#endif
+
   /* Increment the open reference count */
 
   ui->ui_nopen++;
@@ -2305,6 +2527,10 @@ static int unionfs_unlink(FAR struct inode *mountpt,
         }
     }
 
+  /* The name space has been modified; discard any cached lookups */
+
+  unionfs_cache_invalidate(ui);
+
   unionfs_semgive(ui);
   return ret;
 }
@@ -2372,6 +2598,9 @@ static int unionfs_mkdir(FAR struct inode *mountpt, FAR const char *relpath,
 
   if (ret1 >= 0 || ret2 >= 0)
     {
+      /* The name space has been modified; discard any cached lookups */
+
+      unionfs_cache_invalidate(ui);
       ret = OK;
     }
   else
@@ -2456,6 +2685,10 @@ static int unionfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
        */
     }
 
+  /* The name space may have been modified; discard any cached lookups */
+
+  unionfs_cache_invalidate(ui);
+
   unionfs_semgive(ui);
   return ret;
 }
@@ -2510,6 +2743,7 @@ static int unionfs_rename(FAR struct inode *mountpt,
            * file of the same relative path will become visible.
            */
 
+          unionfs_cache_invalidate(ui);
           unionfs_semgive(ui);
           return OK;
         }
@@ -2532,6 +2766,10 @@ static int unionfs_rename(FAR struct inode *mountpt,
                               um->um_prefix);
     }
 
+  /* The name space may have been modified; discard any cached lookups */
+
+  unionfs_cache_invalidate(ui);
+
   unionfs_semgive(ui);
   return ret;
 }
@@ -2545,6 +2783,9 @@ static int unionfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
 {
   FAR struct unionfs_inode_s *ui;
   FAR struct unionfs_mountpt_s *um;
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+  int ndx;
+#endif
   int ret;
 
   finfo("relpath: %s\n", relpath);
@@ -2563,6 +2804,33 @@ static int unionfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
       return ret;
     }
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+  /* A previous lookup may already have determined which file system owns
+   * this path so that the other file system need not be probed at all.
+   */
+
+  if (unionfs_cache_lookup(ui, relpath, &ndx))
+    {
+      if (ndx == UNIONFS_NOLAYER)
+        {
+          /* A previous lookup found this path on neither file system */
+
+          unionfs_semgive(ui);
+          return -ENOENT;
+        }
+
+      um  = &ui->ui_fs[ndx];
+      ret = unionfs_trystat(um->um_node, relpath, um->um_prefix, buf);
+      if (ret >= 0)
+        {
+          unionfs_semgive(ui);
+          return OK;
+        }
+
+      /* The cached result is stale.  Fall through to the full search. */
+    }
+#endif
+
   /* stat this path on file system 1 */
 
   um  = &ui->ui_fs[0];
@@ -2573,6 +2841,9 @@ static int unionfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
        * shadow the second anyway.
        */
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+      unionfs_cache_update(ui, relpath, 0);
+#endif
       unionfs_semgive(ui);
       return OK;
     }
@@ -2587,6 +2858,9 @@ static int unionfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
        * shadow the second anyway.
        */
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+      unionfs_cache_update(ui, relpath, 1);
+#endif
       unionfs_semgive(ui);
       return OK;
     }
@@ -2620,6 +2894,17 @@ static int unionfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
         }
     }
 
+#ifdef CONFIG_FS_UNIONFS_LOOKUP_CACHE
+  /* Remember that this path exists on neither file system so that the
+   * next lookup of the same path can fail without probing either one.
+   */
+
+  if (ret == -ENOENT)
+    {
+      unionfs_cache_update(ui, relpath, UNIONFS_NOLAYER);
+    }
+#endif
+
   unionfs_semgive(ui);
   return ret;
 }
@@ -43,25 +43,101 @@
 
 #include <inttypes.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <poll.h>
+#include <time.h>
 #include <errno.h>
 #include <string.h>
 #include <debug.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/kmalloc.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/signal.h>
+#include <nuttx/fs/fs.h>
+#include <nuttx/net/net.h>
 
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+/* The epoll interest list.  Each member of the poll[] array remains set up
+ * with the underlying driver for as long as the descriptor is a member of
+ * the interest set:  epoll_wait() does NOT re-register every descriptor on
+ * each call.  An unused slot is marked by fd < 0.  Drivers post 'sem' when
+ * they report new events in the corresponding pollfd.
+ */
+
 struct epoll_head
 {
   int size;
   int occupied;
+  sem_t sem;
   FAR epoll_data_t *data;
   FAR struct pollfd *poll;
 };
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: epoll_fdsetup
+ *
+ * Description:
+ *   Register (or unregister) one descriptor of the interest list with the
+ *   underlying file or socket driver.  This mirrors the descriptor
+ *   dispatching performed by poll().
+ *
+ ****************************************************************************/
+
+static int epoll_fdsetup(int fd, FAR struct pollfd *fds, bool setup)
+{
+  /* Check for a valid file descriptor */
+
+  if (fd >= CONFIG_NFILE_DESCRIPTORS)
+    {
+      /* Perform the socket poll setup/teardown */
+
+#ifdef CONFIG_NET
+      if (fd < (CONFIG_NFILE_DESCRIPTORS + CONFIG_NSOCKET_DESCRIPTORS))
+        {
+          return net_poll(fd, fds, setup);
+        }
+      else
+#endif
+        {
+          return -EBADF;
+        }
+    }
+
+  return fs_poll(fd, fds, setup);
+}
+
+/****************************************************************************
+ * Name: epoll_slot
+ *
+ * Description:
+ *   Find the slot of the interest list that holds the file descriptor fd,
+ *   or NULL if the descriptor is not a member of the interest list.
+ *
+ ****************************************************************************/
+
+static FAR struct pollfd *epoll_slot(FAR struct epoll_head *eph, int fd)
+{
+  int i;
+
+  for (i = 0; i < eph->size; i++)
+    {
+      if (eph->poll[i].fd == fd)
+        {
+          return &eph->poll[i];
+        }
+    }
+
+  return NULL;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -83,12 +159,27 @@ int epoll_create(int size)
     (FAR struct epoll_head *)kmm_malloc(sizeof(struct epoll_head) +
                                         sizeof(epoll_data_t) * size +
                                         sizeof(struct pollfd) * size);
+  int i;
 
   eph->size = size;
   eph->occupied = 0;
   eph->data = (FAR epoll_data_t *)(eph + 1);
   eph->poll = (FAR struct pollfd *)(eph->data + size);
 
+  /* Mark all slots of the interest list unused */
+
+  for (i = 0; i < size; i++)
+    {
+      eph->poll[i].fd = -1;
+    }
+
+  /* This semaphore is signaled by the drivers and, hence, should not have
+   * priority inheritance enabled.
+   */
+
+  nxsem_init(&eph->sem, 0, 0);
+  nxsem_set_protocol(&eph->sem, SEM_PRIO_NONE);
+
   /* REVISIT: This will not work on machines where:
    * sizeof(struct epoll_head *) > sizeof(int)
    */
@@ -140,7 +231,19 @@ void epoll_close(int epfd)
    */
 
   FAR struct epoll_head *eph = (FAR struct epoll_head *)((intptr_t)epfd);
+  int i;
+
+  /* Unregister any descriptors still on the interest list */
 
+  for (i = 0; i < eph->size; i++)
+    {
+      if (eph->poll[i].fd >= 0)
+        {
+          epoll_fdsetup(eph->poll[i].fd, &eph->poll[i], false);
+        }
+    }
+
+  nxsem_destroy(&eph->sem);
   kmm_free(eph);
 }
 
@@ -162,6 +265,9 @@ int epoll_ctl(int epfd, int op, int fd, struct epoll_event *ev)
    */
 
   FAR struct epoll_head *eph = (FAR struct epoll_head *)((intptr_t)epfd);
+  FAR struct pollfd *fds;
+  int ret;
+  int i;
 
   switch (op)
     {
@@ -169,56 +275,95 @@ int epoll_ctl(int epfd, int op, int fd, struct epoll_event *ev)
         finfo("%08x CTL ADD(%d): fd=%d ev=%08" PRIx32 "\n",
               epfd, eph->occupied, fd, ev->events);
 
-        eph->data[eph->occupied]        = ev->data;
-        eph->poll[eph->occupied].events = ev->events | POLLERR | POLLHUP;
-        eph->poll[eph->occupied++].fd   = fd;
+        /* Find an unused slot of the interest list.  Slots are never
+         * compacted so that the pollfd address registered with the driver
+         * remains valid for the lifetime of the membership.
+         */
+
+        fds = epoll_slot(eph, -1);
+        if (fds == NULL)
+          {
+            set_errno(ENOMEM);
+            return -1;
+          }
+
+        i = fds - eph->poll;
+        eph->data[i] = ev->data;
+
+        fds->events  = ev->events | POLLERR | POLLHUP;
+        fds->sem     = &eph->sem;
+        fds->revents = 0;
+        fds->priv    = NULL;
+        fds->fd      = fd;
+
+        /* Register the descriptor with the underlying driver.  The
+         * registration remains in effect until the descriptor is removed
+         * from the interest list.
+         */
+
+        ret = epoll_fdsetup(fd, fds, true);
+        if (ret < 0)
+          {
+            fds->fd = -1;
+            set_errno(-ret);
+            return -1;
+          }
+
+        eph->occupied++;
         return 0;
 
       case EPOLL_CTL_DEL:
-        {
-          int i;
+        fds = epoll_slot(eph, fd);
+        if (fds == NULL)
+          {
+            set_errno(ENOENT);
+            return -1;
+          }
+
+        /* Unregister the descriptor from the underlying driver and mark
+         * the slot unused.
+         */
+
+        epoll_fdsetup(fd, fds, false);
+        fds->fd  = -1;
+        fds->sem = NULL;
+
+        eph->occupied--;
+        return 0;
 
-          for (i = 0; i < eph->occupied; i++)
-            {
-              if (eph->poll[i].fd == fd)
-                {
-                  if (i != eph->occupied - 1)
-                    {
-                      memmove(&eph->data[i], &eph->data[i + 1],
-                              sizeof(epoll_data_t) * (eph->occupied - i));
-                      memmove(&eph->poll[i], &eph->poll[i + 1],
-                              sizeof(struct pollfd) * (eph->occupied - i));
-                    }
-
-                  eph->occupied--;
-                  return 0;
-                }
-            }
+      case EPOLL_CTL_MOD:
+        finfo("%08x CTL MOD(%d): fd=%d ev=%08" PRIx32 "\n",
+              epfd, eph->occupied, fd, ev->events);
 
-          set_errno(ENOENT);
-          return -1;
-        }
+        fds = epoll_slot(eph, fd);
+        if (fds == NULL)
+          {
+            set_errno(ENOENT);
+            return -1;
+          }
 
-      case EPOLL_CTL_MOD:
-        {
-          int i;
+        /* Cycle the registration so that the driver re-evaluates the
+         * current state of the descriptor against the new event set.
+         */
 
-          finfo("%08x CTL MOD(%d): fd=%d ev=%08" PRIx32 "\n",
-                epfd, eph->occupied, fd, ev->events);
+        epoll_fdsetup(fd, fds, false);
 
-          for (i = 0; i < eph->occupied; i++)
-            {
-              if (eph->poll[i].fd == fd)
-                {
-                  eph->data[i]        = ev->data;
-                  eph->poll[i].events = ev->events | POLLERR | POLLHUP;
-                  return 0;
-                }
-            }
+        eph->data[fds - eph->poll] = ev->data;
 
-          set_errno(ENOENT);
-          return -1;
-        }
+        fds->events  = ev->events | POLLERR | POLLHUP;
+        fds->revents = 0;
+        fds->priv    = NULL;
+
+        ret = epoll_fdsetup(fd, fds, true);
+        if (ret < 0)
+          {
+            fds->fd = -1;
+            eph->occupied--;
+            set_errno(-ret);
+            return -1;
+          }
+
+        return 0;
     }
 
   set_errno(EINVAL);
@@ -237,61 +382,125 @@ int epoll_pwait(int epfd, FAR struct epoll_event *evs,
    */
 
   FAR struct epoll_head *eph = (FAR struct epoll_head *)((intptr_t)epfd);
-  int counter;
-  int rc;
+  struct timespec abstime;
+  sigset_t oldsigmask;
+  int ngot = 0;
+  int ret = OK;
   int i;
 
-  if (timeout < 0)
+  /* The deadline is absolute so that it need not be adjusted on each pass
+   * through the wait loop.
+   */
+
+  if (timeout > 0)
     {
-      rc = ppoll(eph->poll, eph->occupied, NULL, sigmask);
+      clock_gettime(CLOCK_REALTIME, &abstime);
+      abstime.tv_sec  += timeout / 1000;
+      abstime.tv_nsec += (timeout % 1000) * NSEC_PER_MSEC;
+      if (abstime.tv_nsec >= NSEC_PER_SEC)
+        {
+          abstime.tv_sec++;
+          abstime.tv_nsec -= NSEC_PER_SEC;
+        }
     }
-  else
-    {
-      struct timespec timeout_ts;
 
-      timeout_ts.tv_sec  = timeout / 1000;
-      timeout_ts.tv_nsec = timeout % 1000 * 1000;
+  /* Temporarily replace the signal mask, as ppoll() would */
 
-      rc = ppoll(eph->poll, eph->occupied, &timeout_ts, sigmask);
+  if (sigmask != NULL)
+    {
+      nxsig_procmask(SIG_SETMASK, sigmask, &oldsigmask);
     }
 
-  if (rc <= 0)
+  for (; ; )
     {
-      if (rc < 0)
+      /* Consume any notifications accumulated since the last wait so that
+       * the semaphore count cannot grow without bound.  Events reported
+       * in the interim are still visible in the revents fields.
+       */
+
+      while (nxsem_trywait(&eph->sem) >= 0)
         {
-          ferr("ERROR: %08x poll fail: %d for %d, %d msecs\n",
-               epfd, rc, eph->occupied, timeout);
+        }
+
+      /* Walk the interest list, collecting ready descriptors.  There is
+       * no per-descriptor driver setup on this path:  The registrations
+       * made by epoll_ctl() persist across calls.
+       */
 
-          for (i = 0; i < eph->occupied; i++)
+      for (i = 0; i < eph->size && ngot < maxevents; i++)
+        {
+          FAR struct pollfd *fds = &eph->poll[i];
+
+          if (fds->fd >= 0 && fds->revents != 0)
             {
-              ferr("  %02d: fd=%d\n", i, eph->poll[i].fd);
+              evs[ngot].data     = eph->data[i];
+              evs[ngot++].events = fds->revents;
+
+              fds->revents = 0;
+
+              if ((fds->events & EPOLLONESHOT) != 0)
+                {
+                  fds->events = 0; /* Disable oneshot internally */
+                }
+              else
+                {
+                  /* Re-arm the descriptor by cycling its registration
+                   * with the driver.  This re-evaluates the level-
+                   * triggered state:  If the descriptor is still ready,
+                   * the driver will immediately report the event again.
+                   * Only descriptors that were reported pay this cost.
+                   */
+
+                  epoll_fdsetup(fds->fd, fds, false);
+                  epoll_fdsetup(fds->fd, fds, true);
+                }
             }
         }
 
-      return rc;
-    }
+      if (ngot > 0 || timeout == 0)
+        {
+          break;
+        }
 
-  /* Iterate over non NULL event fds */
+      /* Nothing is ready yet.  Wait for a driver to post the semaphore */
 
-  if (rc > maxevents)
-    {
-      rc = maxevents;
-    }
+      if (timeout < 0)
+        {
+          ret = nxsem_wait(&eph->sem);
+        }
+      else
+        {
+          ret = nxsem_timedwait(&eph->sem, &abstime);
+        }
 
-  for (i = 0, counter = 0; i < rc && counter < eph->occupied; counter++)
-    {
-      if (eph->poll[counter].revents != 0)
+      if (ret < 0)
         {
-          evs[i].data     = eph->data[counter];
-          evs[i++].events = eph->poll[counter].revents;
-          if (eph->poll[counter].events & EPOLLONESHOT)
+          if (ret == -ETIMEDOUT)
             {
-              eph->poll[counter].events = 0; /* Disable oneshot internally */
+              ret = OK;  /* Timeout is not an error; report zero events */
             }
+
+          break;
         }
     }
 
-  return i;
+  /* Restore the original signal mask */
+
+  if (sigmask != NULL)
+    {
+      nxsig_procmask(SIG_SETMASK, &oldsigmask, NULL);
+    }
+
+  if (ret < 0)
+    {
+      ferr("ERROR: %08x wait fail: %d for %d, %d msecs\n",
+           epfd, ret, eph->occupied, timeout);
+
+      set_errno(-ret);
+      return -1;
+    }
+
+  return ngot;
 }
 
 /****************************************************************************
@@ -100,6 +100,18 @@ int fs_getfilep(int fd, FAR struct file **filep)
       return -EAGAIN;
     }
 
+  /* Verify that the file descriptor is in use, i.e., that an inode has
+   * been assigned to the descriptor.  This check is performed without
+   * taking the file list semaphore:  The translation from descriptor to
+   * struct file must remain lock-free so that concurrent I/O on separate
+   * descriptors does not serialize here.
+   */
+
+  if (list->fl_files[fd].f_inode == NULL)
+    {
+      return -EBADF;
+    }
+
   /* And return the file pointer from the list */
 
   *filep = &list->fl_files[fd];
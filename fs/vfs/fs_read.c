@@ -49,6 +49,7 @@
 
 #include <nuttx/cancelpt.h>
 #include <nuttx/net/net.h>
+#include <nuttx/sched.h>
 
 #include "inode/inode.h"
 
@@ -108,6 +109,15 @@ ssize_t file_read(FAR struct file *filep, FAR void *buf, size_t nbytes)
        */
 
       ret = (int)inode->u.i_ops->read(filep, (FAR char *)buf, (size_t)nbytes);
+
+#ifdef CONFIG_SCHED_RUSAGE
+      /* Account the bytes read to the calling thread */
+
+      if (ret > 0)
+        {
+          nxsched_self()->rdbytes += (uint64_t)ret;
+        }
+#endif
     }
 
   /* Return the number of bytes read (or possibly an error code) */
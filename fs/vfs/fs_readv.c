@@ -0,0 +1,257 @@
+/****************************************************************************
+ * fs/vfs/fs_readv.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <nuttx/cancelpt.h>
+#include <nuttx/net/net.h>
+#include <nuttx/fs/fs.h>
+
+#include "inode/inode.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: file_readv
+ *
+ * Description:
+ *   file_readv() is an internal OS interface.  It is functionally similar
+ *   to the standard readv() interface except:
+ *
+ *    - It does not modify the errno variable,
+ *    - It is not a cancellation point,
+ *    - It does not handle socket descriptors, and
+ *    - It accepts a file structure instance instead of file descriptor.
+ *
+ * Input Parameters:
+ *   filep  - File structure instance
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive, non-zero number of bytes read on success, 0 on an
+ *   end-of-file condition, or a negated errno value on any failure.  If an
+ *   error occurs after some data has already been read, the number of
+ *   bytes read so far is returned.
+ *
+ ****************************************************************************/
+
+ssize_t file_readv(FAR struct file *filep, FAR const struct iovec *iov,
+                   int iovcnt)
+{
+  FAR uint8_t *buffer;
+  size_t remaining;
+  ssize_t ntotal;
+  ssize_t nread;
+  int i;
+
+  DEBUGASSERT(filep != NULL && iov != NULL);
+
+  /* Process each entry in the struct iovec array.  Each buffer is filled
+   * completely before proceeding to the next.  The file structure is held
+   * across the whole operation so that the per-call descriptor lookup and
+   * setup costs are paid only once.
+   */
+
+  for (i = 0, ntotal = 0; i < iovcnt; i++)
+    {
+      /* Ignore zero-length buffers */
+
+      if (iov[i].iov_len > 0)
+        {
+          buffer    = iov[i].iov_base;
+          remaining = iov[i].iov_len;
+
+          /* Read repeatedly as necessary to fill the buffer */
+
+          do
+            {
+              nread = file_read(filep, buffer, remaining);
+
+              /* Check for a read error */
+
+              if (nread < 0)
+                {
+                  return ntotal > 0 ? ntotal : nread;
+                }
+
+              /* Check for an end-of-file condition */
+
+              else if (nread == 0)
+                {
+                  return ntotal;
+                }
+
+              /* Update pointers and counts in order to handle partial
+               * buffer reads.
+               */
+
+              buffer    += nread;
+              remaining -= nread;
+              ntotal    += nread;
+            }
+          while (remaining > 0);
+        }
+    }
+
+  return ntotal;
+}
+
+/****************************************************************************
+ * Name: nx_readv
+ *
+ * Description:
+ *   nx_readv() is an internal OS interface.  It is functionally similar to
+ *   the standard readv() interface except:
+ *
+ *    - It does not modify the errno variable, and
+ *    - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - File descriptor to read from
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive, non-zero number of bytes read on success, 0 on an
+ *   end-of-file condition, or a negated errno value on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t nx_readv(int fd, FAR const struct iovec *iov, int iovcnt)
+{
+  /* Did we get a valid file descriptor? */
+
+  if ((unsigned int)fd >= CONFIG_NFILE_DESCRIPTORS)
+    {
+#ifdef CONFIG_NET
+      /* No.. handle a socket descriptor with a sequence of receive
+       * operations, one per buffer.
+       */
+
+      ssize_t ntotal;
+      ssize_t nread;
+      int i;
+
+      for (i = 0, ntotal = 0; i < iovcnt; i++)
+        {
+          if (iov[i].iov_len > 0)
+            {
+              nread = nx_recv(fd, iov[i].iov_base, iov[i].iov_len, 0);
+              if (nread < 0)
+                {
+                  return ntotal > 0 ? ntotal : nread;
+                }
+
+              ntotal += nread;
+
+              /* Stop if the buffer was not filled completely */
+
+              if ((size_t)nread < iov[i].iov_len)
+                {
+                  break;
+                }
+            }
+        }
+
+      return ntotal;
+#else
+      /* No networking... it is a bad descriptor in any event */
+
+      return -EBADF;
+#endif
+    }
+  else
+    {
+      FAR struct file *filep;
+      ssize_t ret;
+
+      /* The descriptor is in a valid range for a file descriptor... do the
+       * read.  First, get the file structure.  Note that on failure,
+       * fs_getfilep() will set the errno variable.
+       */
+
+      ret = (ssize_t)fs_getfilep(fd, &filep);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      /* Then let file_readv do all of the work. */
+
+      return file_readv(filep, iov, iovcnt);
+    }
+}
+
+/****************************************************************************
+ * Name: readv
+ *
+ * Description:
+ *   The standard, POSIX readv interface.  The readv() function is
+ *   equivalent to read(), except that it places the input data into the
+ *   'iovcnt' buffers specified by the members of the 'iov' array: iov[0],
+ *   iov[1], ..., iov['iovcnt'-1].  Each buffer is filled completely before
+ *   proceeding to the next.  Unlike a loop of read() calls, the whole
+ *   operation is performed with a single system call.
+ *
+ * Input Parameters:
+ *   fd     - The open file descriptor for the file to be read
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   Upon successful completion, readv() will return a non-negative integer
+ *   indicating the number of bytes actually read.  Otherwise, the function
+ *   will return -1 and set errno to indicate the error.  See read() for
+ *   the list of returned errno values.
+ *
+ ****************************************************************************/
+
+ssize_t readv(int fd, FAR const struct iovec *iov, int iovcnt)
+{
+  ssize_t ret;
+
+  /* readv() is a cancellation point */
+
+  enter_cancellation_point();
+
+  /* Let nx_readv() do the real work */
+
+  ret = nx_readv(fd, iov, iovcnt);
+  if (ret < 0)
+    {
+      set_errno(-ret);
+      ret = ERROR;
+    }
+
+  leave_cancellation_point();
+  return ret;
+}
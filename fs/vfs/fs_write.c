@@ -53,6 +53,7 @@
 
 #include <nuttx/cancelpt.h>
 #include <nuttx/net/net.h>
+#include <nuttx/sched.h>
 
 #include "inode/inode.h"
 
@@ -90,6 +91,9 @@ ssize_t file_write(FAR struct file *filep, FAR const void *buf,
                    size_t nbytes)
 {
   FAR struct inode *inode;
+#ifdef CONFIG_SCHED_RUSAGE
+  ssize_t ret;
+#endif
 
   /* Was this file opened for write access? */
 
@@ -108,7 +112,20 @@ ssize_t file_write(FAR struct file *filep, FAR const void *buf,
 
   /* Yes, then let the driver perform the write */
 
+#ifdef CONFIG_SCHED_RUSAGE
+  ret = inode->u.i_ops->write(filep, buf, nbytes);
+
+  /* Account the bytes written to the calling thread */
+
+  if (ret > 0)
+    {
+      nxsched_self()->wrbytes += (uint64_t)ret;
+    }
+
+  return ret;
+#else
   return inode->u.i_ops->write(filep, buf, nbytes);
+#endif
 }
 
 /****************************************************************************
@@ -0,0 +1,261 @@
+/****************************************************************************
+ * fs/vfs/fs_writev.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <nuttx/cancelpt.h>
+#include <nuttx/net/net.h>
+#include <nuttx/fs/fs.h>
+
+#include "inode/inode.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: file_writev
+ *
+ * Description:
+ *   Equivalent to the standard writev() function except that is accepts a
+ *   struct file instance instead of a file descriptor.  It is functionally
+ *   equivalent to writev() except that in addition to the differences in
+ *   input parameters:
+ *
+ *  - It does not modify the errno variable,
+ *  - It is not a cancellation point, and
+ *  - It does not handle socket descriptors.
+ *
+ * Input Parameters:
+ *   filep  - Instance of struct file to use with the writes
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with writev() for a description of the appropriate errno
+ *  values).  If an error occurs after some data has already been written,
+ *  the number of bytes written so far is returned.
+ *
+ ****************************************************************************/
+
+ssize_t file_writev(FAR struct file *filep, FAR const struct iovec *iov,
+                    int iovcnt)
+{
+  FAR const uint8_t *buffer;
+  size_t remaining;
+  ssize_t ntotal;
+  ssize_t nwritten;
+  int i;
+
+  DEBUGASSERT(filep != NULL && iov != NULL);
+
+  /* Process each entry in the struct iovec array.  Each buffer is written
+   * completely before proceeding to the next.  The file structure is held
+   * across the whole operation so that the per-call descriptor lookup and
+   * setup costs are paid only once.
+   */
+
+  for (i = 0, ntotal = 0; i < iovcnt; i++)
+    {
+      /* Ignore zero-length buffers */
+
+      if (iov[i].iov_len > 0)
+        {
+          buffer    = iov[i].iov_base;
+          remaining = iov[i].iov_len;
+
+          /* Write repeatedly as necessary to empty the buffer */
+
+          do
+            {
+              nwritten = file_write(filep, buffer, remaining);
+
+              /* Check for a write error */
+
+              if (nwritten < 0)
+                {
+                  return ntotal > 0 ? ntotal : nwritten;
+                }
+
+              /* A return of zero means that no further writes are
+               * possible.
+               */
+
+              else if (nwritten == 0)
+                {
+                  return ntotal;
+                }
+
+              /* Update pointers and counts in order to handle partial
+               * buffer writes.
+               */
+
+              buffer    += nwritten;
+              remaining -= nwritten;
+              ntotal    += nwritten;
+            }
+          while (remaining > 0);
+        }
+    }
+
+  return ntotal;
+}
+
+/****************************************************************************
+ * Name: nx_writev
+ *
+ * Description:
+ *  nx_writev() is an internal OS interface.  It is functionally equivalent
+ *  to writev() except that:
+ *
+ *  - It does not modify the errno variable, and
+ *  - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - file descriptor (or socket descriptor) to write to
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with writev() for a description of the appropriate errno
+ *  values).
+ *
+ ****************************************************************************/
+
+ssize_t nx_writev(int fd, FAR const struct iovec *iov, int iovcnt)
+{
+  /* Did we get a valid file descriptor? */
+
+  if ((unsigned int)fd >= CONFIG_NFILE_DESCRIPTORS)
+    {
+#if defined(CONFIG_NET_TCP) || defined(CONFIG_NET_CAN)
+      /* No.. handle a socket descriptor with a sequence of send
+       * operations, one per buffer.
+       */
+
+      ssize_t ntotal;
+      ssize_t nwritten;
+      int i;
+
+      for (i = 0, ntotal = 0; i < iovcnt; i++)
+        {
+          if (iov[i].iov_len > 0)
+            {
+              nwritten = nx_send(fd, iov[i].iov_base, iov[i].iov_len, 0);
+              if (nwritten < 0)
+                {
+                  return ntotal > 0 ? ntotal : nwritten;
+                }
+
+              ntotal += nwritten;
+
+              /* Stop if the buffer was not sent completely */
+
+              if ((size_t)nwritten < iov[i].iov_len)
+                {
+                  break;
+                }
+            }
+        }
+
+      return ntotal;
+#else
+      return -EBADF;
+#endif
+    }
+  else
+    {
+      FAR struct file *filep;
+      ssize_t ret;
+
+      /* The descriptor is in the right range to be a file descriptor..
+       * write to the file.  Note that fs_getfilep() will set the errno on
+       * failure.
+       */
+
+      ret = (ssize_t)fs_getfilep(fd, &filep);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      /* Then let file_writev do all of the work. */
+
+      return file_writev(filep, iov, iovcnt);
+    }
+}
+
+/****************************************************************************
+ * Name: writev
+ *
+ * Description:
+ *   The standard, POSIX writev interface.  The writev() function is
+ *   equivalent to write(), except that it gathers the output data from the
+ *   'iovcnt' buffers specified by the members of the 'iov' array: iov[0],
+ *   iov[1], ..., iov['iovcnt'-1].  Each buffer is written completely
+ *   before proceeding to the next.  Unlike a loop of write() calls, the
+ *   whole operation is performed with a single system call.
+ *
+ * Input Parameters:
+ *   fd     - The open file descriptor for the file to be written
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   Upon successful completion, writev() will return the number of bytes
+ *   actually written.  Otherwise, the function will return -1 and set
+ *   errno to indicate the error.  See write() for the list of returned
+ *   errno values.
+ *
+ ****************************************************************************/
+
+ssize_t writev(int fd, FAR const struct iovec *iov, int iovcnt)
+{
+  ssize_t ret;
+
+  /* writev() is a cancellation point */
+
+  enter_cancellation_point();
+
+  /* Let nx_writev() do the real work */
+
+  ret = nx_writev(fd, iov, iovcnt);
+  if (ret < 0)
+    {
+      set_errno(-ret);
+      ret = ERROR;
+    }
+
+  leave_cancellation_point();
+  return ret;
+}
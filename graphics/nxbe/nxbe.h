@@ -65,11 +65,14 @@
 
 /* Server flags and helper macros:
  *
- * NXBE_STATE_MODAL  - One window is in a focused, modal state
+ * NXBE_STATE_MODAL   - One window is in a focused, modal state
+ * NXBE_STATE_PENDING - One or more windows have accumulated redraw regions
  */
 
 #define NXBE_STATE_MODAL     (1 << 0) /* Bit 0: One window is in a focused,
                                        *        modal state */
+#define NXBE_STATE_PENDING   (1 << 1) /* Bit 1: One or more windows have
+                                       *        accumulated redraw regions */
 
 /* Helpful flag macros */
 
@@ -80,6 +83,13 @@
 #define NXBE_STATE_CLRMODAL(nxbe) \
   do { (nxbe)->flags &= ~NXBE_STATE_MODAL; } while (0)
 
+#define NXBE_STATE_ISPENDING(nxbe) \
+  (((nxbe)->flags & NXBE_STATE_PENDING) != 0)
+#define NXBE_STATE_SETPENDING(nxbe) \
+  do { (nxbe)->flags |= NXBE_STATE_PENDING; } while (0)
+#define NXBE_STATE_CLRPENDING(nxbe) \
+  do { (nxbe)->flags &= ~NXBE_STATE_PENDING; } while (0)
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -79,6 +79,16 @@ void NXGL_FUNCNAME(nxgl_copyrectangle, NXGLIB_SUFFIX)
   int lnlen;
 #endif
 
+#ifdef CONFIG_NX_BLIT_ACCEL
+  /* Give any hardware 2D engine first claim on the operation */
+
+  if (nxgl_hwcopy(pinfo, dest, src, origin, srcstride,
+                  NXGLIB_BITSPERPIXEL))
+    {
+      return;
+    }
+#endif
+
   /* Get the width of the framebuffer in bytes */
 
   deststride = pinfo->stride;
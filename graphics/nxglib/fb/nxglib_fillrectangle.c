@@ -85,6 +85,15 @@ void NXGL_FUNCNAME(nxgl_fillrectangle, NXGLIB_SUFFIX)
   int lnlen;
 #endif
 
+#ifdef CONFIG_NX_BLIT_ACCEL
+  /* Give any hardware 2D engine first claim on the operation */
+
+  if (nxgl_hwfill(pinfo, rect, (uint32_t)color, NXGLIB_BITSPERPIXEL))
+    {
+      return;
+    }
+#endif
+
   /* Get the width of the framebuffer in bytes */
 
   stride = pinfo->stride;
@@ -128,6 +128,15 @@ void NXGL_FUNCNAME(nxgl_moverectangle,NXGLIB_SUFFIX)
   uint8_t tailmask;
 #endif
 
+#ifdef CONFIG_NX_BLIT_ACCEL
+  /* Give any hardware 2D engine first claim on the operation */
+
+  if (nxgl_hwmove(pinfo, rect, offset, NXGLIB_BITSPERPIXEL))
+    {
+      return;
+    }
+#endif
+
   /* Get the width of the framebuffer in bytes */
 
   stride = pinfo->stride;
@@ -43,6 +43,7 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <string.h>
 
 #include <nuttx/nx/nxglib.h>
 
@@ -97,6 +98,7 @@
 
 #  define NXGL_SCALEX(x)           ((x) << 1)
 #  define NXGL_PIXEL_T             uint16_t
+#  define NXGL_WORDPIXEL(p)        ((uint32_t)(uint16_t)(p) << 16 | (uint16_t)(p))
 #  define NXGL_BLENDER             nxglib_rgb565_blend
 
 #elif NXGLIB_BITSPERPIXEL == 24
@@ -109,6 +111,7 @@
 
 #  define NXGL_SCALEX(x)           ((x) << 2)
 #  define NXGL_PIXEL_T             uint32_t
+#  define NXGL_WORDPIXEL(p)        ((uint32_t)(p))
 #  define NXGL_BLENDER             nxglib_rgb24_blend
 
 #endif
@@ -120,26 +123,16 @@
 #  define NXGL_ALIGNDOWN(x)        ((x) & ~NXGL_PIXELMASK)
 #  define NXGL_ALIGNUP(x)          (((x) + NXGL_PIXELMASK) & ~NXGL_PIXELMASK)
 
+/* Rows are packed, byte-addressable data.  Defer to the C library memset
+ * and memcpy which are normally optimized (word-at-a-time and possibly
+ * further accelerated by the architecture).
+ */
+
 #  define NXGL_MEMSET(dest,value,width) \
-   { \
-     FAR uint8_t *_ptr = (FAR uint8_t*)(dest); \
-     int        _nby = NXGL_SCALEX(width); \
-     while (_nby--) \
-       { \
-         *_ptr++ = (value); \
-       } \
-   }
+     memset((FAR void *)(dest), (value), NXGL_SCALEX(width))
 
 #  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR uint8_t *_dptr = (FAR uint8_t*)(dest); \
-     FAR uint8_t *_sptr = (FAR uint8_t*)(src); \
-     int        _nby  = NXGL_SCALEX(width); \
-     while (_nby--) \
-       { \
-         *_dptr++ = *_sptr++; \
-       } \
-   }
+     memcpy((FAR void *)(dest), (FAR const void *)(src), NXGL_SCALEX(width))
 
 #elif NXGLIB_BITSPERPIXEL == 24
 
@@ -155,18 +148,12 @@
        } \
    }
 
+/* The packed, 3-byte pixels are copied as a byte stream by the normally
+ * optimized C library memcpy.
+ */
+
 #  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR uint8_t *_dptr = (FAR uint8_t*)(dest); \
-     FAR uint8_t *_sptr = (FAR uint8_t*)(src); \
-     nxgl_coord_t _npix = (width); \
-     while (_npix--) \
-       { \
-         *_dptr++ = *_sptr++; \
-         *_dptr++ = *_sptr++; \
-         *_dptr++ = *_sptr++; \
-       } \
-   }
+     memcpy((FAR void *)(dest), (FAR const void *)(src), NXGL_SCALEX(width))
 
 #ifdef CONFIG_NX_ANTIALIASING
 
@@ -187,27 +174,48 @@
 #endif /* CONFIG_NX_ANTIALIASING */
 #else /* NXGLIB_BITSPERPIXEL == 16 || NXGLIB_BITSPERPIXEL == 32 */
 
+/* Fill the row with aligned, 32-bit stores, unrolled by two.  A 16-bit
+ * pixel may first be needed to bring the destination up to a 32-bit
+ * boundary; any remainder is finished with pixel-width stores.
+ */
+
 #  define NXGL_MEMSET(dest,value,width) \
    { \
-     FAR NXGL_PIXEL_T *_ptr = (FAR NXGL_PIXEL_T*)(dest); \
-     nxgl_coord_t     _npix = (width); \
-     while (_npix--) \
+     FAR NXGL_PIXEL_T *_ptr  = (FAR NXGL_PIXEL_T*)(dest); \
+     nxgl_coord_t      _npix = (width); \
+     while (_npix > 0 && \
+            (sizeof(NXGL_PIXEL_T) < 4 && ((uintptr_t)_ptr & 3) != 0)) \
        { \
          *_ptr++ = (value); \
+         _npix--; \
        } \
-   }
-
-#  define NXGL_MEMCPY(dest,src,width) \
-   { \
-     FAR NXGL_PIXEL_T *_dptr = (FAR NXGL_PIXEL_T*)(dest); \
-     FAR NXGL_PIXEL_T *_sptr = (FAR NXGL_PIXEL_T*)(src); \
-     nxgl_coord_t      _npix = (width); \
-     while (_npix--) \
+     if (NXGL_SCALEX(_npix) >= 8) \
        { \
-         *_dptr++ = *_sptr++; \
+         FAR uint32_t *_wptr = (FAR uint32_t*)_ptr; \
+         uint32_t      _wval = NXGL_WORDPIXEL(value); \
+         do \
+           { \
+             _wptr[0] = _wval; \
+             _wptr[1] = _wval; \
+             _wptr   += 2; \
+             _npix   -= 8 / sizeof(NXGL_PIXEL_T); \
+           } \
+         while (NXGL_SCALEX(_npix) >= 8); \
+         _ptr = (FAR NXGL_PIXEL_T*)_wptr; \
+       } \
+     while (_npix-- > 0) \
+       { \
+         *_ptr++ = (value); \
        } \
    }
 
+/* Rows are packed so the pixels may be copied as a byte stream by the
+ * normally optimized C library memcpy.
+ */
+
+#  define NXGL_MEMCPY(dest,src,width) \
+     memcpy((FAR void *)(dest), (FAR const void *)(src), NXGL_SCALEX(width))
+
 #ifdef CONFIG_NX_ANTIALIASING
 
 #  define NXGL_BLEND(dest,color1,frac) \
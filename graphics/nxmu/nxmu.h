@@ -226,6 +226,30 @@ void nxmu_redrawreq(FAR struct nxbe_window_s *wnd,
 void nxmu_redraw(FAR struct nxbe_window_s *wnd,
                  FAR const struct nxgl_rect_s *rect);
 
+/****************************************************************************
+ * Name: nxmu_redraw_flush
+ *
+ * Description:
+ *   Perform the redraw of any region accumulated for the window by
+ *   nxmu_redraw() and update the per-window redraw statistics.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_REDRAW_COALESCE
+void nxmu_redraw_flush(FAR struct nxbe_window_s *wnd);
+
+/****************************************************************************
+ * Name: nxmu_redraw_flushall
+ *
+ * Description:
+ *   Flush the accumulated redraw regions of all windows in the window
+ *   list.  This is called by the server at the end of each frame interval.
+ *
+ ****************************************************************************/
+
+void nxmu_redraw_flushall(FAR struct nxbe_state_s *be);
+#endif
+
 /****************************************************************************
  * Name: nxmu_mouseinit
  *
@@ -40,6 +40,7 @@
 
 #include <nuttx/config.h>
 
+#include <inttypes.h>
 #include <stdbool.h>
 #include <errno.h>
 #include <debug.h>
@@ -124,6 +125,40 @@ static inline void nxmu_redraw_pwfb(FAR struct nxbe_window_s *wnd,
 }
 #endif
 
+/****************************************************************************
+ * Name: nxmu_redraw_now
+ *
+ * Description:
+ *   Perform the redraw of the region immediately, either by rendering
+ *   from the per-window framebuffer or by sending a redraw request to the
+ *   client.
+ *
+ ****************************************************************************/
+
+static void nxmu_redraw_now(FAR struct nxbe_window_s *wnd,
+                            FAR const struct nxgl_rect_s *rect)
+{
+#ifdef CONFIG_NX_RAMBACKED
+  /* If this window supports a pre-window frame buffer, then we can just
+   * update the device content from that framebuffer.
+   */
+
+  if (NXBE_ISRAMBACKED(wnd))
+    {
+      nxmu_redraw_pwfb(wnd, rect);
+    }
+
+  /* Otherwise, send a message to the client requesting an update of the
+   * affected region in the window.
+   */
+
+  else
+#endif
+    {
+      nxmu_redrawreq(wnd, rect);
+    }
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -170,26 +205,81 @@ void nxmu_redraw(FAR struct nxbe_window_s *wnd,
 {
   /* Don't update hidden windows */
 
-  if (!NXBE_ISHIDDEN(wnd))
+  if (NXBE_ISHIDDEN(wnd))
     {
-#ifdef CONFIG_NX_RAMBACKED
-      /* If this window supports a pre-window frame buffer, then we can just
-       * update the device content from that framebuffer.
-       */
+      return;
+    }
 
-      if (NXBE_ISRAMBACKED(wnd))
-        {
-          nxmu_redraw_pwfb(wnd, rect);
-        }
+#ifdef CONFIG_NX_REDRAW_COALESCE
+  /* Merge the region into the window's accumulated dirty rectangle.  The
+   * accumulated region will be flushed by nxmu_redraw_flush() at the end
+   * of the current frame interval.
+   */
 
-      /* Otherwise, send a message to the client requesting an update of the
-       * affected region in the window.
-       */
+  if (NXBE_ISDIRTY(wnd))
+    {
+      nxgl_rectunion(&wnd->dirty, &wnd->dirty, rect);
+    }
+  else
+    {
+      nxgl_rectcopy(&wnd->dirty, rect);
+      NXBE_SETDIRTY(wnd);
+    }
 
-      else
+  wnd->nupdates++;
+  NXBE_STATE_SETPENDING(wnd->be);
+#else
+  nxmu_redraw_now(wnd, rect);
 #endif
+}
+
+/****************************************************************************
+ * Name: nxmu_redraw_flush
+ *
+ * Description:
+ *   Perform the redraw of any region accumulated for the window by
+ *   nxmu_redraw() and update the per-window redraw statistics.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_REDRAW_COALESCE
+void nxmu_redraw_flush(FAR struct nxbe_window_s *wnd)
+{
+  if (NXBE_ISDIRTY(wnd))
+    {
+      NXBE_CLRDIRTY(wnd);
+      wnd->nredraws++;
+
+      ginfo("wnd=%p nupdates=%" PRIu32 " nredraws=%" PRIu32 "\n",
+            wnd, wnd->nupdates, wnd->nredraws);
+
+      /* The window may have been hidden after the region was accumulated */
+
+      if (!NXBE_ISHIDDEN(wnd))
         {
-          nxmu_redrawreq(wnd, rect);
+          nxmu_redraw_now(wnd, &wnd->dirty);
         }
     }
 }
+
+/****************************************************************************
+ * Name: nxmu_redraw_flushall
+ *
+ * Description:
+ *   Flush the accumulated redraw regions of all windows in the window
+ *   list.  This is called by the server at the end of each frame interval.
+ *
+ ****************************************************************************/
+
+void nxmu_redraw_flushall(FAR struct nxbe_state_s *be)
+{
+  FAR struct nxbe_window_s *wnd;
+
+  NXBE_STATE_CLRPENDING(be);
+
+  for (wnd = be->topwnd; wnd != NULL; wnd = wnd->below)
+    {
+      nxmu_redraw_flush(wnd);
+    }
+}
+#endif /* CONFIG_NX_REDRAW_COALESCE */
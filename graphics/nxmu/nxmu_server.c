@@ -49,11 +49,23 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <time.h>
+
+#include <nuttx/clock.h>
 #include <nuttx/mqueue.h>
 #include <nuttx/nx/nx.h>
 
 #include "nxmu.h"
 
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_MSGRING
+static void nxmu_ring_drain(FAR struct nxmu_state_s *nxmu,
+                            FAR struct nxmu_conn_s *conn);
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -235,6 +247,14 @@ static inline int nxmu_setup(FAR const char *mqname, FAR NX_DRIVERTYPE *dev,
 
   nxmu->conn.state = NX_CLISTATE_CONNECTED;
 
+#ifdef CONFIG_NX_MSGRING
+  /* The server's own connection never sends through the ring, but
+   * initialize it anyway so that the connection structure is complete.
+   */
+
+  nxmu_ring_init(&nxmu->conn.ring);
+#endif
+
   /* Initialize the non-NULL elements of the background window */
 
   nxmu->be.bkgd.conn = &nxmu->conn;
@@ -258,6 +278,347 @@ static inline int nxmu_setup(FAR const char *mqname, FAR NX_DRIVERTYPE *dev,
   return OK;
 }
 
+/****************************************************************************
+ * Name: nxmu_dispatch
+ *
+ * Description:
+ *   Dispatch one message to the appropriate server or back-end handler.
+ *   Messages arrive either from the server message queue or, when
+ *   CONFIG_NX_MSGRING is enabled, from a client's shared-memory message
+ *   ring.
+ *
+ ****************************************************************************/
+
+static void nxmu_dispatch(FAR struct nxmu_state_s *nxmu, FAR char *buffer,
+                          int nbytes)
+{
+  FAR struct nxsvrmsg_s *msg;
+
+  DEBUGASSERT(nbytes >= sizeof(struct nxsvrmsg_releasebkgd_s));
+  msg = (FAR struct nxsvrmsg_s *)buffer;
+
+  ginfo("Received opcode=%" PRId32 " nbytes=%d\n", msg->msgid, nbytes);
+    DEBUGASSERT(nbytes >= sizeof(struct nxsvrmsg_releasebkgd_s));
+    msg = (FAR struct nxsvrmsg_s *)buffer;
+
+    ginfo("Received opcode=%" PRId32 " nbytes=%d\n", msg->msgid, nbytes);
+    switch (msg->msgid)
+      {
+        /* Messages sent from clients to the NX server ********************/
+
+        case NX_SVRMSG_CONNECT: /* Establish connection with new NX server client */
+          {
+            FAR struct nxsvrmsg_s *connmsg =
+              (FAR struct nxsvrmsg_s *)buffer;
+            nxmu_connect(connmsg->conn);
+          }
+          break;
+
+        case NX_SVRMSG_DISCONNECT: /* Tear down connection with terminating client */
+          {
+            FAR struct nxsvrmsg_s *disconnmsg =
+              (FAR struct nxsvrmsg_s *)buffer;
+            nxmu_disconnect(disconnmsg->conn);
+          }
+          break;
+
+        case NX_SVRMSG_OPENWINDOW: /* Create a new window */
+          {
+            FAR struct nxsvrmsg_openwindow_s *openmsg =
+              (FAR struct nxsvrmsg_openwindow_s *)buffer;
+            nxmu_openwindow(&nxmu->be, openmsg->wnd);
+          }
+          break;
+
+        case NX_SVRMSG_CLOSEWINDOW: /* Close an existing window */
+          {
+            FAR struct nxsvrmsg_closewindow_s *closemsg =
+              (FAR struct nxsvrmsg_closewindow_s *)buffer;
+            nxbe_closewindow(closemsg->wnd);
+          }
+          break;
+
+        case NX_SVRMSG_BLOCKED: /* Block messages to a window */
+          {
+            FAR struct nxsvrmsg_blocked_s *blocked =
+              (FAR struct nxsvrmsg_blocked_s *)buffer;
+            nxmu_event(blocked->wnd, NXEVENT_BLOCKED, blocked->arg);
+          }
+          break;
+
+        case NX_SVRMSG_SYNCH: /* Synchronization request */
+          {
+            FAR struct nxsvrmsg_synch_s *synch =
+              (FAR struct nxsvrmsg_synch_s *)buffer;
+            nxmu_event(synch->wnd, NXEVENT_SYNCHED, synch->arg);
+          }
+          break;
+
+#if defined(CONFIG_NX_SWCURSOR) || defined(CONFIG_NX_HWCURSOR)
+        case NX_SVRMSG_CURSOR_ENABLE: /* Enable/disable cursor */
+          {
+            FAR struct nxsvrmsg_curenable_s *enabmsg =
+              (FAR struct nxsvrmsg_curenable_s *)buffer;
+            nxbe_cursor_enable(&nxmu->be, enabmsg->enable);
+          }
+          break;
+
+#if defined(CONFIG_NX_HWCURSORIMAGE) || defined(CONFIG_NX_SWCURSOR)
+        case NX_SVRMSG_CURSOR_IMAGE: /* Set cursor image */
+          {
+            FAR struct nxsvrmsg_curimage_s *imgmsg =
+              (FAR struct nxsvrmsg_curimage_s *)buffer;
+            nxbe_cursor_setimage(&nxmu->be, &imgmsg->image);
+          }
+          break;
+#endif
+        case NX_SVRMSG_CURSOR_SETPOS: /* Set cursor position */
+          {
+            FAR struct nxsvrmsg_curpos_s *posmsg =
+              (FAR struct nxsvrmsg_curpos_s *)buffer;
+            nxbe_cursor_setposition(&nxmu->be, &posmsg->pos);
+          }
+          break;
+#endif
+
+        case NX_SVRMSG_REQUESTBKGD: /* Give access to the background window */
+          {
+            FAR struct nxsvrmsg_requestbkgd_s *rqbgmsg =
+              (FAR struct nxsvrmsg_requestbkgd_s *)buffer;
+            nxmu_requestbkgd(rqbgmsg->conn, &nxmu->be, rqbgmsg->cb,
+                             rqbgmsg->arg);
+          }
+          break;
+
+        case NX_SVRMSG_RELEASEBKGD: /* End access to the background window */
+          {
+            nxmu_releasebkgd(nxmu);
+          }
+          break;
+
+        case NX_SVRMSG_SETPOSITION: /* Change window position */
+          {
+            FAR struct nxsvrmsg_setposition_s *setposmsg =
+              (FAR struct nxsvrmsg_setposition_s *)buffer;
+            nxbe_setposition(setposmsg->wnd, &setposmsg->pos);
+          }
+          break;
+
+        case NX_SVRMSG_SETSIZE: /* Change window size */
+          {
+            FAR struct nxsvrmsg_setsize_s *setsizemsg =
+              (FAR struct nxsvrmsg_setsize_s *)buffer;
+            nxbe_setsize(setsizemsg->wnd, &setsizemsg->size);
+          }
+          break;
+
+        case NX_SVRMSG_GETPOSITION: /* Get the window size/position */
+          {
+            FAR struct nxsvrmsg_getposition_s *getposmsg =
+              (FAR struct nxsvrmsg_getposition_s *)buffer;
+            nxmu_reportposition(getposmsg->wnd);
+          }
+          break;
+
+        case NX_SVRMSG_RAISE: /* Move the window to the top of the display */
+          {
+            FAR struct nxsvrmsg_raise_s *raisemsg =
+              (FAR struct nxsvrmsg_raise_s *)buffer;
+            nxbe_raise(raisemsg->wnd);
+          }
+          break;
+
+        case NX_SVRMSG_LOWER: /* Lower the window to the bottom of the display */
+          {
+            FAR struct nxsvrmsg_lower_s *lowermsg =
+              (FAR struct nxsvrmsg_lower_s *)buffer;
+            nxbe_lower(lowermsg->wnd);
+          }
+          break;
+
+        case NX_SVRMSG_MODAL: /* Select/De-select window modal state */
+          {
+            FAR struct nxsvrmsg_modal_s *modalmsg =
+              (FAR struct nxsvrmsg_modal_s *)buffer;
+            nxbe_modal(modalmsg->wnd, modalmsg->modal);
+          }
+          break;
+
+        case NX_SVRMSG_SETVISIBILITY: /* Show or hide a window */
+          {
+            FAR struct nxsvrmsg_setvisibility_s *vismsg =
+             (FAR struct nxsvrmsg_setvisibility_s *)buffer;
+            nxbe_setvisibility(vismsg->wnd, vismsg->hide);
+          }
+          break;
+
+        case NX_SVRMSG_SETPIXEL: /* Set a single pixel in the window with a color */
+          {
+            FAR struct nxsvrmsg_setpixel_s *setmsg =
+              (FAR struct nxsvrmsg_setpixel_s *)buffer;
+            nxbe_setpixel(setmsg->wnd, &setmsg->pos, setmsg->color);
+          }
+          break;
+
+        case NX_SVRMSG_FILL: /* Fill a rectangular region in the window with a color */
+          {
+            FAR struct nxsvrmsg_fill_s *fillmsg =
+              (FAR struct nxsvrmsg_fill_s *)buffer;
+            nxbe_fill(fillmsg->wnd, &fillmsg->rect, fillmsg->color);
+          }
+          break;
+
+        case NX_SVRMSG_GETRECTANGLE: /* Get a rectangular region from the window */
+          {
+            FAR struct nxsvrmsg_getrectangle_s *getmsg =
+              (FAR struct nxsvrmsg_getrectangle_s *)buffer;
+            nxbe_getrectangle(getmsg->wnd, &getmsg->rect, getmsg->plane,
+                             getmsg->dest, getmsg->deststride);
+
+            if (getmsg->sem_done)
+              {
+                nxsem_post(getmsg->sem_done);
+              }
+          }
+          break;
+
+        case NX_SVRMSG_FILLTRAP: /* Fill a trapezoidal region in the window with a color */
+          {
+            FAR struct nxsvrmsg_filltrapezoid_s *trapmsg =
+              (FAR struct nxsvrmsg_filltrapezoid_s *)buffer;
+            nxbe_filltrapezoid(trapmsg->wnd, &trapmsg->clip,
+                               &trapmsg->trap, trapmsg->color);
+          }
+          break;
+
+        case NX_SVRMSG_MOVE: /* Move a rectangular region within the window */
+          {
+            FAR struct nxsvrmsg_move_s *movemsg =
+              (FAR struct nxsvrmsg_move_s *)buffer;
+            nxbe_move(movemsg->wnd, &movemsg->rect, &movemsg->offset);
+          }
+          break;
+
+        case NX_SVRMSG_BITMAP: /* Copy a rectangular bitmap into the window */
+          {
+            FAR struct nxsvrmsg_bitmap_s *bmpmsg =
+              (FAR struct nxsvrmsg_bitmap_s *)buffer;
+            nxbe_bitmap(bmpmsg->wnd, &bmpmsg->dest, bmpmsg->src,
+                        &bmpmsg->origin, bmpmsg->stride);
+
+            if (bmpmsg->sem_done)
+              {
+                nxsem_post(bmpmsg->sem_done);
+              }
+          }
+          break;
+
+        case NX_SVRMSG_SETBGCOLOR: /* Set the color of the background */
+          {
+            FAR struct nxsvrmsg_setbgcolor_s *bgcolormsg =
+              (FAR struct nxsvrmsg_setbgcolor_s *)buffer;
+
+            /* Has the background color changed? */
+
+            if (!nxgl_colorcmp(nxmu->be.bgcolor, bgcolormsg->color))
+              {
+                /* Yes.. fill the background */
+
+                nxgl_colorcopy(nxmu->be.bgcolor, bgcolormsg->color);
+                nxbe_fill(&nxmu->be.bkgd, &nxmu->be.bkgd.bounds,
+                          bgcolormsg->color);
+              }
+          }
+          break;
+
+#ifdef CONFIG_NX_XYINPUT
+        case NX_SVRMSG_MOUSEIN: /* New mouse report from mouse client */
+          {
+            FAR struct nxsvrmsg_mousein_s *mousemsg =
+              (FAR struct nxsvrmsg_mousein_s *)buffer;
+            nxmu_mousein(nxmu, &mousemsg->pt, mousemsg->buttons);
+          }
+          break;
+#endif
+#ifdef CONFIG_NX_KBD
+        case NX_SVRMSG_KBDIN: /* New keyboard report from keyboard client */
+          {
+            FAR struct nxsvrmsg_kbdin_s *kbdmsg =
+              (FAR struct nxsvrmsg_kbdin_s *)buffer;
+            nxmu_kbdin(nxmu, kbdmsg->nch, kbdmsg->ch);
+          }
+          break;
+#endif
+
+        case NX_SVRMSG_REDRAWREQ: /* Request re-drawing of rectangular region */
+          {
+            FAR struct nxsvrmsg_redrawreq_s *redrawmsg =
+              (FAR struct nxsvrmsg_redrawreq_s *)buffer;
+            nxmu_redraw(redrawmsg->wnd, &redrawmsg->rect);
+          }
+          break;
+
+#ifdef CONFIG_NX_MSGRING
+        case NX_SVRMSG_RINGDATA: /* A client message ring has data */
+          {
+            FAR struct nxsvrmsg_s *bellmsg =
+              (FAR struct nxsvrmsg_s *)buffer;
+            nxmu_ring_drain(nxmu, bellmsg->conn);
+          }
+          break;
+#endif
+
+        /* Messages sent to the background window *************************/
+
+        case NX_CLIMSG_REDRAW: /* Re-draw the background window */
+          {
+            FAR struct nxclimsg_redraw_s *redraw =
+              (FAR struct nxclimsg_redraw_s *)buffer;
+            DEBUGASSERT(redraw->wnd == &nxmu->be.bkgd);
+            ginfo("Re-draw background rect={(%d,%d),(%d,%d)}\n",
+                  redraw->rect.pt1.x, redraw->rect.pt1.y,
+                  redraw->rect.pt2.x, redraw->rect.pt2.y);
+            nxbe_fill(&nxmu->be.bkgd, &redraw->rect, nxmu->be.bgcolor);
+          }
+          break;
+
+        case NX_CLIMSG_MOUSEIN:      /* Ignored */
+        case NX_CLIMSG_KBDIN:
+          break;
+
+        case NX_CLIMSG_CONNECTED:    /* Shouldn't happen */
+        case NX_CLIMSG_DISCONNECTED:
+        default:
+          gerr("ERROR: Unrecognized command: %" PRId32 "\n", msg->msgid);
+          break;
+      }
+}
+
+#ifdef CONFIG_NX_MSGRING
+/****************************************************************************
+ * Name: nxmu_ring_drain
+ *
+ * Description:
+ *   Dispatch every message queued in a client's shared-memory message
+ *   ring.  One ring doorbell message covers all of the records written
+ *   while the ring remained non-empty.
+ *
+ ****************************************************************************/
+
+static void nxmu_ring_drain(FAR struct nxmu_state_s *nxmu,
+                            FAR struct nxmu_conn_s *conn)
+{
+  char drainbuf[NX_MXSVRMSGLEN];
+  ssize_t nbytes;
+
+  while ((nbytes = nxmu_ring_get(&conn->ring, drainbuf,
+                                 NX_MXSVRMSGLEN)) > 0)
+    {
+      nxmu_dispatch(nxmu, drainbuf, (int)nbytes);
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -285,8 +646,11 @@ static inline int nxmu_setup(FAR const char *mqname, FAR NX_DRIVERTYPE *dev,
 int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
 {
   struct nxmu_state_s    nxmu;
-  FAR struct nxsvrmsg_s *msg;
   char                   buffer[NX_MXSVRMSGLEN];
+#ifdef CONFIG_NX_REDRAW_COALESCE
+  struct timespec        abstime;
+  clock_t                frametime = 0;
+#endif
   int                    nbytes;
   int                    ret;
 
@@ -314,7 +678,40 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
     {
       /* Receive the next server message */
 
+#ifdef CONFIG_NX_REDRAW_COALESCE
+      if (NXBE_STATE_ISPENDING(&nxmu.be))
+        {
+          /* Redraw regions have been accumulated.  Wait no longer than
+           * the remainder of the current frame interval so that the
+           * accumulated regions are flushed at the configured rate.
+           */
+
+          clock_gettime(CLOCK_REALTIME, &abstime);
+          abstime.tv_nsec += CONFIG_NX_REDRAW_INTERVAL * NSEC_PER_MSEC;
+          while (abstime.tv_nsec >= NSEC_PER_SEC)
+            {
+              abstime.tv_sec++;
+              abstime.tv_nsec -= NSEC_PER_SEC;
+            }
+
+          nbytes = nxmq_timedreceive(nxmu.conn.crdmq, buffer,
+                                     NX_MXSVRMSGLEN, 0, &abstime);
+          if (nbytes == -ETIMEDOUT)
+            {
+              nxmu_redraw_flushall(&nxmu.be);
+              frametime = clock_systime_ticks();
+              continue;
+            }
+        }
+      else
+        {
+          nbytes = nxmq_receive(nxmu.conn.crdmq, buffer,
+                                NX_MXSVRMSGLEN, 0);
+        }
+#else
       nbytes = nxmq_receive(nxmu.conn.crdmq, buffer, NX_MXSVRMSGLEN, 0);
+#endif
+
       if (nbytes < 0)
         {
           if (nbytes != -EINTR)
@@ -329,290 +726,22 @@ int nx_runinstance(FAR const char *mqname, FAR NX_DRIVERTYPE *dev)
 
       /* Dispatch the message appropriately */
 
-      DEBUGASSERT(nbytes >= sizeof(struct nxsvrmsg_releasebkgd_s));
-      msg = (FAR struct nxsvrmsg_s *)buffer;
+      nxmu_dispatch(&nxmu, buffer, nbytes);
 
-      ginfo("Received opcode=%" PRId32 " nbytes=%d\n", msg->msgid, nbytes);
-      switch (msg->msgid)
-        {
-          /* Messages sent from clients to the NX server ********************/
-
-          case NX_SVRMSG_CONNECT: /* Establish connection with new NX server client */
-            {
-              FAR struct nxsvrmsg_s *connmsg =
-                (FAR struct nxsvrmsg_s *)buffer;
-              nxmu_connect(connmsg->conn);
-            }
-            break;
-
-          case NX_SVRMSG_DISCONNECT: /* Tear down connection with terminating client */
-            {
-              FAR struct nxsvrmsg_s *disconnmsg =
-                (FAR struct nxsvrmsg_s *)buffer;
-              nxmu_disconnect(disconnmsg->conn);
-            }
-            break;
-
-          case NX_SVRMSG_OPENWINDOW: /* Create a new window */
-            {
-              FAR struct nxsvrmsg_openwindow_s *openmsg =
-                (FAR struct nxsvrmsg_openwindow_s *)buffer;
-              nxmu_openwindow(&nxmu.be, openmsg->wnd);
-            }
-            break;
+#ifdef CONFIG_NX_REDRAW_COALESCE
+      /* A steady stream of messages will keep the timed receive above from
+       * timing out.  Flush the accumulated redraw regions anyway whenever
+       * a full frame interval has elapsed.
+       */
 
-          case NX_SVRMSG_CLOSEWINDOW: /* Close an existing window */
-            {
-              FAR struct nxsvrmsg_closewindow_s *closemsg =
-                (FAR struct nxsvrmsg_closewindow_s *)buffer;
-              nxbe_closewindow(closemsg->wnd);
-            }
-            break;
-
-          case NX_SVRMSG_BLOCKED: /* Block messages to a window */
-            {
-              FAR struct nxsvrmsg_blocked_s *blocked =
-                (FAR struct nxsvrmsg_blocked_s *)buffer;
-              nxmu_event(blocked->wnd, NXEVENT_BLOCKED, blocked->arg);
-            }
-            break;
-
-          case NX_SVRMSG_SYNCH: /* Synchronization request */
-            {
-              FAR struct nxsvrmsg_synch_s *synch =
-                (FAR struct nxsvrmsg_synch_s *)buffer;
-              nxmu_event(synch->wnd, NXEVENT_SYNCHED, synch->arg);
-            }
-            break;
-
-#if defined(CONFIG_NX_SWCURSOR) || defined(CONFIG_NX_HWCURSOR)
-          case NX_SVRMSG_CURSOR_ENABLE: /* Enable/disable cursor */
-            {
-              FAR struct nxsvrmsg_curenable_s *enabmsg =
-                (FAR struct nxsvrmsg_curenable_s *)buffer;
-              nxbe_cursor_enable(&nxmu.be, enabmsg->enable);
-            }
-            break;
-
-#if defined(CONFIG_NX_HWCURSORIMAGE) || defined(CONFIG_NX_SWCURSOR)
-          case NX_SVRMSG_CURSOR_IMAGE: /* Set cursor image */
-            {
-              FAR struct nxsvrmsg_curimage_s *imgmsg =
-                (FAR struct nxsvrmsg_curimage_s *)buffer;
-              nxbe_cursor_setimage(&nxmu.be, &imgmsg->image);
-            }
-            break;
-#endif
-          case NX_SVRMSG_CURSOR_SETPOS: /* Set cursor position */
-            {
-              FAR struct nxsvrmsg_curpos_s *posmsg =
-                (FAR struct nxsvrmsg_curpos_s *)buffer;
-              nxbe_cursor_setposition(&nxmu.be, &posmsg->pos);
-            }
-            break;
-#endif
-
-          case NX_SVRMSG_REQUESTBKGD: /* Give access to the background window */
-            {
-              FAR struct nxsvrmsg_requestbkgd_s *rqbgmsg =
-                (FAR struct nxsvrmsg_requestbkgd_s *)buffer;
-              nxmu_requestbkgd(rqbgmsg->conn, &nxmu.be, rqbgmsg->cb,
-                               rqbgmsg->arg);
-            }
-            break;
-
-          case NX_SVRMSG_RELEASEBKGD: /* End access to the background window */
-            {
-              nxmu_releasebkgd(&nxmu);
-            }
-            break;
-
-          case NX_SVRMSG_SETPOSITION: /* Change window position */
-            {
-              FAR struct nxsvrmsg_setposition_s *setposmsg =
-                (FAR struct nxsvrmsg_setposition_s *)buffer;
-              nxbe_setposition(setposmsg->wnd, &setposmsg->pos);
-            }
-            break;
-
-          case NX_SVRMSG_SETSIZE: /* Change window size */
-            {
-              FAR struct nxsvrmsg_setsize_s *setsizemsg =
-                (FAR struct nxsvrmsg_setsize_s *)buffer;
-              nxbe_setsize(setsizemsg->wnd, &setsizemsg->size);
-            }
-            break;
-
-          case NX_SVRMSG_GETPOSITION: /* Get the window size/position */
-            {
-              FAR struct nxsvrmsg_getposition_s *getposmsg =
-                (FAR struct nxsvrmsg_getposition_s *)buffer;
-              nxmu_reportposition(getposmsg->wnd);
-            }
-            break;
-
-          case NX_SVRMSG_RAISE: /* Move the window to the top of the display */
-            {
-              FAR struct nxsvrmsg_raise_s *raisemsg =
-                (FAR struct nxsvrmsg_raise_s *)buffer;
-              nxbe_raise(raisemsg->wnd);
-            }
-            break;
-
-          case NX_SVRMSG_LOWER: /* Lower the window to the bottom of the display */
-            {
-              FAR struct nxsvrmsg_lower_s *lowermsg =
-                (FAR struct nxsvrmsg_lower_s *)buffer;
-              nxbe_lower(lowermsg->wnd);
-            }
-            break;
-
-          case NX_SVRMSG_MODAL: /* Select/De-select window modal state */
-            {
-              FAR struct nxsvrmsg_modal_s *modalmsg =
-                (FAR struct nxsvrmsg_modal_s *)buffer;
-              nxbe_modal(modalmsg->wnd, modalmsg->modal);
-            }
-            break;
-
-          case NX_SVRMSG_SETVISIBILITY: /* Show or hide a window */
-            {
-              FAR struct nxsvrmsg_setvisibility_s *vismsg =
-               (FAR struct nxsvrmsg_setvisibility_s *)buffer;
-              nxbe_setvisibility(vismsg->wnd, vismsg->hide);
-            }
-            break;
-
-          case NX_SVRMSG_SETPIXEL: /* Set a single pixel in the window with a color */
-            {
-              FAR struct nxsvrmsg_setpixel_s *setmsg =
-                (FAR struct nxsvrmsg_setpixel_s *)buffer;
-              nxbe_setpixel(setmsg->wnd, &setmsg->pos, setmsg->color);
-            }
-            break;
-
-          case NX_SVRMSG_FILL: /* Fill a rectangular region in the window with a color */
-            {
-              FAR struct nxsvrmsg_fill_s *fillmsg =
-                (FAR struct nxsvrmsg_fill_s *)buffer;
-              nxbe_fill(fillmsg->wnd, &fillmsg->rect, fillmsg->color);
-            }
-            break;
-
-          case NX_SVRMSG_GETRECTANGLE: /* Get a rectangular region from the window */
-            {
-              FAR struct nxsvrmsg_getrectangle_s *getmsg =
-                (FAR struct nxsvrmsg_getrectangle_s *)buffer;
-              nxbe_getrectangle(getmsg->wnd, &getmsg->rect, getmsg->plane,
-                               getmsg->dest, getmsg->deststride);
-
-              if (getmsg->sem_done)
-                {
-                  nxsem_post(getmsg->sem_done);
-                }
-            }
-            break;
-
-          case NX_SVRMSG_FILLTRAP: /* Fill a trapezoidal region in the window with a color */
-            {
-              FAR struct nxsvrmsg_filltrapezoid_s *trapmsg =
-                (FAR struct nxsvrmsg_filltrapezoid_s *)buffer;
-              nxbe_filltrapezoid(trapmsg->wnd, &trapmsg->clip,
-                                 &trapmsg->trap, trapmsg->color);
-            }
-            break;
-
-          case NX_SVRMSG_MOVE: /* Move a rectangular region within the window */
-            {
-              FAR struct nxsvrmsg_move_s *movemsg =
-                (FAR struct nxsvrmsg_move_s *)buffer;
-              nxbe_move(movemsg->wnd, &movemsg->rect, &movemsg->offset);
-            }
-            break;
-
-          case NX_SVRMSG_BITMAP: /* Copy a rectangular bitmap into the window */
-            {
-              FAR struct nxsvrmsg_bitmap_s *bmpmsg =
-                (FAR struct nxsvrmsg_bitmap_s *)buffer;
-              nxbe_bitmap(bmpmsg->wnd, &bmpmsg->dest, bmpmsg->src,
-                          &bmpmsg->origin, bmpmsg->stride);
-
-              if (bmpmsg->sem_done)
-                {
-                  nxsem_post(bmpmsg->sem_done);
-                }
-            }
-            break;
-
-          case NX_SVRMSG_SETBGCOLOR: /* Set the color of the background */
-            {
-              FAR struct nxsvrmsg_setbgcolor_s *bgcolormsg =
-                (FAR struct nxsvrmsg_setbgcolor_s *)buffer;
-
-              /* Has the background color changed? */
-
-              if (!nxgl_colorcmp(nxmu.be.bgcolor, bgcolormsg->color))
-                {
-                  /* Yes.. fill the background */
-
-                  nxgl_colorcopy(nxmu.be.bgcolor, bgcolormsg->color);
-                  nxbe_fill(&nxmu.be.bkgd, &nxmu.be.bkgd.bounds,
-                            bgcolormsg->color);
-                }
-            }
-            break;
-
-#ifdef CONFIG_NX_XYINPUT
-          case NX_SVRMSG_MOUSEIN: /* New mouse report from mouse client */
-            {
-              FAR struct nxsvrmsg_mousein_s *mousemsg =
-                (FAR struct nxsvrmsg_mousein_s *)buffer;
-              nxmu_mousein(&nxmu, &mousemsg->pt, mousemsg->buttons);
-            }
-            break;
-#endif
-#ifdef CONFIG_NX_KBD
-          case NX_SVRMSG_KBDIN: /* New keyboard report from keyboard client */
-            {
-              FAR struct nxsvrmsg_kbdin_s *kbdmsg =
-                (FAR struct nxsvrmsg_kbdin_s *)buffer;
-              nxmu_kbdin(&nxmu, kbdmsg->nch, kbdmsg->ch);
-            }
-            break;
-#endif
-
-          case NX_SVRMSG_REDRAWREQ: /* Request re-drawing of rectangular region */
-            {
-              FAR struct nxsvrmsg_redrawreq_s *redrawmsg =
-                (FAR struct nxsvrmsg_redrawreq_s *)buffer;
-              nxmu_redraw(redrawmsg->wnd, &redrawmsg->rect);
-            }
-            break;
-
-          /* Messages sent to the background window *************************/
-
-          case NX_CLIMSG_REDRAW: /* Re-draw the background window */
-            {
-              FAR struct nxclimsg_redraw_s *redraw =
-                (FAR struct nxclimsg_redraw_s *)buffer;
-              DEBUGASSERT(redraw->wnd == &nxmu.be.bkgd);
-              ginfo("Re-draw background rect={(%d,%d),(%d,%d)}\n",
-                    redraw->rect.pt1.x, redraw->rect.pt1.y,
-                    redraw->rect.pt2.x, redraw->rect.pt2.y);
-              nxbe_fill(&nxmu.be.bkgd, &redraw->rect, nxmu.be.bgcolor);
-            }
-            break;
-
-          case NX_CLIMSG_MOUSEIN:      /* Ignored */
-          case NX_CLIMSG_KBDIN:
-            break;
-
-          case NX_CLIMSG_CONNECTED:    /* Shouldn't happen */
-          case NX_CLIMSG_DISCONNECTED:
-          default:
-            gerr("ERROR: Unrecognized command: %" PRId32 "\n", msg->msgid);
-            break;
+      if (NXBE_STATE_ISPENDING(&nxmu.be) &&
+          clock_systime_ticks() - frametime >=
+          MSEC2TICK(CONFIG_NX_REDRAW_INTERVAL))
+        {
+          nxmu_redraw_flushall(&nxmu.be);
+          frametime = clock_systime_ticks();
         }
+#endif
     }
 
   nxmu_shutdown(&nxmu);
@@ -75,6 +75,20 @@
 
 #define VT100_MAX_SEQUENCE 3
 
+/* Pre-rendered glyph run composition requires a byte-aligned pixel depth
+ * for the scratch buffer arithmetic.
+ */
+
+#if defined(CONFIG_NXTERM_GLYPHRUN) && CONFIG_NXTERM_BPP >= 8
+#  define NXTERM_HAVE_GLYPHRUN 1
+#endif
+
+/* Scrollback is enabled by a non-zero number of scrollback lines */
+
+#if defined(CONFIG_NXTERM_SCROLLBACK) && CONFIG_NXTERM_SCROLLBACK > 0
+#  define NXTERM_HAVE_SCROLLBACK 1
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -151,6 +165,25 @@ struct nxterm_state_s
   char seq[VT100_MAX_SEQUENCE];              /* Buffered characters */
   uint8_t nseq;                              /* Number of buffered characters */
 
+  /* Pre-rendered glyph run composition */
+
+#ifdef NXTERM_HAVE_GLYPHRUN
+  FAR uint8_t *runbuf;                       /* Scratch composition buffer */
+  nxgl_coord_t runx;                         /* Window x of the run start */
+  nxgl_coord_t runy;                         /* Window y of the run */
+  nxgl_coord_t runwidth;                     /* Accumulated run width */
+  uint16_t runchars;                         /* Characters in the run */
+#endif
+
+  /* Scrollback line ring */
+
+#ifdef NXTERM_HAVE_SCROLLBACK
+  FAR char *sbbuffer;                        /* Ring of sbwidth-character lines */
+  uint16_t sbwidth;                          /* Characters per scrollback line */
+  uint16_t sbhead;                           /* Next line slot to overwrite */
+  uint16_t sbcount;                          /* Valid lines in the ring */
+#endif
+
   /* Font cache data storage */
 
   FCACHE fcache;                             /* Font cache handle */
@@ -240,6 +273,14 @@ int nxterm_backspace(FAR struct nxterm_state_s *priv);
 void nxterm_fillchar(FAR struct nxterm_state_s *priv,
     FAR const struct nxgl_rect_s *rect, FAR const struct nxterm_bitmap_s *bm);
 
+/* Pre-rendered glyph run composition */
+
+#ifdef NXTERM_HAVE_GLYPHRUN
+int nxterm_runappend(FAR struct nxterm_state_s *priv,
+    FAR const struct nxterm_bitmap_s *bm);
+void nxterm_runflush(FAR struct nxterm_state_s *priv);
+#endif
+
 void nxterm_putc(FAR struct nxterm_state_s *priv, uint8_t ch);
 void nxterm_showcursor(FAR struct nxterm_state_s *priv);
 void nxterm_hidecursor(FAR struct nxterm_state_s *priv);
@@ -248,4 +289,11 @@ void nxterm_hidecursor(FAR struct nxterm_state_s *priv);
 
 void nxterm_scroll(FAR struct nxterm_state_s *priv, int scrollheight);
 
+/* Scrollback line capture */
+
+#ifdef NXTERM_HAVE_SCROLLBACK
+void nxterm_sbcapture(FAR struct nxterm_state_s *priv, int scrollheight);
+ssize_t nxterm_sbread(NXTERM handle, FAR char *buffer, size_t buflen);
+#endif
+
 #endif /* __GRAPHICS_NXTERM_NXTERM_H */
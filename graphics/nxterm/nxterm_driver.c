@@ -304,6 +304,12 @@ static ssize_t nxterm_write(FAR struct file *filep, FAR const char *buffer,
       while (state == VT100_ABORT);
     }
 
+#ifdef NXTERM_HAVE_GLYPHRUN
+  /* Send any pending glyph run to the display */
+
+  nxterm_runflush(priv);
+#endif
+
   /* Show the cursor at its new position */
 
   nxterm_showcursor(priv);
@@ -452,6 +458,27 @@ int nxterm_ioctl_tap(int cmd, uintptr_t arg)
          }
          break;
 
+      /* CMD:           NXTERMIOC_NXTERM_SCROLLBACK
+       * DESCRIPTION:   Copy buffered scrollback text, oldest line first,
+       *                into a user-provided buffer
+       * ARG:           A reference readable instance of struct
+       *                nxtermioc_scrollback_s
+       * CONFIGURATION: CONFIG_NXTERM_SCROLLBACK > 0
+       */
+
+       case NXTERMIOC_NXTERM_SCROLLBACK:
+         {
+#ifdef NXTERM_HAVE_SCROLLBACK
+           FAR struct nxtermioc_scrollback_s *sb =
+             (FAR struct nxtermioc_scrollback_s *)((uintptr_t)arg);
+
+           ret = (int)nxterm_sbread(sb->handle, sb->buffer, sb->buflen);
+#else
+           ret = -ENOSYS;
+#endif
+         }
+         break;
+
       default:
         ret = -ENOTTY;
         break;
@@ -0,0 +1,256 @@
+/****************************************************************************
+ * graphics/nxterm/nxterm_glyphrun.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+
+#include "nxterm.h"
+
+#ifdef NXTERM_HAVE_GLYPHRUN
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Bytes per pixel at the configured NxTerm depth */
+
+#define NXTERM_PIXELBYTES  (CONFIG_NXTERM_BPP >> 3)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxterm_runbackground
+ *
+ * Description:
+ *   Fill 'npixels' pixels beginning at 'dest' with the window background
+ *   color.
+ *
+ ****************************************************************************/
+
+static void nxterm_runbackground(FAR struct nxterm_state_s *priv,
+                                 FAR uint8_t *dest, nxgl_coord_t npixels)
+{
+  nxgl_mxpixel_t color = priv->wndo.wcolor[0];
+  nxgl_coord_t i;
+
+#if CONFIG_NXTERM_BPP == 8
+  memset(dest, (uint8_t)color, npixels);
+#elif CONFIG_NXTERM_BPP == 16
+  FAR uint16_t *dest16 = (FAR uint16_t *)dest;
+
+  for (i = 0; i < npixels; i++)
+    {
+      *dest16++ = (uint16_t)color;
+    }
+#elif CONFIG_NXTERM_BPP == 24
+  for (i = 0; i < npixels; i++)
+    {
+      *dest++ = (uint8_t)(color & 0xff);
+      *dest++ = (uint8_t)((color >> 8) & 0xff);
+      *dest++ = (uint8_t)((color >> 16) & 0xff);
+    }
+#else /* CONFIG_NXTERM_BPP == 32 */
+  FAR uint32_t *dest32 = (FAR uint32_t *)dest;
+
+  for (i = 0; i < npixels; i++)
+    {
+      *dest32++ = (uint32_t)color;
+    }
+#endif
+
+  UNUSED(i);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxterm_runflush
+ *
+ * Description:
+ *   Send any pending glyph run to the display as a single bitmap update.
+ *   A no-op if no run is pending.  This must be called before any display
+ *   operation that does not go through nxterm_runappend() (erasures,
+ *   scrolling, cursor updates, etc.) so that output reaches the display
+ *   in order.
+ *
+ ****************************************************************************/
+
+void nxterm_runflush(FAR struct nxterm_state_s *priv)
+{
+  struct nxgl_rect_s dest;
+  struct nxgl_point_s origin;
+  FAR const void *src;
+  int ret;
+
+  if (priv->runchars == 0)
+    {
+      return;
+    }
+
+  /* The scratch buffer holds one full-height band of the window; the
+   * source stride is therefore the full window width.
+   */
+
+  dest.pt1.x = priv->runx;
+  dest.pt1.y = priv->runy;
+  dest.pt2.x = priv->runx + priv->runwidth - 1;
+  dest.pt2.y = priv->runy + priv->fheight - 1;
+
+  origin.x   = priv->runx;
+  origin.y   = priv->runy;
+
+  src        = (FAR const void *)priv->runbuf;
+
+  ret = priv->ops->bitmap(priv, &dest, &src, &origin,
+                          (unsigned int)priv->wndo.wsize.w *
+                          NXTERM_PIXELBYTES);
+  if (ret < 0)
+    {
+      gerr("ERROR: bitmap() method failed: %d\n", ret);
+    }
+
+  priv->runchars = 0;
+  priv->runwidth = 0;
+}
+
+/****************************************************************************
+ * Name: nxterm_runappend
+ *
+ * Description:
+ *   Compose the character at 'bm' into the pending glyph run instead of
+ *   issuing an immediate per-character update.  The pre-rendered glyph is
+ *   copied from the font cache -- already expanded to the device color
+ *   depth -- into the scratch buffer.  If the character is not contiguous
+ *   with the pending run, then the pending run is flushed first and a new
+ *   run is started.
+ *
+ * Returned Value:
+ *   Zero (OK) if the character was composed into the run; a negated errno
+ *   value on failure.  On failure the caller should fall back to
+ *   nxterm_fillchar().
+ *
+ ****************************************************************************/
+
+int nxterm_runappend(FAR struct nxterm_state_s *priv,
+                     FAR const struct nxterm_bitmap_s *bm)
+{
+  FAR const struct nxfonts_glyph_s *glyph = NULL;
+  FAR uint8_t *dest;
+  nxgl_coord_t width;
+  unsigned int stride;
+  unsigned int rowbytes;
+  int row;
+
+  /* Allocate the scratch buffer on first use:  One full-height band of
+   * the window at the device color depth.
+   */
+
+  if (priv->runbuf == NULL)
+    {
+      priv->runbuf = (FAR uint8_t *)
+        kmm_malloc((size_t)priv->wndo.wsize.w * priv->fheight *
+                   NXTERM_PIXELBYTES);
+      if (priv->runbuf == NULL)
+        {
+          return -ENOMEM;
+        }
+    }
+
+  /* Spaces are composed as background only; all other characters need
+   * their glyph from the font cache.
+   */
+
+  if (BM_ISSPACE(bm))
+    {
+      width = priv->spwidth;
+    }
+  else
+    {
+      glyph = nxf_cache_getglyph(priv->fcache, bm->code);
+      if (glyph == NULL)
+        {
+          return -ENOENT;
+        }
+
+      width = glyph->width;
+    }
+
+  /* If the character does not continue the pending run, then flush the
+   * pending run and start a new one at the character position.
+   */
+
+  if (priv->runchars > 0 &&
+      (bm->pos.y != priv->runy ||
+       bm->pos.x != priv->runx + priv->runwidth))
+    {
+      nxterm_runflush(priv);
+    }
+
+  if (priv->runchars == 0)
+    {
+      priv->runx     = bm->pos.x;
+      priv->runy     = bm->pos.y;
+      priv->runwidth = 0;
+    }
+
+  /* Fill the full-height column band of the new character with the
+   * window background color, then overlay the glyph rows (glyphs may be
+   * shorter than the font height).
+   */
+
+  stride   = (unsigned int)priv->wndo.wsize.w * NXTERM_PIXELBYTES;
+  rowbytes = (unsigned int)width * NXTERM_PIXELBYTES;
+  dest     = priv->runbuf + (unsigned int)priv->runwidth *
+                            NXTERM_PIXELBYTES;
+
+  for (row = 0; row < priv->fheight; row++)
+    {
+      nxterm_runbackground(priv, dest + row * stride, width);
+    }
+
+  if (glyph != NULL)
+    {
+      for (row = 0; row < glyph->height; row++)
+        {
+          memcpy(dest + row * stride, glyph->bitmap + row * glyph->stride,
+                 rowbytes);
+        }
+    }
+
+  priv->runwidth += width;
+  priv->runchars++;
+  return OK;
+}
+
+#endif /* NXTERM_HAVE_GLYPHRUN */
@@ -75,6 +75,11 @@ void nxterm_putc(FAR struct nxterm_state_s *priv, uint8_t ch)
 
   if (ch == ASCII_BS || ch == ASCII_DEL)
     {
+#ifdef NXTERM_HAVE_GLYPHRUN
+      /* The character to be erased may still be in the pending run */
+
+      nxterm_runflush(priv);
+#endif
       nxterm_backspace(priv);
       return;
     }
@@ -117,6 +122,16 @@ void nxterm_putc(FAR struct nxterm_state_s *priv, uint8_t ch)
   /* Check if we need to scroll up */
 
   lineheight = (priv->fheight + CONFIG_NXTERM_LINESEPARATION);
+
+#ifdef NXTERM_HAVE_GLYPHRUN
+  /* Scrolling moves display memory under the pending run; flush it first */
+
+  if (priv->fpos.y >= priv->wndo.wsize.h - lineheight)
+    {
+      nxterm_runflush(priv);
+    }
+#endif
+
   while (priv->fpos.y >= priv->wndo.wsize.h - lineheight)
     {
       nxterm_scroll(priv, lineheight);
@@ -129,6 +144,18 @@ void nxterm_putc(FAR struct nxterm_state_s *priv, uint8_t ch)
   bm = nxterm_addchar(priv, ch);
   if (bm)
     {
+#ifdef NXTERM_HAVE_GLYPHRUN
+      /* Compose the character into the pending glyph run.  The run is
+       * sent to the display as a single bitmap update when it is broken
+       * by a control operation or when the write completes.
+       */
+
+      if (nxterm_runappend(priv, bm) == OK)
+        {
+          return;
+        }
+#endif
+
       nxterm_fillchar(priv, NULL, bm);
     }
 }
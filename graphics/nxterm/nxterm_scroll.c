@@ -186,6 +186,14 @@ void nxterm_scroll(FAR struct nxterm_state_s *priv, int scrollheight)
   int i;
   int j;
 
+#ifdef NXTERM_HAVE_SCROLLBACK
+  /* Capture the text of the line about to scroll off the display before
+   * its characters are discarded below.
+   */
+
+  nxterm_sbcapture(priv, scrollheight);
+#endif
+
   /* Adjust the vertical position of each character */
 
   for (i = 0; i < priv->nchars; )
@@ -0,0 +1,212 @@
+/****************************************************************************
+ * graphics/nxterm/nxterm_scrollback.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/kmalloc.h>
+
+#include "nxterm.h"
+
+#ifdef NXTERM_HAVE_SCROLLBACK
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxterm_sbcapture
+ *
+ * Description:
+ *   Capture the text of the line that is about to scroll off the top of
+ *   the display into the scrollback line ring.  This must be called from
+ *   nxterm_scroll() BEFORE the scrolled-off characters are removed from
+ *   the bm[] array.  nxterm_scroll() is called one text line at a time so
+ *   each call captures exactly one line.
+ *
+ *   Character cell columns are approximated by dividing the character x
+ *   position by the width of a space.  For the fixed-width fonts normally
+ *   used on a console this reproduces the displayed text exactly.
+ *
+ * Input Parameters:
+ *   priv         - NxTerm private state structure instance.
+ *   scrollheight - The height of the region being scrolled off.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxterm_sbcapture(FAR struct nxterm_state_s *priv, int scrollheight)
+{
+  FAR const struct nxterm_bitmap_s *bm;
+  FAR char *line;
+  int col;
+  int i;
+
+  /* Allocate the scrollback ring when the first line scrolls off.  A
+   * console that never scrolls then costs no additional memory.
+   */
+
+  if (priv->sbbuffer == NULL)
+    {
+      priv->sbwidth = priv->wndo.wsize.w / priv->spwidth;
+      if (priv->sbwidth < 1)
+        {
+          priv->sbwidth = 1;
+        }
+
+      priv->sbbuffer = (FAR char *)
+        kmm_malloc((size_t)CONFIG_NXTERM_SCROLLBACK * priv->sbwidth);
+
+      if (priv->sbbuffer == NULL)
+        {
+          gerr("ERROR: Failed to allocate scrollback buffer\n");
+          return;
+        }
+    }
+
+  /* Initialize the oldest line slot in the ring to all spaces */
+
+  line = &priv->sbbuffer[(size_t)priv->sbhead * priv->sbwidth];
+  memset(line, ' ', priv->sbwidth);
+
+  /* Then overwrite the spaces with the code of each character that lies
+   * (at least partially) within the scrolled-off region.
+   */
+
+  for (i = 0; i < priv->nchars; i++)
+    {
+      bm = &priv->bm[i];
+      if (bm->pos.y < scrollheight + CONFIG_NXTERM_LINESEPARATION &&
+          !BM_ISSPACE(bm))
+        {
+          col = bm->pos.x / priv->spwidth;
+          if (col < priv->sbwidth)
+            {
+              line[col] = (char)bm->code;
+            }
+        }
+    }
+
+  /* Advance the ring, overwriting the oldest line when it is full */
+
+  if (++priv->sbhead >= CONFIG_NXTERM_SCROLLBACK)
+    {
+      priv->sbhead = 0;
+    }
+
+  if (priv->sbcount < CONFIG_NXTERM_SCROLLBACK)
+    {
+      priv->sbcount++;
+    }
+}
+
+/****************************************************************************
+ * Name: nxterm_sbread
+ *
+ * Description:
+ *   Copy buffered scrollback text, oldest line first, into a user-provided
+ *   buffer.  Each line is trimmed of trailing spaces and terminated with a
+ *   newline character.  This implements the NXTERMIOC_NXTERM_SCROLLBACK
+ *   IOCTL command.
+ *
+ * Input Parameters:
+ *   handle - A handle previously returned by nx_register, nxtk_register,
+ *            or nxtool_register.
+ *   buffer - User-provided buffer to receive the scrollback text.
+ *   buflen - The size of the user-provided buffer in bytes.
+ *
+ * Returned Value:
+ *   The number of bytes copied into the buffer is returned on success;
+ *   a negated errno value is returned on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t nxterm_sbread(NXTERM handle, FAR char *buffer, size_t buflen)
+{
+  FAR struct nxterm_state_s *priv;
+  FAR const char *line;
+  size_t nread;
+  int width;
+  int index;
+  int i;
+  int ret;
+
+  DEBUGASSERT(handle != NULL && buffer != NULL);
+
+  /* Recover our private state structure */
+
+  priv = (FAR struct nxterm_state_s *)handle;
+
+  /* Get exclusive access to the state structure */
+
+  ret = nxterm_semwait(priv);
+  if (ret < 0)
+    {
+      return (ssize_t)ret;
+    }
+
+  /* Copy out each buffered line, oldest first */
+
+  nread = 0;
+  for (i = 0; i < priv->sbcount; i++)
+    {
+      index = priv->sbhead - priv->sbcount + i;
+      if (index < 0)
+        {
+          index += CONFIG_NXTERM_SCROLLBACK;
+        }
+
+      line = &priv->sbbuffer[(size_t)index * priv->sbwidth];
+
+      /* Trim trailing spaces from the line */
+
+      width = priv->sbwidth;
+      while (width > 0 && line[width - 1] == ' ')
+        {
+          width--;
+        }
+
+      /* Stop when the trimmed line plus its newline no longer fits */
+
+      if (nread + width + 1 > buflen)
+        {
+          break;
+        }
+
+      memcpy(&buffer[nread], line, width);
+      nread += width;
+      buffer[nread++] = '\n';
+    }
+
+  nxterm_sempost(priv);
+  return (ssize_t)nread;
+}
+
+#endif /* NXTERM_HAVE_SCROLLBACK */
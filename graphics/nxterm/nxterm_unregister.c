@@ -92,6 +92,24 @@ void nxterm_unregister(FAR struct nxterm_state_s *priv)
   snprintf(devname, NX_DEVNAME_SIZE, NX_DEVNAME_FORMAT, priv->minor);
   unregister_driver(devname);
 
+#ifdef NXTERM_HAVE_GLYPHRUN
+  /* Free the glyph run composition buffer */
+
+  if (priv->runbuf != NULL)
+    {
+      kmm_free(priv->runbuf);
+    }
+#endif
+
+#ifdef NXTERM_HAVE_SCROLLBACK
+  /* Free the scrollback line ring */
+
+  if (priv->sbbuffer != NULL)
+    {
+      kmm_free(priv->sbbuffer);
+    }
+#endif
+
   /* Free the private data structure */
 
   kmm_free(priv);
@@ -152,6 +152,21 @@
 #define VNCSERVER_UPDATE_BUFSIZE \
   (CONFIG_VNCSERVER_UPDATE_BUFSIZE + SIZEOF_RFB_FRAMEBUFFERUPDATE_S(0))
 
+#ifdef CONFIG_VNCSERVER_TILECACHE
+#  ifndef CONFIG_VNCSERVER_TILESIZE
+#    define CONFIG_VNCSERVER_TILESIZE 32
+#  endif
+
+/* Dimensions of the display in whole or partial tiles */
+
+#  define VNCSERVER_NTILESX \
+     ((CONFIG_VNCSERVER_SCREENWIDTH + CONFIG_VNCSERVER_TILESIZE - 1) / \
+      CONFIG_VNCSERVER_TILESIZE)
+#  define VNCSERVER_NTILESY \
+     ((CONFIG_VNCSERVER_SCREENHEIGHT + CONFIG_VNCSERVER_TILESIZE - 1) / \
+      CONFIG_VNCSERVER_TILESIZE)
+#endif
+
 /* Local framebuffer characteristics in bytes */
 
 #define RFB_BYTESPERPIXEL   ((RFB_BITSPERPIXEL + 7) >> 3)
@@ -251,6 +266,15 @@ struct vnc_session_s
   sem_t freesem;
   sem_t queuesem;
 
+#ifdef CONFIG_VNCSERVER_TILECACHE
+  /* Hash of the content of each display tile as it was last transmitted
+   * to the client.  The value zero is reserved to mean that the tile has
+   * not been transmitted (see vnc_tilecache_invalidate()).
+   */
+
+  uint32_t tilehash[VNCSERVER_NTILESY][VNCSERVER_NTILESX];
+#endif
+
   /* I/O buffers for misc network send/receive */
 
   uint8_t inbuf[CONFIG_VNCSERVER_INBUFFER_SIZE];
@@ -478,6 +502,49 @@ int vnc_receiver(FAR struct vnc_session_s *session);
 
 int vnc_rre(FAR struct vnc_session_s *session, FAR struct nxgl_rect_s *rect);
 
+/****************************************************************************
+ * Name: vnc_tilecache_invalidate
+ *
+ * Description:
+ *  Invalidate all cached tile content hashes.  This must be done whenever
+ *  a new client connects since the new client has seen none of the tiles.
+ *
+ * Input Parameters:
+ *   session - An instance of the session structure.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_VNCSERVER_TILECACHE
+void vnc_tilecache_invalidate(FAR struct vnc_session_s *session);
+
+/****************************************************************************
+ * Name: vnc_update_tiles
+ *
+ * Description:
+ *  Encode and send the update rectangle, skipping any tiles within the
+ *  rectangle whose content has not changed since the tile was last
+ *  transmitted.  Horizontal runs of changed tiles are sent as single
+ *  rectangles using the RRE encoding when possible and the RAW encoding
+ *  otherwise.
+ *
+ * Input Parameters:
+ *   session - An instance of the session structure.
+ *   rect    - Describes the rectangle in the local framebuffer.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; A negated errno value is returned on failure that
+ *   indicates the nature of the failure.  A failure is only returned
+ *   in cases of a network failure and unexpected internal failures.
+ *
+ ****************************************************************************/
+
+int vnc_update_tiles(FAR struct vnc_session_s *session,
+                     FAR const struct nxgl_rect_s *rect);
+#endif
+
 /****************************************************************************
  * Name: vnc_raw
  *
@@ -0,0 +1,284 @@
+/****************************************************************************
+ * graphics/vnc/server/vnc_tilecache.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+
+#if defined(CONFIG_VNCSERVER_DEBUG) && !defined(CONFIG_DEBUG_GRAPHICS)
+#  undef  CONFIG_DEBUG_ERROR
+#  undef  CONFIG_DEBUG_WARN
+#  undef  CONFIG_DEBUG_INFO
+#  undef  CONFIG_DEBUG_GRAPHICS_ERROR
+#  undef  CONFIG_DEBUG_GRAPHICS_WARN
+#  undef  CONFIG_DEBUG_GRAPHICS_INFO
+#  define CONFIG_DEBUG_ERROR          1
+#  define CONFIG_DEBUG_WARN           1
+#  define CONFIG_DEBUG_INFO           1
+#  define CONFIG_DEBUG_GRAPHICS       1
+#  define CONFIG_DEBUG_GRAPHICS_ERROR 1
+#  define CONFIG_DEBUG_GRAPHICS_WARN  1
+#  define CONFIG_DEBUG_GRAPHICS_INFO  1
+#endif
+#include <debug.h>
+
+#include "vnc_server.h"
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: vnc_tile_hash
+ *
+ * Description:
+ *  Compute a hash of the current content of one display tile in the local
+ *  framebuffer.  The hash is always computed over the full extent of the
+ *  tile (clipped only at the right and bottom edges of the display) so
+ *  that the cached value is independent of the update rectangle that
+ *  covered the tile.
+ *
+ * Input Parameters:
+ *   session - An instance of the session structure.
+ *   tilex   - Tile column index.
+ *   tiley   - Tile row index.
+ *
+ * Returned Value:
+ *   The non-zero content hash of the tile.  Zero is reserved to mean
+ *   "not transmitted" and is never returned.
+ *
+ ****************************************************************************/
+
+static uint32_t vnc_tile_hash(FAR struct vnc_session_s *session,
+                              nxgl_coord_t tilex, nxgl_coord_t tiley)
+{
+  FAR const uint8_t *row;
+  nxgl_coord_t width;
+  nxgl_coord_t height;
+  nxgl_coord_t x;
+  nxgl_coord_t y;
+  uint32_t hash;
+  int i;
+
+  /* Get the position and dimensions of the tile in pixels, clipping at
+   * the right and bottom edges of the display.
+   */
+
+  x      = tilex * CONFIG_VNCSERVER_TILESIZE;
+  y      = tiley * CONFIG_VNCSERVER_TILESIZE;
+  width  = MIN(CONFIG_VNCSERVER_TILESIZE,
+               CONFIG_VNCSERVER_SCREENWIDTH - x);
+  height = MIN(CONFIG_VNCSERVER_TILESIZE,
+               CONFIG_VNCSERVER_SCREENHEIGHT - y);
+
+  /* Then hash the tile content row-by-row (FNV-1a) */
+
+  row  = session->fb + RFB_STRIDE * y + RFB_BYTESPERPIXEL * x;
+  hash = 2166136261u;
+
+  for (; height > 0; height--)
+    {
+      for (i = 0; i < RFB_BYTESPERPIXEL * width; i++)
+        {
+          hash ^= row[i];
+          hash *= 16777619u;
+        }
+
+      row += RFB_STRIDE;
+    }
+
+  /* Zero is reserved to mean that the tile has not been transmitted */
+
+  return hash != 0 ? hash : 1;
+}
+
+/****************************************************************************
+ * Name: vnc_send_run
+ *
+ * Description:
+ *  Encode and send the rectangle covering a horizontal run of changed
+ *  tiles, clipped to the display dimensions.
+ *
+ * Input Parameters:
+ *   session - An instance of the session structure.
+ *   tile1   - Tile column index of the first changed tile in the run.
+ *   tile2   - Tile column index of the last changed tile in the run.
+ *   tiley   - Tile row index of the run.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on a network failure.
+ *
+ ****************************************************************************/
+
+static int vnc_send_run(FAR struct vnc_session_s *session,
+                        nxgl_coord_t tile1, nxgl_coord_t tile2,
+                        nxgl_coord_t tiley)
+{
+  struct nxgl_rect_s run;
+  int ret;
+
+  run.pt1.x = tile1 * CONFIG_VNCSERVER_TILESIZE;
+  run.pt1.y = tiley * CONFIG_VNCSERVER_TILESIZE;
+  run.pt2.x = MIN((tile2 + 1) * CONFIG_VNCSERVER_TILESIZE - 1,
+                  CONFIG_VNCSERVER_SCREENWIDTH - 1);
+  run.pt2.y = MIN(run.pt1.y + CONFIG_VNCSERVER_TILESIZE - 1,
+                  CONFIG_VNCSERVER_SCREENHEIGHT - 1);
+
+  /* Attempt to use RRE encoding */
+
+  ret = vnc_rre(session, &run);
+  if (ret == 0)
+    {
+      /* Perform the framebuffer update using the default RAW encoding */
+
+      ret = vnc_raw(session, &run);
+    }
+
+  return ret < 0 ? ret : OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: vnc_tilecache_invalidate
+ *
+ * Description:
+ *  Invalidate all cached tile content hashes.  This must be done whenever
+ *  a new client connects since the new client has seen none of the tiles.
+ *
+ * Input Parameters:
+ *   session - An instance of the session structure.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void vnc_tilecache_invalidate(FAR struct vnc_session_s *session)
+{
+  memset(session->tilehash, 0, sizeof(session->tilehash));
+}
+
+/****************************************************************************
+ * Name: vnc_update_tiles
+ *
+ * Description:
+ *  Encode and send the update rectangle, skipping any tiles within the
+ *  rectangle whose content has not changed since the tile was last
+ *  transmitted.  Horizontal runs of changed tiles are sent as single
+ *  rectangles using the RRE encoding when possible and the RAW encoding
+ *  otherwise.
+ *
+ *  Tiles that are only partially covered by the update rectangle are
+ *  hashed, and sent, in their entirety.  That keeps the cached hash
+ *  independent of the update rectangle and is always legal:  The region
+ *  sent to the client may be larger than the region that changed.
+ *
+ * Input Parameters:
+ *   session - An instance of the session structure.
+ *   rect    - Describes the rectangle in the local framebuffer.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; A negated errno value is returned on failure that
+ *   indicates the nature of the failure.  A failure is only returned
+ *   in cases of a network failure and unexpected internal failures.
+ *
+ ****************************************************************************/
+
+int vnc_update_tiles(FAR struct vnc_session_s *session,
+                     FAR const struct nxgl_rect_s *rect)
+{
+  nxgl_coord_t tilex1;
+  nxgl_coord_t tilex2;
+  nxgl_coord_t tiley1;
+  nxgl_coord_t tiley2;
+  nxgl_coord_t tilex;
+  nxgl_coord_t tiley;
+  nxgl_coord_t run;
+  uint32_t hash;
+  int ret;
+
+  /* Get the range of tiles covered by the update rectangle */
+
+  tilex1 = rect->pt1.x / CONFIG_VNCSERVER_TILESIZE;
+  tilex2 = rect->pt2.x / CONFIG_VNCSERVER_TILESIZE;
+  tiley1 = rect->pt1.y / CONFIG_VNCSERVER_TILESIZE;
+  tiley2 = rect->pt2.y / CONFIG_VNCSERVER_TILESIZE;
+
+  DEBUGASSERT(tilex2 < VNCSERVER_NTILESX && tiley2 < VNCSERVER_NTILESY);
+
+  /* Visit each row of tiles, collecting horizontal runs of changed tiles */
+
+  for (tiley = tiley1; tiley <= tiley2; tiley++)
+    {
+      run = -1;
+
+      for (tilex = tilex1; tilex <= tilex2; tilex++)
+        {
+          /* Has the content of this tile changed since it was last sent? */
+
+          hash = vnc_tile_hash(session, tilex, tiley);
+          if (hash != session->tilehash[tiley][tilex])
+            {
+              /* Yes.. the tile is now part of the current run */
+
+              session->tilehash[tiley][tilex] = hash;
+              if (run < 0)
+                {
+                  run = tilex;
+                }
+            }
+          else if (run >= 0)
+            {
+              /* No.. send the run of changed tiles just ended */
+
+              ret = vnc_send_run(session, run, tilex - 1, tiley);
+              if (ret < 0)
+                {
+                  return ret;
+                }
+
+              run = -1;
+            }
+        }
+
+      /* Send any run still open at the end of the row */
+
+      if (run >= 0)
+        {
+          ret = vnc_send_run(session, run, tilex2, tiley);
+          if (ret < 0)
+            {
+              return ret;
+            }
+        }
+    }
+
+  return OK;
+}
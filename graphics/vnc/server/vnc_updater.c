@@ -379,6 +379,13 @@ static FAR void *vnc_updater(FAR void *arg)
               srcrect->rect.pt1.x, srcrect->rect.pt1.y,
               srcrect->rect.pt2.x, srcrect->rect.pt2.y);
 
+#ifdef CONFIG_VNCSERVER_TILECACHE
+      /* Encode and send the region, skipping any tiles whose content has
+       * not changed since they were last transmitted.
+       */
+
+      ret = vnc_update_tiles(session, &srcrect->rect);
+#else
       /* Attempt to use RRE encoding */
 
       ret = vnc_rre(session, &srcrect->rect);
@@ -388,6 +395,7 @@ static FAR void *vnc_updater(FAR void *arg)
 
           ret = vnc_raw(session, &srcrect->rect);
         }
+#endif
 
       /* Release the update structure */
 
@@ -433,6 +441,12 @@ int vnc_start_updater(FAR struct vnc_session_s *session)
 
   ginfo("Starting updater for Display %d\n", session->display);
 
+#ifdef CONFIG_VNCSERVER_TILECACHE
+  /* The newly connected client has seen none of the display tiles yet */
+
+  vnc_tilecache_invalidate(session);
+#endif
+
   /* Create thread that is gonna send rectangles to the client */
 
   session->state = VNCSERVER_RUNNING;
@@ -26,6 +26,7 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+#include <nuttx/compiler.h>
 
 #include <sys/types.h>
 #include <stdint.h>
@@ -47,6 +48,15 @@
 #ifdef CONFIG_ENDIAN_BIG
 # define HTONS(ns) (ns)
 # define HTONL(nl) (nl)
+#elif defined(CONFIG_HAVE_BUILTIN_BSWAP16)
+/* The compiler byte-reversal builtins generate a single byte-reverse
+ * instruction on architectures that have one (e.g. REV16/REV on ARMv6 and
+ * above) instead of a sequence of shifts and ORs, and still fold to a
+ * constant when given a constant argument.
+ */
+
+# define HTONS(ns) ((uint16_t)__builtin_bswap16((uint16_t)(ns)))
+# define HTONL(nl) ((uint32_t)__builtin_bswap32((uint32_t)(nl)))
 #else
 # define HTONS(ns) \
   (unsigned short) \
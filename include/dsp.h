@@ -183,6 +183,9 @@ struct pid_controller_s
   float       KP;               /* Proportional coefficient */
   float       KI;               /* Integral coefficient */
   float       KD;               /* Derivative coefficient */
+  float       d_filter;         /* Derivative low-pass filter coefficient
+                                 * (0.0 - 1.0) where 0.0 disables filtering
+                                 */
   float       part[3];          /* 0 - proporitonal part
                                  * 1 - integral part
                                  * 2 - derivative part
@@ -387,10 +390,15 @@ void pi_controller_init(FAR pid_controller_t *pid,
                         float KP, float KI);
 void pid_saturation_set(FAR pid_controller_t *pid, float min, float max);
 void pi_saturation_set(FAR pid_controller_t *pid, float min, float max);
+void pid_derivative_filter_set(FAR pid_controller_t *pid, float filter);
 void pid_integral_reset(FAR pid_controller_t *pid);
 void pi_integral_reset(FAR pid_controller_t *pid);
 float pi_controller(FAR pid_controller_t *pid, float err);
 float pid_controller(FAR pid_controller_t *pid, float err);
+void pi_controller_batch(FAR pid_controller_t *pid, int num,
+                         FAR float *err, FAR float *out);
+void pid_controller_batch(FAR pid_controller_t *pid, int num,
+                          FAR float *err, FAR float *out);
 
 /* Transformation functions */
 
@@ -110,6 +110,30 @@ struct adc_callback_s
 
   CODE int (*au_receive)(FAR struct adc_dev_s *dev, uint8_t ch,
                          int32_t data);
+
+#ifdef CONFIG_ADC_STREAM
+  /* This method is called from the lower half when a whole buffer of
+   * decoded samples is available at once -- typically from the completion
+   * interrupt of one half of a DMA ping-pong buffer.  All samples are
+   * enqueued with a single critical section and readers are notified at
+   * most once per call, so sustained acquisition costs one interrupt and
+   * one notification per buffer instead of per sample.
+   *
+   * Input Parameters:
+   *   dev    - The ADC device structure that was previously registered by
+   *            adc_register()
+   *   buffer - An array of decoded ADC samples
+   *   count  - The number of samples in the buffer
+   *
+   * Returned Value:
+   *   The number of samples enqueued on success; a negated errno value on
+   *   failure.  A short count indicates that the FIFO overran.
+   */
+
+  CODE int (*au_receive_batch)(FAR struct adc_dev_s *dev,
+                               FAR const struct adc_msg_s *buffer,
+                               size_t count);
+#endif
 };
 
 /* This describes on ADC message */
@@ -202,6 +226,18 @@ struct adc_dev_s
    */
 
   struct pollfd *fds[CONFIG_ADC_NPOLLWAITERS];
+
+#ifdef CONFIG_ADC_STREAM
+  /* Streaming mode state.  The watermark is the minimum number of buffered
+   * samples before blocked readers and poll waiters are notified.  The
+   * channel mask selects which channels are retained in the FIFO; bit n
+   * corresponds to channel n and channels above 31 are always retained.
+   */
+
+  uint16_t                    ad_watermark;  /* Notification watermark in samples */
+  uint32_t                    ad_chanmask;   /* Channels retained in the FIFO */
+  uint32_t                    ad_overruns;   /* Number of samples lost to overrun */
+#endif
 #endif /* CONFIG_ADC */
 
   /* Fields provided by lower half ADC logic */
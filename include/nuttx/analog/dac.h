@@ -75,6 +75,16 @@
 #  define CONFIG_DAC_FIFOSIZE 255
 #endif
 
+/* Waveform playback buffering (see CONFIG_DAC_WAVEFORM) */
+
+#if !defined(CONFIG_DAC_WAVEFORM_NBUFFERS)
+#  define CONFIG_DAC_WAVEFORM_NBUFFERS 4
+#endif
+
+#if !defined(CONFIG_DAC_WAVEFORM_BUFSIZE)
+#  define CONFIG_DAC_WAVEFORM_BUFSIZE 256
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -96,6 +106,23 @@ struct dac_fifo_s
   struct dac_msg_s af_buffer[CONFIG_DAC_FIFOSIZE];
 };
 
+#ifdef CONFIG_DAC_WAVEFORM
+/* This structure describes one waveform sample buffer.  Buffers are filled
+ * from the write() data in waveform playback mode, streamed by the lower
+ * half ao_sendbuffer() method -- normally via timer-paced DMA -- and
+ * recycled by dac_wavedone() from the completion interrupt.  The sample
+ * values have the same left-justified format as dac_msg_s am_data.
+ */
+
+struct dac_wavebuffer_s
+{
+  FAR struct dac_wavebuffer_s *wb_flink;  /* Supports the buffer queues */
+  uint8_t  wb_channel;                    /* The DAC channel to play on */
+  uint16_t wb_nsamples;                   /* Number of valid samples */
+  uint32_t wb_samples[CONFIG_DAC_WAVEFORM_BUFSIZE];
+};
+#endif
+
 /* This structure defines all of the operations provided by the architecture
  * specific logic.  All fields must be provided with non-NULL function
  * pointers by the caller of dac_register().
@@ -136,6 +163,18 @@ struct dac_ops_s
 
   CODE int (*ao_ioctl)(FAR struct dac_dev_s *dev, int cmd,
                        unsigned long arg);
+
+#ifdef CONFIG_DAC_WAVEFORM
+  /* Stream a whole buffer of samples at the hardware sample rate --
+   * normally via timer-paced DMA.  The lower half must call dac_wavedone()
+   * when the buffer has been consumed.  This method is required for
+   * waveform playback mode; ANIOC_WAVE_START fails with -ENOSYS if the
+   * lower half does not provide it.
+   */
+
+  CODE int (*ao_sendbuffer)(FAR struct dac_dev_s *dev,
+                            FAR struct dac_wavebuffer_s *wb);
+#endif
 };
 
 /* This is the device structure used by the driver.  The caller of
@@ -155,6 +194,21 @@ struct dac_dev_s
   sem_t                   ad_closesem; /* Locks out new opens while close is
                                         * in progress */
   struct dac_fifo_s       ad_xmit;     /* Describes receive FIFO */
+
+#ifdef CONFIG_DAC_WAVEFORM
+  /* Waveform playback mode state */
+
+  bool                    ad_wavemode;    /* True: playback mode enabled */
+  bool                    ad_wavebusy;    /* True: a buffer is streaming */
+  uint8_t                 ad_wavechan;    /* Channel being played */
+  uint8_t                 ad_wavewaiters; /* Writers waiting for a buffer */
+  sem_t                   ad_wavesem;     /* Signals a recycled buffer */
+  FAR struct dac_wavebuffer_s *ad_wavebufs; /* The buffer pool allocation */
+  FAR struct dac_wavebuffer_s *ad_wavefree; /* List of free buffers */
+  FAR struct dac_wavebuffer_s *ad_wavehead; /* Queue of filled buffers */
+  FAR struct dac_wavebuffer_s *ad_wavetail;
+#endif
+
   const struct dac_ops_s *ad_ops;      /* Arch-specific operations */
   void                   *ad_priv;     /* Used by the arch-specific logic */
 };
@@ -207,6 +261,28 @@ int dac_register(FAR const char *path, FAR struct dac_dev_s *dev);
 
 int dac_txdone(FAR struct dac_dev_s *dev);
 
+/****************************************************************************
+ * Name: dac_wavedone
+ *
+ * Description:
+ *   Called from the DAC interrupt handler -- normally the DMA completion
+ *   interrupt -- when the lower half has consumed a waveform buffer that
+ *   was provided via the ao_sendbuffer() method.  The buffer is recycled
+ *   and the next queued buffer, if any, is streamed.
+ *
+ * Input Parameters:
+ *    dev - An instance of the device-specific DAC interface
+ *    wb  - The consumed waveform buffer
+ *
+ * Returned Value:
+ *   OK on success; a negated errno on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_DAC_WAVEFORM
+int dac_wavedone(FAR struct dac_dev_s *dev, FAR struct dac_wavebuffer_s *wb);
+#endif
+
 /****************************************************************************
  * DAC Initialization functions
  *
@@ -68,6 +68,28 @@
 #define AN_FIRST          0x0001          /* First common command */
 #define AN_NCMDS          3               /* Number of common commands */
 
+/* ADC streaming mode commands (see CONFIG_ADC_STREAM).  These are numbered
+ * well above the blocks reserved for the lower half drivers below so that
+ * those reservations do not have to move.
+ */
+
+#define ANIOC_STREAM_WATERMARK _ANIOC(0x0080) /* Set notification watermark
+                                               * IN: Watermark in samples
+                                               * OUT: None */
+#define ANIOC_STREAM_CHANMASK  _ANIOC(0x0081) /* Select retained channels
+                                               * IN: 32-bit channel mask
+                                               * OUT: None */
+
+/* DAC waveform playback commands (see CONFIG_DAC_WAVEFORM) */
+
+#define ANIOC_WAVE_START       _ANIOC(0x0090) /* Enter waveform playback mode
+                                               * IN: DAC channel number
+                                               * OUT: None */
+#define ANIOC_WAVE_STOP        _ANIOC(0x0091) /* Drain pending buffers and
+                                               * leave waveform playback mode
+                                               * IN: None
+                                               * OUT: None */
+
 /* User defined ioctl commands are also supported. These will be forwarded
  * by the upper-half driver to the lower-half driver via the ioctl()
  * method of the lower-half interface.  However, the lower-half driver
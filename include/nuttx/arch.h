@@ -2149,6 +2149,49 @@ size_t  up_check_intstack_remain(void);
 #endif
 #endif
 
+/****************************************************************************
+ * Name: up_update_stack_watermark
+ *
+ * Description:
+ *   Update the peak stack usage watermark of the indicated thread from its
+ *   current stack pointer.  This is called when the thread is switched out
+ *   so that the watermark is maintained at every context switch with no
+ *   need to scan stack memory.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread being switched out
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_STACK_WATERMARK
+struct tcb_s;
+void up_update_stack_watermark(FAR struct tcb_s *tcb);
+#endif
+
+/****************************************************************************
+ * Name: up_stack_guard
+ *
+ * Description:
+ *   Position the MPU stack guard region over the bottom of the indicated
+ *   thread's stack.  This is called when the thread is switched in so that
+ *   the guard follows the running thread.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread being switched in
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_STACK_GUARD
+struct tcb_s;
+void up_stack_guard(FAR struct tcb_s *tcb);
+#endif
+
 /****************************************************************************
  * Name: up_rtc_initialize
  *
@@ -2407,13 +2450,21 @@ void arch_sporadic_resume(FAR struct tcb_s *tcb);
 #endif
 
 /****************************************************************************
- * Name: up_critmon_*
+ * Name: up_perf_*
  *
  * Description:
- *   The first interface simply provides the current time value in unknown
- *   units.  NOTE:  This function may be called early before the timer has
- *   been initialized.  In that event, the function should just return a
- *   start time of zero.
+ *   The perf counter interfaces provide the common timebase for all of the
+ *   instrumentation in the OS:  The critical section monitor, IRQ and
+ *   syscall timing, precise CPU load, and trace note timestamps.
+ *
+ *   up_perf_init() initializes the counter hardware.  The meaning of the
+ *   argument is backend-specific; cycle counter backends receive the CPU
+ *   frequency in Hz.
+ *
+ *   up_perf_gettime() provides the current time value in unknown units.
+ *   NOTE:  This function may be called early before the timer has been
+ *   initialized.  In that event, the function should just return a start
+ *   time of zero.
  *
  *   Nothing is assumed about the units of this time value.  The following
  *   are assumed, however: (1) The time is an unsigned integer value, (2)
@@ -2421,13 +2472,39 @@ void arch_sporadic_resume(FAR struct tcb_s *tcb);
  *   in unknown units) can be obtained by subtracting a start time from
  *   the current time.
  *
- *   The second interface simple converts an elapsed time into well known
- *   units.
+ *   up_perf_getfreq() returns the number of counts per second.
+ *   up_perf_convert() converts an elapsed time into well known units.
+ *
+ *   A weak, tick-based default implementation is provided for all of the
+ *   interfaces; architectures with a cheap cycle counter (such as the
+ *   ARMv7-M DWT) override the default by selecting
+ *   CONFIG_ARCH_PERF_EVENTS.
+ ****************************************************************************/
+
+void up_perf_init(FAR void *arg);
+uint32_t up_perf_gettime(void);
+unsigned long up_perf_getfreq(void);
+void up_perf_convert(uint32_t elapsed, FAR struct timespec *ts);
+
+/****************************************************************************
+ * Name: up_profile_getpc
+ *
+ * Description:
+ *   Return the program counter of the context that was interrupted by the
+ *   system timer interrupt.  This interface is used by the PC sampling
+ *   profiler and is called only from the system timer interrupt handling
+ *   logic; the value is normally obtained from the saved interrupt context.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   The program counter of the interrupted context.
+ *
  ****************************************************************************/
 
-#ifdef CONFIG_SCHED_CRITMONITOR
-uint32_t up_critmon_gettime(void);
-void up_critmon_convert(uint32_t elapsed, FAR struct timespec *ts);
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+uintptr_t up_profile_getpc(void);
 #endif
 
 #undef EXTERN
@@ -109,6 +109,12 @@
  * AUDIOIOC_STOP - Stop Audio streaming
  *
  *   ioctl argument:  None
+ *
+ * AUDIOIOC_BYPASS - Bypass or re-engage one processing component of a
+ *   composite audio device
+ *
+ *   ioctl argument:  Pointer to a struct audio_comp_bypass_s identifying
+ *                    the component and the new bypass state.
  */
 
 #define AUDIOIOC_GETCAPS            _AUDIOIOC(1)
@@ -128,6 +134,8 @@
 #define AUDIOIOC_UNREGISTERMQ       _AUDIOIOC(15)
 #define AUDIOIOC_HWRESET            _AUDIOIOC(16)
 #define AUDIOIOC_SETBUFFERINFO      _AUDIOIOC(17)
+#define AUDIOIOC_ENQUEUEBUFFERS     _AUDIOIOC(18)
+#define AUDIOIOC_BYPASS             _AUDIOIOC(19)
 
 /* Audio Device Types *******************************************************/
 
@@ -336,6 +344,8 @@
 #define AUDIO_APB_OUTPUT_PROCESS    (1 << 1)
 #define AUDIO_APB_DEQUEUED          (1 << 2)
 #define AUDIO_APB_FINAL             (1 << 3) /* Last buffer in the stream */
+#define AUDIO_APB_POOLED            (1 << 4) /* Buffer belongs to the
+                                              * preallocated buffer pool */
 
 /****************************************************************************
  * Public Types
@@ -486,6 +496,20 @@ struct audio_buf_desc_s
   } u;
 };
 
+/* Structure for enqueueing multiple audio pipeline buffers with a single
+ * AUDIOIOC_ENQUEUEBUFFERS ioctl.  This permits a playback task to top off
+ * the driver queue with one system call instead of one call per buffer.
+ */
+
+struct audio_bufs_desc_s
+{
+#ifdef CONFIG_AUDIO_MULTI_SESSION
+  FAR void            *session;           /* Associated channel */
+#endif
+  uint16_t            nbuffers;           /* Number of buffers to enqueue */
+  FAR struct ap_buffer_s **buffers;       /* Array of buffers to enqueue */
+};
+
 /* Typedef for lower-level to upper-level callback for buffer dequeuing */
 
 #ifdef CONFIG_AUDIO_MULTI_SESSION
@@ -666,6 +690,23 @@ struct audio_ops_s
 #else
   CODE int (*release)(FAR struct audio_lowerhalf_s *dev);
 #endif
+
+  /* Process the samples of an Audio Pipeline Buffer in place.  This
+   * optional method marks the lower-half driver as a pure processing
+   * stage (equalizer, volume, etc.) in a composite audio device: the
+   * component transforms apb->samp directly and the same buffer object is
+   * then offered to the next component in the chain with no intermediate
+   * copy.  The method must not take ownership of the buffer and must not
+   * call the upper-half callback for it; ownership passes through the
+   * chain to the component that accepts the buffer via enqueuebuffer.
+   *
+   * NOTE:  This member was added at the end of the structure so that
+   * drivers with positional ops table initializers need not be updated;
+   * for those drivers the method is simply NULL.
+   */
+
+  CODE int (*process)(FAR struct audio_lowerhalf_s *dev,
+          FAR struct ap_buffer_s *apb);
 };
 
 /* This structure is the generic form of state structure used by lower half
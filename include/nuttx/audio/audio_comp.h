@@ -38,6 +38,17 @@
  * Public Types
  ****************************************************************************/
 
+/* Describes the argument of the AUDIOIOC_BYPASS ioctl command */
+
+struct audio_comp_bypass_s
+{
+  uint8_t index;                  /* Component index, in the order the
+                                   * components were passed to
+                                   * audio_comp_initialize() */
+  bool    bypass;                 /* True: skip the component's process
+                                   * method when chaining buffers */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -0,0 +1,136 @@
+/****************************************************************************
+ * include/nuttx/audio/audio_decoder.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_AUDIO_AUDIO_DECODER_H
+#define __INCLUDE_NUTTX_AUDIO_AUDIO_DECODER_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#ifdef CONFIG_AUDIO_DECODER
+#include <nuttx/audio/audio.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This structure describes one codec plugin.  A plugin may be backed by a
+ * hardware decoder or by optimized software; the framework does not care.
+ * Plugins are registered with audio_decoder_register() at boot time and
+ * are selected by the AUDIO_FMT_* code given when the containing device is
+ * configured.
+ */
+
+struct audio_decoder_ops_s
+{
+  /* The AUDIO_FMT_* code that this codec decodes (e.g. AUDIO_FMT_MP3) */
+
+  uint8_t format;
+
+  /* Allocate any decoder context needed for one playback session.  The
+   * context is passed back to the decode and uninit methods.  May be NULL
+   * if the codec is stateless.
+   */
+
+  CODE int (*init)(FAR void **ctx);
+
+  /* Release the decoder context allocated by init.  May be NULL. */
+
+  CODE void (*uninit)(FAR void *ctx);
+
+  /* Decode the compressed data in the Audio Pipeline Buffer, operating
+   * directly on apb->samp.  The codec consumes the compressed bytes
+   * between curbyte and nbytes and replaces them with decoded samples,
+   * updating curbyte/nbytes accordingly.  The decoded data must fit within
+   * nmaxbytes.  Returns OK on success or a negated errno value; on failure
+   * the buffer is returned to the application without reaching the device.
+   */
+
+  CODE int (*decode)(FAR void *ctx, FAR struct ap_buffer_s *apb);
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: audio_decoder_register
+ *
+ * Description:
+ *   Register one codec plugin with the decoder framework.  Normally called
+ *   during board bring-up, before any decoder device is configured.
+ *
+ * Input Parameters:
+ *   ops - The codec plugin operations.  The referenced structure must
+ *         persist; it is not copied.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int audio_decoder_register(FAR const struct audio_decoder_ops_s *ops);
+
+/****************************************************************************
+ * Name: audio_decoder_initialize
+ *
+ * Description:
+ *   Initialize a decoder device.  The decoder device accepts and contains
+ *   a low-level audio DAC-type device.  It then returns a new audio lower
+ *   half interface that decodes enqueued compressed audio buffers through
+ *   a registered codec plugin before passing them to the low-level device.
+ *   Decoding runs on the low-priority work queue so that the application's
+ *   enqueue operation never blocks on decode work.
+ *
+ * Input Parameters:
+ *   dev - A reference to the low-level audio DAC-type device to contain.
+ *
+ * Returned Value:
+ *   On success, a new audio device instance is returned that wraps the
+ *   low-level device and provides a decoding front end.  NULL is returned
+ *   on failure.
+ *
+ ****************************************************************************/
+
+FAR struct audio_lowerhalf_s *
+  audio_decoder_initialize(FAR struct audio_lowerhalf_s *dev);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_AUDIO_DECODER */
+#endif /* __INCLUDE_NUTTX_AUDIO_AUDIO_DECODER_H */
@@ -90,6 +90,32 @@ void exec_getsymtab(FAR const struct symtab_s **symtab, FAR int *nsymbols);
 
 void exec_setsymtab(FAR const struct symtab_s *symtab, int nsymbols);
 
+/****************************************************************************
+ * Name: exec_symtab_lookup
+ *
+ * Description:
+ *   Find a symbol in the currently selected symbol table using a hash
+ *   table that is built on demand and rebuilt whenever exec_setsymtab()
+ *   selects a new symbol table.  If 'symtab' is not the currently selected
+ *   symbol table, the lookup falls back to a linear search.
+ *
+ * Input Parameters:
+ *   symtab - The symbol table to be searched.
+ *   nsymbols - The number of symbols in the symbol table.
+ *   name - The name of the symbol to find.
+ *
+ * Returned Value:
+ *   A reference to the symbol table entry if an entry with the matching
+ *   name is found; NULL is returned if the entry is not found.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYMTAB_HASHTABLE
+FAR const struct symtab_s *
+exec_symtab_lookup(FAR const struct symtab_s *symtab, int nsymbols,
+                   FAR const char *name);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
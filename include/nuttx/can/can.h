@@ -48,6 +48,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef CONFIG_CAN_TIMESTAMP
+#  include <sys/time.h>
+#endif
+
 #include <nuttx/list.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/fs/ioctl.h>
@@ -74,6 +78,8 @@
  *   just means handling encoded DLC values (for values of DLC > 9).
  * CONFIG_CAN_FIFOSIZE - The size of the circular buffer of CAN messages.
  *   Default: 8
+ * CONFIG_CAN_TIMESTAMP - Record the time of reception of each incoming CAN
+ *   message in the cm_ts field of struct can_msg_s.
  * CONFIG_CAN_NPENDINGRTR - The size of the list of pending RTR requests.
  *   Default: 4
  * CONFIG_CAN_LOOPBACK - A CAN driver may or may not support a loopback
@@ -474,6 +480,9 @@ begin_packed_struct struct can_hdr_s
 begin_packed_struct struct can_msg_s
 {
   struct can_hdr_s cm_hdr;                  /* The CAN header */
+#ifdef CONFIG_CAN_TIMESTAMP
+  struct timeval   cm_ts;                   /* Time of reception */
+#endif
   uint8_t          cm_data[CAN_MAXDATALEN]; /* CAN message data (0-8 byte) */
 } end_packed_struct;
 
@@ -714,6 +723,31 @@ int can_register(FAR const char *path, FAR struct can_dev_s *dev);
 int can_receive(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
                 FAR uint8_t *data);
 
+/************************************************************************************
+ * Name: can_receive_ts
+ *
+ * Description:
+ *   Called from the CAN interrupt handler when new read data is available and
+ *   the controller has captured a hardware timestamp for the message.  This is
+ *   identical to can_receive() except that the provided timestamp is recorded
+ *   with the message in place of the software reception time.
+ *
+ * Input Parameters:
+ *   dev  - The specific CAN device
+ *   hdr  - The 16-bit CAN header
+ *   data - An array contain the CAN data.
+ *   ts   - The time of reception of the message
+ *
+ * Returned Value:
+ *   OK on success; a negated errno on failure.
+ *
+ ************************************************************************************/
+
+#ifdef CONFIG_CAN_TIMESTAMP
+int can_receive_ts(FAR struct can_dev_s *dev, FAR struct can_hdr_s *hdr,
+                   FAR uint8_t *data, FAR const struct timeval *ts);
+#endif
+
 /************************************************************************************
  * Name: can_txdone
  *
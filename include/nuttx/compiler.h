@@ -65,6 +65,20 @@
 #  define CONFIG_HAVE_BUILTIN_POPCOUNT 1
 #endif
 
+/* GCC 4.8 and above (and Clang) have __builtin_bswap16() and
+ * __builtin_bswap32().  These reverse the bytes of 16- and 32-bit values
+ * and typically generate a single byte-reverse instruction (e.g. REV16/REV
+ * on ARMv6 and above) in place of a sequence of shifts and ORs.  With a
+ * constant argument they fold to a constant and so may also be used in
+ * constant expressions.
+ */
+
+#if __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8) || \
+    defined(__clang__)
+#  define CONFIG_HAVE_BUILTIN_BSWAP16  1
+#  define CONFIG_HAVE_BUILTIN_BSWAP32  1
+#endif
+
 /* C++ support */
 
 #if defined(__cplusplus) && __cplusplus >= 201402L
@@ -65,6 +65,7 @@
 #define CIOCGSESSION            101
 #define CIOCFSESSION            102
 #define CIOCCRYPT               103
+#define CIOCNCRYPTM             104
 
 typedef char* caddr_t;
 
@@ -92,4 +93,16 @@ struct crypt_op
   caddr_t iv;
 };
 
+/* Hold a batch of crypt operations that are submitted with a single
+ * CIOCNCRYPTM ioctl.  The operations are processed in order; processing
+ * stops at the first operation that fails.  On return, count holds the
+ * number of operations that completed successfully.
+ */
+
+struct crypt_mop
+{
+  unsigned count;            /* number of operations in reqs[] */
+  FAR struct crypt_op *reqs; /* array of operations to perform */
+};
+
 #endif /* __INCLUDE_NUTTX_CRYPTO_CRYPTODEV_H */
@@ -114,15 +114,17 @@ struct fs_cromfsdir_s
 #endif /* CONFIG_FS_CROMFS */
 
 #ifdef CONFIG_FS_TMPFS
-/* For TMPFS, we need the directory object and an index into the directory
- * entries.
+/* For TMPFS, we need the directory object and the sequence number of the
+ * next directory entry to be returned.  Positions are expressed as entry
+ * sequence numbers, not array indices, so that concurrent directory
+ * modifications do not cause entries to be skipped or repeated.
  */
 
 struct tmpfs_directory_s;               /* Forward reference */
 struct fs_tmpfsdir_s
 {
   FAR struct tmpfs_directory_s *tf_tdo; /* Directory being enumerated */
-  unsigned int tf_index;                /* Directory index */
+  uint32_t tf_seq;                      /* Next entry sequence number */
 };
 #endif /* CONFIG_FS_TMPFS */
 
@@ -42,6 +42,10 @@
 #  include <nuttx/mqueue.h>
 #endif
 
+#ifdef CONFIG_FS_BLOCKASYNC
+#  include <queue.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -205,6 +209,7 @@ struct statfs;
 struct pollfd;
 struct fs_dirent_s;
 struct mtd_dev_s;
+struct iovec;
 
 /* This structure is provided by devices when they are registered with the
  * system.  It is used to call back to perform device specific operations.
@@ -271,6 +276,29 @@ struct block_operations
 #endif
 };
 
+#ifdef CONFIG_FS_BLOCKASYNC
+/* Describes one asynchronous block transfer request submitted to a request
+ * queue block driver with blockasync_submit().  The caller initializes the
+ * write, buffer, sector, nsectors, callback and arg fields; the result
+ * field is valid when the callback is invoked.
+ */
+
+struct blockasync_req_s
+{
+  sq_entry_t entry;            /* Supports the pending request queue */
+  bool write;                  /* true: Write transfer; false: Read */
+  FAR unsigned char *buffer;   /* Caller buffer for the transfer */
+  size_t sector;               /* First sector of the transfer */
+  unsigned int nsectors;       /* Number of sectors to transfer */
+  ssize_t result;              /* Sectors transferred or negated errno */
+
+  /* Invoked (from the service thread) when the transfer completes */
+
+  CODE void (*callback)(FAR struct blockasync_req_s *req, FAR void *arg);
+  FAR void *arg;               /* Opaque argument for the callback */
+};
+#endif
+
 /* This structure is provided by a filesystem to describe a mount point.
  * Note that this structure differs from file_operations ONLY in the form of
  * the open method.  Once the file is opened, it can be accessed either as a
@@ -472,6 +500,10 @@ struct file_struct
 #  if CONFIG_STDIO_BUFFER_SIZE > 0
   unsigned char           fs_buffer[CONFIG_STDIO_BUFFER_SIZE];
 #  endif
+#  ifdef CONFIG_STDIO_STATS
+  uint32_t                fs_nflush;    /* Number of I/O buffer flushes */
+  uint32_t                fs_nwrite;    /* Number of underlying write calls */
+#  endif
 #endif
   uint16_t                fs_oflags;    /* Open mode flags */
   uint8_t                 fs_flags;     /* Stream flags */
@@ -599,6 +631,85 @@ int register_blockpartition(FAR const char *partition,
                             size_t firstsector, size_t nsectors);
 #endif
 
+/****************************************************************************
+ * Name: register_blockcache
+ *
+ * Description:
+ *   Register a cached block driver inode in the pseudo file system.  The
+ *   new block device forwards all transfers to the 'source' block driver
+ *   but retains recently used sectors in RAM so that hot sectors (such as
+ *   file system metadata) need not be re-read from the media.  Mount the
+ *   cache device in place of the source device to enable caching.
+ *
+ * Input Parameters:
+ *   cachedev - The path to the cache block driver inode to be created
+ *   mode     - The mode of the new inode
+ *   source   - The path to the source (parent) block driver inode
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on a failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_BLOCKCACHE
+int register_blockcache(FAR const char *cachedev, mode_t mode,
+                        FAR const char *source);
+#endif
+
+/****************************************************************************
+ * Name: register_blockasync
+ *
+ * Description:
+ *   Register a request queue block driver inode in the pseudo file
+ *   system.  The new block device forwards all transfers to the 'source'
+ *   block driver, but from a dedicated service thread:  Requests from
+ *   multiple tasks are queued, serviced in elevator (ascending sector)
+ *   order and merged into single transfers when they are adjacent on the
+ *   media and in memory.  Mount the queue device in place of the source
+ *   device, or submit requests directly with blockasync_submit().
+ *
+ * Input Parameters:
+ *   queuedev - The path to the request queue block driver inode
+ *   mode     - The mode of the new inode
+ *   source   - The path to the source (parent) block driver inode
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on a failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_BLOCKASYNC
+int register_blockasync(FAR const char *queuedev, mode_t mode,
+                        FAR const char *source);
+#endif
+
+/****************************************************************************
+ * Name: blockasync_submit
+ *
+ * Description:
+ *   Submit one asynchronous block transfer request to a request queue
+ *   block driver.  The request is serviced by the queue's service thread
+ *   in elevator order; the caller continues immediately and the request
+ *   callback is invoked when the transfer completes.  The request memory
+ *   must remain valid until the callback is invoked.
+ *
+ * Input Parameters:
+ *   inode - The request queue block driver inode
+ *   req   - The request to be submitted.  The write, buffer, sector,
+ *           nsectors, callback and arg fields must be initialized.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on a failure to
+ *   submit the request.  Transfer errors are reported through the result
+ *   field of the completed request.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_BLOCKASYNC
+int blockasync_submit(FAR struct inode *inode,
+                      FAR struct blockasync_req_s *req);
+#endif
+
 /****************************************************************************
  * Name: unregister_driver
  *
@@ -1114,6 +1225,55 @@ ssize_t file_read(FAR struct file *filep, FAR void *buf, size_t nbytes);
 
 ssize_t nx_read(int fd, FAR void *buf, size_t nbytes);
 
+/****************************************************************************
+ * Name: file_readv
+ *
+ * Description:
+ *   file_readv() is an internal OS interface.  It is functionally similar
+ *   to the standard readv() interface except:
+ *
+ *    - It does not modify the errno variable,
+ *    - It is not a cancellation point,
+ *    - It does not handle socket descriptors, and
+ *    - It accepts a file structure instance instead of file descriptor.
+ *
+ * Input Parameters:
+ *   filep  - File structure instance
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive, non-zero number of bytes read on success, 0 on an
+ *   end-of-file condition, or a negated errno value on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t file_readv(FAR struct file *filep, FAR const struct iovec *iov,
+                   int iovcnt);
+
+/****************************************************************************
+ * Name: nx_readv
+ *
+ * Description:
+ *   nx_readv() is an internal OS interface.  It is functionally similar to
+ *   the standard readv() interface except:
+ *
+ *    - It does not modify the errno variable, and
+ *    - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - File descriptor to read from
+ *   iov    - Array of read buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *   The positive, non-zero number of bytes read on success, 0 on an
+ *   end-of-file condition, or a negated errno value on any failure.
+ *
+ ****************************************************************************/
+
+ssize_t nx_readv(int fd, FAR const struct iovec *iov, int iovcnt);
+
 /****************************************************************************
  * Name: file_write
  *
@@ -1170,6 +1330,60 @@ ssize_t file_write(FAR struct file *filep, FAR const void *buf,
 
 ssize_t nx_write(int fd, FAR const void *buf, size_t nbytes);
 
+/****************************************************************************
+ * Name: file_writev
+ *
+ * Description:
+ *   Equivalent to the standard writev() function except that is accepts a
+ *   struct file instance instead of a file descriptor.  It is functionally
+ *   equivalent to writev() except that in addition to the differences in
+ *   input parameters:
+ *
+ *  - It does not modify the errno variable,
+ *  - It is not a cancellation point, and
+ *  - It does not handle socket descriptors.
+ *
+ * Input Parameters:
+ *   filep  - Instance of struct file to use with the writes
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with writev() for a description of the appropriate errno
+ *  values).
+ *
+ ****************************************************************************/
+
+ssize_t file_writev(FAR struct file *filep, FAR const struct iovec *iov,
+                    int iovcnt);
+
+/****************************************************************************
+ * Name: nx_writev
+ *
+ * Description:
+ *  nx_writev() is an internal OS interface.  It is functionally equivalent
+ *  to writev() except that:
+ *
+ *  - It does not modify the errno variable, and
+ *  - It is not a cancellation point.
+ *
+ * Input Parameters:
+ *   fd     - file descriptor (or socket descriptor) to write to
+ *   iov    - Array of write buffer descriptors
+ *   iovcnt - Number of elements in iov[]
+ *
+ * Returned Value:
+ *  On success, the number of bytes written are returned (zero indicates
+ *  nothing was written).  On any failure, a negated errno value is returned
+ *  (see comments with writev() for a description of the appropriate errno
+ *  values).
+ *
+ ****************************************************************************/
+
+ssize_t nx_writev(int fd, FAR const struct iovec *iov, int iovcnt);
+
 /****************************************************************************
  * Name: file_pread
  *
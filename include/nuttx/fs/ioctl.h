@@ -408,6 +408,20 @@
                                              *     1=fre when empty
                                              * OUT: None */
 
+#define PIPEIOC_POLLINTHRD  _PIPEIOC(0x0002) /* Set POLLIN watermark
+                                              * IN: unsigned long integer.
+                                              *     POLLIN is only reported
+                                              *     when more than this many
+                                              *     bytes may be read
+                                              * OUT: None */
+
+#define PIPEIOC_POLLOUTTHRD _PIPEIOC(0x0003) /* Set POLLOUT watermark
+                                              * IN: unsigned long integer.
+                                              *     POLLOUT is only reported
+                                              *     when more than this many
+                                              *     bytes may be written
+                                              * OUT: None */
+
 /* RTC driver ioctl definitions *********************************************/
 
 /* (see nuttx/include/rtc.h */
@@ -44,6 +44,7 @@
 
 #include <sys/types.h>
 #include <stdint.h>
+#include <queue.h>
 
 #include <nuttx/fs/ioctl.h>
 
@@ -227,6 +228,40 @@ struct i2c_msg_s
   ssize_t length;             /* Length of the buffer in bytes */
 };
 
+#ifdef CONFIG_I2C_ASYNC
+/* This structure describes one queued, asynchronous I2C transfer.  The
+ * structure is provided by the caller and must persist, unmodified, until
+ * the completion callback has been invoked.
+ */
+
+struct i2c_async_s;
+typedef CODE void (*i2c_async_callback_t)(FAR struct i2c_async_s *xfr,
+                                          int result);
+
+struct i2c_async_s
+{
+  sq_entry_t link;               /* Supports a singly linked list */
+  FAR struct i2c_master_s *dev;  /* I2C bus to perform the transfer on */
+  FAR struct i2c_msg_s *msgv;    /* A set of message descriptors */
+  int msgc;                      /* The number of transfers to perform */
+  uint8_t priority;              /* Higher priorities are served first */
+  i2c_async_callback_t callback; /* Invoked when the transfer completes */
+  FAR void *arg;                 /* Caller context for the callback */
+  clock_t qtime;                 /* Time of queueing (internal) */
+};
+
+/* Per-bus utilization statistics for the asynchronous transfer queue */
+
+struct i2c_async_stats_s
+{
+  FAR struct i2c_master_s *dev;  /* The bus the statistics belong to */
+  uint32_t ntransfers;           /* Number of transfers performed */
+  uint32_t nerrors;              /* Number of failed transfers */
+  clock_t  busytime;             /* Time spent on the bus, in ticks */
+  clock_t  maxqwait;             /* Longest time a transfer was queued */
+};
+#endif /* CONFIG_I2C_ASYNC */
+
 /* I2C private data.  This structure only defines the initial fields of the
  * structure visible to the I2C client.  The specific implementation may
  * add additional, device specific fields after the vtable.
@@ -356,6 +391,51 @@ int i2c_read(FAR struct i2c_master_s *dev,
              FAR const struct i2c_config_s *config,
              FAR uint8_t *buffer, int buflen);
 
+/****************************************************************************
+ * Name: i2c_transfer_async
+ *
+ * Description:
+ *   Queue a sequence of I2C transfers for asynchronous execution and
+ *   return immediately.  Queued transfers are performed in priority order
+ *   by a common service thread; the completion callback is invoked from
+ *   that thread when the transfer has finished.
+ *
+ * Input Parameters:
+ *   xfr - Describes the transfer to perform.  The caller must initialize
+ *         the dev, msgv, msgc, priority, callback, and arg fields.  The
+ *         structure and the message buffers must persist until the
+ *         callback has been invoked.
+ *
+ * Returned Value:
+ *   0: transfer queued, <0: A negated errno
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_I2C_ASYNC
+int i2c_transfer_async(FAR struct i2c_async_s *xfr);
+#endif
+
+/****************************************************************************
+ * Name: i2c_async_stats
+ *
+ * Description:
+ *   Return the utilization statistics collected for one I2C bus by the
+ *   asynchronous transfer queue.
+ *
+ * Input Parameters:
+ *   dev - Device-specific state data
+ *
+ * Returned Value:
+ *   A pointer to the statistics, or NULL if no statistics slot could be
+ *   assigned to the bus (see CONFIG_I2C_ASYNC_NBUSES).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_I2C_ASYNC
+FAR const struct i2c_async_stats_s *
+i2c_async_stats(FAR struct i2c_master_s *dev);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
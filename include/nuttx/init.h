@@ -43,6 +43,7 @@
 #include <nuttx/config.h>
 #include <nuttx/compiler.h>
 
+#include <sys/types.h>
 #include <stdint.h>
 
 /****************************************************************************
@@ -83,6 +84,21 @@ enum nx_initstate_e
                           * active. */
 };
 
+#ifdef CONFIG_INIT_PARALLEL
+/* One driver initialization task in a table passed to nxinit_run().
+ * Entries are grouped into dependency levels:  All entries at level N may
+ * execute concurrently, but none is started before every entry at level
+ * N-1 has completed.
+ */
+
+struct nxinit_task_s
+{
+  FAR const char *name;   /* Driver name used in the timing report */
+  CODE int (*init)(void); /* Initialization function */
+  uint8_t level;          /* Dependency level of this entry */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -115,6 +131,15 @@ int CONFIG_USER_ENTRYPOINT(int argc, char *argv[]);
 
 void nx_start(void) noreturn_function;
 
+/* Functions contained in nx_initrun.c **************************************/
+/* Run a table of driver initialization functions on the low priority work
+ * queue(s), level by level, measuring the time consumed by each.
+ */
+
+#ifdef CONFIG_INIT_PARALLEL
+int nxinit_run(FAR const struct nxinit_task_s *tasks, size_t ntasks);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -50,6 +50,7 @@
  ************************************************************************************/
 
 #include <nuttx/config.h>
+#include <nuttx/clock.h>
 #include <nuttx/fs/ioctl.h>
 
 #ifdef CONFIG_INPUT
@@ -147,6 +148,26 @@ struct touch_sample_s
 #define SIZEOF_TOUCH_SAMPLE_S(n) \
   (sizeof(struct touch_sample_s) + ((n) - 1) * sizeof(struct touch_point_s))
 
+#ifdef CONFIG_INPUT_TOUCHSCREEN
+/* The touchscreen event upper half driver (see drivers/input/
+ * touchscreen_upper.c) queues timestamped events and supports multi-event
+ * reads:  Data read from the event device is a stream of struct
+ * touch_event_s instances and reads may return several events at once.
+ * The timestamp is captured when the lower half driver reports the
+ * sample, not when the application reads it.
+ */
+
+struct touch_event_s
+{
+  clock_t time;                  /* System ticks when the sample was reported */
+  struct touch_point_s point;    /* The touch point data */
+};
+
+/* This opaque structure represents the registered upper half driver state */
+
+struct touch_upperhalf_s;
+#endif
+
 /************************************************************************************
  * Public Function Prototypes
  ************************************************************************************/
@@ -159,6 +180,51 @@ extern "C"
 #define EXTERN extern
 #endif
 
+#ifdef CONFIG_INPUT_TOUCHSCREEN
+/************************************************************************************
+ * Name: touch_register
+ *
+ * Description:
+ *   Register a touchscreen event device at the provided device path.  The
+ *   returned handle is used by the lower half driver to queue new touch
+ *   samples via touch_report().
+ *
+ * Input Parameters:
+ *   devpath - The device path to register, e.g. "/dev/input0"
+ *
+ * Returned Value:
+ *   A non-NULL handle on success; NULL on any failure.
+ *
+ ************************************************************************************/
+
+FAR struct touch_upperhalf_s *touch_register(FAR const char *devpath);
+
+/************************************************************************************
+ * Name: touch_unregister
+ *
+ * Description:
+ *   Unregister a touchscreen event device and free its resources.
+ *
+ ************************************************************************************/
+
+void touch_unregister(FAR struct touch_upperhalf_s *priv,
+                      FAR const char *devpath);
+
+/************************************************************************************
+ * Name: touch_report
+ *
+ * Description:
+ *   Queue one touch sample to all open references of the touchscreen event
+ *   device.  This should be called when the sample is acquired -- from the
+ *   interrupt handler or from interrupt-scheduled work -- so that the
+ *   event timestamps reflect the acquisition time.
+ *
+ ************************************************************************************/
+
+void touch_report(FAR struct touch_upperhalf_s *priv,
+                  FAR const struct touch_sample_s *sample);
+#endif /* CONFIG_INPUT_TOUCHSCREEN */
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -192,6 +192,26 @@ struct module_s
 
   FAR struct module_s *dependencies[CONFIG_MODLIB_MAXDEPEND];
 #endif
+
+#ifdef CONFIG_MODULE_RELOCACHE
+  /* Describes the retainable, relocated image of the module (see
+   * sched/module/module.h).  NULL if the module is not cacheable.
+   */
+
+  FAR struct mod_cache_s *cache;
+#endif
+
+#if defined(CONFIG_BUILD_PROTECTED) && !defined(__KERNEL__)
+  /* In the PROTECTED build all tasks share one flat address space, so a
+   * shared library needs to be loaded only once:  dlopen() re-uses a
+   * library that is already in the registry.  filename is the full path
+   * that the library was loaded from (the key used to detect re-use) and
+   * nrefs counts the dlopen() references that hold the library in memory.
+   */
+
+  FAR char *filename;                  /* Full path to the library file */
+  uint16_t nrefs;                      /* Number of dlopen() references */
+#endif
 };
 
 /* This struct provides a description of the currently loaded instantiation
@@ -276,6 +276,85 @@ ssize_t circbuf_skip(FAR struct circbuf_s *circ, size_t bytes);
 ssize_t circbuf_write(FAR struct circbuf_s *circ,
                        FAR const void *src, size_t bytes);
 
+/****************************************************************************
+ * Name: circbuf_get_writeptr
+ *
+ * Description:
+ *   Reserve linear space at the head of the circular buffer for writing
+ *   without copying.  The returned span may be used directly as a DMA
+ *   target; the write is published afterwards with circbuf_writecommit().
+ *
+ * Note :
+ *   The tail index is read with an acquire atomic and the head index is
+ *   published with a release atomic, so a single producer (e.g. an ISR or
+ *   a DMA completion handler) and a single consumer may use the reserve/
+ *   commit and acquire/release interfaces with no critical section at all.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   size  - Returns the number of contiguous bytes that may be written.
+ *
+ * Returned Value:
+ *   The address of the reserved linear space.
+ ****************************************************************************/
+
+FAR void *circbuf_get_writeptr(FAR struct circbuf_s *circ,
+                               FAR size_t *size);
+
+/****************************************************************************
+ * Name: circbuf_writecommit
+ *
+ * Description:
+ *   Publish bytes previously written into the space returned by
+ *   circbuf_get_writeptr().  Only after this call may the consumer see
+ *   the new data.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   bytes - Number of bytes written, not more than the size returned by
+ *           circbuf_get_writeptr().
+ ****************************************************************************/
+
+void circbuf_writecommit(FAR struct circbuf_s *circ, size_t bytes);
+
+/****************************************************************************
+ * Name: circbuf_get_readptr
+ *
+ * Description:
+ *   Get a pointer to the linear run of data at the tail of the circular
+ *   buffer for zero-copy consumption.  The data remains in the buffer
+ *   until it is released with circbuf_readcommit().
+ *
+ * Note :
+ *   See the note in circbuf_get_writeptr():  with one producer and one
+ *   consumer no locking is needed around these interfaces.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   size  - Returns the number of contiguous bytes that may be read.
+ *
+ * Returned Value:
+ *   The address of the data at the tail of the buffer.
+ ****************************************************************************/
+
+FAR void *circbuf_get_readptr(FAR struct circbuf_s *circ,
+                              FAR size_t *size);
+
+/****************************************************************************
+ * Name: circbuf_readcommit
+ *
+ * Description:
+ *   Release bytes previously acquired with circbuf_get_readptr(), making
+ *   the space available to the producer again.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   bytes - Number of bytes consumed, not more than the size returned by
+ *           circbuf_get_readptr().
+ ****************************************************************************/
+
+void circbuf_readcommit(FAR struct circbuf_s *circ, size_t bytes);
+
 /****************************************************************************
  * Name: circbuf_overwrite
  *
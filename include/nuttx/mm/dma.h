@@ -0,0 +1,187 @@
+/****************************************************************************
+ * include/nuttx/mm/dma.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_MM_DMA_H
+#define __INCLUDE_NUTTX_MM_DMA_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+
+#ifdef CONFIG_MM_DMA
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Every DMA buffer is aligned to and padded out to a multiple of the data
+ * cache line size so that cache clean/invalidate operations on a buffer
+ * can never touch neighboring data.
+ */
+
+#define MM_DMA_LINESIZE  (1 << CONFIG_MM_DMA_CACHELINE_LOG2)
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This opaque structure describes one per-device DMA buffer pool */
+
+struct dma_pool_s;
+
+/* This structure describes the accounting state of one pool.  A device
+ * driver that allocates and frees symmetrically will show curbytes == 0
+ * and nallocs == nfrees when quiescent; anything else is a leak.
+ */
+
+struct dma_poolinfo_s
+{
+  FAR const char *name;  /* The name given to dma_pool_initialize() */
+  uint32_t nallocs;      /* Total number of successful allocations */
+  uint32_t nfrees;       /* Total number of frees */
+  uint32_t nfailures;    /* Number of failed allocations */
+  size_t   curbytes;     /* Bytes currently allocated (padded sizes) */
+  size_t   peakbytes;    /* High watermark of curbytes */
+  size_t   arena;        /* Total size of the pool memory */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: dma_pool_initialize
+ *
+ * Description:
+ *   Create a DMA buffer pool over the provided (DMA-capable) memory.  The
+ *   pool is backed by the granule allocator; the granule size is at least
+ *   one data cache line so that all buffers are automatically cache-line
+ *   aligned and padded.
+ *
+ * Input Parameters:
+ *   name      - A name for the pool used in accounting output.  The
+ *               string is not copied and must persist.
+ *   heapstart - Start of the DMA-capable memory backing the pool.  Must
+ *               be aligned to (1 << log2gran).
+ *   heapsize  - Size of the memory backing the pool.
+ *   log2gran  - Log base 2 of the granule size.  Values smaller than
+ *               CONFIG_MM_DMA_CACHELINE_LOG2 are silently raised to it.
+ *               NOTE:  the granule allocator limits one allocation to 32
+ *               granules, so drivers with large buffers should pick a
+ *               granule size of at least 1/32nd of their largest buffer.
+ *
+ * Returned Value:
+ *   A reference to the pool on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR struct dma_pool_s *dma_pool_initialize(FAR const char *name,
+                                           FAR void *heapstart,
+                                           size_t heapsize,
+                                           uint8_t log2gran);
+
+/****************************************************************************
+ * Name: dma_pool_release
+ *
+ * Description:
+ *   Release a DMA buffer pool and all of its management structures.  Any
+ *   memory still allocated from the pool is abandoned.
+ *
+ * Input Parameters:
+ *   pool - The pool previously returned by dma_pool_initialize()
+ *
+ ****************************************************************************/
+
+void dma_pool_release(FAR struct dma_pool_s *pool);
+
+/****************************************************************************
+ * Name: dma_alloc
+ *
+ * Description:
+ *   Allocate a cache-line aligned DMA buffer from the pool.  The size is
+ *   padded up to a multiple of the granule size, so cache maintenance on
+ *   [buffer, buffer + size) never overlaps another allocation.
+ *
+ * Input Parameters:
+ *   pool - The pool previously returned by dma_pool_initialize()
+ *   size - The size of the buffer needed
+ *
+ * Returned Value:
+ *   The address of the buffer on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR void *dma_alloc(FAR struct dma_pool_s *pool, size_t size);
+
+/****************************************************************************
+ * Name: dma_free
+ *
+ * Description:
+ *   Return a buffer previously allocated by dma_alloc() to its pool.
+ *
+ * Input Parameters:
+ *   pool - The pool that the buffer was allocated from
+ *   mem  - The buffer address returned by dma_alloc()
+ *   size - The size passed to dma_alloc()
+ *
+ ****************************************************************************/
+
+void dma_free(FAR struct dma_pool_s *pool, FAR void *mem, size_t size);
+
+/****************************************************************************
+ * Name: dma_poolinfo
+ *
+ * Description:
+ *   Return the accounting state of a pool so that per-driver DMA memory
+ *   consumption and leaks can be monitored.
+ *
+ * Input Parameters:
+ *   pool - The pool previously returned by dma_pool_initialize()
+ *   info - The location to return the accounting state
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int dma_poolinfo(FAR struct dma_pool_s *pool,
+                 FAR struct dma_poolinfo_s *info);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CONFIG_MM_DMA */
+#endif /* __INCLUDE_NUTTX_MM_DMA_H */
@@ -203,6 +203,9 @@ enum iob_user_e
 #ifdef CONFIG_NET_IPFORWARD
   IOBUSER_NET_IPFORWARD,
 #endif
+#ifdef CONFIG_NET_IPv4_REASSEMBLY
+  IOBUSER_NET_IPREASSEMBLY,
+#endif
 #ifdef CONFIG_WIRELESS_IEEE802154
   IOBUSER_WIRELESS_RAD802154,
 #endif
@@ -223,6 +226,9 @@ enum iob_user_e
 #endif
 #ifdef CONFIG_NET_CAN
   IOBUSER_NET_CAN_READAHEAD,
+#endif
+#ifdef CONFIG_NET_PKT
+  IOBUSER_NET_PKT_READAHEAD,
 #endif
   IOBUSER_GLOBAL,
   IOBUSER_NENTRIES /* MUST BE LAST ENTRY */
@@ -234,6 +240,18 @@ struct iob_userstats_s
   int totalproduced;
 };
 
+#ifdef CONFIG_IOB_OWNER_TRACKING
+/* Summary of the I/O buffers currently held by one owner.  Returned by
+ * iob_owner_getinfo().
+ */
+
+struct iob_ownerinfo_s
+{
+  uint16_t live;        /* Number of I/O buffers currently held */
+  clock_t  oldest;      /* Age in system ticks of the oldest held buffer */
+};
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
@@ -316,13 +334,16 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob,
  *            when the event occurs.
  *   arg    - A user-defined argument that will be available to the worker
  *            function when it runs.
+ *   threshold - The worker will not be notified until at least this many
+ *            IOBs are available.  A value of one (or less) requests
+ *            notification as soon as any IOB is available.
  *
  * Returned Value:
  *   > 0   - The signal notification is in place.  The returned value is a
  *           key that may be used later in a call to
  *           iob_notifier_teardown().
- *   == 0  - There are already free IOBs.  No signal notification will be
- *           provided.
+ *   == 0  - The requested number of IOBs is already available.  No signal
+ *           notification will be provided.
  *   < 0   - An unexpected error occurred and no signal will be sent.  The
  *           returned value is a negated errno value that indicates the
  *           nature of the failure.
@@ -330,7 +351,8 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob,
  ****************************************************************************/
 
 #ifdef CONFIG_IOB_NOTIFIER
-int iob_notifier_setup(int qid, worker_t worker, FAR void *arg);
+int iob_notifier_setup(int qid, worker_t worker, FAR void *arg,
+                       int16_t threshold);
 #endif
 
 /****************************************************************************
@@ -607,5 +629,27 @@ void iob_dump(FAR const char *msg, FAR struct iob_s *iob, unsigned int len,
 FAR struct iob_userstats_s * iob_getuserstats(enum iob_user_e userid);
 #endif
 
+/****************************************************************************
+ * Name: iob_owner_getinfo
+ *
+ * Description:
+ *   Summarize the I/O buffers currently held by one owner:  the number of
+ *   live buffers and the age of the oldest one.  IOBUSER_GLOBAL summarizes
+ *   all owners.
+ *
+ * Input Parameters:
+ *   userid - id representing the IOB owner
+ *   info   - Location to return the summary
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+void iob_owner_getinfo(enum iob_user_e userid,
+                       FAR struct iob_ownerinfo_s *info);
+#endif
+
 #endif /* CONFIG_MM_IOB */
 #endif /* _INCLUDE_NUTTX_MM_IOB_H */
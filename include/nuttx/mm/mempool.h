@@ -0,0 +1,163 @@
+/****************************************************************************
+ * include/nuttx/mm/mempool.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_MM_MEMPOOL_H
+#define __INCLUDE_NUTTX_MM_MEMPOOL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <queue.h>
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This structure describes one fixed-block memory pool.  All fields other
+ * than 'node' are read-only to users of the pool; they may be sampled for
+ * instrumentation but must only be modified through the interfaces below.
+ */
+
+struct mempool_s
+{
+  sq_entry_t node;           /* Links the pool into the pool registry */
+  sq_queue_t queue;          /* The list of free blocks */
+  FAR const char *name;      /* Pool name for reporting */
+  FAR void *base;            /* The block storage */
+  bool external;             /* true: storage was provided by the caller */
+  size_t blocksize;          /* The (aligned) size of one block */
+  size_t nblocks;            /* The total number of blocks in the pool */
+  size_t nfree;              /* The current number of free blocks */
+  size_t minfree;            /* The low watermark of 'nfree' */
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/* The registry of all initialized pools.  It is traversed by the procfs
+ * "mempool" entry; any traversal must be performed with interrupts
+ * disabled.
+ */
+
+EXTERN sq_queue_t g_mempool_registry;
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mempool_init
+ *
+ * Description:
+ *   Initialize a fixed-block memory pool and add it to the pool registry.
+ *
+ * Input Parameters:
+ *   pool      - Address of the pool to be initialized.
+ *   name      - A name for the pool, used only for reporting.  The string
+ *               is not copied and must remain valid for the life of the
+ *               pool.
+ *   base      - A pointer to the block storage.  It can be provided by the
+ *               caller because sometimes the storage is special or needs
+ *               to be preallocated, eg: DMA-capable memory.  If NULL, the
+ *               storage will be allocated from the kernel heap.
+ *   blocksize - The size of one block in bytes.  The size will be rounded
+ *               up as necessary to hold the free list linkage.
+ *   nblocks   - The number of blocks in the pool.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on any failure.
+ *
+ ****************************************************************************/
+
+int mempool_init(FAR struct mempool_s *pool, FAR const char *name,
+                 FAR void *base, size_t blocksize, size_t nblocks);
+
+/****************************************************************************
+ * Name: mempool_deinit
+ *
+ * Description:
+ *   Remove a pool from the pool registry and free its block storage if it
+ *   was allocated by mempool_init().
+ *
+ * Input Parameters:
+ *   pool - Address of the pool to be uninitialized.
+ *
+ * Returned Value:
+ *   Zero on success; -EBUSY if any block is still allocated.
+ *
+ ****************************************************************************/
+
+int mempool_deinit(FAR struct mempool_s *pool);
+
+/****************************************************************************
+ * Name: mempool_alloc
+ *
+ * Description:
+ *   Allocate one block from a pool.  This is an O(1) operation and may be
+ *   called from interrupt handlers.
+ *
+ * Input Parameters:
+ *   pool - Address of the pool to allocate from.
+ *
+ * Returned Value:
+ *   The allocated block on success; NULL if the pool is exhausted.
+ *
+ ****************************************************************************/
+
+FAR void *mempool_alloc(FAR struct mempool_s *pool);
+
+/****************************************************************************
+ * Name: mempool_free
+ *
+ * Description:
+ *   Return one block to the pool that it was allocated from.  This is an
+ *   O(1) operation and may be called from interrupt handlers.
+ *
+ * Input Parameters:
+ *   pool - Address of the pool that the block was allocated from.
+ *   blk  - The block to be returned.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mempool_free(FAR struct mempool_s *pool, FAR void *blk);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __INCLUDE_NUTTX_MM_MEMPOOL_H */
@@ -151,6 +151,46 @@
 #define MM_ALIGN_UP(a)   (((a) + MM_GRAN_MASK) & ~MM_GRAN_MASK)
 #define MM_ALIGN_DOWN(a) ((a) & ~MM_GRAN_MASK)
 
+#ifdef CONFIG_MM_QUICKLIST
+/* The quick lists hold recently freed small chunks, one singly linked list
+ * per chunk size.  Chunk sizes are always multiples of MM_MIN_CHUNK, so
+ * there is one size class for each multiple of MM_MIN_CHUNK up to and
+ * including CONFIG_MM_QUICKLIST_MAX.
+ */
+
+#  define MM_QUICKLIST_NCLASSES (CONFIG_MM_QUICKLIST_MAX >> MM_MIN_SHIFT)
+#  define MM_QUICKLIST_NDX(s)   (((s) >> MM_MIN_SHIFT) - 1)
+#endif
+
+#ifdef CONFIG_MM_HEAP_STATS
+/* Heap telemetry helpers.  These maintain the incremental counters as
+ * chunks enter and leave the free lists and compile away to nothing
+ * unless CONFIG_MM_HEAP_STATS is selected.  The caller must hold the
+ * heap semaphore.
+ */
+
+#  define MM_STATS_ADDFREE(heap, node) \
+     do \
+       { \
+         (heap)->mm_stats.mm_freebytes += (node)->size; \
+         if ((node)->size > (heap)->mm_stats.mm_maxfree) \
+           { \
+             (heap)->mm_stats.mm_maxfree = (node)->size; \
+           } \
+       } \
+     while (0)
+
+#  define MM_STATS_RMFREE(heap, node) \
+     do \
+       { \
+         (heap)->mm_stats.mm_freebytes -= (node)->size; \
+       } \
+     while (0)
+#else
+#  define MM_STATS_ADDFREE(heap, node)
+#  define MM_STATS_RMFREE(heap, node)
+#endif
+
 /* An allocated chunk is distinguished from a free chunk by bit 31 (or 15)
  * of the 'preceding' chunk size.  If set, then this is an allocated chunk.
  */
@@ -222,6 +262,40 @@ struct mm_delaynode_s
 #define CHECK_FREENODE_SIZE \
   DEBUGASSERT(sizeof(struct mm_freenode_s) == SIZEOF_MM_FREENODE)
 
+#ifdef CONFIG_MM_HEAP_STATS
+#ifdef CONFIG_MM_HEAP_STATS_PROFILER
+/* One sampled allocation call site */
+
+struct mm_sampledsite_s
+{
+  FAR void *ms_callsite;           /* Return address of the caller */
+  uint32_t  ms_count;              /* Number of sampled allocations */
+  size_t    ms_bytes;              /* Bytes in the sampled allocations */
+};
+#endif
+
+/* Incrementally maintained heap telemetry.  Unlike mm_mallinfo(), which
+ * walks the entire heap under the heap semaphore, these counters are
+ * updated in O(1) as chunks are allocated and freed and so may be read
+ * cheaply in production.  mm_maxfree is an upper-bound estimate:  it
+ * grows exactly but decays only when mm_mallinfo() performs its full
+ * walk and re-synchronizes the counters.
+ */
+
+struct mm_stats_s
+{
+  size_t   mm_freebytes;           /* Bytes on the free lists */
+  size_t   mm_maxfree;             /* Largest free chunk (upper bound) */
+  uint32_t mm_nallocs[MM_NNODES];  /* Allocations by power-of-two size */
+#ifdef CONFIG_MM_HEAP_STATS_PROFILER
+  uint32_t mm_nsamples;            /* Allocations seen by the sampler */
+  uint32_t mm_othercount;          /* Samples with no free site slot */
+  size_t   mm_otherbytes;          /* Bytes in those samples */
+  struct mm_sampledsite_s mm_sites[CONFIG_MM_HEAP_STATS_NSITES];
+#endif
+};
+#endif
+
 /* This describes one heap (possibly with multiple regions) */
 
 struct mm_heap_s
@@ -254,9 +328,24 @@ struct mm_heap_s
 
   struct mm_freenode_s mm_nodelist[MM_NNODES];
 
+#ifdef CONFIG_MM_QUICKLIST
+  /* Quick lists of recently freed small chunks, one per size class.
+   * Chunks on these lists keep their MM_ALLOC_BIT set so that they are
+   * never coalesced with neighboring free chunks.
+   */
+
+  FAR struct mm_freenode_s *mm_quicklist[MM_QUICKLIST_NCLASSES];
+#endif
+
   /* Free delay list, for some situation can't do free immdiately */
 
   struct mm_delaynode_s *mm_delaylist;
+
+#ifdef CONFIG_MM_HEAP_STATS
+  /* Incrementally maintained telemetry counters */
+
+  struct mm_stats_s mm_stats;
+#endif
 };
 
 /****************************************************************************
@@ -302,9 +391,20 @@ EXTERN struct mm_heap_s g_mmheap;
 #endif
 
 #ifdef CONFIG_MM_KERNEL_HEAP
-/* This is the kernel heap */
+/* The number of kernel heap arenas.  With more than one arena, the kernel
+ * heap is split into independently locked sub-heaps and each CPU prefers
+ * the arena matching its index to relieve SMP allocator contention.
+ */
 
-EXTERN struct mm_heap_s g_kmmheap;
+#ifdef CONFIG_MM_KERNEL_HEAP_ARENAS
+#  define KMM_NARENAS CONFIG_MM_KERNEL_HEAP_ARENAS
+#else
+#  define KMM_NARENAS 1
+#endif
+
+/* This is the kernel heap, possibly partitioned into arenas */
+
+EXTERN struct mm_heap_s g_kmmheap[KMM_NARENAS];
 #endif
 
 /****************************************************************************
@@ -326,6 +426,8 @@ void umm_initialize(FAR void *heap_start, size_t heap_size);
 
 #ifdef CONFIG_MM_KERNEL_HEAP
 void kmm_initialize(FAR void *heap_start, size_t heap_size);
+FAR struct mm_heap_s *kmm_preferred(void);
+FAR struct mm_heap_s *kmm_container(FAR void *mem);
 #endif
 
 /* Functions contained in umm_addregion.c ***********************************/
@@ -485,6 +587,7 @@ int mm_mallinfo(FAR struct mm_heap_s *heap, FAR struct mallinfo *info);
 
 #ifdef CONFIG_MM_KERNEL_HEAP
 struct mallinfo kmm_mallinfo(void);
+int kmm_mallinfo_arena(int arena, FAR struct mallinfo *info);
 #endif
 
 /* Functions contained in mm_shrinkchunk.c **********************************/
@@ -501,6 +604,14 @@ void mm_addfreechunk(FAR struct mm_heap_s *heap,
 
 int mm_size2ndx(size_t size);
 
+/* Functions contained in mm_stats.c ****************************************/
+
+#ifdef CONFIG_MM_HEAP_STATS
+void mm_stats_alloc(FAR struct mm_heap_s *heap, size_t size,
+                    FAR void *callsite);
+void mm_stats(FAR struct mm_heap_s *heap, FAR struct mm_stats_s *stats);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -42,6 +42,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <debug.h>
 
 #include <nuttx/mm/gran.h>
@@ -102,6 +103,17 @@ struct group_shm_s
    */
 
   uintptr_t gs_vaddr[CONFIG_ARCH_SHM_MAXREGIONS];
+
+#ifdef CONFIG_MM_SHM_MAP_CACHE
+  /* A non-zero entry in gs_vaddr[] with the corresponding gs_cached[]
+   * flag set describes a mapping that has been detached by shmdt() but
+   * kept warm so that a later shmat() of the same region can reuse it
+   * without reprogramming the MMU.  A cached mapping continues to hold
+   * an attach reference on the region.
+   */
+
+  bool gs_cached[CONFIG_ARCH_SHM_MAXREGIONS];
+#endif
 };
 
 /****************************************************************************
@@ -269,6 +269,43 @@ int nxmq_unlink(FAR const char *mq_name);
 int nxmq_send(mqd_t mqdes, FAR const char *msg, size_t msglen,
               unsigned int prio);
 
+/****************************************************************************
+ * Name: nxmq_sendv
+ *
+ * Description:
+ *   This function adds a batch of messages to the message queue (mqdes)
+ *   under a single critical section.  This is an internal OS interface
+ *   with no POSIX equivalent.  It is functionally equivalent to calling
+ *   nxmq_send() once for each entry of 'msgv' except that the cost of
+ *   entering and leaving the critical section and of waking up waiting
+ *   readers is paid only once for the whole batch.
+ *
+ *   All messages in the batch share the same priority.  If the message
+ *   queue becomes full while the batch is being delivered, then delivery
+ *   stops short:  This function will block waiting for space only before
+ *   the first message has been enqueued; after that, it returns the
+ *   number of messages actually sent.
+ *
+ * Input Parameters:
+ *   mqdes - Message queue descriptor
+ *   msgv  - Array of messages to send.  Each entry provides the base
+ *           address and the length in bytes of one message.
+ *   msgc  - The number of entries in the msgv[] array
+ *   prio  - The priority of all messages in the batch
+ *
+ * Returned Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  On success, the number of messages enqueued (greater
+ *   than zero) is returned.  A negated errno value is returned if no
+ *   message could be sent (see nxmq_send() for the list of valid return
+ *   values).
+ *
+ ****************************************************************************/
+
+struct iovec; /* Forward reference */
+int nxmq_sendv(mqd_t mqdes, FAR const struct iovec *msgv, int msgc,
+               unsigned int prio);
+
 /****************************************************************************
  * Name: nxmq_timedsend
  *
@@ -232,6 +232,68 @@
 #  define NAND_WRITEPAGE(r,b,p,d,s) ((r)->rawwrite(r,b,p,d,s))
 #endif
 
+/****************************************************************************
+ * Name: NAND_MULTIREAD
+ *
+ * Description:
+ *   Reads the data areas of NPAGES consecutive pages of one erase block of
+ *   a NAND FLASH into the provided buffer in a single operation.  The same
+ *   ECC handling as for NAND_READPAGE applies.  The lower half may use the
+ *   chip's sequential read-cache command to overlap the ECC verification
+ *   of one page with the FLASH array access of the next page.
+ *
+ *   This method is optional.  The upper half will fall back to a
+ *   page-by-page loop if the lower half leaves it NULL.
+ *
+ * Input Parameters:
+ *   raw    - Lower-half, raw NAND FLASH interface
+ *   block  - Number of the block where the pages to read reside.
+ *   page   - Number of the first page to read inside the given block.
+ *   npages - Number of consecutive pages to read.  The caller assures
+ *            that the run does not extend past the end of the block.
+ *   data   - Buffer where the data areas will be stored.
+ *
+ * Returned Value:
+ *   OK is returned in success; a negated errno value is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_NAND_MULTIPAGE
+#  define NAND_MULTIREAD(r,b,p,n,d) ((r)->multiread(r,b,p,n,d))
+#endif
+
+/****************************************************************************
+ * Name: NAND_MULTIWRITE
+ *
+ * Description:
+ *   Writes the data areas of NPAGES consecutive pages of one erase block
+ *   of a NAND FLASH from the provided buffer in a single operation.  The
+ *   same ECC handling as for NAND_WRITEPAGE applies.  The lower half may
+ *   use the chip's cache-program command to overlap the ECC calculation
+ *   for one page with the programming of the previous page.
+ *
+ *   This method is optional.  The upper half will fall back to a
+ *   page-by-page loop if the lower half leaves it NULL.
+ *
+ * Input Parameters:
+ *   raw    - Lower-half, raw NAND FLASH interface
+ *   block  - Number of the block where the pages to write reside.
+ *   page   - Number of the first page to write inside the given block.
+ *   npages - Number of consecutive pages to write.  The caller assures
+ *            that the run does not extend past the end of the block.
+ *   data   - Buffer containing the data to be written.
+ *
+ * Returned Value:
+ *   OK is returned in success; a negated errno value is returned on
+ *   failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MTD_NAND_MULTIPAGE
+#  define NAND_MULTIWRITE(r,b,p,n,d) ((r)->multiwrite(r,b,p,n,d))
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -268,6 +330,17 @@ struct nand_raw_s
                         FAR const void *spare);
 #endif
 
+#ifdef CONFIG_MTD_NAND_MULTIPAGE
+  /* Optional, sequential multi-page transfer methods.  May be NULL. */
+
+  CODE int (*multiread)(FAR struct nand_raw_s *raw, off_t block,
+                        unsigned int page, unsigned int npages,
+                        FAR void *data);
+  CODE int (*multiwrite)(FAR struct nand_raw_s *raw, off_t block,
+                         unsigned int page, unsigned int npages,
+                         FAR const void *data);
+#endif
+
 #if defined(CONFIG_MTD_NAND_SWECC) || defined(CONFIG_MTD_NAND_HWECC)
   /* ECC working buffers*/
 
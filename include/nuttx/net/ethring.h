@@ -0,0 +1,181 @@
+/****************************************************************************
+ * include/nuttx/net/ethring.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_NET_ETHRING_H
+#define __INCLUDE_NUTTX_NET_ETHRING_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <nuttx/mm/iob.h>
+
+#ifdef CONFIG_NETDEV_ETHRING
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This structure describes one IOB-backed DMA descriptor ring.  It tracks
+ * which I/O buffer is attached to each hardware descriptor so that a MAC
+ * driver can DMA directly into and out of network stack buffers instead
+ * of copying frames through an intermediate driver buffer.
+ *
+ * The same structure serves both directions:  For an RX ring the driver
+ * replenishes each descriptor with a fresh buffer and harvests the buffer
+ * when the hardware completes a reception; for a TX ring the driver
+ * attaches outgoing buffers and reclaims them when transmission completes.
+ *
+ * NOTE:  Each descriptor is backed by a single I/O buffer, so either
+ * CONFIG_IOB_BUFSIZE must be at least the MTU plus link layer overhead,
+ * or the MAC must support multi-descriptor (scatter/gather) frames with
+ * one IOB per descriptor.
+ */
+
+struct eth_ring_s
+{
+  FAR struct iob_s **er_bufs;   /* IOB attached to each descriptor */
+  FAR struct iob_s  *er_cache;  /* Small cache of free IOBs for replenish */
+  uint16_t           er_ndesc;  /* Number of descriptors in the ring */
+  uint8_t            er_ncache; /* Number of IOBs in the cache */
+  uint8_t            er_maxcache; /* Limit on the size of the cache */
+  uint8_t            er_user;   /* IOB consumer ID (enum iob_user_e) */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: eth_ring_setup
+ *
+ * Description:
+ *   Initialize an IOB descriptor ring with 'ndesc' descriptors.  Up to
+ *   'maxcache' free I/O buffers will be cached in the ring for use by
+ *   eth_ring_replenish() so that the RX refill path normally does not
+ *   touch the global IOB pool.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int eth_ring_setup(FAR struct eth_ring_s *ring, uint16_t ndesc,
+                   uint8_t maxcache, enum iob_user_e user);
+
+/****************************************************************************
+ * Name: eth_ring_teardown
+ *
+ * Description:
+ *   Release all buffers attached to the ring, the buffer cache and the
+ *   ring bookkeeping memory.
+ *
+ ****************************************************************************/
+
+void eth_ring_teardown(FAR struct eth_ring_s *ring);
+
+/****************************************************************************
+ * Name: eth_ring_replenish
+ *
+ * Description:
+ *   Attach a fresh I/O buffer to the descriptor at 'index' and return the
+ *   address that the hardware should DMA into.  The buffer comes from the
+ *   ring cache when possible and from the global pool otherwise.
+ *
+ * Returned Value:
+ *   The buffer address on success; NULL if no buffer is available (the
+ *   descriptor is then left empty and should not be given to hardware).
+ *
+ * Assumptions:
+ *   May be called from interrupt level.
+ *
+ ****************************************************************************/
+
+FAR uint8_t *eth_ring_replenish(FAR struct eth_ring_s *ring,
+                                uint16_t index);
+
+/****************************************************************************
+ * Name: eth_ring_harvest
+ *
+ * Description:
+ *   Detach the completed I/O buffer from the RX descriptor at 'index',
+ *   recording that 'len' bytes were received into it.  The caller owns
+ *   the returned buffer and will normally hand it to the network stack,
+ *   then replenish the descriptor.
+ *
+ * Returned Value:
+ *   The received I/O buffer, or NULL if the descriptor was empty.
+ *
+ ****************************************************************************/
+
+FAR struct iob_s *eth_ring_harvest(FAR struct eth_ring_s *ring,
+                                   uint16_t index, uint16_t len);
+
+/****************************************************************************
+ * Name: eth_ring_attach
+ *
+ * Description:
+ *   Attach the outgoing I/O buffer 'iob' to the TX descriptor at 'index'.
+ *   The ring takes ownership of the buffer until the matching
+ *   eth_ring_reclaim() at TX completion.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EBUSY if the descriptor still holds a buffer.
+ *
+ ****************************************************************************/
+
+int eth_ring_attach(FAR struct eth_ring_s *ring, uint16_t index,
+                    FAR struct iob_s *iob);
+
+/****************************************************************************
+ * Name: eth_ring_reclaim
+ *
+ * Description:
+ *   Called at TX completion to release the buffer attached to the
+ *   descriptor at 'index'.  The buffer is returned to the ring cache when
+ *   there is room (where the RX replenish logic will pick it up) and to
+ *   the global pool otherwise.
+ *
+ * Assumptions:
+ *   May be called from interrupt level.
+ *
+ ****************************************************************************/
+
+void eth_ring_reclaim(FAR struct eth_ring_s *ring, uint16_t index);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_NETDEV_ETHRING */
+#endif /* __INCLUDE_NUTTX_NET_ETHRING_H */
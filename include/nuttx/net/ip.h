@@ -52,6 +52,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
@@ -259,7 +260,24 @@ extern "C"
  *
  ****************************************************************************/
 
-#ifdef CONFIG_ENDIAN_BIG
+/* The two 16-bit halves are combined in their memory order so that, on
+ * either endianness, the conversion amounts to a native 32-bit load from a
+ * 16-bit aligned address.  On architectures that support unaligned 32-bit
+ * loads, express it as such (via a fixed-size memcpy, which the compiler
+ * reduces to a single load) rather than as two loads composed with shifts
+ * and ORs.
+ */
+
+#if defined(__GNUC__) && \
+    (defined(__ARM_FEATURE_UNALIGNED) || defined(__i386__) || \
+     defined(__x86_64__))
+#  define net_ip4addr_conv32(addr) \
+    ({ \
+       in_addr_t _in4addr; \
+       memcpy(&_in4addr, (FAR const void *)(addr), sizeof(in_addr_t)); \
+       _in4addr; \
+    })
+#elif defined(CONFIG_ENDIAN_BIG)
 #  define net_ip4addr_conv32(addr) \
     (((in_addr_t)((FAR uint16_t *)addr)[0] << 16) | \
      (in_addr_t)((FAR uint16_t *)addr)[1])
@@ -100,6 +100,10 @@ struct neighbor_entry_s
   net_ipv6addr_t         ne_ipaddr;  /* IPv6 address of the Neighbor */
   struct neighbor_addr_s ne_addr;    /* Link layer address of the Neighbor */
   clock_t                ne_time;    /* For aging, units of tick */
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+  clock_t                ne_probetime; /* Time of the last refresh probe */
+  uint8_t                ne_probes;  /* Number of unanswered refresh probes */
+#endif
 };
 
 #ifdef __cplusplus
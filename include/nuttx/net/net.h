@@ -355,6 +355,10 @@ void net_initialize(void);
  *
  *   net_lock()        - Locks the network via a re-entrant mutex.
  *   net_unlock()      - Unlocks the network.
+ *   net_rdlock()      - Locks the network for read-only access.  With
+ *                       CONFIG_NET_RWLOCK, multiple readers may run
+ *                       concurrently; otherwise identical to net_lock().
+ *   net_rdunlock()    - Releases the read-only lock.
  *   net_lockedwait()  - Like pthread_cond_wait() except releases the
  *                       network momentarily to wait on another semaphore.
  *   net_ioballoc()    - Like iob_alloc() except releases the network
@@ -415,6 +419,53 @@ int net_trylock(void);
 
 void net_unlock(void);
 
+/****************************************************************************
+ * Name: net_rdlock
+ *
+ * Description:
+ *   Take the network lock for read-only access.  With CONFIG_NET_RWLOCK,
+ *   multiple readers may hold the lock concurrently; all exclude
+ *   net_lock() writers.  Without CONFIG_NET_RWLOCK this is simply
+ *   net_lock().
+ *
+ *   The read-side critical section must not block on the network (no
+ *   net_lockedwait) and must not attempt to upgrade to net_lock().
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned on
+ *   failured (probably -ECANCELED).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_RWLOCK
+int net_rdlock(void);
+#else
+#  define net_rdlock() net_lock()
+#endif
+
+/****************************************************************************
+ * Name: net_rdunlock
+ *
+ * Description:
+ *   Release the read-only network lock taken by net_rdlock().
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_RWLOCK
+void net_rdunlock(void);
+#else
+#  define net_rdunlock() net_unlock()
+#endif
+
 /****************************************************************************
  * Name: net_timedwait
  *
@@ -57,6 +57,10 @@
 #include <net/ethernet.h>
 #include <arpa/inet.h>
 
+#ifdef CONFIG_NET_RXBATCH
+#  include <nuttx/mm/iob.h>
+#endif
+
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/ip.h>
 
@@ -99,6 +103,7 @@
      memset(&(dev)->d_statistics, 0, sizeof(struct netdev_statistics_s))
 
 #  define _NETDEV_STATISTIC(dev,name) ((dev)->d_statistics.name++)
+#  define _NETDEV_STATISTIC_ADD(dev,name,n) ((dev)->d_statistics.name += (n))
 #  define _NETDEV_ERROR(dev,name) \
      do \
        { \
@@ -126,11 +131,14 @@
 #    define NETDEV_RXARP(dev)
 #  endif
 #  define NETDEV_RXDROPPED(dev)   _NETDEV_STATISTIC(dev,rx_dropped)
+#  define NETDEV_RXBYTES(dev,len) _NETDEV_STATISTIC_ADD(dev,rx_bytes,len)
 
 #  define NETDEV_TXPACKETS(dev)   _NETDEV_STATISTIC(dev,tx_packets)
 #  define NETDEV_TXDONE(dev)      _NETDEV_STATISTIC(dev,tx_done)
 #  define NETDEV_TXERRORS(dev)    _NETDEV_ERROR(dev,tx_errors)
 #  define NETDEV_TXTIMEOUTS(dev)  _NETDEV_ERROR(dev,tx_timeouts)
+#  define NETDEV_TXBYTES(dev,len) _NETDEV_STATISTIC_ADD(dev,tx_bytes,len)
+#  define NETDEV_TXPOLLS(dev)     _NETDEV_STATISTIC(dev,tx_polls)
 
 #  define NETDEV_ERRORS(dev)      _NETDEV_STATISTIC(dev,errors)
 
@@ -143,15 +151,41 @@
 #  define NETDEV_RXIPV6(dev)
 #  define NETDEV_RXARP(dev)
 #  define NETDEV_RXDROPPED(dev)
+#  define NETDEV_RXBYTES(dev,len)
 
 #  define NETDEV_TXPACKETS(dev)
 #  define NETDEV_TXDONE(dev)
 #  define NETDEV_TXERRORS(dev)
 #  define NETDEV_TXTIMEOUTS(dev)
+#  define NETDEV_TXBYTES(dev,len)
+#  define NETDEV_TXPOLLS(dev)
 
 #  define NETDEV_ERRORS(dev)
 #endif
 
+/* Hardware offload capabilities that a network device driver may advertise
+ * in the d_capabilities field.  The network layer consults these bits at
+ * the checksum call sites and skips work that the hardware will perform.
+ */
+
+#ifdef CONFIG_NETDEV_HWCAPS
+#  define NETDEV_CAP_CSUM_TX    (1 << 0) /* Hardware inserts IP header and
+                                          * TCP/UDP checksums on transmit.
+                                          * The stack leaves the checksum
+                                          * fields zero. */
+#  define NETDEV_CAP_CSUM_RX    (1 << 1) /* Hardware verifies IP header and
+                                          * TCP/UDP checksums on receive and
+                                          * discards bad frames.  The stack
+                                          * skips software verification. */
+#  define NETDEV_CAP_SG         (1 << 2) /* Hardware supports gather DMA of
+                                          * non-contiguous buffers on
+                                          * transmit. */
+
+#  define NETDEV_HAS_CAP(dev,cap) (((dev)->d_capabilities & (cap)) != 0)
+#else
+#  define NETDEV_HAS_CAP(dev,cap) (0)
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -179,6 +213,7 @@ struct netdev_statistics_s
   uint32_t rx_arp;         /* Number of Rx ARP packets received */
 #endif
   uint32_t rx_dropped;     /* Unsupported Rx packets received */
+  uint32_t rx_bytes;       /* Number of bytes received */
 
   /* Tx Status */
 
@@ -186,6 +221,8 @@ struct netdev_statistics_s
   uint32_t tx_done;        /* Number of packets completed */
   uint32_t tx_errors;      /* Number of receive errors (incl timeouts) */
   uint32_t tx_timeouts;    /* Number of Tx timeout errors */
+  uint32_t tx_bytes;       /* Number of bytes transmitted */
+  uint32_t tx_polls;       /* Number of device TX poll cycles */
 
   /* Other status */
 
@@ -249,6 +286,9 @@ struct net_driver_s
 #ifdef CONFIG_NETDEV_IFINDEX
   uint8_t d_ifindex;            /* Device index */
 #endif
+#ifdef CONFIG_NETDEV_HWCAPS
+  uint8_t d_capabilities;       /* Hardware offloads; see NETDEV_CAP_* */
+#endif
 
   uint16_t d_pktsize;           /* Maximum packet size */
 
@@ -340,6 +380,16 @@ struct net_driver_s
 
   uint16_t d_sndlen;
 
+#ifdef CONFIG_NET_RXBATCH
+  /* A backlog of received frames awaiting input processing.  Each entry of
+   * the queue is one frame held in a chain of I/O buffers.  The driver adds
+   * frames with devif_rx_enqueue() and drains the backlog in batches with
+   * devif_rx_drain().
+   */
+
+  struct iob_queue_s d_rxqueue;
+#endif
+
   /* Multicast group support */
 
 #ifdef CONFIG_NET_IGMP
@@ -544,6 +594,57 @@ int devif_poll(FAR struct net_driver_s *dev, devif_poll_callback_t callback);
 int devif_timer(FAR struct net_driver_s *dev, int delay,
                 devif_poll_callback_t callback);
 
+/****************************************************************************
+ * Name: devif_rx_enqueue
+ *
+ * Description:
+ *   Add one received frame, held in a chain of I/O buffers, to the RX
+ *   backlog of the device.  This function is intended to be called by the
+ *   device driver from the interrupt level or from a DMA completion
+ *   handler:  It does not take the network lock and does not wait for
+ *   resources.  The frame will be processed later when the driver calls
+ *   devif_rx_drain() from the worker thread.
+ *
+ *   The frame must begin with the link layer header and iob->io_pktlen
+ *   must hold the length of the frame.  On success, the I/O buffer chain
+ *   is owned by the RX backlog; on failure the caller retains ownership
+ *   and should recycle the buffers.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_RXBATCH
+int devif_rx_enqueue(FAR struct net_driver_s *dev, FAR struct iob_s *iob);
+#endif
+
+/****************************************************************************
+ * Name: devif_rx_drain
+ *
+ * Description:
+ *   Process frames from the RX backlog of the device.  For each frame, the
+ *   frame is copied into the driver d_buf, d_len is set, and the provided
+ *   'input' callback is invoked to dispatch the frame into the network
+ *   (and to transmit any response left in d_buf).  Up to 'budget' frames
+ *   are processed per call (or CONFIG_NET_RXBATCH_BUDGET frames if budget
+ *   is zero); the network is locked once for the whole batch.
+ *
+ *   This function must be called from the worker thread, never from the
+ *   interrupt level.  If the return value is equal to the budget, then
+ *   more frames may remain in the backlog and the driver should schedule
+ *   another pass.
+ *
+ * Returned Value:
+ *   The number of frames processed.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_RXBATCH
+int devif_rx_drain(FAR struct net_driver_s *dev,
+                   devif_poll_callback_t input, unsigned int budget);
+#endif
+
 /****************************************************************************
  * Name: neighbor_out
  *
@@ -76,8 +76,14 @@
 #define TCP_OPT_END       0   /* End of TCP options list */
 #define TCP_OPT_NOOP      1   /* "No-operation" TCP option */
 #define TCP_OPT_MSS       2   /* Maximum segment size TCP option */
+#define TCP_OPT_SACK_PERM 4   /* SACK-permitted TCP option (RFC 2018) */
+#define TCP_OPT_SACK      5   /* SACK TCP option (RFC 2018) */
+#define TCP_OPT_TFO       34  /* TCP Fast Open option (RFC 7413) */
 
 #define TCP_OPT_MSS_LEN   4   /* Length of TCP MSS option. */
+#define TCP_OPT_SACK_PERM_LEN 2 /* Length of TCP SACK-permitted option. */
+#define TCP_OPT_TFO_LEN   2   /* Length of TCP Fast Open option without
+                               * the cookie (a cookie request). */
 
 /* The TCP states used in the struct tcp_conn_s tcpstateflags field */
 
@@ -96,6 +96,25 @@ typedef FAR void *NXHANDLE;
 
 typedef FAR void *NXWINDOW;
 
+/* Client-rendered surfaces *************************************************/
+
+#ifdef CONFIG_NX_CLIENTSURFACE
+/* Describes one client-rendered surface.  The client renders frames into
+ * the provided buffer with ordinary memory stores, records the regions it
+ * touched with nx_surfdamage(), and hands the damaged portion of the
+ * buffer to the server with nx_surfflush().
+ */
+
+struct nx_surface_s
+{
+  FAR const void *buffer[CONFIG_NX_NPLANES]; /* Client-rendered pixel data */
+  struct nxgl_rect_s bounds;                 /* Surface bounds; origin (0,0) */
+  unsigned int stride;                       /* Width of a buffer row in bytes */
+  struct nxgl_rect_s dirty;                  /* Accumulated damage rectangle */
+  bool isdirty;                              /* True: dirty is valid */
+};
+#endif
+
 /* NX server callbacks ******************************************************/
 
 /* Event callbacks */
@@ -945,6 +964,80 @@ int nx_bitmap(NXWINDOW hwnd, FAR const struct nxgl_rect_s *dest,
               FAR const void *src[CONFIG_NX_NPLANES],
               FAR const struct nxgl_point_s *origin, unsigned int stride);
 
+/****************************************************************************
+ * Name: nx_surfinit
+ *
+ * Description:
+ *   Initialize a client-rendered surface.  The caller provides the pixel
+ *   buffer; the surface structure only records how the buffer is laid out
+ *   and which portions of it have been damaged since the last flush.
+ *
+ * Input Parameters:
+ *   surf   - The surface structure to be initialized
+ *   buffer - The start of the client-rendered image.  This is an array of
+ *            source images of size CONFIG_NX_NPLANES.
+ *   size   - The size of the surface in pixels.  Surface pixel (x,y)
+ *            corresponds to window position (x,y); the surface would
+ *            normally be the same size as the window.
+ *   stride - The width of the full source image in bytes.
+ *
+ * Returned Value:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_CLIENTSURFACE
+int nx_surfinit(FAR struct nx_surface_s *surf,
+                FAR const void *buffer[CONFIG_NX_NPLANES],
+                FAR const struct nxgl_size_s *size, unsigned int stride);
+#endif
+
+/****************************************************************************
+ * Name: nx_surfdamage
+ *
+ * Description:
+ *   Report that the client has modified a rectangular region of the
+ *   surface buffer.  Damage accumulates into a single bounding rectangle
+ *   until the surface is flushed.  No server communication occurs.
+ *
+ * Input Parameters:
+ *   surf - The surface that was modified
+ *   rect - The modified region (in surface/window coordinates)
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_CLIENTSURFACE
+void nx_surfdamage(FAR struct nx_surface_s *surf,
+                   FAR const struct nxgl_rect_s *rect);
+#endif
+
+/****************************************************************************
+ * Name: nx_surfflush
+ *
+ * Description:
+ *   Hand the damaged region of a client-rendered surface to the server for
+ *   composition into the window.  However many drawing operations the
+ *   client performed on the buffer since the last flush, this sends a
+ *   single bitmap update covering the accumulated damage rectangle.  The
+ *   call does not return until the server has consumed the buffer, so the
+ *   client may begin rendering the next frame immediately.
+ *
+ * Input Parameters:
+ *   hwnd - The window that will receive the surface contents
+ *   surf - The surface to be flushed
+ *
+ * Returned Value:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_CLIENTSURFACE
+int nx_surfflush(NXWINDOW hwnd, FAR struct nx_surface_s *surf);
+#endif
+
 /****************************************************************************
  * Name: nx_kbdin
  *
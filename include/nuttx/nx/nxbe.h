@@ -72,6 +72,7 @@
  * NXBE_WINDOW_RAMBACKED - Window is backed by a framebuffer
  * NXBE_WINDOW_MODAL     - Window is in a focused, modal state
  * NXBE_WINDOW_HIDDEN    - Window is hidden
+ * NXBE_WINDOW_DIRTY     - Window has an accumulated region to be redrawn
  */
 
 #define NXBE_WINDOW_BLOCKED   (1 << 0) /* Bit 0: The window is blocked and will
@@ -80,6 +81,8 @@
 #define NXBE_WINDOW_RAMBACKED (1 << 2) /* Bit 2: Window is backed by a framebuffer */
 #define NXBE_WINDOW_MODAL     (1 << 3) /* Bit 3: Window is in a focused, modal state */
 #define NXBE_WINDOW_HIDDEN    (1 << 4) /* Bit 4: Window is hidden */
+#define NXBE_WINDOW_DIRTY     (1 << 5) /* Bit 5: Window has an accumulated
+                                        *        region to be redrawn */
 
 /* Valid user flags for different window types.  This is the subset of flags
  * that may be passed with nx_openwindow() or nxtk_openwindow.  Most of the
@@ -140,6 +143,13 @@
 #define NXBE_CLRHIDDEN(wnd) \
   do { (wnd)->flags &= ~NXBE_WINDOW_HIDDEN; } while (0)
 
+#define NXBE_ISDIRTY(wnd) \
+  (((wnd)->flags & NXBE_WINDOW_DIRTY) != 0)
+#define NXBE_SETDIRTY(wnd) \
+  do { (wnd)->flags |= NXBE_WINDOW_DIRTY; } while (0)
+#define NXBE_CLRDIRTY(wnd) \
+  do { (wnd)->flags &= ~NXBE_WINDOW_DIRTY; } while (0)
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -179,6 +189,17 @@ struct nxbe_window_s
 
   uint8_t flags;
 
+#ifdef CONFIG_NX_REDRAW_COALESCE
+  /* Redraw coalescing support.  The dirty rectangle is valid only while
+   * the NXBE_WINDOW_DIRTY flag is set.  The counters permit computation
+   * of the per-window update rate and of the coalescing ratio.
+   */
+
+  struct nxgl_rect_s dirty;           /* Accumulated region to be redrawn */
+  uint32_t nupdates;                  /* Number of update regions received */
+  uint32_t nredraws;                  /* Number of redraws performed */
+#endif
+
 #ifdef CONFIG_NX_RAMBACKED
   /* Per-window framebuffer support */
 
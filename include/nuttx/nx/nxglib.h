@@ -492,6 +492,54 @@ void nxgl_circletraps(FAR const struct nxgl_point_s *center,
                       nxgl_coord_t radius,
                       FAR struct nxgl_trapezoid_s *circle);
 
+/****************************************************************************
+ * Name: nxgl_hwfill, nxgl_hwcopy, and nxgl_hwmove
+ *
+ * Description:
+ *   When CONFIG_NX_BLIT_ACCEL=y, the framebuffer rendering logic will call
+ *   out to external logic before performing any rectangular fill, copy, or
+ *   move operation.  This permits a hardware 2D engine (DMA2D, ChromART,
+ *   or similar) to perform the blit without CPU involvement.
+ *
+ *   When this feature is enabled, some external logic must provide these
+ *   interfaces.  Each interface receives the same region description that
+ *   the software implementation would use, plus the pixel depth of the
+ *   plane, and returns true if the hardware performed (or will coherently
+ *   complete) the operation.  If false is returned, then the operation is
+ *   performed by the software implementation instead.  The external logic
+ *   is responsible for any cache coherency and for serializing hardware
+ *   operations against CPU accesses to the framebuffer.
+ *
+ * Input Parameters:
+ *   pinfo     - Describes the plane (framebuffer address and stride)
+ *   rect/dest - The rectangular region to be filled or written
+ *   color     - The fill color, in the format of the plane (fill only)
+ *   src       - The source bitmap (copy only)
+ *   origin    - The origin of the source bitmap (copy only)
+ *   srcstride - The width of the source bitmap in bytes (copy only)
+ *   offset    - The destination of the upper, left-hand corner (move only)
+ *   bpp       - The pixel depth of the plane in bits
+ *
+ * Returned Value:
+ *   True if the operation was handled by the hardware; false to fall back
+ *   to the software implementation.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NX_BLIT_ACCEL
+bool nxgl_hwfill(FAR struct fb_planeinfo_s *pinfo,
+                 FAR const struct nxgl_rect_s *rect,
+                 uint32_t color, int bpp);
+bool nxgl_hwcopy(FAR struct fb_planeinfo_s *pinfo,
+                 FAR const struct nxgl_rect_s *dest,
+                 FAR const void *src,
+                 FAR const struct nxgl_point_s *origin,
+                 unsigned int srcstride, int bpp);
+bool nxgl_hwmove(FAR struct fb_planeinfo_s *pinfo,
+                 FAR const struct nxgl_rect_s *rect,
+                 FAR struct nxgl_point_s *offset, int bpp);
+#endif
+
 /****************************************************************************
  * Name: nxglib_rgb24_blend and nxglib_rgb565_blend
  *
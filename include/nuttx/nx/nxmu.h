@@ -80,6 +80,17 @@
 #define NX_CLIMSG_PRIO 42
 #define NX_SVRMSG_PRIO 42
 
+/* Shared-memory message ring.  Each ring record is a 16-bit length header
+ * followed immediately by the message payload.  A length of NX_RING_WRAP
+ * marks unused space at the end of the buffer; the record then continues
+ * at offset zero.
+ */
+
+#ifdef CONFIG_NX_MSGRING
+#  define NX_RING_WRAP     0xffff
+#  define NX_RING_HDRSIZE  sizeof(uint16_t)
+#endif
+
 /* Handy macros */
 
 #define nxmu_semgive(sem)    _SEM_POST(sem) /* To match nxmu_semtake() */
@@ -99,6 +110,25 @@ enum nx_clistate_e
   NX_CLISTATE_DISCONNECT_PENDING, /* Waiting for server to acknowledge disconnect */
 };
 
+#ifdef CONFIG_NX_MSGRING
+/* This structure is a byte ring buffer that carries client-to-server
+ * messages.  It is shared directly between the client and the server;
+ * both necessarily run in the same, flat address space.  The client side
+ * is the only writer of 'head' and the server side is the only writer of
+ * 'tail'.
+ */
+
+struct nxmu_msgring_s
+{
+  sem_t exsem;              /* Serializes client threads writing the ring */
+  sem_t spacesem;           /* A client waits here when the ring is full */
+  volatile bool waiting;    /* True: a client is waiting for ring space */
+  volatile uint16_t head;   /* Offset at which the next record is written */
+  volatile uint16_t tail;   /* Offset at which the next record is read */
+  uint8_t buffer[CONFIG_NX_MSGRING_BUFSIZE];
+};
+#endif
+
 /* This structure represents a connection between the client and the server */
 
 struct nxmu_conn_s
@@ -116,6 +146,15 @@ struct nxmu_conn_s
   /* These are only usable on the server side of the connection */
 
   mqd_t swrmq;            /* MQ to write to the client */
+
+#ifdef CONFIG_NX_MSGRING
+  /* Shared between both sides.  All client-to-server messages travel
+   * through this ring; cwrmq then carries only the doorbell message that
+   * wakes the server when the ring transitions from empty to non-empty.
+   */
+
+  struct nxmu_msgring_s ring;
+#endif
 };
 
 /* Message IDs **************************************************************/
@@ -161,7 +200,8 @@ enum nxmsg_e
   NX_SVRMSG_SETBGCOLOR,       /* Set the color of the background */
   NX_SVRMSG_MOUSEIN,          /* New mouse report from mouse client */
   NX_SVRMSG_KBDIN,            /* New keyboard report from keyboard client */
-  NX_SVRMSG_REDRAWREQ         /* Request re-drawing of rectangular region */
+  NX_SVRMSG_REDRAWREQ,        /* Request re-drawing of rectangular region */
+  NX_SVRMSG_RINGDATA          /* Doorbell: The client message ring has data */
 };
 
 /* Server-to-Client Message Structures **************************************/
@@ -618,6 +658,69 @@ int nxmu_sendserver(FAR struct nxmu_conn_s *conn,
 int nxmu_sendwindow(FAR struct nxbe_window_s *wnd, FAR const void *msg,
                     size_t msglen);
 
+#ifdef CONFIG_NX_MSGRING
+/****************************************************************************
+ * Name: nxmu_ring_init
+ *
+ * Description:
+ *   Initialize a client message ring to the empty state.
+ *
+ * Input Parameters:
+ *   ring - The message ring to initialize
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nxmu_ring_init(FAR struct nxmu_msgring_s *ring);
+
+/****************************************************************************
+ * Name: nxmu_ring_put
+ *
+ * Description:
+ *   Write one message into the connection's shared-memory ring, blocking
+ *   if the ring is full until the server has drained it.  If the ring was
+ *   empty, a doorbell message is sent on the connection's server message
+ *   queue to wake the server; otherwise the server is already scheduled
+ *   to drain the ring and no wakeup is needed.
+ *
+ * Input Parameters:
+ *   conn   - A pointer to the server connection structure
+ *   msg    - A pointer to the message to send
+ *   msglen - The length of the message in bytes
+ *
+ * Returned Value:
+ *   OK on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int nxmu_ring_put(FAR struct nxmu_conn_s *conn, FAR const void *msg,
+                  size_t msglen);
+
+/****************************************************************************
+ * Name: nxmu_ring_get
+ *
+ * Description:
+ *   Copy the oldest message out of a client message ring.  This is called
+ *   only from the server message loop.  If a client is waiting for ring
+ *   space, it is signaled after the record is consumed.
+ *
+ * Input Parameters:
+ *   ring   - The message ring to read from
+ *   buffer - Location in which to return the message
+ *   buflen - The size of buffer; must be at least NX_MXSVRMSGLEN
+ *
+ * Returned Value:
+ *   The (positive) length of the message copied into buffer, or zero if
+ *   the ring is empty.
+ *
+ ****************************************************************************/
+
+ssize_t nxmu_ring_get(FAR struct nxmu_msgring_s *ring, FAR void *buffer,
+                      size_t buflen);
+#endif /* CONFIG_NX_MSGRING */
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
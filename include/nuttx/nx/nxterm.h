@@ -213,12 +213,20 @@
  *                changed
  * ARG:           A reference readable instance of struct nxtermioc_resize_s
  * CONFIGURATION: CONFIG_NXTERM
+ *
+ * CMD:           NXTERMIOC_NXTERM_SCROLLBACK
+ * DESCRIPTION:   Copy buffered scrollback text, oldest line first, into a
+ *                user-provided buffer
+ * ARG:           A reference readable instance of struct
+ *                nxtermioc_scrollback_s
+ * CONFIGURATION: CONFIG_NXTERM_SCROLLBACK > 0
  */
 
 #define _NXTERMIOC(nr)    _IOC(_NXTERMBASE,nr)
 #define NXTERMIOC_NXTERM_REDRAW     _NXTERMIOC(0x0000)
 #define NXTERMIOC_NXTERM_KBDIN      _NXTERMIOC(0x0001)
 #define NXTERMIOC_NXTERM_RESIZE     _NXTERMIOC(0x0002)
+#define NXTERMIOC_NXTERM_SCROLLBACK _NXTERMIOC(0x0003)
 
 /****************************************************************************
  * Public Types
@@ -269,6 +277,19 @@ struct nxtermioc_resize_s
   struct nxgl_size_s size;                  /* New Window Size */
 };
 
+/* Arguments passed with the NXTERMIOC_NXTERM_SCROLLBACK command.  On
+ * success, the IOCTL returns the number of bytes copied into the buffer.
+ * Each scrollback line is trimmed of trailing spaces and terminated with
+ * a newline character.
+ */
+
+struct nxtermioc_scrollback_s
+{
+  NXTERM handle;                            /* NxTerm handle */
+  FAR char *buffer;                         /* Buffer to receive the text */
+  size_t buflen;                            /* Size of the buffer in bytes */
+};
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -0,0 +1,192 @@
+/****************************************************************************
+ * include/nuttx/rptun/rptun_shmpool.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_RPTUN_RPTUN_SHMPOOL_H
+#define __INCLUDE_NUTTX_RPTUN_RPTUN_SHMPOOL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#ifdef CONFIG_RPTUN_SHMPOOL
+
+#include <sys/types.h>
+#include <stdint.h>
+
+#include <nuttx/semaphore.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The value of an invalid buffer handle */
+
+#define RPTUN_SHMPOOL_INVALID  UINT32_MAX
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This structure describes one pool of equally sized buffers carved from a
+ * region of memory that is shared with the remote core.  Payloads larger
+ * than the RPMsg vring buffers are placed in pool buffers and only a small
+ * ownership handle travels through the vring, so the payload bytes are
+ * never fragmented or copied.
+ *
+ * The pool metadata (the allocation map) is kept in local memory, not in
+ * the shared region, so no cross-core locking is needed.  The protocol is
+ * ownership based:
+ *
+ * 1. The sending side allocates a buffer with rptun_shmpool_alloc(),
+ *    fills it, and sends the handle from rptun_shmpool_handle() in an
+ *    ordinary (small) RPMsg message.  Sending the handle passes ownership
+ *    of the buffer to the peer.
+ * 2. The peer converts the received handle to a local pointer with
+ *    rptun_shmpool_buffer() and consumes the data in place.
+ * 3. When the peer is done it sends the handle back, returning ownership,
+ *    and the original side releases the buffer with rptun_shmpool_free().
+ *
+ * Each core creates its own pool (in a region agreed with the peer, e.g.
+ * exchanged in an announcement message when the endpoint is created) for
+ * the direction in which it transmits.
+ */
+
+struct rptun_shmpool_s
+{
+  FAR uint8_t  *base;    /* Base address of the shared buffer region */
+  size_t        bufsize; /* The size of one buffer */
+  unsigned int  nbufs;   /* The number of buffers in the region */
+  unsigned int  next;    /* Hint where to start the next free search */
+  sem_t         exclsem; /* Serializes access to the allocation map */
+  FAR uint32_t *map;     /* One bit per buffer; set means allocated */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: rptun_shmpool_init
+ *
+ * Description:
+ *   Initialize a buffer pool over a region of shared memory.  The region
+ *   must be visible to both cores; how it is obtained and communicated to
+ *   the peer is up to the caller.
+ *
+ * Input Parameters:
+ *   pool    - The pool state to initialize
+ *   base    - The (local) base address of the shared region
+ *   size    - The size of the shared region in bytes
+ *   bufsize - The size of one buffer.  The region holds size / bufsize
+ *             buffers.
+ *
+ * Returned Value:
+ *   OK on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int rptun_shmpool_init(FAR struct rptun_shmpool_s *pool, FAR void *base,
+                       size_t size, size_t bufsize);
+
+/****************************************************************************
+ * Name: rptun_shmpool_uninit
+ *
+ * Description:
+ *   Release the resources used by a buffer pool.  The shared region itself
+ *   is owned by the caller and is not touched.
+ *
+ ****************************************************************************/
+
+void rptun_shmpool_uninit(FAR struct rptun_shmpool_s *pool);
+
+/****************************************************************************
+ * Name: rptun_shmpool_alloc
+ *
+ * Description:
+ *   Allocate one buffer from the pool.
+ *
+ * Returned Value:
+ *   The buffer address on success; NULL if all buffers are in use.
+ *
+ ****************************************************************************/
+
+FAR void *rptun_shmpool_alloc(FAR struct rptun_shmpool_s *pool);
+
+/****************************************************************************
+ * Name: rptun_shmpool_free
+ *
+ * Description:
+ *   Return one buffer to the pool.  This must be called only by the side
+ *   that allocated the buffer, after the peer has returned ownership.
+ *
+ ****************************************************************************/
+
+void rptun_shmpool_free(FAR struct rptun_shmpool_s *pool, FAR void *buffer);
+
+/****************************************************************************
+ * Name: rptun_shmpool_handle
+ *
+ * Description:
+ *   Convert a buffer address to the handle sent to the peer.  The handle
+ *   is the byte offset of the buffer in the shared region and so is valid
+ *   on both cores regardless of how the region is mapped.
+ *
+ * Returned Value:
+ *   The handle on success; RPTUN_SHMPOOL_INVALID if the address does not
+ *   refer to a buffer of this pool.
+ *
+ ****************************************************************************/
+
+uint32_t rptun_shmpool_handle(FAR struct rptun_shmpool_s *pool,
+                              FAR void *buffer);
+
+/****************************************************************************
+ * Name: rptun_shmpool_buffer
+ *
+ * Description:
+ *   Convert a handle received from the peer back to a local buffer
+ *   address.
+ *
+ * Returned Value:
+ *   The buffer address on success; NULL if the handle does not refer to a
+ *   buffer of this pool.
+ *
+ ****************************************************************************/
+
+FAR void *rptun_shmpool_buffer(FAR struct rptun_shmpool_s *pool,
+                               uint32_t handle);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_RPTUN_SHMPOOL */
+#endif /* __INCLUDE_NUTTX_RPTUN_RPTUN_SHMPOOL_H */
@@ -106,7 +106,13 @@
 #define TCB_FLAG_SIGNAL_ACTION     (1 << 8)                      /* Bit 8: In a signal handler */
 #define TCB_FLAG_SYSCALL           (1 << 9)                      /* Bit 9: In a system call */
 #define TCB_FLAG_EXIT_PROCESSING   (1 << 10)                     /* Bit 10: Exitting */
-                                                                 /* Bits 11-15: Available */
+#define TCB_FLAG_SIGDELIVER        (1 << 11)                     /* Bit 11: Signal delivery is scheduled */
+#define TCB_FLAG_SEM_TRANSFER      (1 << 12)                     /* Bit 12: Semaphore wait was transferred */
+#define TCB_FLAG_SCHED_EDF         (1 << 13)                     /* Bit 13: Deadline scheduled.  The 2-bit
+                                                                  * policy field is full, so EDF is flagged
+                                                                  * separately; the policy field remains
+                                                                  * TCB_FLAG_SCHED_FIFO for an EDF thread */
+                                                                 /* Bits 14-15: Available */
 
 /* Values for struct task_group tg_flags */
 
@@ -303,6 +309,7 @@ struct sporadic_s
   uint8_t   nrepls;                 /* Number of active replenishments          */
   uint32_t  repl_period;            /* Sporadic replenishment period            */
   uint32_t  budget;                 /* Sporadic execution budget period         */
+  uint32_t  exhaustions;            /* Number of full budget exhaustions        */
   clock_t   eventtime;              /* Time thread suspended or [re-]started    */
 
   /* This is the last interval timer activated */
@@ -409,6 +416,10 @@ struct stackinfo_s
                                          /* Needed to deallocate stack          */
   FAR void *adj_stack_ptr;               /* Adjusted stack_alloc_ptr for HW     */
                                          /* The initial stack pointer value     */
+#ifdef CONFIG_STACK_WATERMARK
+  size_t    adj_stack_peak;              /* Peak stack usage observed at        */
+                                         /* context switches                    */
+#endif
 };
 
 /* struct exitinfo_s ************************************************************/
@@ -561,6 +572,11 @@ struct task_group_s
 
   size_t     tg_envsize;            /* Size of environment string allocation    */
   FAR char  *tg_envp;               /* Allocated environment strings            */
+#ifdef CONFIG_ENVIRON_HASH
+  FAR uint16_t *tg_envidx;          /* Hash index of offsets into tg_envp       */
+  uint16_t   tg_envislots;          /* Number of slots in tg_envidx             */
+  bool       tg_envdirty;           /* Index must be rebuilt before use         */
+#endif
 #endif
 
 #ifndef CONFIG_DISABLE_POSIX_TIMERS
@@ -652,6 +668,10 @@ struct tcb_s
   uint8_t  pend_reprios[CONFIG_SEM_NNESTPRIO];
 #endif
   uint8_t  base_priority;                /* "Normal" priority of the thread     */
+#if CONFIG_SEM_TCB_HOLDERS > 0
+  struct semholder_s holdpool[CONFIG_SEM_TCB_HOLDERS];
+                                         /* Embedded semaphore holder records   */
+#endif
 #endif
 
   uint8_t  task_state;                   /* Current state of the thread         */
@@ -676,6 +696,13 @@ struct tcb_s
 #ifdef CONFIG_SCHED_SPORADIC
   FAR struct sporadic_s *sporadic;       /* Sporadic scheduling parameters      */
 #endif
+#ifdef CONFIG_SCHED_EDF
+  clock_t  edf_runtime;                  /* Admitted worst-case job ticks       */
+  clock_t  edf_deadline;                 /* Relative deadline in ticks          */
+  clock_t  edf_period;                   /* Release period in ticks             */
+  clock_t  edf_absdeadline;              /* Absolute deadline of current job    */
+  uint32_t edf_overruns;                 /* Detected deadline overruns          */
+#endif
 
   struct wdog_s waitdog;                 /* All timed waits use this timer      */
 
@@ -688,6 +715,10 @@ struct tcb_s
                                          /* Needed to deallocate stack          */
   FAR void *adj_stack_ptr;               /* Adjusted stack_alloc_ptr for HW     */
                                          /* The initial stack pointer value     */
+#ifdef CONFIG_STACK_WATERMARK
+  size_t    stack_peak;                  /* Peak stack usage observed at        */
+                                         /* context switches                    */
+#endif
 
   /* External Module Support ****************************************************/
 
@@ -706,6 +737,9 @@ struct tcb_s
   sq_queue_t sigpendactionq;             /* List of pending signal actions      */
   sq_queue_t sigpostedq;                 /* List of posted signals              */
   siginfo_t  sigunbinfo;                 /* Signal info when task unblocked     */
+#ifdef CONFIG_SIG_PERTASK_SIGQ
+  FAR struct sigq_s *sigqslot;           /* Recycled pending action entry       */
+#endif
 
   /* POSIX Named Message Queue Fields *******************************************/
 
@@ -739,6 +773,20 @@ struct tcb_s
   uint32_t crit_max;                     /* Max time in critical section        */
 #endif
 
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+  uint32_t run_start;                    /* Time when thread last resumed       */
+  uint64_t run_time;                     /* Total time thread has executed      */
+#endif
+
+  /* Resource usage accounting **************************************************/
+
+#ifdef CONFIG_SCHED_RUSAGE
+  uint32_t nvcsw;                        /* Voluntary context switches          */
+  uint32_t nivcsw;                       /* Involuntary context switches        */
+  uint64_t rdbytes;                      /* Bytes read through the VFS          */
+  uint64_t wrbytes;                      /* Bytes written through the VFS       */
+#endif
+
   /* State save areas ***********************************************************/
 
   /* The form and content of these fields are platform-specific.                */
@@ -801,6 +849,11 @@ struct pthread_tcb_s
 
   pthread_addr_t arg;                    /* Startup argument                    */
   FAR void *joininfo;                    /* Detach-able info to support join    */
+#ifdef CONFIG_PTHREAD_CACHE
+  size_t stacksize;                      /* Requested stack size (non-zero
+                                          * only if the stack was allocated
+                                          * by up_create_stack())             */
+#endif
 };
 #endif /* !CONFIG_DISABLE_PTHREAD */
 
@@ -836,6 +889,42 @@ EXTERN uint32_t g_crit_max[1];
 #endif
 #endif /* CONFIG_SCHED_CRITMONITOR */
 
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+/* Total execution time accumulated on each CPU, in the same units as
+ * up_perf_gettime().  This is the denominator for all precise CPU load
+ * calculations.
+ */
+
+#ifdef CONFIG_SMP_NCPUS
+EXTERN uint64_t g_cpu_runtime[CONFIG_SMP_NCPUS];
+#else
+EXTERN uint64_t g_cpu_runtime[1];
+#endif
+#endif /* CONFIG_SCHED_CPULOAD_PRECISE */
+
+#ifdef CONFIG_SCHED_CSECTION_MONITOR
+/* Per-CPU counts of contended critical section entries and of spin
+ * iterations performed while waiting for the critical section spinlock.
+ * Each counter is written only by its own CPU.  The counts are reported
+ * via the procfs "csection" file.
+ */
+
+EXTERN volatile uint32_t g_cpu_csection_waits[CONFIG_SMP_NCPUS];
+EXTERN volatile uint32_t g_cpu_csection_spins[CONFIG_SMP_NCPUS];
+#endif
+
+#ifdef CONFIG_PTHREAD_CACHE
+/* State of the pthread TCB/stack cache:  The current number of cached
+ * TCB/stack pairs and the cumulative counts of pthread_create() calls that
+ * were satisfied from the cache (hits) and that fell back to the heap
+ * (misses).  Reported via the procfs "pthreadcache" file.
+ */
+
+EXTERN volatile uint16_t g_pthread_cache_count;
+EXTERN volatile uint32_t g_pthread_cache_hits;
+EXTERN volatile uint32_t g_pthread_cache_misses;
+#endif /* CONFIG_PTHREAD_CACHE */
+
 /********************************************************************************
  * Public Function Prototypes
  ********************************************************************************/
@@ -906,6 +995,39 @@ FAR struct tcb_s *nxsched_get_tcb(pid_t pid);
 
 int nxsched_release_tcb(FAR struct tcb_s *tcb, uint8_t ttype);
 
+/********************************************************************************
+ * Name:  nxsched_reap_tcb
+ *
+ * Description:
+ *   Queue a fully initialized, defunct TCB for deferred release on the
+ *   low-priority work queue.  This is the deferred-reaping alternative to
+ *   calling nxsched_release_tcb() from the exiting context.
+ *
+ ********************************************************************************/
+
+#ifdef CONFIG_SCHED_DEFERRED_REAP
+void nxsched_reap_tcb(FAR struct tcb_s *tcb);
+#endif
+
+/********************************************************************************
+ * Name: nxsched_benchmark
+ *
+ * Description:
+ *   Run the scheduler and allocator micro-benchmark suite and emit one
+ *   machine readable CSV line per benchmark on the console.  The suite
+ *   measures context switch, semaphore and message queue wakeup, timer
+ *   queue insertion, and allocator costs so that results may be diffed
+ *   across releases.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ********************************************************************************/
+
+#ifdef CONFIG_SCHED_BENCHMARK
+int nxsched_benchmark(void);
+#endif
+
 /* File system helpers **********************************************************/
 
 /* These functions all extract lists from the group structure associated with the
@@ -1372,6 +1494,29 @@ int nxsched_set_affinity(pid_t pid, size_t cpusetsize,
 
 int nxsched_get_stackinfo(pid_t pid, FAR struct stackinfo_s *stackinfo);
 
+/********************************************************************************
+ * Name: nxsched_get_rusage
+ *
+ * Description:
+ *   Report the resource usage counters accumulated for a thread.
+ *
+ * Input Parameters:
+ *   pid    - Identifies the thread to query.  Zero is interpreted as the
+ *            calling thread.
+ *   rusage - User-provided location to return the resource usage.
+ *
+ * Returned Value:
+ *   Zero (OK) if successful.  Otherwise, a negated errno value is returned.
+ *
+ *     -ESRCH  The task whose ID is pid could not be found.
+ *
+ ********************************************************************************/
+
+#ifdef CONFIG_SCHED_RUSAGE
+struct rusage;  /* Forward reference */
+int nxsched_get_rusage(pid_t pid, FAR struct rusage *rusage);
+#endif
+
 /********************************************************************************
  * Name: nx_wait/nx_waitid/nx_waitpid
  ********************************************************************************/
@@ -147,6 +147,14 @@ enum note_type_e
   NOTE_IRQ_ENTER       = 20,
   NOTE_IRQ_LEAVE       = 21
 #endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+  ,
+  NOTE_PROFILE         = 22
+#endif
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+  ,
+  NOTE_SEM_BLOCKED     = 23
+#endif
 };
 
 /* This structure provides the common header of each note */
@@ -318,6 +326,49 @@ struct note_irqhandler_s
 };
 #endif /* CONFIG_SCHED_INSTRUMENTATION_IRQHANDLER */
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+/* This is the specific form of the NOTE_PROFILE note.  It carries the
+ * program counter of the context that was interrupted by the system timer
+ * interrupt.  A statistical execution profile can be obtained by folding
+ * the sampled addresses against the symbol map of the image.
+ */
+
+struct note_profile_s
+{
+  struct note_common_s npf_cmn;      /* Common note parameters */
+  uint8_t npf_pc[sizeof(uintptr_t)]; /* Sampled program counter */
+};
+#endif /* CONFIG_SCHED_INSTRUMENTATION_PROFILE */
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+/* This is the specific form of the NOTE_SEM_BLOCKED note.  One note is
+ * emitted each time a semaphore wait actually blocks, carrying the address
+ * of the semaphore and the number of ticks that the waiter was blocked.
+ * The uncontended path emits nothing and costs nothing.  The semaphore
+ * addresses may be folded against the symbol map of the image on the host
+ * to identify the contended locks by name.
+ */
+
+struct note_semwait_s
+{
+  struct note_common_s nsw_cmn;       /* Common note parameters */
+  uint8_t nsw_sem[sizeof(uintptr_t)]; /* Address of the semaphore */
+  uint8_t nsw_ticks[4];               /* Blocked time in ticks */
+};
+
+/* One entry of the in-kernel contention summary maintained alongside the
+ * note stream and reported by the procfs semload file.
+ */
+
+struct note_semstat_s
+{
+  FAR void *sem;                      /* Semaphore address; NULL if unused */
+  uint32_t nblocked;                  /* Number of blocking waits */
+  uint32_t ticks;                     /* Total blocked ticks */
+  uint32_t maxticks;                  /* Longest single blocked wait */
+};
+#endif /* CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE */
+
 #ifdef CONFIG_SCHED_INSTRUMENTATION_FILTER
 
 /* This is the type of the argument passed to the NOTECTL_GETMODE and
@@ -439,6 +490,20 @@ void sched_note_irqhandler(int irq, FAR void *handler, bool enter);
 #  define sched_note_irqhandler(i,h,e)
 #endif
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+void sched_note_profile(FAR struct tcb_s *tcb, uintptr_t pc);
+#else
+#  define sched_note_profile(t,p)
+#endif
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+void sched_note_semwait(FAR struct tcb_s *tcb, FAR sem_t *sem,
+                        uint32_t ticks);
+int sched_note_semstats(int index, FAR struct note_semstat_s *stats);
+#else
+#  define sched_note_semwait(t,s,e)
+#endif
+
 #if defined(__KERNEL__) || defined(CONFIG_BUILD_FLAT)
 
 /****************************************************************************
@@ -561,6 +626,8 @@ void sched_note_filter_irq(struct note_filter_irq_s *oldf,
 #  define sched_note_syscall_enter(n,a...)
 #  define sched_note_syscall_leave(n,r)
 #  define sched_note_irqhandler(i,h,e)
+#  define sched_note_profile(t,p)
+#  define sched_note_semwait(t,s,e)
 
 #endif /* CONFIG_SCHED_INSTRUMENTATION */
 #endif /* __INCLUDE_NUTTX_SCHED_NOTE_H */
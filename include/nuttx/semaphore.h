@@ -123,6 +123,19 @@ extern "C"
 #define EXTERN extern
 #endif
 
+#ifdef CONFIG_SEM_BOOST_STATS
+/* Priority boost statistics, reported by the procfs "semboost" file */
+
+struct sem_boost_stats_s
+{
+  uint32_t nboosts;              /* Number of priority boosts applied */
+  uint32_t nchains;              /* Boosts propagated through a chain */
+  uint8_t maxdepth;              /* Deepest inheritance chain observed */
+};
+
+EXTERN struct sem_boost_stats_s g_sem_boost_stats;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
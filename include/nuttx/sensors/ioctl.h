@@ -283,4 +283,35 @@
 
 #define SNIOC_SET_BUFFER_SIZE      _SNIOC(0x0071)
 
+/* Command:      SNIOC_SET_WATERMARK
+ * Description:  Set the poll/read watermark of upper half driver.
+ * Argument:     This is the number of events pointer.
+ * Note:         Poll waiters are only notified and blocking reads only
+ *               complete once at least this many events are held in the
+ *               intermediate circular buffer, so that an application can
+ *               collect batches of samples with one wakeup instead of one
+ *               wakeup per sample.  The default watermark is one event.
+ *               If necessary, the intermediate circular buffer is grown to
+ *               hold the watermark.  The watermark has no effect on lower
+ *               halfs that provide the fetch interface.
+ */
+
+#define SNIOC_SET_WATERMARK        _SNIOC(0x0072)
+
+/* Command:      SNIOC_GET_SAMPLEPAGE
+ * Description:  Get the address of the shared latest-sample page.
+ * Argument:     A pointer of type FAR struct sensor_samplepage_s ** in
+ *               which to receive the address of the sample page.
+ * Note:         The sample page holds the most recent sensor event
+ *               published by the lower half and a sequence counter.  An
+ *               application may read it directly (see
+ *               sensor_samplepage_read()) without any system call, paying
+ *               for syscalls only when it reconfigures the sensor.  Only
+ *               available if CONFIG_SENSORS_SAMPLEPAGE is enabled and the
+ *               lower half reports data via push_event; -ENOTSUP is
+ *               returned otherwise.
+ */
+
+#define SNIOC_GET_SAMPLEPAGE       _SNIOC(0x0073)
+
 #endif /* __INCLUDE_NUTTX_SENSORS_IOCTL_H */
@@ -41,6 +41,7 @@
  ****************************************************************************/
 
 #include <nuttx/config.h>
+#include <nuttx/clock.h>
 #include <nuttx/fs/ioctl.h>
 
 #ifdef CONFIG_SENSORS_QENCODER
@@ -94,10 +95,63 @@
 #define QE_IMXRT_FIRST      (QE_FIRST + QE_NCMDS)
 #define QE_IMXRT_NCMDS      7
 
+/* Buffered snapshot commands.  These are numbered well above the block
+ * reserved for lower-half drivers so that the reservations above do not
+ * have to move:
+ *
+ * QEIOC_SNAPSHOT - Get the most recent position snapshot captured by the
+ *   lower half.  The snapshot is read lock-free; the calling thread is
+ *   never blocked and the capture interrupt is never disabled.
+ *   Argument: struct qe_snapshot_s pointer.
+ * QEIOC_SNAPGROUP - Get the most recent snapshots of all registered
+ *   encoders in a single call.
+ *   Argument: struct qe_snapgroup_s pointer.
+ */
+
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+#  define QEIOC_SNAPSHOT   _QEIOC(0x0080) /* Arg: struct qe_snapshot_s* */
+#  define QEIOC_SNAPGROUP  _QEIOC(0x0081) /* Arg: struct qe_snapgroup_s* */
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
 
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+/* This structure describes one buffered position snapshot.  All three
+ * fields are captured atomically with respect to the reader.
+ */
+
+struct qe_snapshot_s
+{
+  int32_t qs_position;  /* Position at the time of the last capture */
+  int32_t qs_velocity;  /* Position change since the previous capture */
+  clock_t qs_time;      /* System ticks at the time of the last capture */
+};
+
+/* The argument of the QEIOC_SNAPGROUP ioctl command.  On entry qg_count
+ * holds the size of the qg_snapshot[] array; on return it holds the number
+ * of snapshots actually returned.  Snapshots are returned in encoder
+ * registration order.
+ */
+
+struct qe_snapgroup_s
+{
+  uint8_t qg_count;                  /* In: capacity; Out: snapshots returned */
+  struct qe_snapshot_s qg_snapshot[1]; /* Actual dimension is qg_count */
+};
+
+#define SIZEOF_QE_SNAPGROUP_S(n) \
+  (sizeof(struct qe_snapgroup_s) + ((n) - 1) * sizeof(struct qe_snapshot_s))
+
+/* This is the type of the callback that the upper half installs into the
+ * lower half to receive position captures from the timer capture
+ * interrupt.
+ */
+
+typedef CODE void (*qe_capture_t)(FAR void *arg, int32_t position);
+#endif /* CONFIG_SENSORS_QENCODER_SNAPSHOT */
+
 /* This is the vtable that is used to by the upper half quadrature encoder
  * to call back into the lower half quadrature encoder.
  */
@@ -131,6 +185,18 @@ struct qe_ops_s
 
   CODE int (*ioctl)(FAR struct qe_lowerhalf_s *lower,
                     int cmd, unsigned long arg);
+
+#ifdef CONFIG_SENSORS_QENCODER_SNAPSHOT
+  /* Install (or, with a NULL callback, remove) the upper half capture
+   * callback.  The lower half should invoke the callback with the new
+   * position from the timer capture interrupt.  This method is optional;
+   * lower halves that do not provide it simply do not feed the snapshot
+   * buffer.
+   */
+
+  CODE int (*setposcb)(FAR struct qe_lowerhalf_s *lower,
+                       qe_capture_t callback, FAR void *arg);
+#endif
 };
 
 /* This is the interface between the lower half quadrature encoder driver
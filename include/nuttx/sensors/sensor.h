@@ -30,6 +30,8 @@
 #include <sys/types.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+#include <errno.h>
 #include <time.h>
 
 #include <nuttx/sensors/ioctl.h>
@@ -632,9 +634,32 @@ struct sensor_lowerhalf_s
   FAR void *priv;
 };
 
-/****************************************************************************
- * Public Function Prototypes
- ****************************************************************************/
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+/* This structure describes the shared latest-sample page that may be
+ * obtained with the SNIOC_GET_SAMPLEPAGE ioctl.  The upper half publishes
+ * every event pushed by the lower half into this page, bracketing the copy
+ * with increments of the sequence counter:  The counter is odd while an
+ * update is in progress and even when the page is consistent.  An
+ * application can then read the most recent sample without any system
+ * call by re-reading until it observes the same even sequence number
+ * before and after the copy (see sensor_samplepage_read() below).
+ */
+
+struct sensor_samplepage_s
+{
+  volatile uint32_t sp_sequence;   /* Odd while an update is in progress.
+                                    * Zero if no event has been published
+                                    * yet. */
+  uint32_t sp_esize;               /* The size of one sensor event */
+  uint8_t sp_data[1];              /* Latest sensor event.  Actually,
+                                    * sp_esize bytes in size. */
+};
+
+/* The size of one sample page for events of size 'esize' */
+
+#define SIZEOF_SENSOR_SAMPLEPAGE(esize) \
+  (sizeof(struct sensor_samplepage_s) + (esize) - 1)
+#endif
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -736,6 +761,54 @@ void sensor_unregister(FAR struct sensor_lowerhalf_s *dev, int devno);
 
 void sensor_custom_unregister(FAR struct sensor_lowerhalf_s *dev,
                               FAR const char *path);
+
+#ifdef CONFIG_SENSORS_SAMPLEPAGE
+/****************************************************************************
+ * Name: sensor_samplepage_read
+ *
+ * Description:
+ *   Copy the most recent sensor event out of a shared sample page that was
+ *   obtained with the SNIOC_GET_SAMPLEPAGE ioctl.  The copy is lock-free:
+ *   the reader simply retries until it observes the same even sequence
+ *   number before and after the copy.  No system call is performed.
+ *
+ * Input Parameters:
+ *   sp     - The sample page
+ *   buffer - Location in which to return the event.  Must be large enough
+ *            to hold sp->sp_esize bytes.
+ *
+ * Returned Value:
+ *   Zero (OK) if an event was returned; -EAGAIN if no event has been
+ *   published yet.
+ *
+ ****************************************************************************/
+
+static inline int
+sensor_samplepage_read(FAR const struct sensor_samplepage_s *sp,
+                       FAR void *buffer)
+{
+  uint32_t seq;
+
+  for (; ; )
+    {
+      seq = sp->sp_sequence;
+      if (seq == 0)
+        {
+          return -EAGAIN;
+        }
+
+      if ((seq & 1) == 0)
+        {
+          memcpy(buffer, (FAR const void *)sp->sp_data, sp->sp_esize);
+          if (sp->sp_sequence == seq)
+            {
+              return OK;
+            }
+        }
+    }
+}
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -536,6 +536,31 @@ int nxsig_usleep(useconds_t usec);
 int nxsig_notification(pid_t pid, FAR struct sigevent *event,
                        int code, FAR struct sigwork_s *work);
 
+/****************************************************************************
+ * Name: nxsig_notification_pending
+ *
+ * Description:
+ *   Check if a signal notification queued by a previous call to
+ *   nxsig_notification() with the same sigevent is still pending (i.e.,
+ *   queued but not yet delivered to or accepted by the client).  This may
+ *   be used to coalesce repeated notifications of the same event while an
+ *   earlier one has not yet been handled.
+ *
+ * Input Parameters:
+ *   pid   - The task/thread ID of the client thread that was signaled.
+ *   event - The instance of struct sigevent that describes how the client
+ *           was signaled.
+ *   code  - Source: SI_USER, SI_QUEUE, SI_TIMER, SI_ASYNCIO, or SI_MESGQ
+ *
+ * Returned Value:
+ *   true if a matching signal is still queued for the client; false
+ *   otherwise (including for non-signal notification methods).
+ *
+ ****************************************************************************/
+
+bool nxsig_notification_pending(pid_t pid, FAR struct sigevent *event,
+                                int code);
+
 /****************************************************************************
  * Name: nxsig_cancel_notification
  *
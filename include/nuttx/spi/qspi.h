@@ -200,6 +200,57 @@
   (((f) & (QSPIMEM_SCRAMBLE|QSPIMEM_RANDOM)) == \
           (QSPIMEM_SCRAMBLE|QSPIMEM_RANDOM))
 
+/****************************************************************************
+ * Name: QSPI_MEMMAP
+ *
+ * Description:
+ *   Map the FLASH device for memory-mapped read access.  The meminfo
+ *   describes the read transfer that the controller is to perform for
+ *   every bus access falling in the window:  cmd, addrlen, dummies, and
+ *   the QSPIMEM_* flags are used; buflen gives the size of the device in
+ *   bytes; addr and buffer are ignored.  On success, the base address of
+ *   the read window is returned.  The mapping remains in effect until
+ *   QSPI_UNMAP() is called; no command or memory transfers may be
+ *   performed while the device is mapped.
+ *
+ *   This method is optional.  It is available only if the QSPI controller
+ *   driver supports memory-mapped (XIP) access and CONFIG_QSPI_MEMMAP is
+ *   selected.
+ *
+ * Input Parameters:
+ *   dev     - Device-specific state data
+ *   meminfo - Describes the memory-mapped read access.
+ *   mbase   - Location to return the base address of the read window.
+ *
+ * Returned Value:
+ *   Zero (OK) on SUCCESS, a negated errno on value of failure
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_QSPI_MEMMAP
+#  define QSPI_MEMMAP(d,m,v) (d)->ops->memmap(d,m,v)
+#endif
+
+/****************************************************************************
+ * Name: QSPI_UNMAP
+ *
+ * Description:
+ *   Unmap the FLASH device, reverting to command-based accesses.  Must be
+ *   called before any command or memory transfer is performed after the
+ *   device has been mapped via QSPI_MEMMAP().
+ *
+ * Input Parameters:
+ *   dev - Device-specific state data
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_QSPI_MEMMAP
+#  define QSPI_UNMAP(d) (d)->ops->unmap(d)
+#endif
+
 /****************************************************************************
  * Name: QSPI_ALLOC
  *
@@ -290,6 +341,12 @@ struct qspi_ops_s
                     FAR struct qspi_cmdinfo_s *cmdinfo);
   CODE int       (*memory)(FAR struct qspi_dev_s *dev,
                     FAR struct qspi_meminfo_s *meminfo);
+#ifdef CONFIG_QSPI_MEMMAP
+  CODE int       (*memmap)(FAR struct qspi_dev_s *dev,
+                    FAR struct qspi_meminfo_s *meminfo,
+                    FAR const void **mbase);
+  CODE void      (*unmap)(FAR struct qspi_dev_s *dev);
+#endif
   CODE FAR void *(*alloc)(FAR struct qspi_dev_s *dev, size_t buflen);
   CODE void      (*free)(FAR struct qspi_dev_s *dev, FAR void *buffer);
 };
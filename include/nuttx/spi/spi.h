@@ -64,6 +64,9 @@
  *   output that selects between command and data.
  * CONFIG_SPI_HWFEATURES - Include an interface method to support special,
  *   hardware-specific SPI features.
+ * CONFIG_SPI_EXCHANGEV - Include an interface method to exchange a list of
+ *   data segments in one bus transaction.  Drivers with scatter-gather DMA
+ *   may map the segment list directly onto linked DMA descriptors.
  */
 
 /* Access macros ************************************************************/
@@ -409,6 +412,34 @@
 #  define SPI_EXCHANGE(d,t,r,l) ((d)->ops->exchange(d,t,r,l))
 #endif
 
+/****************************************************************************
+ * Name: SPI_EXCHANGEV
+ *
+ * Description:
+ *   Exchange a list of data segments on SPI in one bus transaction.  This
+ *   permits, for example, a command followed by a payload from a different
+ *   buffer to be sent without first concatenating the two into a bounce
+ *   buffer.  Drivers with scatter-gather DMA may map the segment list
+ *   directly onto linked DMA descriptors; for all other drivers the
+ *   segments are exchanged in sequence by the common fall-back logic.
+ *
+ * Input Parameters:
+ *   dev     - Device-specific state data
+ *   seglist - A list of data segments to exchange in order.  A segment
+ *             with a NULL txbuffer sends garbage; a segment with a NULL
+ *             rxbuffer discards the received data.
+ *   nseg    - The number of segments in the list
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SPI_EXCHANGEV
+#  define SPI_EXCHANGEV(d,s,n) \
+  (((d)->ops->exchangev) ? (d)->ops->exchangev(d,s,n) : spi_exchangev(d,s,n))
+#endif
+
 /****************************************************************************
  * Name: SPI_REGISTERCALLBACK
  *
@@ -549,6 +580,20 @@ enum spi_mode_e
 typedef uint8_t spi_hwfeatures_t;
 #endif
 
+#ifdef CONFIG_SPI_EXCHANGEV
+/* This structure describes one segment of a vectored exchange.  Either
+ * buffer pointer (but not both) may be NULL:  A NULL txbuffer sends
+ * garbage and a NULL rxbuffer discards the received data.
+ */
+
+struct spi_sgbuf_s
+{
+  FAR const void *txbuffer;  /* Source buffer of data to be sent */
+  FAR void *rxbuffer;        /* Sink buffer for received data */
+  size_t nwords;             /* Length of the segment in words */
+};
+#endif
+
 /* The SPI vtable */
 
 struct spi_dev_s;
@@ -579,6 +624,10 @@ struct spi_ops_s
   CODE void     (*exchange)(FAR struct spi_dev_s *dev,
                   FAR const void *txbuffer, FAR void *rxbuffer,
                   size_t nwords);
+#ifdef CONFIG_SPI_EXCHANGEV
+  CODE void     (*exchangev)(FAR struct spi_dev_s *dev,
+                  FAR const struct spi_sgbuf_s *seglist, size_t nseg);
+#endif
 #else
   CODE void     (*sndblock)(FAR struct spi_dev_s *dev,
                   FAR const void *buffer, size_t nwords);
@@ -611,6 +660,29 @@ extern "C"
 #define EXTERN extern
 #endif
 
+/****************************************************************************
+ * Name: spi_exchangev
+ *
+ * Description:
+ *   Exchange a list of data segments by performing one normal exchange
+ *   per segment.  This is the fall-back used by the SPI_EXCHANGEV macro
+ *   when the driver does not provide a native exchangev method.
+ *
+ * Input Parameters:
+ *   dev     - Device-specific state data
+ *   seglist - A list of data segments to exchange in order
+ *   nseg    - The number of segments in the list
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SPI_EXCHANGEV
+void spi_exchangev(FAR struct spi_dev_s *dev,
+                   FAR const struct spi_sgbuf_s *seglist, size_t nseg);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -80,6 +80,27 @@
 #  define SP_DSB()
 #endif
 
+/* Spin wait hints may also be provided in arch/spinlock.h
+ *
+ *   WFE - Wait for event.  Low-power wait in the spin loop until another
+ *         CPU signals an event (e.g. by releasing a spinlock).
+ *   SEV - Send event.  Signal the event that wakes CPUs waiting in WFE.
+ *
+ * On architectures that do not provide these, the spin loops simply poll.
+ */
+
+#if !defined(SP_WFE)
+#  define SP_WFE()
+#endif
+
+#if defined(SP_SEV) && !defined(__SP_UNLOCK_FUNCTION)
+#  define __SP_UNLOCK_FUNCTION 1
+#endif
+
+#if !defined(SP_SEV)
+#  define SP_SEV()
+#endif
+
 #if defined(CONFIG_SCHED_INSTRUMENTATION_SPINLOCKS) && !defined(__SP_UNLOCK_FUNCTION)
 #  define __SP_UNLOCK_FUNCTION 1
 #endif
@@ -343,4 +364,14 @@ void spin_clrbit(FAR volatile cpu_set_t *set, unsigned int cpu,
 #endif
 
 #endif /* CONFIG_SPINLOCK */
+
+/* The data memory barrier is also used by lock-free logic (such as the
+ * pid hash lookup) that is compiled even when spinlock support is not
+ * configured.  Fall back to a no-op in that case.
+ */
+
+#ifndef CONFIG_SPINLOCK
+#  define SP_DMB()
+#endif
+
 #endif /* __INCLUDE_NUTTX_SPINLOCK_H */
@@ -151,10 +151,32 @@ void ramlog_syslog_register(void);
  *
  ****************************************************************************/
 
-#ifdef CONFIG_RAMLOG_SYSLOG
+#if defined(CONFIG_RAMLOG_SYSLOG) || defined(CONFIG_SYSLOG_BOOT_REPLAY)
 int ramlog_putc(int ch);
 #endif
 
+/****************************************************************************
+ * Name: ramlog_drain
+ *
+ * Description:
+ *   Remove and return buffered characters from the syslog RAM log.  This
+ *   is used by the boot log replay logic to copy the RAM log content to
+ *   the final SYSLOG device once that device is ready.
+ *
+ * Input Parameters:
+ *   buffer - Location to return the drained characters
+ *   buflen - The maximum number of characters to drain
+ *
+ * Returned Value:
+ *   The number of characters returned in buffer.  Zero is returned when
+ *   the RAM log is empty.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_RAMLOG_SYSLOG) || defined(CONFIG_SYSLOG_BOOT_REPLAY)
+ssize_t ramlog_drain(FAR char *buffer, size_t buflen);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
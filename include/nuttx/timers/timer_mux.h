@@ -0,0 +1,191 @@
+/****************************************************************************
+ * include/nuttx/timers/timer_mux.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_TIMERS_TIMER_MUX_H
+#define __INCLUDE_NUTTX_TIMERS_TIMER_MUX_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#include <nuttx/compiler.h>
+#include <nuttx/timers/timer.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef CONFIG_TIMER_MUX
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This describes the callback function that will be invoked when a virtual
+ * timer channel expires.  The callback runs directly in the context of the
+ * hardware timer interrupt handler:  it must be brief and may use only
+ * interrupt-safe interfaces.
+ */
+
+typedef CODE void (*timer_mux_handler_t)(FAR void *arg);
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: timer_mux_initialize
+ *
+ * Description:
+ *   Bind a timer multiplexer to one hardware timer.  The multiplexer
+ *   schedules up to CONFIG_TIMER_MUX_NCHANNELS virtual timer callbacks
+ *   onto the single hardware timer by re-programming it for the nearest
+ *   pending deadline.  This is a strictly OS internal interface and may
+ *   NOT be used by application code.
+ *
+ * Input Parameters:
+ *   lower - An instance of the lower half timer driver.  The multiplexer
+ *     takes over the lower half callback; the lower half must not be
+ *     shared with any other user.
+ *
+ * Returned Value:
+ *   On success, a non-NULL handle is returned to the caller.  NULL is
+ *   returned on any failure.
+ *
+ ****************************************************************************/
+
+FAR void *timer_mux_initialize(FAR struct timer_lowerhalf_s *lower);
+
+/****************************************************************************
+ * Name: timer_mux_uninitialize
+ *
+ * Description:
+ *   Stop the hardware timer, release all virtual channels, and free the
+ *   multiplexer.  No channel handles obtained from the multiplexer may be
+ *   used after this call.
+ *
+ * Input Parameters:
+ *   handle - The handle that was returned by timer_mux_initialize()
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void timer_mux_uninitialize(FAR void *handle);
+
+/****************************************************************************
+ * Name: timer_mux_setup
+ *
+ * Description:
+ *   Allocate one virtual timer channel from the multiplexer and attach
+ *   its expiration callback.  The channel is created in the stopped state.
+ *
+ * Input Parameters:
+ *   handle  - The handle that was returned by timer_mux_initialize()
+ *   handler - The function to call when the channel expires.  The handler
+ *     runs in interrupt context.
+ *   arg     - An opaque argument that will accompany the callback.
+ *
+ * Returned Value:
+ *   On success, a non-NULL channel handle is returned.  NULL is returned
+ *   if all channels are in use.
+ *
+ ****************************************************************************/
+
+FAR void *timer_mux_setup(FAR void *handle, timer_mux_handler_t handler,
+                          FAR void *arg);
+
+/****************************************************************************
+ * Name: timer_mux_start
+ *
+ * Description:
+ *   Start (or re-start) a virtual timer channel.  If the new deadline is
+ *   nearer than the deadline that the hardware timer is currently
+ *   programmed for, then the hardware timer is re-programmed.  This
+ *   function may be called from the channel callback to re-arm the
+ *   channel.
+ *
+ * Input Parameters:
+ *   chan     - The channel handle that was returned by timer_mux_setup()
+ *   timeout  - Time until the channel expires, in microseconds.  Must be
+ *     greater than zero.
+ *   periodic - If true, the channel re-arms itself with the same timeout
+ *     each time that it expires.  If false, the channel expires once.
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned
+ *   on any failure.
+ *
+ ****************************************************************************/
+
+int timer_mux_start(FAR void *chan, uint32_t timeout, bool periodic);
+
+/****************************************************************************
+ * Name: timer_mux_stop
+ *
+ * Description:
+ *   Stop a virtual timer channel.  The channel remains allocated and may
+ *   be re-started with timer_mux_start().  If no channels remain active,
+ *   then the hardware timer is stopped.
+ *
+ * Input Parameters:
+ *   chan - The channel handle that was returned by timer_mux_setup()
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned
+ *   on any failure.
+ *
+ ****************************************************************************/
+
+int timer_mux_stop(FAR void *chan);
+
+/****************************************************************************
+ * Name: timer_mux_release
+ *
+ * Description:
+ *   Stop a virtual timer channel and return it to the pool of available
+ *   channels.  The channel handle may not be used after this call.
+ *
+ * Input Parameters:
+ *   chan - The channel handle that was returned by timer_mux_setup()
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void timer_mux_release(FAR void *chan);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_TIMER_MUX */
+#endif /* __INCLUDE_NUTTX_TIMERS_TIMER_MUX_H */
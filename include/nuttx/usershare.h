@@ -0,0 +1,153 @@
+/****************************************************************************
+ * include/nuttx/usershare.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_NUTTX_USERSHARE_H
+#define __INCLUDE_NUTTX_USERSHARE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef CONFIG_LIB_USERSHARE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Bits in the us_flags field.  The flags are set by the kernel when the
+ * structure is registered and report which fields the kernel maintains in
+ * this configuration.  User code must fall back to the normal system call
+ * whenever the corresponding flag is not set.
+ */
+
+#define USERSHARE_PID      (1 << 0) /* us_pid is maintained */
+#define USERSHARE_REALTIME (1 << 1) /* us_sec/us_nsec are maintained */
+
+/****************************************************************************
+ * Public Type Definitions
+ ****************************************************************************/
+
+/* This structure lies in user-space memory.  It is registered with the
+ * kernel once at startup; thereafter the kernel is the only writer and
+ * user code treats the structure as read-only.  User code can then obtain
+ * read-mostly values such as the PID of the running task or the current
+ * time of day without trapping into the kernel.
+ *
+ * Consistency of the multi-word time fields is assured with a sequence
+ * counter:  The kernel increments us_seq before and after each update so
+ * that the count is odd while an update is in progress.  Readers must
+ * re-read the fields if the count was odd or changed across the read.
+ */
+
+struct usershare_s
+{
+  volatile uint32_t us_seq;   /* Update sequence count */
+  volatile uint32_t us_flags; /* See USERSHARE_* definitions */
+  volatile pid_t    us_pid;   /* PID of the currently running task */
+  volatile time_t   us_sec;   /* CLOCK_REALTIME at the last timer tick */
+  volatile long     us_nsec;  /*   "      "     "   "   "    "     "   */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C"
+{
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: usershare_register
+ *
+ * Description:
+ *   Register the user-space shared information structure with the kernel.
+ *   This is a system call.  The kernel will begin updating the structure
+ *   fields indicated by us_flags.
+ *
+ * Input Parameters:
+ *   share - The address of the structure in user-space memory.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value is returned on failure.
+ *
+ ****************************************************************************/
+
+int usershare_register(FAR struct usershare_s *share);
+
+#ifndef __KERNEL__
+
+/* The single, user-space instance of the shared information structure and
+ * the one-time logic that registers it with the kernel (see
+ * libs/libc/misc/lib_usershare.c).
+ */
+
+EXTERN struct usershare_s g_usershare;
+
+void lib_usershare_initialize(void);
+
+#else
+
+/****************************************************************************
+ * Name: nxsched_usershare_tick
+ *
+ * Description:
+ *   Update the time-of-day fields of the registered user-space shared
+ *   information structure.  Called from the system timer processing logic
+ *   on each timer tick.
+ *
+ ****************************************************************************/
+
+void nxsched_usershare_tick(void);
+
+/****************************************************************************
+ * Name: nxsched_usershare_switch
+ *
+ * Description:
+ *   Update the PID field of the registered user-space shared information
+ *   structure.  Called when a new task is about to be resumed.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread to be restarted.
+ *
+ ****************************************************************************/
+
+struct tcb_s; /* Forward reference */
+void nxsched_usershare_switch(FAR struct tcb_s *tcb);
+
+#endif /* __KERNEL__ */
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CONFIG_LIB_USERSHARE */
+#endif /* __INCLUDE_NUTTX_USERSHARE_H */
@@ -165,6 +165,15 @@ extern "C"
 
 #define VIDIOC_CANCEL_DQBUF           _VIDIOC(0x0016)
 
+/* Query a driver-allocated buffer (see CONFIG_VIDEO_STREAM_BUFPOOL).
+ *  After ioctl(VIDIOC_REQBUFS) with memory = #V4L2_MEMORY_MMAP, the
+ *  application sets index, type and length; the driver allocates the
+ *  buffer from its DMA-capable pool and returns its address in m.userptr.
+ *  The returned buffer is then enqueued with ioctl(VIDIOC_QBUF) as usual.
+ */
+
+#define VIDIOC_QUERYBUF               _VIDIOC(0x0017)
+
 #define VIDEO_HSIZE_QVGA        (320)   /* QVGA    horizontal size */
 #define VIDEO_VSIZE_QVGA        (240)   /* QVGA    vertical   size */
 #define VIDEO_HSIZE_VGA         (640)   /* VGA     horizontal size */
@@ -247,7 +256,12 @@ enum v4l2_buf_type
   V4L2_BUF_TYPE_STILL_CAPTURE        = 0x81  /* single-planar still capture stream */
 };
 
-/* Memory I/O method. Currently, support only V4L2_MEMORY_USERPTR. */
+/* Memory I/O method. Currently, support V4L2_MEMORY_USERPTR and,
+ * with CONFIG_VIDEO_STREAM_BUFPOOL, V4L2_MEMORY_MMAP.  In the MMAP
+ * case there is no mapping on this flat address space:  The driver
+ * allocates the buffers from a DMA-capable pool and VIDIOC_QUERYBUF
+ * returns their addresses directly.
+ */
 
 enum v4l2_memory
 {
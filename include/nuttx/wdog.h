@@ -170,6 +170,27 @@ int wd_cancel(FAR struct wdog_s *wdog);
 
 int wd_gettime(FAR struct wdog_s *wdog);
 
+/****************************************************************************
+ * Name: wd_nextexpiry
+ *
+ * Description:
+ *   This function returns the time remaining before the next active
+ *   watchdog timer expires.  It may be used, for example, by an idle-time
+ *   power management governor to bound the wakeup latency of a sleep
+ *   state.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   The time in system ticks remaining until the next watchdog timer
+ *   expires.  Zero means that a watchdog expiration is already pending;
+ *   a negative value means that no watchdog timer is active.
+ *
+ ****************************************************************************/
+
+int wd_nextexpiry(void);
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -45,6 +45,7 @@
 
 #include <sys/types.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <queue.h>
 
 #include <nuttx/clock.h>
@@ -265,7 +266,24 @@ struct work_s
   FAR void *arg;         /* Callback argument */
   clock_t qtime;         /* Time work queued */
   clock_t delay;         /* Delay until work performed */
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+  bool batch;            /* True: Queued by work_queue_batch() */
+#endif
+};
+
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+/* Queue latency statistics returned by work_batch_stats().  Latencies are
+ * measured in clock ticks from the time that a batched entry was queued
+ * until the worker thread removed it for execution.
+ */
+
+struct work_latency_s
+{
+  uint32_t nitems;       /* Number of batched entries processed */
+  clock_t  total;        /* Sum of all entry latencies, in ticks */
+  clock_t  maximum;      /* Largest single entry latency, in ticks */
 };
+#endif
 
 /* This is an enumeration of the various events that may be
  * notified via work_notifier_signal().
@@ -368,6 +386,58 @@ int work_usrstart(void);
 int work_queue(int qid, FAR struct work_s *work, worker_t worker,
                FAR void *arg, clock_t delay);
 
+/****************************************************************************
+ * Name: work_queue_batch
+ *
+ * Description:
+ *   Queue batchable work to be performed at a later time.  Batched work is
+ *   coalesced:  The entry is not executed immediately, but is gathered with
+ *   other batched entries until either CONFIG_SCHED_WORKQUEUE_BATCH_COUNT
+ *   entries are pending or CONFIG_SCHED_WORKQUEUE_BATCH_DELAY ticks have
+ *   elapsed.  The worker thread then processes the whole batch in a single
+ *   wakeup.  This reduces wakeup and context switch overhead for driver
+ *   bottom halves that queue many small work items per second.
+ *
+ *   The work structure is managed exactly as for work_queue().
+ *
+ * Input Parameters:
+ *   qid    - The work queue ID
+ *   work   - The work structure to queue
+ *   worker - The worker callback to be invoked.  The callback will invoked
+ *            on the worker thread of execution.
+ *   arg    - The argument that will be passed to the worker callback when
+ *            it is invoked.
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+int work_queue_batch(int qid, FAR struct work_s *work, worker_t worker,
+                     FAR void *arg);
+#endif
+
+/****************************************************************************
+ * Name: work_batch_stats
+ *
+ * Description:
+ *   Return the accumulated queue latency statistics for batched work
+ *   entries on one work queue.
+ *
+ * Input Parameters:
+ *   qid   - The work queue ID
+ *   stats - Location to return the latency statistics
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+int work_batch_stats(int qid, FAR struct work_latency_s *stats);
+#endif
+
 /****************************************************************************
  * Name: work_cancel
  *
@@ -289,6 +289,9 @@ struct pthread_cond_s
 {
   sem_t sem;
   clockid_t clockid;
+#ifdef CONFIG_PTHREAD_WAITMORPH
+  FAR struct pthread_mutex_s *mutex;  /* Mutex associated by the waiters */
+#endif
 };
 
 #ifndef __PTHREAD_COND_T_DEFINED
@@ -296,7 +299,11 @@ typedef struct pthread_cond_s pthread_cond_t;
 #define __PTHREAD_COND_T_DEFINED 1
 #endif
 
+#ifdef CONFIG_PTHREAD_WAITMORPH
+#define PTHREAD_COND_INITIALIZER {SEM_INITIALIZER(0), CLOCK_REALTIME, NULL }
+#else
 #define PTHREAD_COND_INITIALIZER {SEM_INITIALIZER(0), CLOCK_REALTIME }
+#endif
 
 struct pthread_mutexattr_s
 {
@@ -41,6 +41,8 @@
  ****************************************************************************/
 
 #include <sys/types.h>
+#include <stddef.h>
+#include <assert.h>
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -127,53 +129,620 @@ struct dq_queue_s
 typedef struct dq_queue_s dq_queue_t;
 
 /****************************************************************************
- * Public Function Prototypes
+ * Inline Functions
  ****************************************************************************/
 
-#ifdef __cplusplus
-#define EXTERN extern "C"
-extern "C"
+/* These primitives are called from the hottest paths in the OS:  The
+ * scheduler ready-to-run and waiting lists, message queues, I/O buffer
+ * chains, and most driver event lists.  They are defined inline here so
+ * that every call site gets the few instructions of list manipulation
+ * directly, with no function call overhead.
+ */
+
+/****************************************************************************
+ * Name: sq_addfirst
+ *
+ * Description:
+ *   Place the 'node' at the head of the 'queue'
+ *
+ ****************************************************************************/
+
+static inline void sq_addfirst(FAR sq_entry_t *node, FAR sq_queue_t *queue)
+{
+  node->flink = queue->head;
+  if (!queue->head)
+    {
+      queue->tail = node;
+    }
+
+  queue->head = node;
+}
+
+/****************************************************************************
+ * Name: dq_addfirst
+ *
+ * Description:
+ *   Place the 'node' at the head of the 'queue'
+ *
+ ****************************************************************************/
+
+static inline void dq_addfirst(FAR dq_entry_t *node, FAR dq_queue_t *queue)
+{
+  node->blink = NULL;
+  node->flink = queue->head;
+
+  if (!queue->head)
+    {
+      queue->head = node;
+      queue->tail = node;
+    }
+  else
+    {
+      queue->head->blink = node;
+      queue->head = node;
+    }
+}
+
+/****************************************************************************
+ * Name: sq_addlast
+ *
+ * Description:
+ *   Place the 'node' at the tail of the 'queue'
+ *
+ ****************************************************************************/
+
+static inline void sq_addlast(FAR sq_entry_t *node, FAR sq_queue_t *queue)
+{
+  node->flink = NULL;
+  if (!queue->head)
+    {
+      queue->head = node;
+      queue->tail = node;
+    }
+  else
+    {
+      queue->tail->flink = node;
+      queue->tail        = node;
+    }
+}
+
+/****************************************************************************
+ * Name: dq_addlast
+ *
+ * Description:
+ *   Place the 'node' at the tail of the 'queue'
+ *
+ ****************************************************************************/
+
+static inline void dq_addlast(FAR dq_entry_t *node, FAR dq_queue_t *queue)
+{
+  node->flink = NULL;
+  node->blink = queue->tail;
+
+  if (!queue->head)
+    {
+      queue->head = node;
+      queue->tail = node;
+    }
+  else
+    {
+      queue->tail->flink = node;
+      queue->tail        = node;
+    }
+}
+
+/****************************************************************************
+ * Name: sq_addafter
+ *
+ * Description:
+ *   Add 'node' after 'prev' in the 'queue.'
+ *
+ ****************************************************************************/
+
+static inline void sq_addafter(FAR sq_entry_t *prev, FAR sq_entry_t *node,
+                               FAR sq_queue_t *queue)
+{
+  if (!queue->head || prev == queue->tail)
+    {
+      sq_addlast(node, queue);
+    }
+  else
+    {
+      node->flink = prev->flink;
+      prev->flink = node;
+    }
+}
+
+/****************************************************************************
+ * Name: dq_addafter
+ *
+ * Description:
+ *   Add 'node' after 'prev' in the 'queue.'
+ *
+ ****************************************************************************/
+
+static inline void dq_addafter(FAR dq_entry_t *prev, FAR dq_entry_t *node,
+                               FAR dq_queue_t *queue)
+{
+  if (!queue->head || prev == queue->tail)
+    {
+      dq_addlast(node, queue);
+    }
+  else
+    {
+      FAR dq_entry_t *next = prev->flink;
+      node->blink = prev;
+      node->flink = next;
+      next->blink = node;
+      prev->flink = node;
+    }
+}
+
+/****************************************************************************
+ * Name: dq_addbefore
+ *
+ * Description:
+ *   Add 'node' before 'next' in the 'queue'
+ *
+ ****************************************************************************/
+
+static inline void dq_addbefore(FAR dq_entry_t *next, FAR dq_entry_t *node,
+                                FAR dq_queue_t *queue)
+{
+  if (!queue->head || next == queue->head)
+    {
+      dq_addfirst(node, queue);
+    }
+  else
+    {
+      FAR dq_entry_t *prev = next->blink;
+      node->flink = next;
+      node->blink = prev;
+      prev->flink = node;
+      next->blink = node;
+    }
+}
+
+/****************************************************************************
+ * Name: sq_cat
+ *
+ * Description:
+ *   Move the content of queue1 to the end of queue2.
+ *
+ * Input Parameters:
+ *   queue1 - The queue to be appended to queue2.  Will be empty on return.
+ *   queue2 - The queue to contain the content of both queues on return.
+ *
+ ****************************************************************************/
+
+static inline void sq_cat(FAR sq_queue_t *queue1, FAR sq_queue_t *queue2)
+{
+  DEBUGASSERT(queue1 != NULL && queue2 != NULL);
+
+  /* If queue2 is empty, then just move queue1 to queue2 */
+
+  if (sq_empty(queue2))
+    {
+      sq_move(queue1, queue2);
+    }
+
+  /* Do nothing if queue1 is empty */
+
+  else if (!sq_empty(queue1))
+    {
+      /* Attach the head of queue1 to the final entry of queue2 */
+
+      queue2->tail->flink = queue1->head;
+
+      /* The tail of queue1 is the new tail of queue2 */
+
+      queue2->tail = queue1->tail;
+      sq_init(queue1);
+    }
+}
+
+/****************************************************************************
+ * Name: dq_cat
+ *
+ * Description:
+ *   Move the content of queue1 to the end of queue2.
+ *
+ * Input Parameters:
+ *   queue1 - The queue to be appended to queue2.  Will be empty on return.
+ *   queue2 - The queue to contain the content of both queues on return.
+ *
+ ****************************************************************************/
+
+static inline void dq_cat(FAR dq_queue_t *queue1, FAR dq_queue_t *queue2)
+{
+  DEBUGASSERT(queue1 != NULL && queue2 != NULL);
+
+  /* If queue2 is empty, then just move queue1 to queue2 */
+
+  if (dq_empty(queue2))
+    {
+      dq_move(queue1, queue2);
+    }
+
+  /* Do nothing if queue1 is empty */
+
+  else if (!dq_empty(queue1))
+    {
+      /* Attach the head of queue1 to the final entry of queue2 */
+
+      queue2->tail->flink = queue1->head;
+      queue1->head->blink = queue2->tail;
+
+      /* The tail of queue1 is the new tail of queue2 */
+
+      queue2->tail = queue1->tail;
+      dq_init(queue1);
+    }
+}
+
+/****************************************************************************
+ * Name: sq_splice
+ *
+ * Description:
+ *   Append the detached chain of entries 'first' through 'last' to the
+ *   tail of the 'queue' in a single O(1) operation.  The chain must
+ *   already be internally linked via the flink pointers and must not be a
+ *   member of any queue.
+ *
+ ****************************************************************************/
+
+static inline void sq_splice(FAR sq_entry_t *first, FAR sq_entry_t *last,
+                             FAR sq_queue_t *queue)
+{
+  DEBUGASSERT(first != NULL && last != NULL);
+
+  last->flink = NULL;
+  if (!queue->head)
+    {
+      queue->head = first;
+    }
+  else
+    {
+      queue->tail->flink = first;
+    }
+
+  queue->tail = last;
+}
+
+/****************************************************************************
+ * Name: dq_splicebefore
+ *
+ * Description:
+ *   Insert the detached chain of entries 'first' through 'last' before
+ *   'next' in the 'queue' in a single O(1) operation.  The chain must
+ *   already be internally linked via the flink/blink pointers and must not
+ *   be a member of any queue.  If 'next' is NULL, the chain is appended at
+ *   the tail of the queue.
+ *
+ ****************************************************************************/
+
+static inline void dq_splicebefore(FAR dq_entry_t *next,
+                                   FAR dq_entry_t *first,
+                                   FAR dq_entry_t *last,
+                                   FAR dq_queue_t *queue)
+{
+  DEBUGASSERT(first != NULL && last != NULL);
+
+  if (next == NULL)
+    {
+      /* Append the chain at the tail of the queue */
+
+      first->blink = queue->tail;
+      last->flink  = NULL;
+
+      if (!queue->head)
+        {
+          queue->head = first;
+        }
+      else
+        {
+          queue->tail->flink = first;
+        }
+
+      queue->tail = last;
+    }
+  else
+    {
+      FAR dq_entry_t *prev = next->blink;
+
+      first->blink = prev;
+      last->flink  = next;
+      next->blink  = last;
+
+      if (!prev)
+        {
+          queue->head = first;
+        }
+      else
+        {
+          prev->flink = first;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: sq_remafter
+ *
+ * Description:
+ *   Remove the entry following 'node' from the 'queue'
+ *
+ * Returned Value:
+ *   A reference to the removed entry
+ *
+ ****************************************************************************/
+
+static inline FAR sq_entry_t *sq_remafter(FAR sq_entry_t *node,
+                                          FAR sq_queue_t *queue)
+{
+  FAR sq_entry_t *ret = node->flink;
+
+  if (queue->head && ret)
+    {
+      if (queue->tail == ret)
+        {
+          queue->tail = node;
+          node->flink = NULL;
+        }
+      else
+        {
+          node->flink = ret->flink;
+        }
+
+      ret->flink = NULL;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: sq_rem
+ *
+ * Description:
+ *   Remove a 'node' from a 'queue'
+ *
+ ****************************************************************************/
+
+static inline void sq_rem(FAR sq_entry_t *node, FAR sq_queue_t *queue)
+{
+  if (queue->head && node)
+    {
+      if (node == queue->head)
+        {
+          queue->head = node->flink;
+          if (node == queue->tail)
+            {
+              queue->tail = NULL;
+            }
+        }
+      else
+        {
+          FAR sq_entry_t *prev;
+
+          for (prev = (FAR sq_entry_t *)queue->head;
+               prev && prev->flink != node;
+               prev = prev->flink);
+
+          if (prev)
+            {
+              sq_remafter(prev, queue);
+            }
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: dq_rem
+ *
+ * Description:
+ *   Remove the 'node' from the 'queue'
+ *
+ ****************************************************************************/
+
+static inline void dq_rem(FAR dq_entry_t *node, FAR dq_queue_t *queue)
+{
+  FAR dq_entry_t *prev = node->blink;
+  FAR dq_entry_t *next = node->flink;
+
+  if (!prev)
+    {
+      queue->head = next;
+    }
+  else
+    {
+      prev->flink = next;
+    }
+
+  if (!next)
+    {
+      queue->tail = prev;
+    }
+  else
+    {
+      next->blink = prev;
+    }
+
+  node->flink = NULL;
+  node->blink = NULL;
+}
+
+/****************************************************************************
+ * Name: sq_remlast
+ *
+ * Description:
+ *   Removes the last entry in a singly-linked queue.
+ *
+ ****************************************************************************/
+
+static inline FAR sq_entry_t *sq_remlast(FAR sq_queue_t *queue)
+{
+  FAR sq_entry_t *ret = queue->tail;
+
+  if (ret)
+    {
+      if (queue->head == queue->tail)
+        {
+          queue->head = NULL;
+          queue->tail = NULL;
+        }
+      else
+        {
+          FAR sq_entry_t *prev;
+          for (prev = queue->head;
+              prev && prev->flink != ret;
+              prev = prev->flink);
+
+          if (prev)
+            {
+              prev->flink = NULL;
+              queue->tail = prev;
+            }
+        }
+
+      ret->flink = NULL;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: dq_remlast
+ *
+ * Description:
+ *   Removes the last entry in a doubly-linked queue.
+ *
+ ****************************************************************************/
+
+static inline FAR dq_entry_t *dq_remlast(FAR dq_queue_t *queue)
 {
-#else
-#define EXTERN extern
-#endif
+  FAR dq_entry_t *ret = queue->tail;
 
-/* Add nodes to queues */
+  if (ret)
+    {
+      FAR dq_entry_t *prev = ret->blink;
+      if (!prev)
+        {
+          queue->head = NULL;
+          queue->tail = NULL;
+        }
+      else
+        {
+          queue->tail = prev;
+          prev->flink = NULL;
+        }
 
-void sq_addfirst(FAR sq_entry_t *node, FAR sq_queue_t *queue);
-void dq_addfirst(FAR dq_entry_t *node, FAR dq_queue_t *queue);
-void sq_addlast(FAR sq_entry_t *node, FAR sq_queue_t *queue);
-void dq_addlast(FAR dq_entry_t *node, FAR dq_queue_t *queue);
-void sq_addafter(FAR sq_entry_t *prev, FAR sq_entry_t *node,
-                 FAR sq_queue_t *queue);
-void dq_addafter(FAR dq_entry_t *prev, FAR dq_entry_t *node,
-                 FAR dq_queue_t *queue);
-void dq_addbefore(FAR dq_entry_t *next, FAR dq_entry_t *node,
-                  FAR dq_queue_t *queue);
+      ret->flink = NULL;
+      ret->blink = NULL;
+    }
 
-/* Combine queues */
+  return ret;
+}
 
-void sq_cat(FAR sq_queue_t *queue1, FAR sq_queue_t *queue2);
-void dq_cat(FAR dq_queue_t *queue1, FAR dq_queue_t *queue2);
+/****************************************************************************
+ * Name: sq_remfirst
+ *
+ * Description:
+ *   Removes the first entry in a singly-linked queue.
+ *
+ ****************************************************************************/
+
+static inline FAR sq_entry_t *sq_remfirst(FAR sq_queue_t *queue)
+{
+  FAR sq_entry_t *ret = queue->head;
 
-/* Remove nodes from queues */
+  if (ret)
+    {
+      queue->head = ret->flink;
+      if (!queue->head)
+        {
+          queue->tail = NULL;
+        }
 
-FAR  sq_entry_t *sq_remafter(FAR sq_entry_t *node, FAR sq_queue_t *queue);
-void sq_rem(FAR sq_entry_t *node, FAR sq_queue_t *queue);
-void dq_rem(FAR dq_entry_t *node, FAR dq_queue_t *queue);
-FAR  sq_entry_t *sq_remlast(FAR sq_queue_t *queue);
-FAR  dq_entry_t *dq_remlast(FAR dq_queue_t *queue);
-FAR  sq_entry_t *sq_remfirst(FAR sq_queue_t *queue);
-FAR  dq_entry_t *dq_remfirst(FAR dq_queue_t *queue);
+      ret->flink = NULL;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: dq_remfirst
+ *
+ * Description:
+ *   Removes the first entry in a doubly-linked queue.
+ *
+ ****************************************************************************/
+
+static inline FAR dq_entry_t *dq_remfirst(FAR dq_queue_t *queue)
+{
+  FAR dq_entry_t *ret = queue->head;
+
+  if (ret)
+    {
+      FAR dq_entry_t *next = ret->flink;
+      if (!next)
+        {
+          queue->head = NULL;
+          queue->tail = NULL;
+        }
+      else
+        {
+          queue->head = next;
+          next->blink = NULL;
+        }
+
+      ret->flink = NULL;
+      ret->blink = NULL;
+    }
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: sq_count
+ *
+ * Description:
+ *   Return the number of nodes in the queue.
+ *
+ ****************************************************************************/
+
+static inline size_t sq_count(FAR sq_queue_t *queue)
+{
+  FAR sq_entry_t *node;
+  size_t count;
+
+  DEBUGASSERT(queue != NULL);
+
+  for (node = queue->head, count = 0;
+       node != NULL;
+       node = node->flink, count++);
+
+  return count;
+}
+
+/****************************************************************************
+ * Name: dq_count
+ *
+ * Description:
+ *   Return the number of nodes in the queue.
+ *
+ ****************************************************************************/
+
+static inline size_t dq_count(FAR dq_queue_t *queue)
+{
+  FAR dq_entry_t *node;
+  size_t count;
 
-/* Count nodes in queues */
+  DEBUGASSERT(queue != NULL);
 
-size_t sq_count(FAR sq_queue_t *queue);
-size_t dq_count(FAR dq_queue_t *queue);
+  for (node = queue->head, count = 0;
+       node != NULL;
+       node = node->flink, count++);
 
-#undef EXTERN
-#ifdef __cplusplus
+  return count;
 }
-#endif
 
 #endif /* __INCLUDE_QUEUE_H_ */
@@ -46,6 +46,8 @@
 #define SCHED_RR                  2  /* Round robin scheduling policy */
 #define SCHED_SPORADIC            3  /* Sporadic scheduling policy */
 #define SCHED_OTHER               4  /* Not supported */
+#define SCHED_EDF                 5  /* Earliest deadline first scheduling
+                                      * policy (non-standard) */
 
 /* Maximum number of SCHED_SPORADIC replenishments */
 
@@ -197,6 +199,14 @@ struct sched_param
   int sched_ss_max_repl;                /* Maximum pending replenishments for
                                          * sporadic server. */
 #endif
+
+#ifdef CONFIG_SCHED_EDF
+  struct timespec sched_edf_runtime;    /* Worst-case execution time of one
+                                         * job.  Used only for the admission
+                                         * test; the budget is not enforced */
+  struct timespec sched_edf_deadline;   /* Relative deadline of each job */
+  struct timespec sched_edf_period;     /* Release period of the task */
+#endif
 };
 
 /********************************************************************************
@@ -69,14 +69,19 @@
 struct tcb_s; /* Forward reference */
 struct semholder_s
 {
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#if CONFIG_SEM_PREALLOCHOLDERS > 0 || CONFIG_SEM_TCB_HOLDERS > 0
   struct semholder_s *flink;     /* Implements singly linked list */
+#endif
+#if CONFIG_SEM_TCB_HOLDERS > 0
+  FAR struct sem_s *sem;         /* Semaphore on which counts are held */
 #endif
   FAR struct tcb_s *htcb;        /* Holder TCB */
   int16_t counts;                /* Number of counts owned by this holder */
 };
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#if CONFIG_SEM_TCB_HOLDERS > 0
+#  define SEMHOLDER_INITIALIZER {NULL, NULL, NULL, 0}
+#elif CONFIG_SEM_PREALLOCHOLDERS > 0
 #  define SEMHOLDER_INITIALIZER {NULL, NULL, 0}
 #else
 #  define SEMHOLDER_INITIALIZER {NULL, 0}
@@ -96,7 +101,7 @@ struct sem_s
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
   uint8_t flags;                 /* See PRIOINHERIT_FLAGS_* definitions */
-# if CONFIG_SEM_PREALLOCHOLDERS > 0
+# if CONFIG_SEM_PREALLOCHOLDERS > 0 || CONFIG_SEM_TCB_HOLDERS > 0
   FAR struct semholder_s *hhead; /* List of holders of semaphore counts */
 # else
   struct semholder_s holder[2];  /* Slot for old and new holder */
@@ -109,7 +114,7 @@ typedef struct sem_s sem_t;
 /* Initializers */
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
-# if CONFIG_SEM_PREALLOCHOLDERS > 0
+# if CONFIG_SEM_PREALLOCHOLDERS > 0 || CONFIG_SEM_TCB_HOLDERS > 0
 #  define SEM_INITIALIZER(c) \
     {(c), 0, NULL}               /* semcount, flags, hhead */
 # else
@@ -103,12 +103,21 @@ struct rlimit
   rlim_t rlim_max;          /* The hard limit */
 };
 
-/* Minimal, compliant rusage structure */
+/* Minimal, compliant rusage structure.  NuttX does not distinguish user
+ * from system time:  the total thread runtime is reported in ru_utime and
+ * ru_stime is always zero.  NuttX has no notion of a block I/O count;
+ * ru_inblock and ru_oublock instead report the number of BYTES moved
+ * through the VFS read and write paths.
+ */
 
 struct rusage
 {
   struct timeval ru_utime;  /* User time used */
   struct timeval ru_stime;  /* System time used */
+  long ru_inblock;          /* Bytes read through the VFS */
+  long ru_oublock;          /* Bytes written through the VFS */
+  long ru_nvcsw;            /* Voluntary context switches */
+  long ru_nivcsw;           /* Involuntary context switches */
 };
 
 /****************************************************************************
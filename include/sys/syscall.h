@@ -95,7 +95,8 @@ EXTERN const uintptr_t g_stublookup[SYS_nsyscalls];
 
 #endif
 
-#ifdef CONFIG_SCHED_INSTRUMENTATION_SYSCALL
+#if defined(CONFIG_SCHED_INSTRUMENTATION_SYSCALL) || \
+    defined(CONFIG_SYSCALL_PERF)
 
 /* Given the system call number, the corresponding entry in this table
  * provides the name of the function.
@@ -105,6 +106,28 @@ EXTERN const char *g_funcnames[SYS_nsyscalls];
 
 #endif
 
+#ifdef CONFIG_SYSCALL_PERF
+
+/* Given the system call number, the corresponding entry in this table
+ * provides the number of times that the system call was dispatched and
+ * the time accumulated in its stub.  The time is expressed in the same
+ * unknown, monotonic units returned by up_perf_gettime().  The counters
+ * are updated without locking and so are statistical in nature; they may
+ * be reset at any time by zeroing the entry.
+ *
+ * This table is only available during the kernel phase of a kernel build.
+ */
+
+struct syscall_perf_s
+{
+  uint32_t count;               /* Number of times dispatched */
+  uint32_t time;                /* Accumulated stub execution time */
+};
+
+EXTERN struct syscall_perf_s g_syscall_perf[SYS_nsyscalls];
+
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
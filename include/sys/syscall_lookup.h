@@ -39,6 +39,10 @@ SYSCALL_LOOKUP(sched_unlock,               0)
 SYSCALL_LOOKUP(sched_yield,                0)
 SYSCALL_LOOKUP(nxsched_get_stackinfo,      2)
 
+#ifdef CONFIG_SCHED_RUSAGE
+  SYSCALL_LOOKUP(nxsched_get_rusage,       2)
+#endif
+
 #ifdef CONFIG_SMP
   SYSCALL_LOOKUP(sched_getaffinity,        3)
   SYSCALL_LOOKUP(sched_getcpu,             0)
@@ -48,6 +52,10 @@ SYSCALL_LOOKUP(nxsched_get_stackinfo,      2)
 SYSCALL_LOOKUP(gethostname,                2)
 SYSCALL_LOOKUP(sethostname,                2)
 
+#ifdef CONFIG_LIB_USERSHARE
+  SYSCALL_LOOKUP(usershare_register,       1)
+#endif
+
 /* User identity */
 
 #ifdef CONFIG_SCHED_USER_IDENTITY
@@ -198,6 +206,8 @@ SYSCALL_LOOKUP(read,                       3)
 SYSCALL_LOOKUP(write,                      3)
 SYSCALL_LOOKUP(pread,                      4)
 SYSCALL_LOOKUP(pwrite,                     4)
+SYSCALL_LOOKUP(readv,                      3)
+SYSCALL_LOOKUP(writev,                     3)
 #ifdef CONFIG_FS_AIO
   SYSCALL_LOOKUP(aio_read,                 1)
   SYSCALL_LOOKUP(aio_write,                1)
@@ -48,6 +48,8 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <queue.h>
+
 #include <nuttx/audio/audio.h>
 #include <nuttx/usb/audio.h>
 
@@ -55,6 +57,20 @@
 
 #if defined(CONFIG_AUDIO)
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_BUFFER_POOL
+/* The pool of preallocated audio pipeline buffers.  The pool is populated
+ * lazily when the first buffer is allocated.
+ */
+
+static dq_queue_t g_apb_free_pool;
+static bool       g_apb_pool_ready;
+static sem_t      g_apb_poolsem = SEM_INITIALIZER(1);
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -89,6 +105,67 @@ static void apb_semtake(FAR struct ap_buffer_s *apb)
 
 #define apb_semgive(b) _SEM_POST(&b->sem)
 
+/****************************************************************************
+ * Name: apb_pool_lock
+ *
+ *       Get exclusive access to the preallocated buffer pool.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_BUFFER_POOL
+static void apb_pool_lock(void)
+{
+  int ret;
+
+  /* Take the semaphore (perhaps waiting) */
+
+  while (_SEM_WAIT(&g_apb_poolsem) < 0)
+    {
+      /* The only case that an error should occr here is if
+       * the wait was awakened by a signal.
+       */
+
+      DEBUGASSERT(_SEM_ERRNO(ret) == EINTR || _SEM_ERRNO(ret) == ECANCELED);
+      UNUSED(ret);
+    }
+}
+
+#define apb_pool_unlock() _SEM_POST(&g_apb_poolsem)
+#endif
+
+/****************************************************************************
+ * Name: apb_pool_initialize
+ *
+ * Populate the free pool with CONFIG_AUDIO_BUFFER_POOL_PREALLOC buffers,
+ * each large enough to hold CONFIG_AUDIO_BUFFER_NUMBYTES of audio data.
+ * Called with the pool locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_AUDIO_BUFFER_POOL
+static void apb_pool_initialize(void)
+{
+  FAR struct ap_buffer_s *apb;
+  int i;
+
+  for (i = 0; i < CONFIG_AUDIO_BUFFER_POOL_PREALLOC; i++)
+    {
+      apb = lib_umalloc(sizeof(struct ap_buffer_s) +
+                        CONFIG_AUDIO_BUFFER_NUMBYTES);
+      if (apb == NULL)
+        {
+          /* A partially populated pool is still usable */
+
+          break;
+        }
+
+      dq_addlast(&apb->dq_entry, &g_apb_free_pool);
+    }
+
+  g_apb_pool_ready = true;
+}
+#endif
+
 /****************************************************************************
  * Name: apb_alloc
  *
@@ -103,13 +180,44 @@ int apb_alloc(FAR struct audio_buf_desc_s *bufdesc)
   uint32_t            bufsize;
   int                 ret;
   struct ap_buffer_s  *apb;
+#ifdef CONFIG_AUDIO_BUFFER_POOL
+  uint16_t            flags = 0;
+#endif
 
   DEBUGASSERT(bufdesc->u.pbuffer != NULL);
 
-  /* Perform a user mode allocation */
+#ifdef CONFIG_AUDIO_BUFFER_POOL
+  /* Try to take a buffer from the preallocated pool.  Requests larger than
+   * the pool buffer size fall back to the allocator.
+   */
+
+  apb = NULL;
+  if (bufdesc->numbytes <= CONFIG_AUDIO_BUFFER_NUMBYTES)
+    {
+      apb_pool_lock();
+      if (!g_apb_pool_ready)
+        {
+          apb_pool_initialize();
+        }
+
+      apb = (FAR struct ap_buffer_s *)dq_remfirst(&g_apb_free_pool);
+      apb_pool_unlock();
+    }
+
+  if (apb != NULL)
+    {
+      bufsize = sizeof(struct ap_buffer_s) + CONFIG_AUDIO_BUFFER_NUMBYTES;
+      flags   = AUDIO_APB_POOLED;
+    }
+  else
+#endif
+    {
+      /* Perform a user mode allocation */
+
+      bufsize = sizeof(struct ap_buffer_s) + bufdesc->numbytes;
+      apb = lib_umalloc(bufsize);
+    }
 
-  bufsize = sizeof(struct ap_buffer_s) + bufdesc->numbytes;
-  apb = lib_umalloc(bufsize);
   *bufdesc->u.pbuffer = apb;
 
   /* Test if the allocation was successful or not */
@@ -127,7 +235,11 @@ int apb_alloc(FAR struct audio_buf_desc_s *bufdesc)
       apb->crefs      = 1;
       apb->nmaxbytes  = bufdesc->numbytes;
       apb->nbytes     = 0;
+#ifdef CONFIG_AUDIO_BUFFER_POOL
+      apb->flags      = flags;
+#else
       apb->flags      = 0;
+#endif
       apb->samp       = (FAR uint8_t *)(apb + 1);
 #ifdef CONFIG_AUDIO_MULTI_SESSION
       apb->session    = bufdesc->session;
@@ -161,7 +273,21 @@ void apb_free(FAR struct ap_buffer_s *apb)
     {
       audinfo("Freeing %p\n", apb);
       _SEM_DESTROY(&apb->sem);
-      lib_ufree(apb);
+
+#ifdef CONFIG_AUDIO_BUFFER_POOL
+      if ((apb->flags & AUDIO_APB_POOLED) != 0)
+        {
+          /* Return the buffer to the preallocated pool */
+
+          apb_pool_lock();
+          dq_addlast(&apb->dq_entry, &g_apb_free_pool);
+          apb_pool_unlock();
+        }
+      else
+#endif
+        {
+          lib_ufree(apb);
+        }
     }
 }
 
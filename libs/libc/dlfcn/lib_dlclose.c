@@ -87,6 +87,18 @@ static inline int dlremove(FAR void *handle)
       goto errout_with_lock;
     }
 
+  /* If other dlopen() references to the library remain, then just release
+   * this reference.  The single shared copy of the library stays loaded
+   * until the last dlclose().
+   */
+
+  if (modp->nrefs > 1)
+    {
+      modp->nrefs--;
+      modlib_registry_unlock();
+      return OK;
+    }
+
 #if CONFIG_MODLIB_MAXDEPEND > 0
   /* Refuse to remove any module that other modules may depend upon. */
 
@@ -142,6 +154,14 @@ static inline int dlremove(FAR void *handle)
 #endif
     }
 
+  /* Free the saved file name used for sharing the library */
+
+  if (modp->filename != NULL)
+    {
+      lib_free(modp->filename);
+      modp->filename = NULL;
+    }
+
   /* Remove the module from the registry */
 
   ret = modlib_registry_del(modp);
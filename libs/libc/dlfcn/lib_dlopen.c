@@ -52,10 +52,52 @@
 
 #include "libc.h"
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_PROTECTED
+/* Describes one dlinsert_match() search of the module registry */
+
+struct dl_match_s
+{
+  FAR const char *filename;    /* Full path that we are searching for */
+  FAR struct module_s *modp;   /* Matching module (NULL if none) */
+};
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: dlinsert_match
+ *
+ * Description:
+ *   modlib_registry_foreach() callback used by dlinsert() to find a
+ *   library that was already loaded from the same file by an earlier
+ *   dlopen().
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_PROTECTED
+static int dlinsert_match(FAR struct module_s *modp, FAR void *arg)
+{
+  FAR struct dl_match_s *match = (FAR struct dl_match_s *)arg;
+
+  if (modp->filename != NULL &&
+      strcmp(modp->filename, match->filename) == 0)
+    {
+      /* Found it.. terminate the traversal */
+
+      match->modp = modp;
+      return 1;
+    }
+
+  return 0;
+}
+#endif
+
 /****************************************************************************
  * Name: dldump_loadinfo
  ****************************************************************************/
@@ -173,6 +215,7 @@ static void dldump_initializer(mod_initializer_t initializer,
 static inline FAR void *dlinsert(FAR const char *filename)
 {
   struct mod_loadinfo_s loadinfo;
+  struct dl_match_s match;
   FAR struct module_s *modp;
   mod_initializer_t initializer;
   int ret;
@@ -183,6 +226,25 @@ static inline FAR void *dlinsert(FAR const char *filename)
 
   modlib_registry_lock();
 
+  /* If the library was already loaded from this file by an earlier
+   * dlopen(), then share that single copy.  All tasks run in the same
+   * flat address space in the PROTECTED build, so one copy of the
+   * library text serves every process; the code is read from the file
+   * only once and hot library routines stay warm in the I-cache across
+   * process switches.
+   */
+
+  match.filename = filename;
+  match.modp     = NULL;
+
+  modlib_registry_foreach(dlinsert_match, &match);
+  if (match.modp != NULL)
+    {
+      match.modp->nrefs++;
+      modlib_registry_unlock();
+      return (FAR void *)match.modp;
+    }
+
   /* Initialize the ELF library to load the program binary. */
 
   ret = modlib_initialize(filename, &loadinfo);
@@ -247,6 +309,14 @@ static inline FAR void *dlinsert(FAR const char *filename)
       goto errout_with_load;
     }
 
+  /* Remember the file that the library was loaded from so that later
+   * dlopen() calls on the same file will share this copy.  A failure of
+   * the allocation is not fatal; it only disables the sharing.
+   */
+
+  modp->filename = strdup(filename);
+  modp->nrefs    = 1;
+
   /* Add the new module entry to the registry */
 
   modlib_registry_add(modp);
@@ -43,8 +43,11 @@
  * Included Files
  ************************************************************************************************/
 
+#include <nuttx/config.h>
+
 #include <sys/types.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <crc32.h>
 
 /************************************************************************************************
@@ -87,6 +90,50 @@ static const uint32_t crc32_tab[] =
   0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 };
 
+#ifdef CONFIG_LIB_CRC32_SLICEBY8
+/* Derived feedback term tables for the slice-by-8 algorithm.  Table k gives the effect of a
+ * byte k+1 positions ahead in the input stream; crc32_tab above serves as table 0.  The
+ * derived tables are generated on first use.
+ */
+
+static uint32_t crc32_xtab[7][256];
+static bool crc32_xtab_ready;
+#endif
+
+/************************************************************************************************
+ * Private Functions
+ ************************************************************************************************/
+
+/************************************************************************************************
+ * Name: crc32_inittab
+ *
+ * Description:
+ *   Derive the slice-by-8 lookup tables from the table of feedback terms.  The generation is
+ *   idempotent, so a concurrent first call at worst repeats the work.
+ *
+ ************************************************************************************************/
+
+#ifdef CONFIG_LIB_CRC32_SLICEBY8
+static void crc32_inittab(void)
+{
+  uint32_t crc;
+  int i;
+  int k;
+
+  for (i = 0; i < 256; i++)
+    {
+      crc = crc32_tab[i];
+      for (k = 0; k < 7; k++)
+        {
+          crc              = (crc >> 8) ^ crc32_tab[crc & 0xff];
+          crc32_xtab[k][i] = crc;
+        }
+    }
+
+  crc32_xtab_ready = true;
+}
+#endif
+
 /************************************************************************************************
  * Public Functions
  ************************************************************************************************/
@@ -100,8 +147,49 @@ static const uint32_t crc32_tab[] =
 
 uint32_t crc32part(FAR const uint8_t *src, size_t len, uint32_t crc32val)
 {
+#ifdef CONFIG_LIB_CRC32_SLICEBY8
+  uint32_t one;
+  uint32_t two;
+#endif
   size_t i;
 
+#ifdef CONFIG_LIB_CRC32_SLICEBY8
+  if (!crc32_xtab_ready)
+    {
+      crc32_inittab();
+    }
+
+  /* Process eight bytes per iteration, consuming two 32-bit words of input for one round of
+   * table lookups.  The words are assembled from bytes so that the logic depends on neither
+   * the endianness nor the alignment of the source.
+   */
+
+  while (len >= 8)
+    {
+      one = (uint32_t)src[0] |
+            ((uint32_t)src[1] << 8) |
+            ((uint32_t)src[2] << 16) |
+            ((uint32_t)src[3] << 24);
+      two = (uint32_t)src[4] |
+            ((uint32_t)src[5] << 8) |
+            ((uint32_t)src[6] << 16) |
+            ((uint32_t)src[7] << 24);
+
+      one     ^= crc32val;
+      crc32val = crc32_xtab[6][one & 0xff] ^
+                 crc32_xtab[5][(one >> 8) & 0xff] ^
+                 crc32_xtab[4][(one >> 16) & 0xff] ^
+                 crc32_xtab[3][one >> 24] ^
+                 crc32_xtab[2][two & 0xff] ^
+                 crc32_xtab[1][(two >> 8) & 0xff] ^
+                 crc32_xtab[0][(two >> 16) & 0xff] ^
+                 crc32_tab[two >> 24];
+
+      src += 8;
+      len -= 8;
+    }
+#endif
+
   for (i = 0; i < len; i++)
     {
       crc32val = crc32_tab[(crc32val & 0xff) ^ src[i]] ^ (crc32val >> 8);
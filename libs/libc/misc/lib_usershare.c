@@ -0,0 +1,73 @@
+/****************************************************************************
+ * libs/libc/misc/lib_usershare.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+
+#include <nuttx/usershare.h>
+
+#if defined(CONFIG_LIB_USERSHARE) && !defined(__KERNEL__)
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* The single, user-space instance of the shared information structure.
+ * The kernel is the only writer once the structure has been registered;
+ * all user code treats the structure as read-only.
+ */
+
+struct usershare_s g_usershare;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lib_usershare_initialize
+ *
+ * Description:
+ *   Register the user-space shared information structure with the kernel.
+ *   Called on each task startup; only the first call traps into the
+ *   kernel.
+ *
+ ****************************************************************************/
+
+void lib_usershare_initialize(void)
+{
+  static bool registered;
+
+  /* The registered flag lies in the common user-space BSS so registration
+   * is performed only once.  A race between two starting tasks is benign:
+   * both would register the same structure.
+   */
+
+  if (!registered && usershare_register(&g_usershare) == OK)
+    {
+      registered = true;
+    }
+}
+
+#endif /* CONFIG_LIB_USERSHARE && !__KERNEL__ */
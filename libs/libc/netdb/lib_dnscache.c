@@ -63,6 +63,18 @@
 #  define DNS_CLOCK CLOCK_REALTIME
 #endif
 
+/* Number of slots probed from the home slot of a name before giving up on
+ * a lookup or overwriting on a save.  Keeping the probe window small bounds
+ * the lookup cost; the table is hash-indexed so a lookup no longer walks
+ * every cached entry.
+ */
+
+#if CONFIG_NETDB_DNSCLIENT_ENTRIES < 4
+#  define DNS_CACHE_PROBES CONFIG_NETDB_DNSCLIENT_ENTRIES
+#else
+#  define DNS_CACHE_PROBES 4
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -75,11 +87,13 @@
 
 struct dns_cache_s
 {
-#if CONFIG_NETDB_DNSCLIENT_LIFESEC > 0
   time_t            ctime;      /* Creation time */
-#endif
+  uint32_t          lifesec;    /* Lifetime in seconds (0 = no expiry) */
   char              name[CONFIG_NETDB_DNSCLIENT_NAMESIZE];
-  uint8_t           naddr;      /* How many addresses per name */
+  bool              valid;      /* This entry is in use */
+  uint8_t           naddr;      /* How many addresses per name.  Zero means
+                                 * a negative entry:  the name server
+                                 * reported that the name does not exist. */
   union dns_addr_u  addr[CONFIG_NETDB_MAX_IPADDR];
 };
 
@@ -87,10 +101,7 @@ struct dns_cache_s
  * Private Data
  ****************************************************************************/
 
-static uint8_t g_dns_head;        /* Head of the circular, DNS resolver cache */
-static uint8_t g_dns_tail;        /* Tail of the circular, DNS resolver cache */
-
-/* This is the DNS resolver cache */
+/* This is the DNS resolver cache, indexed by a hash of the hostname */
 
 static struct dns_cache_s g_dns_cache[CONFIG_NETDB_DNSCLIENT_ENTRIES];
 
@@ -98,6 +109,46 @@ static struct dns_cache_s g_dns_cache[CONFIG_NETDB_DNSCLIENT_ENTRIES];
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: dns_cache_hash
+ *
+ * Description:
+ *   Map a hostname to its home slot in the cache table.  Because the names
+ *   are truncated to CONFIG_NETDB_DNSCLIENT_NAMESIZE, this has the
+ *   possibility of aliasing two long names to one entry.
+ *
+ ****************************************************************************/
+
+static int dns_cache_hash(FAR const char *name)
+{
+  uint32_t hash = 5381;
+  int i;
+
+  for (i = 0;
+       i < CONFIG_NETDB_DNSCLIENT_NAMESIZE && name[i] != '\0';
+       i++)
+    {
+      hash = ((hash << 5) + hash) ^ (uint8_t)name[i];
+    }
+
+  return (int)(hash % CONFIG_NETDB_DNSCLIENT_ENTRIES);
+}
+
+/****************************************************************************
+ * Name: dns_cache_expired
+ *
+ * Description:
+ *   Check if a cache entry is older than its lifetime.
+ *
+ ****************************************************************************/
+
+static bool dns_cache_expired(FAR const struct dns_cache_s *entry,
+                              time_t now)
+{
+  return entry->lifesec > 0 &&
+         (uint32_t)(now - entry->ctime) > entry->lifesec;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -111,7 +162,10 @@ static struct dns_cache_s g_dns_cache[CONFIG_NETDB_DNSCLIENT_ENTRIES];
  * Input Parameters:
  *   hostname - The hostname string to be cached.
  *   addr     - The IP addresses associated with the hostname.
- *   naddr    - The count of the IP addresses.
+ *   naddr    - The count of the IP addresses.  Zero records a negative
+ *     answer:  the name server reported that the hostname does not exist.
+ *   ttl      - The lifetime reported by the name server, in seconds.  The
+ *     actual entry lifetime is capped by CONFIG_NETDB_DNSCLIENT_LIFESEC.
  *
  * Returned Value:
  *   None
@@ -119,64 +173,96 @@ static struct dns_cache_s g_dns_cache[CONFIG_NETDB_DNSCLIENT_ENTRIES];
  ****************************************************************************/
 
 void dns_save_answer(FAR const char *hostname,
-                     FAR const union dns_addr_u *addr, int naddr)
+                     FAR const union dns_addr_u *addr, int naddr,
+                     uint32_t ttl)
 {
   FAR struct dns_cache_s *entry;
-#if CONFIG_NETDB_DNSCLIENT_LIFESEC > 0
+  FAR struct dns_cache_s *victim;
   struct timespec now;
-#endif
-  int next;
+  uint32_t lifesec;
   int ndx;
+  int i;
 
   naddr = MIN(naddr, CONFIG_NETDB_MAX_IPADDR);
-  DEBUGASSERT(naddr >= 1 && naddr <= UCHAR_MAX);
+  DEBUGASSERT(naddr >= 0 && naddr <= UCHAR_MAX);
+
+  /* Determine the lifetime of the new entry */
+
+  if (naddr > 0)
+    {
+      lifesec = ttl;
+#if CONFIG_NETDB_DNSCLIENT_LIFESEC > 0
+      if (lifesec == 0 || lifesec > CONFIG_NETDB_DNSCLIENT_LIFESEC)
+        {
+          lifesec = CONFIG_NETDB_DNSCLIENT_LIFESEC;
+        }
+#endif
+    }
+  else
+    {
+#if CONFIG_NETDB_DNSCLIENT_NEGATIVE_LIFESEC > 0
+      lifesec = CONFIG_NETDB_DNSCLIENT_NEGATIVE_LIFESEC;
+#else
+      /* Negative caching is disabled */
+
+      return;
+#endif
+    }
 
   /* Get exclusive access to the DNS cache */
 
   dns_semtake();
 
-  /* Get the index to the new head of the list */
+  /* Get the current time, using CLOCK_MONOTONIC if possible */
 
-  ndx  = g_dns_head;
-  next = ndx + 1;
-  if (next >= CONFIG_NETDB_DNSCLIENT_ENTRIES)
-    {
-      next = 0;
-    }
+  clock_gettime(DNS_CLOCK, &now);
 
-  /* If the next head pointer would match the tail index, then increment
-   * the tail index, discarding the oldest mapping in the cache.
+  /* Probe the hash neighborhood of the name.  Prefer refreshing the entry
+   * already holding this name; otherwise take the first free or expired
+   * slot; as a last resort overwrite the home slot of the name.
    */
 
-  if (next == g_dns_tail)
+  ndx    = dns_cache_hash(hostname);
+  victim = NULL;
+
+  for (i = 0; i < DNS_CACHE_PROBES; i++)
     {
-      int tmp = g_dns_tail + 1;
-      if (tmp >= CONFIG_NETDB_DNSCLIENT_ENTRIES)
+      entry = &g_dns_cache[(ndx + i) % CONFIG_NETDB_DNSCLIENT_ENTRIES];
+
+      if (entry->valid &&
+          strncmp(hostname, entry->name,
+                  CONFIG_NETDB_DNSCLIENT_NAMESIZE) == 0)
         {
-          tmp = 0;
+          victim = entry;
+          break;
         }
 
-      g_dns_tail = tmp;
+      if (victim == NULL &&
+          (!entry->valid || dns_cache_expired(entry, now.tv_sec)))
+        {
+          victim = entry;
+        }
     }
 
-  /* Save the answer in the cache */
-
-  entry = &g_dns_cache[ndx];
+  if (victim == NULL)
+    {
+      victim = &g_dns_cache[ndx];
+    }
 
-#if CONFIG_NETDB_DNSCLIENT_LIFESEC > 0
-  /* Get the current time, using CLOCK_MONOTONIC if possible */
+  /* Save the answer in the cache */
 
-  clock_gettime(DNS_CLOCK, &now);
-  entry->ctime = (time_t)now.tv_sec;
-#endif
+  victim->ctime   = (time_t)now.tv_sec;
+  victim->lifesec = lifesec;
+  strncpy(victim->name, hostname, CONFIG_NETDB_DNSCLIENT_NAMESIZE);
 
-  strncpy(entry->name, hostname, CONFIG_NETDB_DNSCLIENT_NAMESIZE);
-  memcpy(&entry->addr, addr, naddr * sizeof(*addr));
-  entry->naddr = naddr;
+  if (naddr > 0)
+    {
+      memcpy(&victim->addr, addr, naddr * sizeof(*addr));
+    }
 
-  /* Save the updated head index */
+  victim->naddr = naddr;
+  victim->valid = true;
 
-  g_dns_head = next;
   dns_semgive();
 }
 
@@ -197,8 +283,10 @@ void dns_save_answer(FAR const char *hostname,
  * Returned Value:
  *   If the host name was successfully found in the DNS name resolution
  *   cache, zero (OK) will be returned.  Otherwise, some negated errno
- *   value will be returned, typically -ENOENT meaning that the hostname
- *   was not found in the cache.
+ *   value will be returned:  -ENOENT means that the hostname was not found
+ *   in the cache; -EHOSTUNREACH means that a negative answer was cached,
+ *   i.e. that the name server recently reported that the hostname does not
+ *   exist.
  *
  ****************************************************************************/
 
@@ -206,85 +294,67 @@ int dns_find_answer(FAR const char *hostname, FAR union dns_addr_u *addr,
                     FAR int *naddr)
 {
   FAR struct dns_cache_s *entry;
-#if CONFIG_NETDB_DNSCLIENT_LIFESEC > 0
   struct timespec now;
-  uint32_t elapsed;
-  int ret;
-#endif
-  int next;
+  int ret = -ENOENT;
   int ndx;
+  int i;
 
   /* Get exclusive access to the DNS cache */
 
   dns_semtake();
 
-#if CONFIG_NETDB_DNSCLIENT_LIFESEC > 0
   /* Get the current time, using CLOCK_MONOTONIC if possible */
 
-  ret = clock_gettime(DNS_CLOCK, &now);
-#endif
+  clock_gettime(DNS_CLOCK, &now);
 
-  for (ndx = g_dns_tail; ndx != g_dns_head; ndx = next)
-    {
-      entry = &g_dns_cache[ndx];
+  /* Probe the hash neighborhood of the name */
 
-      /* Advance the index for the next time through the loop, handling
-       * wrapping to the beginning of the circular buffer.
-       */
+  ndx = dns_cache_hash(hostname);
+
+  for (i = 0; i < DNS_CACHE_PROBES; i++)
+    {
+      entry = &g_dns_cache[(ndx + i) % CONFIG_NETDB_DNSCLIENT_ENTRIES];
 
-      next = ndx + 1;
-      if (next >= CONFIG_NETDB_DNSCLIENT_ENTRIES)
+      if (!entry->valid ||
+          strncmp(hostname, entry->name,
+                  CONFIG_NETDB_DNSCLIENT_NAMESIZE) != 0)
         {
-          next = 0;
+          continue;
         }
 
-#if CONFIG_NETDB_DNSCLIENT_LIFESEC > 0
-      /* Check if this entry has expired
-       * REVISIT: Does not this calculation assume that the sizeof(time_t)
-       * is equal to the sizeof(uint32_t)?
-       */
+      /* Check if this entry has expired */
 
-      elapsed = (uint32_t)now.tv_sec - (uint32_t)entry->ctime;
-      if (ret >= 0 && elapsed > CONFIG_NETDB_DNSCLIENT_LIFESEC)
+      if (dns_cache_expired(entry, now.tv_sec))
         {
-          /* This entry has expired.  Increment the tail index to exclude
-           * this entry on future traversals.
+          /* This entry has expired.  Invalidate it so that the slot can
+           * be reused.
            */
 
-          g_dns_tail = next;
+          entry->valid = false;
+          break;
         }
-      else
-#endif
-        {
-          /* The entry has not expired, check for a name match. Because
-           * the names are truncated to CONFIG_NETDB_DNSCLIENT_NAMESIZE,
-           * this has the possibility of aliasing two names and returning
-           * the wrong entry from the cache.
-           */
 
-          if (strncmp(hostname, entry->name,
-                      CONFIG_NETDB_DNSCLIENT_NAMESIZE) == 0)
-            {
-              /* We have a match.  Return the resolved host address */
+      /* Check for a cached negative answer */
 
-              /* Make sure that the address will fit in the caller-provided
-               * buffer.
-               */
+      if (entry->naddr == 0)
+        {
+          ret = -EHOSTUNREACH;
+          break;
+        }
 
-              *naddr = MIN(*naddr, entry->naddr);
+      /* We have a match.  Make sure that the addresses will fit in the
+       * caller-provided buffer.
+       */
 
-              /* Return the address information */
+      *naddr = MIN(*naddr, entry->naddr);
 
-              memcpy(addr, &entry->addr, *naddr * sizeof(*addr));
+      /* Return the address information */
 
-              dns_semgive();
-              return OK;
-            }
-        }
+      memcpy(addr, &entry->addr, *naddr * sizeof(*addr));
+      ret = OK;
+      break;
     }
 
-  ret = -ENOENT;
-
   dns_semgive();
   return ret;
 }
@@ -79,6 +79,17 @@
 #define SEND_BUFFER_SIZE (16 + CONFIG_NETDB_DNSCLIENT_NAMESIZE + 2)
 #define RECV_BUFFER_SIZE CONFIG_NETDB_DNSCLIENT_MAXRESPONSE
 
+/* Number of queries issued concurrently, one per enabled address family.
+ * Both queries are sent back-to-back on the same socket before waiting for
+ * the responses so that a dual-stack lookup costs only one round trip.
+ */
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+#  define DNS_NQUERIES 2
+#else
+#  define DNS_NQUERIES 1
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -316,16 +327,22 @@ static int dns_send_query(int sd, FAR const char *name,
  * Name: dns_recv_response
  *
  * Description:
- *   Called when new UDP data arrives
+ *   Called when new UDP data arrives.  The received datagram is matched by
+ *   its transaction ID against the 'nqinfo' outstanding queries described
+ *   by the 'qinfos' array.
  *
  * Returned Value:
  *   Returns number of valid IP address responses.  Negated errno value is
- *   returned in all other cases.
+ *   returned in all other cases:  -EHOSTUNREACH means that the name server
+ *   reported that the queried name does not exist.  On success, '*ttl' is
+ *   reduced to the smallest resource record TTL accepted so far; the
+ *   caller is expected to initialize it.
  *
  ****************************************************************************/
 
 static int dns_recv_response(int sd, FAR union dns_addr_u *addr, int naddr,
-                             FAR struct dns_query_info_s *qinfo)
+                             FAR struct dns_query_info_s *qinfos,
+                             int nqinfo, FAR uint32_t *ttl)
 {
   FAR uint8_t *nameptr;
   FAR uint8_t *namestart;
@@ -334,6 +351,8 @@ static int dns_recv_response(int sd, FAR union dns_addr_u *addr, int naddr,
   FAR struct dns_answer_s *ans;
   FAR struct dns_header_s *hdr;
   FAR struct dns_question_s *que;
+  FAR struct dns_query_info_s *qinfo;
+  uint32_t ansttl;
   uint16_t nquestions;
   uint16_t nanswers;
   int naddr_read;
@@ -372,23 +391,33 @@ static int dns_recv_response(int sd, FAR union dns_addr_u *addr, int naddr,
         ntohs(hdr->numquestions), ntohs(hdr->numanswers),
         ntohs(hdr->numauthrr), ntohs(hdr->numextrarr));
 
-  /* Check for error */
+  /* Check for matching ID.  Several queries may be outstanding on this
+   * socket at once; the ID selects which of them this datagram answers.
+   */
 
-  if ((hdr->flags2 & DNS_FLAG2_ERR_MASK) != 0)
+  for (qinfo = qinfos; nqinfo > 0; nqinfo--, qinfo++)
     {
-      nerr("ERROR: DNS reported error: flags2=%02x\n", hdr->flags2);
-      return -EPROTO;
+      if (hdr->id == qinfo->id)
+        {
+          break;
+        }
     }
 
-  /* Check for matching ID. */
-
-  if (hdr->id != qinfo->id)
+  if (nqinfo <= 0)
     {
-      nerr("ERROR: DNS wrong response ID (expected %d, got %d)\n",
-           ntohs(qinfo->id), ntohs(hdr->id));
+      nerr("ERROR: DNS wrong response ID (got %d)\n", ntohs(hdr->id));
       return -EBADMSG;
     }
 
+  /* Check for error */
+
+  if ((hdr->flags2 & DNS_FLAG2_ERR_MASK) != 0)
+    {
+      nerr("ERROR: DNS reported error: flags2=%02x\n", hdr->flags2);
+      return (hdr->flags2 & DNS_FLAG2_ERR_MASK) == DNS_FLAG2_ERR_NAME ?
+             -EHOSTUNREACH : -EPROTO;
+    }
+
   /* We only care about the question(s) and the answers. The authrr
    * and the extrarr are simply discarded.
    */
@@ -466,6 +495,8 @@ static int dns_recv_response(int sd, FAR union dns_addr_u *addr, int naddr,
         }
 
       ans = (FAR struct dns_answer_s *)nameptr;
+      ansttl = ((uint32_t)ntohs(ans->ttl[0]) << 16) |
+                (uint32_t)ntohs(ans->ttl[1]);
 
       ninfo("Answer: type=%04x, class=%04x, ttl=%06x, length=%04x \n",
             ntohs(ans->type), ntohs(ans->class),
@@ -497,6 +528,11 @@ static int dns_recv_response(int sd, FAR union dns_addr_u *addr, int naddr,
           inaddr->sin_port        = 0;
           inaddr->sin_addr.s_addr = ans->u.ipv4.s_addr;
 
+          if (ansttl < *ttl)
+            {
+              *ttl = ansttl;
+            }
+
           if (++naddr_read >= naddr)
             {
               ret = -ERANGE;
@@ -526,6 +562,11 @@ static int dns_recv_response(int sd, FAR union dns_addr_u *addr, int naddr,
           inaddr->sin6_port       = 0;
           memcpy(inaddr->sin6_addr.s6_addr, ans->u.ipv6.s6_addr, 16);
 
+          if (ansttl < *ttl)
+            {
+              *ttl = ansttl;
+            }
+
           if (++naddr_read >= naddr)
             {
               ret = -ERANGE;
@@ -570,9 +611,12 @@ static int dns_query_callback(FAR void *arg, FAR struct sockaddr *addr,
                               FAR socklen_t addrlen)
 {
   FAR struct dns_query_s *query = (FAR struct dns_query_s *)arg;
-  FAR struct dns_query_info_s qinfo;
+  struct dns_query_info_s qinfo[DNS_NQUERIES];
+  uint32_t ttl;
   int next = 0;
   int retries;
+  int nsent;
+  int i;
   int ret;
 
   /* Loop while receive timeout errors occur and there are remaining
@@ -581,12 +625,19 @@ static int dns_query_callback(FAR void *arg, FAR struct sockaddr *addr,
 
   for (retries = 0; retries < CONFIG_NETDB_DNSCLIENT_RETRIES; retries++)
     {
+      /* Issue the queries for all enabled address families back-to-back
+       * before waiting for any response so that a dual-stack lookup costs
+       * only a single round trip to the name server.
+       */
+
+      nsent = 0;
+
 #ifdef CONFIG_NET_IPv6
       /* Send the IPv6 query */
 
       ret = dns_send_query(query->sd, query->hostname,
                           (FAR union dns_addr_u *)addr,
-                           DNS_RECTYPE_AAAA, &qinfo);
+                           DNS_RECTYPE_AAAA, &qinfo[nsent]);
       if (ret < 0)
         {
           nerr("ERROR: IPv6 dns_send_query failed: %d\n", ret);
@@ -594,19 +645,7 @@ static int dns_query_callback(FAR void *arg, FAR struct sockaddr *addr,
         }
       else
         {
-          /* Obtain the IPv6 response */
-
-          ret = dns_recv_response(query->sd, &query->addr[next],
-                                  *query->naddr - next, &qinfo);
-          if (ret >= 0)
-            {
-              next += ret;
-            }
-          else
-            {
-              nerr("ERROR: IPv6 dns_recv_response failed: %d\n", ret);
-              query->result = ret;
-            }
+          nsent++;
         }
 #endif
 
@@ -615,7 +654,7 @@ static int dns_query_callback(FAR void *arg, FAR struct sockaddr *addr,
 
       ret = dns_send_query(query->sd, query->hostname,
                            (FAR union dns_addr_u *)addr,
-                           DNS_RECTYPE_A, &qinfo);
+                           DNS_RECTYPE_A, &qinfo[nsent]);
       if (ret < 0)
         {
           nerr("ERROR: IPv4 dns_send_query failed: %d\n", ret);
@@ -623,28 +662,41 @@ static int dns_query_callback(FAR void *arg, FAR struct sockaddr *addr,
         }
       else
         {
-          /* Obtain the IPv4 response */
+          nsent++;
+        }
+#endif /* CONFIG_NET_IPv4 */
+
+      /* Collect one response per outstanding query.  The responses may
+       * arrive in either order; dns_recv_response() matches each datagram
+       * to its query by the transaction ID.
+       */
+
+      ttl = UINT32_MAX;
 
+      for (i = 0; i < nsent; i++)
+        {
           ret = dns_recv_response(query->sd, &query->addr[next],
-                                  *query->naddr - next, &qinfo);
+                                  *query->naddr - next, qinfo, nsent,
+                                  &ttl);
           if (ret >= 0)
             {
               next += ret;
             }
           else
             {
-              nerr("ERROR: IPv4 dns_recv_response failed: %d\n", ret);
+              nerr("ERROR: dns_recv_response failed: %d\n", ret);
               query->result = ret;
             }
         }
-#endif /* CONFIG_NET_IPv4 */
 
       if (next > 0)
         {
 #if CONFIG_NETDB_DNSCLIENT_ENTRIES > 0
-          /* Save the answer in the DNS cache */
+          /* Save the answer in the DNS cache, honoring the smallest TTL
+           * reported by the name server.
+           */
 
-          dns_save_answer(query->hostname, query->addr, next);
+          dns_save_answer(query->hostname, query->addr, next, ttl);
 #endif
           /* Return 1 to indicate to (1) stop the traversal, and (2)
            * indicate that the address was found.
@@ -718,6 +770,19 @@ int dns_query(int sd, FAR const char *hostname, FAR union dns_addr_u *addr,
   else if (ret == 0)
     {
       ret = query.result;
+
+#if CONFIG_NETDB_DNSCLIENT_ENTRIES > 0 && \
+    CONFIG_NETDB_DNSCLIENT_NEGATIVE_LIFESEC > 0
+      if (ret == -EHOSTUNREACH)
+        {
+          /* The name servers reported that the name does not exist.  Cache
+           * the negative answer so that bursts of lookups for the same bad
+           * name do not each go out to the network.
+           */
+
+          dns_save_answer(hostname, NULL, 0, 0);
+        }
+#endif
     }
 
   return ret;
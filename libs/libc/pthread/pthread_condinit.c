@@ -93,6 +93,12 @@ int pthread_cond_init(FAR pthread_cond_t *cond,
       sem_setprotocol(&cond->sem, SEM_PRIO_NONE);
 
       cond->clockid = attr ? attr->clockid : CLOCK_REALTIME;
+
+#ifdef CONFIG_PTHREAD_WAITMORPH
+      /* No mutex has yet been associated by a waiter */
+
+      cond->mutex = NULL;
+#endif
     }
 
   sinfo("Returning %d\n", ret);
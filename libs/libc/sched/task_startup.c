@@ -43,6 +43,10 @@
 #include <stdlib.h>
 #include <assert.h>
 
+#ifdef CONFIG_LIB_USERSHARE
+#  include <nuttx/usershare.h>
+#endif
+
 #ifndef CONFIG_BUILD_KERNEL
 
 /****************************************************************************
@@ -152,6 +156,14 @@ void nxtask_startup(main_t entrypt, int argc, FAR char *argv[])
 {
   DEBUGASSERT(entrypt);
 
+#ifdef CONFIG_LIB_USERSHARE
+  /* Make sure that the kernel/user shared information structure has been
+   * registered.  Only the first call traps into the kernel.
+   */
+
+  lib_usershare_initialize();
+#endif
+
   /* If C++ initialization for static constructors is supported, then do
    * that first
    */
@@ -122,6 +122,10 @@ ssize_t lib_fflush(FAR FILE *stream, bool bforce)
 
       nbuffer = stream->fs_bufpos - stream->fs_bufstart;
 
+#ifdef CONFIG_STDIO_STATS
+      stream->fs_nflush++;
+#endif
+
       /* Try to write that amount */
 
       src = stream->fs_bufstart;
@@ -130,6 +134,9 @@ ssize_t lib_fflush(FAR FILE *stream, bool bforce)
           /* Perform the write */
 
           bytes_written = _NX_WRITE(stream->fs_fd, src, nbuffer);
+#ifdef CONFIG_STDIO_STATS
+          stream->fs_nwrite++;
+#endif
           if (bytes_written < 0)
             {
               /* Write failed.  The cause of the failure is in 'errno'.
@@ -64,6 +64,7 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
   FAR const unsigned char *start = ptr;
   FAR const unsigned char *src   = ptr;
   ssize_t ret = ERROR;
+  ssize_t nwritten;
   unsigned char *dest;
 
   /* Make sure that writing to this stream is allowed */
@@ -116,6 +117,34 @@ ssize_t lib_fwrite(FAR const void *ptr, size_t count, FAR FILE *stream)
 
   while (count > 0)
     {
+      /* If the I/O buffer is empty and the remaining transfer is at least
+       * as large as the I/O buffer, then bypass the buffer and write
+       * directly from the user memory.  This keeps a large transfer down
+       * to a single write instead of copying the data in buffer-sized
+       * pieces with one flush per piece.
+       */
+
+      if (stream->fs_bufpos == stream->fs_bufstart &&
+          count >= (size_t)(stream->fs_bufend - stream->fs_bufstart))
+        {
+          nwritten = _NX_WRITE(stream->fs_fd, src, count);
+          if (nwritten < 0)
+            {
+#if defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__)
+              _NX_SETERRNO((int)-nwritten);
+#endif
+              goto errout_with_semaphore;
+            }
+
+#ifdef CONFIG_STDIO_STATS
+          stream->fs_nwrite++;
+#endif
+
+          src   += nwritten;
+          count -= nwritten;
+          continue;
+        }
+
       /* Determine the number of bytes left in the buffer */
 
       size_t gulp_size = stream->fs_bufend - stream->fs_bufpos;
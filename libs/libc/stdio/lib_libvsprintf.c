@@ -43,6 +43,7 @@
 #include <nuttx/config.h>
 
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -178,6 +179,14 @@ static int vsprintf_internal(FAR struct lib_outstream_s *stream,
 
   int argnumber;
 
+#else
+
+  FAR const IPTR char *fmt_save;
+  unsigned char fc;
+  bool zfill;
+  int fwidth;
+  int flen;
+
 #endif
 
   for (; ; )
@@ -209,6 +218,126 @@ static int vsprintf_internal(FAR struct lib_outstream_s *stream,
 #endif
         }
 
+#ifndef CONFIG_LIBC_NUMBERED_ARGS
+      /* Fast path for the simple conversions that dominate syslog and
+       * debug output:  "%d", "%u", "%x", "%s", "%c" and the zero-filled
+       * or space-padded fixed width forms of the integer conversions
+       * (e.g. "%08x", "%5d").  These are handled here without running
+       * the full flags state machine below.  Anything else falls through
+       * to the general code with the format pointer restored.
+       */
+
+      fmt_save = fmt;
+      fc       = c;
+      zfill    = false;
+      fwidth   = 0;
+
+      if (fc == '0')
+        {
+          zfill = true;
+          fc    = fmt_char(fmt);
+        }
+
+      while (fc >= '0' && fc <= '9')
+        {
+          fwidth = 10 * fwidth + (fc - '0');
+          fc     = fmt_char(fmt);
+        }
+
+      if (fc == 'c' && !zfill && fwidth == 0)
+        {
+          putc(va_arg(ap, int), stream);
+          continue;
+        }
+      else if (fc == 's' && !zfill && fwidth == 0)
+        {
+          pnt = va_arg(ap, FAR char *);
+          if (pnt == NULL)
+            {
+              pnt = g_nullstring;
+            }
+
+          while (*pnt != '\0')
+            {
+              putc(*pnt++, stream);
+            }
+
+          continue;
+        }
+      else if (fc == 'd' || fc == 'i' || fc == 'u' || fc == 'x' ||
+               fc == 'X')
+        {
+          bool negative = false;
+          int nconv;
+
+          if (fc == 'd' || fc == 'i')
+            {
+              int x = va_arg(ap, int);
+              unsigned int ux;
+
+              if (x < 0)
+                {
+                  negative = true;
+                  ux = -(unsigned int)x;
+                }
+              else
+                {
+                  ux = (unsigned int)x;
+                }
+
+              nconv = __ultoa_invert(ux, (FAR char *)buf, 10) -
+                      (FAR char *)buf;
+            }
+          else
+            {
+              unsigned int x = va_arg(ap, unsigned int);
+
+              nconv = __ultoa_invert(x, (FAR char *)buf,
+                                     fc == 'u' ? 10 :
+                                     fc == 'x' ? 16 : 16 | XTOA_UPPER) -
+                      (FAR char *)buf;
+            }
+
+          /* Pad to the field width:  Blanks go before the sign, zeros
+           * after it.
+           */
+
+          flen = nconv + (negative ? 1 : 0);
+          if (!zfill)
+            {
+              while (flen < fwidth)
+                {
+                  putc(' ', stream);
+                  flen++;
+                }
+            }
+
+          if (negative)
+            {
+              putc('-', stream);
+            }
+
+          while (flen < fwidth)
+            {
+              putc('0', stream);
+              flen++;
+            }
+
+          while (nconv > 0)
+            {
+              putc(buf[--nconv], stream);
+            }
+
+          continue;
+        }
+
+      /* Not a simple conversion.  Restore the format pointer and run the
+       * general state machine.
+       */
+
+      fmt = fmt_save;
+#endif
+
       flags = 0;
       width = 0;
       prec  = 0;
@@ -39,6 +39,27 @@
 
 #include "lib_ultoa_invert.h"
 
+/****************************************************************************
+ * Private Constant Data
+ ****************************************************************************/
+
+/* Two-character lookup table for the decimal values 0..99.  Converting two
+ * digits per iteration halves the number of divisions, which matters on
+ * MCUs where (long long) division is a library call.
+ */
+
+static const char g_twodigit[200] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -56,6 +77,38 @@ FAR char *__ultoa_invert(unsigned long val, FAR char *str, int base)
       upper = 1;
       base &= ~XTOA_UPPER;
     }
+
+  if (base == 10)
+    {
+      /* Decimal:  Pull two digits per division from the lookup table.
+       * The string is built least significant digit first, so the ones
+       * digit of each pair is emitted before the tens digit.
+       */
+
+      while (val >= 100)
+        {
+          int rem = (int)(val % 100) << 1;
+
+          val /= 100;
+          *str++ = g_twodigit[rem + 1];
+          *str++ = g_twodigit[rem];
+        }
+
+      if (val >= 10)
+        {
+          int rem = (int)val << 1;
+
+          *str++ = g_twodigit[rem + 1];
+          *str++ = g_twodigit[rem];
+        }
+      else
+        {
+          *str++ = '0' + (int)val;
+        }
+
+      return str;
+    }
+
   do
     {
       int v;
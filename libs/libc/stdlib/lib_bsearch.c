@@ -88,18 +88,14 @@
  *   the array, or a null pointer if no match is found. If two or more
  *   members compare equal, which member is returned is unspecified.
  *
- * Notes from the NetBSD version:
- *   The code below is a bit sneaky.  After a comparison fails, we divide
- *   the work in half by moving either left or right. If 'lim' is odd,
- *   moving left simply involves halving 'lim': e.g., when 'lim' is 5 we
- *   look at item 2, so we change 'lim' to 2 so that we will look at items
- *   0 & 1.  If 'lim' is even, the same applies.  If 'lim' is odd, moving
- *   right again involes halving 'lim', this time moving the base up one
- *   item past 'middle': e.g., when 'lim' is 5 we change base to item 3 and
- *   make 'lim' 2 so that we will look at items 3 and 4.  If 'lim' is
- *   even, however, we have to shrink it by one before halving: e.g.,
- *   when 'lim' is 4, we still looked at item 2, so we have to make 'lim'
- *   3, then halve, obtaining 1, so that we will only look at item 3.
+ * Notes:
+ *   Each iteration narrows the region to the half that may still hold the
+ *   key without testing for an exact match.  The loop body then contains
+ *   only one conditional update which the compiler can reduce to a
+ *   conditional move, avoiding the poorly predicted three-way branch of
+ *   the classic implementation.  The loop converges on the last element
+ *   that does not compare greater than the key, so a single comparison
+ *   after the loop decides between a match and no match.
  *
  ****************************************************************************/
 
@@ -107,32 +103,35 @@ FAR void *bsearch(FAR const void *key, FAR const void *base, size_t nel,
                   size_t width, CODE int (*compar)(FAR const void *,
                   FAR const void *))
 {
-  FAR const void *middle;  /* Current entry being tested */
-  FAR const char *lower;   /* The lower limit of the search region */
-  size_t lim;              /* The number of elements in the region */
-  int cmp;                 /* Boolean comparison result */
+  FAR const char *middle;  /* Current entry being tested */
+  FAR const char *lower;   /* First entry of the search region */
+  size_t half;             /* Elements in the lower half of the region */
 
   DEBUGASSERT(key != NULL);
   DEBUGASSERT(base != NULL || nel == 0);
   DEBUGASSERT(compar != NULL);
 
-  for (lim = nel, lower = (const char *)base; lim != 0; lim >>= 1)
+  lower = (FAR const char *)base;
+  while (nel > 1)
     {
-      middle = lower + (lim >> 1) * width;
-      cmp    = (*compar)(key, middle);
+      half   = nel >> 1;
+      middle = lower + half * width;
 
-      if (cmp == 0)
+      /* If key >= middle, then the last element that does not compare
+       * greater than the key lies in the upper half of the region.
+       */
+
+      if ((*compar)(key, middle) >= 0)
         {
-          return (FAR void *)middle;
+          lower = middle;
         }
 
-      if (cmp > 0)
-        {
-          /* key > middle: move right (else move left) */
+      nel -= half;
+    }
 
-          lower = (FAR const char *)middle + width;
-          lim--;
-        }
+  if (nel != 0 && (*compar)(key, lower) == 0)
+    {
+      return (FAR void *)lower;
     }
 
   return NULL;
@@ -48,11 +48,23 @@
 
 #include <sys/types.h>
 #include <stdlib.h>
+#include <limits.h>
 
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
 
+/* Partitions below this size are finished with an insertion sort */
+
+#define INTROSORT_THRESHOLD 16
+
+/* The maximum number of deferred partitions.  Since the smaller partition
+ * is always processed first and the larger one deferred, the stack can
+ * never hold more than log2(nel) entries.
+ */
+
+#define INTROSORT_STACK     (sizeof(size_t) * CHAR_BIT)
+
 #define min(a, b)  (a) < (b) ? a : b
 
 #define swapcode(TYPE, parmi, parmj, n) \
@@ -85,6 +97,19 @@
 
 #define vecswap(a, b, n) if ((n) > 0) swapfunc(a, b, n, swaptype)
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One partition whose sorting has been deferred */
+
+struct qsort_chunk_s
+{
+  FAR char *base;            /* First element of the partition */
+  size_t    nel;             /* Number of elements in the partition */
+  int       limit;           /* Remaining partition depth budget */
+};
+
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
@@ -93,6 +118,12 @@ static inline void swapfunc(FAR char *a, FAR char *b, int n, int swaptype);
 static inline FAR char *med3(FAR char *a, FAR char *b, FAR char *c,
                              CODE int (*compar)(FAR const void *,
                              FAR const void *));
+static void insertion_sort(FAR char *base, size_t nel, size_t width,
+                           CODE int (*compar)(FAR const void *,
+                           FAR const void *), int swaptype);
+static void heap_sort(FAR char *base, size_t nel, size_t width,
+                      CODE int (*compar)(FAR const void *,
+                      FAR const void *), int swaptype);
 
 /****************************************************************************
  * Private Functions
@@ -119,6 +150,98 @@ static inline FAR char *med3(FAR char *a, FAR char *b, FAR char *c,
          (compar(b, c) > 0 ? b : (compar(a, c) < 0 ? a : c));
 }
 
+/****************************************************************************
+ * Name: insertion_sort
+ *
+ * Description:
+ *   Simple insertion sort.  This is optimal for the small partitions left
+ *   over by the quicksort stage.
+ *
+ ****************************************************************************/
+
+static void insertion_sort(FAR char *base, size_t nel, size_t width,
+                           CODE int (*compar)(FAR const void *,
+                           FAR const void *), int swaptype)
+{
+  FAR char *pl;
+  FAR char *pm;
+
+  for (pm = base + width; pm < base + nel * width; pm += width)
+    {
+      for (pl = pm;
+           pl > base && compar(pl - width, pl) > 0;
+           pl -= width)
+        {
+          swap(pl, pl - width);
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: heap_sort
+ *
+ * Description:
+ *   In-place heapsort.  This is slower than the quicksort stage on average
+ *   but is guaranteed O(n*log(n)), so it is used as the fallback when the
+ *   partition depth indicates a pathological input.
+ *
+ ****************************************************************************/
+
+static void heap_sort(FAR char *base, size_t nel, size_t width,
+                      CODE int (*compar)(FAR const void *,
+                      FAR const void *), int swaptype)
+{
+  size_t start;
+  size_t root;
+  size_t child;
+  size_t n;
+
+  /* Heapify, then repeatedly move the largest element to the end of the
+   * shrinking heap.  'start > 0' selects the heapify phase.
+   */
+
+  for (start = nel / 2, n = nel; n > 1; )
+    {
+      if (start > 0)
+        {
+          /* Heapify phase: sift down the element at start - 1 */
+
+          root = --start;
+        }
+      else
+        {
+          /* Sorting phase: move the heap maximum to its final position
+           * and sift down the element swapped into the root.
+           */
+
+          n--;
+          swap(base, base + n * width);
+          root = 0;
+        }
+
+      /* Sift down the root element until the heap property is restored */
+
+      while ((child = 2 * root + 1) < n)
+        {
+          /* Select the larger of the two children */
+
+          if (child + 1 < n &&
+              compar(base + child * width, base + (child + 1) * width) < 0)
+            {
+              child++;
+            }
+
+          if (compar(base + root * width, base + child * width) >= 0)
+            {
+              break;
+            }
+
+          swap(base + root * width, base + child * width);
+          root = child;
+        }
+    }
+}
+
 /****************************************************************************
  * Public Function
  ****************************************************************************/
@@ -157,14 +280,21 @@ static inline FAR char *med3(FAR char *a, FAR char *b, FAR char *c,
  * Returned Value:
  *   The qsort() function will not return a value.
  *
- * Notes from the original BSD version:
- *   Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
+ * Notes:
+ *   This is an introspective sort:  The quicksort stage comes from Bentley
+ *   & McIlroy's "Engineering a Sort Function" but recursion is replaced
+ *   with an explicit stack and a partition depth budget of 2*log2(nel).
+ *   Partitions that exhaust the budget are finished with heapsort and
+ *   partitions smaller than INTROSORT_THRESHOLD with insertion sort, so
+ *   both the running time and the stack usage are bounded for any input.
  *
  ****************************************************************************/
 
 void qsort(FAR void *base, size_t nel, size_t width,
            CODE int(*compar)(FAR const void *, FAR const void *))
 {
+  struct qsort_chunk_s stack[INTROSORT_STACK];
+  FAR struct qsort_chunk_s *top = stack;
   FAR char *pa;
   FAR char *pb;
   FAR char *pc;
@@ -172,35 +302,53 @@ void qsort(FAR void *base, size_t nel, size_t width,
   FAR char *pl;
   FAR char *pm;
   FAR char *pn;
+  size_t lnel;
+  size_t rnel;
+  size_t tmp;
   int swaptype;
-  int swap_cnt;
+  int limit;
   int d;
   int r;
 
-loop:
   SWAPINIT(base, width);
-  swap_cnt = 0;
 
-  if (nel < 7)
+  /* Get the partition depth budget: 2*log2(nel) */
+
+  for (limit = 0, tmp = nel; tmp > 0; tmp >>= 1)
     {
-      for (pm = (FAR char *)base + width;
-           pm < (FAR char *)base + nel * width;
-           pm += width)
+      limit += 2;
+    }
+
+  for (; ; )
+    {
+      /* Use insertion sort on small partitions */
+
+      if (nel < INTROSORT_THRESHOLD)
         {
-          for (pl = pm;
-               pl > (FAR char *)base && compar(pl - width, pl) > 0;
-               pl -= width)
+          if (nel > 1)
             {
-              swap(pl, pl - width);
+              insertion_sort(base, nel, width, compar, swaptype);
             }
+
+          goto next;
         }
 
-      return;
-  }
+      /* Fall back to heapsort when the partition depth indicates that
+       * quicksort is degenerating on this input.
+       */
 
-  pm = (FAR char *)base + (nel / 2) * width;
-  if (nel > 7)
-    {
+      if (limit-- == 0)
+        {
+          heap_sort(base, nel, width, compar, swaptype);
+          goto next;
+        }
+
+      /* Select the pivot with the median-of-3 method (or the ninther for
+       * large partitions) and perform the Bentley-McIlroy split-end
+       * three-way partitioning.
+       */
+
+      pm = (FAR char *)base + (nel / 2) * width;
       pl = base;
       pn = (FAR char *)base + (nel - 1) * width;
       if (nel > 40)
@@ -212,86 +360,105 @@ loop:
         }
 
       pm = med3(pl, pm, pn, compar);
-    }
 
-  swap(base, pm);
-  pa = pb = (FAR char *)base + width;
+      swap(base, pm);
+      pa = pb = (FAR char *)base + width;
 
-  pc = pd = (FAR char *)base + (nel - 1) * width;
-  for (; ; )
-    {
-      while (pb <= pc && (r = compar(pb, base)) <= 0)
+      pc = pd = (FAR char *)base + (nel - 1) * width;
+      for (; ; )
         {
-          if (r == 0)
+          while (pb <= pc && (r = compar(pb, base)) <= 0)
             {
-              swap_cnt = 1;
-              swap(pa, pb);
-              pa += width;
+              if (r == 0)
+                {
+                  swap(pa, pb);
+                  pa += width;
+                }
+
+              pb += width;
             }
 
-          pb += width;
-        }
+          while (pb <= pc && (r = compar(pc, base)) >= 0)
+            {
+              if (r == 0)
+                {
+                  swap(pc, pd);
+                  pd -= width;
+                }
 
-      while (pb <= pc && (r = compar(pc, base)) >= 0)
-        {
-          if (r == 0)
+              pc -= width;
+            }
+
+          if (pb > pc)
             {
-              swap_cnt = 1;
-              swap(pc, pd);
-              pd -= width;
+              break;
             }
 
+          swap(pb, pc);
+          pb += width;
           pc -= width;
         }
 
-      if (pb > pc)
-        {
-          break;
-        }
+      pn = (FAR char *)base + nel * width;
+      r  = min(pa - (FAR char *)base, pb - pa);
+      vecswap(base, pb - r, r);
 
-      swap(pb, pc);
-      swap_cnt = 1;
-      pb      += width;
-      pc      -= width;
-    }
+      r  = min(pd - pc, pn - pd - (ssize_t)width);
+      vecswap(pb, pn - r, r);
 
-  if (swap_cnt == 0)
-    {
-      /* Switch to insertion sort */
+      /* Get the sizes of the partitions on either side of the elements
+       * equal to the pivot.
+       */
+
+      lnel = (pb - pa) / width;
+      rnel = (pd - pc) / width;
 
-      for (pm = (FAR char *)base + width;
-           pm < (FAR char *)base + nel * width;
-           pm += width)
+      /* Continue with the smaller partition and defer the larger one.
+       * This bounds the stack to log2(nel) entries.
+       */
+
+      if (lnel > rnel)
         {
-          for (pl = pm;
-               pl > (FAR char *)base && compar(pl - width, pl) > 0;
-               pl -= width)
+          if (lnel > 1)
             {
-              swap(pl, pl - width);
+              top->base  = base;
+              top->nel   = lnel;
+              top->limit = limit;
+              top++;
             }
-        }
 
-      return;
-    }
+          base = pn - rnel * width;
+          nel  = rnel;
+        }
+      else
+        {
+          if (rnel > 1)
+            {
+              top->base  = pn - rnel * width;
+              top->nel   = rnel;
+              top->limit = limit;
+              top++;
+            }
 
-  pn = (FAR char *)base + nel * width;
-  r  = min(pa - (FAR char *)base, pb - pa);
-  vecswap(base, pb - r, r);
+          nel = lnel;
+        }
 
-  r  = min(pd - pc, pn - pd - width);
-  vecswap(pb, pn - r, r);
+      if (nel > 1)
+        {
+          continue;
+        }
 
-  if ((r = pb - pa) > width)
-    {
-      qsort(base, r / width, width, compar);
-    }
+next:
+      /* This partition is fully sorted.  Continue with a deferred one */
 
-  if ((r = pd - pc) > width)
-    {
-      /* Iterate rather than recurse to save stack space */
+      if (top == stack)
+        {
+          return;
+        }
 
-      base = pn - r;
-      nel = r / width;
-      goto loop;
+      top--;
+      base  = top->base;
+      nel   = top->nel;
+      limit = top->limit;
     }
 }
@@ -39,6 +39,7 @@
 
 #include <nuttx/config.h>
 #include <sys/types.h>
+#include <stdint.h>
 #include <string.h>
 
 /****************************************************************************
@@ -51,6 +52,42 @@ int memcmp(FAR const void *s1, FAR const void *s2, size_t n)
   unsigned char *p1 = (unsigned char *)s1;
   unsigned char *p2 = (unsigned char *)s2;
 
+#ifdef CONFIG_MEMCMP_OPTSPEED
+  /* Whole words can be compared at a time, but only if both buffers have
+   * the same alignment relative to a word boundary.
+   */
+
+  if (n >= sizeof(uint32_t) &&
+      ((uintptr_t)p1 & 3) == ((uintptr_t)p2 & 3))
+    {
+      /* Advance byte-by-byte until both pointers are word aligned */
+
+      while (((uintptr_t)p1 & 3) != 0)
+        {
+          if (*p1 != *p2)
+            {
+              return *p1 < *p2 ? -1 : 1;
+            }
+
+          p1++;
+          p2++;
+          n--;
+        }
+
+      /* Compare words while they are equal.  The first differing or
+       * trailing bytes are compared by the byte loop below.
+       */
+
+      while (n >= sizeof(uint32_t) &&
+             *(FAR uint32_t *)p1 == *(FAR uint32_t *)p2)
+        {
+          p1 += sizeof(uint32_t);
+          p2 += sizeof(uint32_t);
+          n  -= sizeof(uint32_t);
+        }
+    }
+#endif
+
   while (n-- > 0)
     {
       if (*p1 < *p2)
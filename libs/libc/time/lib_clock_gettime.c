@@ -0,0 +1,84 @@
+/****************************************************************************
+ * libs/libc/time/lib_clock_gettime.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <time.h>
+#include <syscall.h>
+
+#include <nuttx/usershare.h>
+
+#if defined(CONFIG_LIB_USERSHARE) && !defined(__KERNEL__)
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: clock_gettime
+ *
+ * Description:
+ *   Return the current time of the specified clock.  When the kernel
+ *   maintains the time of day in the shared information structure,
+ *   CLOCK_REALTIME is satisfied by reading the structure directly without
+ *   trapping into the kernel.  The shared time is refreshed on each timer
+ *   tick, matching the resolution of the trapped implementation.  This
+ *   definition replaces the auto-generated system call proxy (see
+ *   syscall/syscall.csv).
+ *
+ ****************************************************************************/
+
+int clock_gettime(clockid_t clockid, FAR struct timespec *tp)
+{
+  uint32_t seq;
+
+  if (clockid == CLOCK_REALTIME && tp != NULL &&
+      (g_usershare.us_flags & USERSHARE_REALTIME) != 0)
+    {
+      /* Re-read the time fields until a consistent snapshot is obtained:
+       * The sequence count is odd while the kernel is updating the fields
+       * and changes across the read if an update completed meanwhile.
+       */
+
+      do
+        {
+          seq         = g_usershare.us_seq;
+          tp->tv_sec  = g_usershare.us_sec;
+          tp->tv_nsec = g_usershare.us_nsec;
+        }
+      while ((seq & 1) != 0 || g_usershare.us_seq != seq);
+
+      return OK;
+    }
+
+  /* All other clocks (and unregistered startup) trap into the kernel as
+   * the proxy would.
+   */
+
+  return (int)sys_call2((unsigned int)SYS_clock_gettime,
+                        (uintptr_t)clockid, (uintptr_t)tp);
+}
+
+#endif /* CONFIG_LIB_USERSHARE && !__KERNEL__ */
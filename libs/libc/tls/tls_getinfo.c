@@ -33,6 +33,33 @@
 
 #ifndef CONFIG_TLS_ALIGNED
 
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_TLS_INFO_CACHE
+/* Each cache entry maps a range of stack addresses to the TLS structure
+ * that lies at the bottom of that stack.  An entry with a zero stack_size
+ * is invalid.
+ */
+
+struct tls_cache_s
+{
+  uintptr_t stack_base;                /* Lowest address of the stack */
+  uintptr_t stack_size;                /* Extent of the stack range */
+  FAR struct tls_info_s *info;         /* TLS structure for this stack */
+};
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_TLS_INFO_CACHE
+static struct tls_cache_s g_tls_cache[CONFIG_TLS_INFO_CACHE_ENTRIES];
+static int g_tls_cache_next;
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -59,6 +86,27 @@ FAR struct tls_info_s *tls_get_info(void)
   FAR struct tls_info_s *info = NULL;
   struct stackinfo_s stackinfo;
   int ret;
+#ifdef CONFIG_TLS_INFO_CACHE
+  FAR struct tls_cache_s *entry;
+  uintptr_t anchor;
+  int i;
+
+  /* The address of any local variable is an anchor into the stack of the
+   * currently executing thread:  A cache entry whose stack range contains
+   * the anchor belongs to this thread and no OS interface need be called.
+   */
+
+  anchor = (uintptr_t)&stackinfo;
+
+  for (i = 0; i < CONFIG_TLS_INFO_CACHE_ENTRIES; i++)
+    {
+      entry = &g_tls_cache[i];
+      if (anchor - entry->stack_base < entry->stack_size)
+        {
+          return entry->info;
+        }
+    }
+#endif
 
   ret = nxsched_get_stackinfo(0, &stackinfo);
   if (ret >= 0)
@@ -68,6 +116,56 @@ FAR struct tls_info_s *tls_get_info(void)
        */
 
       info = (FAR struct tls_info_s *)stackinfo.stack_alloc_ptr;
+
+#ifdef CONFIG_TLS_INFO_CACHE
+      /* Invalidate any cached entry that overlaps the resolved stack
+       * range.  The memory may have been recycled from the stack of a
+       * thread that has exited.
+       */
+
+      for (i = 0; i < CONFIG_TLS_INFO_CACHE_ENTRIES; i++)
+        {
+          entry = &g_tls_cache[i];
+          if (entry->stack_size > 0 &&
+              (uintptr_t)info <
+                entry->stack_base + entry->stack_size &&
+              entry->stack_base <
+                (uintptr_t)stackinfo.adj_stack_ptr)
+            {
+              entry->stack_size = 0;
+            }
+        }
+
+      /* Then remember the new mapping, preferring an invalid entry and
+       * falling back to round-robin replacement.  The updates are ordered
+       * so that a concurrent lookup never matches a partially written
+       * entry:  The entry is invalid while stack_size is zero and the
+       * range is published last.
+       */
+
+      entry = NULL;
+      for (i = 0; i < CONFIG_TLS_INFO_CACHE_ENTRIES; i++)
+        {
+          if (g_tls_cache[i].stack_size == 0)
+            {
+              entry = &g_tls_cache[i];
+              break;
+            }
+        }
+
+      if (entry == NULL)
+        {
+          entry = &g_tls_cache[g_tls_cache_next];
+          g_tls_cache_next =
+            (g_tls_cache_next + 1) % CONFIG_TLS_INFO_CACHE_ENTRIES;
+        }
+
+      entry->stack_size = 0;
+      entry->info       = info;
+      entry->stack_base = (uintptr_t)info;
+      entry->stack_size = (uintptr_t)stackinfo.adj_stack_ptr -
+                          (uintptr_t)info;
+#endif
     }
 
   return info;
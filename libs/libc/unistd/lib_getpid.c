@@ -0,0 +1,65 @@
+/****************************************************************************
+ * libs/libc/unistd/lib_getpid.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <unistd.h>
+#include <syscall.h>
+
+#include <nuttx/usershare.h>
+
+#if defined(CONFIG_LIB_USERSHARE) && !defined(__KERNEL__)
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: getpid
+ *
+ * Description:
+ *   Return the task ID of the calling task without trapping into the
+ *   kernel:  The kernel stores the ID of the task to be resumed in the
+ *   shared information structure on every context switch, so the value
+ *   read here is always the ID of the currently executing task.  This
+ *   definition replaces the auto-generated system call proxy (see
+ *   syscall/syscall.csv).
+ *
+ ****************************************************************************/
+
+pid_t getpid(void)
+{
+  if ((g_usershare.us_flags & USERSHARE_PID) != 0 && g_usershare.us_pid > 0)
+    {
+      return g_usershare.us_pid;
+    }
+
+  /* Not yet registered (or the kernel does not maintain the PID in this
+   * configuration).  Trap into the kernel as the proxy would.
+   */
+
+  return (pid_t)sys_call0((unsigned int)SYS_getpid);
+}
+
+#endif /* CONFIG_LIB_USERSHARE && !__KERNEL__ */
@@ -29,6 +29,8 @@
 
 #include <sys/resource.h>
 
+#include <nuttx/sched.h>
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -48,6 +50,10 @@
  *   information for the child process is discarded and not included in the
  *   resource information provided by getrusage().
  *
+ *   If CONFIG_SCHED_RUSAGE is enabled, RUSAGE_SELF reports the counters
+ *   accumulated for the calling thread.  NuttX does not aggregate the
+ *   usage of terminated children; RUSAGE_CHILDREN always reports zeros.
+ *
  ****************************************************************************/
 
 int getrusage(int who, FAR struct rusage *r_usage)
@@ -58,6 +64,20 @@ int getrusage(int who, FAR struct rusage *r_usage)
       return ERROR;
     }
 
+#ifdef CONFIG_SCHED_RUSAGE
+  if (who == RUSAGE_SELF)
+    {
+      int ret = nxsched_get_rusage(0, r_usage);
+      if (ret < 0)
+        {
+          set_errno(-ret);
+          return ERROR;
+        }
+
+      return OK;
+    }
+#endif
+
   memset(r_usage, 0, sizeof(*r_usage));
   return OK;
 }
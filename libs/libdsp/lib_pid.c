@@ -144,6 +144,33 @@ void pi_saturation_set(FAR pid_controller_t *pid, float min, float max)
   pid_saturation_set(pid, min, max);
 }
 
+/****************************************************************************
+ * Name: pid_derivative_filter_set
+ *
+ * Description:
+ *   Set derivative part low-pass filter coefficient.  An unfiltered
+ *   derivative amplifies measurement noise, so most practical PID loops
+ *   need some filtering here.
+ *
+ * Input Parameters:
+ *   pid    - (out) pointer to the PID controller data
+ *   filter - (in) low-pass filter coefficient (0.0 - 1.0) where
+ *            1.0 gives unfiltered values and 0.0 disables filtering
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pid_derivative_filter_set(FAR pid_controller_t *pid, float filter)
+{
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(filter >= 0.0f);
+  DEBUGASSERT(filter <= 1.0f);
+
+  pid->d_filter = filter;
+}
+
 /****************************************************************************
  * Name: pid_integral_reset
  ****************************************************************************/
@@ -254,15 +281,28 @@ float pi_controller(FAR pid_controller_t *pid, float err)
 
 float pid_controller(FAR pid_controller_t *pid, float err)
 {
+  float d = 0.0f;
+
   DEBUGASSERT(pid != NULL);
 
   /* Get PI output */
 
   pi_controller(pid, err);
 
-  /* Get derivative part */
+  /* Get derivative part and low-pass filter it if the filter
+   * is configured
+   */
+
+  d = pid->KD * (err - pid->err_prev);
 
-  pid->part[2] = pid->KD * (err - pid->err_prev);
+  if (pid->d_filter > 0.0f)
+    {
+      LP_FILTER(pid->part[2], d, pid->d_filter);
+    }
+  else
+    {
+      pid->part[2] = d;
+    }
 
   /* Add derivative part to the PI part */
 
@@ -294,3 +334,71 @@ float pid_controller(FAR pid_controller_t *pid, float err)
 
   return pid->out;
 }
+
+/****************************************************************************
+ * Name: pi_controller_batch
+ *
+ * Description:
+ *   One step of a batch of PI controllers.  All controllers are stored in
+ *   a contiguous array and processed in a single sweep, so the per-tick
+ *   cost for a multi-loop controller is one call and one sequential pass
+ *   over the controller state.
+ *
+ * Input Parameters:
+ *   pid - (in/out) pointer to the array of PI controllers
+ *   num - (in) number of controllers in the array
+ *   err - (in) array of current controller errors
+ *   out - (out) array of controller outputs
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pi_controller_batch(FAR pid_controller_t *pid, int num,
+                         FAR float *err, FAR float *out)
+{
+  int i;
+
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(err != NULL);
+  DEBUGASSERT(out != NULL);
+
+  for (i = 0; i < num; i += 1)
+    {
+      out[i] = pi_controller(&pid[i], err[i]);
+    }
+}
+
+/****************************************************************************
+ * Name: pid_controller_batch
+ *
+ * Description:
+ *   One step of a batch of PID controllers.  All controllers are stored in
+ *   a contiguous array and processed in a single sweep.
+ *
+ * Input Parameters:
+ *   pid - (in/out) pointer to the array of PID controllers
+ *   num - (in) number of controllers in the array
+ *   err - (in) array of current controller errors
+ *   out - (out) array of controller outputs
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pid_controller_batch(FAR pid_controller_t *pid, int num,
+                          FAR float *err, FAR float *out)
+{
+  int i;
+
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(err != NULL);
+  DEBUGASSERT(out != NULL);
+
+  for (i = 0; i < num; i += 1)
+    {
+      out[i] = pid_controller(&pid[i], err[i]);
+    }
+}
@@ -0,0 +1,408 @@
+/****************************************************************************
+ * libs/libdsp/lib_pid_b16.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <dspb16.h>
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pid_controller_init_b16
+ *
+ * Description:
+ *   Initialize PID controller. This function does not initialize saturation
+ *   limits.
+ *
+ * Input Parameters:
+ *   pid - (out) pointer to the PID controller data
+ *   KP  - (in) proportional gain
+ *   KI  - (in) integral gain
+ *   KD  - (in) derivative gain
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pid_controller_init_b16(FAR pid_controller_b16_t *pid, b16_t KP,
+                             b16_t KI, b16_t KD)
+{
+  DEBUGASSERT(pid != NULL);
+
+  /* Reset controller data */
+
+  memset(pid, 0, sizeof(pid_controller_b16_t));
+
+  /* Copy controller parameters */
+
+  pid->KP = KP;
+  pid->KI = KI;
+  pid->KD = KD;
+}
+
+/****************************************************************************
+ * Name: pi_controller_init_b16
+ *
+ * Description:
+ *   Initialize PI controller. This function does not initialize saturation
+ *   limits.
+ *
+ * Input Parameters:
+ *   pid - (out) pointer to the PID controller data
+ *   KP  - (in) proportional gain
+ *   KI  - (in) integral gain
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pi_controller_init_b16(FAR pid_controller_b16_t *pid, b16_t KP,
+                            b16_t KI)
+{
+  DEBUGASSERT(pid != NULL);
+
+  /* Reset controller data */
+
+  memset(pid, 0, sizeof(pid_controller_b16_t));
+
+  /* Copy controller parameters */
+
+  pid->KP = KP;
+  pid->KI = KI;
+  pid->KD = 0;
+}
+
+/****************************************************************************
+ * Name: pid_saturation_set_b16
+ *
+ * Description:
+ *   Set controller saturation limits. Sometimes we need change saturation
+ *   configuration in the run-time, so this function is separate from
+ *   pid_controller_init_b16().
+ *
+ * Input Parameters:
+ *   pid - (out) pointer to the PID controller data
+ *   min - (in) lower limit
+ *   max - (in) upper limit
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pid_saturation_set_b16(FAR pid_controller_b16_t *pid, b16_t min,
+                            b16_t max)
+{
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(min < max);
+
+  pid->sat.max = max;
+  pid->sat.min = min;
+}
+
+/****************************************************************************
+ * Name: pi_saturation_set_b16
+ *
+ * Description:
+ *
+ * Input Parameters:
+ *   pid - (out) pointer to the PID controller data
+ *   min - (in) lower limit
+ *   max - (in) upper limit
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pi_saturation_set_b16(FAR pid_controller_b16_t *pid, b16_t min,
+                           b16_t max)
+{
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(min < max);
+
+  pid_saturation_set_b16(pid, min, max);
+}
+
+/****************************************************************************
+ * Name: pid_derivative_filter_set_b16
+ *
+ * Description:
+ *   Set derivative part low-pass filter coefficient.  An unfiltered
+ *   derivative amplifies measurement noise, so most practical PID loops
+ *   need some filtering here.
+ *
+ * Input Parameters:
+ *   pid    - (out) pointer to the PID controller data
+ *   filter - (in) low-pass filter coefficient (0.0 - 1.0) where
+ *            1.0 gives unfiltered values and 0 disables filtering
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pid_derivative_filter_set_b16(FAR pid_controller_b16_t *pid,
+                                   b16_t filter)
+{
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(filter >= 0);
+  DEBUGASSERT(filter <= b16ONE);
+
+  pid->d_filter = filter;
+}
+
+/****************************************************************************
+ * Name: pid_integral_reset_b16
+ ****************************************************************************/
+
+void pid_integral_reset_b16(FAR pid_controller_b16_t *pid)
+{
+  pid->part[1] = 0;
+}
+
+/****************************************************************************
+ * Name: pi_integral_reset_b16
+ ****************************************************************************/
+
+void pi_integral_reset_b16(FAR pid_controller_b16_t *pid)
+{
+  pid_integral_reset_b16(pid);
+}
+
+/****************************************************************************
+ * Name: pi_controller_b16
+ *
+ * Description:
+ *   PI controller with output saturation and windup protection
+ *
+ * Input Parameters:
+ *   pid - (in/out) pointer to the PI controller data
+ *   err - (in) current controller error
+ *
+ * Returned Value:
+ *   Return controller output.
+ *
+ ****************************************************************************/
+
+b16_t pi_controller_b16(FAR pid_controller_b16_t *pid, b16_t err)
+{
+  DEBUGASSERT(pid != NULL);
+
+  /* Store error in controller structure */
+
+  pid->err = err;
+
+  /* Get proportional part */
+
+  pid->part[0] = b16mulb16(pid->KP, err);
+
+  /* Get intergral part */
+
+  pid->part[1] += b16mulb16(pid->KI, err);
+
+  /* Add proportional, integral */
+
+  pid->out = pid->part[0] + pid->part[1];
+
+  /* Saturate output only if we are not in a PID calculation and only
+   * if some limits are set. Saturation for a PID controller are done later
+   * in PID routine.
+   */
+
+  if (pid->sat.max != pid->sat.min && pid->KD == 0)
+    {
+      if (pid->out > pid->sat.max)
+        {
+          /* Limit output to the upper limit */
+
+          pid->out = pid->sat.max;
+
+          /* Integral anti-windup - reset integral part */
+
+          if (err > 0)
+            {
+              pi_integral_reset_b16(pid);
+            }
+        }
+      else if (pid->out < pid->sat.min)
+        {
+          /* Limit output to the lower limit */
+
+          pid->out = pid->sat.min;
+
+          /* Integral anti-windup - reset integral part */
+
+          if (err < 0)
+            {
+              pi_integral_reset_b16(pid);
+            }
+        }
+    }
+
+  /* Return regulator output */
+
+  return pid->out;
+}
+
+/****************************************************************************
+ * Name: pid_controller_b16
+ *
+ * Description:
+ *   PID controller with output saturation and windup protection
+ *
+ * Input Parameters:
+ *   pid - (in/out) pointer to the PID controller data
+ *   err - (in) current controller error
+ *
+ * Returned Value:
+ *   Return controller output.
+ *
+ ****************************************************************************/
+
+b16_t pid_controller_b16(FAR pid_controller_b16_t *pid, b16_t err)
+{
+  b16_t d = 0;
+
+  DEBUGASSERT(pid != NULL);
+
+  /* Get PI output */
+
+  pi_controller_b16(pid, err);
+
+  /* Get derivative part and low-pass filter it if the filter
+   * is configured
+   */
+
+  d = b16mulb16(pid->KD, err - pid->err_prev);
+
+  if (pid->d_filter > 0)
+    {
+      LP_FILTER_B16(pid->part[2], d, pid->d_filter);
+    }
+  else
+    {
+      pid->part[2] = d;
+    }
+
+  /* Add derivative part to the PI part */
+
+  pid->out += pid->part[2];
+
+  /* Store current error */
+
+  pid->err_prev = err;
+
+  /* Saturate output if limits are set */
+
+  if (pid->sat.max != pid->sat.min)
+    {
+      if (pid->out > pid->sat.max)
+        {
+          /* Limit output to the upper limit */
+
+          pid->out = pid->sat.max;
+        }
+      else if (pid->out < pid->sat.min)
+        {
+          /* Limit output to the lower limit */
+
+          pid->out = pid->sat.min;
+        }
+    }
+
+  /* Return regulator output */
+
+  return pid->out;
+}
+
+/****************************************************************************
+ * Name: pi_controller_batch_b16
+ *
+ * Description:
+ *   One step of a batch of PI controllers.  All controllers are stored in
+ *   a contiguous array and processed in a single sweep, so the per-tick
+ *   cost for a multi-loop controller is one call and one sequential pass
+ *   over the controller state.
+ *
+ * Input Parameters:
+ *   pid - (in/out) pointer to the array of PI controllers
+ *   num - (in) number of controllers in the array
+ *   err - (in) array of current controller errors
+ *   out - (out) array of controller outputs
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pi_controller_batch_b16(FAR pid_controller_b16_t *pid, int num,
+                             FAR b16_t *err, FAR b16_t *out)
+{
+  int i;
+
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(err != NULL);
+  DEBUGASSERT(out != NULL);
+
+  for (i = 0; i < num; i += 1)
+    {
+      out[i] = pi_controller_b16(&pid[i], err[i]);
+    }
+}
+
+/****************************************************************************
+ * Name: pid_controller_batch_b16
+ *
+ * Description:
+ *   One step of a batch of PID controllers.  All controllers are stored in
+ *   a contiguous array and processed in a single sweep.
+ *
+ * Input Parameters:
+ *   pid - (in/out) pointer to the array of PID controllers
+ *   num - (in) number of controllers in the array
+ *   err - (in) array of current controller errors
+ *   out - (out) array of controller outputs
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pid_controller_batch_b16(FAR pid_controller_b16_t *pid, int num,
+                              FAR b16_t *err, FAR b16_t *out)
+{
+  int i;
+
+  DEBUGASSERT(pid != NULL);
+  DEBUGASSERT(err != NULL);
+  DEBUGASSERT(out != NULL);
+
+  for (i = 0; i < num; i += 1)
+    {
+      out[i] = pid_controller_b16(&pid[i], err[i]);
+    }
+}
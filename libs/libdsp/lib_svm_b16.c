@@ -0,0 +1,393 @@
+/****************************************************************************
+ * libs/libdsp/lib_svm_b16.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <assert.h>
+
+#include <dspb16.h>
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: svm3_sector_get_b16
+ *
+ * Description:
+ *   Get current sector for space vector modulation.
+ *
+ *   See svm3_sector_get() in lib_svm.c for the sector identification
+ *   diagram.
+ *
+ * Input Parameters:
+ *   ijk - (in) pointer to the auxiliary ABC frame
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static uint8_t svm3_sector_get_b16(FAR abc_frame_b16_t *ijk)
+{
+  uint8_t sector = 0;
+  b16_t i = ijk->a;
+  b16_t j = ijk->b;
+  b16_t k = ijk->c;
+
+  if (k <= 0)
+    {
+      if (i <= 0)
+        {
+          sector = 2;
+        }
+      else
+        {
+          if (j <= 0)
+            {
+              sector = 6;
+            }
+          else
+            {
+              sector = 1;
+            }
+        }
+    }
+  else
+    {
+      if (i <= 0)
+        {
+          if (j <= 0)
+            {
+              sector = 4;
+            }
+          else
+            {
+              sector = 3;
+            }
+        }
+      else
+        {
+          sector = 5;
+        }
+    }
+
+  /* Return SVM sector */
+
+  return sector;
+}
+
+/****************************************************************************
+ * Name: svm3_duty_calc_b16
+ *
+ * Description:
+ *   Calculate duty cycles for space vector modulation.
+ *
+ * Input Parameters:
+ *   s   - (in/out) pointer to the SVM state data
+ *   ijk - (in) pointer to the auxiliary ABC frame
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static void svm3_duty_calc_b16(FAR struct svm3_state_b16_s *s,
+                               FAR abc_frame_b16_t *ijk)
+{
+  b16_t i = ijk->a;
+  b16_t j = ijk->b;
+  b16_t k = ijk->c;
+  b16_t T0 = 0;
+  b16_t T1 = 0;
+  b16_t T2 = 0;
+  b16_t T0_by_two = 0;
+
+  /* Determine T1, T2 and T0 based on the sector */
+
+  switch (s->sector)
+    {
+      case 1:
+        {
+          T1 = i;
+          T2 = j;
+          break;
+        }
+
+      case 2:
+        {
+          T1 = -k;
+          T2 = -i;
+          break;
+        }
+
+      case 3:
+        {
+          T1 = j;
+          T2 = k;
+          break;
+        }
+
+      case 4:
+        {
+          T1 = -i;
+          T2 = -j;
+          break;
+        }
+
+      case 5:
+        {
+          T1 = k;
+          T2 = i;
+          break;
+        }
+
+      case 6:
+        {
+          T1 = -j;
+          T2 = -k;
+          break;
+        }
+
+      default:
+        {
+          /* We should not get here */
+
+          DEBUGASSERT(0);
+          break;
+        }
+    }
+
+  /* Get null vector time */
+
+  T0 = b16ONE - T1 - T2;
+  T0_by_two = b16mulb16(T0, b16HALF);
+
+  /* Calculate duty cycle for 3 phase */
+
+  switch (s->sector)
+    {
+      case 1:
+        {
+          s->d_u = T1 + T2 + T0_by_two;
+          s->d_v = T2 + T0_by_two;
+          s->d_w = T0_by_two;
+          break;
+        }
+
+      case 2:
+        {
+          s->d_u = T1 + T0_by_two;
+          s->d_v = T1 + T2 + T0_by_two;
+          s->d_w = T0_by_two;
+          break;
+        }
+
+      case 3:
+        {
+          s->d_u = T0_by_two;
+          s->d_v = T1 + T2 + T0_by_two;
+          s->d_w = T2 + T0_by_two;
+          break;
+        }
+
+      case 4:
+        {
+          s->d_u = T0_by_two;
+          s->d_v = T1 + T0_by_two;
+          s->d_w = T1 + T2 + T0_by_two;
+          break;
+        }
+
+      case 5:
+        {
+          s->d_u = T2 + T0_by_two;
+          s->d_v = T0_by_two;
+          s->d_w = T1 + T2 + T0_by_two;
+          break;
+        }
+
+      case 6:
+        {
+          s->d_u = T1 + T2 + T0_by_two;
+          s->d_v = T0_by_two;
+          s->d_w = T1 + T0_by_two;
+          break;
+        }
+
+      default:
+        {
+          /* We should not get here */
+
+          DEBUGASSERT(0);
+          break;
+        }
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: svm3_b16
+ *
+ * Description:
+ *   One step of the space vector modulation.
+ *   This is most common of SVM with alternate-reverse null vector.
+ *
+ *   See svm3() in lib_svm.c for the voltage vector definitions.
+ *
+ * Input Parameters:
+ *   s    - (out) pointer to the SVM data
+ *   v_ab - (in) pointer to the modulation voltage vector in alpha-beta
+ *          frame, normalized to magnitude (0.0 - 1.0)
+ *
+ * NOTE: v_ab vector magnitude must be in range <0.0, 1.0> to get correct
+ *       SVM3 results.
+ *
+ ****************************************************************************/
+
+void svm3_b16(FAR struct svm3_state_b16_s *s, FAR ab_frame_b16_t *v_ab)
+{
+  DEBUGASSERT(s != NULL);
+  DEBUGASSERT(v_ab != NULL);
+
+  abc_frame_b16_t ijk;
+
+  /* Perform modified inverse Clarke-transformation (alpha,beta) -> (i,j,k)
+   * to obtain auxiliary frame which will be used in further calculations.
+   */
+
+  ijk.a = b16mulb16(-b16HALF, v_ab->b) +
+          b16mulb16(SQRT3_BY_TWO_B16, v_ab->a);
+  ijk.b = v_ab->b;
+  ijk.c = -ijk.b - ijk.a;
+
+  /* Get vector sector */
+
+  s->sector = svm3_sector_get_b16(&ijk);
+
+  /* Get duty cycle */
+
+  svm3_duty_calc_b16(s, &ijk);
+
+  /* Saturate output from SVM */
+
+  f_saturate_b16(&s->d_u, s->d_min, s->d_max);
+  f_saturate_b16(&s->d_v, s->d_min, s->d_max);
+  f_saturate_b16(&s->d_w, s->d_min, s->d_max);
+}
+
+/****************************************************************************
+ * Name: svm3_current_correct_b16
+ *
+ * Description:
+ *   Correct ADC samples (int32) according to SVM3 state.
+ *   NOTE: This works only with 3 shunt resistors configuration.
+ *
+ ****************************************************************************/
+
+void svm3_current_correct_b16(FAR struct svm3_state_b16_s *s,
+                              int32_t *c0, int32_t *c1, int32_t *c2)
+{
+  /* Get best ADC samples according to SVM sector.
+   *
+   * In SVM phase current can be sampled only in v0 vector state, when lower
+   * bridge transistors are turned on.
+   *
+   * We ignore sample from phase which has the shortest V0 state and
+   * estimate its value with KCL for motor phases:
+   *    i_a + i_b + i_c = 0
+   */
+
+  switch (s->sector)
+    {
+      case 1:
+      case 6:
+        {
+          /* Sector 1-6: ignore phase 1 */
+
+          *c0 = -(*c1 + *c2);
+
+          break;
+        }
+
+      case 2:
+      case 3:
+        {
+          /* Sector 2-3: ignore phase 2 */
+
+          *c1 = -(*c0 + *c2);
+
+          break;
+        }
+
+      case 4:
+      case 5:
+        {
+          /* Sector 4-5: ignore phase 3 */
+
+          *c2 = -(*c0 + *c1);
+
+          break;
+        }
+
+      default:
+        {
+          /* We should not get here. */
+
+          *c0 = 0;
+          *c1 = 0;
+          *c2 = 0;
+
+          break;
+        }
+    }
+}
+
+/****************************************************************************
+ * Name: svm3_init_b16
+ *
+ * Description:
+ *   Initialize 3-phase SVM data.
+ *
+ * Input Parameters:
+ *   s - (in/out) pointer to the SVM state data
+ *   min - (in) lower duty cycle limit
+ *   max - (in) upper duty cycle limit
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void svm3_init_b16(FAR struct svm3_state_b16_s *s, b16_t min, b16_t max)
+{
+  DEBUGASSERT(s != NULL);
+  DEBUGASSERT(max > min);
+
+  memset(s, 0, sizeof(struct svm3_state_b16_s));
+
+  s->d_max = max;
+  s->d_min = min;
+}
@@ -0,0 +1,166 @@
+/****************************************************************************
+ * libs/libdsp/lib_transform_b16.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <dspb16.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: B16_DOT2
+ *
+ * Description:
+ *   Dot product of two b16 2D vectors with a b32 accumulator.
+ *
+ *   The products are accumulated in 64-bits and truncated to b16 only
+ *   once, which both preserves one more bit of precision than chained
+ *   b16mulb16() calls and lets the compiler emit the single-cycle long
+ *   multiply-accumulate instructions (SMULL/SMLAL on ARMv7-M) for the
+ *   whole expression.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_HAVE_LONG_LONG
+#  define B16_DOT2(x1, y1, x2, y2) \
+     (b32tob16((b32_t)(x1) * (b32_t)(y1) + (b32_t)(x2) * (b32_t)(y2)))
+#else
+#  define B16_DOT2(x1, y1, x2, y2) \
+     (b16mulb16(x1, y1) + b16mulb16(x2, y2))
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: Clarke transform (abc frame -> ab frame)
+ *
+ * Description:
+ *   Transform the abc frame to the alpha-beta frame.
+ *
+ *   See clarke_transform() in lib_transform.c for details.
+ *
+ * Input Parameters:
+ *   abc - (in) pointer to the abc frame
+ *   ab  - (out) pointer to the alpha-beta frame
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void clarke_transform_b16(FAR abc_frame_b16_t *abc,
+                          FAR ab_frame_b16_t *ab)
+{
+  DEBUGASSERT(abc != NULL);
+  DEBUGASSERT(ab != NULL);
+
+  ab->a = abc->a;
+  ab->b = B16_DOT2(ONE_BY_SQRT3_B16, abc->a, TWO_BY_SQRT3_B16, abc->b);
+}
+
+/****************************************************************************
+ * Name: Inverse Clarke transform (ab frame -> abc frame)
+ *
+ * Description:
+ *   Transform the alpha-beta frame to the abc frame.
+ *
+ * Input Parameters:
+ *   ab  - (in) pointer to the alpha-beta frame
+ *   abc - (out) pointer to the abc frame
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void inv_clarke_transform_b16(FAR ab_frame_b16_t *ab,
+                              FAR abc_frame_b16_t *abc)
+{
+  DEBUGASSERT(ab != NULL);
+  DEBUGASSERT(abc != NULL);
+
+  /* Assume non-power-invariant transform and balanced system */
+
+  abc->a = ab->a;
+  abc->b = B16_DOT2(-b16HALF, ab->a, SQRT3_BY_TWO_B16, ab->b);
+  abc->c = -abc->a - abc->b;
+}
+
+/****************************************************************************
+ * Name: Park transform (ab frame -> dq frame)
+ *
+ * Description:
+ *   Transform the alpha-beta frame to the direct-quadrature frame.
+ *
+ * Input Parameters:
+ *   angle - (in) pointer to the phase angle data
+ *   ab    - (in) pointer to the alpha-beta frame
+ *   dq    - (out) pointer to the direct-quadrature frame
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void park_transform_b16(FAR phase_angle_b16_t *angle,
+                        FAR ab_frame_b16_t *ab,
+                        FAR dq_frame_b16_t *dq)
+{
+  DEBUGASSERT(angle != NULL);
+  DEBUGASSERT(ab != NULL);
+  DEBUGASSERT(dq != NULL);
+
+  dq->d = B16_DOT2(angle->cos, ab->a, angle->sin, ab->b);
+  dq->q = B16_DOT2(angle->cos, ab->b, -angle->sin, ab->a);
+}
+
+/****************************************************************************
+ * Name: Inverse Park transform (dq frame -> ab frame)
+ *
+ * Description:
+ *   Transform direct-quadrature frame to alpha-beta frame.
+ *
+ * Input Parameters:
+ *   angle - (in) pointer to the phase angle data
+ *   dq    - (in) pointer to the direct-quadrature frame
+ *   ab    - (out) pointer to the alpha-beta frame
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void inv_park_transform_b16(FAR phase_angle_b16_t *angle,
+                            FAR dq_frame_b16_t *dq,
+                            FAR ab_frame_b16_t *ab)
+{
+  DEBUGASSERT(angle != NULL);
+  DEBUGASSERT(dq != NULL);
+  DEBUGASSERT(ab != NULL);
+
+  ab->a = B16_DOT2(angle->cos, dq->d, -angle->sin, dq->q);
+  ab->b = B16_DOT2(angle->cos, dq->q, angle->sin, dq->d);
+}
@@ -162,6 +162,14 @@ NXHANDLE nx_connectinstance(FAR const char *svrmqname)
       goto errout_with_rmq;
     }
 
+#ifdef CONFIG_NX_MSGRING
+  /* Initialize the shared-memory message ring.  This must be done before
+   * the first message (the connect message below) is sent to the server.
+   */
+
+  nxmu_ring_init(&conn->ring);
+#endif
+
   /* Inform the server that this client exists */
 
   outmsg.msgid = NX_SVRMSG_CONNECT;
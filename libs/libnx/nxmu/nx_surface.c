@@ -0,0 +1,245 @@
+/****************************************************************************
+ * libs/libnx/nxmu/nx_surface.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/semaphore.h>
+#include <nuttx/nx/nx.h>
+#include <nuttx/nx/nxbe.h>
+#include <nuttx/nx/nxmu.h>
+
+#ifdef CONFIG_NX_CLIENTSURFACE
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nx_surfinit
+ *
+ * Description:
+ *   Initialize a client-rendered surface.  The caller provides the pixel
+ *   buffer; the surface structure only records how the buffer is laid out
+ *   and which portions of it have been damaged since the last flush.
+ *
+ * Input Parameters:
+ *   surf   - The surface structure to be initialized
+ *   buffer - The start of the client-rendered image.  This is an array of
+ *            source images of size CONFIG_NX_NPLANES.
+ *   size   - The size of the surface in pixels.  Surface pixel (x,y)
+ *            corresponds to window position (x,y); the surface would
+ *            normally be the same size as the window.
+ *   stride - The width of the full source image in bytes.
+ *
+ * Returned Value:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+int nx_surfinit(FAR struct nx_surface_s *surf,
+                FAR const void *buffer[CONFIG_NX_NPLANES],
+                FAR const struct nxgl_size_s *size, unsigned int stride)
+{
+  int i;
+
+#ifdef CONFIG_DEBUG_FEATURES
+  if (!surf || !buffer || !size)
+    {
+      set_errno(EINVAL);
+      return ERROR;
+    }
+#endif
+
+  for (i = 0; i < CONFIG_NX_NPLANES; i++)
+    {
+      surf->buffer[i] = buffer[i];
+    }
+
+  surf->bounds.pt1.x = 0;
+  surf->bounds.pt1.y = 0;
+  surf->bounds.pt2.x = size->w - 1;
+  surf->bounds.pt2.y = size->h - 1;
+  surf->stride       = stride;
+  surf->isdirty      = false;
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nx_surfdamage
+ *
+ * Description:
+ *   Report that the client has modified a rectangular region of the
+ *   surface buffer.  Damage accumulates into a single bounding rectangle
+ *   until the surface is flushed.  No server communication occurs.
+ *
+ * Input Parameters:
+ *   surf - The surface that was modified
+ *   rect - The modified region (in surface/window coordinates)
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void nx_surfdamage(FAR struct nx_surface_s *surf,
+                   FAR const struct nxgl_rect_s *rect)
+{
+  struct nxgl_rect_s clipped;
+
+#ifdef CONFIG_DEBUG_FEATURES
+  if (!surf || !rect)
+    {
+      return;
+    }
+#endif
+
+  /* Clip the damage to the surface bounds and discard degenerate damage */
+
+  nxgl_rectintersect(&clipped, rect, &surf->bounds);
+  if (nxgl_nullrect(&clipped))
+    {
+      return;
+    }
+
+  /* Merge the damage into the accumulated dirty rectangle */
+
+  if (surf->isdirty)
+    {
+      nxgl_rectunion(&surf->dirty, &surf->dirty, &clipped);
+    }
+  else
+    {
+      nxgl_rectcopy(&surf->dirty, &clipped);
+      surf->isdirty = true;
+    }
+}
+
+/****************************************************************************
+ * Name: nx_surfflush
+ *
+ * Description:
+ *   Hand the damaged region of a client-rendered surface to the server for
+ *   composition into the window.  However many drawing operations the
+ *   client performed on the buffer since the last flush, this sends a
+ *   single bitmap update covering the accumulated damage rectangle.  The
+ *   call does not return until the server has consumed the buffer, so the
+ *   client may begin rendering the next frame immediately.
+ *
+ * Input Parameters:
+ *   hwnd - The window that will receive the surface contents
+ *   surf - The surface to be flushed
+ *
+ * Returned Value:
+ *   OK on success; ERROR on failure with errno set appropriately
+ *
+ ****************************************************************************/
+
+int nx_surfflush(NXWINDOW hwnd, FAR struct nx_surface_s *surf)
+{
+  FAR struct nxbe_window_s *wnd = (FAR struct nxbe_window_s *)hwnd;
+  struct nxsvrmsg_bitmap_s outmsg;
+  sem_t sem_done;
+  int i;
+  int ret;
+
+#ifdef CONFIG_DEBUG_FEATURES
+  if (!wnd || !surf)
+    {
+      set_errno(EINVAL);
+      return ERROR;
+    }
+#endif
+
+  /* If the client has reported no damage, then there is nothing to do */
+
+  if (!surf->isdirty)
+    {
+      return OK;
+    }
+
+  /* Format the bitmap command.  Because surface pixel (x,y) corresponds to
+   * window position (x,y), the bitmap origin is always the window origin.
+   */
+
+  outmsg.msgid      = NX_SVRMSG_BITMAP;
+  outmsg.wnd        = wnd;
+  outmsg.stride     = surf->stride;
+
+  for (i = 0; i < CONFIG_NX_NPLANES; i++)
+    {
+      outmsg.src[i] = surf->buffer[i];
+    }
+
+  outmsg.origin.x   = 0;
+  outmsg.origin.y   = 0;
+  nxgl_rectcopy(&outmsg.dest, &surf->dirty);
+
+  /* Create a semaphore for tracking command completion */
+
+  outmsg.sem_done = &sem_done;
+
+  ret = _SEM_INIT(&sem_done, 0, 0);
+  if (ret < 0)
+    {
+      gerr("ERROR: _SEM_INIT failed: %d\n", _SEM_ERRNO(ret));
+      return ret;
+    }
+
+  /* The sem_done semaphore is used for signaling and, hence, should not
+   * have priority inheritance enabled.
+   */
+
+  _SEM_SETPROTOCOL(&sem_done, SEM_PRIO_NONE);
+
+  /* Forward the bitmap command to the server */
+
+  ret = nxmu_sendwindow(wnd, &outmsg, sizeof(struct nxsvrmsg_bitmap_s));
+
+  /* Wait that the command is completed, so that the client can render the
+   * next frame into the buffer.
+   */
+
+  if (ret == OK)
+    {
+      ret = _SEM_WAIT(&sem_done);
+    }
+
+  /* Destroy the semaphore and return */
+
+  _SEM_DESTROY(&sem_done);
+
+  if (ret == OK)
+    {
+      surf->isdirty = false;
+    }
+
+  return ret;
+}
+
+#endif /* CONFIG_NX_CLIENTSURFACE */
@@ -0,0 +1,271 @@
+/****************************************************************************
+ * libs/libnx/nxmu/nxmu_msgring.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <mqueue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/semaphore.h>
+#include <nuttx/mqueue.h>
+#include <nuttx/nx/nxmu.h>
+
+#ifdef CONFIG_NX_MSGRING
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxmu_ring_init
+ *
+ * Description:
+ *   Initialize a client message ring to the empty state.
+ *
+ ****************************************************************************/
+
+void nxmu_ring_init(FAR struct nxmu_msgring_s *ring)
+{
+  _SEM_INIT(&ring->exsem, 0, 1);
+  _SEM_INIT(&ring->spacesem, 0, 0);
+  ring->waiting = false;
+  ring->head    = 0;
+  ring->tail    = 0;
+}
+
+/****************************************************************************
+ * Name: nxmu_ring_put
+ *
+ * Description:
+ *   Write one message into the connection's shared-memory ring, blocking
+ *   if the ring is full until the server has drained it.  If the ring was
+ *   empty, a doorbell message is sent on the connection's server message
+ *   queue to wake the server; otherwise the server is already scheduled
+ *   to drain the ring and no wakeup is needed.
+ *
+ ****************************************************************************/
+
+int nxmu_ring_put(FAR struct nxmu_conn_s *conn, FAR const void *msg,
+                  size_t msglen)
+{
+  FAR struct nxmu_msgring_s *ring = &conn->ring;
+  struct nxsvrmsg_s doorbell;
+  uint16_t reclen = (uint16_t)msglen;
+  uint16_t oldhead;
+  uint16_t head;
+  uint16_t used;
+  uint16_t need;
+  uint16_t pos;
+  int ret = OK;
+
+  DEBUGASSERT(msglen > 0 && msglen <= NX_MXSVRMSGLEN);
+
+  /* Only one client thread at a time may write to the ring */
+
+  nxmu_semtake(&ring->exsem);
+
+  /* Wait until there is space in the ring for the record.  One byte is
+   * always left unused so that head == tail unambiguously means empty.
+   * If the record would not fit contiguously before the end of the
+   * buffer, then the space skipped by the wrap marker is needed as well.
+   */
+
+  for (; ; )
+    {
+      head = ring->head;
+      if (head >= ring->tail)
+        {
+          used = head - ring->tail;
+        }
+      else
+        {
+          used = CONFIG_NX_MSGRING_BUFSIZE - (ring->tail - head);
+        }
+
+      need = NX_RING_HDRSIZE + reclen;
+      if (head + need > CONFIG_NX_MSGRING_BUFSIZE)
+        {
+          need += CONFIG_NX_MSGRING_BUFSIZE - head;
+        }
+
+      if (need <= CONFIG_NX_MSGRING_BUFSIZE - 1 - used)
+        {
+          break;
+        }
+
+      /* The ring is full.  Since it is full it is certainly non-empty, so
+       * the server has a doorbell pending (or is draining right now) and
+       * is guaranteed to check the waiting flag when it drains.  Note the
+       * re-check after setting the flag:  The server may have drained the
+       * ring before the flag became visible, in which case no post is
+       * coming and we must not wait.
+       */
+
+      ring->waiting = true;
+      if (ring->head != ring->tail)
+        {
+          nxmu_semtake(&ring->spacesem);
+        }
+    }
+
+  /* Copy the record into the ring.  If it does not fit contiguously, mark
+   * the remainder of the buffer as skipped and continue at offset zero.
+   * The wrap marker needs two bytes itself; if fewer remain, the reader
+   * wraps implicitly.
+   */
+
+  oldhead = head;
+  pos     = head;
+
+  if (pos + NX_RING_HDRSIZE + reclen > CONFIG_NX_MSGRING_BUFSIZE)
+    {
+      if (CONFIG_NX_MSGRING_BUFSIZE - pos >= NX_RING_HDRSIZE)
+        {
+          uint16_t wrap = NX_RING_WRAP;
+          memcpy(&ring->buffer[pos], &wrap, NX_RING_HDRSIZE);
+        }
+
+      pos = 0;
+    }
+
+  memcpy(&ring->buffer[pos], &reclen, NX_RING_HDRSIZE);
+  memcpy(&ring->buffer[pos + NX_RING_HDRSIZE], msg, reclen);
+
+  /* Publish the record by advancing the head index */
+
+  pos += NX_RING_HDRSIZE + reclen;
+  if (pos >= CONFIG_NX_MSGRING_BUFSIZE)
+    {
+      pos = 0;
+    }
+
+  ring->head = pos;
+
+  /* Ring the doorbell if the server has consumed everything up to the old
+   * head index:  Either the ring was empty before the record was written,
+   * or the server drained it and may have gone back to sleep just before
+   * the new record became visible.  If the tail has not caught up with
+   * the old head, then the server still has older records to drain and
+   * will find this one in the same pass.  A redundant doorbell only costs
+   * the server one empty drain pass.
+   */
+
+  if (ring->tail == oldhead)
+    {
+      doorbell.msgid = NX_SVRMSG_RINGDATA;
+      doorbell.conn  = conn;
+
+      ret = _MQ_SEND(conn->cwrmq, (FAR const char *)&doorbell,
+                     sizeof(struct nxsvrmsg_s), NX_SVRMSG_PRIO);
+      if (ret < 0)
+        {
+          gerr("ERROR: _MQ_SEND failed: %d\n", _MQ_GETERRNO(ret));
+        }
+    }
+
+  nxmu_semgive(&ring->exsem);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxmu_ring_get
+ *
+ * Description:
+ *   Copy the oldest message out of a client message ring.  This is called
+ *   only from the server message loop.  If a client is waiting for ring
+ *   space, it is signaled after the record is consumed.
+ *
+ ****************************************************************************/
+
+ssize_t nxmu_ring_get(FAR struct nxmu_msgring_s *ring, FAR void *buffer,
+                      size_t buflen)
+{
+  uint16_t tail = ring->tail;
+  uint16_t reclen;
+
+  DEBUGASSERT(buflen >= NX_MXSVRMSGLEN);
+
+  /* Find the next record, handling both the explicit wrap marker and the
+   * implicit wrap when fewer bytes than a record header remain.
+   */
+
+  for (; ; )
+    {
+      if (tail == ring->head)
+        {
+          /* The ring is empty.  Release any client waiting for space. */
+
+          if (ring->waiting)
+            {
+              ring->waiting = false;
+              nxmu_semgive(&ring->spacesem);
+            }
+
+          return 0;
+        }
+
+      if (CONFIG_NX_MSGRING_BUFSIZE - tail < NX_RING_HDRSIZE)
+        {
+          tail = 0;
+          continue;
+        }
+
+      memcpy(&reclen, &ring->buffer[tail], NX_RING_HDRSIZE);
+      if (reclen == NX_RING_WRAP)
+        {
+          tail = 0;
+          continue;
+        }
+
+      break;
+    }
+
+  DEBUGASSERT(reclen > 0 && reclen <= NX_MXSVRMSGLEN);
+  memcpy(buffer, &ring->buffer[tail + NX_RING_HDRSIZE], reclen);
+
+  /* Release the record by advancing the tail index */
+
+  tail += NX_RING_HDRSIZE + reclen;
+  if (tail >= CONFIG_NX_MSGRING_BUFSIZE)
+    {
+      tail = 0;
+    }
+
+  ring->tail = tail;
+
+  /* Release any client waiting for the space just recovered */
+
+  if (ring->waiting)
+    {
+      ring->waiting = false;
+      nxmu_semgive(&ring->spacesem);
+    }
+
+  return (ssize_t)reclen;
+}
+
+#endif /* CONFIG_NX_MSGRING */
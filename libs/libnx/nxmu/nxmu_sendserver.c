@@ -83,11 +83,19 @@ int nxmu_sendserver(FAR struct nxmu_conn_s *conn, FAR const void *msg,
 
   /* Send the message to the server */
 
+#ifdef CONFIG_NX_MSGRING
+  ret = nxmu_ring_put(conn, msg, msglen);
+  if (ret < 0)
+    {
+      gerr("ERROR: nxmu_ring_put failed: %d\n", ret);
+    }
+#else
   ret = _MQ_SEND(conn->cwrmq, msg, msglen, NX_SVRMSG_PRIO);
   if (ret < 0)
     {
       gerr("ERROR: _MQ_SEND failed: %d\n", _MQ_GETERRNO(ret));
     }
+#endif
 
   return ret;
 }
@@ -414,6 +414,129 @@ ssize_t circbuf_write(FAR struct circbuf_s *circ,
   return bytes;
 }
 
+/****************************************************************************
+ * Name: circbuf_get_writeptr
+ *
+ * Description:
+ *   Reserve linear space at the head of the circular buffer for writing
+ *   without copying.  The returned span may be used directly as a DMA
+ *   target; the write is published afterwards with circbuf_writecommit().
+ *
+ * Note :
+ *   The tail index is read with an acquire atomic and the head index is
+ *   published with a release atomic, so a single producer (e.g. an ISR or
+ *   a DMA completion handler) and a single consumer may use the reserve/
+ *   commit and acquire/release interfaces with no critical section at all.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   size  - Returns the number of contiguous bytes that may be written.
+ *
+ * Returned Value:
+ *   The address of the reserved linear space.
+ ****************************************************************************/
+
+FAR void *circbuf_get_writeptr(FAR struct circbuf_s *circ, FAR size_t *size)
+{
+  size_t space;
+  size_t tail;
+  size_t off;
+
+  DEBUGASSERT(circ && size);
+
+  tail  = __atomic_load_n(&circ->tail, __ATOMIC_ACQUIRE);
+  off   = circ->head % circ->size;
+  space = circ->size - (circ->head - tail);
+
+  if (space > circ->size - off)
+    {
+      space = circ->size - off;
+    }
+
+  *size = space;
+  return circ->base + off;
+}
+
+/****************************************************************************
+ * Name: circbuf_writecommit
+ *
+ * Description:
+ *   Publish bytes previously written into the space returned by
+ *   circbuf_get_writeptr().  Only after this call may the consumer see
+ *   the new data.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   bytes - Number of bytes written, not more than the size returned by
+ *           circbuf_get_writeptr().
+ ****************************************************************************/
+
+void circbuf_writecommit(FAR struct circbuf_s *circ, size_t bytes)
+{
+  DEBUGASSERT(circ);
+  __atomic_store_n(&circ->head, circ->head + bytes, __ATOMIC_RELEASE);
+}
+
+/****************************************************************************
+ * Name: circbuf_get_readptr
+ *
+ * Description:
+ *   Get a pointer to the linear run of data at the tail of the circular
+ *   buffer for zero-copy consumption.  The data remains in the buffer
+ *   until it is released with circbuf_readcommit().
+ *
+ * Note :
+ *   See the note in circbuf_get_writeptr():  with one producer and one
+ *   consumer no locking is needed around these interfaces.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   size  - Returns the number of contiguous bytes that may be read.
+ *
+ * Returned Value:
+ *   The address of the data at the tail of the buffer.
+ ****************************************************************************/
+
+FAR void *circbuf_get_readptr(FAR struct circbuf_s *circ, FAR size_t *size)
+{
+  size_t head;
+  size_t len;
+  size_t off;
+
+  DEBUGASSERT(circ && size);
+
+  head = __atomic_load_n(&circ->head, __ATOMIC_ACQUIRE);
+  off  = circ->tail % circ->size;
+  len  = head - circ->tail;
+
+  if (len > circ->size - off)
+    {
+      len = circ->size - off;
+    }
+
+  *size = len;
+  return circ->base + off;
+}
+
+/****************************************************************************
+ * Name: circbuf_readcommit
+ *
+ * Description:
+ *   Release bytes previously acquired with circbuf_get_readptr(), making
+ *   the space available to the producer again.
+ *
+ * Input Parameters:
+ *   circ  - Address of the circular buffer to be used.
+ *   bytes - Number of bytes consumed, not more than the size returned by
+ *           circbuf_get_readptr().
+ ****************************************************************************/
+
+void circbuf_readcommit(FAR struct circbuf_s *circ, size_t bytes)
+{
+  DEBUGASSERT(circ);
+  __atomic_store_n(&circ->tail, circ->tail + bytes, __ATOMIC_RELEASE);
+}
+
 /****************************************************************************
  * Name: circbuf_overwrite
  *
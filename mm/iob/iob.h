@@ -67,6 +67,15 @@
  * Public Data
  ****************************************************************************/
 
+#ifdef CONFIG_IOB_OWNER_TRACKING
+/* The pool of pre-allocated I/O buffers.  The ownership tracking logic
+ * needs the pool base address to map an I/O buffer to its side-table
+ * entry.
+ */
+
+extern struct iob_s g_iob_pool[CONFIG_IOB_NBUFFERS];
+#endif
+
 /* A list of all free, unallocated I/O buffers */
 
 extern FAR struct iob_s *g_iob_freelist;
@@ -198,5 +207,62 @@ void iob_stats_onalloc(enum iob_user_e consumerid);
 void iob_stats_onfree(enum iob_user_e producerid);
 #endif
 
+/****************************************************************************
+ * Name: iob_owner_onalloc
+ *
+ * Description:
+ *   An IOB has just been allocated.  Record its owner and the allocation
+ *   time in the ownership side table.
+ *
+ * Input Parameters:
+ *   iob        - the allocated I/O buffer
+ *   consumerid - id representing who is consuming the IOB
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+void iob_owner_onalloc(FAR struct iob_s *iob, enum iob_user_e consumerid);
+#endif
+
+/****************************************************************************
+ * Name: iob_owner_onfree
+ *
+ * Description:
+ *   An IOB is being freed.  Release its entry in the ownership side table.
+ *
+ * Input Parameters:
+ *   iob - the I/O buffer being freed
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+void iob_owner_onfree(FAR struct iob_s *iob);
+#endif
+
+/****************************************************************************
+ * Name: iob_owner_of
+ *
+ * Description:
+ *   Return the recorded owner of an allocated I/O buffer.
+ *
+ * Input Parameters:
+ *   iob - the I/O buffer to query
+ *
+ * Returned Value:
+ *   The user id recorded when the I/O buffer was allocated, or
+ *   IOBUSER_UNKNOWN if the buffer is not marked in-use.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+enum iob_user_e iob_owner_of(FAR struct iob_s *iob);
+#endif
+
 #endif /* CONFIG_MM_IOB */
 #endif /* __MM_IOB_IOB_H */
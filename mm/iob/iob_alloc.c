@@ -93,6 +93,10 @@ static FAR struct iob_s *iob_alloc_committed(enum iob_user_e consumerid)
     defined(CONFIG_MM_IOB) && !defined(CONFIG_FS_PROCFS_EXCLUDE_IOBINFO)
       iob_stats_onalloc(consumerid);
 #endif
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+      iob_owner_onalloc(iob, consumerid);
+#endif
     }
 
   leave_critical_section(flags);
@@ -291,6 +295,10 @@ FAR struct iob_s *iob_tryalloc(bool throttled, enum iob_user_e consumerid)
           iob_stats_onalloc(consumerid);
 #endif
 
+#ifdef CONFIG_IOB_OWNER_TRACKING
+          iob_owner_onalloc(iob, consumerid);
+#endif
+
           leave_critical_section(flags);
 
           /* Put the I/O buffer in a known state */
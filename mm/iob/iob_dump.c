@@ -118,8 +118,13 @@ void iob_dump(FAR const char *msg, FAR struct iob_s *iob, unsigned int len,
 
   for (; iob; iob = iob->io_flink)
     {
+#ifdef CONFIG_IOB_OWNER_TRACKING
+      syslog(LOG_DEBUG, "  iob=%p len=%d offset=%d owner=%d\n",
+             iob, iob->io_len, iob->io_offset, (int)iob_owner_of(iob));
+#else
       syslog(LOG_DEBUG, "  iob=%p len=%d offset=%d\n",
              iob, iob->io_len, iob->io_offset);
+#endif
     }
 
   /* Get the amount of data to be displayed, limited by the amount that we
@@ -146,20 +146,30 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob,
     {
       iob->io_flink   = g_iob_committed;
       g_iob_committed = iob;
+
+      /* Signal that an IOB is available.  There is a thread blocked,
+       * waiting for an IOB, so this will wake up exactly one thread.  The
+       * semaphore count will correctly indicated that the awakened task
+       * owns an IOB and should find it in the committed list.
+       */
+
+      nxsem_post(&g_iob_sem);
     }
   else
     {
       iob->io_flink   = g_iob_freelist;
       g_iob_freelist  = iob;
-    }
 
-  /* Signal that an IOB is available.  If there is a thread blocked,
-   * waiting for an IOB, this will wake up exactly one thread.  The
-   * semaphore count will correctly indicated that the awakened task
-   * owns an IOB and should find it in the committed list.
-   */
+      /* No thread is waiting for an IOB, so there is no need for the
+       * full nxsem_post() wakeup logic.  We hold the critical section
+       * and the count is non-negative, so a simple increment is all
+       * that is needed (this is the same shortcut that iob_tryalloc()
+       * uses to take a count).
+       */
+
+      g_iob_sem.semcount++;
+    }
 
-  nxsem_post(&g_iob_sem);
   DEBUGASSERT(g_iob_sem.semcount <= CONFIG_IOB_NBUFFERS);
 
 #if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS) && \
@@ -167,8 +177,25 @@ FAR struct iob_s *iob_free(FAR struct iob_s *iob,
   iob_stats_onfree(producerid);
 #endif
 
+#ifdef CONFIG_IOB_OWNER_TRACKING
+  iob_owner_onfree(iob);
+#endif
+
 #if CONFIG_IOB_THROTTLE > 0
-  nxsem_post(&g_throttle_sem);
+  /* The same fast path applies to the throttle semaphore:  Only perform
+   * the full nxsem_post() if there is a thread waiting on a throttled
+   * allocation.
+   */
+
+  if (g_throttle_sem.semcount < 0)
+    {
+      nxsem_post(&g_throttle_sem);
+    }
+  else
+    {
+      g_throttle_sem.semcount++;
+    }
+
   DEBUGASSERT(g_throttle_sem.semcount <=
               (CONFIG_IOB_NBUFFERS - CONFIG_IOB_THROTTLE));
 #endif
@@ -39,6 +39,11 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
 #include <nuttx/arch.h>
 #include <nuttx/mm/iob.h>
 
@@ -53,18 +58,132 @@
  *
  * Description:
  *   Free an entire buffer chain, starting at the beginning of the I/O
- *   buffer chain
+ *   buffer chain.  The whole chain is restored to the free list with a
+ *   single critical section and, if notifications are enabled, a single
+ *   notifier wakeup -- rather than re-entering the critical section once
+ *   per buffer as repeated calls to iob_free() would.
  *
  ****************************************************************************/
 
 void iob_free_chain(FAR struct iob_s *iob, enum iob_user_e producerid)
 {
+  FAR struct iob_s *tail;
   FAR struct iob_s *next;
+  irqstate_t flags;
+  int total;
+  int count;
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS) && \
+    defined(CONFIG_MM_IOB) && !defined(CONFIG_FS_PROCFS_EXCLUDE_IOBINFO)
+  int i;
+#endif
+#ifdef CONFIG_IOB_NOTIFIER
+  int16_t navail;
+#endif
+
+  if (iob == NULL)
+    {
+      return;
+    }
+
+  /* Count the I/O buffers in the chain and find its tail.  The chain is
+   * still owned by the caller, so this walk may be performed before
+   * taking the critical section.
+   */
+
+  count = 1;
+  for (tail = iob; tail->io_flink != NULL; tail = tail->io_flink)
+    {
+      count++;
+    }
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+  /* Release the ownership records while the chain is still intact */
+
+  for (next = iob; next != NULL; next = next->io_flink)
+    {
+      iob_owner_onfree(next);
+    }
+#endif
+
+  total = count;
+  iobinfo("iob=%p count=%d\n", iob, count);
+
+  /* We don't know what context we are called from so we use extreme
+   * measures to protect the free list:  We disable interrupts very
+   * briefly.
+   */
+
+  flags = enter_critical_section();
+
+  /* While there are threads blocked waiting for an IOB, feed them one
+   * buffer at a time from the head of the chain through the committed
+   * list:  each waiter must receive its own nxsem_post() so that the
+   * semaphore count remains correct.
+   */
+
+  while (iob != NULL && g_iob_sem.semcount < 0)
+    {
+      next            = iob->io_flink;
+      iob->io_flink   = g_iob_committed;
+      g_iob_committed = iob;
+      nxsem_post(&g_iob_sem);
+      iob             = next;
+      count--;
+    }
 
-  /* Free each IOB in the chain -- one at a time to keep the count straight */
+  /* Then splice whatever remains of the chain onto the free list in one
+   * operation.  No thread is waiting for these buffers, so a simple
+   * adjustment of the semaphore count is all that is needed (this is the
+   * same shortcut that iob_tryalloc() uses to take a count).
+   */
 
-  for (; iob; iob = next)
+  if (iob != NULL)
     {
-      next = iob_free(iob, producerid);
+      tail->io_flink      = g_iob_freelist;
+      g_iob_freelist      = iob;
+      g_iob_sem.semcount += count;
     }
+
+  DEBUGASSERT(g_iob_sem.semcount <= CONFIG_IOB_NBUFFERS);
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS) && \
+    defined(CONFIG_MM_IOB) && !defined(CONFIG_FS_PROCFS_EXCLUDE_IOBINFO)
+  for (i = 0; i < total; i++)
+    {
+      iob_stats_onfree(producerid);
+    }
+#endif
+
+#if CONFIG_IOB_THROTTLE > 0
+  /* The same logic applies to the throttle semaphore:  each waiter gets
+   * its own nxsem_post(); the rest of the count is a simple adjustment.
+   */
+
+  count = total;
+  while (count > 0 && g_throttle_sem.semcount < 0)
+    {
+      nxsem_post(&g_throttle_sem);
+      count--;
+    }
+
+  g_throttle_sem.semcount += count;
+
+  DEBUGASSERT(g_throttle_sem.semcount <=
+              (CONFIG_IOB_NBUFFERS - CONFIG_IOB_THROTTLE));
+#endif
+
+#ifdef CONFIG_IOB_NOTIFIER
+  /* A bulk free is the completion of a burst:  signal threads that have
+   * requested a notification just once for the whole chain rather than
+   * once per buffer.
+   */
+
+  navail = iob_navail(false);
+  if (navail > 0)
+    {
+      iob_notifier_signal();
+    }
+#endif
+
+  leave_critical_section(flags);
 }
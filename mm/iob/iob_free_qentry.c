@@ -85,21 +85,31 @@ FAR struct iob_qentry_s *iob_free_qentry(FAR struct iob_qentry_s *iobq)
     {
       iobq->qe_flink   = g_iob_qcommitted;
       g_iob_qcommitted = iobq;
+
+      /* Signal that an I/O buffer chain container is available.  There
+       * is a thread waiting for an I/O buffer chain container, so this
+       * will wake up exactly one thread.  The semaphore count will
+       * correctly indicated that the awakened task owns an I/O buffer
+       * chain container and should find it in the committed list.
+       */
+
+      nxsem_post(&g_qentry_sem);
     }
   else
     {
       iobq->qe_flink   = g_iob_freeqlist;
       g_iob_freeqlist  = iobq;
-    }
 
-  /* Signal that an I/O buffer chain container is available.  If there
-   * is a thread waiting for an I/O buffer chain container, this will
-   * wake up exactly one thread.  The semaphore count will correctly
-   * indicated that the awakened task owns an I/O buffer chain container
-   * and should find it in the committed list.
-   */
+      /* No thread is waiting for a container, so there is no need for
+       * the full nxsem_post() wakeup logic.  We hold the critical
+       * section and the count is non-negative, so a simple increment is
+       * all that is needed (this is the same shortcut that
+       * iob_tryalloc_qentry() uses to take a count).
+       */
+
+      g_qentry_sem.semcount++;
+    }
 
-  nxsem_post(&g_qentry_sem);
   leave_critical_section(flags);
 
   /* And return the I/O buffer chain container after the one that was freed */
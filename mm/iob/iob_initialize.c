@@ -57,9 +57,16 @@
  * Private Data
  ****************************************************************************/
 
-/* This is a pool of pre-allocated I/O buffers */
-
+/* This is a pool of pre-allocated I/O buffers.  The pool has file scope
+ * unless ownership tracking needs the pool base address to map an I/O
+ * buffer to its side-table entry.
+ */
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+struct iob_s               g_iob_pool[CONFIG_IOB_NBUFFERS];
+#else
 static struct iob_s        g_iob_pool[CONFIG_IOB_NBUFFERS];
+#endif
 #if CONFIG_IOB_NCHAINS > 0
 static struct iob_qentry_s g_iob_qpool[CONFIG_IOB_NCHAINS];
 #endif
@@ -40,6 +40,8 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <assert.h>
 
 #include <nuttx/wqueue.h>
@@ -67,26 +69,51 @@
  *            when the event occurs.
  *   arg    - A user-defined argument that will be available to the worker
  *            function when it runs.
+ *   threshold - The worker will not be notified until at least this many
+ *            IOBs are available.  This avoids thundering-herd wakeups:  a
+ *            waiter that needs several IOBs is not awakened (uselessly)
+ *            by every single free.  A value of one (or less) requests
+ *            notification as soon as any IOB is available.
  *
  * Returned Value:
  *   > 0   - The notification is in place.  The returned value is a key that
  *           may be used later in a call to iob_notifier_teardown().
- *   == 0  - There are already free IOBs.  No notification will be provided.
+ *   == 0  - The requested number of IOBs is already available.  No
+ *           notification will be provided.
  *   < 0   - An unexpected error occurred and notification will occur.  The
  *           returned value is a negated errno value that indicates the
  *           nature of the failure.
  *
  ****************************************************************************/
 
-int iob_notifier_setup(int qid, worker_t worker, FAR void *arg)
+int iob_notifier_setup(int qid, worker_t worker, FAR void *arg,
+                       int16_t threshold)
 {
   struct work_notifier_s info;
 
   DEBUGASSERT(worker != NULL);
 
+  if (threshold < 1)
+    {
+      threshold = 1;
+    }
+
+  /* If the requested number of IOBs is already available, then there is
+   * nothing to wait for.
+   */
+
+  if (iob_navail(false) >= threshold)
+    {
+      return 0;
+    }
+
+  /* The threshold is encoded in the qualifier so that iob_notifier_signal()
+   * can wake only the waiters whose threshold has been reached.
+   */
+
   info.evtype    = WORK_IOB_AVAIL;
   info.qid       = qid;
-  info.qualifier = NULL;
+  info.qualifier = (FAR void *)(uintptr_t)threshold;
   info.arg       = arg;
   info.worker    = worker;
 
@@ -126,10 +153,10 @@ int iob_notifier_teardown(int key)
  *   An IOB has become available.  Signal all threads waiting for an IOB
  *   that an IOB is available.
  *
- *   When an IOB becomes available, *all* of the workers waiting for an
- *   IOB will be executed.  If there are multiple workers waiting for an IOB
- *   then only the first to execute will get the IOB.  Others will
- *   need to call iob_notify_setup() once again.
+ *   Only the workers whose availability threshold has been reached are
+ *   executed.  If there are multiple workers with the same threshold then
+ *   only the first to execute will get the IOB(s).  Others will need to
+ *   call iob_notifier_setup() once again.
  *
  * Input Parameters:
  *   None.
@@ -141,9 +168,21 @@ int iob_notifier_teardown(int key)
 
 void iob_notifier_signal(void)
 {
-  /* This is just a simple wrapper around work_notifier_signal(). */
+  int16_t navail;
+  int16_t threshold;
+
+  navail = iob_navail(false);
+
+  /* Each distinct threshold value was registered as a separate qualifier,
+   * so signal each satisfied threshold in turn.  Waiters with larger
+   * thresholds remain blocked until enough IOBs have accumulated.
+   */
 
-  work_notifier_signal(WORK_IOB_AVAIL, NULL);
+  for (threshold = 1; threshold <= navail; threshold++)
+    {
+      work_notifier_signal(WORK_IOB_AVAIL,
+                           (FAR void *)(uintptr_t)threshold);
+    }
 }
 
 #endif /* CONFIG_IOB_NOTIFIER */
@@ -0,0 +1,279 @@
+/****************************************************************************
+ * mm/iob/iob_owner.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <syslog.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/clock.h>
+#include <nuttx/mm/iob.h>
+
+#include "iob.h"
+
+#ifdef CONFIG_IOB_OWNER_TRACKING
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* IOBUSER_UNKNOWN is -1, so the per-owner arrays are shifted by one to
+ * give it a slot of its own.
+ */
+
+#define IOB_OWNER_NDX(o)  ((int)(o) + 1)
+#define IOB_OWNER_NSLOTS  (IOBUSER_NENTRIES + 1)
+
+/* The number of buffers that one owner may hold before a warning is
+ * logged.
+ */
+
+#if CONFIG_IOB_OWNER_THRESHOLD > 0
+#  define IOB_OWNER_LIMIT \
+     ((CONFIG_IOB_NBUFFERS * CONFIG_IOB_OWNER_THRESHOLD) / 100)
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One side-table entry for each pre-allocated I/O buffer */
+
+struct iob_owner_s
+{
+  bool    inuse;        /* True:  The I/O buffer is allocated */
+  int8_t  owner;        /* The iob_user_e id of the allocator */
+  clock_t alloctime;    /* Time of the allocation in system ticks */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The ownership side table, indexed by the position of the I/O buffer in
+ * the pre-allocated pool.
+ */
+
+static struct iob_owner_s g_iob_owners[CONFIG_IOB_NBUFFERS];
+
+/* The number of buffers currently held by each owner */
+
+static uint16_t g_iob_livecount[IOB_OWNER_NSLOTS];
+
+#if CONFIG_IOB_OWNER_THRESHOLD > 0
+/* One latch bit per owner so that each threshold crossing is reported
+ * only once.
+ */
+
+static uint32_t g_iob_warned;
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iob_owner_onalloc
+ *
+ * Description:
+ *   An IOB has just been allocated.  Record its owner and the allocation
+ *   time in the ownership side table.
+ *
+ * Input Parameters:
+ *   iob        - the allocated I/O buffer
+ *   consumerid - id representing who is consuming the IOB
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void iob_owner_onalloc(FAR struct iob_s *iob, enum iob_user_e consumerid)
+{
+  FAR struct iob_owner_s *entry;
+  irqstate_t flags;
+  int ndx = iob - g_iob_pool;
+
+  DEBUGASSERT(ndx >= 0 && ndx < CONFIG_IOB_NBUFFERS);
+  DEBUGASSERT(consumerid < IOBUSER_NENTRIES);
+
+  flags = enter_critical_section();
+
+  entry            = &g_iob_owners[ndx];
+  entry->inuse     = true;
+  entry->owner     = (int8_t)consumerid;
+  entry->alloctime = clock_systime_ticks();
+
+  g_iob_livecount[IOB_OWNER_NDX(consumerid)]++;
+
+#if CONFIG_IOB_OWNER_THRESHOLD > 0
+  /* Warn (once per crossing) if this owner now holds more than its share
+   * of the buffer pool.
+   */
+
+  if (g_iob_livecount[IOB_OWNER_NDX(consumerid)] > IOB_OWNER_LIMIT &&
+      (g_iob_warned & (1ul << IOB_OWNER_NDX(consumerid))) == 0)
+    {
+      g_iob_warned |= (1ul << IOB_OWNER_NDX(consumerid));
+      syslog(LOG_WARNING, "WARNING: IOB user %d holds %u of %u buffers\n",
+             (int)consumerid,
+             g_iob_livecount[IOB_OWNER_NDX(consumerid)],
+             CONFIG_IOB_NBUFFERS);
+    }
+#endif
+
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: iob_owner_onfree
+ *
+ * Description:
+ *   An IOB is being freed.  Release its entry in the ownership side table.
+ *
+ * Input Parameters:
+ *   iob - the I/O buffer being freed
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void iob_owner_onfree(FAR struct iob_s *iob)
+{
+  FAR struct iob_owner_s *entry;
+  irqstate_t flags;
+  int ndx = iob - g_iob_pool;
+
+  DEBUGASSERT(ndx >= 0 && ndx < CONFIG_IOB_NBUFFERS);
+
+  flags = enter_critical_section();
+
+  entry = &g_iob_owners[ndx];
+  if (entry->inuse)
+    {
+      DEBUGASSERT(g_iob_livecount[IOB_OWNER_NDX(entry->owner)] > 0);
+      g_iob_livecount[IOB_OWNER_NDX(entry->owner)]--;
+      entry->inuse = false;
+
+#if CONFIG_IOB_OWNER_THRESHOLD > 0
+      /* Re-arm the warning once the owner drops back under its share */
+
+      if (g_iob_livecount[IOB_OWNER_NDX(entry->owner)] <= IOB_OWNER_LIMIT)
+        {
+          g_iob_warned &= ~(1ul << IOB_OWNER_NDX(entry->owner));
+        }
+#endif
+    }
+
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: iob_owner_of
+ *
+ * Description:
+ *   Return the recorded owner of an allocated I/O buffer.
+ *
+ * Input Parameters:
+ *   iob - the I/O buffer to query
+ *
+ * Returned Value:
+ *   The user id recorded when the I/O buffer was allocated, or
+ *   IOBUSER_UNKNOWN if the buffer is not marked in-use.
+ *
+ ****************************************************************************/
+
+enum iob_user_e iob_owner_of(FAR struct iob_s *iob)
+{
+  int ndx = iob - g_iob_pool;
+
+  DEBUGASSERT(ndx >= 0 && ndx < CONFIG_IOB_NBUFFERS);
+
+  if (!g_iob_owners[ndx].inuse)
+    {
+      return IOBUSER_UNKNOWN;
+    }
+
+  return (enum iob_user_e)g_iob_owners[ndx].owner;
+}
+
+/****************************************************************************
+ * Name: iob_owner_getinfo
+ *
+ * Description:
+ *   Summarize the I/O buffers currently held by one owner:  the number of
+ *   live buffers and the age of the oldest one.  IOBUSER_GLOBAL summarizes
+ *   all owners.
+ *
+ * Input Parameters:
+ *   userid - id representing the IOB owner
+ *   info   - Location to return the summary
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void iob_owner_getinfo(enum iob_user_e userid,
+                       FAR struct iob_ownerinfo_s *info)
+{
+  FAR struct iob_owner_s *entry;
+  irqstate_t flags;
+  clock_t now;
+  clock_t age;
+  int i;
+
+  DEBUGASSERT(info != NULL);
+
+  info->live   = 0;
+  info->oldest = 0;
+
+  flags = enter_critical_section();
+  now   = clock_systime_ticks();
+
+  for (i = 0; i < CONFIG_IOB_NBUFFERS; i++)
+    {
+      entry = &g_iob_owners[i];
+      if (entry->inuse &&
+          (userid == IOBUSER_GLOBAL || entry->owner == (int8_t)userid))
+        {
+          info->live++;
+
+          age = now - entry->alloctime;
+          if (age > info->oldest)
+            {
+              info->oldest = age;
+            }
+        }
+    }
+
+  leave_critical_section(flags);
+}
+
+#endif /* CONFIG_IOB_OWNER_TRACKING */
@@ -64,7 +64,18 @@
 
 void kmm_addregion(FAR void *heap_start, size_t heap_size)
 {
-  return mm_addregion(&g_kmmheap, heap_start, heap_size);
+#if KMM_NARENAS > 1
+  static int next;
+
+  /* Distribute added regions over the arenas round-robin so that later
+   * regions also contribute to contention relief.
+   */
+
+  mm_addregion(&g_kmmheap[next], heap_start, heap_size);
+  next = (next + 1) % KMM_NARENAS;
+#else
+  return mm_addregion(&g_kmmheap[0], heap_start, heap_size);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -57,7 +57,23 @@
 
 FAR void *kmm_calloc(size_t n, size_t elem_size)
 {
-  return mm_calloc(&g_kmmheap, n, elem_size);
+  FAR void *mem;
+#if KMM_NARENAS > 1
+  int i;
+#endif
+
+  mem = mm_calloc(kmm_preferred(), n, elem_size);
+
+#if KMM_NARENAS > 1
+  /* Steal from the other arenas if the preferred arena is exhausted */
+
+  for (i = 0; mem == NULL && i < KMM_NARENAS; i++)
+    {
+      mem = mm_calloc(&g_kmmheap[i], n, elem_size);
+    }
+#endif
+
+  return mem;
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -58,7 +58,7 @@
 
 void kmm_extend(FAR void *mem, size_t size, int region)
 {
-  mm_extend(&g_kmmheap, mem, size, region);
+  mm_extend(&g_kmmheap[0], mem, size, region);
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
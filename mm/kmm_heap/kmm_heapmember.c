@@ -67,7 +67,21 @@
 
 bool kmm_heapmember(FAR void *mem)
 {
-  return mm_heapmember(&g_kmmheap, mem);
+#if KMM_NARENAS > 1
+  int i;
+
+  for (i = 0; i < KMM_NARENAS; i++)
+    {
+      if (mm_heapmember(&g_kmmheap[i], mem))
+        {
+          return true;
+        }
+    }
+
+  return false;
+#else
+  return mm_heapmember(&g_kmmheap[0], mem);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
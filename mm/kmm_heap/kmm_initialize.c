@@ -39,6 +39,9 @@
 
 #include <nuttx/config.h>
 
+#include <assert.h>
+
+#include <nuttx/arch.h>
 #include <nuttx/mm/mm.h>
 
 #ifdef CONFIG_MM_KERNEL_HEAP
@@ -47,9 +50,9 @@
  * Public Data
  ****************************************************************************/
 
-/* This is the kernel heap */
+/* This is the kernel heap, possibly partitioned into arenas */
 
-struct mm_heap_s g_kmmheap;
+struct mm_heap_s g_kmmheap[KMM_NARENAS];
 
 /****************************************************************************
  * Public Functions
@@ -73,7 +76,84 @@ struct mm_heap_s g_kmmheap;
 
 void kmm_initialize(FAR void *heap_start, size_t heap_size)
 {
-  return mm_initialize(&g_kmmheap, heap_start, heap_size);
+#if KMM_NARENAS > 1
+  size_t slice = heap_size / KMM_NARENAS;
+  int i;
+
+  /* Divide the initial region evenly among the arenas.  The last arena
+   * also receives whatever remains after the division.
+   */
+
+  for (i = 0; i < KMM_NARENAS - 1; i++)
+    {
+      mm_initialize(&g_kmmheap[i],
+                    (FAR char *)heap_start + i * slice, slice);
+    }
+
+  mm_initialize(&g_kmmheap[i], (FAR char *)heap_start + i * slice,
+                heap_size - i * slice);
+#else
+  return mm_initialize(&g_kmmheap[0], heap_start, heap_size);
+#endif
+}
+
+/****************************************************************************
+ * Name: kmm_preferred
+ *
+ * Description:
+ *   Return the kernel heap arena preferred for allocations made by the
+ *   current CPU.  With a single arena this is simply the kernel heap.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   The address of the preferred arena.
+ *
+ ****************************************************************************/
+
+FAR struct mm_heap_s *kmm_preferred(void)
+{
+#if defined(CONFIG_SMP) && KMM_NARENAS > 1
+  return &g_kmmheap[up_cpu_index() % KMM_NARENAS];
+#else
+  return &g_kmmheap[0];
+#endif
+}
+
+/****************************************************************************
+ * Name: kmm_container
+ *
+ * Description:
+ *   Return the kernel heap arena that contains the allocation at 'mem'.
+ *   Memory must always be freed back into (or re-allocated within) the
+ *   arena that it came from.
+ *
+ * Input Parameters:
+ *   mem - The address of the allocation
+ *
+ * Returned Value:
+ *   The address of the containing arena.
+ *
+ ****************************************************************************/
+
+FAR struct mm_heap_s *kmm_container(FAR void *mem)
+{
+#if KMM_NARENAS > 1
+  int i;
+
+  for (i = 0; i < KMM_NARENAS - 1; i++)
+    {
+      if (mm_heapmember(&g_kmmheap[i], mem))
+        {
+          return &g_kmmheap[i];
+        }
+    }
+
+  return &g_kmmheap[KMM_NARENAS - 1];
+#else
+  return &g_kmmheap[0];
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
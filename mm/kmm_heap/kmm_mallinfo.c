@@ -25,6 +25,7 @@
 #include <nuttx/config.h>
 
 #include <malloc.h>
+#include <errno.h>
 
 #include <nuttx/mm/mm.h>
 
@@ -46,8 +47,61 @@
 struct mallinfo kmm_mallinfo(void)
 {
   struct mallinfo info;
-  mm_mallinfo(&g_kmmheap, &info);
+#if KMM_NARENAS > 1
+  struct mallinfo arena;
+  int i;
+
+  /* Aggregate the statistics of all of the arenas */
+
+  mm_mallinfo(&g_kmmheap[0], &info);
+
+  for (i = 1; i < KMM_NARENAS; i++)
+    {
+      mm_mallinfo(&g_kmmheap[i], &arena);
+
+      info.arena    += arena.arena;
+      info.ordblks  += arena.ordblks;
+      info.uordblks += arena.uordblks;
+      info.fordblks += arena.fordblks;
+
+      if (arena.mxordblk > info.mxordblk)
+        {
+          info.mxordblk = arena.mxordblk;
+        }
+    }
+#else
+  mm_mallinfo(&g_kmmheap[0], &info);
+#endif
+
   return info;
 }
 
+/****************************************************************************
+ * Name: kmm_mallinfo_arena
+ *
+ * Description:
+ *   Return the current heap information of one kernel heap arena.  This
+ *   permits watching how evenly the kernel allocations are spread over
+ *   the arenas.
+ *
+ * Input Parameters:
+ *   arena - The index of the arena to be queried
+ *   info  - The location to return the heap information
+ *
+ * Returned Value:
+ *   Zero (OK) on success; -EINVAL if 'arena' does not index a configured
+ *   arena.
+ *
+ ****************************************************************************/
+
+int kmm_mallinfo_arena(int arena, FAR struct mallinfo *info)
+{
+  if (arena < 0 || arena >= KMM_NARENAS || info == NULL)
+    {
+      return -EINVAL;
+    }
+
+  return mm_mallinfo(&g_kmmheap[arena], info);
+}
+
 #endif /* CONFIG_MM_KERNEL_HEAP */
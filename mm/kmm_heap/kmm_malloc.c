@@ -63,7 +63,23 @@
 
 FAR void *kmm_malloc(size_t size)
 {
-  return mm_malloc(&g_kmmheap, size);
+  FAR void *mem;
+#if KMM_NARENAS > 1
+  int i;
+#endif
+
+  mem = mm_malloc(kmm_preferred(), size);
+
+#if KMM_NARENAS > 1
+  /* Steal from the other arenas if the preferred arena is exhausted */
+
+  for (i = 0; mem == NULL && i < KMM_NARENAS; i++)
+    {
+      mem = mm_malloc(&g_kmmheap[i], size);
+    }
+#endif
+
+  return mem;
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
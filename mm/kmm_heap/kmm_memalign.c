@@ -66,7 +66,23 @@
 
 FAR void *kmm_memalign(size_t alignment, size_t size)
 {
-  return mm_memalign(&g_kmmheap, alignment, size);
+  FAR void *mem;
+#if KMM_NARENAS > 1
+  int i;
+#endif
+
+  mem = mm_memalign(kmm_preferred(), alignment, size);
+
+#if KMM_NARENAS > 1
+  /* Steal from the other arenas if the preferred arena is exhausted */
+
+  for (i = 0; mem == NULL && i < KMM_NARENAS; i++)
+    {
+      mem = mm_memalign(&g_kmmheap[i], alignment, size);
+    }
+#endif
+
+  return mem;
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
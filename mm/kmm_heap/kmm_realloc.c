@@ -64,7 +64,15 @@
 
 FAR void *kmm_realloc(FAR void *oldmem, size_t newsize)
 {
-  return mm_realloc(&g_kmmheap, oldmem, newsize);
+  FAR struct mm_heap_s *heap;
+
+  /* A re-allocation must be performed within the arena that made the
+   * original allocation.  A NULL oldmem is simply a new allocation from
+   * the preferred arena.
+   */
+
+  heap = oldmem != NULL ? kmm_container(oldmem) : kmm_preferred();
+  return mm_realloc(heap, oldmem, newsize);
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
@@ -81,7 +81,7 @@
 
 FAR void *kmm_sbrk(intptr_t incr)
 {
-  return mm_sbrk(&g_kmmheap, incr, UINTPTR_MAX);
+  return mm_sbrk(&g_kmmheap[0], incr, UINTPTR_MAX);
 }
 
 #endif /* CONFIG_BUILD_KERNEL && __KERNEL__ */
@@ -63,7 +63,32 @@
 
 int kmm_trysemaphore(void)
 {
-  return mm_trysemaphore(&g_kmmheap);
+#if KMM_NARENAS > 1
+  int ret;
+  int i;
+
+  /* The kernel heap is held only when every arena is held.  On failure,
+   * give back the arenas already taken.
+   */
+
+  for (i = 0; i < KMM_NARENAS; i++)
+    {
+      ret = mm_trysemaphore(&g_kmmheap[i]);
+      if (ret < 0)
+        {
+          while (--i >= 0)
+            {
+              mm_givesemaphore(&g_kmmheap[i]);
+            }
+
+          return ret;
+        }
+    }
+
+  return OK;
+#else
+  return mm_trysemaphore(&g_kmmheap[0]);
+#endif
 }
 
 /****************************************************************************
@@ -82,7 +107,16 @@ int kmm_trysemaphore(void)
 
 void kmm_givesemaphore(void)
 {
-  return mm_givesemaphore(&g_kmmheap);
+#if KMM_NARENAS > 1
+  int i;
+
+  for (i = KMM_NARENAS - 1; i >= 0; i--)
+    {
+      mm_givesemaphore(&g_kmmheap[i]);
+    }
+#else
+  return mm_givesemaphore(&g_kmmheap[0]);
+#endif
 }
 
 #endif /* CONFIG_MM_KERNEL_HEAP */
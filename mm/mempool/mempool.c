@@ -0,0 +1,239 @@
+/****************************************************************************
+ * mm/mempool/mempool.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mm/mempool.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Each free block holds the free list linkage, so a block can be no
+ * smaller than a sq_entry_t and must be aligned to hold a pointer.
+ */
+
+#define MEMPOOL_ALIGN       (sizeof(FAR void *))
+#define MEMPOOL_ALIGNUP(s)  (((s) + MEMPOOL_ALIGN - 1) & ~(MEMPOOL_ALIGN - 1))
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* The registry of all initialized pools */
+
+sq_queue_t g_mempool_registry;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mempool_init
+ *
+ * Description:
+ *   Initialize a fixed-block memory pool and add it to the pool registry.
+ *
+ * Input Parameters:
+ *   pool      - Address of the pool to be initialized.
+ *   name      - A name for the pool, used only for reporting.
+ *   base      - A pointer to the block storage or NULL to allocate the
+ *               storage from the kernel heap.
+ *   blocksize - The size of one block in bytes.
+ *   nblocks   - The number of blocks in the pool.
+ *
+ * Returned Value:
+ *   Zero on success; a negated errno value is returned on any failure.
+ *
+ ****************************************************************************/
+
+int mempool_init(FAR struct mempool_s *pool, FAR const char *name,
+                 FAR void *base, size_t blocksize, size_t nblocks)
+{
+  FAR uint8_t *blk;
+  irqstate_t flags;
+  size_t i;
+
+  DEBUGASSERT(pool != NULL && blocksize > 0 && nblocks > 0);
+
+  /* Round the block size up so that every block can hold the free list
+   * linkage and so that consecutive blocks are properly aligned.
+   */
+
+  blocksize = MEMPOOL_ALIGNUP(blocksize);
+  if (blocksize < sizeof(sq_entry_t))
+    {
+      blocksize = sizeof(sq_entry_t);
+    }
+
+  pool->external = (base != NULL);
+
+  if (base == NULL)
+    {
+      base = kmm_malloc(blocksize * nblocks);
+      if (base == NULL)
+        {
+          return -ENOMEM;
+        }
+    }
+
+  pool->name      = name;
+  pool->base      = base;
+  pool->blocksize = blocksize;
+  pool->nblocks   = nblocks;
+  pool->nfree     = nblocks;
+  pool->minfree   = nblocks;
+
+  /* Carve the storage into blocks and place each block on the free list */
+
+  sq_init(&pool->queue);
+
+  for (blk = (FAR uint8_t *)base, i = 0; i < nblocks; blk += blocksize, i++)
+    {
+      sq_addlast((FAR sq_entry_t *)blk, &pool->queue);
+    }
+
+  /* Add the pool to the registry */
+
+  flags = enter_critical_section();
+  sq_addlast(&pool->node, &g_mempool_registry);
+  leave_critical_section(flags);
+
+  return OK;
+}
+
+/****************************************************************************
+ * Name: mempool_deinit
+ *
+ * Description:
+ *   Remove a pool from the pool registry and free its block storage if it
+ *   was allocated by mempool_init().
+ *
+ * Input Parameters:
+ *   pool - Address of the pool to be uninitialized.
+ *
+ * Returned Value:
+ *   Zero on success; -EBUSY if any block is still allocated.
+ *
+ ****************************************************************************/
+
+int mempool_deinit(FAR struct mempool_s *pool)
+{
+  irqstate_t flags;
+
+  DEBUGASSERT(pool != NULL);
+
+  if (pool->nfree != pool->nblocks)
+    {
+      return -EBUSY;
+    }
+
+  flags = enter_critical_section();
+  sq_rem(&pool->node, &g_mempool_registry);
+  leave_critical_section(flags);
+
+  if (!pool->external)
+    {
+      kmm_free(pool->base);
+    }
+
+  pool->base    = NULL;
+  pool->nblocks = 0;
+  pool->nfree   = 0;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: mempool_alloc
+ *
+ * Description:
+ *   Allocate one block from a pool.  This is an O(1) operation and may be
+ *   called from interrupt handlers.
+ *
+ * Input Parameters:
+ *   pool - Address of the pool to allocate from.
+ *
+ * Returned Value:
+ *   The allocated block on success; NULL if the pool is exhausted.
+ *
+ ****************************************************************************/
+
+FAR void *mempool_alloc(FAR struct mempool_s *pool)
+{
+  FAR sq_entry_t *blk;
+  irqstate_t flags;
+
+  DEBUGASSERT(pool != NULL);
+
+  flags = enter_critical_section();
+  blk = sq_remfirst(&pool->queue);
+  if (blk != NULL)
+    {
+      pool->nfree--;
+      if (pool->nfree < pool->minfree)
+        {
+          pool->minfree = pool->nfree;
+        }
+    }
+
+  leave_critical_section(flags);
+  return blk;
+}
+
+/****************************************************************************
+ * Name: mempool_free
+ *
+ * Description:
+ *   Return one block to the pool that it was allocated from.  This is an
+ *   O(1) operation and may be called from interrupt handlers.
+ *
+ * Input Parameters:
+ *   pool - Address of the pool that the block was allocated from.
+ *   blk  - The block to be returned.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mempool_free(FAR struct mempool_s *pool, FAR void *blk)
+{
+  irqstate_t flags;
+
+  DEBUGASSERT(pool != NULL && blk != NULL);
+  DEBUGASSERT((FAR uint8_t *)blk >= (FAR uint8_t *)pool->base &&
+              (FAR uint8_t *)blk <  (FAR uint8_t *)pool->base +
+                                    pool->blocksize * pool->nblocks);
+
+  flags = enter_critical_section();
+  sq_addfirst((FAR sq_entry_t *)blk, &pool->queue);
+  pool->nfree++;
+  leave_critical_section(flags);
+}
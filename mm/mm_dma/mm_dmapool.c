@@ -0,0 +1,295 @@
+/****************************************************************************
+ * mm/mm_dma/mm_dmapool.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/mm/gran.h>
+#include <nuttx/mm/dma.h>
+
+#ifdef CONFIG_MM_DMA
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes the state of one DMA buffer pool */
+
+struct dma_pool_s
+{
+  GRAN_HANDLE     dp_gran;      /* The underlying granule allocator */
+  FAR const char *dp_name;      /* Pool name for accounting output */
+  size_t          dp_arena;     /* Total size of the pool memory */
+  uint8_t         dp_log2gran;  /* Log2 of the granule size */
+
+  /* Leak accounting.  These counters are incrementally updated under a
+   * critical section so that dma_poolinfo() returns a consistent snapshot
+   * even when the pool is used from interrupt level.
+   */
+
+  uint32_t        dp_nallocs;   /* Total number of successful allocations */
+  uint32_t        dp_nfrees;    /* Total number of frees */
+  uint32_t        dp_nfailures; /* Number of failed allocations */
+  size_t          dp_curbytes;  /* Bytes currently allocated */
+  size_t          dp_peakbytes; /* High watermark of dp_curbytes */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dma_padsize
+ *
+ * Description:
+ *   Return the requested size padded up to a multiple of the granule size.
+ *   This is the size that the allocation actually occupies and the size
+ *   that is charged to the accounting counters.
+ *
+ ****************************************************************************/
+
+static size_t dma_padsize(FAR struct dma_pool_s *pool, size_t size)
+{
+  size_t granmask = ((size_t)1 << pool->dp_log2gran) - 1;
+  return (size + granmask) & ~granmask;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dma_pool_initialize
+ *
+ * Description:
+ *   Create a DMA buffer pool over the provided (DMA-capable) memory.  The
+ *   pool is backed by the granule allocator; the granule size is at least
+ *   one data cache line so that all buffers are automatically cache-line
+ *   aligned and padded.
+ *
+ * Input Parameters:
+ *   name      - A name for the pool used in accounting output.  The
+ *               string is not copied and must persist.
+ *   heapstart - Start of the DMA-capable memory backing the pool.  Must
+ *               be aligned to (1 << log2gran).
+ *   heapsize  - Size of the memory backing the pool.
+ *   log2gran  - Log base 2 of the granule size.  Values smaller than
+ *               CONFIG_MM_DMA_CACHELINE_LOG2 are silently raised to it.
+ *
+ * Returned Value:
+ *   A reference to the pool on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR struct dma_pool_s *dma_pool_initialize(FAR const char *name,
+                                           FAR void *heapstart,
+                                           size_t heapsize,
+                                           uint8_t log2gran)
+{
+  FAR struct dma_pool_s *pool;
+
+  DEBUGASSERT(name != NULL && heapstart != NULL && heapsize > 0);
+
+  /* Never use a granule smaller than the data cache line size.  Both the
+   * granule size and the granule alignment are set to the same value so
+   * that every buffer begins on a cache line boundary and occupies whole
+   * cache lines.
+   */
+
+  if (log2gran < CONFIG_MM_DMA_CACHELINE_LOG2)
+    {
+      log2gran = CONFIG_MM_DMA_CACHELINE_LOG2;
+    }
+
+  /* Allocate and initialize the pool structure */
+
+  pool = (FAR struct dma_pool_s *)kmm_zalloc(sizeof(struct dma_pool_s));
+  if (pool == NULL)
+    {
+      merr("ERROR: Failed to allocate pool structure\n");
+      return NULL;
+    }
+
+  pool->dp_gran = gran_initialize(heapstart, heapsize, log2gran, log2gran);
+  if (pool->dp_gran == NULL)
+    {
+      merr("ERROR: gran_initialize() failed\n");
+      kmm_free(pool);
+      return NULL;
+    }
+
+  pool->dp_name     = name;
+  pool->dp_arena    = heapsize;
+  pool->dp_log2gran = log2gran;
+  return pool;
+}
+
+/****************************************************************************
+ * Name: dma_pool_release
+ *
+ * Description:
+ *   Release a DMA buffer pool and all of its management structures.  Any
+ *   memory still allocated from the pool is abandoned.
+ *
+ * Input Parameters:
+ *   pool - The pool previously returned by dma_pool_initialize()
+ *
+ ****************************************************************************/
+
+void dma_pool_release(FAR struct dma_pool_s *pool)
+{
+  DEBUGASSERT(pool != NULL);
+
+  if (pool->dp_curbytes > 0)
+    {
+      mwarn("WARNING: Pool %s released with %zu bytes still allocated\n",
+            pool->dp_name, pool->dp_curbytes);
+    }
+
+  gran_release(pool->dp_gran);
+  kmm_free(pool);
+}
+
+/****************************************************************************
+ * Name: dma_alloc
+ *
+ * Description:
+ *   Allocate a cache-line aligned DMA buffer from the pool.  The size is
+ *   padded up to a multiple of the granule size, so cache maintenance on
+ *   [buffer, buffer + size) never overlaps another allocation.
+ *
+ * Input Parameters:
+ *   pool - The pool previously returned by dma_pool_initialize()
+ *   size - The size of the buffer needed
+ *
+ * Returned Value:
+ *   The address of the buffer on success; NULL on failure.
+ *
+ ****************************************************************************/
+
+FAR void *dma_alloc(FAR struct dma_pool_s *pool, size_t size)
+{
+  FAR void *mem;
+  irqstate_t flags;
+  size_t padsize;
+
+  DEBUGASSERT(pool != NULL && size > 0);
+
+  mem     = gran_alloc(pool->dp_gran, size);
+  padsize = dma_padsize(pool, size);
+
+  flags = enter_critical_section();
+  if (mem != NULL)
+    {
+      pool->dp_nallocs++;
+      pool->dp_curbytes += padsize;
+      if (pool->dp_curbytes > pool->dp_peakbytes)
+        {
+          pool->dp_peakbytes = pool->dp_curbytes;
+        }
+    }
+  else
+    {
+      pool->dp_nfailures++;
+    }
+
+  leave_critical_section(flags);
+  return mem;
+}
+
+/****************************************************************************
+ * Name: dma_free
+ *
+ * Description:
+ *   Return a buffer previously allocated by dma_alloc() to its pool.
+ *
+ * Input Parameters:
+ *   pool - The pool that the buffer was allocated from
+ *   mem  - The buffer address returned by dma_alloc()
+ *   size - The size passed to dma_alloc()
+ *
+ ****************************************************************************/
+
+void dma_free(FAR struct dma_pool_s *pool, FAR void *mem, size_t size)
+{
+  irqstate_t flags;
+  size_t padsize;
+
+  DEBUGASSERT(pool != NULL && mem != NULL && size > 0);
+
+  gran_free(pool->dp_gran, mem, size);
+  padsize = dma_padsize(pool, size);
+
+  flags = enter_critical_section();
+  DEBUGASSERT(pool->dp_curbytes >= padsize);
+  pool->dp_nfrees++;
+  pool->dp_curbytes -= padsize;
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: dma_poolinfo
+ *
+ * Description:
+ *   Return the accounting state of a pool so that per-driver DMA memory
+ *   consumption and leaks can be monitored.
+ *
+ * Input Parameters:
+ *   pool - The pool previously returned by dma_pool_initialize()
+ *   info - The location to return the accounting state
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int dma_poolinfo(FAR struct dma_pool_s *pool,
+                 FAR struct dma_poolinfo_s *info)
+{
+  irqstate_t flags;
+
+  if (pool == NULL || info == NULL)
+    {
+      return -EINVAL;
+    }
+
+  flags = enter_critical_section();
+  info->name      = pool->dp_name;
+  info->nallocs   = pool->dp_nallocs;
+  info->nfrees    = pool->dp_nfrees;
+  info->nfailures = pool->dp_nfailures;
+  info->curbytes  = pool->dp_curbytes;
+  info->peakbytes = pool->dp_peakbytes;
+  info->arena     = pool->dp_arena;
+  leave_critical_section(flags);
+
+  return OK;
+}
+
+#endif /* CONFIG_MM_DMA */
@@ -32,6 +32,69 @@
 
 #ifdef CONFIG_GRAN
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: gran_ffz
+ *
+ * Description:
+ *   Return the bit index of the first zero bit in a GAT entry, beginning
+ *   with the least significant bit.
+ *
+ * Input Parameters:
+ *   value - The GAT entry to be searched.  At least one bit must be zero.
+ *
+ * Returned Value:
+ *   The index (0-31) of the first zero bit.
+ *
+ ****************************************************************************/
+
+static inline int gran_ffz(uint32_t value)
+{
+#ifdef CONFIG_HAVE_BUILTIN_CTZ
+  /* Count trailing zeros of the complement to find the first zero bit */
+
+  return __builtin_ctz(~value);
+#else
+  int shift = 0;
+
+  /* Binary search for the first zero bit */
+
+  if ((value & 0x0000ffff) == 0x0000ffff)
+    {
+      value >>= 16;
+      shift  += 16;
+    }
+
+  if ((value & 0x000000ff) == 0x000000ff)
+    {
+      value >>= 8;
+      shift  += 8;
+    }
+
+  if ((value & 0x0000000f) == 0x0000000f)
+    {
+      value >>= 4;
+      shift  += 4;
+    }
+
+  if ((value & 0x00000003) == 0x00000003)
+    {
+      value >>= 2;
+      shift  += 2;
+    }
+
+  if ((value & 0x00000001) == 0x00000001)
+    {
+      shift++;
+    }
+
+  return shift;
+#endif
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -67,6 +130,8 @@ FAR void *gran_alloc(GRAN_HANDLE handle, size_t size)
   uint32_t     mask;
   int          granidx;
   int          gatidx;
+  int          gatndx;
+  int          ngats;
   int          bitidx;
   int          shift;
   int          ret;
@@ -93,14 +158,27 @@ FAR void *gran_alloc(GRAN_HANDLE handle, size_t size)
       DEBUGASSERT(ngranules <= 32);
       mask = 0xffffffff >> (32 - ngranules);
 
-      /* Now search the granule allocation table for that number of contiguous */
+      /* Now search the granule allocation table for that number of
+       * contiguous granules.  The search is performed one 32-bit GAT
+       * entry at a time, beginning at the rotating next-fit hint left by
+       * the last successful allocation or free and wrapping around the
+       * end of the table.
+       */
 
-      for (granidx = 0; granidx < priv->ngranules; granidx += 32)
+      ngats = (priv->ngranules + 31) >> 5;
+
+      for (gatndx = 0; gatndx < ngats; gatndx++)
         {
           /* Get the GAT index associated with the granule table entry */
 
-          gatidx = granidx >> 5;
-          curr = priv->gat[gatidx];
+          gatidx = priv->sgatidx + gatndx;
+          if (gatidx >= ngats)
+            {
+              gatidx -= ngats;
+            }
+
+          granidx = gatidx << 5;
+          curr    = priv->gat[gatidx];
 
           /* Handle the case where there are no free granules in the entry */
 
@@ -111,7 +189,7 @@ FAR void *gran_alloc(GRAN_HANDLE handle, size_t size)
 
           /* Get the next entry from the GAT to support a 64 bit shift */
 
-          if (granidx < priv->ngranules)
+          if (gatidx + 1 < ngats)
             {
               next = priv->gat[gatidx + 1];
             }
@@ -150,80 +228,38 @@ FAR void *gran_alloc(GRAN_HANDLE handle, size_t size)
                   break;
                 }
 
-              /* Check for the first zero bit in the lower or upper 16-bits.
-               * From the test above, we know that at least one of the 32-
-               * bits in 'curr' is zero.
-               */
-
-              else if ((curr & 0x0000ffff) == 0x0000ffff)
-                {
-                  /* Not in the lower 16 bits.  The first free bit must be
-                   * in the upper 16 bits.
-                   */
-
-                  shift = 16;
-                }
-
-              /* We know that the first free bit is now within the lower 16
-               * bits of 'curr'.  Is it in the upper or lower byte?
-               */
-
-              else if ((curr & 0x0000ff) == 0x000000ff)
-                {
-                  /* Not in the lower 8 bits.  The first free bit must be in
-                   * the upper 8 bits.
-                   */
-
-                  shift = 8;
-                }
-
-              /* We know that the first free bit is now within the lower 4
-               * bits of 'curr'.  Is it in the upper or lower nibble?
-               */
-
-              else if ((curr & 0x00000f) == 0x0000000f)
-                {
-                  /* Not in the lower 4 bits.  The first free bit must be in
-                   * the upper 4 bits.
-                   */
-
-                  shift = 4;
-                }
-
-              /* We know that the first free bit is now within the lower 4
-               * bits of 'curr'.  Is it in the upper or lower pair?
+              /* Jump directly to the position of the first zero bit in
+               * 'curr'.  From the test above, we know that at least one
+               * of the 32-bits in 'curr' is zero.
                */
 
-              else if ((curr & 0x000003) == 0x00000003)
+              shift = gran_ffz(curr);
+              if (shift == 0)
                 {
-                  /* Not in the lower 2 bits.  The first free bit must be in
-                   * the upper 2 bits.
+                  /* The first free granule is at this bit position.  Check
+                   * if we have the whole allocation here.
                    */
 
-                  shift = 2;
-                }
+                  if ((curr & mask) == 0)
+                    {
+                      /* Yes.. mark these granules allocated */
 
-              /* We know that the first free bit is now within the lower 4
-               * bits of 'curr'.  Check if we have the allocation at this
-               * bit position.
-               */
+                      gran_mark_allocated(priv, alloc, ngranules);
 
-              else if ((curr & mask) == 0)
-                {
-                  /* Yes.. mark these granules allocated */
+                      /* Remember where the allocation was found so that
+                       * the next search begins in the same GAT entry.
+                       */
 
-                  gran_mark_allocated(priv, alloc, ngranules);
+                      priv->sgatidx = gatidx;
 
-                  /* And return the allocation address */
+                      /* And return the allocation address */
 
-                  gran_leave_critical(priv);
-                  return (FAR void *)alloc;
-                }
+                      gran_leave_critical(priv);
+                      return (FAR void *)alloc;
+                    }
 
-              /* The free allocation does not start at this position */
+                  /* The free region at this position is too small */
 
-              else
-                {
                   shift = 1;
                 }
 
@@ -129,6 +129,12 @@ void gran_free(GRAN_HANDLE handle, FAR void *memory, size_t size)
       priv->gat[gatidx] &= ~gatmask;
     }
 
+  /* Direct the next search at the just-freed region so that a repeated
+   * same-size allocation is satisfied in constant time.
+   */
+
+  priv->sgatidx = gatidx;
+
   gran_leave_critical(priv);
 }
 
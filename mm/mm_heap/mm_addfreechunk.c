@@ -87,4 +87,8 @@ void mm_addfreechunk(FAR struct mm_heap_s *heap, FAR struct mm_freenode_s *node)
 
       next->blink = node;
     }
+
+  /* Count the chunk in the incremental telemetry */
+
+  MM_STATS_ADDFREE(heap, node);
 }
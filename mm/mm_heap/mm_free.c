@@ -140,6 +140,25 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
 
   DEBUGASSERT(node->preceding & MM_ALLOC_BIT);
 
+#ifdef CONFIG_MM_QUICKLIST
+  /* Small chunks go to the quick list of their size class instead of to
+   * the nodelist.  They keep their MM_ALLOC_BIT so that neighboring
+   * chunks will not coalesce with them, and they will be handed back by
+   * the next mm_malloc() of the same size class without any searching.
+   */
+
+  if (node->size <= CONFIG_MM_QUICKLIST_MAX)
+    {
+      int ndx = MM_QUICKLIST_NDX(node->size);
+
+      node->flink = heap->mm_quicklist[ndx];
+      heap->mm_quicklist[ndx] = node;
+
+      mm_givesemaphore(heap);
+      return;
+    }
+#endif
+
   node->preceding &= ~MM_ALLOC_BIT;
 
   /* Check if the following node is free and, if so, merge it */
@@ -169,6 +188,8 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
           next->flink->blink = next->blink;
         }
 
+      MM_STATS_RMFREE(heap, next);
+
       /* Then merge the two chunks */
 
       node->size          += next->size;
@@ -196,6 +217,8 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
           prev->flink->blink = prev->blink;
         }
 
+      MM_STATS_RMFREE(heap, prev);
+
       /* Then merge the two chunks */
 
       prev->size     += node->size;
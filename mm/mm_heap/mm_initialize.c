@@ -183,6 +183,12 @@ void mm_initialize(FAR struct mm_heap_s *heap, FAR void *heapstart,
 
   heap->mm_delaylist = NULL;
 
+#ifdef CONFIG_MM_QUICKLIST
+  /* Initialize the quick lists */
+
+  memset(heap->mm_quicklist, 0, sizeof(heap->mm_quicklist));
+#endif
+
   /* Initialize the node array */
 
   memset(heap->mm_nodelist, 0, sizeof(struct mm_freenode_s) * MM_NNODES);
@@ -64,6 +64,9 @@ int mm_mallinfo(FAR struct mm_heap_s *heap, FAR struct mallinfo *info)
   FAR struct mm_allocnode_s *prev;
 #endif
   size_t mxordblk = 0;
+#ifdef CONFIG_MM_QUICKLIST
+  int    i;
+#endif
   int    ordblks  = 0;  /* Number of non-inuse chunks */
   size_t uordblks = 0;  /* Total allocated space */
   size_t fordblks = 0;  /* Total non-inuse space */
@@ -145,6 +148,47 @@ int mm_mallinfo(FAR struct mm_heap_s *heap, FAR struct mallinfo *info)
     }
 #undef region
 
+#ifdef CONFIG_MM_HEAP_STATS
+  /* The full walk gives exact values, so take the opportunity to
+   * re-synchronize the incremental counters.  In particular this is the
+   * only point at which the largest-free-chunk estimate can decay.
+   */
+
+  mm_takesemaphore(heap);
+  heap->mm_stats.mm_freebytes = fordblks;
+  heap->mm_stats.mm_maxfree   = mxordblk;
+  mm_givesemaphore(heap);
+#endif
+
+#ifdef CONFIG_MM_QUICKLIST
+  /* Chunks held on the quick lists carry the MM_ALLOC_BIT and were
+   * counted above as allocated.  Report them as available instead since
+   * they will satisfy future small allocations.
+   */
+
+  mm_takesemaphore(heap);
+
+  for (i = 0; i < MM_QUICKLIST_NCLASSES; i++)
+    {
+      FAR struct mm_freenode_s *qnode;
+
+      for (qnode = heap->mm_quicklist[i];
+           qnode != NULL;
+           qnode = qnode->flink)
+        {
+          ordblks++;
+          uordblks -= qnode->size;
+          fordblks += qnode->size;
+          if (qnode->size > mxordblk)
+            {
+              mxordblk = qnode->size;
+            }
+        }
+    }
+
+  mm_givesemaphore(heap);
+#endif
+
   DEBUGASSERT(uordblks + fordblks == heap->mm_heapsize);
 
   info->arena    = heap->mm_heapsize;
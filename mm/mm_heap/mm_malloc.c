@@ -140,6 +140,37 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 
   mm_takesemaphore(heap);
 
+#ifdef CONFIG_MM_QUICKLIST
+  /* Small allocations are served first from the quick list of the matching
+   * size class.  Chunks on the quick lists are still marked allocated, so
+   * all that is needed is to unlink the head of the list.
+   */
+
+  if (alignsize <= CONFIG_MM_QUICKLIST_MAX)
+    {
+      FAR struct mm_freenode_s *qnode;
+
+      ndx   = MM_QUICKLIST_NDX(alignsize);
+      qnode = heap->mm_quicklist[ndx];
+      if (qnode != NULL)
+        {
+          DEBUGASSERT(qnode->size == alignsize);
+          DEBUGASSERT((qnode->preceding & MM_ALLOC_BIT) != 0);
+
+          heap->mm_quicklist[ndx] = qnode->flink;
+
+#ifdef CONFIG_MM_HEAP_STATS
+          mm_stats_alloc(heap, alignsize, __builtin_return_address(0));
+#endif
+          mm_givesemaphore(heap);
+
+          ret = (FAR void *)((FAR char *)qnode + SIZEOF_MM_ALLOCNODE);
+          minfo("quicklist allocated %p, size %zu\n", ret, alignsize);
+          return ret;
+        }
+    }
+#endif
+
   /* Get the location in the node list to start the search. Special case
    * really big allocations
    */
@@ -189,6 +220,8 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
           node->flink->blink = node->blink;
         }
 
+      MM_STATS_RMFREE(heap, node);
+
       /* Check if we have to split the free node into one of the allocated
        * size and another smaller freenode.  In some cases, the remaining
        * bytes can be smaller (they may be SIZEOF_MM_ALLOCNODE).  In that
@@ -233,6 +266,13 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
       ret = (void *)((FAR char *)node + SIZEOF_MM_ALLOCNODE);
     }
 
+#ifdef CONFIG_MM_HEAP_STATS
+  if (ret)
+    {
+      mm_stats_alloc(heap, alignsize, __builtin_return_address(0));
+    }
+#endif
+
   DEBUGASSERT(ret == NULL || mm_heapmember(heap, ret));
   mm_givesemaphore(heap);
 
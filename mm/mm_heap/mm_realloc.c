@@ -236,6 +236,8 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem,
               prev->flink->blink = prev->blink;
             }
 
+          MM_STATS_RMFREE(heap, prev);
+
           /* Extend the node into the previous free chunk */
 
           newnode = (FAR struct mm_allocnode_s *)
@@ -310,6 +312,8 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem,
               next->flink->blink = next->blink;
             }
 
+          MM_STATS_RMFREE(heap, next);
+
           /* Extend the node into the next chunk */
 
           oldnode->size = oldsize + takenext;
@@ -95,6 +95,8 @@ void  mm_shrinkchunk(FAR struct mm_heap_s *heap,
           next->flink->blink = next->blink;
         }
 
+      MM_STATS_RMFREE(heap, next);
+
       /* Create a new chunk that will hold both the next chunk and the
        * tailing memory from the aligned chunk.
        */
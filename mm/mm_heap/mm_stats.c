@@ -0,0 +1,150 @@
+/****************************************************************************
+ * mm/mm_heap/mm_stats.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <string.h>
+#include <assert.h>
+
+#include <nuttx/mm/mm.h>
+
+#ifdef CONFIG_MM_HEAP_STATS
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mm_stats_alloc
+ *
+ * Description:
+ *   Record one successful allocation in the telemetry counters:  count it
+ *   in the power-of-two size histogram and, if the sampled profiler is
+ *   enabled, attribute every Nth allocation to its call site.  The caller
+ *   must hold the heap semaphore.
+ *
+ * Input Parameters:
+ *   heap     - The heap that made the allocation
+ *   size     - The (aligned) size of the allocated chunk
+ *   callsite - The return address of the caller of mm_malloc().  Ignored
+ *              unless CONFIG_MM_HEAP_STATS_PROFILER is selected.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mm_stats_alloc(FAR struct mm_heap_s *heap, size_t size,
+                    FAR void *callsite)
+{
+#ifdef CONFIG_MM_HEAP_STATS_PROFILER
+  FAR struct mm_sampledsite_s *site;
+  FAR struct mm_sampledsite_s *avail;
+  int i;
+#endif
+  int ndx;
+
+  /* Count the allocation in the histogram bin matching its size class */
+
+  if (size >= MM_MAX_CHUNK)
+    {
+      ndx = MM_NNODES - 1;
+    }
+  else
+    {
+      ndx = mm_size2ndx(size);
+    }
+
+  heap->mm_stats.mm_nallocs[ndx]++;
+
+#ifdef CONFIG_MM_HEAP_STATS_PROFILER
+  /* Attribute every Nth allocation to its call site.  Sampling keeps the
+   * overhead of the table search off the common allocation path.
+   */
+
+  if (++heap->mm_stats.mm_nsamples % CONFIG_MM_HEAP_STATS_SAMPLERATE != 0)
+    {
+      return;
+    }
+
+  avail = NULL;
+  for (i = 0; i < CONFIG_MM_HEAP_STATS_NSITES; i++)
+    {
+      site = &heap->mm_stats.mm_sites[i];
+      if (site->ms_callsite == callsite)
+        {
+          site->ms_count++;
+          site->ms_bytes += size;
+          return;
+        }
+
+      if (site->ms_callsite == NULL && avail == NULL)
+        {
+          avail = site;
+        }
+    }
+
+  if (avail != NULL)
+    {
+      avail->ms_callsite = callsite;
+      avail->ms_count    = 1;
+      avail->ms_bytes    = size;
+    }
+  else
+    {
+      /* The table is full.  Lump the sample with the other overflow. */
+
+      heap->mm_stats.mm_othercount++;
+      heap->mm_stats.mm_otherbytes += size;
+    }
+#endif
+}
+
+/****************************************************************************
+ * Name: mm_stats
+ *
+ * Description:
+ *   Return a snapshot of the incrementally maintained heap telemetry.
+ *   Unlike mm_mallinfo(), this does not walk the heap; it only copies the
+ *   counters under the heap semaphore.
+ *
+ * Input Parameters:
+ *   heap  - The heap to be queried
+ *   stats - The location to return the telemetry snapshot
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void mm_stats(FAR struct mm_heap_s *heap, FAR struct mm_stats_s *stats)
+{
+  DEBUGASSERT(heap != NULL && stats != NULL);
+
+  mm_takesemaphore(heap);
+  memcpy(stats, &heap->mm_stats, sizeof(struct mm_stats_s));
+  mm_givesemaphore(heap);
+}
+
+#endif /* CONFIG_MM_HEAP_STATS */
@@ -135,9 +135,48 @@ int shm_group_initialize(FAR struct task_group_s *group)
 
 void shm_group_release(FAR struct task_group_s *group)
 {
+#ifdef CONFIG_MM_SHM_MAP_CACHE
+  FAR struct shm_region_s *region;
+  int shmid;
+#endif
   GRAN_HANDLE handle;
   DEBUGASSERT(group);
 
+#ifdef CONFIG_MM_SHM_MAP_CACHE
+  /* Drop the attach references held by any cached mappings.  The MMU
+   * mappings themselves disappear along with the group's address
+   * environment, but the region bookkeeping must be updated so that
+   * unlinked regions are eventually destroyed.
+   */
+
+  for (shmid = 0; shmid < CONFIG_ARCH_SHM_MAXREGIONS; shmid++)
+    {
+      if (group->tg_shm.gs_cached[shmid])
+        {
+          region = &g_shminfo.si_region[shmid];
+
+          nxsem_wait_uninterruptible(&region->sr_sem);
+
+          DEBUGASSERT(region->sr_ds.shm_nattch > 0);
+          if (region->sr_ds.shm_nattch <= 1)
+            {
+              region->sr_ds.shm_nattch = 0;
+              if ((region->sr_flags & SRFLAG_UNLINKED) != 0)
+                {
+                  shm_destroy(shmid);
+                  continue;
+                }
+            }
+          else
+            {
+              region->sr_ds.shm_nattch--;
+            }
+
+          nxsem_post(&region->sr_sem);
+        }
+    }
+#endif
+
   handle = group->tg_shm.gs_handle;
   if (handle)
     {
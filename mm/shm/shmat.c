@@ -128,8 +128,14 @@ FAR void *shmat(int shmid, FAR const void *shmaddr, int shmflg)
   tcb = nxsched_self();
   DEBUGASSERT(tcb && tcb->group);
   group = tcb->group;
+#ifdef CONFIG_MM_SHM_MAP_CACHE
+  DEBUGASSERT(group->tg_shm.gs_handle != NULL &&
+              (group->tg_shm.gs_vaddr[shmid] == 0 ||
+               group->tg_shm.gs_cached[shmid]));
+#else
   DEBUGASSERT(group->tg_shm.gs_handle != NULL &&
               group->tg_shm.gs_vaddr[shmid] == 0);
+#endif
 
   /* Get exclusive access to the region data structure */
 
@@ -140,6 +146,27 @@ FAR void *shmat(int shmid, FAR const void *shmaddr, int shmflg)
       goto errout_with_ret;
     }
 
+#ifdef CONFIG_MM_SHM_MAP_CACHE
+  /* Check for a mapping of this region that was kept warm by a previous
+   * shmdt().  The cached mapping still holds an attach reference and the
+   * MMU is still programmed, so only the accounting needs refreshing.
+   */
+
+  if (group->tg_shm.gs_cached[shmid])
+    {
+      group->tg_shm.gs_cached[shmid] = false;
+      vaddr = group->tg_shm.gs_vaddr[shmid];
+
+      /* Save the process ID and time of the last shmat() */
+
+      region->sr_ds.shm_lpid  = tcb->pid;
+      region->sr_ds.shm_atime = time(NULL);
+
+      nxsem_post(&region->sr_sem);
+      return (FAR void *)vaddr;
+    }
+#endif
+
   /* Set aside a virtual address space to span this physical region */
 
   vaddr = (uintptr_t)gran_alloc(group->tg_shm.gs_handle,
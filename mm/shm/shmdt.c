@@ -97,6 +97,19 @@ int shmdt(FAR const void *shmaddr)
       goto errout_with_errno;
     }
 
+#ifdef CONFIG_MM_SHM_MAP_CACHE
+  /* A cached mapping is not attached:  detaching it a second time is an
+   * application error just as it would be without the cache.
+   */
+
+  if (group->tg_shm.gs_cached[shmid])
+    {
+      shmerr("ERROR: Region at %p is already detached\n", shmaddr);
+      ret = -EINVAL;
+      goto errout_with_errno;
+    }
+#endif
+
   /* Get the region associated with the shmid */
 
   region =  &g_shminfo.si_region[shmid];
@@ -111,6 +124,29 @@ int shmdt(FAR const void *shmaddr)
       goto errout_with_errno;
     }
 
+#ifdef CONFIG_MM_SHM_MAP_CACHE
+  /* Unless the region has been marked for deletion, keep the mapping
+   * warm:  the virtual address range stays allocated and the MMU stays
+   * programmed, and the attach reference is carried over to the cache
+   * so that the physical pages cannot be freed underneath the mapping.
+   * A later shmat() of the same region will then skip both gran_alloc()
+   * and up_shmat().
+   */
+
+  if ((region->sr_flags & SRFLAG_UNLINKED) == 0)
+    {
+      group->tg_shm.gs_cached[shmid] = true;
+
+      /* Save the process ID and time of the last shmdt() */
+
+      region->sr_ds.shm_lpid  = tcb->pid;
+      region->sr_ds.shm_dtime = time(NULL);
+
+      nxsem_post(&region->sr_sem);
+      return OK;
+    }
+#endif
+
   /* Free the virtual address space */
 
   gran_free(group->tg_shm.gs_handle, (FAR void *)shmaddr,
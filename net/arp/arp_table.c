@@ -72,6 +72,19 @@
 
 #define ARP_MAXAGE_TICK SEC2TICK(10 * CONFIG_NET_ARP_MAXAGE)
 
+/* Each IP address hashes to a small set of candidate table entries.  Both
+ * lookup and insertion consider only the entries of that set so that the
+ * cost of TX-path address resolution does not grow with the size of the
+ * table.  Four ways per set keeps conflict evictions rare while bounding
+ * the probe length.
+ */
+
+#if CONFIG_NET_ARPTAB_SIZE < 4
+#  define ARP_HASH_NWAYS CONFIG_NET_ARPTAB_SIZE
+#else
+#  define ARP_HASH_NWAYS 4
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -94,6 +107,31 @@ static struct arp_entry_s g_arptable[CONFIG_NET_ARPTAB_SIZE];
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: arp_hash
+ *
+ * Description:
+ *   Return the index of the first candidate ARP table entry for the IP
+ *   address.  The candidate set consists of the ARP_HASH_NWAYS entries
+ *   beginning at that index (wrapping at the end of the table).
+ *
+ ****************************************************************************/
+
+static int arp_hash(in_addr_t ipaddr)
+{
+  uint32_t hash = ipaddr;
+
+  /* The IP address is in network byte order.  Fold all four octets into
+   * the hash value so that addresses differing only in the host part do
+   * not collide.
+   */
+
+  hash ^= hash >> 16;
+  hash ^= hash >> 8;
+
+  return (int)(hash % CONFIG_NET_ARPTAB_SIZE);
+}
+
 /****************************************************************************
  * Name: arp_match
  *
@@ -195,33 +233,39 @@ arp_return_old_entry(FAR struct arp_entry_s *e1, FAR struct arp_entry_s *e2)
 
 int arp_update(in_addr_t ipaddr, FAR uint8_t *ethaddr)
 {
-  FAR struct arp_entry_s *tabptr = &g_arptable[0];
+  FAR struct arp_entry_s *tabptr;
+  int ndx = arp_hash(ipaddr);
   int i;
 
-  /* Walk through the ARP mapping table and try to find an entry to
-   * update. If none is found, the IP -> MAC address mapping is
-   * inserted in the ARP table.
+  /* Walk through the candidate set of ARP table entries and try to find
+   * an entry to update.  If none is found, the IP -> MAC address mapping
+   * replaces the oldest entry of the set.
    */
 
-  for (i = 0; i < CONFIG_NET_ARPTAB_SIZE; ++i)
+  tabptr = &g_arptable[ndx];
+
+  for (i = 0; i < ARP_HASH_NWAYS; ++i)
     {
+      FAR struct arp_entry_s *candidate =
+        &g_arptable[(ndx + i) % CONFIG_NET_ARPTAB_SIZE];
+
       /* Check if the source IP address of the incoming packet matches
        * the IP address in this ARP table entry.
        */
 
-      if (g_arptable[i].at_ipaddr != 0 &&
-          net_ipv4addr_cmp(ipaddr, g_arptable[i].at_ipaddr))
+      if (candidate->at_ipaddr != 0 &&
+          net_ipv4addr_cmp(ipaddr, candidate->at_ipaddr))
         {
           /* An old entry found, break. */
 
-          tabptr = &g_arptable[i];
+          tabptr = candidate;
           break;
         }
       else
         {
           /* Record the oldest entry. */
 
-          tabptr = arp_return_old_entry(tabptr, &g_arptable[i]);
+          tabptr = arp_return_old_entry(tabptr, candidate);
         }
     }
 
@@ -282,13 +326,18 @@ void arp_hdr_update(FAR uint16_t *pipaddr, FAR uint8_t *ethaddr)
 FAR struct arp_entry_s *arp_lookup(in_addr_t ipaddr)
 {
   FAR struct arp_entry_s *tabptr;
+  int ndx = arp_hash(ipaddr);
   int i;
 
-  /* Check if the IPv4 address is already in the ARP table. */
+  /* Check if the IPv4 address is in its candidate set of ARP table
+   * entries.  Expired entries are skipped (and will eventually be
+   * reclaimed by the oldest-entry replacement in arp_update()) so that
+   * no periodic sweep of the table is needed.
+   */
 
-  for (i = 0; i < CONFIG_NET_ARPTAB_SIZE; ++i)
+  for (i = 0; i < ARP_HASH_NWAYS; ++i)
     {
-      tabptr = &g_arptable[i];
+      tabptr = &g_arptable[(ndx + i) % CONFIG_NET_ARPTAB_SIZE];
       if (net_ipv4addr_cmp(ipaddr, tabptr->at_ipaddr) &&
           clock_systime_ticks() - tabptr->at_time <= ARP_MAXAGE_TICK)
         {
@@ -279,16 +279,26 @@ extern "C"
 #define EXTERN extern
 #endif
 
-#ifdef CONFIG_NET_IPv4_REASSEMBLY
-/* Reassembly timer (units: deci-seconds) */
-
-EXTERN uint8_t g_reassembly_timer;
-#endif
-
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: devif_ipv4_reasstimer
+ *
+ * Description:
+ *   Age the active IPv4 reassembly queues and drop any that have waited
+ *   too long for their missing fragments.  Called from devif_timer().
+ *
+ * Input Parameters:
+ *   hsec - The elapsed time, in units of half-seconds.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4_REASSEMBLY
+void devif_ipv4_reasstimer(int hsec);
+#endif
+
 /****************************************************************************
  * Name: devif_initialize
  *
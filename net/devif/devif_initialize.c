@@ -62,12 +62,6 @@
 struct net_stats_s g_netstats;
 #endif
 
-#ifdef CONFIG_NET_IPv4_REASSEMBLY
-/* Reassembly timer (units: deci-seconds) */
-
-uint8_t g_reassembly_timer;
-#endif
-
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -193,6 +193,27 @@ static void devif_packet_conversion(FAR struct net_driver_s *dev,
 #  define devif_packet_conversion(dev,pkttype)
 #endif /* CONFIG_NET_6LOWPAN */
 
+/****************************************************************************
+ * Name: devif_poll_out
+ *
+ * Description:
+ *   Generic callback before device poll callback is invoked.  Accounts for
+ *   any outgoing packet that the poll generated before handing it to the
+ *   device driver for transmission.
+ *
+ ****************************************************************************/
+
+static int devif_poll_out(FAR struct net_driver_s *dev,
+                          devif_poll_callback_t callback)
+{
+  if (dev->d_len > 0)
+    {
+      NETDEV_TXBYTES(dev, dev->d_len);
+    }
+
+  return callback(dev);
+}
+
 /****************************************************************************
  * Name: devif_poll_pkt_connections
  *
@@ -226,7 +247,7 @@ static int devif_poll_pkt_connections(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
 
   return bstop;
@@ -264,7 +285,7 @@ static int devif_poll_can_connections(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
 
   return bstop;
@@ -300,7 +321,7 @@ static int devif_poll_bluetooth_connections(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
 
   return bstop;
@@ -336,7 +357,7 @@ static int devif_poll_ieee802154_connections(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
 
   return bstop;
@@ -372,7 +393,7 @@ static inline int devif_poll_icmp(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
 
   return bstop;
@@ -412,7 +433,7 @@ static inline int devif_poll_icmpv6(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
   while (!bstop && (conn = icmpv6_nextconn(conn)) != NULL);
 
@@ -443,7 +464,7 @@ static inline int devif_poll_forward(FAR struct net_driver_s *dev,
 
   /* Call back into the driver */
 
-  return callback(dev);
+  return devif_poll_out(dev, callback);
 }
 #endif /* CONFIG_NET_ICMPv6_SOCKET || CONFIG_NET_ICMPv6_NEIGHBOR*/
 
@@ -463,17 +484,33 @@ static inline int devif_poll_forward(FAR struct net_driver_s *dev,
 static inline int devif_poll_igmp(FAR struct net_driver_s *dev,
                                   devif_poll_callback_t callback)
 {
-  /* Perform the IGMP TX poll */
+  int bstop;
 
-  igmp_poll(dev);
+  /* Send all pending IGMP messages in this one poll pass so that groups
+   * whose report timers expired together do not each have to wait for a
+   * separate pass.
+   */
 
-  /* Perform any necessary conversions on outgoing packets */
+  do
+    {
+      /* Perform the IGMP TX poll */
 
-  devif_packet_conversion(dev, DEVIF_IGMP);
+      igmp_poll(dev);
 
-  /* Call back into the driver */
+      /* Perform any necessary conversions on outgoing packets */
 
-  return callback(dev);
+      devif_packet_conversion(dev, DEVIF_IGMP);
+
+      /* Call back into the driver.  Continue as long as the poll
+       * generated a message (d_len is non-zero after the poll) and the
+       * driver continues to accept them.
+       */
+
+      bstop = devif_poll_out(dev, callback);
+    }
+  while (!bstop && dev->d_len > 0);
+
+  return bstop;
 }
 #endif /* CONFIG_NET_IGMP */
 
@@ -493,17 +530,33 @@ static inline int devif_poll_igmp(FAR struct net_driver_s *dev,
 static inline int devif_poll_mld(FAR struct net_driver_s *dev,
                                  devif_poll_callback_t callback)
 {
-  /* Perform the MLD TX poll */
+  int bstop;
+
+  /* Send all pending MLD messages in this one poll pass so that groups
+   * whose report timers expired together do not each have to wait for a
+   * separate pass.
+   */
 
-  mld_poll(dev);
+  do
+    {
+      /* Perform the MLD TX poll */
 
-  /* Perform any necessary conversions on outgoing ICMPv6 packets */
+      mld_poll(dev);
 
-  devif_packet_conversion(dev, DEVIF_ICMP6);
+      /* Perform any necessary conversions on outgoing ICMPv6 packets */
 
-  /* Call back into the driver */
+      devif_packet_conversion(dev, DEVIF_ICMP6);
 
-  return callback(dev);
+      /* Call back into the driver.  Continue as long as the poll
+       * generated a message (d_len is non-zero after the poll) and the
+       * driver continues to accept them.
+       */
+
+      bstop = devif_poll_out(dev, callback);
+    }
+  while (!bstop && dev->d_len > 0);
+
+  return bstop;
 }
 #endif /* CONFIG_NET_MLD */
 
@@ -540,7 +593,7 @@ static int devif_poll_udp_connections(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
 
   return bstop;
@@ -565,22 +618,57 @@ static inline int devif_poll_tcp_connections(FAR struct net_driver_s *dev,
 {
   FAR struct tcp_conn_s *conn  = NULL;
   int bstop = 0;
+  int burst;
 
   /* Traverse all of the active TCP connections and perform the poll action */
 
   while (!bstop && (conn = tcp_nextconn(conn)))
     {
-      /* Perform the TCP TX poll */
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+      /* Service an expired per-connection timer first so that a pending
+       * retransmission or probe is not deferred until the next periodic
+       * timer poll of the driver.  The expiry handler requested this poll
+       * via the txnotify callback of the device.
+       */
 
-      tcp_poll(dev, conn);
+      if (conn->wdog_expired)
+        {
+          conn->wdog_expired = false;
+          tcp_timer(dev, conn, conn->wdog_hsec);
+          devif_packet_conversion(dev, DEVIF_TCP);
+          bstop = devif_poll_out(dev, callback);
+          if (bstop)
+            {
+              break;
+            }
+        }
+#endif
 
-      /* Perform any necessary conversions on outgoing packets */
+      burst = CONFIG_NET_TCP_POLL_BURST;
 
-      devif_packet_conversion(dev, DEVIF_TCP);
+      do
+        {
+          /* Perform the TCP TX poll */
 
-      /* Call back into the driver */
+          tcp_poll(dev, conn);
+
+          /* Perform any necessary conversions on outgoing packets */
+
+          devif_packet_conversion(dev, DEVIF_TCP);
+
+          /* Call back into the driver */
 
-      bstop = callback(dev);
+          bstop = devif_poll_out(dev, callback);
+
+          /* Re-poll the same connection while it continues to generate
+           * segments (d_len is non-zero after the poll) and the driver
+           * continues to accept them, up to the configured burst limit.
+           * This lets a connection with a large backlog of TX data fill
+           * multiple driver TX buffers in a single poll pass instead of
+           * sending one segment per pass.
+           */
+        }
+      while (!bstop && dev->d_len > 0 && --burst > 0);
     }
 
   return bstop;
@@ -614,9 +702,29 @@ static inline int devif_poll_tcp_timer(FAR struct net_driver_s *dev,
 
   while (!bstop && (conn = tcp_nextconn(conn)))
     {
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+      /* Each connection keeps its own deadline with a watchdog timer.
+       * Only connections whose watchdog has expired need any timer
+       * processing; idle connections are skipped entirely.
+       */
+
+      if (!conn->wdog_expired)
+        {
+          continue;
+        }
+
+      conn->wdog_expired = false;
+
+      /* Perform the TCP timer poll using the interval that the expired
+       * watchdog was armed with.
+       */
+
+      tcp_timer(dev, conn, conn->wdog_hsec);
+#else
       /* Perform the TCP timer poll */
 
       tcp_timer(dev, conn, hsec);
+#endif
 
       /* Perform any necessary conversions on outgoing packets */
 
@@ -624,7 +732,7 @@ static inline int devif_poll_tcp_timer(FAR struct net_driver_s *dev,
 
       /* Call back into the driver */
 
-      bstop = callback(dev);
+      bstop = devif_poll_out(dev, callback);
     }
 
   return bstop;
@@ -666,6 +774,8 @@ int devif_poll(FAR struct net_driver_s *dev, devif_poll_callback_t callback)
 {
   int bstop = false;
 
+  NETDEV_TXPOLLS(dev);
+
   /* Traverse all of the active packet connections and perform the poll
    * action.
    */
@@ -819,13 +929,9 @@ int devif_timer(FAR struct net_driver_s *dev, int delay,
   int bstop = false;
 
 #ifdef CONFIG_NET_IPv4_REASSEMBLY
-  /* Increment the timer used by the IP reassembly logic */
+  /* Age the IP reassembly queues, dropping any that have timed out */
 
-  if (g_reassembly_timer != 0 &&
-      g_reassembly_timer < CONFIG_NET_IPv4_REASS_MAXAGE)
-    {
-      g_reassembly_timer += hsec;
-    }
+  devif_ipv4_reasstimer(hsec);
 #endif
 
 #ifdef NET_TCP_HAVE_STACK
@@ -836,6 +942,18 @@ int devif_timer(FAR struct net_driver_s *dev, int delay,
   bstop = devif_poll_tcp_timer(dev, callback, hsec);
 #endif
 
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+  /* Send a Neighbor Solicitation for any stale Neighbor Table entry on
+   * this device so that active address mappings are refreshed before they
+   * age out of the table.
+   */
+
+  if (!bstop)
+    {
+      bstop = icmpv6_refresh_poll(dev, callback);
+    }
+#endif
+
   /* If possible, continue with a normal poll checking for pending
    * network driver actions.
    */
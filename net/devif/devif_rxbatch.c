@@ -0,0 +1,173 @@
+/****************************************************************************
+ * net/devif/devif_rxbatch.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+#if defined(CONFIG_NET) && defined(CONFIG_NET_RXBATCH)
+
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/mm/iob.h>
+#include <nuttx/net/net.h>
+#include <nuttx/net/netdev.h>
+
+#include "devif/devif.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: devif_rx_enqueue
+ *
+ * Description:
+ *   Add one received frame, held in a chain of I/O buffers, to the RX
+ *   backlog of the device.  This function is intended to be called by the
+ *   device driver from the interrupt level or from a DMA completion
+ *   handler:  It does not take the network lock and does not wait for
+ *   resources.  The frame will be processed later when the driver calls
+ *   devif_rx_drain() from the worker thread.
+ *
+ *   The frame must begin with the link layer header and iob->io_pktlen
+ *   must hold the length of the frame.  On success, the I/O buffer chain
+ *   is owned by the RX backlog; on failure the caller retains ownership
+ *   and should recycle the buffers.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int devif_rx_enqueue(FAR struct net_driver_s *dev, FAR struct iob_s *iob)
+{
+  irqstate_t flags;
+  int ret;
+
+  DEBUGASSERT(dev != NULL && iob != NULL && iob->io_pktlen > 0);
+
+  /* Add the frame to the RX backlog.  iob_tryadd_queue() will not wait
+   * for a queue entry to become available, so this is safe at the
+   * interrupt level.  The critical section serializes the queue against
+   * the drain logic running on the worker thread.
+   */
+
+  flags = enter_critical_section();
+  ret = iob_tryadd_queue(iob, &dev->d_rxqueue);
+  leave_critical_section(flags);
+
+  return ret;
+}
+
+/****************************************************************************
+ * Name: devif_rx_drain
+ *
+ * Description:
+ *   Process frames from the RX backlog of the device.  For each frame, the
+ *   frame is copied into the driver d_buf, d_len is set, and the provided
+ *   'input' callback is invoked to dispatch the frame into the network
+ *   (and to transmit any response left in d_buf).  Up to 'budget' frames
+ *   are processed per call (or CONFIG_NET_RXBATCH_BUDGET frames if budget
+ *   is zero); the network is locked once for the whole batch.
+ *
+ *   This function must be called from the worker thread, never from the
+ *   interrupt level.  If the return value is equal to the budget, then
+ *   more frames may remain in the backlog and the driver should schedule
+ *   another pass.
+ *
+ * Returned Value:
+ *   The number of frames processed.
+ *
+ ****************************************************************************/
+
+int devif_rx_drain(FAR struct net_driver_s *dev,
+                   devif_poll_callback_t input, unsigned int budget)
+{
+  FAR struct iob_s *iob;
+  irqstate_t flags;
+  unsigned int nframes;
+  int bstop = 0;
+
+  DEBUGASSERT(dev != NULL && input != NULL);
+
+  if (budget == 0)
+    {
+      budget = CONFIG_NET_RXBATCH_BUDGET;
+    }
+
+  /* Lock the network once for the entire batch.  The per-frame work below
+   * then consists only of a brief critical section to dequeue the frame,
+   * the copy into d_buf, and the input dispatch itself.
+   */
+
+  net_lock();
+
+  for (nframes = 0; nframes < budget && !bstop; )
+    {
+      /* Remove the oldest frame from the RX backlog */
+
+      flags = enter_critical_section();
+      iob = iob_remove_queue(&dev->d_rxqueue);
+      leave_critical_section(flags);
+
+      if (iob == NULL)
+        {
+          /* The backlog is empty */
+
+          break;
+        }
+
+      /* Frames that cannot fit in the device packet buffer cannot be
+       * processed; drop them here.
+       */
+
+      if (iob->io_pktlen > dev->d_pktsize)
+        {
+          nwarn("WARNING: RX frame too big: %u > %u... Dropped\n",
+                iob->io_pktlen, dev->d_pktsize);
+
+          NETDEV_RXDROPPED(dev);
+          iob_free_chain(iob, IOBUSER_GLOBAL);
+          continue;
+        }
+
+      /* Copy the frame into the device packet buffer and dispatch it.
+       * The input callback may leave a response in d_buf with d_len > 0;
+       * it is responsible for transmitting that response and returns a
+       * non-zero value if it cannot accept further frames.
+       */
+
+      dev->d_len = iob_copyout(dev->d_buf, iob, iob->io_pktlen, 0);
+      iob_free_chain(iob, IOBUSER_GLOBAL);
+
+      nframes++;
+      bstop = input(dev);
+    }
+
+  net_unlock();
+  return nframes;
+}
+
+#endif /* CONFIG_NET && CONFIG_NET_RXBATCH */
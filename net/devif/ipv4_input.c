@@ -89,6 +89,7 @@
 #include <netinet/in.h>
 #include <net/if.h>
 
+#include <nuttx/mm/iob.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/netstats.h>
@@ -111,22 +112,49 @@
 /* Macros */
 
 #define BUF                  ((FAR struct ipv4_hdr_s *)&dev->d_buf[NET_LL_HDRLEN(dev)])
-#define FBUF                 ((FAR struct ipv4_hdr_s *)&g_reassembly_buffer[0])
 
 /* IP fragment re-assembly.
  *
- * REVISIT:  There are multiple issues with the current implementation:
- * 1. IPv4 reassembly is untested.
- * 2. Currently can only work with Ethernet due to the definition of
- *    IPv4_REASS_BUFSIZE.
- * 3. Since there is only a single reassembly buffer, IPv4 reassembly cannot
- *    be used in a context where multiple network devices may be concurrently
- *    re-assembling packets.
+ * Fragments are accumulated in a small table of reassembly queues.  Each
+ * queue holds the payload in an I/O buffer chain that grows on demand, so
+ * the only fixed per-queue RAM is the header, the hole bitmap, and some
+ * bookkeeping.  If the IOB pool is exhausted, the queue (and all of its
+ * buffered fragments) is dropped; that is the memory cap.
+ *
+ * REVISIT:  The maximum size of the reassembled packet is bounded by the
+ * size of the device d_buf that the completed packet is delivered in.
+ * This limits the feature to Ethernet where that size is known (see
+ * IPv4_REASS_BUFSIZE).
  */
 
 #define IP_MF                0x20  /* See IP_FLAG_MOREFRAGS */
 #define IPv4_REASS_BUFSIZE   (CONFIG_NET_ETH_PKTSIZE - ETH_HDRLEN)
-#define IPv4_REASS_LASTFRAG  0x01
+#define IPv4_REASS_MAXPAYLOAD (IPv4_REASS_BUFSIZE - IPv4_HDRLEN)
+#define IPv4_REASS_BITMAPSIZE (IPv4_REASS_MAXPAYLOAD / (8 * 8) + 1)
+
+#define IPv4_REASS_LASTFRAG  0x01  /* The final fragment has been seen */
+#define IPv4_REASS_INUSE     0x02  /* The reassembly queue is active */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4_REASSEMBLY
+/* This structure describes one partially reassembled packet */
+
+struct ipv4_reassdata_s
+{
+  FAR struct iob_s *rd_iob;     /* Accumulated payload (no IP header) */
+  uint16_t rd_srcipaddr[2];     /* Source IP address of the fragments */
+  uint16_t rd_destipaddr[2];    /* Destination IP address of the fragments */
+  uint8_t rd_ipid[2];           /* IP ID of the fragments */
+  uint8_t rd_iphdr[IPv4_HDRLEN]; /* IP header for the reassembled packet */
+  uint16_t rd_len;              /* Total payload length (last frag seen) */
+  uint8_t rd_age;               /* Age of the queue, devif_timer units */
+  uint8_t rd_flags;             /* See IPv4_REASS_* definitions */
+  uint8_t rd_bitmap[IPv4_REASS_BITMAPSIZE]; /* Map of the received holes */
+};
+#endif
 
 /****************************************************************************
  * Private Data
@@ -134,16 +162,17 @@
 
 #ifdef CONFIG_NET_IPv4_REASSEMBLY
 
-static uint8_t g_reassembly_buffer[IPv4_REASS_BUFSIZE];
-static uint8_t g_reassembly_bitmap[IPv4_REASS_BUFSIZE / (8 * 8)];
+static struct ipv4_reassdata_s
+  g_reassembly[CONFIG_NET_IPv4_REASS_NQUEUES];
 
 static const uint8_t g_bitmap_bits[8] =
 {
   0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01
 };
 
-static uint16_t g_reassembly_len;
-static uint8_t g_reassembly_flags;
+/* A block of zeroes used to fill the gap below an out-of-order fragment */
+
+static const uint8_t g_reass_zeroes[64];
 
 #endif /* CONFIG_NET_IPv4_REASSEMBLY */
 
@@ -151,162 +180,337 @@ static uint8_t g_reassembly_flags;
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: devif_reass_free
+ *
+ * Description:
+ *   Release a reassembly queue and all of the fragment data that it has
+ *   accumulated.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4_REASSEMBLY
+static void devif_reass_free(FAR struct ipv4_reassdata_s *reass)
+{
+  if (reass->rd_iob != NULL)
+    {
+      iob_free_chain(reass->rd_iob, IOBUSER_NET_IPREASSEMBLY);
+      reass->rd_iob = NULL;
+    }
+
+  reass->rd_flags = 0;
+}
+#endif
+
+/****************************************************************************
+ * Name: devif_reass_find
+ *
+ * Description:
+ *   Find the reassembly queue that the fragment in the device buffer
+ *   belongs to, or set up a new one.  If the table is full, the oldest
+ *   queue is evicted in favor of the new packet.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4_REASSEMBLY
+static FAR struct ipv4_reassdata_s *
+devif_reass_find(FAR struct ipv4_hdr_s *ipv4)
+{
+  FAR struct ipv4_reassdata_s *reass;
+  FAR struct ipv4_reassdata_s *avail = NULL;
+  int i;
+
+  for (i = 0; i < CONFIG_NET_IPv4_REASS_NQUEUES; i++)
+    {
+      reass = &g_reassembly[i];
+      if ((reass->rd_flags & IPv4_REASS_INUSE) == 0)
+        {
+          /* Remember the first free queue (but keep searching for a
+           * match).
+           */
+
+          if (avail == NULL || (avail->rd_flags & IPv4_REASS_INUSE) != 0)
+            {
+              avail = reass;
+            }
+        }
+      else if (net_ipv4addr_hdrcmp(ipv4->srcipaddr, reass->rd_srcipaddr) &&
+               net_ipv4addr_hdrcmp(ipv4->destipaddr,
+                                   reass->rd_destipaddr) &&
+               ipv4->ipid[0] == reass->rd_ipid[0] &&
+               ipv4->ipid[1] == reass->rd_ipid[1])
+        {
+          /* This fragment belongs to an active queue */
+
+          return reass;
+        }
+      else if (avail == NULL || ((avail->rd_flags & IPv4_REASS_INUSE) != 0 &&
+               reass->rd_age > avail->rd_age))
+        {
+          /* Remember the oldest active queue as the eviction candidate */
+
+          avail = reass;
+        }
+    }
+
+  /* No match.  Claim the free (or oldest) queue for this packet. */
+
+  if ((avail->rd_flags & IPv4_REASS_INUSE) != 0)
+    {
+      devif_reass_free(avail);
+    }
+
+  net_ipv4addr_hdrcopy(avail->rd_srcipaddr, ipv4->srcipaddr);
+  net_ipv4addr_hdrcopy(avail->rd_destipaddr, ipv4->destipaddr);
+  avail->rd_ipid[0] = ipv4->ipid[0];
+  avail->rd_ipid[1] = ipv4->ipid[1];
+  memcpy(avail->rd_iphdr, &ipv4->vhl, IPv4_HDRLEN);
+  memset(avail->rd_bitmap, 0, sizeof(avail->rd_bitmap));
+  avail->rd_len   = 0;
+  avail->rd_age   = 0;
+  avail->rd_flags = IPv4_REASS_INUSE;
+  return avail;
+}
+#endif
+
 /****************************************************************************
  * Name: devif_reassembly
  *
  * Description:
- *   IP fragment reassembly: not well-tested.
+ *   Accumulate the IPv4 fragment in the device buffer into the matching
+ *   reassembly queue.  If the fragment completes a packet, the packet is
+ *   rebuilt in the device buffer.
+ *
+ * Returned Value:
+ *   The total length of the reassembled packet is returned if this
+ *   fragment completed it; zero if the packet is still incomplete (or the
+ *   fragment was dropped).
  *
  * Assumptions:
+ *   The network is locked.
  *
  ****************************************************************************/
 
 #ifdef CONFIG_NET_IPv4_REASSEMBLY
-static uint8_t devif_reassembly(FAR struct net_driver_s *dev)
+static uint16_t devif_reassembly(FAR struct net_driver_s *dev)
 {
-  FAR struct ipv4_hdr_s *ipv4  = BUF;
-  FAR struct ipv4_hdr_s *fipv4 = FBUF;
+  FAR struct ipv4_hdr_s *ipv4 = BUF;
+  FAR struct ipv4_reassdata_s *reass;
   uint16_t offset;
+  uint16_t totlen;
   uint16_t len;
+  uint16_t gap;
   uint16_t i;
 
-  /* If g_reassembly_timer is zero, no packet is present in the buffer, so
-   * we write the IP header of the fragment into the reassembly buffer.  The
-   * timer is updated with the maximum age.
-   */
+  /* Find (or create) the reassembly queue for this fragment */
 
-  if (!g_reassembly_timer)
+  reass = devif_reass_find(ipv4);
+  if (reass->rd_iob == NULL)
     {
-      memcpy(g_reassembly_buffer, &ipv4->vhl, IPv4_HDRLEN);
-      g_reassembly_timer = CONFIG_NET_IPv4_REASS_MAXAGE;
-      g_reassembly_flags = 0;
+      reass->rd_iob = iob_tryalloc(false, IOBUSER_NET_IPREASSEMBLY);
+      if (reass->rd_iob == NULL)
+        {
+          /* The IOB pool is exhausted; drop the queue */
 
-      /* Clear the bitmap. */
+          devif_reass_free(reass);
+          return 0;
+        }
+    }
+
+  len    = ((uint16_t)ipv4->len[0] << 8) + (uint16_t)ipv4->len[1] -
+           (uint16_t)(ipv4->vhl & IPv4_HLMASK) * 4;
+  offset = ((((uint16_t)(ipv4->ipoffset[0] & 0x1f)) << 8) +
+            ipv4->ipoffset[1]) * 8;
+
+  /* If the fragment lies beyond what the device buffer could deliver as a
+   * reassembled packet, the whole packet must be discarded.
+   */
 
-      memset(g_reassembly_bitmap, 0, sizeof(g_reassembly_bitmap));
+  if (offset >= IPv4_REASS_MAXPAYLOAD ||
+      offset + len > IPv4_REASS_MAXPAYLOAD)
+    {
+      devif_reass_free(reass);
+      return 0;
     }
 
-  /* Check if the incoming fragment matches the one currently present
-   * in the reassembly buffer. If so, we proceed with copying the
-   * fragment into the buffer.
+  /* The fragment at offset zero carries the IP header that the
+   * reassembled packet will be delivered with.
    */
 
-  if (net_ipv4addr_hdrcmp(ipv4->srcipaddr, fipv4->srcipaddr) &&
-      net_ipv4addr_hdrcmp(ipv4->destipaddr, fipv4->destipaddr) &&
-      ipv4->ipid[0] == fipv4->ipid[0] && ipv4->ipid[1] == fipv4->ipid[1])
+  if (offset == 0)
     {
-      len    = ((uint16_t)ipv4->len[0] << 8) + (uint16_t)ipv4->len[1] -
-               (uint16_t)(ipv4->vhl & 0x0f) * 4;
-      offset = (((ipv4->ipoffset[0] & 0x3f) << 8) + ipv4->ipoffset[1]) * 8;
+      memcpy(reass->rd_iphdr, &ipv4->vhl, IPv4_HDRLEN);
+    }
 
-      /* If the offset or the offset + fragment length overflows the
-       * reassembly buffer, we discard the entire packet.
-       */
+  /* An I/O buffer chain cannot represent holes:  iob_trycopyin() rejects
+   * any offset beyond the data already in the chain.  If this fragment
+   * begins beyond the data accumulated so far (the fragments arrived out
+   * of order), zero-fill the gap first.  The hole bitmap records which
+   * bytes came from real fragments, so the filler is simply overwritten
+   * when the missing fragments arrive.
+   */
 
-      if (offset > IPv4_REASS_BUFSIZE || offset + len > IPv4_REASS_BUFSIZE)
+  while (reass->rd_iob->io_pktlen < offset)
+    {
+      gap = offset - reass->rd_iob->io_pktlen;
+      if (gap > sizeof(g_reass_zeroes))
         {
-          g_reassembly_timer = 0;
-          goto nullreturn;
+          gap = sizeof(g_reass_zeroes);
         }
 
-      /* Copy the fragment into the reassembly buffer, at the right offset. */
-
-      memcpy(&g_reassembly_buffer[IPv4_HDRLEN + offset],
-             (FAR char *)ipv4 + (int)((ipv4->vhl & 0x0f) * 4), len);
-
-      /* Update the bitmap. */
-
-      if (offset / (8 * 8) == (offset + len) / (8 * 8))
+      if (iob_trycopyin(reass->rd_iob, g_reass_zeroes, gap,
+                        reass->rd_iob->io_pktlen, true,
+                        IOBUSER_NET_IPREASSEMBLY) < 0)
         {
-          /* If the two endpoints are in the same byte, we only update that byte. */
+          /* The IOB pool is exhausted; drop the queue.  That bounds the
+           * memory committed to reassembly by the (possibly throttled)
+           * IOB pool itself.
+           */
 
-          g_reassembly_bitmap[offset / (8 * 8)] |=
-            g_bitmap_bits[(offset / 8) & 7] &
-              ~g_bitmap_bits[((offset + len) / 8) & 7];
+          devif_reass_free(reass);
+          return 0;
         }
-      else
-        {
-          /* If the two endpoints are in different bytes, we update the bytes
-           * in the endpoints and fill the stuff in between with 0xff.
-           */
+    }
 
-          g_reassembly_bitmap[offset / (8 * 8)] |=
-            g_bitmap_bits[(offset / 8) & 7];
+  /* Copy the fragment payload into the I/O buffer chain at its offset.
+   * The chain extends on demand; if the IOB pool is exhausted then the
+   * entire queue is dropped.  That bounds the memory committed to
+   * reassembly by the (possibly throttled) IOB pool itself.
+   */
 
-          for (i = 1 + offset / (8 * 8); i < (offset + len) / (8 * 8); ++i)
-            {
-              g_reassembly_bitmap[i] = 0xff;
-            }
+  if (iob_trycopyin(reass->rd_iob,
+                    (FAR uint8_t *)ipv4 +
+                      (int)((ipv4->vhl & IPv4_HLMASK) * 4),
+                    len, offset, true, IOBUSER_NET_IPREASSEMBLY) < 0)
+    {
+      devif_reass_free(reass);
+      return 0;
+    }
 
-          g_reassembly_bitmap[(offset + len) / (8 * 8)] |=
-            ~g_bitmap_bits[((offset + len) / 8) & 7];
-        }
+  /* Update the hole bitmap.  Each bit covers eight bytes of payload. */
+
+  if (offset / (8 * 8) == (offset + len) / (8 * 8))
+    {
+      /* If the two endpoints are in the same byte, we only update that
+       * byte.
+       */
 
-      /* If this fragment has the More Fragments flag set to zero, we know that
-       * this is the last fragment, so we can calculate the size of the entire
-       * packet. We also set the IP_REASS_FLAG_LASTFRAG flag to indicate that
-       * we have received the final fragment.
+      reass->rd_bitmap[offset / (8 * 8)] |=
+        g_bitmap_bits[(offset / 8) & 7] &
+          ~g_bitmap_bits[((offset + len) / 8) & 7];
+    }
+  else
+    {
+      /* If the two endpoints are in different bytes, we update the bytes
+       * in the endpoints and fill the stuff in between with 0xff.
        */
 
-      if ((ipv4->ipoffset[0] & IP_MF) == 0)
+      reass->rd_bitmap[offset / (8 * 8)] |=
+        g_bitmap_bits[(offset / 8) & 7];
+
+      for (i = 1 + offset / (8 * 8); i < (offset + len) / (8 * 8); ++i)
         {
-          g_reassembly_flags |= IPv4_REASS_LASTFRAG;
-          g_reassembly_len = offset + len;
+          reass->rd_bitmap[i] = 0xff;
         }
 
-      /* Finally, we check if we have a full packet in the buffer. We do this
-       * by checking if we have the last fragment and if all bits in the bitmap
-       * are set.
-       */
+      reass->rd_bitmap[(offset + len) / (8 * 8)] |=
+        ~g_bitmap_bits[((offset + len) / 8) & 7];
+    }
+
+  /* If this fragment has the More Fragments flag set to zero, it is the
+   * last fragment and the size of the entire payload is now known.
+   */
+
+  if ((ipv4->ipoffset[0] & IP_MF) == 0)
+    {
+      reass->rd_flags |= IPv4_REASS_LASTFRAG;
+      reass->rd_len = offset + len;
+    }
 
-      if (g_reassembly_flags & IPv4_REASS_LASTFRAG)
+  /* Check if we have a full packet:  The last fragment has been seen and
+   * the bitmap shows no holes.
+   */
+
+  if ((reass->rd_flags & IPv4_REASS_LASTFRAG) == 0)
+    {
+      return 0;
+    }
+
+  for (i = 0; i < reass->rd_len / (8 * 8); ++i)
+    {
+      if (reass->rd_bitmap[i] != 0xff)
         {
-          /* Check all bytes up to and including all but the last byte in
-           * the bitmap.
-           */
+          return 0;
+        }
+    }
 
-          for (i = 0; i < g_reassembly_len / (8 * 8) - 1; ++i)
-            {
-              if (g_reassembly_bitmap[i] != 0xff)
-                {
-                  goto nullreturn;
-                }
-            }
+  if (reass->rd_bitmap[reass->rd_len / (8 * 8)] !=
+      (uint8_t)~g_bitmap_bits[(reass->rd_len / 8) & 7])
+    {
+      return 0;
+    }
 
-          /* Check the last byte in the bitmap. It should contain just the
-           * right amount of bits.
-           */
+  /* We have a full packet.  Rebuild it in the device buffer and pretend
+   * that it was a "normal" (i.e., not fragmented) IP packet from now on.
+   */
 
-          if (g_reassembly_bitmap[g_reassembly_len / (8 * 8)] !=
-              (uint8_t)~g_bitmap_bits[g_reassembly_len / 8 & 7])
-            {
-              goto nullreturn;
-            }
+  totlen = reass->rd_len + IPv4_HDRLEN;
 
-          /* If we have come this far, we have a full packet in the buffer,
-           * so we allocate a ipv4 and copy the packet into it. We also reset
-           * the timer.
-           */
+  memcpy(&ipv4->vhl, reass->rd_iphdr, IPv4_HDRLEN);
+  iob_copyout((FAR uint8_t *)ipv4 + IPv4_HDRLEN, reass->rd_iob,
+              reass->rd_len, 0);
 
-          g_reassembly_timer = 0;
-          memcpy(ipv4, fipv4, g_reassembly_len);
+  ipv4->vhl         = 0x45;  /* No options in the reassembled header */
+  ipv4->ipoffset[0] = 0;
+  ipv4->ipoffset[1] = 0;
+  ipv4->len[0]      = totlen >> 8;
+  ipv4->len[1]      = totlen & 0xff;
 
-          /* Pretend to be a "normal" (i.e., not fragmented) IP packet from
-           * now on.
-           */
+  devif_reass_free(reass);
 
-          ipv4->ipoffset[0] = ipv4->ipoffset[1] = 0;
-          ipv4->len[0] = g_reassembly_len >> 8;
-          ipv4->len[1] = g_reassembly_len & 0xff;
-          ipv4->ipchksum = 0;
-          ipv4->ipchksum = ~(ipv4_chksum(dev));
+  ipv4->ipchksum = 0;
+  ipv4->ipchksum = ~(ipv4_chksum(dev));
 
-          return g_reassembly_len;
+  return totlen;
+}
+#endif /* CONFIG_NET_IPv4_REASSEMBLY */
+
+/****************************************************************************
+ * Name: devif_ipv4_reasstimer
+ *
+ * Description:
+ *   Age the active reassembly queues and drop any that have waited too
+ *   long for their missing fragments.  Called from devif_timer().
+ *
+ * Input Parameters:
+ *   hsec - The elapsed time, in units of half-seconds.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_IPv4_REASSEMBLY
+void devif_ipv4_reasstimer(int hsec)
+{
+  FAR struct ipv4_reassdata_s *reass;
+  unsigned int age;
+  int i;
+
+  for (i = 0; i < CONFIG_NET_IPv4_REASS_NQUEUES; i++)
+    {
+      reass = &g_reassembly[i];
+      if ((reass->rd_flags & IPv4_REASS_INUSE) != 0)
+        {
+          age = (unsigned int)reass->rd_age + hsec;
+          if (age >= CONFIG_NET_IPv4_REASS_MAXAGE)
+            {
+              nwarn("WARNING: Incomplete IP packet timed out\n");
+              devif_reass_free(reass);
+            }
+          else
+            {
+              reass->rd_age = age;
+            }
         }
     }
-
-nullreturn:
-  return 0;
 }
 #endif /* CONFIG_NET_IPv4_REASSEMBLY */
 
@@ -341,6 +545,8 @@ int ipv4_input(FAR struct net_driver_s *dev)
   g_netstats.ipv4.recv++;
 #endif
 
+  NETDEV_RXBYTES(dev, dev->d_len);
+
   /* Start of IP input header processing code.
    *
    * Check validity of the IP header.
@@ -519,9 +725,13 @@ int ipv4_input(FAR struct net_driver_s *dev)
         }
     }
 
-  if (ipv4_chksum(dev) != 0xffff)
+  if (!NETDEV_HAS_CAP(dev, NETDEV_CAP_CSUM_RX) &&
+      ipv4_chksum(dev) != 0xffff)
     {
-      /* Compute and check the IP header checksum. */
+      /* Compute and check the IP header checksum.  The check is skipped
+       * when the hardware has already verified the checksum and discarded
+       * any bad frame.
+       */
 
 #ifdef CONFIG_NET_STATISTICS
       g_netstats.ipv4.drop++;
@@ -289,6 +289,8 @@ int ipv6_input(FAR struct net_driver_s *dev)
   g_netstats.ipv6.recv++;
 #endif
 
+  NETDEV_RXBYTES(dev, dev->d_len);
+
   /* Start of IP input header processing code.
    *
    * Check validity of the IP header.
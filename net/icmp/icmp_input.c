@@ -46,6 +46,7 @@
 #include <nuttx/config.h>
 #ifdef CONFIG_NET
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <debug.h>
@@ -53,6 +54,7 @@
 #include <net/if.h>
 #include <arpa/inet.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/netstats.h>
@@ -72,10 +74,86 @@
 #define ICMPBUF(hl)  ((FAR struct icmp_hdr_s *)&dev->d_buf[NET_LL_HDRLEN(dev) + (hl)])
 #define ICMPSIZE(hl) ((dev)->d_len - (hl))
 
+#ifdef CONFIG_NET_ICMP_RATELIMIT
+/* Token bucket state for echo reply rate limiting.  Token counts are
+ * scaled by TICK_PER_SEC so that the bucket can be refilled directly from
+ * elapsed system ticks without division:  One reply costs TICK_PER_SEC
+ * scaled tokens and each elapsed tick adds RATE scaled tokens.
+ */
+
+#define ICMP_RATELIMIT_CAP \
+  ((uint32_t)CONFIG_NET_ICMP_RATELIMIT_BURST * TICK_PER_SEC)
+#define ICMP_RATELIMIT_FILLTIME \
+  (ICMP_RATELIMIT_CAP / CONFIG_NET_ICMP_RATELIMIT_RATE)
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_ICMP_RATELIMIT
+static clock_t  g_ratelimit_time;
+static uint32_t g_ratelimit_tokens = ICMP_RATELIMIT_CAP;
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: icmp_ratelimited
+ *
+ * Description:
+ *   Take one token from the echo reply token bucket, refilling the bucket
+ *   first from the number of system ticks elapsed since the last attempt.
+ *
+ * Returned Value:
+ *   true if the bucket is empty and the echo request must be dropped.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_ICMP_RATELIMIT
+static bool icmp_ratelimited(void)
+{
+  clock_t now     = clock_systime_ticks();
+  clock_t elapsed = now - g_ratelimit_time;
+
+  g_ratelimit_time = now;
+
+  /* Refill the bucket.  After an idle period long enough to fill the
+   * bucket completely, just clamp to the cap (this also avoids any
+   * overflow of the multiplication below).
+   */
+
+  if (elapsed >= ICMP_RATELIMIT_FILLTIME)
+    {
+      g_ratelimit_tokens = ICMP_RATELIMIT_CAP;
+    }
+  else
+    {
+      g_ratelimit_tokens += (uint32_t)elapsed *
+                            CONFIG_NET_ICMP_RATELIMIT_RATE;
+      if (g_ratelimit_tokens > ICMP_RATELIMIT_CAP)
+        {
+          g_ratelimit_tokens = ICMP_RATELIMIT_CAP;
+        }
+    }
+
+  /* Take the cost of one reply from the bucket, if available */
+
+  if (g_ratelimit_tokens >= TICK_PER_SEC)
+    {
+      g_ratelimit_tokens -= TICK_PER_SEC;
+      return false;
+    }
+
+  return true;
+}
+#endif
+
 /****************************************************************************
  * Name: icmp_datahandler
  *
@@ -256,6 +334,18 @@ void icmp_input(FAR struct net_driver_s *dev)
 
   if (icmp->type == ICMP_ECHO_REQUEST)
     {
+#ifdef CONFIG_NET_ICMP_RATELIMIT
+      /* Silently drop the echo request if the reply token bucket is
+       * empty.  The peer will retry and, at a sane ping rate, will then
+       * find tokens available.
+       */
+
+      if (icmp_ratelimited())
+        {
+          goto drop;
+        }
+#endif
+
       /* Change the ICMP type */
 
       icmp->type = ICMP_ECHO_REPLY;
@@ -366,7 +456,7 @@ typeerr:
   g_netstats.icmp.typeerr++;
 #endif
 
-#ifdef CONFIG_NET_ICMP_SOCKET
+#if defined(CONFIG_NET_ICMP_SOCKET) || defined(CONFIG_NET_ICMP_RATELIMIT)
 drop:
 #endif
 
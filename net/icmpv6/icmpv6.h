@@ -273,6 +273,35 @@ void icmpv6_poll(FAR struct net_driver_s *dev,
 void icmpv6_solicit(FAR struct net_driver_s *dev,
                     FAR const net_ipv6addr_t ipaddr);
 
+/****************************************************************************
+ * Name: icmpv6_refresh_poll
+ *
+ * Description:
+ *   Called from devif_timer() for each device.  If a Neighbor Table entry
+ *   served by this device has gone without a reachability confirmation for
+ *   longer than the configured reachable time, then a Neighbor
+ *   Solicitation for that entry is placed in the device packet buffer and
+ *   handed to the driver.
+ *
+ * Input Parameters:
+ *   dev      - The device driver structure being polled
+ *   callback - The driver callback that transmits the generated packet
+ *
+ * Returned Value:
+ *   The (non-zero) return value of the driver callback if a solicitation
+ *   was generated and the driver can accept no more packets; zero
+ *   otherwise.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+int icmpv6_refresh_poll(FAR struct net_driver_s *dev,
+                        devif_poll_callback_t callback);
+#endif
+
 /****************************************************************************
  * Name: icmpv6_rsolicit
  *
@@ -0,0 +1,100 @@
+/****************************************************************************
+ * net/icmpv6/icmpv6_refresh.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <debug.h>
+
+#include <net/if.h>
+
+#include <nuttx/net/netdev.h>
+#include <nuttx/net/ip.h>
+#include <nuttx/net/icmpv6.h>
+
+#include "devif/devif.h"
+#include "neighbor/neighbor.h"
+#include "icmpv6/icmpv6.h"
+
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: icmpv6_refresh_poll
+ *
+ * Description:
+ *   Called from devif_timer() for each device.  If a Neighbor Table entry
+ *   served by this device has gone without a reachability confirmation for
+ *   longer than the configured reachable time, then a Neighbor
+ *   Solicitation for that entry is placed in the device packet buffer and
+ *   handed to the driver.  The Neighbor Advertisement that comes back
+ *   refreshes the entry, so steady-state traffic never has to block in
+ *   icmpv6_neighbor() waiting for an expired entry to be re-resolved.
+ *
+ * Input Parameters:
+ *   dev      - The device driver structure being polled
+ *   callback - The driver callback that transmits the generated packet
+ *
+ * Returned Value:
+ *   The (non-zero) return value of the driver callback if a solicitation
+ *   was generated and the driver can accept no more packets; zero
+ *   otherwise.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+int icmpv6_refresh_poll(FAR struct net_driver_s *dev,
+                        devif_poll_callback_t callback)
+{
+  net_ipv6addr_t ipaddr;
+
+  /* Nothing to do unless this is an IPv6-capable device with a stale
+   * neighbor.
+   */
+
+  if (!IFF_IS_UP(dev->d_flags) || neighbor_stale(dev, ipaddr) < 0)
+    {
+      return 0;
+    }
+
+  /* Build the Neighbor Solicitation in the device packet buffer and pass
+   * it to the driver.
+   */
+
+  dev->d_appdata = NULL;
+  dev->d_len     = 0;
+  dev->d_sndlen  = 0;
+
+  icmpv6_solicit(dev, ipaddr);
+  IFF_SET_IPv6(dev->d_flags);
+
+  ninfo("Refreshing neighbor entry\n");
+  return callback(dev);
+}
+
+#endif /* CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH */
@@ -94,6 +94,10 @@ static ssize_t    inet_sendfile(FAR struct socket *psock,
 static ssize_t    inet_recvfrom(FAR struct socket *psock, FAR void *buf,
                     size_t len, int flags, FAR struct sockaddr *from,
                     FAR socklen_t *fromlen);
+#if defined(CONFIG_NET_TIMESTAMP) && defined(NET_UDP_HAVE_STACK)
+static ssize_t    inet_recvmsg(FAR struct socket *psock,
+                    FAR struct msghdr *msg, int flags);
+#endif
 
 /****************************************************************************
  * Private Data
@@ -118,7 +122,11 @@ static const struct sock_intf_s g_inet_sockif =
 #endif
   inet_recvfrom,    /* si_recvfrom */
 #ifdef CONFIG_NET_CMSG
+#if defined(CONFIG_NET_TIMESTAMP) && defined(NET_UDP_HAVE_STACK)
+  inet_recvmsg,     /* si_recvmsg */
+#else
   NULL,             /* si_recvmsg */
+#endif
   NULL,             /* si_sendmsg */
 #endif
   inet_close        /* si_close */
@@ -1072,75 +1080,80 @@ static ssize_t inet_send(FAR struct socket *psock, FAR const void *buf,
 {
   ssize_t ret;
 
-  switch (psock->s_type)
-    {
+  /* The socket type was verified by inet_setup() when the socket was
+   * created, so in a configuration with only one of TCP or UDP enabled
+   * there is nothing to dispatch on at run time:  The type check below
+   * collapses to a direct call to the one supported transport.
+   */
+
 #ifdef CONFIG_NET_TCP
-      case SOCK_STREAM:
-        {
+#ifdef CONFIG_NET_UDP
+  if (psock->s_type == SOCK_STREAM)
+#endif
+    {
 #ifdef CONFIG_NET_6LOWPAN
-          /* Try 6LoWPAN TCP packet send */
+      /* Try 6LoWPAN TCP packet send */
 
-          ret = psock_6lowpan_tcp_send(psock, buf, len);
+      ret = psock_6lowpan_tcp_send(psock, buf, len);
 
 #ifdef NET_TCP_HAVE_STACK
-          if (ret < 0)
-            {
-              /* TCP/IP packet send */
+      if (ret < 0)
+        {
+          /* TCP/IP packet send */
 
-              ret = psock_tcp_send(psock, buf, len, flags);
-            }
+          ret = psock_tcp_send(psock, buf, len, flags);
+        }
 #endif /* NET_TCP_HAVE_STACK */
 
 #elif defined(NET_TCP_HAVE_STACK)
-          ret = psock_tcp_send(psock, buf, len, flags);
+      ret = psock_tcp_send(psock, buf, len, flags);
 #else
-          ret = -ENOSYS;
+      ret = -ENOSYS;
 #endif /* CONFIG_NET_6LOWPAN */
-        }
-        break;
+    }
 #endif /* CONFIG_NET_TCP */
 
 #ifdef CONFIG_NET_UDP
-      case SOCK_DGRAM:
-        {
+#ifdef CONFIG_NET_TCP
+  else
+#endif
+    {
+      DEBUGASSERT(psock->s_type == SOCK_DGRAM);
+
 #if defined(CONFIG_NET_6LOWPAN)
-           /* Try 6LoWPAN UDP packet send */
+      /* Try 6LoWPAN UDP packet send */
 
-           ret = psock_6lowpan_udp_send(psock, buf, len);
+      ret = psock_6lowpan_udp_send(psock, buf, len);
 
 #ifdef NET_UDP_HAVE_STACK
-          if (ret < 0)
-            {
-              /* UDP/IP packet send */
+      if (ret < 0)
+        {
+          /* UDP/IP packet send */
 
-              ret = _SS_ISCONNECTED(psock->s_flags) ?
-                psock_udp_sendto(psock, buf, len, 0, NULL, 0) : -ENOTCONN;
-            }
+          ret = _SS_ISCONNECTED(psock->s_flags) ?
+            psock_udp_sendto(psock, buf, len, 0, NULL, 0) : -ENOTCONN;
+        }
 #endif /* NET_UDP_HAVE_STACK */
 
 #elif defined(NET_UDP_HAVE_STACK)
-          /* Only UDP/IP packet send */
+      /* Only UDP/IP packet send */
 
-          ret = _SS_ISCONNECTED(psock->s_flags) ?
-            psock_udp_sendto(psock, buf, len, 0, NULL, 0) : -ENOTCONN;
+      ret = _SS_ISCONNECTED(psock->s_flags) ?
+        psock_udp_sendto(psock, buf, len, 0, NULL, 0) : -ENOTCONN;
 #else
-          ret = -ENOSYS;
+      ret = -ENOSYS;
 #endif /* CONFIG_NET_6LOWPAN */
-        }
-        break;
+    }
 #endif /* CONFIG_NET_UDP */
 
-      default:
-        {
-          /* EDESTADDRREQ.  Signifies that the socket is not connection-mode
-           * and no peer address is set.
-           */
+#if !defined(CONFIG_NET_TCP) && !defined(CONFIG_NET_UDP)
+  /* EDESTADDRREQ.  Signifies that the socket is not connection-mode and
+   * no peer address is set.
+   */
 
-          nerr("ERROR:  Bad socket type: %d\n", psock->s_type);
-          ret = -EDESTADDRREQ;
-        }
-        break;
-    }
+  nerr("ERROR:  Bad socket type: %d\n", psock->s_type);
+  ret = -EDESTADDRREQ;
+#endif
 
   return ret;
 }
@@ -1355,45 +1368,132 @@ static ssize_t inet_recvfrom(FAR struct socket *psock, FAR void *buf,
 
   /* Read from the network interface driver buffer.
    * Or perform the TCP/IP or UDP recv() operation.
+   *
+   * The socket type was verified by inet_setup() when the socket was
+   * created, so in a configuration with only one of TCP or UDP enabled
+   * the type check collapses to a direct call to the one supported
+   * transport.
    */
 
-  switch (psock->s_type)
-    {
 #ifdef CONFIG_NET_TCP
-    case SOCK_STREAM:
-      {
+#ifdef CONFIG_NET_UDP
+  if (psock->s_type == SOCK_STREAM)
+#endif
+    {
 #ifdef NET_TCP_HAVE_STACK
-        ret = psock_tcp_recvfrom(psock, buf, len, flags, from, fromlen);
+      ret = psock_tcp_recvfrom(psock, buf, len, flags, from, fromlen);
 #else
-        ret = -ENOSYS;
+      ret = -ENOSYS;
 #endif
-      }
-      break;
+    }
 #endif /* CONFIG_NET_TCP */
 
 #ifdef CONFIG_NET_UDP
-    case SOCK_DGRAM:
-      {
+#ifdef CONFIG_NET_TCP
+  else
+#endif
+    {
+      DEBUGASSERT(psock->s_type == SOCK_DGRAM);
+
 #ifdef NET_UDP_HAVE_STACK
-        ret = psock_udp_recvfrom(psock, buf, len, flags, from, fromlen);
+      ret = psock_udp_recvfrom(psock, buf, len, flags, from, fromlen);
 #else
-        ret = -ENOSYS;
+      ret = -ENOSYS;
 #endif
-      }
-      break;
+    }
 #endif /* CONFIG_NET_UDP */
 
-    default:
-      {
-        nerr("ERROR: Unsupported socket type: %d\n", psock->s_type);
-        ret = -ENOSYS;
-      }
-      break;
-    }
+#if !defined(CONFIG_NET_TCP) && !defined(CONFIG_NET_UDP)
+  nerr("ERROR: Unsupported socket type: %d\n", psock->s_type);
+  ret = -ENOSYS;
+#endif
 
   return ret;
 }
 
+/****************************************************************************
+ * Name: inet_recvmsg
+ *
+ * Description:
+ *   Implements the socket recvmsg interface for the case of the AF_INET
+ *   and AF_INET6 address families.  The difference with respect to the
+ *   generic si_recvfrom-based fallback in psock_recvmsg() is that ancillary
+ *   data (presently only the SO_TIMESTAMP receipt time) may be returned
+ *   for SOCK_DGRAM sockets.
+ *
+ * Input Parameters:
+ *   psock    A pointer to a NuttX-specific, internal socket structure
+ *   msg      Message header describing the user and control buffers
+ *   flags    Receive flags
+ *
+ * Returned Value:
+ *   On success, returns the number of characters received.  Otherwise, on
+ *   errors, a negated errno value is returned (see recvmsg() for the list
+ *   of appropriate error values).
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_TIMESTAMP) && defined(NET_UDP_HAVE_STACK)
+static ssize_t inet_recvmsg(FAR struct socket *psock,
+                            FAR struct msghdr *msg, int flags)
+{
+  FAR struct sockaddr *from;
+  FAR socklen_t *fromlen;
+  ssize_t total;
+  ssize_t ret;
+  int i;
+
+  /* Only SOCK_DGRAM sockets may return ancillary data */
+
+  if (psock->s_type == SOCK_DGRAM)
+    {
+      return psock_udp_recvmsg(psock, msg, flags);
+    }
+
+  /* Otherwise, fill each I/O vector with a separate receive operation just
+   * as psock_recvmsg() would do in the absence of an si_recvmsg method.
+   */
+
+  from    = msg->msg_name;
+  fromlen = (FAR socklen_t *)&msg->msg_namelen;
+  total   = 0;
+
+  for (i = 0; i < msg->msg_iovlen; i++)
+    {
+      FAR void *buf = msg->msg_iov[i].iov_base;
+      size_t len    = msg->msg_iov[i].iov_len;
+
+      if (len == 0)
+        {
+          continue;
+        }
+
+      ret = inet_recvfrom(psock, buf, len, flags, from, fromlen);
+      if (ret <= 0)
+        {
+          /* Return any error (or the end-of-stream indication) only if
+           * nothing has been received yet.  Otherwise, report the number
+           * of bytes received so far.
+           */
+
+          return total > 0 ? total : ret;
+        }
+
+      total += ret;
+
+      /* Only the first receive operation may block or return a source
+       * address.
+       */
+
+      flags  |= MSG_DONTWAIT;
+      from    = NULL;
+      fromlen = NULL;
+    }
+
+  return total;
+}
+#endif /* CONFIG_NET_TIMESTAMP && NET_UDP_HAVE_STACK */
+
 #endif /* NET_UDP_HAVE_STACK || NET_TCP_HAVE_STACK */
 
 /****************************************************************************
@@ -152,7 +152,6 @@ static int ipv4_hdrsize(FAR struct ipv4_hdr_s *ipv4)
 
 static int ipv4_decr_ttl(FAR struct ipv4_hdr_s *ipv4)
 {
-  uint16_t iphdrlen;
   uint16_t sum;
   int ttl;
 
@@ -172,31 +171,19 @@ static int ipv4_decr_ttl(FAR struct ipv4_hdr_s *ipv4)
       return 0;
     }
 
-  /* Save the updated TTL value */
-
-  ipv4->ttl = ttl;
-
-  /* Get the IP header length (accounting for possible options). */
-
-  iphdrlen = (ipv4->vhl & IPv4_HLMASK) << 2;
-
-  /* Re-calculate the IPv4 checksum.  This checksum is the Internet checksum
-   * of the 20 bytes of the IPv4 header.  This checksum will be different
-   * because we just modify the IPv4 TTL.
+  /* Adjust the IPv4 header checksum incrementally (RFC 1624):  Only the
+   * 16-bit word holding the TTL and protocol fields has changed, so there
+   * is no need to re-sum the entire header.
    */
 
-  ipv4->ipchksum = 0;
-  sum            = chksum(0, (FAR const uint8_t *)ipv4, iphdrlen);
-  if (sum == 0)
-    {
-      sum = 0xffff;
-    }
-  else
-    {
-      sum = htons(sum);
-    }
+  sum = chksum_adjust(ntohs(ipv4->ipchksum),
+                      ((uint16_t)ipv4->ttl << 8) | ipv4->proto,
+                      ((uint16_t)ttl << 8) | ipv4->proto);
+
+  /* Save the updated TTL value and checksum */
 
-  ipv4->ipchksum = ~sum;
+  ipv4->ttl      = ttl;
+  ipv4->ipchksum = htons(sum);
   return ttl;
 }
 
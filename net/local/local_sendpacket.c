@@ -41,6 +41,7 @@
 
 #include <sys/types.h>
 #include <stdint.h>
+#include <string.h>
 #include <unistd.h>
 #include <errno.h>
 #include <assert.h>
@@ -143,25 +144,24 @@ static int local_fifo_write(FAR struct file *filep, FAR const uint8_t *buf,
 int local_send_packet(FAR struct file *filep, FAR const uint8_t *buf,
                       size_t len)
 {
+  uint8_t hdr[LOCAL_PREAMBLE_SIZE + sizeof(uint16_t)];
   uint16_t len16;
   int ret;
 
-  /* Send the packet preamble */
+  /* Send the packet preamble and length together so that the FIFO device
+   * is entered only once for the packet framing.
+   */
 
-  ret = local_fifo_write(filep, g_preamble, LOCAL_PREAMBLE_SIZE);
+  len16 = len;
+  memcpy(hdr, g_preamble, LOCAL_PREAMBLE_SIZE);
+  memcpy(&hdr[LOCAL_PREAMBLE_SIZE], &len16, sizeof(uint16_t));
+
+  ret = local_fifo_write(filep, hdr, sizeof(hdr));
   if (ret == OK)
     {
-      /* Send the packet length */
-
-      len16 = len;
-      ret = local_fifo_write(filep, (FAR const uint8_t *)&len16,
-                             sizeof(uint16_t));
-      if (ret == OK)
-        {
-          /* Send the packet data */
+      /* Send the packet data */
 
-          ret = local_fifo_write(filep, buf, len);
-        }
+      ret = local_fifo_write(filep, buf, len);
     }
 
   return ret;
@@ -56,6 +56,22 @@
 
 #ifdef CONFIG_NET_IPv6
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Each IPv6 address hashes to a small set of candidate Neighbor Table
+ * entries.  Both lookup and insertion consider only the entries of that
+ * set so that the cost of TX-path address resolution does not grow with
+ * the size of the table.
+ */
+
+#if CONFIG_NET_IPv6_NCONF_ENTRIES < 4
+#  define NEIGHBOR_HASH_NWAYS CONFIG_NET_IPv6_NCONF_ENTRIES
+#else
+#  define NEIGHBOR_HASH_NWAYS 4
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -72,6 +88,24 @@ extern struct neighbor_entry_s g_neighbors[CONFIG_NET_IPv6_NCONF_ENTRIES];
 
 struct net_driver_s; /* Forward reference */
 
+/****************************************************************************
+ * Name: neighbor_hash
+ *
+ * Description:
+ *   Return the index of the first candidate Neighbor Table entry for the
+ *   IPv6 address.  The candidate set consists of the NEIGHBOR_HASH_NWAYS
+ *   entries beginning at that index (wrapping at the end of the table).
+ *
+ * Input Parameters:
+ *   ipaddr - The IPv6 address to hash
+ *
+ * Returned Value:
+ *   The index of the first entry of the candidate set.
+ *
+ ****************************************************************************/
+
+int neighbor_hash(const net_ipv6addr_t ipaddr);
+
 /****************************************************************************
  * Name: neighbor_findentry
  *
@@ -149,6 +183,33 @@ int neighbor_lookup(FAR const net_ipv6addr_t ipaddr,
 
 void neighbor_update(const net_ipv6addr_t ipaddr);
 
+/****************************************************************************
+ * Name: neighbor_stale
+ *
+ * Description:
+ *   Find a Neighbor Table entry on the link served by 'dev' whose
+ *   reachability has not been confirmed recently and which is due for a
+ *   refresh probe.  At most one entry is returned per call and the probe
+ *   bookkeeping of the returned entry is advanced, so the caller is
+ *   expected to actually send the Neighbor Solicitation.
+ *
+ * Input Parameters:
+ *   dev    - The device driver structure about to be polled
+ *   ipaddr - The location to return the IPv6 address to be probed
+ *
+ * Returned Value:
+ *   Zero (OK) is returned if a stale entry was found and its address
+ *   copied to 'ipaddr'; -ENOENT is returned if no entry needs a probe.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+int neighbor_stale(FAR struct net_driver_s *dev, FAR net_ipv6addr_t ipaddr);
+#endif
+
 /****************************************************************************
  * Name: neighbor_ethernet_out
  *
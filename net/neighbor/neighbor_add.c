@@ -84,33 +84,38 @@ void neighbor_add(FAR struct net_driver_s *dev, FAR net_ipv6addr_t ipaddr,
   uint8_t lltype;
   clock_t oldest_time;
   int     oldest_ndx;
+  int     ndx;
   int     i;
 
   DEBUGASSERT(dev != NULL && addr != NULL);
 
-  /* Find the matching entry, first unused entry, or the oldest used entry.
-   * The unused entry will have ne_time == 0 and should generate the oldest
+  /* Find the matching entry, first unused entry, or the oldest used entry
+   * in the candidate set selected by the hash of the IPv6 address.  The
+   * unused entry will have ne_time == 0 and should generate the oldest
    * time.  REVISIT:  Could this fail on clock wraparound?  A more explicit
    * check might be to compare ne_ipaddr with the IPv6 unspecified address.
    */
 
-  oldest_time = g_neighbors[0].ne_time;
-  oldest_ndx  = 0;
+  ndx         = neighbor_hash(ipaddr);
+  oldest_time = g_neighbors[ndx].ne_time;
+  oldest_ndx  = ndx;
   lltype      = dev->d_lltype;
 
-  for (i = 0; i < CONFIG_NET_IPv6_NCONF_ENTRIES; ++i)
+  for (i = 0; i < NEIGHBOR_HASH_NWAYS; ++i)
     {
-      if (g_neighbors[i].ne_addr.na_lltype == lltype &&
-          net_ipv6addr_cmp(g_neighbors[i].ne_ipaddr, ipaddr))
+      int candidate = (ndx + i) % CONFIG_NET_IPv6_NCONF_ENTRIES;
+
+      if (g_neighbors[candidate].ne_addr.na_lltype == lltype &&
+          net_ipv6addr_cmp(g_neighbors[candidate].ne_ipaddr, ipaddr))
         {
-          oldest_ndx = i;
+          oldest_ndx = candidate;
           break;
         }
 
-      if ((int)(g_neighbors[i].ne_time - oldest_time) < 0)
+      if ((int)(g_neighbors[candidate].ne_time - oldest_time) < 0)
         {
-          oldest_ndx = i;
-          oldest_time = g_neighbors[i].ne_time;
+          oldest_ndx = candidate;
+          oldest_time = g_neighbors[candidate].ne_time;
         }
     }
 
@@ -119,6 +124,9 @@ void neighbor_add(FAR struct net_driver_s *dev, FAR net_ipv6addr_t ipaddr,
    */
 
   g_neighbors[oldest_ndx].ne_time = clock_systime_ticks();
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+  g_neighbors[oldest_ndx].ne_probes = 0;
+#endif
   net_ipv6addr_copy(g_neighbors[oldest_ndx].ne_ipaddr, ipaddr);
 
   g_neighbors[oldest_ndx].ne_addr.na_lltype = lltype;
@@ -52,6 +52,42 @@
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: neighbor_hash
+ *
+ * Description:
+ *   Return the index of the first candidate Neighbor Table entry for the
+ *   IPv6 address.  The candidate set consists of the NEIGHBOR_HASH_NWAYS
+ *   entries beginning at that index (wrapping at the end of the table).
+ *
+ * Input Parameters:
+ *   ipaddr - The IPv6 address to hash
+ *
+ * Returned Value:
+ *   The index of the first entry of the candidate set.
+ *
+ ****************************************************************************/
+
+int neighbor_hash(const net_ipv6addr_t ipaddr)
+{
+  uint32_t hash = 0;
+  int i;
+
+  /* Fold all eight 16-bit groups of the IPv6 address into the hash value
+   * so that addresses differing only in the interface identifier do not
+   * collide.
+   */
+
+  for (i = 0; i < 8; i++)
+    {
+      hash ^= ipaddr[i];
+    }
+
+  hash ^= hash >> 8;
+
+  return (int)(hash % CONFIG_NET_IPv6_NCONF_ENTRIES);
+}
+
 /****************************************************************************
  * Name: neighbor_findentry
  *
@@ -70,11 +106,17 @@
 
 FAR struct neighbor_entry_s *neighbor_findentry(const net_ipv6addr_t ipaddr)
 {
+  int ndx = neighbor_hash(ipaddr);
   int i;
 
-  for (i = 0; i < CONFIG_NET_IPv6_NCONF_ENTRIES; ++i)
+  /* Only the candidate set of entries selected by the hash of the IPv6
+   * address needs to be searched.
+   */
+
+  for (i = 0; i < NEIGHBOR_HASH_NWAYS; ++i)
     {
-      FAR struct neighbor_entry_s *neighbor = &g_neighbors[i];
+      FAR struct neighbor_entry_s *neighbor =
+        &g_neighbors[(ndx + i) % CONFIG_NET_IPv6_NCONF_ENTRIES];
 
       if (net_ipv6addr_cmp(neighbor->ne_ipaddr, ipaddr))
         {
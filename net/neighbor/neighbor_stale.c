@@ -0,0 +1,131 @@
+/****************************************************************************
+ * net/neighbor/neighbor_stale.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <errno.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/net/netdev.h>
+
+#include "neighbor/neighbor.h"
+
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* A neighbor is considered reachable for this long after the last
+ * confirmation (a Neighbor Advertisement or an upper-layer hint such as a
+ * TCP acknowledgment).  Entries older than this are probed; entries that
+ * remain unconfirmed after twice this time are left to age out of the
+ * table.
+ */
+
+#define NEIGHBOR_REACHABLE_TICKS SEC2TICK(CONFIG_ICMPv6_NEIGHBOR_REACHABLE)
+
+/* Minimum interval between refresh probes of the same entry */
+
+#define NEIGHBOR_PROBE_TICKS     SEC2TICK(1)
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: neighbor_stale
+ *
+ * Description:
+ *   Find a Neighbor Table entry on the link served by 'dev' whose
+ *   reachability has not been confirmed recently and which is due for a
+ *   refresh probe.  At most one entry is returned per call and the probe
+ *   bookkeeping of the returned entry is advanced, so the caller is
+ *   expected to actually send the Neighbor Solicitation.
+ *
+ * Input Parameters:
+ *   dev    - The device driver structure about to be polled
+ *   ipaddr - The location to return the IPv6 address to be probed
+ *
+ * Returned Value:
+ *   Zero (OK) is returned if a stale entry was found and its address
+ *   copied to 'ipaddr'; -ENOENT is returned if no entry needs a probe.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+int neighbor_stale(FAR struct net_driver_s *dev, FAR net_ipv6addr_t ipaddr)
+{
+  FAR struct neighbor_entry_s *neighbor;
+  clock_t now = clock_systime_ticks();
+  clock_t age;
+  int i;
+
+  for (i = 0; i < CONFIG_NET_IPv6_NCONF_ENTRIES; i++)
+    {
+      neighbor = &g_neighbors[i];
+
+      /* Skip unused entries and entries for other link types */
+
+      if (neighbor->ne_time == 0 ||
+          neighbor->ne_addr.na_lltype != dev->d_lltype)
+        {
+          continue;
+        }
+
+      /* Is the entry in the window where it should be refreshed?  Entries
+       * younger than the reachable time need no probe; entries that did
+       * not respond to the probes of an entire reachable period are
+       * presumed gone and are left to be replaced.
+       */
+
+      age = now - neighbor->ne_time;
+      if (age < NEIGHBOR_REACHABLE_TICKS ||
+          age >= 2 * NEIGHBOR_REACHABLE_TICKS)
+        {
+          continue;
+        }
+
+      /* Limit the number of probes per staleness period and pace them */
+
+      if (neighbor->ne_probes >= CONFIG_ICMPv6_NEIGHBOR_MAXPROBES ||
+          (neighbor->ne_probes > 0 &&
+           now - neighbor->ne_probetime < NEIGHBOR_PROBE_TICKS))
+        {
+          continue;
+        }
+
+      neighbor->ne_probetime = now;
+      neighbor->ne_probes++;
+
+      net_ipv6addr_copy(ipaddr, neighbor->ne_ipaddr);
+      return OK;
+    }
+
+  return -ENOENT;
+}
+
+#endif /* CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH */
@@ -73,5 +73,8 @@ void neighbor_update(const net_ipv6addr_t ipaddr)
   if (neighbor != NULL)
     {
       neighbor->ne_time = clock_systime_ticks();
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+      neighbor->ne_probes = 0;
+#endif
     }
 }
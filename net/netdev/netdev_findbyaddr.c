@@ -84,7 +84,7 @@ FAR struct net_driver_s *netdev_findby_lipv4addr(in_addr_t lipaddr)
 
   /* Examine each registered network device */
 
-  net_lock();
+  net_rdlock();
   for (dev = g_netdevices; dev; dev = dev->flink)
     {
       /* Is the interface in the "up" state? */
@@ -98,7 +98,7 @@ FAR struct net_driver_s *netdev_findby_lipv4addr(in_addr_t lipaddr)
             {
               /* Its a match */
 
-              net_unlock();
+              net_rdunlock();
               return dev;
             }
         }
@@ -106,7 +106,7 @@ FAR struct net_driver_s *netdev_findby_lipv4addr(in_addr_t lipaddr)
 
   /* No device with the matching address found */
 
-  net_unlock();
+  net_rdunlock();
   return NULL;
 }
 #endif /* CONFIG_NET_IPv4 */
@@ -135,7 +135,7 @@ FAR struct net_driver_s *netdev_findby_lipv6addr(const net_ipv6addr_t lipaddr)
 
   /* Examine each registered network device */
 
-  net_lock();
+  net_rdlock();
   for (dev = g_netdevices; dev; dev = dev->flink)
     {
       /* Is the interface in the "up" state? */
@@ -149,7 +149,7 @@ FAR struct net_driver_s *netdev_findby_lipv6addr(const net_ipv6addr_t lipaddr)
             {
               /* Its a match */
 
-              net_unlock();
+              net_rdunlock();
               return dev;
             }
         }
@@ -157,7 +157,7 @@ FAR struct net_driver_s *netdev_findby_lipv6addr(const net_ipv6addr_t lipaddr)
 
   /* No device with the matching address found */
 
-  net_unlock();
+  net_rdunlock();
   return NULL;
 }
 #endif /* CONFIG_NET_IPv6 */
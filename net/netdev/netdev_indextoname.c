@@ -84,7 +84,7 @@ int netdev_indextoname(unsigned int ifindex, FAR char *ifname)
 
   /* Find the driver with this name */
 
-  net_lock();
+  net_rdlock();
   dev = netdev_findbyindex(ifindex);
   if (dev != NULL)
     {
@@ -92,7 +92,7 @@ int netdev_indextoname(unsigned int ifindex, FAR char *ifname)
       ret = OK;
     }
 
-  net_unlock();
+  net_rdunlock();
   return ret;
 }
 
@@ -78,14 +78,14 @@ unsigned int netdev_nametoindex(FAR const char *ifname)
 
   /* Find the driver with this name */
 
-  net_lock();
+  net_rdlock();
   dev = netdev_findbyname(ifname);
   if (dev != NULL)
     {
       ifindex = dev->d_ifindex;
     }
 
-  net_unlock();
+  net_rdunlock();
   return ifindex;
 }
 
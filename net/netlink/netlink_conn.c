@@ -396,6 +396,52 @@ netlink_tryget_response(FAR struct netlink_conn_s *conn)
   return resp;
 }
 
+/****************************************************************************
+ * Name: netlink_tryget_response_fit
+ *
+ * Description:
+ *   Return the next response from the head of the pending response list,
+ *   but only if that response is no larger than 'maxlen'.  This is used
+ *   to pack additional pending messages into the remainder of a receive
+ *   buffer without removing a message that would not fit.
+ *
+ *   Note:  The network will be momentarily locked to support exclusive
+ *   access to the pending response list.
+ *
+ * Returned Value:
+ *   The next response from the head of the pending response list is
+ *   returned.  NULL will be returned if the pending response list is
+ *   empty or if the response at the head is larger than 'maxlen'.
+ *
+ ****************************************************************************/
+
+FAR struct netlink_response_s *
+netlink_tryget_response_fit(FAR struct netlink_conn_s *conn, size_t maxlen)
+{
+  FAR struct netlink_response_s *resp;
+
+  DEBUGASSERT(conn != NULL);
+
+  /* Remove the response at the head of the pending response list only if
+   * it fits in the remaining buffer space.
+   */
+
+  net_lock();
+  resp = (FAR struct netlink_response_s *)conn->resplist.head;
+  if (resp != NULL && resp->msg.nlmsg_len <= maxlen)
+    {
+      sq_remfirst(&conn->resplist);
+    }
+  else
+    {
+      resp = NULL;
+    }
+
+  net_unlock();
+
+  return resp;
+}
+
 /****************************************************************************
  * Name: netlink_get_response
  *
@@ -807,6 +807,10 @@ static ssize_t netlink_recvfrom(FAR struct socket *psock, FAR void *buf,
                                 FAR socklen_t *fromlen)
 {
   FAR struct netlink_response_s *entry;
+  FAR uint8_t *dest = buf;
+  size_t fullen;
+  size_t msglen;
+  size_t total;
 
   DEBUGASSERT(psock != NULL && psock->s_conn != NULL && buf != NULL);
   DEBUGASSERT(from == NULL ||
@@ -836,22 +840,60 @@ static ssize_t netlink_recvfrom(FAR struct socket *psock, FAR void *buf,
         }
     }
 
-  if (len > entry->msg.nlmsg_len)
+  fullen = entry->msg.nlmsg_len;
+  msglen = fullen;
+  if (msglen > len)
     {
-      len = entry->msg.nlmsg_len;
+      msglen = len;
     }
 
   /* Copy the payload to the user buffer */
 
-  memcpy(buf, &entry->msg, len);
+  memcpy(dest, &entry->msg, msglen);
+  total = msglen;
   kmm_free(entry);
 
+  /* If the first message was copied whole, pack any additional pending
+   * messages into the remainder of the user buffer.  Each message begins
+   * on a NLMSG_ALIGN'ed boundary so that the caller can walk the buffer
+   * with NLMSG_NEXT(), per the usual netlink semantics.  Messages are
+   * never truncated here:  A message that does not fit remains at the
+   * head of the pending response list for the next call.
+   */
+
+  if (msglen == fullen)
+    {
+      for (; ; )
+        {
+          size_t offset = NLMSG_ALIGN(total);
+
+          if (offset >= len)
+            {
+              break;
+            }
+
+          entry = netlink_tryget_response_fit(psock->s_conn, len - offset);
+          if (entry == NULL)
+            {
+              break;
+            }
+
+          /* Zero the alignment padding between messages */
+
+          memset(&dest[total], 0, offset - total);
+
+          memcpy(&dest[offset], &entry->msg, entry->msg.nlmsg_len);
+          total = offset + entry->msg.nlmsg_len;
+          kmm_free(entry);
+        }
+    }
+
   if (from != NULL)
     {
       netlink_getpeername(psock, from, fromlen);
     }
 
-  return len;
+  return total;
 }
 
 /****************************************************************************
@@ -45,6 +45,8 @@
 #include <sys/types.h>
 #include <queue.h>
 
+#include <nuttx/mm/iob.h>
+
 #ifdef CONFIG_NET_PKT
 
 /****************************************************************************
@@ -84,6 +86,15 @@ struct pkt_conn_s
   uint8_t    ifindex;
   uint16_t   proto;
   uint8_t    crefs;    /* Reference counts on this instance */
+
+  /* Read-ahead buffering.
+   *
+   *   readahead - A singly linked list of type struct iob_qentry_s
+   *               where captured frames are retained until the reader
+   *               catches up.  One I/O buffer chain holds one frame.
+   */
+
+  struct iob_queue_s readahead;   /* Read-ahead buffering */
 };
 
 /****************************************************************************
@@ -187,6 +198,32 @@ FAR struct pkt_conn_s *pkt_nextconn(FAR struct pkt_conn_s *conn);
 uint16_t pkt_callback(FAR struct net_driver_s *dev,
                       FAR struct pkt_conn_s *conn, uint16_t flags);
 
+/****************************************************************************
+ * Name: pkt_datahandler
+ *
+ * Description:
+ *   Handle a captured frame that is not accepted by the application because
+ *   there is no listener in place ready to receive it.  The frame is
+ *   retained in the connection's read-ahead buffer queue where it may be
+ *   consumed later by recvfrom() without blocking per frame.
+ *
+ * Input Parameters:
+ *   conn   - A pointer to the packet connection structure
+ *   buffer - A pointer to the frame to be retained
+ *   buflen - The length of the frame in bytes
+ *
+ * Returned Value:
+ *   The number of bytes actually buffered is returned.  This will be
+ *   either zero or equal to buflen; partial frames are not buffered.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+uint16_t pkt_datahandler(FAR struct pkt_conn_s *conn, FAR uint8_t *buffer,
+                         uint16_t buflen);
+
 /****************************************************************************
  * Name: pkt_input
  *
@@ -41,14 +41,65 @@
 #if defined(CONFIG_NET) && defined(CONFIG_NET_PKT)
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <debug.h>
 
+#include <nuttx/mm/iob.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/netdev.h>
 
 #include "devif/devif.h"
 #include "pkt/pkt.h"
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pkt_data_event
+ *
+ * Description:
+ *   Handle data that is not accepted by the application because there is no
+ *   listener in place ready to receive the data.
+ *
+ * Assumptions:
+ * - The caller has checked that PKT_NEWDATA is set in flags and that there
+ *   is no other handler available to process the incoming data.
+ * - This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+static inline uint16_t
+pkt_data_event(FAR struct net_driver_s *dev, FAR struct pkt_conn_s *conn,
+               uint16_t flags)
+{
+  uint16_t ret;
+  FAR uint8_t *buffer = dev->d_appdata;
+  uint16_t buflen = dev->d_len;
+  uint16_t recvlen;
+
+  ret = (flags & ~PKT_NEWDATA);
+
+  /* Save the frame in the read-ahead buffer.  NOTE that partial frames
+   * will not be buffered.
+   */
+
+  recvlen = pkt_datahandler(conn, buffer, buflen);
+  if (recvlen < buflen)
+    {
+      /* There is no handler to receive new data and there are no free
+       * read-ahead buffers to retain the data -- drop the frame.
+       */
+
+      ninfo("Dropped %d bytes\n", dev->d_len);
+    }
+
+  /* In any event, the new data has now been handled */
+
+  dev->d_len = 0;
+  return ret;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -79,9 +130,88 @@ uint16_t pkt_callback(FAR struct net_driver_s *dev,
       /* Perform the callback */
 
       flags = devif_conn_event(dev, conn, flags, conn->list);
+
+      /* If no application listener consumed the new data, then retain the
+       * frame in the read-ahead buffer so that it can be delivered by a
+       * later recvfrom() without another wakeup per frame.
+       */
+
+      if ((flags & PKT_NEWDATA) != 0)
+        {
+          flags = pkt_data_event(dev, conn, flags);
+        }
     }
 
   return flags;
 }
 
+/****************************************************************************
+ * Name: pkt_datahandler
+ *
+ * Description:
+ *   Handle a captured frame that is not accepted by the application because
+ *   there is no listener in place ready to receive it.
+ *
+ * Input Parameters:
+ *   conn   - A pointer to the packet connection structure
+ *   buffer - A pointer to the frame to be retained
+ *   buflen - The length of the frame in bytes
+ *
+ * Returned Value:
+ *   The number of bytes actually buffered is returned.  This will be
+ *   either zero or equal to buflen; partial frames are not buffered.
+ *
+ * Assumptions:
+ * - This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+uint16_t pkt_datahandler(FAR struct pkt_conn_s *conn, FAR uint8_t *buffer,
+                         uint16_t buflen)
+{
+  FAR struct iob_s *iob;
+  int ret;
+
+  /* Try to allocate on I/O buffer to start the chain without waiting (and
+   * throttling as necessary).  If we would have to wait, then drop the
+   * frame.
+   */
+
+  iob = iob_tryalloc(true, IOBUSER_NET_PKT_READAHEAD);
+  if (iob == NULL)
+    {
+      nerr("ERROR: Failed to create new I/O buffer chain\n");
+      return 0;
+    }
+
+  /* Copy the frame into the I/O buffer chain (without waiting) */
+
+  ret = iob_trycopyin(iob, buffer, buflen, 0, true,
+                      IOBUSER_NET_PKT_READAHEAD);
+  if (ret < 0)
+    {
+      /* On a failure, iob_trycopyin return a negated error value but does
+       * not free any I/O buffers.
+       */
+
+      nerr("ERROR: Failed to add data to the I/O buffer chain: %d\n", ret);
+      iob_free_chain(iob, IOBUSER_NET_PKT_READAHEAD);
+      return 0;
+    }
+
+  /* Add the new I/O buffer chain to the tail of the read-ahead queue (again
+   * without waiting).
+   */
+
+  ret = iob_tryadd_queue(iob, &conn->readahead);
+  if (ret < 0)
+    {
+      nerr("ERROR: Failed to queue the I/O buffer chain: %d\n", ret);
+      iob_free_chain(iob, IOBUSER_NET_PKT_READAHEAD);
+      return 0;
+    }
+
+  return buflen;
+}
+
 #endif /* CONFIG_NET && CONFIG_NET_PKT */
@@ -49,6 +49,7 @@
 
 #include <arch/irq.h>
 
+#include <nuttx/mm/iob.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
@@ -188,6 +189,10 @@ void pkt_free(FAR struct pkt_conn_s *conn)
 
   dq_rem(&conn->node, &g_active_pkt_connections);
 
+  /* Release any read-ahead buffers attached to the connection */
+
+  iob_free_queue(&conn->readahead, IOBUSER_NET_PKT_READAHEAD);
+
   /* Free the connection */
 
   dq_addlast(&conn->node, &g_free_pkt_connections);
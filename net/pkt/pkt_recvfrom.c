@@ -52,6 +52,7 @@
 
 #include <arch/irq.h>
 
+#include <nuttx/mm/iob.h>
 #include <nuttx/semaphore.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
@@ -152,6 +153,75 @@ static void pkt_recvfrom_newdata(FAR struct net_driver_s *dev,
   pkt_add_recvlen(pstate, recvlen);
 }
 
+/****************************************************************************
+ * Name: pkt_readahead
+ *
+ * Description:
+ *   Copy the buffered read-ahead data to the user buffer.
+ *
+ * Input Parameters:
+ *   conn     The packet connection structure
+ *   pstate   recvfrom state structure
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+static inline void pkt_readahead(FAR struct pkt_conn_s *conn,
+                                 FAR struct pkt_recvfrom_s *pstate)
+{
+  FAR struct iob_s *iob;
+  int recvlen;
+
+  /* Check if there is a frame already buffered in a read-ahead buffer */
+
+  pstate->pr_recvlen = -1;
+
+  if ((iob = iob_peek_queue(&conn->readahead)) != NULL)
+    {
+      FAR struct iob_s *tmp;
+
+      DEBUGASSERT(iob->io_pktlen > 0);
+
+      /* Transfer the buffered frame from the I/O buffer chain into the
+       * user buffer.  Frames have datagram semantics:  Any frame data
+       * that does not fit in the user buffer is discarded.
+       */
+
+      if (pstate->pr_buflen > 0)
+        {
+          recvlen = iob_copyout(pstate->pr_buffer, iob, pstate->pr_buflen,
+                                0);
+
+          ninfo("Received %d bytes (of %d)\n", recvlen, iob->io_pktlen);
+
+          /* Update the accumulated size of the data read */
+
+          pkt_add_recvlen(pstate, recvlen);
+        }
+      else
+        {
+          pstate->pr_recvlen = 0;
+        }
+
+      /* Remove the I/O buffer chain from the head of the read-ahead
+       * buffer queue.
+       */
+
+      tmp = iob_remove_queue(&conn->readahead);
+      DEBUGASSERT(tmp == iob);
+      UNUSED(tmp);
+
+      /* And free the I/O buffer chain */
+
+      iob_free_chain(iob, IOBUSER_NET_PKT_READAHEAD);
+    }
+}
+
 /****************************************************************************
  * Name: pkt_recvfrom_sender
  *
@@ -391,6 +461,18 @@ ssize_t pkt_recvfrom(FAR struct socket *psock, FAR void *buf, size_t len,
   net_lock();
   pkt_recvfrom_initialize(psock, buf, len, from, fromlen, &state);
 
+  /* Check if there is buffered read-ahead data for this socket.  If so,
+   * then we can deliver it immediately without blocking, allowing the
+   * caller to drain batches of captured frames back-to-back.
+   */
+
+  pkt_readahead(conn, &state);
+  if (state.pr_recvlen >= 0)
+    {
+      ret = state.pr_recvlen;
+      goto errout_with_state;
+    }
+
   /* Get the device driver that will service this transfer */
 
   dev  = pkt_find_device(conn);
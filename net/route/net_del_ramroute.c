@@ -48,6 +48,7 @@
 #include <nuttx/net/ip.h>
 
 #include "route/ramroute.h"
+#include "route/cacheroute.h"
 #include "route/route.h"
 
 #if defined(CONFIG_ROUTE_IPv4_RAMROUTE) || defined(CONFIG_ROUTE_IPv6_RAMROUTE)
@@ -221,7 +222,20 @@ int net_delroute_ipv4(in_addr_t target, in_addr_t netmask)
 
   /* Then remove the entry from the routing table */
 
-  return net_foreachroute_ipv4(net_match_ipv4, &match) ? OK : -ENOENT;
+  if (net_foreachroute_ipv4(net_match_ipv4, &match) == 0)
+    {
+      return -ENOENT;
+    }
+
+#ifdef CONFIG_ROUTE_IPv4_CACHEROUTE
+  /* The routing table changed.  Flush the in-memory routing table cache so
+   * that the removed route can no longer be used.
+   */
+
+  net_flushcache_ipv4();
+#endif
+
+  return OK;
 }
 #endif
 
@@ -238,7 +252,20 @@ int net_delroute_ipv6(net_ipv6addr_t target, net_ipv6addr_t netmask)
 
   /* Then remove the entry from the routing table */
 
-  return net_foreachroute_ipv6(net_match_ipv6, &match) ? OK : -ENOENT;
+  if (net_foreachroute_ipv6(net_match_ipv6, &match) == 0)
+    {
+      return -ENOENT;
+    }
+
+#ifdef CONFIG_ROUTE_IPv6_CACHEROUTE
+  /* The routing table changed.  Flush the in-memory routing table cache so
+   * that the removed route can no longer be used.
+   */
+
+  net_flushcache_ipv6();
+#endif
+
+  return OK;
 }
 #endif
 
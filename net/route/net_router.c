@@ -40,14 +40,17 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <errno.h>
 
 #include <netinet/in.h>
+#include <arpa/inet.h>
 
 #include <nuttx/net/ip.h>
 
 #include "devif/devif.h"
+#include "utils/utils.h"
 #include "route/cacheroute.h"
 #include "route/route.h"
 
@@ -77,6 +80,8 @@
 struct route_ipv4_match_s
 {
   in_addr_t target;              /* Target IPv4 address on remote network */
+  in_addr_t netmask;             /* Netmask of the best route found so far */
+  bool found;                    /* True: a matching route has been found */
 #ifdef CONFIG_ROUTE_IPv4_CACHEROUTE
   struct net_route_ipv4_s entry; /* Full entry from the IPv4 routing table */
 #else
@@ -89,6 +94,8 @@ struct route_ipv4_match_s
 struct route_ipv6_match_s
 {
   net_ipv6addr_t target;         /* Target IPv6 address on remote network */
+  uint8_t prefixlen;             /* Prefix length of the best route so far */
+  bool found;                    /* True: a matching route has been found */
 #ifdef CONFIG_ROUTE_IPv6_CACHEROUTE
   struct net_route_ipv6_s entry; /* Full entry from the IPv6 routing table */
 #else
@@ -105,14 +112,15 @@ struct route_ipv6_match_s
  * Name: net_ipv4_match
  *
  * Description:
- *   Return 1 if the IPv4 route is available
+ *   Record the IPv4 route if it is the best match found so far.
  *
  * Input Parameters:
  *   route - The next route to examine
  *   arg   - The match values (cast to void*)
  *
  * Returned Value:
- *   0 if the entry is not a match; 1 if the entry matched and was cleared.
+ *   Always zero so that the traversal continues and every route is
+ *   considered for the longest prefix match.
  *
  ****************************************************************************/
 
@@ -122,12 +130,16 @@ static int net_ipv4_match(FAR struct net_route_ipv4_s *route, FAR void *arg)
   FAR struct route_ipv4_match_s *match = (FAR struct route_ipv4_match_s *)arg;
 
   /* To match, the masked target addresses must be the same.  In the event
-   * of multiple matches, only the first is returned.  There is not (yet) any
-   * concept for the precedence of networks.
+   * of multiple matches, the route with the longest prefix (the largest
+   * netmask) takes precedence.
    */
 
-  if (net_ipv4addr_maskcmp(route->target, match->target, route->netmask))
+  if (net_ipv4addr_maskcmp(route->target, match->target, route->netmask) &&
+      (!match->found || ntohl(route->netmask) > ntohl(match->netmask)))
     {
+      match->found   = true;
+      match->netmask = route->netmask;
+
 #ifdef CONFIG_ROUTE_IPv4_CACHEROUTE
       /* They match.. Copy the entire routing table entry */
 
@@ -137,7 +149,6 @@ static int net_ipv4_match(FAR struct net_route_ipv4_s *route, FAR void *arg)
 
       net_ipv4addr_copy(match->router, route->router);
 #endif
-      return 1;
     }
 
   return 0;
@@ -148,14 +159,15 @@ static int net_ipv4_match(FAR struct net_route_ipv4_s *route, FAR void *arg)
  * Name: net_ipv6_match
  *
  * Description:
- *   Return 1 if the IPv6 route is available
+ *   Record the IPv6 route if it is the best match found so far.
  *
  * Input Parameters:
  *   route - The next route to examine
  *   arg   - The match values (cast to void*)
  *
  * Returned Value:
- *   0 if the entry is not a match; 1 if the entry matched and was cleared.
+ *   Always zero so that the traversal continues and every route is
+ *   considered for the longest prefix match.
  *
  ****************************************************************************/
 
@@ -163,14 +175,21 @@ static int net_ipv4_match(FAR struct net_route_ipv4_s *route, FAR void *arg)
 static int net_ipv6_match(FAR struct net_route_ipv6_s *route, FAR void *arg)
 {
   FAR struct route_ipv6_match_s *match = (FAR struct route_ipv6_match_s *)arg;
+  uint8_t prefixlen;
 
   /* To match, the masked target addresses must be the same.  In the event
-   * of multiple matches, only the first is returned.  There is not (yet) any
-   * concept for the precedence of networks.
+   * of multiple matches, the route with the longest prefix takes
+   * precedence.
    */
 
-  if (net_ipv6addr_maskcmp(route->target, match->target, route->netmask))
+  prefixlen = net_ipv6_mask2pref(route->netmask);
+
+  if (net_ipv6addr_maskcmp(route->target, match->target, route->netmask) &&
+      (!match->found || prefixlen > match->prefixlen))
     {
+      match->found     = true;
+      match->prefixlen = prefixlen;
+
 #ifdef CONFIG_ROUTE_IPv6_CACHEROUTE
       /* They match.. Copy the entire routing table entry */
 
@@ -180,7 +199,6 @@ static int net_ipv6_match(FAR struct net_route_ipv6_s *route, FAR void *arg)
 
       net_ipv6addr_copy(match->router, route->router);
 #endif
-      return 1;
     }
 
   return 0;
@@ -212,7 +230,6 @@ static int net_ipv6_match(FAR struct net_route_ipv6_s *route, FAR void *arg)
 int net_ipv4_router(in_addr_t target, FAR in_addr_t *router)
 {
   struct route_ipv4_match_s match;
-  int ret;
 
   /* Do not route the special broadcast IP address */
 
@@ -229,20 +246,20 @@ int net_ipv4_router(in_addr_t target, FAR in_addr_t *router)
 #ifdef CONFIG_ROUTE_IPv4_CACHEROUTE
   /* First see if we can find a router entry in the cache */
 
-  ret = net_foreachcache_ipv4(net_ipv4_match, &match);
-  if (ret <= 0)
+  net_foreachcache_ipv4(net_ipv4_match, &match);
+  if (!match.found)
 #endif
     {
       /* Not found in the cache.  Try to find a router entry with the
        * routing table that can forward to this address
        */
 
-      ret = net_foreachroute_ipv4(net_ipv4_match, &match);
+      net_foreachroute_ipv4(net_ipv4_match, &match);
     }
 
   /* Did we find a route? */
 
-  if (ret <= 0)
+  if (!match.found)
     {
       /* No.. there is no route for this address */
 
@@ -287,7 +304,6 @@ int net_ipv4_router(in_addr_t target, FAR in_addr_t *router)
 int net_ipv6_router(const net_ipv6addr_t target, net_ipv6addr_t router)
 {
   struct route_ipv6_match_s match;
-  int ret;
 
   /* Do not route to any the special IPv6 multicast addresses */
 
@@ -304,20 +320,20 @@ int net_ipv6_router(const net_ipv6addr_t target, net_ipv6addr_t router)
 #ifdef CONFIG_ROUTE_IPv6_CACHEROUTE
   /* First see if we can find a router entry in the cache */
 
-  ret = net_foreachcache_ipv6(net_ipv6_match, &match);
-  if (ret <= 0)
+  net_foreachcache_ipv6(net_ipv6_match, &match);
+  if (!match.found)
 #endif
     {
       /* Not found in the cache.  Try to find a router entry with the
        * routing table that can forward to this address
        */
 
-      ret = net_foreachroute_ipv6(net_ipv6_match, &match);
+      net_foreachroute_ipv6(net_ipv6_match, &match);
     }
 
   /* Did we find a route? */
 
-  if (ret <= 0)
+  if (!match.found)
     {
       /* No.. there is no route for this address */
 
@@ -40,13 +40,17 @@
 #include <nuttx/config.h>
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <string.h>
 #include <errno.h>
 
+#include <arpa/inet.h>
+
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/ip.h>
 
 #include "netdev/netdev.h"
+#include "utils/utils.h"
 #include "route/cacheroute.h"
 #include "route/route.h"
 
@@ -77,6 +81,8 @@ struct route_ipv4_devmatch_s
 {
   FAR struct net_driver_s *dev;  /* The route must use this device */
   in_addr_t target;              /* Target IPv4 address on remote network */
+  in_addr_t netmask;             /* Netmask of the best route found so far */
+  bool found;                    /* True: a matching route has been found */
 #ifdef CONFIG_ROUTE_IPv4_CACHEROUTE
   struct net_route_ipv4_s entry; /* Full entry from the IPv4 routing table */
 #else
@@ -90,6 +96,8 @@ struct route_ipv6_devmatch_s
 {
   FAR struct net_driver_s *dev;  /* The route must use this device */
   net_ipv6addr_t target;         /* Target IPv4 address on remote network */
+  uint8_t prefixlen;             /* Prefix length of the best route so far */
+  bool found;                    /* True: a matching route has been found */
 #ifdef CONFIG_ROUTE_IPv6_CACHEROUTE
   struct net_route_ipv6_s entry; /* Full entry from the IPv6 routing table */
 #else
@@ -106,14 +114,16 @@ struct route_ipv6_devmatch_s
  * Name: net_ipv4_devmatch
  *
  * Description:
- *   Return 1 if the IPv4 route is available on the device's network.
+ *   Record the IPv4 route if it is available on the device's network and
+ *   is the best match found so far.
  *
  * Input Parameters:
  *   route - The next route to examine
  *   arg   - The match values (cast to void*)
  *
  * Returned Value:
- *   0 if the entry is not a match; 1 if the entry matched and was cleared.
+ *   Always zero so that the traversal continues and every route is
+ *   considered for the longest prefix match.
  *
  ****************************************************************************/
 
@@ -128,13 +138,17 @@ static int net_ipv4_devmatch(FAR struct net_route_ipv4_s *route,
   /* To match, (1) the masked target addresses must be the same, and (2) the
    * router address must like on the network provided by the device.
    *
-   * In the event of multiple matches, only the first is returned.  There
-   * not (yet) any concept for the precedence of networks.
+   * In the event of multiple matches, the route with the longest prefix
+   * (the largest netmask) takes precedence.
    */
 
   if (net_ipv4addr_maskcmp(route->target, match->target, route->netmask) &&
-      net_ipv4addr_maskcmp(route->router, dev->d_ipaddr, dev->d_netmask))
+      net_ipv4addr_maskcmp(route->router, dev->d_ipaddr, dev->d_netmask) &&
+      (!match->found || ntohl(route->netmask) > ntohl(match->netmask)))
     {
+      match->found   = true;
+      match->netmask = route->netmask;
+
 #ifdef CONFIG_ROUTE_IPv4_CACHEROUTE
       /* They match.. Copy the entire routing table entry */
 
@@ -144,7 +158,6 @@ static int net_ipv4_devmatch(FAR struct net_route_ipv4_s *route,
 
       net_ipv4addr_copy(match->router, route->router);
 #endif
-      return 1;
     }
 
   return 0;
@@ -155,14 +168,16 @@ static int net_ipv4_devmatch(FAR struct net_route_ipv4_s *route,
  * Name: net_ipv6_devmatch
  *
  * Description:
- *   Return 1 if the IPv6 route is available on the device's network.
+ *   Record the IPv6 route if it is available on the device's network and
+ *   is the best match found so far.
  *
  * Input Parameters:
  *   route - The next route to examine
  *   arg   - The match values (cast to void*)
  *
  * Returned Value:
- *   0 if the entry is not a match; 1 if the entry matched and was cleared.
+ *   Always zero so that the traversal continues and every route is
+ *   considered for the longest prefix match.
  *
  ****************************************************************************/
 
@@ -173,18 +188,25 @@ static int net_ipv6_devmatch(FAR struct net_route_ipv6_s *route,
   FAR struct route_ipv6_devmatch_s *match =
     (FAR struct route_ipv6_devmatch_s *)arg;
   FAR struct net_driver_s *dev = match->dev;
+  uint8_t prefixlen;
 
   /* To match, (1) the masked target addresses must be the same, and (2) the
    * router address must like on the network provided by the device.
    *
-   * In the event of multiple matches, only the first is returned.  There
-   * not (yet) any concept for the precedence of networks.
+   * In the event of multiple matches, the route with the longest prefix
+   * takes precedence.
    */
 
+  prefixlen = net_ipv6_mask2pref(route->netmask);
+
   if (net_ipv6addr_maskcmp(route->target, match->target, route->netmask) &&
       net_ipv6addr_maskcmp(route->router, dev->d_ipv6addr,
-                           dev->d_ipv6netmask))
+                           dev->d_ipv6netmask) &&
+      (!match->found || prefixlen > match->prefixlen))
     {
+      match->found     = true;
+      match->prefixlen = prefixlen;
+
 #ifdef CONFIG_ROUTE_IPv6_CACHEROUTE
       /* They match.. Copy the entire routing table entry */
 
@@ -194,7 +216,6 @@ static int net_ipv6_devmatch(FAR struct net_route_ipv6_s *route,
 
       net_ipv6addr_copy(match->router, route->router);
 #endif
-      return 1;
     }
 
   return 0;
@@ -231,7 +252,6 @@ void netdev_ipv4_router(FAR struct net_driver_s *dev, in_addr_t target,
                         FAR in_addr_t *router)
 {
   struct route_ipv4_devmatch_s match;
-  int ret;
 
   /* Set up the comparison structure */
 
@@ -242,20 +262,20 @@ void netdev_ipv4_router(FAR struct net_driver_s *dev, in_addr_t target,
 #ifdef CONFIG_ROUTE_IPv4_CACHEROUTE
   /* First see if we can find a router entry in the cache */
 
-  ret = net_foreachcache_ipv4(net_ipv4_devmatch, &match);
-  if (ret <= 0)
+  net_foreachcache_ipv4(net_ipv4_devmatch, &match);
+  if (!match.found)
 #endif
     {
       /* Not found in the cache.  Try to find a router entry with the
        * routing table that can forward to this address
        */
 
-      ret = net_foreachroute_ipv4(net_ipv4_devmatch, &match);
+      net_foreachroute_ipv4(net_ipv4_devmatch, &match);
     }
 
   /* Did we find a route? */
 
-  if (ret > 0)
+  if (match.found)
     {
       /* We found a route. */
 
@@ -264,7 +284,7 @@ void netdev_ipv4_router(FAR struct net_driver_s *dev, in_addr_t target,
        * this will update it to the most recently accessed.
        */
 
-      ret = net_addcache_ipv4(&match.entry);
+      net_addcache_ipv4(&match.entry);
 #endif
 
       /* We Return the router address. */
@@ -310,7 +330,6 @@ void netdev_ipv6_router(FAR struct net_driver_s *dev,
                         FAR net_ipv6addr_t router)
 {
   struct route_ipv6_devmatch_s match;
-  int ret;
 
   /* Set up the comparison structure */
 
@@ -321,20 +340,20 @@ void netdev_ipv6_router(FAR struct net_driver_s *dev,
 #ifdef CONFIG_ROUTE_IPv6_CACHEROUTE
   /* First see if we can find a router entry in the cache */
 
-  ret = net_foreachcache_ipv6(net_ipv6_devmatch, &match);
-  if (ret <= 0)
+  net_foreachcache_ipv6(net_ipv6_devmatch, &match);
+  if (!match.found)
 #endif
     {
       /* Not found in the cache.  Try to find a router entry with the
        * routing table that can forward to this address
        */
 
-      ret = net_foreachroute_ipv6(net_ipv6_devmatch, &match);
+      net_foreachroute_ipv6(net_ipv6_devmatch, &match);
     }
 
   /* Did we find a route? */
 
-  if (ret > 0)
+  if (match.found)
     {
       /* We found a route. */
 
@@ -343,7 +362,7 @@ void netdev_ipv6_router(FAR struct net_driver_s *dev,
        * this will update it to the most recently accessed.
        */
 
-      ret = net_addcache_ipv6(&match.entry);
+      net_addcache_ipv6(&match.entry);
 #endif
       /* Return the router address. */
 
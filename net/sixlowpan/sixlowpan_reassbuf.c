@@ -58,6 +58,14 @@
 
 #define NET_6LOWPAN_TIMEOUT SEC2TICK(CONFIG_NET_6LOWPAN_MAXAGE)
 
+/* Active reassembly buffers are kept in small hash buckets, keyed by the
+ * (source address, reassembly tag) pair, to avoid a linear search over
+ * every active reassembly on each received fragment.  The bucket count
+ * must be a power of two.
+ */
+
+#define REASS_NBUCKETS 8
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -69,9 +77,18 @@
 
 static FAR struct sixlowpan_reassbuf_s *g_free_reass;
 
-/* This is a list of active, allocated reassemby buffers */
+/* These are the hash buckets, each a list of active, allocated reassemby
+ * buffers.  Buffers are hashed by (source address, reassembly tag).
+ */
+
+static FAR struct sixlowpan_reassbuf_s *g_active_reass[REASS_NBUCKETS];
+
+#if !defined(CONFIG_NET_6LOWPAN_REASS_STATIC) && \
+    CONFIG_NET_6LOWPAN_REASS_MAXALLOC > 0
+/* The number of reassembly buffers currently allocated from the heap */
 
-static FAR struct sixlowpan_reassbuf_s *g_active_reass;
+static uint8_t g_ndynamic;
+#endif
 
 /* Pool of pre-allocated reassembly buffer structures */
 
@@ -114,6 +131,37 @@ static bool sixlowpan_compare_fragsrc(FAR struct sixlowpan_reassbuf_s *reass,
   return false;
 }
 
+/****************************************************************************
+ * Name: sixlowpan_reass_hash
+ *
+ * Description:
+ *   Map a (source address, reassembly tag) pair to one of the active
+ *   reassembly buffer hash buckets.
+ *
+ * Input Parameters:
+ *   reasstag - The reassembly tag.
+ *   fragsrc  - The source address of the fragment.
+ *
+ * Returned Value:
+ *   The bucket index.
+ *
+ ****************************************************************************/
+
+static unsigned int
+  sixlowpan_reass_hash(uint16_t reasstag,
+                       FAR const struct netdev_varaddr_s *fragsrc)
+{
+  unsigned int hash = reasstag;
+  int i;
+
+  for (i = 0; i < fragsrc->nv_addrlen; i++)
+    {
+      hash = hash * 31 + fragsrc->nv_addr[i];
+    }
+
+  return hash & (REASS_NBUCKETS - 1);
+}
+
 /****************************************************************************
  * Name: sixlowpan_reass_expire
  *
@@ -136,36 +184,42 @@ static void sixlowpan_reass_expire(void)
   FAR struct sixlowpan_reassbuf_s *reass;
   FAR struct sixlowpan_reassbuf_s *next;
   clock_t elapsed;
+  int bucket;
 
   /* If reassembly timed out, cancel it */
 
-  for (reass = g_active_reass; reass != NULL; reass = next)
+  for (bucket = 0; bucket < REASS_NBUCKETS; bucket++)
     {
-      /* Needed if 'reass' is freed */
-
-      next = reass->rb_flink;
-
-      /* Free any inactive reassembly buffers.  This is done because the life
-       * the reassembly buffer is not cerain.
-       */
-
-      if (!reass->rb_active)
+      for (reass = g_active_reass[bucket]; reass != NULL; reass = next)
         {
-          sixlowpan_reass_free(reass);
-        }
-      else
-        {
-          /* Get the elpased time of the reassembly */
+          /* Needed if 'reass' is freed */
 
-          elapsed = clock_systime_ticks() - reass->rb_time;
+          next = reass->rb_flink;
 
-          /* If the reassembly has expired, then free the reassembly buffer */
+          /* Free any inactive reassembly buffers.  This is done because
+           * the life the reassembly buffer is not cerain.
+           */
 
-          if (elapsed >= NET_6LOWPAN_TIMEOUT)
+          if (!reass->rb_active)
             {
-              nwarn("WARNING: Reassembly timed out\n");
               sixlowpan_reass_free(reass);
             }
+          else
+            {
+              /* Get the elpased time of the reassembly */
+
+              elapsed = clock_systime_ticks() - reass->rb_time;
+
+              /* If the reassembly has expired, then free the reassembly
+               * buffer
+               */
+
+              if (elapsed >= NET_6LOWPAN_TIMEOUT)
+                {
+                  nwarn("WARNING: Reassembly timed out\n");
+                  sixlowpan_reass_free(reass);
+                }
+            }
         }
     }
 }
@@ -191,10 +245,26 @@ static void sixlowpan_remove_active(FAR struct sixlowpan_reassbuf_s *reass)
 {
   FAR struct sixlowpan_reassbuf_s *curr;
   FAR struct sixlowpan_reassbuf_s *prev;
+  unsigned int bucket;
 
-  /* Find the reassembly buffer in the list of active reassembly buffers */
+  /* Reassembly buffers provided by the radio driver are never added to
+   * the active reassembly buffer lists (and their tag and source address
+   * fields are not valid for hashing).
+   */
+
+  if (reass->rb_pool == REASS_POOL_RADIO)
+    {
+      reass->rb_flink = NULL;
+      return;
+    }
 
-  for (prev = NULL, curr = g_active_reass;
+  /* Find the reassembly buffer in its hash bucket of active reassembly
+   * buffers
+   */
+
+  bucket = sixlowpan_reass_hash(reass->rb_reasstag, &reass->rb_fragsrc);
+
+  for (prev = NULL, curr = g_active_reass[bucket];
        curr != NULL && curr != reass;
        prev = curr, curr = curr->rb_flink)
     {
@@ -208,7 +278,7 @@ static void sixlowpan_remove_active(FAR struct sixlowpan_reassbuf_s *reass)
 
       if (prev == NULL)
         {
-          g_active_reass = reass->rb_flink;
+          g_active_reass[bucket] = reass->rb_flink;
         }
       else
         {
@@ -294,6 +364,7 @@ FAR struct sixlowpan_reassbuf_s *
                            FAR const struct netdev_varaddr_s *fragsrc)
 {
   FAR struct sixlowpan_reassbuf_s *reass;
+  unsigned int bucket;
   uint8_t pool;
 
   /* First, removed any expired or inactive reassembly buffers.  This might
@@ -302,6 +373,33 @@ FAR struct sixlowpan_reassbuf_s *
 
   sixlowpan_reass_expire();
 
+#if CONFIG_NET_6LOWPAN_REASS_PERNODE > 0
+  /* Enforce per-node fairness:  Refuse the allocation if this source
+   * address already occupies its full share of the reassembly buffers so
+   * that one chatty node cannot claim every buffer and starve the
+   * partial datagrams of all other nodes.
+   */
+
+  {
+    int nactive = 0;
+
+    for (bucket = 0; bucket < REASS_NBUCKETS; bucket++)
+      {
+        for (reass = g_active_reass[bucket];
+             reass != NULL;
+             reass = reass->rb_flink)
+          {
+            if (sixlowpan_compare_fragsrc(reass, fragsrc) &&
+                ++nactive >= CONFIG_NET_6LOWPAN_REASS_PERNODE)
+              {
+                nwarn("WARNING: Too many reassemblies from one node\n");
+                return NULL;
+              }
+          }
+      }
+  }
+#endif
+
   /* Now, try the free list first */
 
   if (g_free_reass != NULL)
@@ -316,11 +414,28 @@ FAR struct sixlowpan_reassbuf_s *
       reass         = NULL;
 #else
       /* If we cannot get a reassembly buffer instance from the free list,
-       * then we will have to allocate one from the kernel memory pool.
+       * then we will have to allocate one from the kernel memory pool --
+       * unless that would exceed the configured bound on dynamically
+       * allocated reassembly buffers.
        */
 
-      reass = (FAR struct sixlowpan_reassbuf_s *)
-        kmm_malloc((sizeof (struct sixlowpan_reassbuf_s)));
+      reass = NULL;
+
+#if CONFIG_NET_6LOWPAN_REASS_MAXALLOC > 0
+      if (g_ndynamic < CONFIG_NET_6LOWPAN_REASS_MAXALLOC)
+#endif
+        {
+          reass = (FAR struct sixlowpan_reassbuf_s *)
+            kmm_malloc((sizeof (struct sixlowpan_reassbuf_s)));
+        }
+
+#if CONFIG_NET_6LOWPAN_REASS_MAXALLOC > 0
+      if (reass != NULL)
+        {
+          g_ndynamic++;
+        }
+#endif
+
       pool  = REASS_POOL_DYNAMIC;
 #endif
     }
@@ -338,10 +453,13 @@ FAR struct sixlowpan_reassbuf_s *
       reass->rb_reasstag = reasstag;
       reass->rb_time     = clock_systime_ticks();
 
-      /* Add the reassembly buffer to the list of active reassembly buffers */
+      /* Add the reassembly buffer to its hash bucket of active reassembly
+       * buffers
+       */
 
-      reass->rb_flink   = g_active_reass;
-      g_active_reass    = reass;
+      bucket                 = sixlowpan_reass_hash(reasstag, fragsrc);
+      reass->rb_flink        = g_active_reass[bucket];
+      g_active_reass[bucket] = reass;
     }
 
   return reass;
@@ -378,11 +496,14 @@ FAR struct sixlowpan_reassbuf_s *
 
   sixlowpan_reass_expire();
 
-  /* Now search for the matching reassembly buffer in the remainng, active
-   * reassembly buffers.
+  /* Now search for the matching reassembly buffer in the remaining, active
+   * reassembly buffers of the one hash bucket that the (source address,
+   * reassembly tag) pair may occupy.
    */
 
-  for (reass = g_active_reass; reass != NULL; reass = reass->rb_flink)
+  for (reass = g_active_reass[sixlowpan_reass_hash(reasstag, fragsrc)];
+       reass != NULL;
+       reass = reass->rb_flink)
     {
       /* In order to be a match, it must have the same reassembly tag as
        * well as source address (different sources might use the same
@@ -445,6 +566,11 @@ void sixlowpan_reass_free(FAR struct sixlowpan_reassbuf_s *reass)
 #else
       DEBUGASSERT(reass->rb_pool == REASS_POOL_DYNAMIC);
 
+#if CONFIG_NET_6LOWPAN_REASS_MAXALLOC > 0
+      DEBUGASSERT(g_ndynamic > 0);
+      g_ndynamic--;
+#endif
+
       /* Otherwise, deallocate it. */
 
       kmm_free(reass);
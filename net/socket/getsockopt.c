@@ -292,12 +292,35 @@ static int psock_socketlevel_option(FAR struct socket *psock, int option,
         break;
 #endif
 
+#if defined(NET_TCP_HAVE_STACK) && defined(CONFIG_NET_TCP_WINDOW_AUTOTUNE)
+      case SO_RCVBUF:     /* Reports receive buffer size */
+        {
+          FAR struct tcp_conn_s *conn;
+
+          if (*value_len != sizeof(int))
+            {
+              return -EINVAL;
+            }
+
+          if (psock->s_type != SOCK_STREAM || psock->s_conn == NULL)
+            {
+              return -ENOPROTOOPT;
+            }
+
+          conn = (FAR struct tcp_conn_s *)psock->s_conn;
+          *(FAR int *)value = conn->rcv_bufsize;
+        }
+        break;
+#endif
+
       /* The following are not yet implemented
        * (return values other than {0,1})
        */
 
       case SO_LINGER:     /* Lingers on a close() if data is present */
+#if !defined(NET_TCP_HAVE_STACK) || !defined(CONFIG_NET_TCP_WINDOW_AUTOTUNE)
       case SO_RCVBUF:     /* Sets receive buffer size */
+#endif
       case SO_RCVLOWAT:   /* Sets the minimum number of bytes to input */
       case SO_SNDBUF:     /* Sets send buffer size */
       case SO_SNDLOWAT:   /* Sets the minimum number of bytes to output */
@@ -40,6 +40,7 @@
 
 #include <nuttx/config.h>
 
+#include <sys/socket.h>
 #include <assert.h>
 #include <errno.h>
 
@@ -81,23 +82,32 @@
  *   is returned (see comments with send() for a list of appropriate errno
  *   values).
  *
+ *   If more than one I/O vector is provided, each vector is filled by a
+ *   separate receive operation:  For a datagram socket, each vector
+ *   receives (at most) one queued datagram so that a single call can
+ *   drain the readahead queue.  Only the first receive may block; the
+ *   remaining vectors are filled only with data that is already
+ *   available.  The source address returned in msg_name is that of the
+ *   first datagram received.
+ *
  ****************************************************************************/
 
 ssize_t psock_recvmsg(FAR struct socket *psock, FAR struct msghdr *msg,
                        int flags)
 {
+  FAR struct sockaddr *from;
+  FAR socklen_t *fromlen;
+  ssize_t total;
+  ssize_t ret;
+  int i;
+
   /* Verify that non-NULL pointers were passed */
 
-  if (msg == NULL)
+  if (msg == NULL || msg->msg_iov == NULL || msg->msg_iovlen < 1)
     {
       return -EINVAL;
     }
 
-  if (msg->msg_iovlen != 1)
-    {
-      return -ENOTSUP;
-    }
-
   /* Verify that the sockfd corresponds to valid, allocated socket */
 
   if (psock == NULL || psock->s_crefs <= 0)
@@ -117,18 +127,51 @@ ssize_t psock_recvmsg(FAR struct socket *psock, FAR struct msghdr *msg,
     {
       return psock->s_sockif->si_recvmsg(psock, msg, flags);
     }
-  else
-    {
-      /* Socket doesn't implement si_recvmsg fallback to si_recvfrom */
 
-      FAR void *buf             = msg->msg_iov->iov_base;
-      FAR struct sockaddr *from = msg->msg_name;
-      FAR socklen_t *fromlen    = (FAR socklen_t *)&msg->msg_namelen;
-      size_t len                = msg->msg_iov->iov_len;
+  /* Socket doesn't implement si_recvmsg fallback to si_recvfrom.  Fill
+   * each I/O vector with a separate receive operation.  The source
+   * address is returned only for the first receive; subsequent receives
+   * must not block since data for the first has already been consumed.
+   */
+
+  from    = msg->msg_name;
+  fromlen = (FAR socklen_t *)&msg->msg_namelen;
+  total   = 0;
 
-      return psock->s_sockif->si_recvfrom(psock, buf, len, flags, from,
-                                          fromlen);
+  for (i = 0; i < msg->msg_iovlen; i++)
+    {
+      FAR void *buf = msg->msg_iov[i].iov_base;
+      size_t len    = msg->msg_iov[i].iov_len;
+
+      if (len == 0)
+        {
+          continue;
+        }
+
+      ret = psock->s_sockif->si_recvfrom(psock, buf, len, flags, from,
+                                         fromlen);
+      if (ret <= 0)
+        {
+          /* Return any error (or the end-of-stream indication) only if
+           * nothing has been received yet.  Otherwise, report the number
+           * of bytes received so far.
+           */
+
+          return total > 0 ? total : ret;
+        }
+
+      total += ret;
+
+      /* Only the first receive operation may block or return a source
+       * address.
+       */
+
+      flags  |= MSG_DONTWAIT;
+      from    = NULL;
+      fromlen = NULL;
     }
+
+  return total;
 }
 
 /****************************************************************************
@@ -299,13 +299,83 @@ static int psock_socketlevel_option(FAR struct socket *psock, int option,
 
           psock->s_timestamp = *((FAR int32_t *)value);
 
+#ifdef NET_UDP_HAVE_STACK
+          /* The UDP read-ahead logic has no access to the socket
+           * structure, so the selection must be shadowed in the UDP
+           * connection structure.
+           */
+
+          if (psock->s_type == SOCK_DGRAM && psock->s_conn != NULL)
+            {
+              FAR struct udp_conn_s *conn = psock->s_conn;
+
+              conn->timestamp = (psock->s_timestamp != 0);
+            }
+#endif
+
           net_unlock();
         }
         break;
 #endif
+#if defined(NET_TCP_HAVE_STACK) && defined(CONFIG_NET_TCP_WINDOW_AUTOTUNE)
+      case SO_RCVBUF:     /* Sets receive buffer size */
+        {
+          FAR struct tcp_conn_s *conn;
+          int buffersize;
+
+          /* Verify that option is the size of an 'int' */
+
+          if (value_len != sizeof(int))
+            {
+              return -EINVAL;
+            }
+
+          buffersize = *(FAR int *)value;
+          if (buffersize < 0)
+            {
+              return -EINVAL;
+            }
+
+          /* At present the receive buffer size is used only to limit the
+           * TCP receive window advertised by tcp_get_recvwindow().
+           */
+
+          if (psock->s_type != SOCK_STREAM || psock->s_conn == NULL)
+            {
+              return -ENOPROTOOPT;
+            }
+
+          if (buffersize > UINT16_MAX)
+            {
+              buffersize = UINT16_MAX;
+            }
+
+          /* Lock the network so that we have exclusive access to the
+           * connection.
+           */
+
+          net_lock();
+
+          conn = (FAR struct tcp_conn_s *)psock->s_conn;
+          conn->rcv_bufsize = (uint16_t)buffersize;
+
+          /* Apply a lowered limit to the tracked window immediately */
+
+          if (conn->rcv_bufsize > 0 && conn->rcv_wnd > conn->rcv_bufsize)
+            {
+              conn->rcv_wnd = conn->rcv_bufsize;
+            }
+
+          net_unlock();
+        }
+        break;
+#endif
+
       /* The following are not yet implemented */
 
+#if !defined(NET_TCP_HAVE_STACK) || !defined(CONFIG_NET_TCP_WINDOW_AUTOTUNE)
       case SO_RCVBUF:     /* Sets receive buffer size */
+#endif
       case SO_RCVLOWAT:   /* Sets the minimum number of bytes to input */
       case SO_SNDBUF:     /* Sets send buffer size */
       case SO_SNDLOWAT:   /* Sets the minimum number of bytes to output */
@@ -49,6 +49,10 @@
 #include <nuttx/mm/iob.h>
 #include <nuttx/net/ip.h>
 
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+#  include <nuttx/wdog.h>
+#endif
+
 #ifdef CONFIG_NET_TCP_NOTIFIER
 #  include <nuttx/wqueue.h>
 #endif
@@ -72,6 +76,20 @@
 #define tcp_callback_free(conn,cb) \
   devif_conn_callback_free((conn)->dev, (cb), &(conn)->list)
 
+#ifdef CONFIG_NET_TCP_FASTOPEN
+/* Limits on the length of the TCP Fast Open cookie (RFC 7413) */
+
+#  define TCP_TFO_MINCOOKIE 4   /* Minimum cookie length in bytes */
+#  define TCP_TFO_MAXCOOKIE 16  /* Maximum cookie length in bytes */
+#endif
+
+/* Wrap-safe TCP sequence number comparisons */
+
+#define TCP_SEQ_LT(a,b)   ((int32_t)((a) - (b)) < 0)
+#define TCP_SEQ_GT(a,b)   TCP_SEQ_LT(b,a)
+#define TCP_SEQ_GTE(a,b)  (!TCP_SEQ_LT(a,b))
+#define TCP_SEQ_LTE(a,b)  (!TCP_SEQ_LT(b,a))
+
 #ifdef CONFIG_NET_TCP_WRITE_BUFFERS
 /* TCP write buffer access macros */
 
@@ -87,6 +105,9 @@
 #  define TCP_WBTRYCOPYIN(wrb,src,n) \
      (iob_trycopyin((wrb)->wb_iob,src,(n),0,false,\
                     IOBUSER_NET_TCP_WRITEBUFFER))
+#  define TCP_WBTRYAPPEND(wrb,src,n,off) \
+     (iob_trycopyin((wrb)->wb_iob,src,(n),(off),false,\
+                    IOBUSER_NET_TCP_WRITEBUFFER))
 
 #  define TCP_WBTRIM(wrb,n) \
      do { (wrb)->wb_iob = iob_trimhead((wrb)->wb_iob,(n),\
@@ -132,12 +153,32 @@ struct tcp_poll_s
   FAR struct devif_callback_s *cb; /* Needed to teardown the poll */
 };
 
+#ifdef CONFIG_NET_TCP_SACK
+/* One selectively acknowledged sequence range reported by the peer
+ * (RFC 2018).  The range covers sequence numbers left <= seq < right.
+ */
+
+struct tcp_sack_range_s
+{
+  uint32_t left;                   /* Left edge of the SACKed range */
+  uint32_t right;                  /* Right edge of the SACKed range */
+};
+#endif
+
 struct tcp_conn_s
 {
   /* Common prologue of all connection structures. */
 
   dq_entry_t node;        /* Implements a doubly linked list */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  /* Implements a singly linked hash bucket chain for fast lookup of the
+   * connection matching an incoming segment.
+   */
+
+  FAR struct tcp_conn_s *hashlink;
+#endif
+
   /* TCP callbacks:
    *
    * Data transfer events are retained in 'list'.  Event handlers in 'list'
@@ -191,7 +232,17 @@ struct tcp_conn_s
   uint16_t rport;         /* The remoteTCP port, in network byte order */
   uint16_t mss;           /* Current maximum segment size for the
                            * connection */
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+  struct wdog_s wdog;     /* Per-connection RTO/keepalive timer */
+  uint16_t wdog_hsec;     /* Interval that the armed timer represents */
+  bool     wdog_expired;  /* True: timer expired; timer work is pending */
+#endif
   uint16_t winsize;       /* Current window size of the connection */
+#ifdef CONFIG_NET_TCP_WINDOW_AUTOTUNE
+  uint16_t rcv_wnd;       /* Smoothed, advertised receive window */
+  uint16_t rcv_bufsize;   /* SO_RCVBUF limit on the advertised receive
+                           * window (zero means no limit) */
+#endif
 #ifdef CONFIG_NET_TCP_WRITE_BUFFERS
   uint32_t tx_unacked;    /* Number bytes sent but not yet ACKed */
 #else
@@ -212,6 +263,9 @@ struct tcp_conn_s
    */
 
   struct iob_queue_s readahead;   /* Read-ahead buffering */
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+  uint32_t readahead_bytes;       /* Bytes held in the read-ahead queue */
+#endif
 
 #ifdef CONFIG_NET_TCP_WRITE_BUFFERS
   /* Write buffering
@@ -230,6 +284,21 @@ struct tcp_conn_s
   uint32_t   isn;         /* Initial sequence number */
   uint32_t   sndseq_max;  /* The sequence number of next not-retransmitted
                            * segment (next greater sndseq) */
+
+#ifdef CONFIG_NET_TCP_SACK
+  /* Selective acknowledgment scoreboard.  The ranges are refreshed from
+   * the SACK option of each incoming ACK and are consulted on
+   * retransmission to avoid resending data that the peer already holds.
+   */
+
+  uint8_t    sack_enabled; /* SACK was negotiated on this connection */
+  uint8_t    nsacked;      /* Number of valid entries in sacked[] */
+  struct tcp_sack_range_s sacked[CONFIG_NET_TCP_SACK_RANGES];
+#endif
+
+#ifdef CONFIG_NET_TCP_FASTOPEN
+  uint16_t   tfo_sndlen;  /* Number of data bytes carried on the SYN */
+#endif
 #endif
 
 #ifdef CONFIG_NET_TCPBACKLOG
@@ -814,6 +883,36 @@ void tcp_poll(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn);
 void tcp_timer(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
                int hsec);
 
+/****************************************************************************
+ * Name: tcp_timer_update
+ *
+ * Description:
+ *   Re-arm (or cancel) the per-connection watchdog timer to match the
+ *   earliest pending deadline of the connection:  the retransmission
+ *   timeout, the TIME_WAIT/FIN_WAIT_2 timeout, the next keepalive probe
+ *   or a delayed acknowledgment.  If the connection has no pending
+ *   deadline, then the watchdog is stopped and the idle connection incurs
+ *   no timer processing at all.
+ *
+ *   This function must be called whenever an event changes the timing
+ *   state of the connection (segment sent, ACK received, keepalive
+ *   reconfigured, etc.).
+ *
+ * Input Parameters:
+ *   conn - The TCP connection of interest
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+void tcp_timer_update(FAR struct tcp_conn_s *conn);
+#endif
+
 /****************************************************************************
  * Name: tcp_listen_initialize
  *
@@ -1125,6 +1224,32 @@ uint16_t tcp_callback(FAR struct net_driver_s *dev,
 uint16_t tcp_datahandler(FAR struct tcp_conn_s *conn, FAR uint8_t *buffer,
                          uint16_t nbytes);
 
+/****************************************************************************
+ * Name: tcp_readahead_quota
+ *
+ * Description:
+ *   Return the number of additional bytes that the connection may buffer
+ *   in its read-ahead queue under the fair-share policy.  Each established
+ *   connection is entitled to an equal share of the read-ahead buffer
+ *   memory; the share shrinks when the I/O buffer pool comes under
+ *   pressure.
+ *
+ * Input Parameters:
+ *   conn - A pointer to the TCP connection structure
+ *
+ * Returned Value:
+ *   The number of bytes that the connection may still buffer.  Zero if
+ *   the connection has consumed its full share.
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+uint32_t tcp_readahead_quota(FAR struct tcp_conn_s *conn);
+#endif
+
 /****************************************************************************
  * Name: tcp_backlogcreate
  *
@@ -1355,6 +1480,35 @@ struct socket;
 ssize_t psock_tcp_send(FAR struct socket *psock, FAR const void *buf,
                        size_t len, int flags);
 
+/****************************************************************************
+ * Name: psock_send_eventhandler
+ *
+ * Description:
+ *   This function is the write-buffering event handler.  It is called from
+ *   the network interrupt level when a TCP event occurs on the connection.
+ *   It drains the connection's write queue to the network device.  It is
+ *   shared by psock_tcp_send() and the write-buffered tcp_sendfile().
+ *
+ * Input Parameters:
+ *   dev    The structure of the network driver that caused the event
+ *   pvconn The connection structure associated with the socket
+ *   pvpriv The socket structure (cast to void)
+ *   flags  Set of events describing why the callback was invoked
+ *
+ * Returned Value:
+ *   The updated flags.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_WRITE_BUFFERS
+uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
+                                 FAR void *pvconn, FAR void *pvpriv,
+                                 uint16_t flags);
+#endif
+
 /****************************************************************************
  * Name: tcp_setsockopt
  *
@@ -1427,17 +1581,22 @@ int tcp_getsockopt(FAR struct socket *psock, int option,
  * Name: tcp_get_recvwindow
  *
  * Description:
- *   Calculate the TCP receive window for the specified device.
+ *   Calculate the TCP receive window for the specified device and
+ *   connection.  If CONFIG_NET_TCP_WINDOW_AUTOTUNE is selected, then the
+ *   returned window is smoothed across calls and clamped to any SO_RCVBUF
+ *   limit that has been set on the connection.
  *
  * Input Parameters:
- *   dev - The device whose TCP receive window will be updated.
+ *   dev  - The device whose TCP receive window will be updated.
+ *   conn - The TCP connection structure holding connection information.
  *
  * Returned Value:
  *   The value of the TCP receive window to use.
  *
  ****************************************************************************/
 
-uint16_t tcp_get_recvwindow(FAR struct net_driver_s *dev);
+uint16_t tcp_get_recvwindow(FAR struct net_driver_s *dev,
+                            FAR struct tcp_conn_s *conn);
 
 /****************************************************************************
  * Name: psock_tcp_cansend
@@ -1569,6 +1728,88 @@ void tcp_wrbuffer_dump(FAR const char *msg, FAR struct tcp_wrbuffer_s *wrb,
 #endif
 #endif /* CONFIG_NET_TCP_WRITE_BUFFERS */
 
+/****************************************************************************
+ * Name: tcp_tfo_lookup
+ *
+ * Description:
+ *   Look up the cached TCP Fast Open cookie for the remote peer of a
+ *   connection.
+ *
+ * Input Parameters:
+ *   conn      - The TCP connection of interest.  The remote address must
+ *               have been set up (as it is after tcp_connect()).
+ *   cookielen - The location to return the length of the cookie.
+ *
+ * Returned Value:
+ *   A pointer to the cookie, or NULL if no cookie has been cached for
+ *   the peer.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_FASTOPEN
+FAR const uint8_t *tcp_tfo_lookup(FAR struct tcp_conn_s *conn,
+                                  FAR uint8_t *cookielen);
+#endif
+
+/****************************************************************************
+ * Name: tcp_tfo_store
+ *
+ * Description:
+ *   Cache the TCP Fast Open cookie provided by the remote peer of a
+ *   connection (in its SYN-ACK) for use by subsequent connections to the
+ *   same peer.
+ *
+ * Input Parameters:
+ *   conn      - The TCP connection that received the cookie.
+ *   cookie    - The cookie data.
+ *   cookielen - The length of the cookie in bytes.
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_FASTOPEN
+void tcp_tfo_store(FAR struct tcp_conn_s *conn, FAR const uint8_t *cookie,
+                   uint8_t cookielen);
+#endif
+
+/****************************************************************************
+ * Name: tcp_tfo_synopt
+ *
+ * Description:
+ *   Append the TCP Fast Open option to an outgoing client SYN segment.
+ *   If a cookie has been cached for the peer, then the cookie is sent and
+ *   any application data queued in the write buffers rides on the SYN.
+ *   Otherwise a cookie request is sent so that the next connection to the
+ *   peer can carry data on its SYN.
+ *
+ * Input Parameters:
+ *   dev  - The device driver structure to use in the send operation
+ *   conn - The TCP connection structure holding connection information
+ *   tcp  - A pointer to the TCP header of the SYN being built
+ *
+ * Returned Value:
+ *   None.  dev->d_len and the TCP header length are updated to cover the
+ *   appended option (and data).
+ *
+ * Assumptions:
+ *   The network is locked.  tcp_synack() has initialized the segment with
+ *   the standard SYN options.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_FASTOPEN
+void tcp_tfo_synopt(FAR struct net_driver_s *dev,
+                    FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp);
+#endif
+
 /****************************************************************************
  * Name: tcp_pollsetup
  *
@@ -132,6 +132,12 @@ void tcp_appsend(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
            */
 
           conn->rx_unackseg = 1;
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+          /* Arm the per-connection timer for the delayed ACK deadline */
+
+          tcp_timer_update(conn);
+#endif
           return;
         }
     }
@@ -246,6 +252,14 @@ void tcp_appsend(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
 
       tcp_rexmit(dev, conn, result);
     }
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+  /* Re-arm the per-connection timer to match the (possibly changed)
+   * earliest deadline, including a newly pending delayed ACK.
+   */
+
+  tcp_timer_update(conn);
+#endif
 }
 
 /****************************************************************************
@@ -127,6 +127,102 @@ tcp_data_event(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_readahead_quota
+ *
+ * Description:
+ *   Return the number of additional bytes that the connection may buffer
+ *   in its read-ahead queue under the fair-share policy.  Each established
+ *   connection is entitled to an equal share of the read-ahead buffer
+ *   memory; the share shrinks when the I/O buffer pool comes under
+ *   pressure.
+ *
+ * Input Parameters:
+ *   conn - A pointer to the TCP connection structure
+ *
+ * Returned Value:
+ *   The number of bytes that the connection may still buffer.  Zero if
+ *   the connection has consumed its full share.
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+uint32_t tcp_readahead_quota(FAR struct tcp_conn_s *conn)
+{
+  FAR struct tcp_conn_s *check;
+  uint32_t share;
+  int nactive = 0;
+  int navail;
+
+  /* Count the established connections competing for read-ahead memory.
+   * The walk is over a small, fixed-size connection table and occurs at
+   * most once per received segment.
+   */
+
+  for (check = tcp_nextconn(NULL);
+       check != NULL;
+       check = tcp_nextconn(check))
+    {
+      if ((check->tcpstateflags & TCP_STATE_MASK) == TCP_ESTABLISHED)
+        {
+          nactive++;
+        }
+    }
+
+  if (nactive < 1)
+    {
+      nactive = 1;
+    }
+
+  /* Each established connection gets an equal share of the portion of the
+   * I/O buffer pool that the read-ahead throttle leaves available.
+   */
+
+  share = ((uint32_t)(CONFIG_IOB_NBUFFERS - CONFIG_IOB_THROTTLE) *
+           CONFIG_IOB_BUFSIZE) / nactive;
+
+  /* When the free pool has drained below one quarter of the read-ahead
+   * capacity, halve every share so that bulk connections surrender memory
+   * before the pool is exhausted and interactive connections can still
+   * buffer data.
+   */
+
+  navail = iob_navail(true);
+#if CONFIG_IOB_THROTTLE > 0
+  navail -= CONFIG_IOB_THROTTLE;
+#endif
+
+  if (navail < 0)
+    {
+      navail = 0;
+    }
+
+  if (navail * 4 < CONFIG_IOB_NBUFFERS - CONFIG_IOB_THROTTLE)
+    {
+      share >>= 1;
+    }
+
+  /* Never deny a connection its first buffer:  that would leave the
+   * connection unable to make progress with no listener in place.
+   */
+
+  if (share < CONFIG_IOB_BUFSIZE)
+    {
+      share = CONFIG_IOB_BUFSIZE;
+    }
+
+  if (conn->readahead_bytes >= share)
+    {
+      return 0;
+    }
+
+  return share - conn->readahead_bytes;
+}
+#endif /* CONFIG_NET_TCP_READAHEAD_FAIRSHARE */
+
 /****************************************************************************
  * Name: tcp_callback
  *
@@ -243,6 +339,20 @@ uint16_t tcp_datahandler(FAR struct tcp_conn_s *conn, FAR uint8_t *buffer,
   FAR struct iob_s *iob;
   int ret;
 
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+  /* Drop the packet if buffering it would take the connection beyond its
+   * fair share of the read-ahead memory.  Suppressing the ACK causes the
+   * sender to back off and retransmit later, leaving the remaining buffer
+   * memory for the other connections.
+   */
+
+  if (buflen > tcp_readahead_quota(conn))
+    {
+      ninfo("Read-ahead quota exceeded, dropping %d bytes\n", buflen);
+      return 0;
+    }
+#endif
+
   /* Try to allocate on I/O buffer to start the chain without waiting (and
    * throttling as necessary).  If we would have to wait, then drop the
    * packet.
@@ -282,6 +392,10 @@ uint16_t tcp_datahandler(FAR struct tcp_conn_s *conn, FAR uint8_t *buffer,
       return 0;
     }
 
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+  conn->readahead_bytes += buflen;
+#endif
+
 #ifdef CONFIG_NET_TCP_NOTIFIER
   /* Provide notification(s) that additional TCP read-ahead data is
    * available.
@@ -67,6 +67,10 @@
 #include "arp/arp.h"
 #include "icmpv6/icmpv6.h"
 
+#if CONFIG_NET_TCP_EMBRYONIC_LIMIT > 0
+#  include <nuttx/net/netstats.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -74,6 +78,11 @@
 #define IPv4BUF ((struct ipv4_hdr_s *)&dev->d_buf[NET_LL_HDRLEN(dev)])
 #define IPv6BUF ((struct ipv6_hdr_s *)&dev->d_buf[NET_LL_HDRLEN(dev)])
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+#  define TCP_CONN_NBUCKETS   CONFIG_NET_TCP_CONN_HASHSIZE
+#  define TCP_CONN_BUCKET(h)  ((h) & (TCP_CONN_NBUCKETS - 1))
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -90,6 +99,14 @@ static dq_queue_t g_free_tcp_connections;
 
 static dq_queue_t g_active_tcp_connections;
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+/* A hash table of the active TCP connections, keyed by the connection
+ * 4-tuple.  Each bucket holds a singly linked chain of connections.
+ */
+
+static FAR struct tcp_conn_s *g_tcp_conn_hash[TCP_CONN_NBUCKETS];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -318,6 +335,143 @@ static int tcp_selectport(uint8_t domain, FAR const union ip_addr_u *ipaddr,
   return portno;
 }
 
+/****************************************************************************
+ * Name: tcp_ipv4_hashndx
+ *
+ * Description:
+ *   Map the IPv4 connection 4-tuple to a hash bucket index.  The local
+ *   address is excluded from the key because a connection may be bound to
+ *   INADDR_ANY.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_TCP_CONN_HASH) && defined(CONFIG_NET_IPv4)
+static int tcp_ipv4_hashndx(in_addr_t raddr, uint16_t rport, uint16_t lport)
+{
+  uint32_t hash = raddr;
+
+  hash ^= (uint32_t)rport << 16 | lport;
+  hash ^= hash >> 16;
+  hash ^= hash >> 8;
+  return TCP_CONN_BUCKET(hash);
+}
+#endif
+
+/****************************************************************************
+ * Name: tcp_ipv6_hashndx
+ *
+ * Description:
+ *   Map the IPv6 connection 4-tuple to a hash bucket index.  The local
+ *   address is excluded from the key because a connection may be bound to
+ *   the unspecified address.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_NET_TCP_CONN_HASH) && defined(CONFIG_NET_IPv6)
+static int tcp_ipv6_hashndx(const net_ipv6addr_t raddr, uint16_t rport,
+                            uint16_t lport)
+{
+  uint32_t hash = (uint32_t)rport << 16 | lport;
+  int i;
+
+  for (i = 0; i < 8; i++)
+    {
+      hash ^= raddr[i];
+    }
+
+  hash ^= hash >> 16;
+  hash ^= hash >> 8;
+  return TCP_CONN_BUCKET(hash);
+}
+#endif
+
+/****************************************************************************
+ * Name: tcp_conn_hashndx
+ *
+ * Description:
+ *   Return the hash bucket index for the 4-tuple bound to the connection.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+static int tcp_conn_hashndx(FAR struct tcp_conn_s *conn)
+{
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  if (conn->domain == PF_INET)
+#endif
+    {
+      return tcp_ipv4_hashndx(conn->u.ipv4.raddr, conn->rport,
+                              conn->lport);
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  else
+#endif
+    {
+      return tcp_ipv6_hashndx(conn->u.ipv6.raddr, conn->rport,
+                              conn->lport);
+    }
+#endif /* CONFIG_NET_IPv6 */
+}
+#endif /* CONFIG_NET_TCP_CONN_HASH */
+
+/****************************************************************************
+ * Name: tcp_conn_hash
+ *
+ * Description:
+ *   Add the connection to the hash table of active connections.  This must
+ *   be done after the 4-tuple of the connection is final.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+static void tcp_conn_hash(FAR struct tcp_conn_s *conn)
+{
+  int ndx = tcp_conn_hashndx(conn);
+
+  conn->hashlink       = g_tcp_conn_hash[ndx];
+  g_tcp_conn_hash[ndx] = conn;
+}
+#endif
+
+/****************************************************************************
+ * Name: tcp_conn_unhash
+ *
+ * Description:
+ *   Remove the connection from the hash table of active connections.  It
+ *   is not an error if the connection was never hashed (for example, a
+ *   listening connection).
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+static void tcp_conn_unhash(FAR struct tcp_conn_s *conn)
+{
+  FAR struct tcp_conn_s **link;
+
+  for (link = &g_tcp_conn_hash[tcp_conn_hashndx(conn)];
+       *link != NULL;
+       link = &(*link)->hashlink)
+    {
+      if (*link == conn)
+        {
+          *link          = conn->hashlink;
+          conn->hashlink = NULL;
+          return;
+        }
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: tcp_ipv4_active
  *
@@ -339,10 +493,21 @@ static inline FAR struct tcp_conn_s *
   in_addr_t srcipaddr;
   in_addr_t destipaddr;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = net_ip4addr_conv32(ip->srcipaddr);
   destipaddr = net_ip4addr_conv32(ip->destipaddr);
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  /* Only the hash bucket matching the 4-tuple of the incoming segment
+   * needs to be searched.  The source of the packet is the remote end of
+   * the connection.
+   */
+
+  conn       = g_tcp_conn_hash[tcp_ipv4_hashndx(srcipaddr, tcp->srcport,
+                                                tcp->destport)];
+#else
+  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
+#endif
+
   while (conn)
     {
       /* Find an open connection matching the TCP input. The following
@@ -363,6 +528,9 @@ static inline FAR struct tcp_conn_s *
        */
 
       if (conn->tcpstateflags != TCP_CLOSED &&
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+          conn->domain  == PF_INET &&
+#endif
           tcp->destport == conn->lport &&
           tcp->srcport  == conn->rport &&
           (net_ipv4addr_cmp(conn->u.ipv4.laddr, INADDR_ANY) ||
@@ -378,7 +546,11 @@ static inline FAR struct tcp_conn_s *
 
       /* Look at the next active connection */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      conn = conn->hashlink;
+#else
       conn = (FAR struct tcp_conn_s *)conn->node.flink;
+#endif
     }
 
   return conn;
@@ -406,10 +578,21 @@ static inline FAR struct tcp_conn_s *
   net_ipv6addr_t *srcipaddr;
   net_ipv6addr_t *destipaddr;
 
-  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
   srcipaddr  = (net_ipv6addr_t *)ip->srcipaddr;
   destipaddr = (net_ipv6addr_t *)ip->destipaddr;
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  /* Only the hash bucket matching the 4-tuple of the incoming segment
+   * needs to be searched.  The source of the packet is the remote end of
+   * the connection.
+   */
+
+  conn       = g_tcp_conn_hash[tcp_ipv6_hashndx(*srcipaddr, tcp->srcport,
+                                                tcp->destport)];
+#else
+  conn       = (FAR struct tcp_conn_s *)g_active_tcp_connections.head;
+#endif
+
   while (conn)
     {
       /* Find an open connection matching the TCP input. The following
@@ -430,6 +613,9 @@ static inline FAR struct tcp_conn_s *
        */
 
       if (conn->tcpstateflags != TCP_CLOSED &&
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+          conn->domain  == PF_INET6 &&
+#endif
           tcp->destport == conn->lport &&
           tcp->srcport  == conn->rport &&
           (net_ipv6addr_cmp(conn->u.ipv6.laddr, g_ipv6_unspecaddr) ||
@@ -445,7 +631,11 @@ static inline FAR struct tcp_conn_s *
 
       /* Look at the next active connection */
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      conn = conn->hashlink;
+#else
       conn = (FAR struct tcp_conn_s *)conn->node.flink;
+#endif
     }
 
   return conn;
@@ -606,6 +796,10 @@ void tcp_initialize(void)
   dq_init(&g_free_tcp_connections);
   dq_init(&g_active_tcp_connections);
 
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  memset(g_tcp_conn_hash, 0, sizeof(g_tcp_conn_hash));
+#endif
+
   /* Now initialize each connection structure */
 
   for (i = 0; i < CONFIG_NET_TCP_CONNS; i++)
@@ -764,6 +958,13 @@ void tcp_free(FAR struct tcp_conn_s *conn)
   DEBUGASSERT(conn->crefs == 0);
   net_lock();
 
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+  /* Stop the per-connection timer */
+
+  wd_cancel(&conn->wdog);
+  conn->wdog_expired = false;
+#endif
+
   /* Free remaining callbacks, actually there should be only the close
    * callback left.
    */
@@ -783,11 +984,20 @@ void tcp_free(FAR struct tcp_conn_s *conn)
       /* Remove the connection from the active list */
 
       dq_rem(&conn->node, &g_active_tcp_connections);
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      /* And from the hash table of active connections */
+
+      tcp_conn_unhash(conn);
+#endif
     }
 
   /* Release any read-ahead buffers attached to the connection */
 
   iob_free_queue(&conn->readahead, IOBUSER_NET_TCP_READAHEAD);
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+  conn->readahead_bytes = 0;
+#endif
 
 #ifdef CONFIG_NET_TCP_WRITE_BUFFERS
   /* Release any write buffers attached to the connection */
@@ -887,6 +1097,65 @@ FAR struct tcp_conn_s *tcp_nextconn(FAR struct tcp_conn_s *conn)
     }
 }
 
+/****************************************************************************
+ * Name: tcp_reclaim_embryonic
+ *
+ * Description:
+ *   Enforce the per-port limit on half-open (SYN_RCVD) connections.  If
+ *   the limit has been reached, then the stalest half-open connection --
+ *   the one that has retransmitted its SYNACK the most -- is reclaimed.
+ *   During a SYN flood the stalest half-open connection is the one most
+ *   likely to be bogus; reclaiming it lets new connection attempts be
+ *   serviced without exhausting the connection table.
+ *
+ * Assumptions:
+ *   This function is called from network logic with the network locked.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NET_TCP_EMBRYONIC_LIMIT > 0
+static void tcp_reclaim_embryonic(uint16_t portno)
+{
+  FAR struct tcp_conn_s *conn = NULL;
+  FAR struct tcp_conn_s *stalest = NULL;
+  int count = 0;
+
+  /* Count the half-open connections on this port, remembering the one
+   * that has been waiting on its handshake the longest.
+   */
+
+  while ((conn = tcp_nextconn(conn)) != NULL)
+    {
+      if ((conn->tcpstateflags & TCP_STATE_MASK) == TCP_SYN_RCVD &&
+          conn->lport == portno)
+        {
+          count++;
+          if (stalest == NULL || conn->nrtx > stalest->nrtx)
+            {
+              stalest = conn;
+            }
+        }
+    }
+
+  if (count >= CONFIG_NET_TCP_EMBRYONIC_LIMIT && stalest != NULL)
+    {
+      ninfo("Reclaiming stale half-open connection %p\n", stalest);
+
+#ifdef CONFIG_NET_STATISTICS
+      g_netstats.tcp.syndrop++;
+#endif
+
+      /* Half-open connections are owned by the network; there is no
+       * socket reference to release.  Free the connection silently:  If
+       * the remote peer is real, then it will retransmit its SYN.
+       */
+
+      stalest->crefs = 0;
+      tcp_free(stalest);
+    }
+}
+#endif /* CONFIG_NET_TCP_EMBRYONIC_LIMIT > 0 */
+
 /****************************************************************************
  * Name: tcp_alloc_accept
  *
@@ -918,6 +1187,14 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
   domain = PF_INET6;
 #endif
 
+#if CONFIG_NET_TCP_EMBRYONIC_LIMIT > 0
+  /* Make room for the new connection attempt if a SYN flood has driven
+   * this port to its half-open connection limit.
+   */
+
+  tcp_reclaim_embryonic(tcp->destport);
+#endif
+
   /* Allocate the connection structure */
 
   conn = tcp_alloc(domain);
@@ -1015,6 +1292,12 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
       conn->rport         = tcp->srcport;
       conn->tcpstateflags = TCP_SYN_RCVD;
 
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+      /* Arm the per-connection timer for the SYNACK retransmission */
+
+      tcp_timer_update(conn);
+#endif
+
       tcp_initsequence(conn->sndseq);
       conn->tx_unacked    = 1;
 #ifdef CONFIG_NET_TCP_WRITE_BUFFERS
@@ -1031,6 +1314,9 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
       /* Initialize the list of TCP read-ahead buffers */
 
       IOB_QINIT(&conn->readahead);
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+      conn->readahead_bytes = 0;
+#endif
 
 #ifdef CONFIG_NET_TCP_WRITE_BUFFERS
       /* Initialize the write buffer lists */
@@ -1044,6 +1330,12 @@ FAR struct tcp_conn_s *tcp_alloc_accept(FAR struct net_driver_s *dev,
        */
 
       dq_addlast(&conn->node, &g_active_tcp_connections);
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+      /* The 4-tuple of the connection is now final; hash it */
+
+      tcp_conn_hash(conn);
+#endif
     }
 
   return conn;
@@ -1294,10 +1586,16 @@ int tcp_connect(FAR struct tcp_conn_s *conn, FAR const struct sockaddr *addr)
   conn->sent       = 0;
   conn->sndseq_max = 0;
 #endif
+#ifdef CONFIG_NET_TCP_FASTOPEN
+  conn->tfo_sndlen = 0;
+#endif
 
   /* Initialize the list of TCP read-ahead buffers */
 
   IOB_QINIT(&conn->readahead);
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+  conn->readahead_bytes = 0;
+#endif
 
 #ifdef CONFIG_NET_TCP_WRITE_BUFFERS
   /* Initialize the TCP write buffer lists */
@@ -1309,6 +1607,19 @@ int tcp_connect(FAR struct tcp_conn_s *conn, FAR const struct sockaddr *addr)
   /* And, finally, put the connection structure into the active list. */
 
   dq_addlast(&conn->node, &g_active_tcp_connections);
+
+#ifdef CONFIG_NET_TCP_CONN_HASH
+  /* The 4-tuple of the connection is now final; hash it */
+
+  tcp_conn_hash(conn);
+#endif
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+  /* Arm the per-connection timer so that the SYN is sent promptly */
+
+  tcp_timer_update(conn);
+#endif
+
   ret = OK;
 
 errout_with_lock:
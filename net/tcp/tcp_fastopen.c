@@ -0,0 +1,375 @@
+/****************************************************************************
+ * net/tcp/tcp_fastopen.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <nuttx/mm/iob.h>
+#include <nuttx/net/netconfig.h>
+#include <nuttx/net/netdev.h>
+#include <nuttx/net/ip.h>
+#include <nuttx/net/tcp.h>
+
+#include "tcp/tcp.h"
+
+#if defined(CONFIG_NET) && defined(CONFIG_NET_TCP_FASTOPEN)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One cached TCP Fast Open cookie (RFC 7413).  The server issues the
+ * cookie in its SYN-ACK; it is presented on the SYN of subsequent
+ * connections to the same peer to authorize data on the SYN.
+ */
+
+struct tcp_tfo_peer_s
+{
+  union ip_addr_u addr;           /* The remote peer address */
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+  uint8_t domain;                 /* IP domain: PF_INET or PF_INET6 */
+#endif
+  uint8_t cookielen;              /* Cookie length; zero if unused */
+  uint8_t cookie[TCP_TFO_MAXCOOKIE];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The cookie cache and the round-robin replacement index */
+
+static struct tcp_tfo_peer_s g_tfo_peers[CONFIG_NET_TCP_FASTOPEN_NPEERS];
+static uint8_t g_tfo_next;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tcp_tfo_match
+ *
+ * Description:
+ *   Check if a cookie cache entry belongs to the remote peer of a
+ *   connection.
+ *
+ * Input Parameters:
+ *   peer - The cookie cache entry to check
+ *   conn - The TCP connection whose remote peer is of interest
+ *
+ * Returned Value:
+ *   True if the entry is in use and matches the peer of the connection.
+ *
+ ****************************************************************************/
+
+static bool tcp_tfo_match(FAR struct tcp_tfo_peer_s *peer,
+                          FAR struct tcp_conn_s *conn)
+{
+  if (peer->cookielen == 0)
+    {
+      return false;
+    }
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  if (conn->domain == PF_INET)
+#endif
+    {
+#ifdef CONFIG_NET_IPv6
+      if (peer->domain != PF_INET)
+        {
+          return false;
+        }
+
+#endif
+      return net_ipv4addr_cmp(peer->addr.ipv4, conn->u.ipv4.raddr);
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  else
+#endif
+    {
+#ifdef CONFIG_NET_IPv4
+      if (peer->domain != PF_INET6)
+        {
+          return false;
+        }
+
+#endif
+      return net_ipv6addr_cmp(peer->addr.ipv6, conn->u.ipv6.raddr);
+    }
+#endif /* CONFIG_NET_IPv6 */
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tcp_tfo_lookup
+ *
+ * Description:
+ *   Look up the cached TCP Fast Open cookie for the remote peer of a
+ *   connection.
+ *
+ * Input Parameters:
+ *   conn      - The TCP connection of interest.  The remote address must
+ *               have been set up (as it is after tcp_connect()).
+ *   cookielen - The location to return the length of the cookie.
+ *
+ * Returned Value:
+ *   A pointer to the cookie, or NULL if no cookie has been cached for
+ *   the peer.
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+FAR const uint8_t *tcp_tfo_lookup(FAR struct tcp_conn_s *conn,
+                                  FAR uint8_t *cookielen)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_NET_TCP_FASTOPEN_NPEERS; i++)
+    {
+      if (tcp_tfo_match(&g_tfo_peers[i], conn))
+        {
+          *cookielen = g_tfo_peers[i].cookielen;
+          return g_tfo_peers[i].cookie;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: tcp_tfo_store
+ *
+ * Description:
+ *   Cache the TCP Fast Open cookie provided by the remote peer of a
+ *   connection (in its SYN-ACK) for use by subsequent connections to the
+ *   same peer.
+ *
+ * Input Parameters:
+ *   conn      - The TCP connection that received the cookie.
+ *   cookie    - The cookie data.
+ *   cookielen - The length of the cookie in bytes.
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+void tcp_tfo_store(FAR struct tcp_conn_s *conn, FAR const uint8_t *cookie,
+                   uint8_t cookielen)
+{
+  FAR struct tcp_tfo_peer_s *peer = NULL;
+  int i;
+
+  DEBUGASSERT(cookielen >= TCP_TFO_MINCOOKIE &&
+              cookielen <= TCP_TFO_MAXCOOKIE);
+
+  /* Is there already an entry for this peer?  If so, the server has issued
+   * a new cookie and the old one must be replaced.
+   */
+
+  for (i = 0; i < CONFIG_NET_TCP_FASTOPEN_NPEERS; i++)
+    {
+      if (tcp_tfo_match(&g_tfo_peers[i], conn))
+        {
+          peer = &g_tfo_peers[i];
+          break;
+        }
+    }
+
+  /* Otherwise, claim the next entry in round-robin order.  The cache is
+   * only an optimization; evicting another peer merely costs that peer
+   * one round trip on its next connection.
+   */
+
+  if (peer == NULL)
+    {
+      peer = &g_tfo_peers[g_tfo_next];
+      if (++g_tfo_next >= CONFIG_NET_TCP_FASTOPEN_NPEERS)
+        {
+          g_tfo_next = 0;
+        }
+    }
+
+#ifdef CONFIG_NET_IPv4
+#ifdef CONFIG_NET_IPv6
+  if (conn->domain == PF_INET)
+#endif
+    {
+      net_ipv4addr_copy(peer->addr.ipv4, conn->u.ipv4.raddr);
+    }
+#endif /* CONFIG_NET_IPv4 */
+
+#ifdef CONFIG_NET_IPv6
+#ifdef CONFIG_NET_IPv4
+  else
+#endif
+    {
+      net_ipv6addr_copy(peer->addr.ipv6, conn->u.ipv6.raddr);
+    }
+#endif /* CONFIG_NET_IPv6 */
+
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+  peer->domain = conn->domain;
+#endif
+
+  memcpy(peer->cookie, cookie, cookielen);
+  peer->cookielen = cookielen;
+
+  ninfo("Cached %u-byte TFO cookie\n", cookielen);
+}
+
+/****************************************************************************
+ * Name: tcp_tfo_synopt
+ *
+ * Description:
+ *   Append the TCP Fast Open option to an outgoing client SYN segment.
+ *   If a cookie has been cached for the peer, then the cookie is sent and
+ *   any application data queued in the write buffers rides on the SYN.
+ *   Otherwise a cookie request is sent so that the next connection to the
+ *   peer can carry data on its SYN.
+ *
+ * Input Parameters:
+ *   dev  - The device driver structure to use in the send operation
+ *   conn - The TCP connection structure holding connection information
+ *   tcp  - A pointer to the TCP header of the SYN being built
+ *
+ * Returned Value:
+ *   None.  dev->d_len and the TCP header length are updated to cover the
+ *   appended option (and data).
+ *
+ * Assumptions:
+ *   The network is locked.  tcp_synack() has initialized the segment with
+ *   the standard SYN options.
+ *
+ ****************************************************************************/
+
+void tcp_tfo_synopt(FAR struct net_driver_s *dev,
+                    FAR struct tcp_conn_s *conn, FAR struct tcp_hdr_s *tcp)
+{
+  FAR struct tcp_wrbuffer_s *wrb;
+  FAR const uint8_t *cookie;
+  unsigned int optlen;
+  unsigned int tfolen;
+  uint8_t cookielen = 0;
+
+  /* Get the length of the options already in the SYN */
+
+  optlen = (((tcp->tcpoffset >> 4) - (TCP_HDRLEN >> 2)) << 2);
+
+  /* Append either the cached cookie for this peer or, if there is none, a
+   * cookie request (an option with an empty cookie).
+   */
+
+  cookie = tcp_tfo_lookup(conn, &cookielen);
+  tfolen = TCP_OPT_TFO_LEN + cookielen;
+
+  tcp->optdata[optlen]     = TCP_OPT_TFO;
+  tcp->optdata[optlen + 1] = tfolen;
+  if (cookie != NULL)
+    {
+      memcpy(&tcp->optdata[optlen + 2], cookie, cookielen);
+    }
+
+  /* Pad the option list to a 32-bit boundary with NOPs */
+
+  while ((tfolen & 3) != 0)
+    {
+      tcp->optdata[optlen + tfolen] = TCP_OPT_NOOP;
+      tfolen++;
+    }
+
+  optlen         += tfolen;
+  tcp->tcpoffset  = ((TCP_HDRLEN + optlen) >> 2) << 4;
+  dev->d_len     += tfolen;
+
+  /* If we hold a cookie for the peer, then application data already queued
+   * in the write buffers may ride on the SYN.  The data is only copied
+   * into the segment here; the write buffer is left on the write queue
+   * untouched.  When the SYN-ACK arrives, psock_send_eventhandler() trims
+   * whatever the server acknowledged; anything else is sent through the
+   * normal data path after the connection is established.
+   */
+
+  conn->tfo_sndlen = 0;
+
+  wrb = (FAR struct tcp_wrbuffer_s *)sq_peek(&conn->write_q);
+  if (cookie != NULL && wrb != NULL && TCP_WBPKTLEN(wrb) > 0)
+    {
+      unsigned int sndlen;
+      unsigned int space;
+
+      /* The SYN data is limited by the MSS (less the SYN options) and by
+       * the space remaining in the device packet buffer.
+       */
+
+      sndlen = TCP_WBPKTLEN(wrb);
+      if (sndlen > conn->mss - optlen)
+        {
+          sndlen = conn->mss - optlen;
+        }
+
+      space = dev->d_pktsize - NET_LL_HDRLEN(dev) - dev->d_len;
+      if (sndlen > space)
+        {
+          sndlen = space;
+        }
+
+      if (sndlen > 0)
+        {
+          iob_copyout((FAR uint8_t *)tcp + TCP_HDRLEN + optlen,
+                      TCP_WBIOB(wrb), sndlen, 0);
+
+          /* Record where the SYN data begins so that the SYN-ACK
+           * processing can determine how much of it was acknowledged.
+           * The SYN itself consumes one sequence number before the data.
+           */
+
+          TCP_WBSEQNO(wrb)  = tcp_getsequence(conn->sndseq) + 1;
+          conn->tfo_sndlen  = sndlen;
+          conn->tx_unacked  = 1 + sndlen;
+          conn->sndseq_max  = TCP_WBSEQNO(wrb) + sndlen;
+          dev->d_len       += sndlen;
+
+          ninfo("%u bytes of data on SYN\n", sndlen);
+        }
+    }
+}
+
+#endif /* CONFIG_NET && CONFIG_NET_TCP_FASTOPEN */
@@ -48,6 +48,7 @@
 #if defined(CONFIG_NET) && defined(CONFIG_NET_TCP)
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <assert.h>
@@ -62,6 +63,9 @@
 #include "devif/devif.h"
 #include "utils/utils.h"
 #include "tcp/tcp.h"
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+#  include "neighbor/neighbor.h"
+#endif
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -73,6 +77,120 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_parse_sack
+ *
+ * Description:
+ *   Refresh the connection's SACK scoreboard from the SACK option of an
+ *   incoming ACK (RFC 2018).  The scoreboard always reflects the most
+ *   recently received SACK option; an ACK without the option clears it.
+ *
+ * Input Parameters:
+ *   conn   - The TCP connection of interest
+ *   dev    - The device driver structure containing the received packet
+ *   tcp    - Header of the received TCP segment
+ *   hdrlen - Offset of the TCP option data in the d_buf
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The network is locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_SACK
+static void tcp_parse_sack(FAR struct tcp_conn_s *conn,
+                           FAR struct net_driver_s *dev,
+                           FAR struct tcp_hdr_s *tcp,
+                           unsigned int hdrlen)
+{
+  unsigned int optend;
+  unsigned int optlen;
+  unsigned int nblocks;
+  unsigned int i;
+  unsigned int j;
+  uint8_t opt;
+
+  conn->nsacked = 0;
+
+  if ((tcp->tcpoffset & 0xf0) <= 0x50)
+    {
+      return;
+    }
+
+  optend = (unsigned int)(((tcp->tcpoffset >> 4) - 5) << 2);
+  for (i = 0; i < optend; )
+    {
+      opt = dev->d_buf[hdrlen + i];
+      if (opt == TCP_OPT_END)
+        {
+          /* End of options. */
+
+          break;
+        }
+      else if (opt == TCP_OPT_NOOP)
+        {
+          /* NOP option. */
+
+          ++i;
+        }
+      else
+        {
+          if (i + 1 >= optend)
+            {
+              /* The length byte would lie outside of the option area. */
+
+              break;
+            }
+
+          optlen = dev->d_buf[hdrlen + 1 + i];
+          if (optlen < 2 || i + optlen > optend)
+            {
+              /* If the length field is zero (or otherwise extends beyond
+               * the option area), the options are malformed and we don't
+               * process them further.
+               */
+
+              break;
+            }
+
+          if (opt == TCP_OPT_SACK && optlen >= 2 + 8)
+            {
+              /* Each SACK block is a pair of 32-bit sequence numbers
+               * bounding one range of data that the peer holds.  The
+               * number of blocks is derived from the option length that
+               * was bounded against the option area above, so the block
+               * reads cannot stray outside of the TCP header.
+               */
+
+              nblocks = (optlen - 2) >> 3;
+              for (j = 0;
+                   j < nblocks &&
+                   conn->nsacked < CONFIG_NET_TCP_SACK_RANGES;
+                   j++)
+                {
+                  FAR uint8_t *blk = &dev->d_buf[hdrlen + 2 + i + (j << 3)];
+                  uint32_t left    = tcp_getsequence(blk);
+                  uint32_t right   = tcp_getsequence(&blk[4]);
+
+                  /* Ignore malformed (empty or inverted) ranges */
+
+                  if (TCP_SEQ_LT(left, right))
+                    {
+                      conn->sacked[conn->nsacked].left  = left;
+                      conn->sacked[conn->nsacked].right = right;
+                      conn->nsacked++;
+                    }
+                }
+            }
+
+          i += optlen;
+        }
+    }
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 /****************************************************************************
  * Name: tcp_input
  *
@@ -132,9 +250,12 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
 
   hdrlen = tcpiplen + NET_LL_HDRLEN(dev);
 
-  /* Start of TCP input header processing code. */
+  /* Start of TCP input header processing code.  The TCP checksum is
+   * verified in software unless the hardware has already done so.
+   */
 
-  if (tcp_chksum(dev) != 0xffff)
+  if (!NETDEV_HAS_CAP(dev, NETDEV_CAP_CSUM_RX) &&
+      tcp_chksum(dev) != 0xffff)
     {
       /* Compute and check the TCP checksum. */
 
@@ -270,10 +391,29 @@ static void tcp_input(FAR struct net_driver_s *dev, uint8_t domain,
                                (uint16_t)dev->d_buf[hdrlen + 3 + i];
                       conn->mss = tmp16 > tcp_mss ? tcp_mss : tmp16;
 
+#ifdef CONFIG_NET_TCP_SACK
+                      /* Keep scanning for the SACK-permitted option. */
+
+                      i += TCP_OPT_MSS_LEN;
+#else
                       /* And we are done processing options. */
 
                       break;
+#endif
+                    }
+#ifdef CONFIG_NET_TCP_SACK
+                  else if (opt == TCP_OPT_SACK_PERM &&
+                           dev->d_buf[hdrlen + 1 + i] ==
+                           TCP_OPT_SACK_PERM_LEN)
+                    {
+                      /* The peer can process SACKs; enable the selective
+                       * retransmission scoreboard for this connection.
+                       */
+
+                      conn->sack_enabled = true;
+                      i += TCP_OPT_SACK_PERM_LEN;
                     }
+#endif
                   else
                     {
                       /* All other options have a length field, so that we
@@ -485,6 +625,17 @@ found:
 
       ackseq = tcp_getsequence(tcp->ackno);
 
+#ifdef CONFIG_NET_TCP_SACK
+      /* Refresh the SACK scoreboard from this ACK so that any subsequent
+       * retransmission can skip data that the peer already holds.
+       */
+
+      if (conn->sack_enabled)
+        {
+          tcp_parse_sack(conn, dev, tcp, hdrlen);
+        }
+#endif
+
       /* Check how many of the outstanding bytes have been acknowledged. For
        * most send operations, this should always be true.  However,
        * the send() API sends data ahead when it can without waiting for
@@ -554,6 +705,22 @@ found:
 
       flags |= TCP_ACKDATA;
 
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR_REFRESH
+      /* Forward progress on the connection is an upper-layer reachability
+       * confirmation for the peer (RFC 4861).  Refresh the Neighbor Table
+       * entry, if any, so that it is not probed or aged out while the
+       * connection is active.  If the peer is reached through a router,
+       * then there is no entry for the peer address and this is a no-op.
+       */
+
+#ifdef CONFIG_NET_IPv4
+      if (conn->domain == PF_INET6)
+#endif
+        {
+          neighbor_update(conn->u.ipv6.raddr);
+        }
+#endif
+
       /* Reset the retransmission timer. */
 
       conn->timer = conn->rto;
@@ -681,10 +848,64 @@ found:
                           dev->d_buf[hdrlen + 3 + i];
                         conn->mss = tmp16 > tcp_mss ? tcp_mss : tmp16;
 
+#if defined(CONFIG_NET_TCP_SACK) || defined(CONFIG_NET_TCP_FASTOPEN)
+                        /* Keep scanning for the other SYN options. */
+
+                        i += TCP_OPT_MSS_LEN;
+#else
                         /* And we are done processing options. */
 
                         break;
+#endif
                       }
+#ifdef CONFIG_NET_TCP_SACK
+                    else if (opt == TCP_OPT_SACK_PERM &&
+                             dev->d_buf[hdrlen + 1 + i] ==
+                             TCP_OPT_SACK_PERM_LEN)
+                      {
+                        /* The peer can process SACKs; enable the selective
+                         * retransmission scoreboard for this connection.
+                         */
+
+                        conn->sack_enabled = true;
+                        i += TCP_OPT_SACK_PERM_LEN;
+                      }
+#endif
+#ifdef CONFIG_NET_TCP_FASTOPEN
+                    else if (opt == TCP_OPT_TFO &&
+                             dev->d_buf[hdrlen + 1 + i] >= TCP_OPT_TFO_LEN)
+                      {
+                        uint8_t tfolen;
+                        uint8_t cookielen;
+
+                        /* The claimed option length must lie within the
+                         * option area or the cookie bytes would be read
+                         * from beyond the TCP header.
+                         */
+
+                        tfolen = dev->d_buf[hdrlen + 1 + i];
+                        if (i + tfolen > (((tcp->tcpoffset >> 4) - 5) << 2))
+                          {
+                            break;
+                          }
+
+                        /* The server granted a Fast Open cookie.  Cache it
+                         * so that the next connection to this peer can
+                         * carry data on its SYN.
+                         */
+
+                        cookielen = tfolen - TCP_OPT_TFO_LEN;
+                        if (cookielen >= TCP_TFO_MINCOOKIE &&
+                            cookielen <= TCP_TFO_MAXCOOKIE)
+                          {
+                            tcp_tfo_store(conn,
+                                          &dev->d_buf[hdrlen + 2 + i],
+                                          cookielen);
+                          }
+
+                        i += tfolen;
+                      }
+#endif
                     else
                       {
                         /* All other options have a length field, so that we
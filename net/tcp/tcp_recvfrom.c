@@ -259,6 +259,15 @@ static inline void tcp_readahead(struct tcp_recvfrom_s *pstate)
 
       tcp_update_recvlen(pstate, recvlen);
 
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+      /* The copied bytes leave the read-ahead queue below, either with the
+       * chain that is freed or when the head of the queue is trimmed.
+       */
+
+      DEBUGASSERT(conn->readahead_bytes >= (uint32_t)recvlen);
+      conn->readahead_bytes -= recvlen;
+#endif
+
       /* If we took all of the data from the I/O buffer chain is empty, then
        * release it.  If there is still data available in the I/O buffer
        * chain, then just trim the data that we have taken from the
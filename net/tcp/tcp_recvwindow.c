@@ -60,17 +60,22 @@
  * Name: tcp_get_recvwindow
  *
  * Description:
- *   Calculate the TCP receive window for the specified device.
+ *   Calculate the TCP receive window for the specified device and
+ *   connection.  If CONFIG_NET_TCP_WINDOW_AUTOTUNE is selected, then the
+ *   returned window is smoothed across calls and clamped to any SO_RCVBUF
+ *   limit that has been set on the connection.
  *
  * Input Parameters:
- *   dev - The device whose TCP receive window will be updated.
+ *   dev  - The device whose TCP receive window will be updated.
+ *   conn - The TCP connection structure holding connection information.
  *
  * Returned Value:
  *   The value of the TCP receive window to use.
  *
  ****************************************************************************/
 
-uint16_t tcp_get_recvwindow(FAR struct net_driver_s *dev)
+uint16_t tcp_get_recvwindow(FAR struct net_driver_s *dev,
+                            FAR struct tcp_conn_s *conn)
 {
   uint16_t iplen;
   uint16_t mss;
@@ -177,5 +182,65 @@ uint16_t tcp_get_recvwindow(FAR struct net_driver_s *dev)
       recvwndo = mss;
     }
 
+#ifdef CONFIG_NET_TCP_READAHEAD_FAIRSHARE
+  /* Never advertise more than the connection's remaining fair share of
+   * the read-ahead memory.  This reduces the window of a hogging bulk
+   * connection early -- before its data must be dropped -- leaving buffer
+   * memory for the other connections.  At least one MSS is always
+   * advertised so that the connection continues to make progress at a
+   * reduced rate.
+   */
+
+    {
+      uint32_t quota = tcp_readahead_quota(conn);
+
+      if (quota < mss)
+        {
+          quota = mss;
+        }
+
+      if (recvwndo > quota)
+        {
+          recvwndo = (uint16_t)quota;
+        }
+    }
+#endif
+
+#ifdef CONFIG_NET_TCP_WINDOW_AUTOTUNE
+  /* Has an upper limit on the receive window been set with SO_RCVBUF? */
+
+  if (conn->rcv_bufsize > 0 && recvwndo > conn->rcv_bufsize)
+    {
+      recvwndo = conn->rcv_bufsize;
+    }
+
+  /* Smooth the rate at which the advertised window grows.  The
+   * instantaneous window computed above swings over the full range as
+   * IOBs are consumed and drained; advertising it directly makes bulk
+   * senders burst against an empty pool and then stall on a tiny window.
+   * Growth is averaged toward the instantaneous value so that the window
+   * re-opens at roughly the rate at which the receiver has demonstrated
+   * it can drain data.  Shrinkage is never smoothed:  We must not
+   * advertise more than we can buffer right now.
+   */
+
+  if (conn->rcv_wnd > 0 && recvwndo > conn->rcv_wnd)
+    {
+      uint32_t tuned;
+
+      tuned = ((uint32_t)conn->rcv_wnd * 3 + recvwndo) >> 2;
+      if (tuned < mss)
+        {
+          tuned = mss;
+        }
+
+      recvwndo = (uint16_t)tuned;
+    }
+
+  conn->rcv_wnd = recvwndo;
+#else
+  UNUSED(conn);
+#endif
+
   return recvwndo;
 }
@@ -147,13 +147,16 @@ static inline void tcp_ipv4_sendcomplete(FAR struct net_driver_s *dev,
   ipv4->len[0]      = (dev->d_len >> 8);
   ipv4->len[1]      = (dev->d_len & 0xff);
 
-  /* Calculate TCP checksum. */
+  /* Calculate TCP checksum (unless the hardware will insert it). */
 
   tcp->urgp[0]      = 0;
   tcp->urgp[1]      = 0;
 
   tcp->tcpchksum    = 0;
-  tcp->tcpchksum    = ~tcp_ipv4_chksum(dev);
+  if (!NETDEV_HAS_CAP(dev, NETDEV_CAP_CSUM_TX))
+    {
+      tcp->tcpchksum = ~tcp_ipv4_chksum(dev);
+    }
 
   /* Finish initializing the IP header and calculate the IP checksum */
 
@@ -165,10 +168,13 @@ static inline void tcp_ipv4_sendcomplete(FAR struct net_driver_s *dev,
   ipv4->ipid[0]     = g_ipid >> 8;
   ipv4->ipid[1]     = g_ipid & 0xff;
 
-  /* Calculate IP checksum. */
+  /* Calculate IP checksum (unless the hardware will insert it). */
 
   ipv4->ipchksum    = 0;
-  ipv4->ipchksum    = ~ipv4_chksum(dev);
+  if (!NETDEV_HAS_CAP(dev, NETDEV_CAP_CSUM_TX))
+    {
+      ipv4->ipchksum = ~ipv4_chksum(dev);
+    }
 
   ninfo("IPv4 length: %d\n", ((int)ipv4->len[0] << 8) + ipv4->len[1]);
 
@@ -219,13 +225,16 @@ static inline void tcp_ipv6_sendcomplete(FAR struct net_driver_s *dev,
   ipv6->len[0]    = (iplen >> 8);
   ipv6->len[1]    = (iplen & 0xff);
 
-  /* Calculate TCP checksum. */
+  /* Calculate TCP checksum (unless the hardware will insert it). */
 
   tcp->urgp[0]     = 0;
   tcp->urgp[1]     = 0;
 
   tcp->tcpchksum   = 0;
-  tcp->tcpchksum   = ~tcp_ipv6_chksum(dev);
+  if (!NETDEV_HAS_CAP(dev, NETDEV_CAP_CSUM_TX))
+    {
+      tcp->tcpchksum = ~tcp_ipv6_chksum(dev);
+    }
 
   /* Finish initializing the IP header (no IPv6 checksum) */
 
@@ -360,7 +369,7 @@ static void tcp_sendcommon(FAR struct net_driver_s *dev,
     {
       /* Update the TCP received window based on I/O buffer availability */
 
-      uint16_t recvwndo = tcp_get_recvwindow(dev);
+      uint16_t recvwndo = tcp_get_recvwindow(dev, conn);
 
       /* Set the TCP Window */
 
@@ -407,6 +416,15 @@ void tcp_send(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
   dev->d_len     = len;
   tcp->tcpoffset = (TCP_HDRLEN / 4) << 4;
   tcp_sendcommon(dev, conn, tcp);
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+  /* Every state transition that requires timing funnels through here or
+   * through tcp_appsend().  Re-arm the per-connection timer to match the
+   * (possibly changed) earliest deadline.
+   */
+
+  tcp_timer_update(conn);
+#endif
 }
 
 /****************************************************************************
@@ -621,6 +639,38 @@ void tcp_synack(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
   tcp->optdata[3] = tcp_mss & 0xff;
   tcp->tcpoffset  = ((TCP_HDRLEN + TCP_OPT_MSS_LEN) / 4) << 4;
 
+#ifdef CONFIG_NET_TCP_SACK
+  /* Offer to accept SACKs in the SYN and SYN-ACK segments (RFC 2018
+   * permits the SACK-permitted option only in segments with the SYN flag
+   * set).  Two NOPs align the two-byte option on a 32-bit boundary.  The
+   * SACK scoreboard is enabled only if the peer offers the option as
+   * well.
+   */
+
+  if ((ack & TCP_SYN) != 0)
+    {
+      tcp->optdata[4] = TCP_OPT_NOOP;
+      tcp->optdata[5] = TCP_OPT_NOOP;
+      tcp->optdata[6] = TCP_OPT_SACK_PERM;
+      tcp->optdata[7] = TCP_OPT_SACK_PERM_LEN;
+      tcp->tcpoffset  = ((TCP_HDRLEN + TCP_OPT_MSS_LEN + 4) / 4) << 4;
+      dev->d_len     += 4;
+    }
+#endif
+
+#ifdef CONFIG_NET_TCP_FASTOPEN
+  /* A client SYN carries the TCP Fast Open option (RFC 7413):  Either the
+   * cached cookie for this peer, in which case queued application data may
+   * ride on the SYN, or a cookie request so that the next connection to
+   * the peer can do so.
+   */
+
+  if (ack == TCP_SYN)
+    {
+      tcp_tfo_synopt(dev, conn, tcp);
+    }
+#endif
+
   /* Complete the common portions of the TCP message */
 
   tcp_sendcommon(dev, conn, tcp);
@@ -159,6 +159,48 @@ static void psock_insert_segment(FAR struct tcp_wrbuffer_s *wrb,
     }
 }
 
+/****************************************************************************
+ * Name: psock_wrbuffer_sacked
+ *
+ * Description:
+ *   Check if the entire sequence range held by a write buffer has been
+ *   selectively acknowledged by the peer.  Such a write buffer need not
+ *   be retransmitted; the peer already holds the data and is waiting only
+ *   for the missing segments before it advances the cumulative ACK.
+ *
+ * Input Parameters:
+ *   conn  The connection whose SACK scoreboard is to be consulted
+ *   wrb   The write buffer to be checked
+ *
+ * Returned Value:
+ *   true if the write buffer lies entirely within a SACKed range
+ *
+ * Assumptions:
+ *   The network is locked
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_SACK
+static bool psock_wrbuffer_sacked(FAR struct tcp_conn_s *conn,
+                                  FAR struct tcp_wrbuffer_s *wrb)
+{
+  uint32_t left  = TCP_WBSEQNO(wrb);
+  uint32_t right = left + TCP_WBPKTLEN(wrb);
+  int i;
+
+  for (i = 0; i < conn->nsacked; i++)
+    {
+      if (TCP_SEQ_GTE(left, conn->sacked[i].left) &&
+          TCP_SEQ_LTE(right, conn->sacked[i].right))
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+#endif
+
 /****************************************************************************
  * Name: psock_writebuffer_notify
  *
@@ -321,7 +363,7 @@ static inline void send_ipselect(FAR struct net_driver_s *dev,
  *
  ****************************************************************************/
 
-static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
+uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
                                         FAR void *pvconn, FAR void *pvpriv,
                                         uint16_t flags)
 {
@@ -364,6 +406,56 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
 
   ninfo("flags: %04x\n", flags);
 
+#ifdef CONFIG_NET_TCP_FASTOPEN
+  /* When the connection is established after a SYN that carried Fast Open
+   * data, trim from the head write buffer whatever the server has
+   * acknowledged in its SYN-ACK.  Anything the server did not accept is
+   * left in the write queue and will be sent through the normal data path
+   * below.
+   */
+
+  if ((flags & TCP_CONNECTED) != 0 && conn->tfo_sndlen > 0)
+    {
+      FAR struct tcp_wrbuffer_s *wrb;
+
+      wrb = (FAR struct tcp_wrbuffer_s *)sq_peek(&conn->write_q);
+      if (wrb != NULL)
+        {
+          uint32_t acked;
+
+          /* conn->sndseq now holds the SYN-ACK acknowledgment number and
+           * TCP_WBSEQNO() was set to the sequence number of the first data
+           * byte on the SYN.
+           */
+
+          acked = tcp_getsequence(conn->sndseq) - TCP_WBSEQNO(wrb);
+          if (acked > conn->tfo_sndlen)
+            {
+              acked = conn->tfo_sndlen;
+            }
+
+          ninfo("TFO: %" PRIu32 " of %u SYN data bytes acked\n",
+                acked, conn->tfo_sndlen);
+
+          if (acked >= TCP_WBPKTLEN(wrb))
+            {
+              /* The entire write buffer rode on the SYN and was accepted */
+
+              sq_remfirst(&conn->write_q);
+              tcp_wrbuffer_release(wrb);
+              psock_writebuffer_notify(conn);
+            }
+          else if (acked > 0)
+            {
+              TCP_WBTRIM(wrb, acked);
+              TCP_WBSEQNO(wrb) += acked;
+            }
+        }
+
+      conn->tfo_sndlen = 0;
+    }
+#endif
+
   /* If this packet contains an acknowledgment, then update the count of
    * acknowledged bytes.
    */
@@ -527,6 +619,11 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
     {
       FAR struct tcp_wrbuffer_s *wrb;
       FAR sq_entry_t *entry;
+#ifdef CONFIG_NET_TCP_SACK
+      sq_queue_t sacked_q;
+
+      sq_init(&sacked_q);
+#endif
 
       ninfo("REXMIT: %04x\n", flags);
 
@@ -617,6 +714,21 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
           wrb = (FAR struct tcp_wrbuffer_s *)entry;
           uint16_t sent;
 
+#ifdef CONFIG_NET_TCP_SACK
+          /* If the peer has selectively acknowledged the entire write
+           * buffer, then it need not be retransmitted.  Set it aside; it
+           * will be returned to the unacked_q below to await the advance
+           * of the cumulative ACK.
+           */
+
+          if (psock_wrbuffer_sacked(conn, wrb))
+            {
+              ninfo("REXMIT: wrb=%p is SACKed, do not retransmit\n", wrb);
+              sq_addfirst(entry, &sacked_q);
+              continue;
+            }
+#endif
+
           /* Reset the number of bytes sent sent from the write buffer */
 
           sent = TCP_WBSENT(wrb);
@@ -684,6 +796,19 @@ static uint16_t psock_send_eventhandler(FAR struct net_driver_s *dev,
               psock_insert_segment(wrb, &conn->write_q);
             }
         }
+
+#ifdef CONFIG_NET_TCP_SACK
+      /* Return any SACKed write buffers to the unacked_q (in sequence
+       * number order) where they will wait for the cumulative ACK to
+       * advance past them.
+       */
+
+      while ((entry = sq_remfirst(&sacked_q)) != NULL)
+        {
+          psock_insert_segment((FAR struct tcp_wrbuffer_s *)entry,
+                               &conn->unacked_q);
+        }
+#endif
     }
 
   /* Check if the outgoing packet is available (it may have been claimed
@@ -969,9 +1094,21 @@ ssize_t psock_tcp_send(FAR struct socket *psock, FAR const void *buf,
 
   if (psock->s_type != SOCK_STREAM || !_SS_ISCONNECTED(psock->s_flags))
     {
-      nerr("ERROR: Not connected\n");
-      ret = -ENOTCONN;
-      goto errout;
+#ifdef CONFIG_NET_TCP_FASTOPEN
+      /* With TCP Fast Open, data may be queued while the three-way
+       * handshake is still in progress.  If a cookie for the peer has
+       * been cached, the data will ride on the SYN.
+       */
+
+      conn = (FAR struct tcp_conn_s *)psock->s_conn;
+      if (psock->s_type != SOCK_STREAM || conn == NULL ||
+          (conn->tcpstateflags & TCP_STATE_MASK) != TCP_SYN_SENT)
+#endif
+        {
+          nerr("ERROR: Not connected\n");
+          ret = -ENOTCONN;
+          goto errout;
+        }
     }
 
   /* Make sure that we have the IP address mapping */
@@ -1025,6 +1162,56 @@ ssize_t psock_tcp_send(FAR struct socket *psock, FAR const void *buf,
        */
 
       net_lock();
+
+#ifdef CONFIG_NET_TCP_WRBUFFER_COALESCE
+      /* Small writes are appended to the last queued write buffer provided
+       * that the send logic has not yet touched it:  No sequence number
+       * has been assigned, nothing has been sent and there have been no
+       * retransmissions.  The combined segment is capped at the connection
+       * MSS so that a train of small writes goes onto the wire as one
+       * full-sized segment instead of one segment per write.
+       *
+       * The copy must not wait for IOBs here:  If the network lock were
+       * broken to wait, then the send logic could begin transmitting the
+       * very buffer being extended.  If the data cannot be appended
+       * without waiting, any partial progress is trimmed off and the
+       * normal write buffer allocation below takes over.
+       */
+
+      wrb = (FAR struct tcp_wrbuffer_s *)conn->write_q.tail;
+      if (wrb != NULL && TCP_WBSEQNO(wrb) == (unsigned)-1 &&
+          TCP_WBSENT(wrb) == 0 && TCP_WBNRTX(wrb) == 0 &&
+          TCP_WBPKTLEN(wrb) > 0 && TCP_WBPKTLEN(wrb) + len <= conn->mss)
+        {
+          unsigned int offset = TCP_WBPKTLEN(wrb);
+
+          if (TCP_WBTRYAPPEND(wrb, (FAR uint8_t *)buf, len, offset) >= 0)
+            {
+              /* The entire write was coalesced into the queued segment */
+
+              ninfo("Coalesced %zu bytes into WRB=%p pktlen=%u\n",
+                    len, wrb, TCP_WBPKTLEN(wrb));
+
+              /* Notify the device driver of the availability of TX data */
+
+              send_txnotify(psock, conn);
+              net_unlock();
+              return len;
+            }
+
+          /* The append failed for lack of IOBs.  Remove any partially
+           * appended data and continue with a separate write buffer.
+           */
+
+          if (TCP_WBPKTLEN(wrb) > offset)
+            {
+              wrb->wb_iob = iob_trimtail(wrb->wb_iob,
+                                         TCP_WBPKTLEN(wrb) - offset,
+                                         IOBUSER_NET_TCP_WRITEBUFFER);
+            }
+        }
+#endif
+
       if (nonblock)
         {
           wrb = tcp_wrbuffer_tryalloc();
@@ -1065,6 +1252,13 @@ ssize_t psock_tcp_send(FAR struct socket *psock, FAR const void *buf,
 
       psock->s_sndcb->flags = (TCP_ACKDATA | TCP_REXMIT | TCP_POLL |
                                TCP_DISCONN_EVENTS);
+#ifdef CONFIG_NET_TCP_FASTOPEN
+      /* The connection event is needed to account for any data that rode
+       * on the SYN.
+       */
+
+      psock->s_sndcb->flags |= TCP_CONNECTED;
+#endif
       psock->s_sndcb->priv  = (FAR void *)psock;
       psock->s_sndcb->event = psock_send_eventhandler;
 
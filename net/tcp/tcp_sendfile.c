@@ -57,6 +57,7 @@
 
 #include <arch/irq.h>
 #include <nuttx/semaphore.h>
+#include <nuttx/mm/iob.h>
 #include <nuttx/fs/fs.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
@@ -89,6 +90,7 @@
  * Private Types
  ****************************************************************************/
 
+#ifndef CONFIG_NET_TCP_WRITE_BUFFERS
 /* This structure holds the state of the send operation until it can be
  * operated upon from the driver poll event.
  */
@@ -377,6 +379,8 @@ wait:
   return flags;
 }
 
+#endif /* !CONFIG_NET_TCP_WRITE_BUFFERS */
+
 /****************************************************************************
  * Name: sendfile_txnotify
  *
@@ -424,6 +428,109 @@ static inline void sendfile_txnotify(FAR struct socket *psock,
 #endif /* CONFIG_NET_IPv6 */
 }
 
+/****************************************************************************
+ * Name: sendfile_copyin
+ *
+ * Description:
+ *   Read up to len bytes from the input file directly into the I/O buffer
+ *   chain of a TCP write buffer, extending the chain as necessary.  There
+ *   is no intermediate copy through a bounce buffer:  The file system
+ *   writes straight into the I/O buffer memory that the write-buffering
+ *   logic will hand to the device driver.
+ *
+ * Input Parameters:
+ *   wrb      - The TCP write buffer whose I/O buffer chain is to be filled
+ *   infile   - File structure of the input file
+ *   len      - The maximum number of bytes to read
+ *   nonblock - True: do not wait for I/O buffers to become available
+ *
+ * Returned Value:
+ *   The non-negative number of bytes read into the chain (zero means end
+ *   of file); a negated errno value on failure with nothing read.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_WRITE_BUFFERS
+static ssize_t sendfile_copyin(FAR struct tcp_wrbuffer_s *wrb,
+                               FAR struct file *infile, size_t len,
+                               bool nonblock)
+{
+  FAR struct iob_s *head = TCP_WBIOB(wrb);
+  FAR struct iob_s *iob = head;
+  ssize_t total = 0;
+  ssize_t nread;
+  unsigned int space;
+
+  /* Find the tail of the I/O buffer chain */
+
+  while (iob->io_flink != NULL)
+    {
+      iob = iob->io_flink;
+    }
+
+  while (len > 0)
+    {
+      /* How much room is there in the tail I/O buffer? */
+
+      space = CONFIG_IOB_BUFSIZE - (iob->io_offset + iob->io_len);
+      if (space == 0)
+        {
+          FAR struct iob_s *next;
+
+          /* None.. extend the chain.  Use a throttled allocation so that
+           * write buffering cannot starve the network read path of IOBs.
+           */
+
+          if (nonblock)
+            {
+              next = iob_tryalloc(true, IOBUSER_NET_TCP_WRITEBUFFER);
+            }
+          else
+            {
+              next = iob_alloc(true, IOBUSER_NET_TCP_WRITEBUFFER);
+            }
+
+          if (next == NULL)
+            {
+              break;
+            }
+
+          iob->io_flink = next;
+          iob           = next;
+          space         = CONFIG_IOB_BUFSIZE;
+        }
+
+      if (space > len)
+        {
+          space = len;
+        }
+
+      /* Read the file data directly into the I/O buffer */
+
+      nread = file_read(infile,
+                        &iob->io_data[iob->io_offset + iob->io_len],
+                        space);
+      if (nread < 0)
+        {
+          return total > 0 ? total : nread;
+        }
+      else if (nread == 0)
+        {
+          /* End of file */
+
+          break;
+        }
+
+      iob->io_len     += nread;
+      head->io_pktlen += nread;
+      total           += nread;
+      len             -= nread;
+    }
+
+  return total;
+}
+#endif /* CONFIG_NET_TCP_WRITE_BUFFERS */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -448,6 +555,201 @@ static inline void sendfile_txnotify(FAR struct socket *psock,
  *
  ****************************************************************************/
 
+#ifdef CONFIG_NET_TCP_WRITE_BUFFERS
+ssize_t tcp_sendfile(FAR struct socket *psock, FAR struct file *infile,
+                      FAR off_t *offset, size_t count)
+{
+  FAR struct tcp_conn_s *conn;
+  FAR struct tcp_wrbuffer_s *wrb;
+  bool nonblock;
+  ssize_t total = 0;
+  ssize_t nread;
+  int ret = OK;
+
+  /* If this is an un-connected socket, then return ENOTCONN */
+
+  if (psock->s_type != SOCK_STREAM || !_SS_ISCONNECTED(psock->s_flags))
+    {
+      nerr("ERROR: Not connected\n");
+      return -ENOTCONN;
+    }
+
+  /* Make sure that we have the IP address mapping */
+
+  conn = (FAR struct tcp_conn_s *)psock->s_conn;
+  DEBUGASSERT(conn != NULL);
+
+#if defined(CONFIG_NET_ARP_SEND) || defined(CONFIG_NET_ICMPv6_NEIGHBOR)
+#ifdef CONFIG_NET_ARP_SEND
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR
+  if (psock->s_domain == PF_INET)
+#endif
+    {
+      /* Make sure that the IP address mapping is in the ARP table */
+
+      ret = arp_send(conn->u.ipv4.raddr);
+    }
+#endif /* CONFIG_NET_ARP_SEND */
+#ifdef CONFIG_NET_ICMPv6_NEIGHBOR
+#ifdef CONFIG_NET_ARP_SEND
+  else
+#endif
+    {
+      /* Make sure that the IP address mapping is in the Neighbor Table */
+
+      ret = icmpv6_neighbor(conn->u.ipv6.raddr);
+    }
+#endif /* CONFIG_NET_ICMPv6_NEIGHBOR */
+
+  /* Did we successfully get the address mapping? */
+
+  if (ret < 0)
+    {
+      nerr("ERROR: Not reachable\n");
+      return -ENETUNREACH;
+    }
+#endif /* CONFIG_NET_ARP_SEND || CONFIG_NET_ICMPv6_NEIGHBOR */
+
+  nonblock = _SS_ISNONBLOCK(psock->s_flags);
+
+  /* Position the input file at the caller's offset (if any) */
+
+  if (offset != NULL)
+    {
+      ret = (int)file_seek(infile, *offset, SEEK_SET);
+      if (ret < 0)
+        {
+          nerr("ERROR: Failed to lseek: %d\n", ret);
+          return ret;
+        }
+
+      ret = OK;
+    }
+
+  /* Read the file into TCP write buffers and queue them for transmission.
+   * The file data goes directly into the I/O buffer chains that the
+   * write-buffering event handler will pass to the device driver; there
+   * is no per-packet bounce buffer and no wait for each segment to be
+   * acknowledged before the next is read.
+   */
+
+  while (total < (ssize_t)count)
+    {
+      size_t chunk = count - total;
+
+      /* Allocate a write buffer.  This may block unless the socket is
+       * non-blocking.
+       */
+
+      if (nonblock)
+        {
+          wrb = tcp_wrbuffer_tryalloc();
+        }
+      else
+        {
+          wrb = tcp_wrbuffer_alloc();
+        }
+
+      if (wrb == NULL)
+        {
+          ret = nonblock ? -EAGAIN : -ENOMEM;
+          break;
+        }
+
+      /* Limit each write buffer to roughly one MSS so that the send logic
+       * can map buffers to segments without re-chunking.
+       */
+
+      if (chunk > conn->mss)
+        {
+          chunk = conn->mss;
+        }
+
+      nread = sendfile_copyin(wrb, infile, chunk, nonblock);
+      if (nread <= 0)
+        {
+          /* Error or end of file with nothing buffered */
+
+          tcp_wrbuffer_release(wrb);
+          if (nread < 0)
+            {
+              ret = nread;
+            }
+
+          break;
+        }
+
+      net_lock();
+
+      /* The connection could have been lost while we were reading from
+       * the file.
+       */
+
+      if (!_SS_ISCONNECTED(psock->s_flags))
+        {
+          net_unlock();
+          tcp_wrbuffer_release(wrb);
+          ret = -ENOTCONN;
+          break;
+        }
+
+      /* Allocate resources to receive a callback (only once; the callback
+       * remains in place and is shared with psock_tcp_send()).
+       */
+
+      if (psock->s_sndcb == NULL)
+        {
+          psock->s_sndcb = tcp_callback_alloc(conn);
+          if (psock->s_sndcb == NULL)
+            {
+              net_unlock();
+              tcp_wrbuffer_release(wrb);
+              ret = -ENOMEM;
+              break;
+            }
+        }
+
+      /* Set up the callback in the connection */
+
+      psock->s_sndcb->flags = (TCP_ACKDATA | TCP_REXMIT | TCP_POLL |
+                               TCP_DISCONN_EVENTS);
+      psock->s_sndcb->priv  = (FAR void *)psock;
+      psock->s_sndcb->event = psock_send_eventhandler;
+
+      /* Initialize the write buffer and enqueue it for transmission */
+
+      TCP_WBSEQNO(wrb) = (unsigned)-1;
+      TCP_WBNRTX(wrb)  = 0;
+
+      sq_addlast(&wrb->wb_node, &conn->write_q);
+      ninfo("Queued %zd bytes, wrb=%p pktlen=%u\n",
+            nread, wrb, TCP_WBPKTLEN(wrb));
+
+      /* Notify the device driver of the availability of TX data */
+
+      sendfile_txnotify(psock, conn);
+      net_unlock();
+
+      total += nread;
+
+      if (nread < (ssize_t)chunk)
+        {
+          /* Short read: end of file */
+
+          break;
+        }
+    }
+
+  if (offset != NULL)
+    {
+      *offset += total;
+    }
+
+  return total > 0 ? total : ret;
+}
+
+#else /* CONFIG_NET_TCP_WRITE_BUFFERS */
+
 ssize_t tcp_sendfile(FAR struct socket *psock, FAR struct file *infile,
                       FAR off_t *offset, size_t count)
 {
@@ -597,4 +899,5 @@ errout_locked:
     }
 }
 
+#endif /* CONFIG_NET_TCP_WRITE_BUFFERS */
 #endif /* CONFIG_NET_SENDFILE && CONFIG_NET_TCP && NET_TCP_HAVE_STACK */
@@ -142,6 +142,12 @@ int tcp_setsockopt(FAR struct socket *psock, int option,
               {
                 conn->keepalive = (bool)keepalive;
                 conn->keeptime  = clock_systime_ticks();   /* Reset start time */
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+                /* Schedule (or cancel) the keepalive probe timer */
+
+                tcp_timer_update(conn);
+#endif
                 ret = OK;
               }
           }
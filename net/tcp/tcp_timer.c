@@ -50,6 +50,11 @@
 #include <assert.h>
 #include <debug.h>
 
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+#  include <nuttx/clock.h>
+#  include <nuttx/wdog.h>
+#endif
+
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/net.h>
 #include <nuttx/net/netdev.h>
@@ -57,6 +62,7 @@
 #include <nuttx/net/tcp.h>
 
 #include "devif/devif.h"
+#include "netdev/netdev.h"
 #include "socket/socket.h"
 #include "tcp/tcp.h"
 
@@ -74,10 +80,160 @@
 
 #define ACK_DELAY (1)
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: tcp_timer_expiry
+ *
+ * Description:
+ *   The per-connection watchdog timer has expired.  Mark the connection
+ *   so that the next poll performs its timer processing and kick the
+ *   bound network device so that the poll happens promptly rather than
+ *   at the next periodic interval.
+ *
+ * Assumptions:
+ *   Runs in the context of the timer interrupt handler.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+static void tcp_timer_expiry(wdparm_t arg)
+{
+  FAR struct tcp_conn_s *conn = (FAR struct tcp_conn_s *)arg;
+
+  conn->wdog_expired = true;
+  if (conn->dev != NULL)
+    {
+      netdev_txnotify_dev(conn->dev);
+    }
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: tcp_timer_update
+ *
+ * Description:
+ *   Re-arm (or cancel) the per-connection watchdog timer to match the
+ *   earliest pending deadline of the connection.  If the connection has
+ *   no pending deadline, then the watchdog is stopped and the idle
+ *   connection incurs no timer processing at all.
+ *
+ * Input Parameters:
+ *   conn - The TCP connection of interest
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   Called from network stack logic with the network stack locked
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+void tcp_timer_update(FAR struct tcp_conn_s *conn)
+{
+  unsigned int hsec = 0;
+  uint8_t state = conn->tcpstateflags & TCP_STATE_MASK;
+
+  /* A closed or unused connection has no deadlines at all */
+
+  if (state == TCP_CLOSED || state == TCP_ALLOCATED)
+    {
+      wd_cancel(&conn->wdog);
+      conn->wdog_expired = false;
+      return;
+    }
+
+  if (state == TCP_TIME_WAIT || state == TCP_FIN_WAIT_2)
+    {
+      /* conn->timer counts up toward the 2MSL timeout in these states */
+
+      unsigned int limit = TCP_TIME_WAIT_TIMEOUT * HSEC_PER_SEC;
+
+      hsec = conn->timer < limit ? limit - conn->timer : 1;
+    }
+  else if (conn->tx_unacked > 0)
+    {
+      /* conn->timer holds the half-seconds remaining until the
+       * retransmission timeout.
+       */
+
+      hsec = conn->timer > 0 ? conn->timer : 1;
+    }
+  else if (state == TCP_ESTABLISHED)
+    {
+#ifdef CONFIG_NET_TCP_KEEPALIVE
+      if (conn->keepalive)
+        {
+          /* The next probe is due timeo after the last activity (or after
+           * the previous probe if retries are in progress).
+           */
+
+          socktimeo_t timeo;
+          sclock_t remaining;
+
+          if (conn->keepretries > 0)
+            {
+              timeo = (socktimeo_t)conn->keepintvl;
+            }
+          else
+            {
+              timeo = (socktimeo_t)conn->keepidle;
+            }
+
+          remaining = (sclock_t)(conn->keeptime + DSEC2TICK(timeo) -
+                                 clock_systime_ticks());
+          hsec = remaining > 0 ? TICK2HSEC(remaining) : 0;
+          if (hsec < 1)
+            {
+              hsec = 1;
+            }
+        }
+#endif
+
+#ifdef CONFIG_NET_TCP_DELAYED_ACK
+      if (conn->rx_unackseg > 0)
+        {
+          unsigned int ackhsec;
+
+          ackhsec = conn->rx_acktimer < ACK_DELAY ?
+                    ACK_DELAY - conn->rx_acktimer : 1;
+          if (hsec == 0 || ackhsec < hsec)
+            {
+              hsec = ackhsec;
+            }
+        }
+#endif
+    }
+
+  if (hsec > 0)
+    {
+      if (hsec > UINT16_MAX)
+        {
+          hsec = UINT16_MAX;
+        }
+
+      conn->wdog_hsec = (uint16_t)hsec;
+      wd_start(&conn->wdog, HSEC2TICK((int32_t)hsec),
+               tcp_timer_expiry, (wdparm_t)conn);
+    }
+  else
+    {
+      /* The connection is idle:  No retransmissions pending, no probes
+       * or delayed ACKs due.  Stop the watchdog entirely.
+       */
+
+      wd_cancel(&conn->wdog);
+    }
+}
+#endif /* CONFIG_NET_TCP_PERCONN_TIMERS */
+
 /****************************************************************************
  * Name: tcp_timer
  *
@@ -527,6 +683,14 @@ void tcp_timer(FAR struct net_driver_s *dev, FAR struct tcp_conn_s *conn,
   dev->d_len = 0;
 
 done:
+#ifdef CONFIG_NET_TCP_PERCONN_TIMERS
+  /* Re-arm the watchdog for the next deadline of the connection.  If the
+   * connection was freed above, then its state is TCP_CLOSED and the
+   * watchdog is simply cancelled.
+   */
+
+  tcp_timer_update(conn);
+#endif
   return;
 }
 
@@ -53,6 +53,10 @@
 #  include <nuttx/wqueue.h>
 #endif
 
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+#  include <nuttx/semaphore.h>
+#endif
+
 #if defined(CONFIG_NET_UDP) && !defined(CONFIG_NET_UDP_NO_STACK)
 
 /****************************************************************************
@@ -85,6 +89,18 @@
 
 #define _UDP_ISCONNECTMODE(f) (((f) & _UDP_FLAG_CONNECTMODE) != 0)
 
+#ifdef CONFIG_NET_TIMESTAMP
+/* Each buffered read-ahead datagram is prefixed by a single byte holding
+ * the size of the source address that follows it.  The MSB of that byte
+ * flags the presence of a struct timeval receipt timestamp between the
+ * source address and the datagram payload (the size of any sockaddr is
+ * well below 128 bytes).
+ */
+
+#  define UDP_RAH_TIMESTAMP   0x80 /* Receipt timestamp follows the address */
+#  define UDP_RAH_SIZEMASK    0x7f /* Mask for the source address size */
+#endif
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
@@ -115,6 +131,14 @@ struct udp_conn_s
 
   dq_entry_t node;        /* Supports a doubly linked list */
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* Implements a singly linked hash bucket chain for fast lookup of the
+   * connection matching an incoming datagram.
+   */
+
+  FAR struct udp_conn_s *hashlink;
+#endif
+
   /* This is a list of UDP connection callbacks.  Each callback represents
    * a thread that is stalled, waiting for a device-specific event.
    */
@@ -131,6 +155,13 @@ struct udp_conn_s
   uint8_t  ttl;           /* Default time-to-live */
   uint8_t  crefs;         /* Reference counts on this instance */
 
+#ifdef CONFIG_NET_TIMESTAMP
+  uint8_t  timestamp;     /* SO_TIMESTAMP: capture the receipt time of each
+                           * incoming datagram (shadows s_timestamp in the
+                           * socket structure, which is not visible to the
+                           * read-ahead logic) */
+#endif
+
 #ifdef CONFIG_NET_UDP_BINDTODEVICE
   uint8_t  boundto;       /* Index of the interface we are bound to.
                            * Unbound: 0, Bound: 1-MAX_IFINDEX */
@@ -166,12 +197,30 @@ struct udp_conn_s
  * for a IOB list and associated destination address.
  */
 
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+/* This structure supports the completion handshake between a blocked
+ * zero-copy sender and the device poll that consumes its payload.  It
+ * lives on the stack of the blocked sender.
+ */
+
+struct udp_zcwait_s
+{
+  sem_t wz_sem;                    /* Posted when the payload is consumed */
+  int wz_result;                   /* OK or a negated errno value */
+};
+#endif
+
 #ifdef CONFIG_NET_UDP_WRITE_BUFFERS
 struct udp_wrbuffer_s
 {
   sq_entry_t wb_node;              /* Supports a singly linked list */
   struct sockaddr_storage wb_dest; /* Destination address */
   struct iob_s *wb_iob;            /* Head of the I/O buffer chain */
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+  FAR struct udp_zcwait_s *wb_zcwait; /* Non-NULL only for zero-copy sends */
+  FAR const uint8_t *wb_zcbuf;     /* The caller-owned payload */
+  uint16_t wb_zclen;               /* Length of the caller-owned payload */
+#endif
 };
 #endif
 
@@ -661,6 +710,33 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
                            size_t len, int flags, FAR struct sockaddr *from,
                            FAR socklen_t *fromlen);
 
+/****************************************************************************
+ * Name: psock_udp_recvmsg
+ *
+ * Description:
+ *   Perform the recvmsg operation for a UDP SOCK_DGRAM socket.  This
+ *   differs from psock_udp_recvfrom() in that the receipt time of the
+ *   datagram is returned as ancillary data if the SO_TIMESTAMP option has
+ *   been selected for the socket.
+ *
+ * Input Parameters:
+ *   psock  Pointer to the socket structure for the SOCK_DGRAM socket
+ *   msg    Message header describing the user and control buffers
+ *   flags  Receive flags
+ *
+ * Returned Value:
+ *   On success, returns the number of characters received.  On  error,
+ *   -errno is returned (see recvmsg for list of errnos).
+ *
+ * Assumptions:
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TIMESTAMP
+ssize_t psock_udp_recvmsg(FAR struct socket *psock, FAR struct msghdr *msg,
+                          int flags);
+#endif
+
 /****************************************************************************
  * Name: psock_udp_sendto
  *
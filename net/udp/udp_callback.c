@@ -44,6 +44,11 @@
 #include <string.h>
 #include <debug.h>
 
+#ifdef CONFIG_NET_TIMESTAMP
+#  include <sys/time.h>
+#  include <nuttx/clock.h>
+#endif
+
 #include <nuttx/net/netconfig.h>
 #include <nuttx/net/netdev.h>
 #include <nuttx/net/netstats.h>
@@ -97,6 +102,11 @@ static uint16_t udp_datahandler(FAR struct net_driver_s *dev,
 
   FAR void  *src_addr;
   uint8_t src_addr_size;
+  uint16_t offset;
+#ifdef CONFIG_NET_TIMESTAMP
+  struct timespec ts;
+  struct timeval tv;
+#endif
 
   /* Allocate on I/O buffer to start the chain (throttling as necessary).
    * We will not wait for an I/O buffer to become available in this context.
@@ -173,6 +183,21 @@ static uint16_t udp_datahandler(FAR struct net_driver_s *dev,
     }
 #endif /* CONFIG_NET_IPv4 */
 
+#ifdef CONFIG_NET_TIMESTAMP
+  /* If the SO_TIMESTAMP option has been selected for this connection, then
+   * capture the receipt time of the datagram now and flag its presence in
+   * the MSB of the source address size.
+   */
+
+  if (conn->timestamp)
+    {
+      clock_systime_timespec(&ts);
+      tv.tv_sec      = ts.tv_sec;
+      tv.tv_usec     = ts.tv_nsec / 1000;
+      src_addr_size |= UDP_RAH_TIMESTAMP;
+    }
+#endif
+
   /* Copy the src address info into the I/O buffer chain.  We will not wait
    * for an I/O buffer to become available in this context.  It there is
    * any failure to allocated, the entire I/O buffer chain will be discarded.
@@ -191,6 +216,10 @@ static uint16_t udp_datahandler(FAR struct net_driver_s *dev,
       return 0;
     }
 
+#ifdef CONFIG_NET_TIMESTAMP
+  src_addr_size &= UDP_RAH_SIZEMASK;
+#endif
+
   ret = iob_trycopyin(iob, (FAR const uint8_t *)src_addr, src_addr_size,
                       sizeof(uint8_t), true, IOBUSER_NET_UDP_READAHEAD);
   if (ret < 0)
@@ -204,12 +233,33 @@ static uint16_t udp_datahandler(FAR struct net_driver_s *dev,
       return 0;
     }
 
+  offset = src_addr_size + sizeof(uint8_t);
+
+#ifdef CONFIG_NET_TIMESTAMP
+  if (conn->timestamp)
+    {
+      /* Append the receipt timestamp after the source address */
+
+      ret = iob_trycopyin(iob, (FAR const uint8_t *)&tv,
+                          sizeof(struct timeval), offset, true,
+                          IOBUSER_NET_UDP_READAHEAD);
+      if (ret < 0)
+        {
+          nerr("ERROR: Failed to add data to the I/O buffer chain: %d\n",
+               ret);
+          iob_free_chain(iob, IOBUSER_NET_UDP_READAHEAD);
+          return 0;
+        }
+
+      offset += sizeof(struct timeval);
+    }
+#endif
+
   if (buflen > 0)
     {
       /* Copy the new appdata into the I/O buffer chain */
 
-      ret = iob_trycopyin(iob, buffer, buflen,
-                          src_addr_size + sizeof(uint8_t), true,
+      ret = iob_trycopyin(iob, buffer, buflen, offset, true,
                           IOBUSER_NET_UDP_READAHEAD);
       if (ret < 0)
         {
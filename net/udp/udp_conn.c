@@ -74,6 +74,11 @@
 #define IPv4BUF ((struct ipv4_hdr_s *)&dev->d_buf[NET_LL_HDRLEN(dev)])
 #define IPv6BUF ((struct ipv6_hdr_s *)&dev->d_buf[NET_LL_HDRLEN(dev)])
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+#  define UDP_CONN_NBUCKETS   CONFIG_NET_UDP_CONN_HASHSIZE
+#  define UDP_CONN_BUCKET(p)  (((p) ^ ((p) >> 8)) & (UDP_CONN_NBUCKETS - 1))
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -91,6 +96,15 @@ static sem_t g_free_sem;
 
 static dq_queue_t g_active_udp_connections;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+/* A hash table of the allocated UDP connections, keyed by the bound local
+ * port number.  The local port is the only component of the match that
+ * cannot be a wildcard, so it is the only component of the key.
+ */
+
+static FAR struct udp_conn_s *g_udp_conn_hash[UDP_CONN_NBUCKETS];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -110,6 +124,86 @@ static inline void _udp_semtake(FAR sem_t *sem)
 
 #define _udp_semgive(sem) nxsem_post(sem)
 
+/****************************************************************************
+ * Name: udp_conn_hash
+ *
+ * Description:
+ *   Add the connection to the hash bucket selected by its bound local port
+ *   number.
+ *
+ * Assumptions:
+ *   This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+static void udp_conn_hash(FAR struct udp_conn_s *conn)
+{
+  int ndx = UDP_CONN_BUCKET(conn->lport);
+
+  conn->hashlink       = g_udp_conn_hash[ndx];
+  g_udp_conn_hash[ndx] = conn;
+}
+#endif
+
+/****************************************************************************
+ * Name: udp_conn_unhash
+ *
+ * Description:
+ *   Remove the connection from its hash bucket.  The bucket is derived
+ *   from the bound local port, so this must be called before the local
+ *   port number of the connection is changed.
+ *
+ * Assumptions:
+ *   This function must be called with the network locked.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+static void udp_conn_unhash(FAR struct udp_conn_s *conn)
+{
+  FAR struct udp_conn_s **link;
+
+  for (link = &g_udp_conn_hash[UDP_CONN_BUCKET(conn->lport)];
+       *link != NULL;
+       link = &(*link)->hashlink)
+    {
+      if (*link == conn)
+        {
+          *link          = conn->hashlink;
+          conn->hashlink = NULL;
+          return;
+        }
+    }
+}
+#endif
+
+/****************************************************************************
+ * Name: udp_conn_setlport
+ *
+ * Description:
+ *   Assign a new local port number to the connection, moving it to the
+ *   hash bucket of the new port.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+static void udp_conn_setlport(FAR struct udp_conn_s *conn, uint16_t lport)
+{
+  /* The network lock is recursive; it is harmless to take it again if the
+   * caller already holds it.
+   */
+
+  net_lock();
+  udp_conn_unhash(conn);
+  conn->lport = lport;
+  udp_conn_hash(conn);
+  net_unlock();
+}
+#else
+#  define udp_conn_setlport(conn,portno) ((conn)->lport = (portno))
+#endif
+
 /****************************************************************************
  * Name: udp_find_conn()
  *
@@ -264,7 +358,16 @@ static inline FAR struct udp_conn_s *
   FAR struct ipv4_hdr_s *ip = IPv4BUF;
   FAR struct udp_conn_s *conn;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* Every match requires that the destination port of the datagram equal
+   * the bound local port, so only the hash bucket of the destination port
+   * needs to be searched.
+   */
+
+  conn = g_udp_conn_hash[UDP_CONN_BUCKET(udp->destport)];
+#else
   conn = (FAR struct udp_conn_s *)g_active_udp_connections.head;
+#endif
   while (conn)
     {
       /* If the local UDP port is non-zero, the connection is considered
@@ -320,6 +423,9 @@ static inline FAR struct udp_conn_s *
        */
 
       if (conn->lport != 0 && udp->destport == conn->lport &&
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+          conn->domain == PF_INET &&
+#endif
 
           /* Local port accepts any address on this port or there
            * is an exact match in destipaddr and the bound local
@@ -377,7 +483,11 @@ static inline FAR struct udp_conn_s *
 
       /* Look at the next active connection */
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+      conn = conn->hashlink;
+#else
       conn = (FAR struct udp_conn_s *)conn->node.flink;
+#endif
     }
 
   return conn;
@@ -403,7 +513,16 @@ static inline FAR struct udp_conn_s *
   FAR struct ipv6_hdr_s *ip = IPv6BUF;
   FAR struct udp_conn_s *conn;
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* Every match requires that the destination port of the datagram equal
+   * the bound local port, so only the hash bucket of the destination port
+   * needs to be searched.
+   */
+
+  conn = g_udp_conn_hash[UDP_CONN_BUCKET(udp->destport)];
+#else
   conn = (FAR struct udp_conn_s *)g_active_udp_connections.head;
+#endif
   while (conn != NULL)
     {
       /* If the local UDP port is non-zero, the connection is considered
@@ -458,6 +577,9 @@ static inline FAR struct udp_conn_s *
        */
 
       if ((conn->lport != 0 && udp->destport == conn->lport &&
+#if defined(CONFIG_NET_IPv4) && defined(CONFIG_NET_IPv6)
+          conn->domain == PF_INET6 &&
+#endif
 
           /* Check if the local port accepts any address on this port or
            * that there is an exact match between the destipaddr and the
@@ -516,7 +638,11 @@ static inline FAR struct udp_conn_s *
 
       /* Look at the next active connection */
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+      conn = conn->hashlink;
+#else
       conn = (FAR struct udp_conn_s *)conn->node.flink;
+#endif
     }
 
   return conn;
@@ -546,6 +672,10 @@ void udp_initialize(void)
   dq_init(&g_active_udp_connections);
   nxsem_init(&g_free_sem, 0, 1);
 
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  memset(g_udp_conn_hash, 0, sizeof(g_udp_conn_hash));
+#endif
+
   for (i = 0; i < CONFIG_NET_UDP_CONNS; i++)
     {
       /* Mark the connection closed and move it to the free list */
@@ -586,6 +716,10 @@ FAR struct udp_conn_s *udp_alloc(uint8_t domain)
       conn->lport   = 0;
       conn->ttl     = IP_TTL;
 
+#ifdef CONFIG_NET_TIMESTAMP
+      conn->timestamp = 0;
+#endif
+
 #ifdef CONFIG_NET_UDP_WRITE_BUFFERS
       /* Initialize the write buffer lists */
 
@@ -594,6 +728,14 @@ FAR struct udp_conn_s *udp_alloc(uint8_t domain)
       /* Enqueue the connection into the active list */
 
       dq_addlast(&conn->node, &g_active_udp_connections);
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+      /* And hash it on its (as yet unbound) local port */
+
+      net_lock();
+      udp_conn_hash(conn);
+      net_unlock();
+#endif
     }
 
   _udp_semgive(&g_free_sem);
@@ -620,6 +762,17 @@ void udp_free(FAR struct udp_conn_s *conn)
   DEBUGASSERT(conn->crefs == 0);
 
   _udp_semtake(&g_free_sem);
+
+#ifdef CONFIG_NET_UDP_CONN_HASH
+  /* Remove the connection from the hash table.  This must be done before
+   * the local port number is forgotten.
+   */
+
+  net_lock();
+  udp_conn_unhash(conn);
+  net_unlock();
+#endif
+
   conn->lport = 0;
 
   /* Remove the connection from the active list */
@@ -769,8 +922,9 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
     {
       /* Yes.. Select any unused local port number */
 
-      conn->lport = htons(udp_select_port(conn->domain, &conn->u));
-      ret         = OK;
+      udp_conn_setlport(conn,
+                        htons(udp_select_port(conn->domain, &conn->u)));
+      ret = OK;
     }
   else
     {
@@ -786,8 +940,8 @@ int udp_bind(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
         {
           /* No.. then bind the socket to the port */
 
-          conn->lport = portno;
-          ret         = OK;
+          udp_conn_setlport(conn, portno);
+          ret = OK;
         }
       else
         {
@@ -839,7 +993,8 @@ int udp_connect(FAR struct udp_conn_s *conn, FAR const struct sockaddr *addr)
        * connection structure.
        */
 
-      conn->lport = htons(udp_select_port(conn->domain, &conn->u));
+      udp_conn_setlport(conn,
+                        htons(udp_select_port(conn->domain, &conn->u)));
     }
 
   /* Is there a remote port (rport)? */
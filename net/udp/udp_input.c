@@ -131,7 +131,15 @@ static int udp_input(FAR struct net_driver_s *dev, unsigned int iplen)
 
 #ifdef CONFIG_NET_UDP_CHECKSUMS
   chksum = udp->udpchksum;
-  if (chksum != 0)
+  if (NETDEV_HAS_CAP(dev, NETDEV_CAP_CSUM_RX))
+    {
+      /* The hardware has already verified the checksum and discarded any
+       * bad frame.
+       */
+
+      chksum = 0;
+    }
+  else if (chksum != 0)
     {
 #ifdef CONFIG_NET_IPv6
 #ifdef CONFIG_NET_IPv4
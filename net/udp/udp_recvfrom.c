@@ -45,6 +45,11 @@
 #include <debug.h>
 #include <assert.h>
 
+#ifdef CONFIG_NET_TIMESTAMP
+#  include <sys/time.h>
+#  include <nuttx/clock.h>
+#endif
+
 #include <nuttx/semaphore.h>
 #include <nuttx/net/net.h>
 #include <nuttx/mm/iob.h>
@@ -80,6 +85,10 @@ struct udp_recvfrom_s
   uint8_t                 *ir_buffer;    /* Pointer to receive buffer */
   FAR struct sockaddr     *ir_from;      /* Address of sender */
   FAR socklen_t           *ir_fromlen;   /* Number of bytes allocated for address of sender */
+#ifdef CONFIG_NET_TIMESTAMP
+  size_t                   ir_msglen;    /* Length of the control message buffer */
+  FAR uint8_t             *ir_msgbuf;    /* Pointer to the control message buffer */
+#endif
   ssize_t                  ir_recvlen;   /* The received length */
   int                      ir_result;    /* Success:OK, failure:negated errno */
 };
@@ -185,6 +194,22 @@ static size_t udp_recvfrom_newdata(FAR struct net_driver_s *dev,
 static inline void udp_newdata(FAR struct net_driver_s *dev,
                                FAR struct udp_recvfrom_s *pstate)
 {
+#ifdef CONFIG_NET_TIMESTAMP
+  /* The datagram is being taken directly from the device buffer, so its
+   * receipt time is now.
+   */
+
+  if (pstate->ir_msglen == sizeof(struct timeval))
+    {
+      FAR struct timeval *tv = (FAR struct timeval *)pstate->ir_msgbuf;
+      struct timespec ts;
+
+      clock_systime_timespec(&ts);
+      tv->tv_sec  = ts.tv_sec;
+      tv->tv_usec = ts.tv_nsec / 1000;
+    }
+#endif
+
   /* Take as much data from the packet as we can */
 
   udp_recvfrom_newdata(dev, pstate);
@@ -211,6 +236,10 @@ static inline void udp_readahead(struct udp_recvfrom_s *pstate)
     {
       FAR struct iob_s *tmp;
       uint8_t src_addr_size;
+      uint16_t offset;
+#ifdef CONFIG_NET_TIMESTAMP
+      bool hastimestamp;
+#endif
 
       DEBUGASSERT(iob->io_pktlen > 0);
 
@@ -224,6 +253,15 @@ static inline void udp_readahead(struct udp_recvfrom_s *pstate)
           goto out;
         }
 
+#ifdef CONFIG_NET_TIMESTAMP
+      /* Extract and remove the timestamp-present flag from the source
+       * address size (see udp_datahandler()).
+       */
+
+      hastimestamp   = (src_addr_size & UDP_RAH_TIMESTAMP) != 0;
+      src_addr_size &= UDP_RAH_SIZEMASK;
+#endif
+
       if (0
 #ifdef CONFIG_NET_IPv6
           || src_addr_size == sizeof(struct sockaddr_in6)
@@ -248,10 +286,39 @@ static inline void udp_readahead(struct udp_recvfrom_s *pstate)
             }
         }
 
+      offset = src_addr_size + sizeof(uint8_t);
+
+#ifdef CONFIG_NET_TIMESTAMP
+      if (hastimestamp)
+        {
+          /* Copy the receipt timestamp out to the caller's control message
+           * buffer if one was provided; otherwise just skip over it.
+           */
+
+          if (pstate->ir_msglen == sizeof(struct timeval))
+            {
+              recvlen = iob_copyout(pstate->ir_msgbuf, iob,
+                                    sizeof(struct timeval), offset);
+              if (recvlen != sizeof(struct timeval))
+                {
+                  goto out;
+                }
+            }
+
+          offset += sizeof(struct timeval);
+        }
+      else
+        {
+          /* There is no timestamp to deliver with this datagram */
+
+          pstate->ir_msglen = 0;
+        }
+#endif
+
       if (pstate->ir_buflen > 0)
         {
           recvlen = iob_copyout(pstate->ir_buffer, iob, pstate->ir_buflen,
-                                src_addr_size + sizeof(uint8_t));
+                                offset);
 
           ninfo("Received %d bytes (of %d)\n", recvlen, iob->io_pktlen);
 
@@ -587,50 +654,37 @@ static ssize_t udp_recvfrom_result(int result, struct udp_recvfrom_s *pstate)
 }
 
 /****************************************************************************
- * Public Functions
- ****************************************************************************/
-
-/****************************************************************************
- * Name: psock_udp_recvfrom
+ * Name: udp_recvfrom_core
  *
  * Description:
- *   Perform the recvfrom operation for a UDP SOCK_DGRAM
+ *   Implement the core of the recvfrom() operation:  Copy any buffered
+ *   read-ahead data then, if the socket permits blocking, wait for new
+ *   data to arrive.
  *
  * Input Parameters:
- *   psock  Pointer to the socket structure for the SOCK_DRAM socket
- *   buf    Buffer to receive data
- *   len    Length of buffer
- *   from   INET address of source (may be NULL)
+ *   psock    Pointer to the socket structure for the socket
+ *   flags    Receive flags
+ *   pstate   An initialized recvfrom state structure
  *
  * Returned Value:
  *   On success, returns the number of characters received.  On  error,
- *   -errno is returned (see recvfrom for list of errnos).
+ *   -errno is returned.
  *
  * Assumptions:
+ *   The network is locked.
  *
  ****************************************************************************/
 
-ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
-                           size_t len, int flags, FAR struct sockaddr *from,
-                           FAR socklen_t *fromlen)
+static ssize_t udp_recvfrom_core(FAR struct socket *psock, int flags,
+                                 FAR struct udp_recvfrom_s *pstate)
 {
   FAR struct udp_conn_s *conn = (FAR struct udp_conn_s *)psock->s_conn;
   FAR struct net_driver_s *dev;
-  struct udp_recvfrom_s state;
-  int ret;
-
-  /* Perform the UDP recvfrom() operation */
-
-  /* Initialize the state structure.  This is done with the network locked
-   * because we don't want anything to happen until we are ready.
-   */
-
-  net_lock();
-  udp_recvfrom_initialize(psock, buf, len, from, fromlen, &state);
+  ssize_t ret;
 
   /* Copy the read-ahead data from the packet */
 
-  udp_readahead(&state);
+  udp_readahead(pstate);
 
   /* The default return value is the number of bytes that we just copied
    * into the user buffer.  We will return this if the socket has become
@@ -638,7 +692,7 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
    * data from the readahead buffers.
    */
 
-  ret = state.ir_recvlen;
+  ret = pstate->ir_recvlen;
 
   /* Handle non-blocking UDP sockets */
 
@@ -664,7 +718,7 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
    * NOTE: that udp_readahead() may set state.ir_recvlen == -1.
    */
 
-  else if (state.ir_recvlen <= 0)
+  else if (pstate->ir_recvlen <= 0)
     {
       /* Get the device that will handle the packet transfers.  This may be
        * NULL if the UDP socket is bound to INADDR_ANY.  In that case, no
@@ -675,21 +729,22 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
 
       /* Set up the callback in the connection */
 
-      state.ir_cb = udp_callback_alloc(dev, conn);
-      if (state.ir_cb)
+      pstate->ir_cb = udp_callback_alloc(dev, conn);
+      if (pstate->ir_cb)
         {
           /* Set up the callback in the connection */
 
-          state.ir_cb->flags   = (UDP_NEWDATA | NETDEV_DOWN);
-          state.ir_cb->priv    = (FAR void *)&state;
-          state.ir_cb->event   = udp_eventhandler;
+          pstate->ir_cb->flags   = (UDP_NEWDATA | NETDEV_DOWN);
+          pstate->ir_cb->priv    = (FAR void *)pstate;
+          pstate->ir_cb->event   = udp_eventhandler;
 
           /* Wait for either the receive to complete or for an error/timeout
            * to occur.  net_timedwait will also terminate if a signal is
            * received.
            */
 
-          ret = net_timedwait(&state.ir_sem, _SO_TIMEOUT(psock->s_rcvtimeo));
+          ret = net_timedwait(&pstate->ir_sem,
+                              _SO_TIMEOUT(psock->s_rcvtimeo));
           if (ret == -ETIMEDOUT)
             {
               ret = -EAGAIN;
@@ -697,8 +752,8 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
 
           /* Make sure that no further events are processed */
 
-          udp_callback_free(dev, conn, state.ir_cb);
-          ret = udp_recvfrom_result(ret, &state);
+          udp_callback_free(dev, conn, pstate->ir_cb);
+          ret = udp_recvfrom_result(ret, pstate);
         }
       else
         {
@@ -706,9 +761,141 @@ ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
         }
     }
 
+  return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: psock_udp_recvfrom
+ *
+ * Description:
+ *   Perform the recvfrom operation for a UDP SOCK_DGRAM
+ *
+ * Input Parameters:
+ *   psock  Pointer to the socket structure for the SOCK_DRAM socket
+ *   buf    Buffer to receive data
+ *   len    Length of buffer
+ *   from   INET address of source (may be NULL)
+ *
+ * Returned Value:
+ *   On success, returns the number of characters received.  On  error,
+ *   -errno is returned (see recvfrom for list of errnos).
+ *
+ * Assumptions:
+ *
+ ****************************************************************************/
+
+ssize_t psock_udp_recvfrom(FAR struct socket *psock, FAR void *buf,
+                           size_t len, int flags, FAR struct sockaddr *from,
+                           FAR socklen_t *fromlen)
+{
+  struct udp_recvfrom_s state;
+  ssize_t ret;
+
+  /* Perform the UDP recvfrom() operation */
+
+  /* Initialize the state structure.  This is done with the network locked
+   * because we don't want anything to happen until we are ready.
+   */
+
+  net_lock();
+  udp_recvfrom_initialize(psock, buf, len, from, fromlen, &state);
+
+  ret = udp_recvfrom_core(psock, flags, &state);
+
+  net_unlock();
+  udp_recvfrom_uninitialize(&state);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: psock_udp_recvmsg
+ *
+ * Description:
+ *   Perform the recvmsg operation for a UDP SOCK_DGRAM socket.  This
+ *   differs from psock_udp_recvfrom() in that the receipt time of the
+ *   datagram is returned as ancillary data if the SO_TIMESTAMP option has
+ *   been selected for the socket.
+ *
+ * Input Parameters:
+ *   psock  Pointer to the socket structure for the SOCK_DGRAM socket
+ *   msg    Message header describing the user and control buffers
+ *   flags  Receive flags
+ *
+ * Returned Value:
+ *   On success, returns the number of characters received.  On  error,
+ *   -errno is returned (see recvmsg for list of errnos).
+ *
+ * Assumptions:
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_TIMESTAMP
+ssize_t psock_udp_recvmsg(FAR struct socket *psock, FAR struct msghdr *msg,
+                          int flags)
+{
+  struct udp_recvfrom_s state;
+  socklen_t fromlen = msg->msg_namelen;
+  ssize_t ret;
+
+  /* Initialize the state structure.  This is done with the network locked
+   * because we don't want anything to happen until we are ready.
+   */
+
+  net_lock();
+  udp_recvfrom_initialize(psock, msg->msg_iov->iov_base,
+                          msg->msg_iov->iov_len,
+                          (FAR struct sockaddr *)msg->msg_name,
+                          &fromlen, &state);
+
+  /* If the SO_TIMESTAMP option has been selected and the caller has
+   * provided space for a control message, then set up to return the
+   * receipt time of the datagram as ancillary data.
+   */
+
+  if (psock->s_timestamp && msg->msg_controllen >=
+      (sizeof(struct cmsghdr) + sizeof(struct timeval)))
+    {
+      FAR struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg);
+
+      state.ir_msglen  = sizeof(struct timeval);
+      state.ir_msgbuf  = CMSG_DATA(cmsg);
+      cmsg->cmsg_level = SOL_SOCKET;
+      cmsg->cmsg_type  = SO_TIMESTAMP;
+      cmsg->cmsg_len   = state.ir_msglen;
+      msg->msg_controllen = sizeof(struct cmsghdr) + sizeof(struct timeval);
+    }
+  else
+    {
+      /* Expected behavior is that msg_controllen becomes zero, otherwise
+       * CMSG_NXTHDR will go into an infinite loop.
+       */
+
+      msg->msg_controllen = 0;
+    }
+
+  ret = udp_recvfrom_core(psock, flags, &state);
+  if (ret >= 0)
+    {
+      msg->msg_namelen = fromlen;
+
+      /* If no timestamp accompanied the received datagram, then do not
+       * return the (uninitialized) control message.
+       */
+
+      if (state.ir_msglen == 0)
+        {
+          msg->msg_controllen = 0;
+        }
+    }
+
   net_unlock();
   udp_recvfrom_uninitialize(&state);
   return ret;
 }
+#endif /* CONFIG_NET_TIMESTAMP */
 
 #endif /* CONFIG_NET && CONFIG_NET_UDP */
@@ -174,6 +174,19 @@ static void sendto_writebuffer_release(FAR struct socket *psock,
           wrb = (FAR struct udp_wrbuffer_s *)sq_remfirst(&conn->write_q);
           DEBUGASSERT(wrb != NULL);
 
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+          /* If this was a zero-copy send, then wake up the blocked sender.
+           * Its payload has either been consumed by the device poll or
+           * abandoned (wz_result tells it which); in either case its
+           * buffer is no longer referenced.
+           */
+
+          if (wrb->wb_zcwait != NULL)
+            {
+              nxsem_post(&wrb->wb_zcwait->wz_sem);
+            }
+#endif
+
           udp_wrbuffer_release(wrb);
 
           /* Set up for the next packet transfer by setting the connection
@@ -428,15 +441,6 @@ static uint16_t sendto_eventhandler(FAR struct net_driver_s *dev,
       wrb = (FAR struct udp_wrbuffer_s *)sq_peek(&conn->write_q);
       DEBUGASSERT(wrb != NULL);
 
-      /* Get the amount of data that we can send in the next packet.
-       * We will send either the remaining data in the buffer I/O
-       * buffer chain, or as much as will fit given the MSS and current
-       * window size.
-       */
-
-      sndlen = wrb->wb_iob->io_pktlen;
-      ninfo("wrb=%p sndlen=%zu\n", wrb, sndlen);
-
 #ifdef NEED_IPDOMAIN_SUPPORT
       /* If both IPv4 and IPv6 support are enabled, then we will need to
        * select which one to use when generating the outgoing packet.
@@ -446,11 +450,40 @@ static uint16_t sendto_eventhandler(FAR struct net_driver_s *dev,
 
       sendto_ipselect(dev, conn);
 #endif
-      /* Then set-up to send that amount of data with the offset
-       * corresponding to the size of the IP-dependent address structure.
-       */
 
-      devif_iob_send(dev, wrb->wb_iob, sndlen, 0);
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+      if (wrb->wb_zcwait != NULL)
+        {
+          /* Zero-copy send:  The payload still lives in the blocked
+           * sender's buffer; copy it directly into the device buffer,
+           * bypassing the write-buffer IOB chain entirely.
+           */
+
+          sndlen = wrb->wb_zclen;
+          ninfo("wrb=%p zero-copy sndlen=%zu\n", wrb, sndlen);
+
+          devif_send(dev, wrb->wb_zcbuf, sndlen);
+          wrb->wb_zcwait->wz_result = OK;
+        }
+      else
+#endif
+        {
+          /* Get the amount of data that we can send in the next packet.
+           * We will send either the remaining data in the buffer I/O
+           * buffer chain, or as much as will fit given the MSS and
+           * current window size.
+           */
+
+          sndlen = wrb->wb_iob->io_pktlen;
+          ninfo("wrb=%p sndlen=%zu\n", wrb, sndlen);
+
+          /* Then set-up to send that amount of data with the offset
+           * corresponding to the size of the IP-dependent address
+           * structure.
+           */
+
+          devif_iob_send(dev, wrb->wb_iob, sndlen, 0);
+        }
 
       /* Free the write buffer at the head of the queue and attempt to
        * setup the next transfer.
@@ -505,6 +538,10 @@ ssize_t psock_udp_sendto(FAR struct socket *psock, FAR const void *buf,
 {
   FAR struct udp_conn_s *conn;
   FAR struct udp_wrbuffer_s *wrb;
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+  struct udp_zcwait_s zcwait;
+  bool zcopy;
+#endif
   bool nonblock;
   bool empty;
   int ret = OK;
@@ -632,6 +669,15 @@ ssize_t psock_udp_sendto(FAR struct socket *psock, FAR const void *buf,
 
   nonblock = _SS_ISNONBLOCK(psock->s_flags) || (flags & MSG_DONTWAIT) != 0;
 
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+  /* A zero-copy send must block until the device poll has consumed the
+   * caller's buffer, so MSG_ZEROCOPY falls back to the normal buffered
+   * copy on a non-blocking socket.
+   */
+
+  zcopy = (flags & MSG_ZEROCOPY) != 0 && !nonblock;
+#endif
+
   /* Dump the incoming buffer */
 
   BUF_DUMP("psock_udp_sendto", buf, len);
@@ -713,6 +759,25 @@ ssize_t psock_udp_sendto(FAR struct socket *psock, FAR const void *buf,
        * buffer space if the socket was opened non-blocking.
        */
 
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+      if (zcopy)
+        {
+          /* Zero-copy:  Leave the payload in the caller's buffer.  We
+           * block below until the device poll has consumed the payload,
+           * so the buffer cannot be modified or recycled underneath us.
+           */
+
+          nxsem_init(&zcwait.wz_sem, 0, 0);
+          nxsem_set_protocol(&zcwait.wz_sem, SEM_PRIO_NONE);
+          zcwait.wz_result = -ENETDOWN;
+
+          wrb->wb_zcwait = &zcwait;
+          wrb->wb_zcbuf  = (FAR const uint8_t *)buf;
+          wrb->wb_zclen  = len;
+          ret            = OK;
+        }
+      else
+#endif
       if (nonblock)
         {
           ret = iob_trycopyin(wrb->wb_iob, (FAR uint8_t *)buf, len, 0, false,
@@ -780,6 +845,48 @@ ssize_t psock_udp_sendto(FAR struct socket *psock, FAR const void *buf,
             }
         }
 
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+      if (zcopy)
+        {
+          /* Wait for the device poll to consume the payload.  The network
+           * is unlocked while we wait so that the poll can run.
+           */
+
+          ret = net_lockedwait(&zcwait.wz_sem);
+          if (ret >= 0)
+            {
+              ret = zcwait.wz_result;
+            }
+          else if (nxsem_trywait(&zcwait.wz_sem) >= 0)
+            {
+              /* The wait was interrupted, but the payload had already
+               * been consumed.  The event handler runs with the network
+               * locked, so there is no race against this check:  Report
+               * the result of the completed transfer.
+               */
+
+              ret = zcwait.wz_result;
+            }
+          else
+            {
+              /* The wait was interrupted before the payload was consumed.
+               * Remove the write buffer from the queue so that the
+               * caller's buffer is no longer referenced.
+               */
+
+              sq_rem(&wrb->wb_node, &conn->write_q);
+              udp_wrbuffer_release(wrb);
+            }
+
+          nxsem_destroy(&zcwait.wz_sem);
+          if (ret < 0)
+            {
+              net_unlock();
+              return ret;
+            }
+        }
+#endif
+
       net_unlock();
     }
 
@@ -788,6 +895,13 @@ ssize_t psock_udp_sendto(FAR struct socket *psock, FAR const void *buf,
   return len;
 
 errout_with_wrb:
+#ifdef CONFIG_NET_UDP_ZEROCOPY
+  if (zcopy)
+    {
+      nxsem_destroy(&zcwait.wz_sem);
+    }
+#endif
+
   udp_wrbuffer_release(wrb);
 
 errout_with_lock:
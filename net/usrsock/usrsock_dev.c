@@ -83,6 +83,7 @@ struct usrsockdev_s
     FAR const struct iovec *iov; /* Pending request buffers */
     int     iovcnt;              /* Number of request buffers */
     size_t  pos;                 /* Reader position on request buffer */
+    size_t  totlen;              /* Total length of the request buffers */
     sem_t   sem;                 /* Request semaphore (only one outstanding
                                   * request) */
     sem_t   acksem;              /* Request acknowledgment notification */
@@ -395,6 +396,21 @@ static ssize_t usrsockdev_read(FAR struct file *filep, FAR char *buffer,
         {
           dev->req.pos += rlen;
           len = rlen;
+
+          /* Has the daemon now read the entire request?  If so, the
+           * request buffers are no longer needed and the request line can
+           * be freed for the next request.  The daemon's response will be
+           * matched to the issuing connection by the exchange id, so
+           * there is no need to block the request channel for the full
+           * round trip.
+           */
+
+          if (dev->req.pos >= dev->req.totlen)
+            {
+              dev->req.iov = NULL;
+
+              nxsem_post(&dev->req.acksem);
+            }
         }
     }
   else
@@ -785,8 +801,9 @@ static ssize_t usrsockdev_handle_req_response(FAR struct usrsockdev_s *dev,
 
   if (dev->req.ack_xid == hdr->xid && dev->req.iov)
     {
-      /* Signal that request was received and read by daemon and
-       * acknowledgment response was received.
+      /* The daemon responded without reading the entire request (the
+       * request line is normally freed when the last request byte is
+       * read).  Signal that the request exchange is complete.
        */
 
       dev->req.iov = NULL;
@@ -1219,17 +1236,29 @@ int usrsockdev_do_request(FAR struct usrsock_conn_s *conn,
 
   if (usrsockdev_is_opened(dev))
     {
+      unsigned int i;
+
       DEBUGASSERT(dev->req.iov == NULL);
       dev->req.ack_xid = req_head->xid;
       dev->req.iov = iov;
       dev->req.pos = 0;
       dev->req.iovcnt = iovcnt;
+      dev->req.totlen = 0;
+
+      for (i = 0; i < iovcnt; i++)
+        {
+          dev->req.totlen += iov[i].iov_len;
+        }
 
       /* Notify daemon of new request. */
 
       usrsockdev_pollnotify(dev, POLLIN);
 
-      /* Wait ack for request. */
+      /* Wait until the daemon has read the request.  The response will
+       * arrive asynchronously through usrsockdev_write() and is matched
+       * to this connection by the exchange id, so the next request may
+       * be issued as soon as this one has been consumed.
+       */
 
       net_lockedwait_uninterruptible(&dev->req.acksem);
     }
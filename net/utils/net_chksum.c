@@ -69,43 +69,94 @@
 #ifndef CONFIG_NET_ARCH_CHKSUM
 uint16_t chksum(uint16_t sum, FAR const uint8_t *data, uint16_t len)
 {
-  FAR const uint8_t *dataptr;
-  FAR const uint8_t *last_byte;
-  uint16_t t;
+  FAR const uint8_t *dataptr = data;
+  uint32_t acc = sum;
 
-  dataptr = data;
-  last_byte = data + len - 1;
+  /* Accumulate 16-bit words into a 32-bit accumulator, deferring all of
+   * the carry folding to the end.  Eight bytes are consumed per loop
+   * iteration to limit the loop overhead.  A 32-bit accumulator cannot
+   * overflow here:  The worst case is 32768 additions of 0xffff.
+   */
 
-  while (dataptr < last_byte)
+  while (len >= 8)
     {
-      /* At least two more bytes */
+      acc += ((uint16_t)dataptr[0] << 8) | dataptr[1];
+      acc += ((uint16_t)dataptr[2] << 8) | dataptr[3];
+      acc += ((uint16_t)dataptr[4] << 8) | dataptr[5];
+      acc += ((uint16_t)dataptr[6] << 8) | dataptr[7];
 
-      t = ((uint16_t)dataptr[0] << 8) + dataptr[1];
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
+      dataptr += 8;
+      len     -= 8;
+    }
+
+  while (len >= 2)
+    {
+      acc += ((uint16_t)dataptr[0] << 8) | dataptr[1];
 
       dataptr += 2;
+      len     -= 2;
+    }
+
+  /* Handle any dangling final byte */
+
+  if (len > 0)
+    {
+      acc += (uint16_t)dataptr[0] << 8;
     }
 
-  if (dataptr == last_byte)
+  /* Fold the deferred carries back into the low 16-bits */
+
+  while ((acc >> 16) != 0)
     {
-      t = (dataptr[0] << 8) + 0;
-      sum += t;
-      if (sum < t)
-        {
-          sum++; /* carry */
-        }
+      acc = (acc & 0xffff) + (acc >> 16);
     }
 
   /* Return sum in host byte order. */
 
-  return sum;
+  return (uint16_t)acc;
 }
 #endif /* CONFIG_NET_ARCH_CHKSUM */
 
+/****************************************************************************
+ * Name: chksum_adjust
+ *
+ * Description:
+ *   Adjust a computed checksum after one 16-bit word of the covered data
+ *   has been modified, without re-summing the data (RFC 1624):
+ *
+ *     HC' = ~(~HC + ~m + m')
+ *
+ *   All values are in host byte order; the caller is responsible for any
+ *   conversions.
+ *
+ * Input Parameters:
+ *   chksum - The checksum field value before the modification.
+ *   old    - The 16-bit word before the modification.
+ *   new    - The 16-bit word after the modification.
+ *
+ * Returned Value:
+ *   The adjusted checksum field value.
+ *
+ ****************************************************************************/
+
+uint16_t chksum_adjust(uint16_t chksum, uint16_t old, uint16_t new)
+{
+  uint32_t acc;
+
+  acc  = (uint16_t)~chksum;
+  acc += (uint16_t)~old;
+  acc += new;
+
+  /* Fold the carries back into the low 16-bits */
+
+  while ((acc >> 16) != 0)
+    {
+      acc = (acc & 0xffff) + (acc >> 16);
+    }
+
+  return ~(uint16_t)acc;
+}
+
 /****************************************************************************
  * Name: net_chksum
  *
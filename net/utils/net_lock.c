@@ -68,6 +68,11 @@ static sem_t        g_netlock;
 static pid_t        g_holder = NO_HOLDER;
 static unsigned int g_count  = 0;
 
+#ifdef CONFIG_NET_RWLOCK
+static sem_t        g_rdgate;       /* Serializes reader bookkeeping */
+static unsigned int g_nreaders = 0; /* Outstanding read-side acquisitions */
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -175,6 +180,9 @@ _net_timedwait(sem_t *sem, bool interruptible, unsigned int timeout)
 void net_lockinitialize(void)
 {
   nxsem_init(&g_netlock, 0, 1);
+#ifdef CONFIG_NET_RWLOCK
+  nxsem_init(&g_rdgate, 0, 1);
+#endif
 }
 
 /****************************************************************************
@@ -322,6 +330,126 @@ void net_unlock(void)
 #endif
 }
 
+/****************************************************************************
+ * Name: net_rdlock
+ *
+ * Description:
+ *   Take the network lock for read-only access.  Multiple readers may hold
+ *   the lock concurrently; all exclude net_lock() writers.  The read-side
+ *   critical section must not block on the network (no net_lockedwait)
+ *   and must not attempt to upgrade to net_lock().
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   Zero (OK) is returned on success; a negated errno value is returned on
+ *   failured (probably -ECANCELED).
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_RWLOCK
+int net_rdlock(void)
+{
+#ifdef CONFIG_SMP
+  irqstate_t flags = enter_critical_section();
+#endif
+  pid_t me = getpid();
+  int ret = OK;
+
+  /* Does this thread already hold the lock exclusively?  Then recurse as
+   * a writer; the write lock subsumes read access.
+   */
+
+  if (g_holder == me)
+    {
+      g_count++;
+    }
+  else
+    {
+      /* Serialize the reader bookkeeping.  The gate is held only briefly
+       * (except by the first reader while it waits out a writer), so
+       * readers queue here rather than on the network lock itself.
+       */
+
+      ret = nxsem_wait_uninterruptible(&g_rdgate);
+      if (ret >= 0)
+        {
+          /* The first reader in excludes writers; later readers just
+           * increment the count and proceed in parallel.
+           */
+
+          if (++g_nreaders == 1)
+            {
+              ret = _net_takesem();
+              if (ret < 0)
+                {
+                  g_nreaders--;
+                }
+            }
+
+          nxsem_post(&g_rdgate);
+        }
+    }
+
+#ifdef CONFIG_SMP
+  leave_critical_section(flags);
+#endif
+  return ret;
+}
+#endif
+
+/****************************************************************************
+ * Name: net_rdunlock
+ *
+ * Description:
+ *   Release the read-only network lock taken by net_rdlock().
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_NET_RWLOCK
+void net_rdunlock(void)
+{
+#ifdef CONFIG_SMP
+  irqstate_t flags = enter_critical_section();
+#endif
+  pid_t me = getpid();
+
+  /* If this thread holds the lock exclusively, then net_rdlock() recursed
+   * on the write lock and we must unwind the same way.
+   */
+
+  if (g_holder == me)
+    {
+      net_unlock();
+    }
+  else
+    {
+      DEBUGVERIFY(nxsem_wait_uninterruptible(&g_rdgate));
+      DEBUGASSERT(g_nreaders > 0);
+
+      /* The last reader out lets the writers back in */
+
+      if (--g_nreaders == 0)
+        {
+          nxsem_post(&g_netlock);
+        }
+
+      nxsem_post(&g_rdgate);
+    }
+
+#ifdef CONFIG_SMP
+  leave_critical_section(flags);
+#endif
+}
+#endif
+
 /****************************************************************************
  * Name: net_breaklock
  *
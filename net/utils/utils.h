@@ -236,6 +236,26 @@ void net_ipv6_pref2mask(uint8_t preflen, net_ipv6addr_t mask);
 
 uint16_t chksum(uint16_t sum, FAR const uint8_t *data, uint16_t len);
 
+/****************************************************************************
+ * Name: chksum_adjust
+ *
+ * Description:
+ *   Adjust a computed checksum after one 16-bit word of the covered data
+ *   has been modified, without re-summing the data (RFC 1624).  All values
+ *   are in host byte order.
+ *
+ * Input Parameters:
+ *   chksum - The checksum field value before the modification.
+ *   old    - The 16-bit word before the modification.
+ *   new    - The 16-bit word after the modification.
+ *
+ * Returned Value:
+ *   The adjusted checksum field value.
+ *
+ ****************************************************************************/
+
+uint16_t chksum_adjust(uint16_t chksum, uint16_t old, uint16_t new);
+
 /****************************************************************************
  * Name: net_chksum
  *
@@ -0,0 +1,96 @@
+/****************************************************************************
+ * sched/clock/clock_perf.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <time.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/compiler.h>
+
+#include "clock/clock.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: up_perf_init
+ *
+ * Description:
+ *   Default, weak implementation of the perf counter initialization.  The
+ *   tick-based fallback needs no initialization; architecture backends
+ *   that maintain a real cycle counter override this function.
+ *
+ ****************************************************************************/
+
+void weak_function up_perf_init(FAR void *arg)
+{
+  UNUSED(arg);
+}
+
+/****************************************************************************
+ * Name: up_perf_gettime
+ *
+ * Description:
+ *   Default, weak implementation of the perf counter timebase.  The system
+ *   tick counter satisfies the monotonicity requirement of the interface
+ *   but provides only tick granularity.
+ *
+ ****************************************************************************/
+
+uint32_t weak_function up_perf_gettime(void)
+{
+  return (uint32_t)clock_systime_ticks();
+}
+
+/****************************************************************************
+ * Name: up_perf_getfreq
+ *
+ * Description:
+ *   Default, weak implementation returning the frequency of the fallback
+ *   timebase, i.e., the system timer tick rate.
+ *
+ ****************************************************************************/
+
+unsigned long weak_function up_perf_getfreq(void)
+{
+  return TICK_PER_SEC;
+}
+
+/****************************************************************************
+ * Name: up_perf_convert
+ *
+ * Description:
+ *   Default, weak implementation converting an elapsed count from the
+ *   fallback timebase (system timer ticks) to a timespec.
+ *
+ ****************************************************************************/
+
+void weak_function up_perf_convert(uint32_t elapsed, FAR struct timespec *ts)
+{
+  clock_ticks2time((sclock_t)elapsed, ts);
+}
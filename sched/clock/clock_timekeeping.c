@@ -67,6 +67,23 @@ static uint64_t        g_clock_last_counter;
 static uint64_t        g_clock_mask;
 static long            g_clock_adjust;
 
+#ifdef CONFIG_CLOCK_TIMEKEEPING_SEQLOCK
+/* Sequence count protecting the timebase.  The count is incremented once
+ * before the timebase is updated and once again afterward, so an odd value
+ * means that an update is in progress.  All updates occur with interrupts
+ * disabled, so there is exactly one writer at a time; readers simply retry
+ * if the count changed while they sampled the timebase.
+ */
+
+static volatile unsigned int g_clock_seqcount;
+
+#  define clock_seqcount_begin() do { g_clock_seqcount++; } while (0)
+#  define clock_seqcount_end()   do { g_clock_seqcount++; } while (0)
+#else
+#  define clock_seqcount_begin()
+#  define clock_seqcount_end()
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -75,6 +92,61 @@ static long            g_clock_adjust;
  * Name: clock_get_current_time
  ****************************************************************************/
 
+#ifdef CONFIG_CLOCK_TIMEKEEPING_SEQLOCK
+static int clock_get_current_time(FAR struct timespec *ts,
+                                  FAR struct timespec *base)
+{
+  struct timespec basecopy;
+  unsigned int seq;
+  uint64_t counter;
+  uint64_t last;
+  uint64_t offset;
+  uint64_t nsec;
+  time_t sec;
+  int ret;
+
+  /* Sample the published timebase and the hardware counter, retrying if
+   * the timebase was updated while we sampled it.  Neither interrupts nor
+   * the critical section are needed in this read path.
+   */
+
+  do
+    {
+      do
+        {
+          seq = g_clock_seqcount;
+        }
+      while ((seq & 1) != 0);
+
+      basecopy.tv_sec  = base->tv_sec;
+      basecopy.tv_nsec = base->tv_nsec;
+      last             = g_clock_last_counter;
+
+      ret = up_timer_getcounter(&counter);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+  while (seq != g_clock_seqcount);
+
+  offset = (counter - last) & g_clock_mask;
+  nsec   = offset * NSEC_PER_TICK;
+  sec    = nsec   / NSEC_PER_SEC;
+  nsec  -= sec    * NSEC_PER_SEC;
+
+  nsec  += basecopy.tv_nsec;
+  if (nsec >= NSEC_PER_SEC)
+    {
+      nsec -= NSEC_PER_SEC;
+      sec  += 1;
+    }
+
+  ts->tv_nsec = nsec;
+  ts->tv_sec  = basecopy.tv_sec + sec;
+  return OK;
+}
+#else
 static int clock_get_current_time(FAR struct timespec *ts,
                                   FAR struct timespec *base)
 {
@@ -112,6 +184,7 @@ errout_in_critical_section:
   leave_critical_section(flags);
   return ret;
 }
+#endif /* CONFIG_CLOCK_TIMEKEEPING_SEQLOCK */
 
 /****************************************************************************
  * Public Functions
@@ -144,10 +217,14 @@ int clock_timekeeping_set_wall_time(FAR struct timespec *ts)
       goto errout_in_critical_section;
     }
 
+  clock_seqcount_begin();
+
   g_clock_wall_time    = *ts;
   g_clock_adjust       = 0;
   g_clock_last_counter = counter;
 
+  clock_seqcount_end();
+
 errout_in_critical_section:
   leave_critical_section(flags);
   return ret;
@@ -209,7 +286,9 @@ int adjtime(FAR const struct timeval *delta, FAR struct timeval *olddelta)
       olddelta->tv_usec = g_clock_adjust;
     }
 
+  clock_seqcount_begin();
   g_clock_adjust = adjust_usec;
+  clock_seqcount_end();
 
   leave_critical_section(flags);
 
@@ -277,11 +356,15 @@ void clock_update_wall_time(void)
         }
     }
 
+  clock_seqcount_begin();
+
   g_clock_wall_time.tv_sec += sec;
   g_clock_wall_time.tv_nsec = (long)nsec;
 
   g_clock_last_counter = counter;
 
+  clock_seqcount_end();
+
 errout_in_critical_section:
   leave_critical_section(flags);
 }
@@ -42,9 +42,14 @@
 #ifndef CONFIG_DISABLE_ENVIRON
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <sched.h>
 
+#ifdef CONFIG_ENVIRON_HASH
+#  include <nuttx/kmalloc.h>
+#endif
+
 #include "environ/environ.h"
 
 /****************************************************************************
@@ -73,6 +78,142 @@ static bool env_cmpname(const char *pszname, const char *peqname)
   return false;
 }
 
+#ifdef CONFIG_ENVIRON_HASH
+/****************************************************************************
+ * Name: env_hashname
+ *
+ * Description:
+ *   Hash a variable name.  The name may be terminated either by NUL (a
+ *   search name) or by '=' (a name=value string in the environment block).
+ *
+ ****************************************************************************/
+
+static uint16_t env_hashname(FAR const char *name)
+{
+  uint32_t hash = 5381;
+
+  for (; *name != '\0' && *name != '='; name++)
+    {
+      hash = ((hash << 5) + hash) ^ (uint8_t)*name;
+    }
+
+  return (uint16_t)(hash ^ (hash >> 16));
+}
+
+/****************************************************************************
+ * Name: env_index_rebuild
+ *
+ * Description:
+ *   Rebuild the hash index over the packed environment block.  Each slot
+ *   of the index holds the offset of one name=value string, plus one so
+ *   that zero marks an empty slot.  On any failure the index is simply
+ *   left stale and lookups fall back to the linear scan.
+ *
+ ****************************************************************************/
+
+static void env_index_rebuild(FAR struct task_group_s *group)
+{
+  FAR char *ptr;
+  FAR char *end;
+  uint16_t slots;
+  uint16_t slot;
+  int nvars;
+
+  /* Offsets (plus one) must fit in a uint16_t index entry */
+
+  if (group->tg_envsize >= UINT16_MAX)
+    {
+      return;
+    }
+
+  /* Count the variables in the environment block */
+
+  nvars = 0;
+  end   = &group->tg_envp[group->tg_envsize];
+  for (ptr = group->tg_envp; ptr < end; ptr += strlen(ptr) + 1)
+    {
+      nvars++;
+    }
+
+  /* Size the table to the next power of two holding twice the number of
+   * variables so that probe chains stay short.
+   */
+
+  for (slots = 8; slots < 2 * nvars; slots <<= 1);
+
+  /* (Re-)allocate the index if the required size changed */
+
+  if (group->tg_envidx == NULL || group->tg_envislots != slots)
+    {
+      if (group->tg_envidx != NULL)
+        {
+          kumm_free(group->tg_envidx);
+        }
+
+      group->tg_envidx = (FAR uint16_t *)
+        kumm_malloc(slots * sizeof(uint16_t));
+      if (group->tg_envidx == NULL)
+        {
+          group->tg_envislots = 0;
+          return;
+        }
+
+      group->tg_envislots = slots;
+    }
+
+  memset(group->tg_envidx, 0, slots * sizeof(uint16_t));
+
+  /* Insert the offset of each name=value string, resolving collisions by
+   * linear probing.  The table is never more than half full.
+   */
+
+  for (ptr = group->tg_envp; ptr < end; ptr += strlen(ptr) + 1)
+    {
+      slot = env_hashname(ptr) & (slots - 1);
+      while (group->tg_envidx[slot] != 0)
+        {
+          slot = (slot + 1) & (slots - 1);
+        }
+
+      group->tg_envidx[slot] = (uint16_t)(ptr - group->tg_envp) + 1;
+    }
+
+  group->tg_envdirty = false;
+}
+
+/****************************************************************************
+ * Name: env_index_lookup
+ *
+ * Description:
+ *   Find a variable through the hash index.  The probe ends at the first
+ *   empty slot since the index was built with linear probing and holds no
+ *   deleted entries.
+ *
+ ****************************************************************************/
+
+static FAR char *env_index_lookup(FAR struct task_group_s *group,
+                                  FAR const char *pname)
+{
+  FAR char *ptr;
+  uint16_t slots = group->tg_envislots;
+  uint16_t slot;
+
+  slot = env_hashname(pname) & (slots - 1);
+  while (group->tg_envidx[slot] != 0)
+    {
+      ptr = &group->tg_envp[group->tg_envidx[slot] - 1];
+      if (env_cmpname(pname, ptr))
+        {
+          return ptr;
+        }
+
+      slot = (slot + 1) & (slots - 1);
+    }
+
+  return NULL;
+}
+#endif /* CONFIG_ENVIRON_HASH */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -106,6 +247,23 @@ FAR char *env_findvar(FAR struct task_group_s *group, FAR const char *pname)
 
   DEBUGASSERT(group != NULL && pname != NULL);
 
+#ifdef CONFIG_ENVIRON_HASH
+  /* Rebuild the hash index if the environment was modified since it was
+   * last built, then search through the index.  If the index could not be
+   * (re-)built, fall back to the linear scan below.
+   */
+
+  if (group->tg_envdirty || group->tg_envidx == NULL)
+    {
+      env_index_rebuild(group);
+    }
+
+  if (group->tg_envidx != NULL && !group->tg_envdirty)
+    {
+      return env_index_lookup(group, pname);
+    }
+#endif
+
   /* Search for a name=value string with matching name */
 
   end = &group->tg_envp[group->tg_envsize];
@@ -86,6 +86,19 @@ void env_release(FAR struct task_group_s *group)
       kumm_free(group->tg_envp);
     }
 
+#ifdef CONFIG_ENVIRON_HASH
+  /* Free the hash index as well */
+
+  if (group->tg_envidx)
+    {
+      kumm_free(group->tg_envidx);
+    }
+
+  group->tg_envidx    = NULL;
+  group->tg_envislots = 0;
+  group->tg_envdirty  = false;
+#endif
+
   /* In any event, make sure that all environment-related variables in the
    * task group structure are reset to initial values.
    */
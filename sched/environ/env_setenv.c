@@ -187,6 +187,10 @@ int setenv(FAR const char *name, FAR const char *value, int overwrite)
   /* Now, put the new name=value string into the environment buffer */
 
   sprintf(pvar, "%s=%s", name, value);
+
+  /* A variable was added; the hash index must be rebuilt */
+
+  env_index_dirty(group);
   sched_unlock();
   return OK;
 
@@ -53,6 +53,17 @@
 #  define env_release(group) (0)
 #else
 
+/* Mark the hash index stale after any modification of the environment
+ * block.  The index is rebuilt lazily by the next env_findvar() call.
+ */
+
+#ifdef CONFIG_ENVIRON_HASH
+#  define env_index_dirty(group) \
+     do { (group)->tg_envdirty = true; } while (0)
+#else
+#  define env_index_dirty(group)
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -0,0 +1,244 @@
+/****************************************************************************
+ * sched/init/nx_initrun.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <time.h>
+#include <assert.h>
+#include <errno.h>
+#include <syslog.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/init.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/wqueue.h>
+
+#ifdef CONFIG_INIT_PARALLEL
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure tracks one initialization task while it is in flight on
+ * the work queue.
+ */
+
+struct nxinit_runner_s
+{
+  struct work_s work;                    /* Work queue entry */
+  FAR const struct nxinit_task_s *task;  /* The task being run */
+  FAR sem_t *done;                       /* Posted when the task completes */
+  uint32_t elapsed;                      /* Measured initialization time */
+  int result;                            /* Value returned by init() */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxinit_worker
+ *
+ * Description:
+ *   Work queue callback that runs one initialization function, measures
+ *   the time that it consumed, and signals completion.
+ *
+ ****************************************************************************/
+
+static void nxinit_worker(FAR void *arg)
+{
+  FAR struct nxinit_runner_s *runner = (FAR struct nxinit_runner_s *)arg;
+  uint32_t start;
+
+  start           = up_perf_gettime();
+  runner->result  = runner->task->init();
+  runner->elapsed = up_perf_gettime() - start;
+
+  nxsem_post(runner->done);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxinit_run
+ *
+ * Description:
+ *   Run a table of driver initialization functions, level by level.  All
+ *   entries at the same dependency level are queued on the low priority
+ *   work queue at once and may execute concurrently if the work queue has
+ *   more than one worker thread; the next level is not started until all
+ *   entries of the previous level have completed.
+ *
+ *   The time consumed by each initialization function is measured with
+ *   the perf counter timebase and reported via syslog so that slow
+ *   probes are identifiable.
+ *
+ * Input Parameters:
+ *   tasks  - Table of initialization tasks to perform
+ *   ntasks - The number of entries in the table
+ *
+ * Returned Value:
+ *   Zero (OK) if all initialization functions succeeded.  Otherwise, the
+ *   first failure returned by an initialization function.  All entries
+ *   are run even if some fail.
+ *
+ * Assumptions:
+ *   Called from a kernel thread context that may wait, such as the board
+ *   initialization thread.  The low priority work queue must have been
+ *   started.
+ *
+ ****************************************************************************/
+
+int nxinit_run(FAR const struct nxinit_task_s *tasks, size_t ntasks)
+{
+  FAR struct nxinit_runner_s *runners;
+  struct timespec ts;
+  sem_t done;
+  uint8_t level;
+  uint8_t maxlevel;
+  size_t nqueued;
+  size_t i;
+  int ret = OK;
+  int status;
+
+  DEBUGASSERT(tasks != NULL);
+
+  if (ntasks == 0)
+    {
+      return OK;
+    }
+
+  runners = kmm_zalloc(ntasks * sizeof(struct nxinit_runner_s));
+  if (runners == NULL)
+    {
+      return -ENOMEM;
+    }
+
+  nxsem_init(&done, 0, 0);
+  nxsem_set_protocol(&done, SEM_PRIO_NONE);
+
+  /* Find the highest dependency level in the table */
+
+  maxlevel = 0;
+  for (i = 0; i < ntasks; i++)
+    {
+      if (tasks[i].level > maxlevel)
+        {
+          maxlevel = tasks[i].level;
+        }
+    }
+
+  /* Process each level in turn */
+
+  for (level = 0; ; level++)
+    {
+      /* Queue every task at this level.  If the work queue is not usable
+       * (or queueing fails), fall back to running the task in place.
+       */
+
+      nqueued = 0;
+      for (i = 0; i < ntasks; i++)
+        {
+          if (tasks[i].level == level)
+            {
+              runners[i].task = &tasks[i];
+              runners[i].done = &done;
+
+              if (work_queue(LPWORK, &runners[i].work, nxinit_worker,
+                             &runners[i], 0) == OK)
+                {
+                  nqueued++;
+                }
+              else
+                {
+                  nxinit_worker(&runners[i]);
+                  nqueued++;
+                }
+            }
+        }
+
+      /* Wait until every task queued at this level has completed */
+
+      while (nqueued > 0)
+        {
+          status = nxsem_wait(&done);
+          if (status == OK)
+            {
+              nqueued--;
+            }
+          else
+            {
+              DEBUGASSERT(status == -EINTR || status == -ECANCELED);
+            }
+        }
+
+      if (level >= maxlevel)
+        {
+          break;
+        }
+    }
+
+  /* Report the per-driver timing and collect the first failure */
+
+  for (i = 0; i < ntasks; i++)
+    {
+      if (runners[i].task == NULL)
+        {
+          continue;
+        }
+
+      up_perf_convert(runners[i].elapsed, &ts);
+      if (runners[i].result < 0)
+        {
+          syslog(LOG_ERR, "init: %s FAILED (%d) after %lu.%06lus\n",
+                 tasks[i].name, runners[i].result,
+                 (unsigned long)ts.tv_sec,
+                 (unsigned long)(ts.tv_nsec / NSEC_PER_USEC));
+
+          if (ret == OK)
+            {
+              ret = runners[i].result;
+            }
+        }
+      else
+        {
+          syslog(LOG_INFO, "init: %s %lu.%06lus\n",
+                 tasks[i].name,
+                 (unsigned long)ts.tv_sec,
+                 (unsigned long)(ts.tv_nsec / NSEC_PER_USEC));
+        }
+    }
+
+  nxsem_destroy(&done);
+  kmm_free(runners);
+  return ret;
+}
+
+#endif /* CONFIG_INIT_PARALLEL */
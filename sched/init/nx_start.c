@@ -420,7 +420,9 @@ void nx_start(void)
   for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++, g_lastpid++)
 #endif
     {
+#ifndef CONFIG_SCHED_READYQ_BITMAP
       FAR dq_queue_t *tasklist;
+#endif
       int hashndx;
 
       /* Assign the process ID(s) of ZERO to the idle task(s) */
@@ -517,12 +519,20 @@ void nx_start(void)
        * run list.
        */
 
+#ifdef CONFIG_SCHED_READYQ_BITMAP
+      /* Insert through the bitmap-indexed ready queue so that the priority
+       * bitmap and tail pointers account for the IDLE task.
+       */
+
+      nxsched_readyq_insert(&g_idletcb[cpu].cmn);
+#else
 #ifdef CONFIG_SMP
       tasklist = TLIST_HEAD(TSTATE_TASK_RUNNING, cpu);
 #else
       tasklist = TLIST_HEAD(TSTATE_TASK_RUNNING);
 #endif
       dq_addfirst((FAR dq_entry_t *)&g_idletcb[cpu], tasklist);
+#endif
 
       /* Mark the idle task as the running task */
 
@@ -83,6 +83,14 @@ struct irq_info_s
   uint32_t lscount;  /* Number of interrupts on this IRQ (LS) */
 #endif
   uint32_t time;     /* Maximum execution time on this IRQ */
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  uint32_t hist[CONFIG_SCHED_IRQMONITOR_HISTOGRAM_BINS];
+                     /* Distribution of execution times on this IRQ.  Bin n
+                      * counts executions that took less than 2**n
+                      * microseconds; the last bin also absorbs all longer
+                      * runtimes.
+                      */
+#endif
 #endif
 };
 
@@ -55,6 +55,17 @@ volatile cpu_set_t g_cpu_irqset SP_SECTION;
 /* Handles nested calls to enter_critical section from interrupt handlers */
 
 volatile uint8_t g_cpu_nestcount[CONFIG_SMP_NCPUS];
+
+#ifdef CONFIG_SCHED_CSECTION_MONITOR
+/* Per-CPU counts of contended critical section entries and of spin
+ * iterations performed while waiting for g_cpu_irqlock.  Each counter is
+ * written only by its own CPU, so no locking is required; the counts are
+ * reported via the procfs "csection" file.
+ */
+
+volatile uint32_t g_cpu_csection_waits[CONFIG_SMP_NCPUS];
+volatile uint32_t g_cpu_csection_spins[CONFIG_SMP_NCPUS];
+#endif
 #endif
 
 /****************************************************************************
@@ -107,6 +118,9 @@ volatile uint8_t g_cpu_nestcount[CONFIG_SMP_NCPUS];
 #ifdef CONFIG_SMP
 static inline bool irq_waitlock(int cpu)
 {
+#ifdef CONFIG_SCHED_CSECTION_MONITOR
+  bool contended = false;
+#endif
 #ifdef CONFIG_SCHED_INSTRUMENTATION_SPINLOCKS
   FAR struct tcb_s *tcb = current_task(cpu);
 
@@ -121,6 +135,18 @@ static inline bool irq_waitlock(int cpu)
 
   while (spin_trylock_wo_note(&g_cpu_irqlock) == SP_LOCKED)
     {
+#ifdef CONFIG_SCHED_CSECTION_MONITOR
+      /* Count the contended entry (once) and the spin iterations */
+
+      if (!contended)
+        {
+          contended = true;
+          g_cpu_csection_waits[cpu]++;
+        }
+
+      g_cpu_csection_spins[cpu]++;
+#endif
+
       /* Is a pause request pending? */
 
       if (up_cpu_pausereq(cpu))
@@ -137,6 +163,20 @@ static inline bool irq_waitlock(int cpu)
 
           return false;
         }
+
+      /* Wait until the lock appears to be free again before retrying the
+       * atomic test-and-set.  Spinning on a simple read keeps the wait
+       * within the local cache and, on architectures that provide
+       * SP_WFE(), lets this CPU sleep until the lock is released.  The
+       * read loop must also poll for a pending pause request so that the
+       * deadlock check above remains responsive.
+       */
+
+      while (g_cpu_irqlock == SP_LOCKED && !up_cpu_pausereq(cpu))
+        {
+          SP_DSB();
+          SP_WFE();
+        }
     }
 
   /* We have g_cpu_irqlock! */
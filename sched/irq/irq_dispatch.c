@@ -76,6 +76,32 @@
      while (0)
 #endif
 
+/* INCR_HISTOGRAM - Add one handler execution time to the histogram for
+ * this IRQ number.  Bin n counts executions that took less than 2**n
+ * microseconds; the last bin also absorbs all longer runtimes.  The
+ * microsecond is approximated as 1024 nanoseconds to avoid a division
+ * in the interrupt path.
+ */
+
+#ifndef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+#  define INCR_HISTOGRAM(ndx, nsec)
+#else
+#  define INCR_HISTOGRAM(ndx, nsec) \
+     do \
+       { \
+         uint32_t usec_ = (uint32_t)(nsec) >> 10; \
+         int bin_ = 0; \
+         while (usec_ != 0 && \
+                bin_ < CONFIG_SCHED_IRQMONITOR_HISTOGRAM_BINS - 1) \
+           { \
+             usec_ >>= 1; \
+             bin_++; \
+           } \
+         g_irqvector[ndx].hist[bin_]++; \
+       } \
+     while (0)
+#endif
+
 /* CALL_VECTOR - Call the interrupt service routine attached to this
  * interrupt request
  */
@@ -90,14 +116,15 @@
          struct timespec delta; \
          uint32_t start; \
          uint32_t elapsed; \
-         start = up_critmon_gettime(); \
+         start = up_perf_gettime(); \
          vector(irq, context, arg); \
-         elapsed = up_critmon_gettime() - start; \
-         up_critmon_convert(elapsed, &delta); \
+         elapsed = up_perf_gettime() - start; \
+         up_perf_convert(elapsed, &delta); \
          if (delta.tv_nsec > g_irqvector[ndx].time) \
            { \
              g_irqvector[ndx].time = delta.tv_nsec; \
            } \
+         INCR_HISTOGRAM(ndx, delta.tv_nsec); \
        } \
      while (0)
 #else
@@ -115,6 +142,7 @@
            { \
              g_irqvector[ndx].time = delta.tv_nsec; \
            } \
+         INCR_HISTOGRAM(ndx, delta.tv_nsec); \
        } \
      while (0)
 #endif /* CONFIG_SCHED_IRQMONITOR */
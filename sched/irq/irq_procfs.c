@@ -40,6 +40,7 @@
 #include <nuttx/config.h>
 
 #include <sys/stat.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <fcntl.h>
 #include <string.h>
@@ -82,6 +83,21 @@
 
 #define IRQ_LINELEN 50
 
+/* The "irqhist" lines hold one 10-character column per histogram bucket
+ * following the IRQ number.
+ */
+
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+#  define IRQHIST_LINELEN (8 + 10 * CONFIG_SCHED_IRQMONITOR_HISTOGRAM_BINS)
+#  if IRQHIST_LINELEN > IRQ_LINELEN
+#    define IRQ_BUFLEN IRQHIST_LINELEN
+#  else
+#    define IRQ_BUFLEN IRQ_LINELEN
+#  endif
+#else
+#  define IRQ_BUFLEN IRQ_LINELEN
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -95,17 +111,24 @@ struct irq_file_s
   size_t remaining;           /* Number of available characters in buffer */
   size_t ncopied;             /* Number of characters in buffer */
   off_t offset;               /* Current file offset */
-  char line[IRQ_LINELEN];     /* Pre-allocated buffer for formatted lines */
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  bool hist;                  /* True: "irqhist" was opened, not "irqs" */
+#endif
+  char line[IRQ_BUFLEN];      /* Pre-allocated buffer for formatted lines */
 };
 
 /****************************************************************************
  * Private Function Prototypes
  ****************************************************************************/
 
-/* irq_foreach() callback function */
+/* irq_foreach() callback functions */
 
 static int     irq_callback(int irq, FAR struct irq_info_s *info,
                  FAR void *arg);
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+static int     irqhist_callback(int irq, FAR struct irq_info_s *info,
+                 FAR void *arg);
+#endif
 
 /* File system methods */
 
@@ -277,6 +300,81 @@ static int irq_callback(int irq, FAR struct irq_info_s *info,
     }
 }
 
+/****************************************************************************
+ * Name: irqhist_callback
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+static int irqhist_callback(int irq, FAR struct irq_info_s *info,
+                            FAR void *arg)
+{
+  FAR struct irq_file_s *irqfile = (FAR struct irq_file_s *)arg;
+  uint32_t hist[CONFIG_SCHED_IRQMONITOR_HISTOGRAM_BINS];
+  irqstate_t flags;
+  uint32_t total;
+  size_t linesize;
+  size_t copysize;
+  int i;
+
+  DEBUGASSERT(irqfile != NULL);
+
+  /* Take a snapshot of the histogram and reset it */
+
+  flags = enter_critical_section();
+  memcpy(hist, info->hist, sizeof(hist));
+  memset(info->hist, 0, sizeof(info->hist));
+  leave_critical_section(flags);
+
+  /* Don't bother if no handler executions were recorded.  See the REVISIT
+   * in irq_callback() for the limitations of skipping empty entries.
+   */
+
+  total = 0;
+  for (i = 0; i < CONFIG_SCHED_IRQMONITOR_HISTOGRAM_BINS; i++)
+    {
+      total += hist[i];
+    }
+
+  if (total == 0)
+    {
+      return 0;
+    }
+
+  /* Output one line with one column per histogram bucket */
+
+  linesize = snprintf(irqfile->line, IRQ_BUFLEN, "%3u", (unsigned int)irq);
+
+  for (i = 0; i < CONFIG_SCHED_IRQMONITOR_HISTOGRAM_BINS; i++)
+    {
+      linesize += snprintf(irqfile->line + linesize, IRQ_BUFLEN - linesize,
+                           " %9lu", (unsigned long)hist[i]);
+    }
+
+  linesize += snprintf(irqfile->line + linesize, IRQ_BUFLEN - linesize,
+                       "\n");
+
+  copysize  = procfs_memcpy(irqfile->line, linesize, irqfile->buffer,
+                            irqfile->remaining, &irqfile->offset);
+
+  irqfile->ncopied   += copysize;
+  irqfile->buffer    += copysize;
+  irqfile->remaining -= copysize;
+
+  /* Return a non-zero value to stop the traversal if the user-provided
+   * buffer is full.
+   */
+
+  if (irqfile->remaining > 0)
+    {
+      return 0;
+    }
+  else
+    {
+      return 1;
+    }
+}
+#endif
+
 /****************************************************************************
  * Name: irq_open
  ****************************************************************************/
@@ -298,9 +396,15 @@ static int irq_open(FAR struct file *filep, FAR const char *relpath,
       return -EACCES;
     }
 
-  /* "irqs" is the only acceptable value for the relpath */
+  /* "irqs" (and "irqhist", if enabled) are the only acceptable values for
+   * the relpath.
+   */
 
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  if (strcmp(relpath, "irqs") != 0 && strcmp(relpath, "irqhist") != 0)
+#else
   if (strcmp(relpath, "irqs") != 0)
+#endif
     {
       ferr("ERROR: relpath is '%s'\n", relpath);
       return -ENOENT;
@@ -315,6 +419,10 @@ static int irq_open(FAR struct file *filep, FAR const char *relpath,
       return -ENOMEM;
     }
 
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  irqfile->hist = (strcmp(relpath, "irqhist") == 0);
+#endif
+
   /* Save the attributes as the open-specific state in filep->f_priv */
 
   filep->f_priv = (FAR void *)irqfile;
@@ -367,7 +475,29 @@ static ssize_t irq_read(FAR struct file *filep, FAR char *buffer,
 
   /* The first line to output is the header */
 
-  linesize = snprintf(irqfile->line, IRQ_LINELEN, HDR_FMT);
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  if (irqfile->hist)
+    {
+      int i;
+
+      /* Label each bucket column with its upper bound in microseconds */
+
+      linesize = snprintf(irqfile->line, IRQ_BUFLEN, "IRQ");
+      for (i = 0; i < CONFIG_SCHED_IRQMONITOR_HISTOGRAM_BINS; i++)
+        {
+          linesize += snprintf(irqfile->line + linesize,
+                               IRQ_BUFLEN - linesize, " <%6uus",
+                               (unsigned int)1 << i);
+        }
+
+      linesize += snprintf(irqfile->line + linesize, IRQ_BUFLEN - linesize,
+                           "\n");
+    }
+  else
+#endif
+    {
+      linesize = snprintf(irqfile->line, IRQ_LINELEN, HDR_FMT);
+    }
 
   copysize = procfs_memcpy(irqfile->line, linesize, irqfile->buffer,
                            irqfile->remaining, &irqfile->offset);
@@ -380,7 +510,16 @@ static ssize_t irq_read(FAR struct file *filep, FAR char *buffer,
    * each.
    */
 
-  irq_foreach(irq_callback, (FAR void *)irqfile);
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  if (irqfile->hist)
+    {
+      irq_foreach(irqhist_callback, (FAR void *)irqfile);
+    }
+  else
+#endif
+    {
+      irq_foreach(irq_callback, (FAR void *)irqfile);
+    }
 
   /* Update the file position */
 
@@ -436,15 +575,21 @@ static int irq_dup(FAR const struct file *oldp, FAR struct file *newp)
 
 static int irq_stat(const char *relpath, struct stat *buf)
 {
-  /* "irqs" is the only acceptable value for the relpath */
+  /* "irqs" (and "irqhist", if enabled) are the only acceptable values for
+   * the relpath.
+   */
 
+#ifdef CONFIG_SCHED_IRQMONITOR_HISTOGRAM
+  if (strcmp(relpath, "irqs") != 0 && strcmp(relpath, "irqhist") != 0)
+#else
   if (strcmp(relpath, "irqs") != 0)
+#endif
     {
       ferr("ERROR: relpath is '%s'\n", relpath);
       return -ENOENT;
     }
 
-  /* "irqs" is the name for a read-only file */
+  /* Both are names for read-only files */
 
   memset(buf, 0, sizeof(struct stat));
   buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
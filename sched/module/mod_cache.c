@@ -0,0 +1,271 @@
+/****************************************************************************
+ * sched/module/mod_cache.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <string.h>
+#include <debug.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/kmalloc.h>
+#include <nuttx/lib/modlib.h>
+
+#include "module/module.h"
+
+#ifdef CONFIG_MODULE_RELOCACHE
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The list of retained module images.  The list (and the cache records
+ * reachable from it) is protected by the module registry lock.
+ */
+
+static FAR struct mod_cache_s *g_mod_cache;
+static int g_mod_ncached;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mod_cache_prepare
+ *
+ * Description:
+ *   Create a cache record describing a freshly loaded and bound (but not
+ *   yet initialized) module so that its relocated image may be retained
+ *   when the module is later removed.  A pristine copy of the .data/.bss
+ *   region is captured so that it can be restored on reuse.
+ *
+ * Returned Value:
+ *   The new cache record, or NULL if the record could not be created.  A
+ *   NULL return is not an error; the module is simply not cacheable.
+ *
+ ****************************************************************************/
+
+FAR struct mod_cache_s *mod_cache_prepare(FAR const char *filename,
+                                          FAR struct mod_loadinfo_s
+                                          *loadinfo)
+{
+  FAR struct mod_cache_s *cache;
+  struct stat buf;
+  size_t namelen;
+  int ret;
+
+  /* Get the identity of the file.  If the file cannot be stat'ed, then
+   * a reloaded image could not be validated against it.
+   */
+
+  ret = stat(filename, &buf);
+  if (ret < 0)
+    {
+      return NULL;
+    }
+
+  /* Allocate and initialize the cache record */
+
+  cache = (FAR struct mod_cache_s *)
+    kmm_zalloc(sizeof(struct mod_cache_s));
+  if (cache == NULL)
+    {
+      return NULL;
+    }
+
+  namelen = strlen(filename) + 1;
+  cache->filename = (FAR char *)kmm_malloc(namelen);
+  if (cache->filename == NULL)
+    {
+      kmm_free(cache);
+      return NULL;
+    }
+
+  memcpy(cache->filename, filename, namelen);
+
+  /* Capture a pristine copy of the .data/.bss region.  This must be done
+   * before the module initializer runs.
+   */
+
+  if (loadinfo->datasize > 0)
+    {
+      cache->pristine = (FAR uint8_t *)kmm_malloc(loadinfo->datasize);
+      if (cache->pristine == NULL)
+        {
+          kmm_free(cache->filename);
+          kmm_free(cache);
+          return NULL;
+        }
+
+      memcpy(cache->pristine, (FAR const void *)loadinfo->datastart,
+             loadinfo->datasize);
+    }
+
+  cache->mtime     = buf.st_mtime;
+  cache->filesize  = buf.st_size;
+  cache->textalloc = loadinfo->textalloc;
+  cache->datastart = loadinfo->datastart;
+  cache->textsize  = loadinfo->textsize;
+  cache->datasize  = loadinfo->datasize;
+  cache->entry     = loadinfo->ehdr.e_entry;
+  return cache;
+}
+
+/****************************************************************************
+ * Name: mod_cache_take
+ *
+ * Description:
+ *   Search the cache for a retained image of the given file.  The file
+ *   identity (path, size, and modification time) must match the identity
+ *   recorded when the image was loaded.  On a match, the record is removed
+ *   from the cache list and ownership passes to the caller.
+ *
+ * Returned Value:
+ *   The matching cache record, or NULL if there is none.
+ *
+ ****************************************************************************/
+
+FAR struct mod_cache_s *mod_cache_take(FAR const char *filename)
+{
+  FAR struct mod_cache_s *cache;
+  FAR struct mod_cache_s *prev;
+  struct stat buf;
+  int ret;
+
+  ret = stat(filename, &buf);
+  if (ret < 0)
+    {
+      return NULL;
+    }
+
+  for (prev = NULL, cache = g_mod_cache;
+       cache != NULL;
+       prev = cache, cache = cache->flink)
+    {
+      if (strcmp(cache->filename, filename) == 0)
+        {
+          /* The retained image is only valid if the file has not been
+           * replaced since it was loaded.  If it has been, then drop the
+           * stale image from the cache.
+           */
+
+          if (cache->mtime != buf.st_mtime ||
+              cache->filesize != buf.st_size)
+            {
+              if (prev != NULL)
+                {
+                  prev->flink = cache->flink;
+                }
+              else
+                {
+                  g_mod_cache = cache->flink;
+                }
+
+              g_mod_ncached--;
+              mod_cache_discard(cache, true);
+              return NULL;
+            }
+
+          /* Detach the record and pass ownership to the caller */
+
+          if (prev != NULL)
+            {
+              prev->flink = cache->flink;
+            }
+          else
+            {
+              g_mod_cache = cache->flink;
+            }
+
+          g_mod_ncached--;
+          cache->flink = NULL;
+          return cache;
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Name: mod_cache_keep
+ *
+ * Description:
+ *   Add the cache record (and the module image that it retains) to the
+ *   cache list.  If the cache is full, the record and the image are freed
+ *   instead.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void mod_cache_keep(FAR struct mod_cache_s *cache)
+{
+  if (g_mod_ncached >= CONFIG_MODULE_RELOCACHE_MAXMODULES)
+    {
+      mod_cache_discard(cache, true);
+      return;
+    }
+
+  cache->flink = g_mod_cache;
+  g_mod_cache  = cache;
+  g_mod_ncached++;
+}
+
+/****************************************************************************
+ * Name: mod_cache_discard
+ *
+ * Description:
+ *   Free the cache record.  If 'freeimage' is true, then the retained
+ *   module memory allocations are freed as well; otherwise the caller
+ *   remains responsible for the module memory.
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void mod_cache_discard(FAR struct mod_cache_s *cache, bool freeimage)
+{
+  if (freeimage)
+    {
+#if defined(CONFIG_ARCH_USE_MODULE_TEXT)
+      up_module_text_free((FAR void *)cache->textalloc);
+      kmm_free((FAR void *)cache->datastart);
+#else
+      kmm_free((FAR void *)cache->textalloc);
+#endif
+    }
+
+  if (cache->pristine != NULL)
+    {
+      kmm_free(cache->pristine);
+    }
+
+  kmm_free(cache->filename);
+  kmm_free(cache);
+}
+
+#endif /* CONFIG_MODULE_RELOCACHE */
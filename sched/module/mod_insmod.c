@@ -51,6 +51,8 @@
 #include <nuttx/module.h>
 #include <nuttx/lib/modlib.h>
 
+#include "module/module.h"
+
 #ifdef CONFIG_MODULE
 
 /****************************************************************************
@@ -140,6 +142,96 @@ static void mod_dumpinitializer(mod_initializer_t initializer,
 # define mod_dumpinitializer(b,l)
 #endif
 
+/****************************************************************************
+ * Name: mod_insmod_cached
+ *
+ * Description:
+ *   Install a module from a retained, fully relocated image.  The pristine
+ *   .data/.bss content is restored and the module initializer is re-run;
+ *   no ELF processing is needed.
+ *
+ * Returned Value:
+ *   A non-NULL module handle on success; NULL with the errno variable set
+ *   on any failure.
+ *
+ * Assumptions:
+ *   The caller holds the lock on the module registry.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MODULE_RELOCACHE
+static FAR struct module_s *mod_insmod_cached(FAR struct mod_cache_s *cache,
+                                              FAR const char *modname)
+{
+  FAR struct module_s *modp;
+  mod_initializer_t initializer;
+  int ret;
+
+  /* Allocate a module registry entry to hold the module data */
+
+  modp = (FAR struct module_s *)kmm_zalloc(sizeof(struct module_s));
+  if (modp == NULL)
+    {
+      /* Return the image to the cache; it is still valid. */
+
+      mod_cache_keep(cache);
+      set_errno(ENOMEM);
+      return NULL;
+    }
+
+  /* Save the module name in the registry entry */
+
+  strncpy(modp->modname, modname, MODLIB_NAMEMAX);
+
+  /* Restore the pristine .data/.bss content captured when the module was
+   * first loaded.
+   */
+
+  if (cache->pristine != NULL)
+    {
+      memcpy((FAR void *)cache->datastart, cache->pristine,
+             cache->datasize);
+    }
+
+  /* Transfer the retained image to the new registry entry */
+
+#if defined(CONFIG_ARCH_USE_MODULE_TEXT)
+  modp->textalloc   = (FAR void *)cache->textalloc;
+  modp->dataalloc   = (FAR void *)cache->datastart;
+#else
+  modp->alloc       = (FAR void *)cache->textalloc;
+#endif
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MODULE)
+  modp->textsize    = cache->textsize;
+  modp->datasize    = cache->datasize;
+#endif
+
+  modp->cache       = cache;
+
+  /* Call the module initializer */
+
+  initializer = (mod_initializer_t)(cache->textalloc + cache->entry);
+#if defined(CONFIG_FS_PROCFS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_MODULE)
+  modp->initializer = initializer;
+#endif
+
+  ret = initializer(&modp->modinfo);
+  if (ret < 0)
+    {
+      binfo("Failed to initialize the module: %d\n", ret);
+      mod_cache_discard(cache, true);
+      kmm_free(modp);
+      set_errno(-ret);
+      return NULL;
+    }
+
+  /* Add the new module entry to the registry */
+
+  modlib_registry_add(modp);
+  return modp;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -175,6 +267,9 @@ FAR void *insmod(FAR const char *filename, FAR const char *modname)
   struct mod_loadinfo_s loadinfo;
   FAR struct module_s *modp;
   mod_initializer_t initializer;
+#ifdef CONFIG_MODULE_RELOCACHE
+  FAR struct mod_cache_s *cache;
+#endif
   int ret;
 
   DEBUGASSERT(filename != NULL && modname != NULL);
@@ -193,6 +288,20 @@ FAR void *insmod(FAR const char *filename, FAR const char *modname)
       goto errout_with_lock;
     }
 
+#ifdef CONFIG_MODULE_RELOCACHE
+  /* Do we have a retained, relocated image of this same file?  If so, then
+   * the module can be reinstalled without any ELF processing.
+   */
+
+  cache = mod_cache_take(filename);
+  if (cache != NULL)
+    {
+      modp = mod_insmod_cached(cache, modname);
+      modlib_registry_unlock();
+      return (FAR void *)modp;
+    }
+#endif
+
   /* Initialize the ELF library to load the program binary. */
 
   ret = modlib_initialize(filename, &loadinfo);
@@ -235,6 +344,16 @@ FAR void *insmod(FAR const char *filename, FAR const char *modname)
       goto errout_with_load;
     }
 
+#ifdef CONFIG_MODULE_RELOCACHE
+  /* Capture the identity of the file and a pristine copy of the
+   * .data/.bss region so that the relocated image may be retained when
+   * the module is removed.  This must be done before the initializer
+   * runs.  Failure simply means that this module is not cacheable.
+   */
+
+  modp->cache = mod_cache_prepare(filename, &loadinfo);
+#endif
+
   /* Save the load information */
 
 #if defined(CONFIG_ARCH_USE_MODULE_TEXT)
@@ -275,6 +394,14 @@ FAR void *insmod(FAR const char *filename, FAR const char *modname)
   return (FAR void *)modp;
 
 errout_with_load:
+#ifdef CONFIG_MODULE_RELOCACHE
+  if (modp->cache != NULL)
+    {
+      mod_cache_discard(modp->cache, false);
+      modp->cache = NULL;
+    }
+#endif
+
   modlib_unload(&loadinfo);
   modlib_undepend(modp);
 errout_with_registry_entry:
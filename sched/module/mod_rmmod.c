@@ -40,6 +40,7 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdbool.h>
 #include <assert.h>
 #include <errno.h>
 
@@ -47,6 +48,8 @@
 #include <nuttx/module.h>
 #include <nuttx/lib/modlib.h>
 
+#include "module/module.h"
+
 #ifdef CONFIG_MODULE
 
 /****************************************************************************
@@ -126,6 +129,53 @@ int rmmod(FAR void *handle)
 #endif
     }
 
+#ifdef CONFIG_MODULE_RELOCACHE
+  /* If a cache record was prepared when the module was loaded, then the
+   * fully relocated image may be retained for a later insmod of the same
+   * file.  Modules that depend on other modules are not retained:  The
+   * image holds absolute addresses into the exporting modules which would
+   * be stale by the time that the image is reused.
+   */
+
+  if (modp->cache != NULL)
+    {
+      bool cacheable = true;
+#if CONFIG_MODLIB_MAXDEPEND > 0
+      int i;
+
+      for (i = 0; i < CONFIG_MODLIB_MAXDEPEND; i++)
+        {
+          if (modp->dependencies[i] != NULL)
+            {
+              cacheable = false;
+              break;
+            }
+        }
+#endif
+
+      if (cacheable)
+        {
+          /* Pass the module memory to the cache and nullify the
+           * allocations so that the memory is not freed below.
+           */
+
+          mod_cache_keep(modp->cache);
+#if defined(CONFIG_ARCH_USE_MODULE_TEXT)
+          modp->textalloc = NULL;
+          modp->dataalloc = NULL;
+#else
+          modp->alloc     = NULL;
+#endif
+        }
+      else
+        {
+          mod_cache_discard(modp->cache, false);
+        }
+
+      modp->cache = NULL;
+    }
+#endif
+
   /* Release resources held by the module */
 
 #if defined(CONFIG_ARCH_USE_MODULE_TEXT)
@@ -0,0 +1,158 @@
+/****************************************************************************
+ * sched/module/module.h
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __SCHED_MODULE_MODULE_H
+#define __SCHED_MODULE_MODULE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <nuttx/lib/modlib.h>
+
+#ifdef CONFIG_MODULE_RELOCACHE
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* This structure retains the fully relocated image of an unloaded module
+ * together with the identity of the file that it was loaded from.  While
+ * the module is loaded, the structure is owned by the module registry
+ * entry; after rmmod it may be kept on the cache list so that a subsequent
+ * insmod of the same, unmodified file can reuse the image without
+ * re-running the full ELF load and relocation logic.
+ */
+
+struct mod_cache_s
+{
+  FAR struct mod_cache_s *flink;       /* Supports a singly linked list */
+  FAR char *filename;                  /* Full path to the module file */
+  time_t mtime;                        /* File modification time */
+  off_t filesize;                      /* File size */
+  uintptr_t textalloc;                 /* Retained .text memory allocation */
+  uintptr_t datastart;                 /* Start of the .data/.bss region */
+  size_t textsize;                     /* Size of the .text allocation */
+  size_t datasize;                     /* Size of the .data/.bss region */
+  uintptr_t entry;                     /* Initializer offset (e_entry) */
+  FAR uint8_t *pristine;               /* Pre-initialization copy of .data/.bss */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mod_cache_prepare
+ *
+ * Description:
+ *   Create a cache record describing a freshly loaded and bound (but not
+ *   yet initialized) module so that its relocated image may be retained
+ *   when the module is later removed.  A pristine copy of the .data/.bss
+ *   region is captured so that it can be restored on reuse.
+ *
+ * Input Parameters:
+ *   filename - Full path to the module file
+ *   loadinfo - Describes the loaded module image
+ *
+ * Returned Value:
+ *   The new cache record, or NULL if the record could not be created.  A
+ *   NULL return is not an error; the module is simply not cacheable.
+ *
+ * Assumptions:
+ *   The caller holds the lock on the module registry.
+ *
+ ****************************************************************************/
+
+FAR struct mod_cache_s *mod_cache_prepare(FAR const char *filename,
+                                          FAR struct mod_loadinfo_s
+                                          *loadinfo);
+
+/****************************************************************************
+ * Name: mod_cache_take
+ *
+ * Description:
+ *   Search the cache for a retained image of the given file.  The file
+ *   identity (path, size, and modification time) must match the identity
+ *   recorded when the image was loaded.  On a match, the record is removed
+ *   from the cache list and ownership passes to the caller.
+ *
+ * Input Parameters:
+ *   filename - Full path to the module file
+ *
+ * Returned Value:
+ *   The matching cache record, or NULL if there is none.
+ *
+ * Assumptions:
+ *   The caller holds the lock on the module registry.
+ *
+ ****************************************************************************/
+
+FAR struct mod_cache_s *mod_cache_take(FAR const char *filename);
+
+/****************************************************************************
+ * Name: mod_cache_keep
+ *
+ * Description:
+ *   Add the cache record (and the module image that it retains) to the
+ *   cache list.  If the cache is full, the record and the image are freed
+ *   instead.
+ *
+ * Input Parameters:
+ *   cache - The cache record from mod_cache_prepare() or mod_cache_take()
+ *
+ * Returned Value:
+ *   None.
+ *
+ * Assumptions:
+ *   The caller holds the lock on the module registry.
+ *
+ ****************************************************************************/
+
+void mod_cache_keep(FAR struct mod_cache_s *cache);
+
+/****************************************************************************
+ * Name: mod_cache_discard
+ *
+ * Description:
+ *   Free the cache record.  If 'freeimage' is true, then the retained
+ *   module memory allocations are freed as well; otherwise the caller
+ *   remains responsible for the module memory.
+ *
+ * Input Parameters:
+ *   cache     - The cache record to be freed
+ *   freeimage - True: also free the retained module image
+ *
+ * Returned Value:
+ *   None.
+ *
+ ****************************************************************************/
+
+void mod_cache_discard(FAR struct mod_cache_s *cache, bool freeimage);
+
+#endif /* CONFIG_MODULE_RELOCACHE */
+#endif /* __SCHED_MODULE_MODULE_H */
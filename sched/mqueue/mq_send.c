@@ -25,7 +25,9 @@
 #include  <nuttx/config.h>
 
 #include  <sys/types.h>
+#include  <sys/uio.h>
 #include  <mqueue.h>
+#include  <string.h>
 #include  <errno.h>
 #include  <debug.h>
 
@@ -33,6 +35,7 @@
 #include  <nuttx/arch.h>
 #include  <nuttx/cancelpt.h>
 
+#include  "sched/sched.h"
 #include  "mqueue/mqueue.h"
 
 /****************************************************************************
@@ -152,6 +155,207 @@ int nxmq_send(mqd_t mqdes, FAR const char *msg, size_t msglen,
   return ret;
 }
 
+/****************************************************************************
+ * Name: nxmq_sendv
+ *
+ * Description:
+ *   This function adds a batch of messages to the message queue (mqdes)
+ *   under a single critical section.  This is an internal OS interface
+ *   with no POSIX equivalent.  It is functionally equivalent to calling
+ *   nxmq_send() once for each entry of 'msgv' except that the cost of
+ *   entering and leaving the critical section and of waking up waiting
+ *   readers is paid only once for the whole batch.
+ *
+ *   All messages in the batch share the same priority.  If the message
+ *   queue becomes full while the batch is being delivered, then delivery
+ *   stops short:  This function will block waiting for space only before
+ *   the first message has been enqueued; after that, it returns the
+ *   number of messages actually sent.
+ *
+ * Input Parameters:
+ *   mqdes - Message queue descriptor
+ *   msgv  - Array of messages to send.  Each entry provides the base
+ *           address and the length in bytes of one message.
+ *   msgc  - The number of entries in the msgv[] array
+ *   prio  - The priority of all messages in the batch
+ *
+ * Returned Value:
+ *   This is an internal OS interface and should not be used by
+ *   applications.  On success, the number of messages enqueued (greater
+ *   than zero) is returned.  A negated errno value is returned if no
+ *   message could be sent (see nxmq_send() for the list of valid return
+ *   values).
+ *
+ ****************************************************************************/
+
+int nxmq_sendv(mqd_t mqdes, FAR const struct iovec *msgv, int msgc,
+               unsigned int prio)
+{
+  FAR struct mqueue_inode_s *msgq;
+  FAR struct mqueue_msg_s *mqmsg;
+  FAR struct tcb_s *btcb;
+  sq_queue_t batch;
+  irqstate_t flags;
+  int nsent;
+  int ret;
+  int i;
+
+  /* Verify the parameters of every message before committing to any */
+
+  if (msgv == NULL || msgc <= 0)
+    {
+      return -EINVAL;
+    }
+
+  for (i = 0; i < msgc; i++)
+    {
+      ret = nxmq_verify_send(mqdes, msgv[i].iov_base, msgv[i].iov_len,
+                             prio);
+      if (ret < 0)
+        {
+          return ret;
+        }
+    }
+
+  /* Allocate and initialize all of the message structures up front so
+   * that no allocation or data copy is performed while the critical
+   * section is held.
+   */
+
+  sq_init(&batch);
+  nsent = 0;
+
+  for (i = 0; i < msgc; i++)
+    {
+      mqmsg = nxmq_alloc_msg();
+      if (mqmsg == NULL)
+        {
+          ret = -ENOMEM;
+          goto errout_with_batch;
+        }
+
+      mqmsg->priority = prio;
+      mqmsg->msglen   = msgv[i].iov_len;
+      memcpy((FAR void *)mqmsg->mail, msgv[i].iov_base, msgv[i].iov_len);
+      sq_addlast((FAR sq_entry_t *)mqmsg, &batch);
+    }
+
+  /* Insert the whole batch under a single critical section */
+
+  sched_lock();
+  msgq = mqdes->msgq;
+  ret  = OK;
+
+  flags = enter_critical_section();
+  while ((mqmsg = (FAR struct mqueue_msg_s *)sq_remfirst(&batch)) != NULL)
+    {
+      /* Is the message queue FULL? */
+
+      if (msgq->nmsgs >= msgq->maxmsgs)
+        {
+          /* Yes.. We will wait for space to become available only before
+           * the first message of the batch has been enqueued.  After that
+           * the batch is simply cut short.
+           */
+
+          if (nsent == 0 && !up_interrupt_context())
+            {
+              ret = nxmq_wait_send(mqdes);
+            }
+          else
+            {
+              ret = -EAGAIN;
+            }
+
+          if (ret < 0)
+            {
+              sq_addfirst((FAR sq_entry_t *)mqmsg, &batch);
+              break;
+            }
+        }
+
+      /* Add the message at the position appropriate for its priority */
+
+      nxmq_insert_message(msgq, mqmsg);
+      msgq->nmsgs++;
+      nsent++;
+    }
+
+  leave_critical_section(flags);
+
+  if (nsent > 0)
+    {
+      /* Check if we need to notify any tasks that are attached to the
+       * message queue
+       */
+
+      if (msgq->ntmqdes)
+        {
+          struct sigevent event;
+          pid_t pid;
+
+          /* Remove the message notification data from the message
+           * queue.
+           */
+
+          memcpy(&event, &msgq->ntevent, sizeof(struct sigevent));
+          pid = msgq->ntpid;
+
+          /* Detach the notification */
+
+          memset(&msgq->ntevent, 0, sizeof(struct sigevent));
+          msgq->ntpid   = INVALID_PROCESS_ID;
+          msgq->ntmqdes = NULL;
+
+          /* Notification the client */
+
+          DEBUGVERIFY(nxsig_notification(pid, &event,
+                                         SI_MESGQ, &msgq->ntwork));
+        }
+
+      /* Wake up one task waiting for the MQ not empty event for each
+       * message that was enqueued.
+       */
+
+      flags = enter_critical_section();
+      for (i = 0; i < nsent && msgq->nwaitnotempty > 0; i++)
+        {
+          /* Find the highest priority task that is waiting for this
+           * queue to be non-empty in the g_waitingformqnotempty list.
+           */
+
+          for (btcb = (FAR struct tcb_s *)g_waitingformqnotempty.head;
+               btcb && btcb->msgwaitq != msgq;
+               btcb = btcb->flink)
+            {
+            }
+
+          /* If one was found, unblock it */
+
+          DEBUGASSERT(btcb);
+
+          btcb->msgwaitq = NULL;
+          msgq->nwaitnotempty--;
+          up_unblock_task(btcb);
+        }
+
+      leave_critical_section(flags);
+    }
+
+  sched_unlock();
+
+errout_with_batch:
+
+  /* Free any messages that were never delivered */
+
+  while ((mqmsg = (FAR struct mqueue_msg_s *)sq_remfirst(&batch)) != NULL)
+    {
+      nxmq_free_msg(mqmsg);
+    }
+
+  return nsent > 0 ? nsent : ret;
+}
+
 /****************************************************************************
  * Name: mq_send
  *
@@ -299,6 +299,69 @@ int nxmq_wait_send(mqd_t mqdes)
   return OK;
 }
 
+/****************************************************************************
+ * Name: nxmq_insert_message
+ *
+ * Description:
+ *   Insert one message into the pending message list of a message queue at
+ *   the position appropriate for its priority.  As an important special
+ *   case, a message whose priority is not higher than the priority of the
+ *   message at the tail of the list is simply appended.  That makes the
+ *   insertion O(1) for the common stream of same-priority messages; the
+ *   list is walked only when a message must overtake lower priority
+ *   messages already in the queue.
+ *
+ * Input Parameters:
+ *   msgq  - Message queue
+ *   mqmsg - Message to insert.  The priority field must already be set.
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ * - Executes within a critical section established by the caller.
+ *
+ ****************************************************************************/
+
+void nxmq_insert_message(FAR struct mqueue_inode_s *msgq,
+                         FAR struct mqueue_msg_s *mqmsg)
+{
+  FAR struct mqueue_msg_s *next;
+  FAR struct mqueue_msg_s *prev;
+
+  /* The message list is maintained in descending priority order.  If the
+   * new message does not have to overtake the message at the tail of the
+   * list, then it can be appended without any search.
+   */
+
+  prev = (FAR struct mqueue_msg_s *)msgq->msglist.tail;
+  if (prev == NULL || mqmsg->priority <= prev->priority)
+    {
+      sq_addlast((FAR sq_entry_t *)mqmsg, &msgq->msglist);
+      return;
+    }
+
+  /* Search the message list to find the location to insert the new
+   * message.
+   */
+
+  for (prev = NULL, next = (FAR struct mqueue_msg_s *)msgq->msglist.head;
+       next && mqmsg->priority <= next->priority;
+       prev = next, next = next->next);
+
+  /* Add the message at the right place */
+
+  if (prev)
+    {
+      sq_addafter((FAR sq_entry_t *)prev, (FAR sq_entry_t *)mqmsg,
+                  &msgq->msglist);
+    }
+  else
+    {
+      sq_addfirst((FAR sq_entry_t *)mqmsg, &msgq->msglist);
+    }
+}
+
 /****************************************************************************
  * Name: nxmq_do_send
  *
@@ -325,8 +388,6 @@ int nxmq_do_send(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg,
 {
   FAR struct tcb_s *btcb;
   FAR struct mqueue_inode_s *msgq;
-  FAR struct mqueue_msg_s *next;
-  FAR struct mqueue_msg_s *prev;
   irqstate_t flags;
 
   /* Get a pointer to the message queue */
@@ -346,26 +407,7 @@ int nxmq_do_send(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg,
   /* Insert the new message in the message queue */
 
   flags = enter_critical_section();
-
-  /* Search the message list to find the location to insert the new
-   * message. Each is list is maintained in ascending priority order.
-   */
-
-  for (prev = NULL, next = (FAR struct mqueue_msg_s *)msgq->msglist.head;
-       next && prio <= next->priority;
-       prev = next, next = next->next);
-
-  /* Add the message at the right place */
-
-  if (prev)
-    {
-      sq_addafter((FAR sq_entry_t *)prev, (FAR sq_entry_t *)mqmsg,
-                  &msgq->msglist);
-    }
-  else
-    {
-      sq_addfirst((FAR sq_entry_t *)mqmsg, &msgq->msglist);
-    }
+  nxmq_insert_message(msgq, mqmsg);
 
   /* Increment the count of messages in the queue */
 
@@ -146,6 +146,8 @@ int nxmq_verify_send(mqd_t mqdes, FAR const char *msg, size_t msglen,
                      unsigned int prio);
 FAR struct mqueue_msg_s *nxmq_alloc_msg(void);
 int nxmq_wait_send(mqd_t mqdes);
+void nxmq_insert_message(FAR struct mqueue_inode_s *msgq,
+                         FAR struct mqueue_msg_s *mqmsg);
 int nxmq_do_send(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg,
                  FAR const char *msg, size_t msglen, unsigned int prio);
 
@@ -93,6 +93,7 @@ extern "C"
 
 struct pthread_tcb_s; /* Forward reference */
 struct task_group_s;  /* Forward reference */
+struct tcb_s;         /* Forward reference */
 
 void weak_function pthread_initialize(void);
 int pthread_setup_scheduler(FAR struct pthread_tcb_s *tcb, int priority,
@@ -109,6 +110,14 @@ FAR struct join_s *pthread_findjoininfo(FAR struct task_group_s *group,
                                         pid_t pid);
 void pthread_release(FAR struct task_group_s *group);
 
+#ifdef CONFIG_PTHREAD_CACHE
+FAR struct pthread_tcb_s *pthread_tcb_cache_alloc(size_t stacksize);
+bool pthread_tcb_cache_claim(FAR struct tcb_s *tcb, uint8_t ttype);
+void pthread_tcb_cache_commit(FAR struct tcb_s *tcb);
+FAR struct join_s *pthread_join_alloc(void);
+void pthread_join_free(FAR struct join_s *pjoin);
+#endif
+
 int pthread_sem_take(FAR sem_t *sem, FAR const struct timespec *abs_timeout,
                      bool intr);
 #ifdef CONFIG_PTHREAD_MUTEX_UNSAFE
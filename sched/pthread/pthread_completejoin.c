@@ -284,5 +284,9 @@ void pthread_destroyjoin(FAR struct task_group_s *group,
 
   /* And deallocate the pjoin structure */
 
+#ifdef CONFIG_PTHREAD_CACHE
+  pthread_join_free(pjoin);
+#else
   kmm_free(pjoin);
+#endif
 }
@@ -42,6 +42,7 @@
 #include "sched/sched.h"
 #include "pthread/pthread.h"
 #include "clock/clock.h"
+#include "semaphore/semaphore.h"
 #include "signal/signal.h"
 
 /****************************************************************************
@@ -241,6 +242,17 @@ int pthread_cond_clockwait(FAR pthread_cond_t *cond,
               uint8_t type;
               int16_t nlocks;
 #endif
+#ifdef CONFIG_PTHREAD_WAITMORPH
+              bool morphed = false;
+
+              /* Bind the mutex to the condition variable so that
+               * pthread_cond_signal() can transfer us directly to the
+               * mutex wait queue if the signaler still holds the mutex.
+               */
+
+              cond->mutex = mutex;
+#endif
+
               /* Give up the mutex */
 
               mutex->pid = -1;
@@ -275,6 +287,17 @@ int pthread_cond_clockwait(FAR pthread_cond_t *cond,
 
                   status = nxsem_wait((FAR sem_t *)&cond->sem);
 
+#ifdef CONFIG_PTHREAD_WAITMORPH
+                  /* Check whether the wakeup was the result of a wait-
+                   * morphing transfer.  The marker must be collected (and
+                   * cleared) even if the wait failed:  a transferred wait
+                   * can still time out or be interrupted, in which case
+                   * the mutex was NOT acquired.
+                   */
+
+                  morphed = nxsem_transfer_received() && status == OK;
+#endif
+
                   /* Did we get the condition semaphore. */
 
                   if (status < 0)
@@ -309,7 +332,21 @@ int pthread_cond_clockwait(FAR pthread_cond_t *cond,
 
               sinfo("Re-locking...\n");
 
-              status = pthread_mutex_take(mutex, NULL, false);
+#ifdef CONFIG_PTHREAD_WAITMORPH
+              if (morphed)
+                {
+                  /* The releasing holder granted us the mutex directly
+                   * when it unlocked; we must not take it a second time.
+                   */
+
+                  status = OK;
+                }
+              else
+#endif
+                {
+                  status = pthread_mutex_take(mutex, NULL, false);
+                }
+
               if (status == OK)
                 {
                   mutex->pid    = mypid;
@@ -25,10 +25,12 @@
 #include <nuttx/config.h>
 
 #include <pthread.h>
+#include <unistd.h>
 #include <errno.h>
 #include <debug.h>
 
 #include "pthread/pthread.h"
+#include "semaphore/semaphore.h"
 
 /****************************************************************************
  * Public Functions
@@ -90,8 +92,30 @@ int pthread_cond_signal(FAR pthread_cond_t *cond)
           sinfo("sval=%d\n", sval);
           if (sval < 0)
             {
-              sinfo("Signalling...\n");
-              ret = pthread_sem_give((FAR sem_t *)&cond->sem);
+#ifdef CONFIG_PTHREAD_WAITMORPH
+              FAR struct pthread_mutex_s *mutex = cond->mutex;
+
+              /* If the signaling thread still holds the mutex associated
+               * with the condition variable, then waking the waiter now
+               * would only cause it to block again re-acquiring the mutex.
+               * Instead, transfer the waiter directly to the mutex wait
+               * queue; it will be awakened when the mutex is released.
+               * The mutex pointer was bound by pthread_cond_wait() and is
+               * necessarily in use while there are waiters.
+               */
+
+              if (mutex != NULL && mutex->pid == (int)getpid() &&
+                  nxsem_transfer((FAR sem_t *)&cond->sem,
+                                 (FAR sem_t *)&mutex->sem) == OK)
+                {
+                  sinfo("Transferred waiter to mutex\n");
+                }
+              else
+#endif
+                {
+                  sinfo("Signalling...\n");
+                  ret = pthread_sem_give((FAR sem_t *)&cond->sem);
+                }
             }
         }
     }
@@ -24,6 +24,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdbool.h>
 #include <unistd.h>
 #include <pthread.h>
 #include <sched.h>
@@ -33,6 +34,7 @@
 #include <nuttx/cancelpt.h>
 
 #include "pthread/pthread.h"
+#include "semaphore/semaphore.h"
 
 /****************************************************************************
  * Public Functions
@@ -87,12 +89,25 @@ int pthread_cond_wait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex)
       uint8_t type;
       int16_t nlocks;
 #endif
+#ifdef CONFIG_PTHREAD_WAITMORPH
+      bool morphed;
+#endif
 
       /* Give up the mutex */
 
       sinfo("Give up mutex / take cond\n");
 
       sched_lock();
+
+#ifdef CONFIG_PTHREAD_WAITMORPH
+      /* Bind the mutex to the condition variable so that
+       * pthread_cond_signal() can transfer us directly to the mutex wait
+       * queue if the signaler still holds the mutex.
+       */
+
+      cond->mutex = mutex;
+#endif
+
       mutex->pid = -1;
 #ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
       mflags     = mutex->flags;
@@ -108,6 +123,17 @@ int pthread_cond_wait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex)
        */
 
       status = pthread_sem_take((FAR sem_t *)&cond->sem, NULL, false);
+
+#ifdef CONFIG_PTHREAD_WAITMORPH
+      /* Check whether the wakeup was the result of a wait-morphing
+       * transfer.  The marker must be collected (and cleared) even if the
+       * wait failed:  a transferred wait can still be interrupted by a
+       * signal or canceled, in which case the mutex was NOT acquired.
+       */
+
+      morphed = nxsem_transfer_received() && status == OK;
+#endif
+
       if (ret == OK)
         {
           /* Report the first failure that occurs */
@@ -126,7 +152,21 @@ int pthread_cond_wait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex)
 
       sinfo("Reacquire mutex...\n");
 
-      status = pthread_mutex_take(mutex, NULL, false);
+#ifdef CONFIG_PTHREAD_WAITMORPH
+      if (morphed)
+        {
+          /* The releasing holder granted us the mutex directly when it
+           * unlocked; we must not take it a second time.
+           */
+
+          status = OK;
+        }
+      else
+#endif
+        {
+          status = pthread_mutex_take(mutex, NULL, false);
+        }
+
       if (ret == OK)
         {
           /* Report the first failure that occurs */
@@ -244,8 +244,25 @@ int pthread_create(FAR pthread_t *thread, FAR const pthread_attr_t *attr,
 
   /* Allocate a TCB for the new task. */
 
-  ptcb = (FAR struct pthread_tcb_s *)
-            kmm_zalloc(sizeof(struct pthread_tcb_s));
+#ifdef CONFIG_PTHREAD_CACHE
+  /* First try to recycle a TCB/stack pair left behind by an exited pthread
+   * that used a stack of the same size.  A caller-provided stack can never
+   * match a cached pair.
+   */
+
+  ptcb = NULL;
+  if (!attr->stackaddr)
+    {
+      ptcb = pthread_tcb_cache_alloc(attr->stacksize);
+    }
+
+  if (!ptcb)
+#endif
+    {
+      ptcb = (FAR struct pthread_tcb_s *)
+                kmm_zalloc(sizeof(struct pthread_tcb_s));
+    }
+
   if (!ptcb)
     {
       serr("ERROR: Failed to allocate TCB\n");
@@ -276,7 +293,11 @@ int pthread_create(FAR pthread_t *thread, FAR const pthread_attr_t *attr,
 
   /* Allocate a detachable structure to support pthread_join logic */
 
+#ifdef CONFIG_PTHREAD_CACHE
+  pjoin = pthread_join_alloc();
+#else
   pjoin = (FAR struct join_s *)kmm_zalloc(sizeof(struct join_s));
+#endif
   if (!pjoin)
     {
       serr("ERROR: Failed to allocate join\n");
@@ -296,12 +317,32 @@ int pthread_create(FAR pthread_t *thread, FAR const pthread_attr_t *attr,
       ret = up_use_stack((FAR struct tcb_s *)ptcb, attr->stackaddr,
                          attr->stacksize);
     }
+#ifdef CONFIG_PTHREAD_CACHE
+  else if (ptcb->cmn.stack_alloc_ptr)
+    {
+      /* A recycled stack is already attached to the TCB */
+
+      ret = OK;
+    }
+#endif
   else
     {
       /* Allocate the stack for the TCB */
 
       ret = up_create_stack((FAR struct tcb_s *)ptcb, attr->stacksize,
                             TCB_FLAG_TTYPE_PTHREAD);
+
+#ifdef CONFIG_PTHREAD_CACHE
+      if (ret == OK)
+        {
+          /* Remember the requested stack size so that the TCB/stack pair
+           * can be matched against future pthread_create() calls when it
+           * is recycled.
+           */
+
+          ptcb->stacksize = attr->stacksize;
+        }
+#endif
     }
 
   if (ret != OK)
@@ -595,7 +636,11 @@ int pthread_create(FAR pthread_t *thread, FAR const pthread_attr_t *attr,
   return ret;
 
 errout_with_join:
+#ifdef CONFIG_PTHREAD_CACHE
+  pthread_join_free(pjoin);
+#else
   kmm_free(pjoin);
+#endif
   ptcb->joininfo = NULL;
 
 errout_with_tcb:
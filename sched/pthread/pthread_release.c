@@ -94,7 +94,11 @@ void pthread_release(FAR struct task_group_s *group)
 
       /* And deallocate the join structure */
 
+#ifdef CONFIG_PTHREAD_CACHE
+      pthread_join_free(join);
+#else
       kmm_free(join);
+#endif
     }
 
   /* Destroy the join list semaphore */
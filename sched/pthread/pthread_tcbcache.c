@@ -0,0 +1,302 @@
+/****************************************************************************
+ * sched/pthread/pthread_tcbcache.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <string.h>
+#include <queue.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+#include <nuttx/kmalloc.h>
+
+#include "pthread/pthread.h"
+
+#ifdef CONFIG_PTHREAD_CACHE
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* Cache statistics sampled by the procfs "pthreadcache" entry */
+
+volatile uint16_t g_pthread_cache_count;
+volatile uint32_t g_pthread_cache_hits;
+volatile uint32_t g_pthread_cache_misses;
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The list of recycled TCB/stack pairs.  A TCB on this list retains its
+ * stack allocation; everything else in the TCB is stale and will be
+ * re-initialized when the TCB is recycled.  The TCB is linked through its
+ * leading flink pointer.
+ */
+
+static sq_queue_t g_pthread_cache;
+
+/* A free list of join_s structures recycled by pthread_join_free() */
+
+static FAR struct join_s *g_join_free;
+static uint16_t g_join_count;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_tcb_cache_alloc
+ *
+ * Description:
+ *   Try to allocate a pthread TCB with an attached stack from the cache of
+ *   recycled TCB/stack pairs.  Only a cached stack whose original requested
+ *   size exactly matches 'stacksize' will be reused.
+ *
+ * Input Parameters:
+ *   stacksize - The requested stack size in bytes
+ *
+ * Returned Value:
+ *   On success, a zeroed TCB with stack_alloc_ptr and the stack-related
+ *   fields already set up is returned.  NULL is returned if no matching
+ *   pair is cached; the caller then falls back to the normal allocation
+ *   path.
+ *
+ ****************************************************************************/
+
+FAR struct pthread_tcb_s *pthread_tcb_cache_alloc(size_t stacksize)
+{
+  FAR struct pthread_tcb_s *ptcb;
+  FAR sq_entry_t *curr;
+  FAR sq_entry_t *prev;
+  FAR void *stackptr;
+  irqstate_t flags;
+
+  /* Search the cache for a TCB holding a stack of the requested size */
+
+  flags = enter_critical_section();
+  for (prev = NULL, curr = g_pthread_cache.head;
+       curr != NULL;
+       prev = curr, curr = curr->flink)
+    {
+      if (((FAR struct pthread_tcb_s *)curr)->stacksize == stacksize)
+        {
+          break;
+        }
+    }
+
+  if (curr != NULL)
+    {
+      if (prev != NULL)
+        {
+          sq_remafter(prev, &g_pthread_cache);
+        }
+      else
+        {
+          sq_remfirst(&g_pthread_cache);
+        }
+
+      g_pthread_cache_count--;
+      g_pthread_cache_hits++;
+    }
+  else
+    {
+      g_pthread_cache_misses++;
+    }
+
+  leave_critical_section(flags);
+
+  if (curr == NULL)
+    {
+      return NULL;
+    }
+
+  /* Scrub the stale TCB content, preserving only the stack allocation */
+
+  ptcb     = (FAR struct pthread_tcb_s *)curr;
+  stackptr = ptcb->cmn.stack_alloc_ptr;
+
+  memset(ptcb, 0, sizeof(struct pthread_tcb_s));
+
+  /* Re-attach the recycled stack to the scrubbed TCB */
+
+  if (up_use_stack(&ptcb->cmn, stackptr, stacksize) != OK)
+    {
+      ptcb->cmn.stack_alloc_ptr = stackptr;
+      up_release_stack(&ptcb->cmn, TCB_FLAG_TTYPE_PTHREAD);
+      kmm_free(ptcb);
+      return NULL;
+    }
+
+  ptcb->stacksize = stacksize;
+  return ptcb;
+}
+
+/****************************************************************************
+ * Name: pthread_tcb_cache_claim
+ *
+ * Description:
+ *   Called from nxsched_release_tcb() at the point where the thread's
+ *   stack would be freed.  If the TCB is eligible for recycling, reserve a
+ *   slot in the cache and keep the stack attached.  The TCB is actually
+ *   inserted into the cache later by pthread_tcb_cache_commit(), after the
+ *   remaining TCB resources have been released.
+ *
+ * Input Parameters:
+ *   tcb   - The TCB being released
+ *   ttype - The type of the TCB being released
+ *
+ * Returned Value:
+ *   true if the TCB/stack pair was claimed for the cache.  In that case
+ *   the caller must skip up_release_stack() and must call
+ *   pthread_tcb_cache_commit() instead of freeing the TCB.
+ *
+ ****************************************************************************/
+
+bool pthread_tcb_cache_claim(FAR struct tcb_s *tcb, uint8_t ttype)
+{
+  irqstate_t flags;
+
+  /* Only pthread TCBs are cached, and only if the stack was allocated by
+   * up_create_stack() (a non-zero stacksize excludes caller-provided
+   * stacks set up with pthread_attr_setstack()).
+   */
+
+  if (ttype != TCB_FLAG_TTYPE_PTHREAD ||
+      ((FAR struct pthread_tcb_s *)tcb)->stacksize == 0)
+    {
+      return false;
+    }
+
+  /* Reserve a slot in the cache if one is available */
+
+  flags = enter_critical_section();
+  if (g_pthread_cache_count >= CONFIG_PTHREAD_CACHE_MAXTCBS)
+    {
+      leave_critical_section(flags);
+      return false;
+    }
+
+  g_pthread_cache_count++;
+  leave_critical_section(flags);
+  return true;
+}
+
+/****************************************************************************
+ * Name: pthread_tcb_cache_commit
+ *
+ * Description:
+ *   Insert a TCB previously claimed by pthread_tcb_cache_claim() into the
+ *   cache.  The slot was already accounted for by the claim.
+ *
+ * Input Parameters:
+ *   tcb - The TCB to be cached
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pthread_tcb_cache_commit(FAR struct tcb_s *tcb)
+{
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  sq_addfirst((FAR sq_entry_t *)tcb, &g_pthread_cache);
+  leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: pthread_join_alloc
+ *
+ * Description:
+ *   Allocate a join_s structure, preferring the free list of recycled
+ *   structures over the heap.
+ *
+ * Returned Value:
+ *   A zeroed join_s structure, or NULL on allocation failure.
+ *
+ ****************************************************************************/
+
+FAR struct join_s *pthread_join_alloc(void)
+{
+  FAR struct join_s *pjoin;
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  pjoin = g_join_free;
+  if (pjoin != NULL)
+    {
+      g_join_free = pjoin->next;
+      g_join_count--;
+    }
+
+  leave_critical_section(flags);
+
+  if (pjoin != NULL)
+    {
+      memset(pjoin, 0, sizeof(struct join_s));
+      return pjoin;
+    }
+
+  return (FAR struct join_s *)kmm_zalloc(sizeof(struct join_s));
+}
+
+/****************************************************************************
+ * Name: pthread_join_free
+ *
+ * Description:
+ *   Release a join_s structure, returning it to the free list if there is
+ *   room.
+ *
+ * Input Parameters:
+ *   pjoin - The join structure to be released
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void pthread_join_free(FAR struct join_s *pjoin)
+{
+  irqstate_t flags;
+
+  flags = enter_critical_section();
+  if (g_join_count < CONFIG_PTHREAD_CACHE_MAXTCBS)
+    {
+      pjoin->next = g_join_free;
+      g_join_free = pjoin;
+      g_join_count++;
+      leave_critical_section(flags);
+      return;
+    }
+
+  leave_critical_section(flags);
+  kmm_free(pjoin);
+}
+
+#endif /* CONFIG_PTHREAD_CACHE */
@@ -362,6 +362,10 @@ bool nxsched_add_prioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list);
 void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
                                uint8_t task_state);
 bool nxsched_merge_pending(void);
+#ifdef CONFIG_SCHED_READYQ_BITMAP
+bool nxsched_readyq_insert(FAR struct tcb_s *btcb);
+void nxsched_readyq_remove(FAR struct tcb_s *rtcb);
+#endif
 void nxsched_add_blocked(FAR struct tcb_s *btcb, tstate_t task_state);
 void nxsched_remove_blocked(FAR struct tcb_s *btcb);
 int  nxsched_set_priority(FAR struct tcb_s *tcb, int sched_priority);
@@ -406,6 +410,13 @@ uint32_t nxsched_process_sporadic(FAR struct tcb_s *tcb, uint32_t ticks,
 void nxsched_sporadic_lowpriority(FAR struct tcb_s *tcb);
 #endif
 
+#ifdef CONFIG_SCHED_EDF
+int  nxsched_edf_set(FAR struct tcb_s *tcb,
+                     FAR const struct sched_param *param);
+void nxsched_edf_newjob(FAR struct tcb_s *tcb);
+bool nxsched_edf_insert(FAR struct tcb_s *btcb);
+#endif
+
 #ifdef CONFIG_SIG_SIGSTOP_ACTION
 void nxsched_suspend(FAR struct tcb_s *tcb);
 void nxsched_continue(FAR struct tcb_s *tcb);
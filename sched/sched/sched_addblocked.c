@@ -42,6 +42,10 @@
 #include <queue.h>
 #include <assert.h>
 
+#ifdef CONFIG_SCHED_EDF
+#  include <nuttx/clock.h>
+#endif
+
 #include "sched/sched.h"
 
 /****************************************************************************
@@ -77,6 +81,18 @@ void nxsched_add_blocked(FAR struct tcb_s *btcb, tstate_t task_state)
   DEBUGASSERT(task_state >= FIRST_BLOCKED_STATE &&
               task_state <= LAST_BLOCKED_STATE);
 
+#ifdef CONFIG_SCHED_EDF
+  /* An EDF task blocking marks the end of its current job.  If the
+   * absolute deadline has already passed, then count the overrun.
+   */
+
+  if ((btcb->flags & TCB_FLAG_SCHED_EDF) != 0 &&
+      clock_systime_ticks() > btcb->edf_absdeadline)
+    {
+      btcb->edf_overruns++;
+    }
+#endif
+
   /* Add the TCB to the blocked task list associated with this state. */
 
   tasklist = TLIST_BLOCKED(task_state);
@@ -104,7 +104,13 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
 
   /* Otherwise, add the new task to the ready-to-run task list */
 
+#if defined(CONFIG_SCHED_READYQ_BITMAP)
+  else if (nxsched_readyq_insert(btcb))
+#elif defined(CONFIG_SCHED_EDF)
+  else if (nxsched_edf_insert(btcb))
+#else
   else if (nxsched_add_prioritized(btcb, (FAR dq_queue_t *)&g_readytorun))
+#endif
     {
       /* The new btcb was added at the head of the ready-to-run list.  It
        * is now the new active task!
@@ -114,6 +120,14 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
 
       btcb->task_state = TSTATE_TASK_RUNNING;
       btcb->flink->task_state = TSTATE_TASK_READYTORUN;
+
+#ifdef CONFIG_SCHED_RUSAGE
+      /* The previously running task was displaced by a higher priority
+       * task:  an involuntary context switch.
+       */
+
+      rtcb->nivcsw++;
+#endif
       ret = true;
     }
   else
@@ -184,11 +198,31 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
     }
   else
     {
-      /* Otherwise, find the CPU that is executing the lowest priority task
-       * (possibly its IDLE task).
+#ifdef CONFIG_SMP_WAKEUP_AFFINITY
+      /* Prefer the CPU on which the task last ran if that CPU is permitted
+       * by the affinity mask and is currently executing its IDLE task.
+       * The task's working set may still be resident in that CPU's cache
+       * and no other task is displaced by the wakeup.  The IDLE task is
+       * always the last task in the assigned task list, so a CPU is idle
+       * if the task at the head of its list has no successor.
        */
 
-      cpu = nxsched_select_cpu(btcb->affinity);
+      FAR struct tcb_s *atcb = (FAR struct tcb_s *)
+                               g_assignedtasks[btcb->cpu].head;
+
+      if ((btcb->affinity & (1 << btcb->cpu)) != 0 && atcb->flink == NULL)
+        {
+          cpu = btcb->cpu;
+        }
+      else
+#endif
+        {
+          /* Otherwise, find the CPU that is executing the lowest priority
+           * task (possibly its IDLE task).
+           */
+
+          cpu = nxsched_select_cpu(btcb->affinity);
+        }
     }
 
   /* Get the task currently running on the CPU (may be the IDLE task) */
@@ -302,6 +336,14 @@ bool nxsched_add_readytorun(FAR struct tcb_s *btcb)
           btcb->cpu        = cpu;
           btcb->task_state = TSTATE_TASK_RUNNING;
 
+#ifdef CONFIG_SCHED_RUSAGE
+          /* The task that was running on the CPU was displaced by a higher
+           * priority task:  an involuntary context switch.
+           */
+
+          rtcb->nivcsw++;
+#endif
+
           /* Adjust global pre-emption controls.  If the lockcount is
            * greater than zero, then this task/this CPU holds the scheduler
            * lock.
@@ -0,0 +1,495 @@
+/****************************************************************************
+ * sched/sched/sched_bench.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <mqueue.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/kthread.h>
+#include <nuttx/semaphore.h>
+#include <nuttx/wdog.h>
+
+#include "sched/sched.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define BENCH_ITERATIONS  CONFIG_SCHED_BENCHMARK_ITERATIONS
+#define BENCH_STACKSIZE   CONFIG_DEFAULT_TASK_STACKSIZE
+
+/* Number of watchdogs pre-inserted into the active timer queue for each
+ * round of the wd_start() benchmark.
+ */
+
+#define BENCH_WDOG_MAXLOAD 64
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Start gate and completion signalling between the benchmark control task
+ * and its worker threads.
+ */
+
+static sem_t g_bench_go;
+static sem_t g_bench_done;
+
+/* Ping-pong semaphores */
+
+static sem_t g_bench_ping;
+static sem_t g_bench_pong;
+
+#ifndef CONFIG_DISABLE_MQUEUE
+/* Ping-pong message queues */
+
+static mqd_t g_bench_mqping;
+static mqd_t g_bench_mqpong;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: bench_gettime
+ *
+ * Description:
+ *   Return the current system time in nanoseconds.
+ *
+ ****************************************************************************/
+
+static uint64_t bench_gettime(void)
+{
+  struct timespec ts;
+
+  clock_systime_timespec(&ts);
+  return (uint64_t)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+/****************************************************************************
+ * Name: bench_report
+ *
+ * Description:
+ *   Emit one machine readable result line:
+ *
+ *     bench,<name>,<operations>,<total-nsec>,<nsec-per-operation>
+ *
+ *   The fixed "bench," prefix allows the lines to be extracted from mixed
+ *   console output and diffed across releases.
+ *
+ ****************************************************************************/
+
+static void bench_report(FAR const char *name, unsigned long ops,
+                         uint64_t elapsed)
+{
+  printf("bench,%s,%lu,%lu,%lu\n", name, ops,
+         (unsigned long)elapsed,
+         (unsigned long)(ops > 0 ? elapsed / ops : 0));
+}
+
+/****************************************************************************
+ * Name: bench_yield_worker
+ *
+ * Description:
+ *   Worker for the context switch benchmark.  Two instances of this thread
+ *   run at the same priority; each sched_yield() transfers control to the
+ *   other instance, so every loop iteration is one context switch.
+ *
+ ****************************************************************************/
+
+static int bench_yield_worker(int argc, FAR char **argv)
+{
+  int i;
+
+  nxsem_wait(&g_bench_go);
+
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+      sched_yield();
+    }
+
+  nxsem_post(&g_bench_done);
+  return OK;
+}
+
+/****************************************************************************
+ * Name: bench_sem_worker
+ *
+ * Description:
+ *   Worker for the semaphore wakeup benchmark.  Each round trip consists
+ *   of one post/wait pair in each direction, i.e. two wakeups and two
+ *   context switches.
+ *
+ ****************************************************************************/
+
+static int bench_sem_worker(int argc, FAR char **argv)
+{
+  int i;
+
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+      nxsem_wait(&g_bench_ping);
+      nxsem_post(&g_bench_pong);
+    }
+
+  nxsem_post(&g_bench_done);
+  return OK;
+}
+
+#ifndef CONFIG_DISABLE_MQUEUE
+/****************************************************************************
+ * Name: bench_mq_worker
+ *
+ * Description:
+ *   Worker for the message queue round trip benchmark.  Echoes each
+ *   received message back on the reply queue.
+ *
+ ****************************************************************************/
+
+static int bench_mq_worker(int argc, FAR char **argv)
+{
+  char msg[1];
+  int i;
+
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+      mq_receive(g_bench_mqping, msg, sizeof(msg), NULL);
+      mq_send(g_bench_mqpong, msg, sizeof(msg), 0);
+    }
+
+  nxsem_post(&g_bench_done);
+  return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: bench_wdog_dummy
+ *
+ * Description:
+ *   Watchdog expiration handler for the wd_start() benchmark.  The delays
+ *   are chosen so that no watchdog expires while the benchmark runs; this
+ *   handler exists only to provide a valid entry point.
+ *
+ ****************************************************************************/
+
+static void bench_wdog_dummy(wdparm_t arg)
+{
+}
+
+/****************************************************************************
+ * Name: bench_yield
+ *
+ * Description:
+ *   Measure the yield-to-yield context switch time between two kernel
+ *   threads of equal priority.
+ *
+ ****************************************************************************/
+
+static void bench_yield(int priority)
+{
+  uint64_t start;
+  uint64_t elapsed;
+
+  nxsem_init(&g_bench_go, 0, 0);
+  nxsem_init(&g_bench_done, 0, 0);
+
+  kthread_create("bench_yield0", priority, BENCH_STACKSIZE,
+                 bench_yield_worker, NULL);
+  kthread_create("bench_yield1", priority, BENCH_STACKSIZE,
+                 bench_yield_worker, NULL);
+
+  start = bench_gettime();
+
+  nxsem_post(&g_bench_go);
+  nxsem_post(&g_bench_go);
+
+  nxsem_wait(&g_bench_done);
+  nxsem_wait(&g_bench_done);
+
+  elapsed = bench_gettime() - start;
+
+  nxsem_destroy(&g_bench_go);
+  nxsem_destroy(&g_bench_done);
+
+  /* Each worker iteration is one context switch */
+
+  bench_report("yield", 2 * BENCH_ITERATIONS, elapsed);
+}
+
+/****************************************************************************
+ * Name: bench_sem
+ *
+ * Description:
+ *   Measure the semaphore post/wait wakeup round trip between this task
+ *   and a higher priority kernel thread.
+ *
+ ****************************************************************************/
+
+static void bench_sem(int priority)
+{
+  uint64_t start;
+  uint64_t elapsed;
+  int i;
+
+  nxsem_init(&g_bench_ping, 0, 0);
+  nxsem_init(&g_bench_pong, 0, 0);
+  nxsem_init(&g_bench_done, 0, 0);
+
+  kthread_create("bench_sem", priority, BENCH_STACKSIZE,
+                 bench_sem_worker, NULL);
+
+  start = bench_gettime();
+
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+      nxsem_post(&g_bench_ping);
+      nxsem_wait(&g_bench_pong);
+    }
+
+  elapsed = bench_gettime() - start;
+
+  nxsem_wait(&g_bench_done);
+  nxsem_destroy(&g_bench_ping);
+  nxsem_destroy(&g_bench_pong);
+  nxsem_destroy(&g_bench_done);
+
+  bench_report("sem_roundtrip", BENCH_ITERATIONS, elapsed);
+}
+
+#ifndef CONFIG_DISABLE_MQUEUE
+/****************************************************************************
+ * Name: bench_mq
+ *
+ * Description:
+ *   Measure the one byte message queue send/receive round trip between
+ *   this task and a higher priority kernel thread.
+ *
+ ****************************************************************************/
+
+static void bench_mq(int priority)
+{
+  struct mq_attr attr;
+  uint64_t start;
+  uint64_t elapsed;
+  char msg[1];
+  int i;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.mq_maxmsg  = 4;
+  attr.mq_msgsize = sizeof(msg);
+
+  g_bench_mqping = mq_open("bench_mqping", O_RDWR | O_CREAT, 0666, &attr);
+  g_bench_mqpong = mq_open("bench_mqpong", O_RDWR | O_CREAT, 0666, &attr);
+  if (g_bench_mqping == (mqd_t)-1 || g_bench_mqpong == (mqd_t)-1)
+    {
+      printf("bench,mq_roundtrip,skipped\n");
+      return;
+    }
+
+  nxsem_init(&g_bench_done, 0, 0);
+
+  kthread_create("bench_mq", priority, BENCH_STACKSIZE,
+                 bench_mq_worker, NULL);
+
+  msg[0] = 'b';
+  start = bench_gettime();
+
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+    {
+      mq_send(g_bench_mqping, msg, sizeof(msg), 0);
+      mq_receive(g_bench_mqpong, msg, sizeof(msg), NULL);
+    }
+
+  elapsed = bench_gettime() - start;
+
+  nxsem_wait(&g_bench_done);
+  nxsem_destroy(&g_bench_done);
+
+  mq_close(g_bench_mqping);
+  mq_close(g_bench_mqpong);
+  mq_unlink("bench_mqping");
+  mq_unlink("bench_mqpong");
+
+  bench_report("mq_roundtrip", BENCH_ITERATIONS, elapsed);
+}
+#endif
+
+/****************************************************************************
+ * Name: bench_wdog
+ *
+ * Description:
+ *   Measure the cost of wd_start() insertion into the active timer queue
+ *   with 0, 8 and 64 timers already in the queue.  The insertion point is
+ *   placed in the middle of the pre-loaded delays so that the measured
+ *   cost reflects the average queue traversal.
+ *
+ ****************************************************************************/
+
+static void bench_wdog(void)
+{
+  static struct wdog_s load[BENCH_WDOG_MAXLOAD];
+  static const int nload[] =
+  {
+    0, 8, BENCH_WDOG_MAXLOAD
+  };
+
+  struct wdog_s probe;
+  uint64_t start;
+  uint64_t elapsed;
+  char name[16];
+  unsigned int n;
+  int i;
+
+  memset(&probe, 0, sizeof(probe));
+
+  for (n = 0; n < sizeof(nload) / sizeof(nload[0]); n++)
+    {
+      memset(load, 0, sizeof(load));
+
+      /* Pre-load the timer queue with staggered, far future expirations
+       * so that none fires while the benchmark runs.
+       */
+
+      for (i = 0; i < nload[n]; i++)
+        {
+          wd_start(&load[i], 10000 + 100 * i, bench_wdog_dummy, 0);
+        }
+
+      start = bench_gettime();
+
+      for (i = 0; i < BENCH_ITERATIONS; i++)
+        {
+          wd_start(&probe, 10000 + 50 * nload[n], bench_wdog_dummy, 0);
+          wd_cancel(&probe);
+        }
+
+      elapsed = bench_gettime() - start;
+
+      for (i = 0; i < nload[n]; i++)
+        {
+          wd_cancel(&load[i]);
+        }
+
+      snprintf(name, sizeof(name), "wd_start_%d", nload[n]);
+      bench_report(name, BENCH_ITERATIONS, elapsed);
+    }
+}
+
+/****************************************************************************
+ * Name: bench_malloc
+ *
+ * Description:
+ *   Measure malloc()/free() cycles against the mm_heap allocator for a
+ *   range of allocation sizes.
+ *
+ ****************************************************************************/
+
+static void bench_malloc(void)
+{
+  static const size_t sizes[] =
+  {
+    16, 64, 256, 1024
+  };
+
+  FAR void *ptr;
+  uint64_t start;
+  uint64_t elapsed;
+  char name[16];
+  unsigned int n;
+  int i;
+
+  for (n = 0; n < sizeof(sizes) / sizeof(sizes[0]); n++)
+    {
+      start = bench_gettime();
+
+      for (i = 0; i < BENCH_ITERATIONS; i++)
+        {
+          ptr = malloc(sizes[n]);
+          free(ptr);
+        }
+
+      elapsed = bench_gettime() - start;
+
+      snprintf(name, sizeof(name), "malloc_%u", (unsigned int)sizes[n]);
+      bench_report(name, BENCH_ITERATIONS, elapsed);
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_benchmark
+ *
+ * Description:
+ *   Run the scheduler and allocator micro-benchmark suite and emit one
+ *   machine readable CSV line per benchmark on the console:
+ *
+ *     bench,<name>,<operations>,<total-nsec>,<nsec-per-operation>
+ *
+ *   The suite measures yield-to-yield context switches, semaphore wakeup
+ *   round trips, message queue round trips, wd_start() insertion under
+ *   increasing timer queue loads, and malloc()/free() cycles.  The caller
+ *   must be a task or kernel thread; worker threads are created one
+ *   priority level above the caller so that wakeups hand off immediately.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+int nxsched_benchmark(void)
+{
+  FAR struct tcb_s *rtcb = this_task();
+  int priority = rtcb->sched_priority + 1;
+
+  if (priority > SCHED_PRIORITY_MAX)
+    {
+      return -EINVAL;
+    }
+
+  bench_yield(priority);
+  bench_sem(priority);
+#ifndef CONFIG_DISABLE_MQUEUE
+  bench_mq(priority);
+#endif
+  bench_wdog();
+  bench_malloc();
+
+  return OK;
+}
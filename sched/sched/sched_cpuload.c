@@ -39,6 +39,7 @@
 
 #include <nuttx/config.h>
 
+#include <stdint.h>
 #include <errno.h>
 #include <assert.h>
 
@@ -272,8 +273,46 @@ int clock_cpuload(int pid, FAR struct cpuload_s *cpuload)
 
   if (g_pidhash[hash_index].tcb && g_pidhash[hash_index].pid == pid)
     {
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+      uint64_t total = 0;
+      uint64_t active;
+#ifdef CONFIG_SMP
+      int cpu;
+#endif
+
+      /* Use the precise runtime counters that are accumulated at every
+       * context switch.  The in-progress timeslice of each running thread
+       * is not included; the resulting error is bounded by one timeslice
+       * per CPU.
+       */
+
+#ifdef CONFIG_SMP
+      for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++)
+        {
+          total += g_cpu_runtime[cpu];
+        }
+#else
+      total = g_cpu_runtime[0];
+#endif
+
+      active = g_pidhash[hash_index].tcb->run_time;
+
+      /* Scale the counters into the 32-bit fields of struct cpuload_s,
+       * preserving the active:total ratio.
+       */
+
+      while (total > UINT32_MAX)
+        {
+          total  >>= 1;
+          active >>= 1;
+        }
+
+      cpuload->total  = (uint32_t)total;
+      cpuload->active = (uint32_t)active;
+#else
       cpuload->total  = g_cpuload_total;
       cpuload->active = g_pidhash[hash_index].ticks;
+#endif
       ret = OK;
     }
 
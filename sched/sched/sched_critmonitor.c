@@ -74,6 +74,18 @@ uint32_t g_premp_max[1];
 uint32_t g_crit_max[1];
 #endif
 
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+/* Total execution time accumulated on each CPU.  This is the denominator
+ * for all precise CPU load calculations.
+ */
+
+#ifdef CONFIG_SMP_NCPUS
+uint64_t g_cpu_runtime[CONFIG_SMP_NCPUS];
+#else
+uint64_t g_cpu_runtime[1];
+#endif
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -102,7 +114,7 @@ void nxsched_critmon_preemption(FAR struct tcb_s *tcb, bool state)
 
       /* Disabling.. Save the thread start time */
 
-      tcb->premp_start = up_critmon_gettime();
+      tcb->premp_start = up_perf_gettime();
 
       /* Zero means that the timer is not ready */
 
@@ -117,7 +129,7 @@ void nxsched_critmon_preemption(FAR struct tcb_s *tcb, bool state)
     {
       /* Re-enabling.. Check for the max elapsed time */
 
-      uint32_t now     = up_critmon_gettime();
+      uint32_t now     = up_perf_gettime();
       uint32_t elapsed = now - tcb->premp_start;
 
       DEBUGASSERT(now != 0);
@@ -166,7 +178,7 @@ void nxsched_critmon_csection(FAR struct tcb_s *tcb, bool state)
       /* Entering... Save the start time. */
 
       DEBUGASSERT(tcb->crit_start == 0);
-      tcb->crit_start = up_critmon_gettime();
+      tcb->crit_start = up_perf_gettime();
 
       /* Zero means that the timer is not ready */
 
@@ -181,7 +193,7 @@ void nxsched_critmon_csection(FAR struct tcb_s *tcb, bool state)
     {
       /* Leaving .. Check for the max elapsed time */
 
-      uint32_t now     = up_critmon_gettime();
+      uint32_t now     = up_perf_gettime();
       uint32_t elapsed = now - tcb->crit_start;
 
       DEBUGASSERT(now != 0);
@@ -227,13 +239,19 @@ void nxsched_resume_critmon(FAR struct tcb_s *tcb)
 
   DEBUGASSERT(tcb->premp_start == 0 && tcb->crit_start == 0);
 
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+  /* Remember when this thread was given the CPU */
+
+  tcb->run_start = up_perf_gettime();
+#endif
+
   /* Did this task disable pre-emption? */
 
   if (tcb->lockcount > 0)
     {
       /* Yes.. Save the start time */
 
-      tcb->premp_start = up_critmon_gettime();
+      tcb->premp_start = up_perf_gettime();
       DEBUGASSERT(tcb->premp_start != 0);
 
       /* Zero means that the timer is not ready */
@@ -247,7 +265,7 @@ void nxsched_resume_critmon(FAR struct tcb_s *tcb)
     {
       /* Check for the global max elapsed time */
 
-      elapsed            = up_critmon_gettime() - g_premp_start[cpu];
+      elapsed            = up_perf_gettime() - g_premp_start[cpu];
       g_premp_start[cpu] = 0;
 
       if (elapsed > g_premp_max[cpu])
@@ -262,7 +280,7 @@ void nxsched_resume_critmon(FAR struct tcb_s *tcb)
     {
       /* Yes.. Save the start time */
 
-      tcb->crit_start = up_critmon_gettime();
+      tcb->crit_start = up_perf_gettime();
       DEBUGASSERT(tcb->crit_start != 0);
 
       if (g_crit_start[cpu] == 0)
@@ -274,7 +292,7 @@ void nxsched_resume_critmon(FAR struct tcb_s *tcb)
     {
       /* Check for the global max elapsed time */
 
-      elapsed      = up_critmon_gettime() - g_crit_start[cpu];
+      elapsed      = up_perf_gettime() - g_crit_start[cpu];
       g_crit_start[cpu] = 0;
 
       if (elapsed > g_crit_max[cpu])
@@ -301,13 +319,24 @@ void nxsched_suspend_critmon(FAR struct tcb_s *tcb)
 {
   uint32_t elapsed;
 
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+  /* Credit this thread with the time that it has held the CPU.  The same
+   * elapsed time is added to the per-CPU total which serves as the
+   * denominator for precise CPU load calculations.
+   */
+
+  elapsed        = up_perf_gettime() - tcb->run_start;
+  tcb->run_time += elapsed;
+  g_cpu_runtime[this_cpu()] += elapsed;
+#endif
+
   /* Did this task disable preemption? */
 
   if (tcb->lockcount > 0)
     {
       /* Possibly re-enabling.. Check for the max elapsed time */
 
-      elapsed = up_critmon_gettime() - tcb->premp_start;
+      elapsed = up_perf_gettime() - tcb->premp_start;
 
       tcb->premp_start = 0;
       if (elapsed > tcb->premp_max)
@@ -322,7 +351,7 @@ void nxsched_suspend_critmon(FAR struct tcb_s *tcb)
     {
       /* Possibly leaving .. Check for the max elapsed time */
 
-      elapsed = up_critmon_gettime() - tcb->crit_start;
+      elapsed = up_perf_gettime() - tcb->crit_start;
 
       tcb->crit_start = 0;
       if (elapsed > tcb->crit_max)
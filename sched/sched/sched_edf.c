@@ -0,0 +1,331 @@
+/****************************************************************************
+ * sched/sched/sched_edf.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sched.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/sched.h>
+#include <nuttx/clock.h>
+
+#include "sched/sched.h"
+#include "clock/clock.h"
+
+#ifdef CONFIG_SCHED_EDF
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Accumulator used by the admission test */
+
+struct edf_admission_s
+{
+  FAR struct tcb_s *tcb;  /* The task being (re-)admitted */
+  uint32_t utilization;   /* Summed utilization in parts per thousand */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_edf_utilization
+ *
+ * Description:
+ *   nxsched_foreach() callback that accumulates the processor utilization
+ *   of every admitted EDF task other than the one being (re-)admitted.
+ *
+ ****************************************************************************/
+
+static void nxsched_edf_utilization(FAR struct tcb_s *tcb, FAR void *arg)
+{
+  FAR struct edf_admission_s *adm = (FAR struct edf_admission_s *)arg;
+
+  if (tcb != adm->tcb && (tcb->flags & TCB_FLAG_SCHED_EDF) != 0)
+    {
+      adm->utilization +=
+        (uint32_t)((uint64_t)tcb->edf_runtime * 1000 / tcb->edf_period);
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_edf_set
+ *
+ * Description:
+ *   Validate the EDF parameters in 'param', perform the utilization-based
+ *   admission test against all other admitted EDF tasks, and, if the task
+ *   is admitted, save the deadline parameters in the TCB.  The worst-case
+ *   execution time is used only by the admission test; the execution
+ *   budget is not enforced at run time.
+ *
+ * Input Parameters:
+ *   tcb   - The TCB of the task being placed under EDF scheduling
+ *   param - Scheduling parameters including the EDF extensions
+ *
+ * Returned Value:
+ *   Zero (OK) on success.  A negated errno value is returned on failure:
+ *
+ *   EINVAL The deadline parameters are not self-consistent.
+ *   EBUSY  Admitting the task would exceed 100% processor utilization.
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+int nxsched_edf_set(FAR struct tcb_s *tcb,
+                    FAR const struct sched_param *param)
+{
+  struct edf_admission_s adm;
+  sclock_t runtime_ticks;
+  sclock_t deadline_ticks;
+  sclock_t period_ticks;
+
+  /* Convert timespec values to system clock ticks */
+
+  clock_time2ticks(&param->sched_edf_runtime, &runtime_ticks);
+  clock_time2ticks(&param->sched_edf_deadline, &deadline_ticks);
+  clock_time2ticks(&param->sched_edf_period, &period_ticks);
+
+  /* Avoid zero/negative times */
+
+  if (runtime_ticks < 1)
+    {
+      runtime_ticks = 1;
+    }
+
+  if (deadline_ticks < 1)
+    {
+      deadline_ticks = 1;
+    }
+
+  if (period_ticks < 1)
+    {
+      period_ticks = 1;
+    }
+
+  /* The relative deadline may neither precede the worst-case execution
+   * time nor extend beyond the release period.
+   */
+
+  if (deadline_ticks < runtime_ticks || period_ticks < deadline_ticks)
+    {
+      return -EINVAL;
+    }
+
+  /* Admission test:  The total utilization of all EDF tasks, including
+   * the task being admitted, must not exceed the processor capacity.
+   */
+
+  adm.tcb         = tcb;
+  adm.utilization =
+    (uint32_t)((uint64_t)runtime_ticks * 1000 / period_ticks);
+
+  nxsched_foreach(nxsched_edf_utilization, &adm);
+
+  if (adm.utilization > 1000)
+    {
+      return -EBUSY;
+    }
+
+  /* The task was admitted.  Save the deadline parameters and start the
+   * first job now.
+   */
+
+  tcb->edf_runtime     = (clock_t)runtime_ticks;
+  tcb->edf_deadline    = (clock_t)deadline_ticks;
+  tcb->edf_period      = (clock_t)period_ticks;
+  tcb->edf_absdeadline = clock_systime_ticks() + (clock_t)deadline_ticks;
+  tcb->edf_overruns    = 0;
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxsched_edf_newjob
+ *
+ * Description:
+ *   Release the next job of an EDF task.  This is called when the task
+ *   wakes from a blocked state; a job boundary is assumed at each such
+ *   wakeup.  The absolute deadline normally advances by one release
+ *   period; if the task has fallen behind its release pattern, the
+ *   deadline is re-anchored relative to the actual wakeup time.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the EDF task being unblocked
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+void nxsched_edf_newjob(FAR struct tcb_s *tcb)
+{
+  clock_t now = clock_systime_ticks();
+
+  /* Advance the absolute deadline by one release period */
+
+  tcb->edf_absdeadline += tcb->edf_period;
+
+  /* If the advanced deadline is nearer than one relative deadline from
+   * now, then the task woke later than its release pattern allows.
+   * Re-anchor the deadline to the actual release time.
+   */
+
+  if ((sclock_t)(tcb->edf_absdeadline - now) < (sclock_t)tcb->edf_deadline)
+    {
+      tcb->edf_absdeadline = now + tcb->edf_deadline;
+    }
+}
+
+/****************************************************************************
+ * Name: nxsched_edf_insert
+ *
+ * Description:
+ *   Add a TCB to the ready-to-run list, ordering EDF tasks within their
+ *   priority band by ascending absolute deadline.  Tasks that are not
+ *   under EDF scheduling are forwarded to nxsched_add_prioritized() and
+ *   receive the normal strict priority ordering.
+ *
+ * Input Parameters:
+ *   btcb - Points to the TCB that is ready-to-run
+ *
+ * Returned Value:
+ *   true if the head of the ready-to-run list has changed.
+ *
+ * Assumptions:
+ * - The caller has established a critical section before calling this
+ *   function.
+ * - The caller has already removed the input btcb from whatever list it
+ *   was in.
+ * - The caller handles the condition that occurs if the head of the
+ *   ready-to-run list is changed.
+ *
+ ****************************************************************************/
+
+bool nxsched_edf_insert(FAR struct tcb_s *btcb)
+{
+  FAR dq_queue_t *list = (FAR dq_queue_t *)&g_readytorun;
+  FAR struct tcb_s *next;
+  FAR struct tcb_s *prev;
+  uint8_t sched_priority = btcb->sched_priority;
+  bool ret = false;
+
+  /* Tasks that are not under EDF scheduling use the normal priority
+   * ordering.
+   */
+
+  if ((btcb->flags & TCB_FLAG_SCHED_EDF) == 0)
+    {
+      return nxsched_add_prioritized(btcb, list);
+    }
+
+  /* Search the list for the location to insert the new TCB.  The list is
+   * maintained in descending sched_priority order; within the EDF
+   * priority band it is further ordered by ascending absolute deadline.
+   * Stop at the first task of lower priority or at the first EDF peer
+   * whose absolute deadline is later than ours.
+   */
+
+  for (next = (FAR struct tcb_s *)list->head;
+       next != NULL && sched_priority <= next->sched_priority;
+       next = next->flink)
+    {
+      if (sched_priority == next->sched_priority &&
+          (next->flags & TCB_FLAG_SCHED_EDF) != 0 &&
+          (sclock_t)(next->edf_absdeadline - btcb->edf_absdeadline) > 0)
+        {
+          break;
+        }
+    }
+
+  /* Add the TCB to the spot found in the list. */
+
+  if (next == NULL)
+    {
+      /* The TCB goes at the end of the list. */
+
+      prev = (FAR struct tcb_s *)list->tail;
+      if (prev == NULL)
+        {
+          /* Special case:  The list is empty */
+
+          btcb->flink = NULL;
+          btcb->blink = NULL;
+          list->head  = (FAR dq_entry_t *)btcb;
+          list->tail  = (FAR dq_entry_t *)btcb;
+          ret = true;
+        }
+      else
+        {
+          /* The TCB goes at the end of a non-empty list */
+
+          btcb->flink = NULL;
+          btcb->blink = prev;
+          prev->flink = btcb;
+          list->tail  = (FAR dq_entry_t *)btcb;
+        }
+    }
+  else
+    {
+      /* The TCB goes just before next */
+
+      prev = (FAR struct tcb_s *)next->blink;
+      if (prev == NULL)
+        {
+          /* Special case:  Insert at the head of the list */
+
+          btcb->flink = next;
+          btcb->blink = NULL;
+          next->blink = btcb;
+          list->head  = (FAR dq_entry_t *)btcb;
+          ret = true;
+        }
+      else
+        {
+          /* Insert in the middle of the list */
+
+          btcb->flink = next;
+          btcb->blink = prev;
+          prev->flink = btcb;
+          next->blink = btcb;
+        }
+    }
+
+  return ret;
+}
+
+#endif /* CONFIG_SCHED_EDF */
@@ -0,0 +1,148 @@
+/****************************************************************************
+ * sched/sched/sched_get_rusage.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <sys/resource.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include <nuttx/arch.h>
+#include <nuttx/clock.h>
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_RUSAGE
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_get_rusage
+ *
+ * Description:
+ *   Report the resource usage counters accumulated for a thread:  context
+ *   switch counts split by cause and bytes moved through the VFS read and
+ *   write paths.  If CONFIG_SCHED_CPULOAD_PRECISE is enabled, the total
+ *   thread runtime is also reported in ru_utime (NuttX does not separate
+ *   user from system time).
+ *
+ * Input Parameters:
+ *   pid    - Identifies the thread to query.  Zero is interpreted as the
+ *            calling thread.
+ *   rusage - User-provided location to return the resource usage.
+ *
+ * Returned Value:
+ *   Zero (OK) if successful.  Otherwise, a negated errno value is returned.
+ *
+ *     -ESRCH  The task whose ID is pid could not be found.
+ *
+ ****************************************************************************/
+
+int nxsched_get_rusage(pid_t pid, FAR struct rusage *rusage)
+{
+  FAR struct tcb_s *qtcb;
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+  uint64_t runtime;
+  uint64_t sec;
+  long nsec;
+#endif
+  irqstate_t flags;
+
+  DEBUGASSERT(rusage != NULL);
+  memset(rusage, 0, sizeof(struct rusage));
+
+  /* Disable interrupts so that the queried thread cannot exit and so that
+   * the counters are sampled consistently.
+   */
+
+  flags = enter_critical_section();
+
+  /* A pid of 0 means that we are querying the calling thread */
+
+  if (pid == 0)
+    {
+      qtcb = this_task();
+    }
+  else
+    {
+      qtcb = nxsched_get_tcb(pid);
+      if (qtcb == NULL)
+        {
+          leave_critical_section(flags);
+          return -ESRCH;
+        }
+    }
+
+  rusage->ru_nvcsw   = (long)qtcb->nvcsw;
+  rusage->ru_nivcsw  = (long)qtcb->nivcsw;
+  rusage->ru_inblock = (long)qtcb->rdbytes;
+  rusage->ru_oublock = (long)qtcb->wrbytes;
+
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+  runtime = qtcb->run_time;
+#endif
+
+  leave_critical_section(flags);
+
+#ifdef CONFIG_SCHED_CPULOAD_PRECISE
+  /* Convert the accumulated runtime to a timeval.  up_perf_convert()
+   * accepts only a 32-bit count so long accumulations must be converted
+   * in pieces.
+   */
+
+  sec  = 0;
+  nsec = 0;
+
+  while (runtime > 0)
+    {
+      struct timespec ts;
+      uint32_t chunk;
+
+      chunk    = (runtime > UINT32_MAX) ? UINT32_MAX : (uint32_t)runtime;
+      runtime -= chunk;
+
+      up_perf_convert(chunk, &ts);
+      sec  += (uint64_t)ts.tv_sec;
+      nsec += ts.tv_nsec;
+      if (nsec >= NSEC_PER_SEC)
+        {
+          sec++;
+          nsec -= NSEC_PER_SEC;
+        }
+    }
+
+  rusage->ru_utime.tv_sec  = (time_t)sec;
+  rusage->ru_utime.tv_usec = nsec / NSEC_PER_USEC;
+#endif
+
+  return OK;
+}
+
+#endif /* CONFIG_SCHED_RUSAGE */
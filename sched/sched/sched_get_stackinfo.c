@@ -101,5 +101,8 @@ int nxsched_get_stackinfo(pid_t pid, FAR struct stackinfo_s *stackinfo)
   stackinfo->adj_stack_size  = qtcb->adj_stack_size;
   stackinfo->stack_alloc_ptr = qtcb->stack_alloc_ptr;
   stackinfo->adj_stack_ptr   = qtcb->adj_stack_ptr;
+#ifdef CONFIG_STACK_WATERMARK
+  stackinfo->adj_stack_peak  = qtcb->stack_peak;
+#endif
   return OK;
 }
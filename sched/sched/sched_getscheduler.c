@@ -102,6 +102,17 @@ int nxsched_get_scheduler(pid_t pid)
       return -ESRCH;
     }
 
+#ifdef CONFIG_SCHED_EDF
+  /* EDF scheduling is flagged separately from the policy field (EDF tasks
+   * carry FIFO in the policy field and run at the EDF band priority).
+   */
+
+  if ((tcb->flags & TCB_FLAG_SCHED_EDF) != 0)
+    {
+      return SCHED_EDF;
+    }
+#endif
+
   /* Return the scheduling policy from the TCB.  NOTE that the user-
    * interpretable values are 1 based; the TCB values are zero-based.
    */
@@ -26,6 +26,8 @@
 
 #include <sched.h>
 
+#include <nuttx/spinlock.h>
+
 #include "nuttx/irq.h"
 
 #include "sched/sched.h"
@@ -41,47 +43,58 @@
  *   Given a task ID, this function will return the a pointer to the
  *   corresponding TCB (or NULL if there is no such task ID).
  *
- *   NOTE:  This function holds a critical section while examining TCB data
- *   data structures but releases that critical section before returning.
- *   When it is released, the TCB may become unstable.  If the caller
- *   requires absolute stability while using the TCB, then the caller
- *   should establish the critical section BEFORE calling this function and
- *   hold that critical section as long as necessary.
+ *   NOTE:  This function examines the TCB data structures without locking:
+ *   writers bind the TCB pointer before publishing the PID and invalidate
+ *   the TCB pointer before retiring the PID (see nxtask_assign_pid() and
+ *   nxsched_releasepid()), so re-checking the PID after snapshotting the
+ *   TCB pointer is sufficient to detect a concurrent slot update.  The
+ *   returned TCB may nevertheless become unstable at any time.  If the
+ *   caller requires absolute stability while using the TCB, then the
+ *   caller should establish a critical section BEFORE calling this
+ *   function and hold that critical section as long as necessary.
  *
  ****************************************************************************/
 
 FAR struct tcb_s *nxsched_get_tcb(pid_t pid)
 {
+  FAR volatile struct pidhash_s *slot;
   FAR struct tcb_s *ret = NULL;
-  irqstate_t flags;
-  int hash_ndx;
+  FAR struct tcb_s *tcb;
 
   /* Verify that the PID is within range */
 
   if (pid >= 0)
     {
-      /* Get the hash_ndx associated with the pid */
+      /* Get the hash slot associated with the pid */
 
-      hash_ndx = PIDHASH(pid);
+      slot = &g_pidhash[PIDHASH(pid)];
 
-      /* The test and the return setup should be atomic.  This still does
-       * not provide proper protection if the recipient of the TCB does not
-       * also protect against the task associated with the TCB from
-       * terminating asynchronously.
+      /* Check the slot binding without taking a critical section so that
+       * pid lookups do not serialize cross-CPU process management.  This
+       * still does not provide proper protection if the recipient of the
+       * TCB does not also protect against the task associated with the
+       * TCB from terminating asynchronously.
        */
 
-      flags = enter_critical_section();
-
-      /* Verify that the correct TCB was found. */
-
-      if (pid == g_pidhash[hash_ndx].pid)
+      if (pid == slot->pid)
         {
-          /* Return the TCB associated with this pid (if any) */
-
-          ret = g_pidhash[hash_ndx].tcb;
+          /* Snapshot the TCB associated with this pid (if any) */
+
+          tcb = slot->tcb;
+          SP_DMB();
+
+          /* Re-verify the binding:  If the slot was concurrently reused
+           * for another pid hashing to the same index, the pid will have
+           * changed.  If the task was concurrently retired, the TCB
+           * pointer was cleared before the pid and the snapshot is either
+           * still valid or NULL.
+           */
+
+          if (pid == slot->pid)
+            {
+              ret = tcb;
+            }
         }
-
-      leave_critical_section(flags);
     }
 
   /* Return the TCB. */
@@ -69,6 +69,40 @@
  ****************************************************************************/
 
 #ifndef CONFIG_SMP
+#ifdef CONFIG_SCHED_READYQ_BITMAP
+bool nxsched_merge_pending(void)
+{
+  FAR struct tcb_s *ptcb;
+  bool ret = false;
+
+  /* Remove each pending task and insert it into the g_readytorun list at
+   * the position found through the priority bitmap.  Each insertion is
+   * O(1) so the full merge is linear in the number of pending tasks.
+   */
+
+  while ((ptcb = (FAR struct tcb_s *)
+                 dq_remfirst((FAR dq_queue_t *)&g_pendingtasks)) != NULL)
+    {
+      if (nxsched_readyq_insert(ptcb))
+        {
+          /* The pending task was added at the head of the ready-to-run
+           * list.  It is now the new active task!
+           */
+
+          DEBUGASSERT(ptcb->flink != NULL);
+          ptcb->task_state        = TSTATE_TASK_RUNNING;
+          ptcb->flink->task_state = TSTATE_TASK_READYTORUN;
+          ret = true;
+        }
+      else
+        {
+          ptcb->task_state = TSTATE_TASK_READYTORUN;
+        }
+    }
+
+  return ret;
+}
+#else
 bool nxsched_merge_pending(void)
 {
   FAR struct tcb_s *ptcb;
@@ -150,6 +184,7 @@ bool nxsched_merge_pending(void)
 
   return ret;
 }
+#endif /* CONFIG_SCHED_READYQ_BITMAP */
 #endif /* !CONFIG_SMP */
 
 /****************************************************************************
@@ -134,15 +134,38 @@ void nxsched_merge_prioritized(FAR dq_queue_t *list1, FAR dq_queue_t *list2,
       else if (tcb1->sched_priority > tcb2->sched_priority)
         {
           /* The TCB from list1 has higher priority than the TCB from list2.
-           * Remove the TCB from list1 and insert it before the TCB from
-           * list2.
+           * Find the end of the run of TCBs from list1 that all have
+           * priority above the TCB from list2.  Since both lists are
+           * prioritized, the entire run can be moved in one step.
            */
 
-          tmp = (FAR struct tcb_s *)dq_remfirst(&clone);
-          DEBUGASSERT(tmp == tcb1);
+          FAR struct tcb_s *last = tcb1;
+
+          for (tmp = (FAR struct tcb_s *)dq_next((FAR dq_entry_t *)last);
+               tmp != NULL && tmp->sched_priority > tcb2->sched_priority;
+               tmp = (FAR struct tcb_s *)dq_next((FAR dq_entry_t *)last))
+            {
+              last = tmp;
+            }
+
+          /* Detach the run from the head of list1... */
+
+          clone.head = ((FAR dq_entry_t *)last)->flink;
+          if (clone.head == NULL)
+            {
+              clone.tail = NULL;
+            }
+          else
+            {
+              clone.head->blink = NULL;
+            }
+
+          /* ...and splice it before the TCB from list2 in a single O(1)
+           * operation.
+           */
 
-          dq_addbefore((FAR dq_entry_t *)tcb2, (FAR dq_entry_t *)tmp,
-                       list2);
+          dq_splicebefore((FAR dq_entry_t *)tcb2, (FAR dq_entry_t *)tcb1,
+                          (FAR dq_entry_t *)last, list2);
 
           tcb1 = (FAR struct tcb_s *)dq_peek(&clone);
         }
@@ -33,6 +33,7 @@
 
 #include <nuttx/irq.h>
 #include <nuttx/sched.h>
+#include <nuttx/arch.h>
 #include <nuttx/clock.h>
 #include <nuttx/spinlock.h>
 #include <nuttx/sched_note.h>
@@ -93,6 +94,13 @@ static unsigned int g_note_disabled_irq_nest[1];
 #endif
 #endif
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+/* Summary of blocked semaphore waits, keyed by semaphore address */
+
+static struct note_semstat_s
+  g_note_semstats[CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE_NENTRIES];
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -123,7 +131,7 @@ static void note_common(FAR struct tcb_s *tcb,
 
   clock_systime_timespec(&ts);
 #else
-  uint32_t systime    = (uint32_t)clock_systime_ticks();
+  uint32_t systime    = up_perf_gettime();
 #endif
 
   /* Save all of the common fields */
@@ -147,7 +155,9 @@ static void note_common(FAR struct tcb_s *tcb,
   note->nc_systime_sec[2] = (uint8_t)((ts.tv_sec >> 16) & 0xff);
   note->nc_systime_sec[3] = (uint8_t)((ts.tv_sec >> 24) & 0xff);
 #else
-  /* Save the LS 32-bits of the system timer in little endian order */
+  /* Save the LS 32-bits of the perf counter timebase in little endian
+   * order
+   */
 
   note->nc_systime[0] = (uint8_t)(systime         & 0xff);
   note->nc_systime[1] = (uint8_t)((systime >> 8)  & 0xff);
@@ -787,6 +797,152 @@ void sched_note_irqhandler(int irq, FAR void *handler, bool enter)
 }
 #endif
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+void sched_note_profile(FAR struct tcb_s *tcb, uintptr_t pc)
+{
+  struct note_profile_s note;
+
+  if (!note_isenabled())
+    {
+      return;
+    }
+
+  /* Format the note */
+
+  note_common(tcb, &note.npf_cmn, sizeof(struct note_profile_s),
+              NOTE_PROFILE);
+
+  note.npf_pc[0] = (uint8_t)(pc & 0xff);
+  note.npf_pc[1] = (uint8_t)((pc >> 8)  & 0xff);
+#if UINTPTR_MAX > UINT16_MAX
+  note.npf_pc[2] = (uint8_t)((pc >> 16) & 0xff);
+  note.npf_pc[3] = (uint8_t)((pc >> 24) & 0xff);
+#if UINTPTR_MAX > UINT32_MAX
+  note.npf_pc[4] = (uint8_t)((pc >> 32) & 0xff);
+  note.npf_pc[5] = (uint8_t)((pc >> 40) & 0xff);
+  note.npf_pc[6] = (uint8_t)((pc >> 48) & 0xff);
+  note.npf_pc[7] = (uint8_t)((pc >> 56) & 0xff);
+#endif
+#endif
+
+  /* Add the note to circular buffer */
+
+  sched_note_add(&note, sizeof(struct note_profile_s));
+}
+#endif
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+void sched_note_semwait(FAR struct tcb_s *tcb, FAR sem_t *sem,
+                        uint32_t ticks)
+{
+  struct note_semwait_s note;
+  uintptr_t semaddr = (uintptr_t)sem;
+  FAR struct note_semstat_s *stat;
+  FAR struct note_semstat_s *victim;
+  int i;
+
+  /* Fold the blocked wait into the contention summary.  The caller holds
+   * the critical section, so the summary table may be updated directly.
+   * If the semaphore is not yet in the table and no slot is free, then the
+   * entry with the least accumulated blocked time is evicted.
+   */
+
+  victim = &g_note_semstats[0];
+  for (i = 0; i < CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE_NENTRIES; i++)
+    {
+      stat = &g_note_semstats[i];
+      if (stat->sem == (FAR void *)sem || stat->sem == NULL)
+        {
+          victim = stat;
+          break;
+        }
+
+      if (stat->ticks < victim->ticks)
+        {
+          victim = stat;
+        }
+    }
+
+  if (victim->sem != (FAR void *)sem)
+    {
+      victim->sem      = (FAR void *)sem;
+      victim->nblocked = 0;
+      victim->ticks    = 0;
+      victim->maxticks = 0;
+    }
+
+  victim->nblocked++;
+  victim->ticks += ticks;
+  if (ticks > victim->maxticks)
+    {
+      victim->maxticks = ticks;
+    }
+
+  if (!note_isenabled())
+    {
+      return;
+    }
+
+  /* Format the note */
+
+  note_common(tcb, &note.nsw_cmn, sizeof(struct note_semwait_s),
+              NOTE_SEM_BLOCKED);
+
+  note.nsw_sem[0] = (uint8_t)(semaddr & 0xff);
+  note.nsw_sem[1] = (uint8_t)((semaddr >> 8)  & 0xff);
+#if UINTPTR_MAX > UINT16_MAX
+  note.nsw_sem[2] = (uint8_t)((semaddr >> 16) & 0xff);
+  note.nsw_sem[3] = (uint8_t)((semaddr >> 24) & 0xff);
+#if UINTPTR_MAX > UINT32_MAX
+  note.nsw_sem[4] = (uint8_t)((semaddr >> 32) & 0xff);
+  note.nsw_sem[5] = (uint8_t)((semaddr >> 40) & 0xff);
+  note.nsw_sem[6] = (uint8_t)((semaddr >> 48) & 0xff);
+  note.nsw_sem[7] = (uint8_t)((semaddr >> 56) & 0xff);
+#endif
+#endif
+
+  note.nsw_ticks[0] = (uint8_t)(ticks & 0xff);
+  note.nsw_ticks[1] = (uint8_t)((ticks >> 8)  & 0xff);
+  note.nsw_ticks[2] = (uint8_t)((ticks >> 16) & 0xff);
+  note.nsw_ticks[3] = (uint8_t)((ticks >> 24) & 0xff);
+
+  /* Add the note to circular buffer */
+
+  sched_note_add(&note, sizeof(struct note_semwait_s));
+}
+
+/****************************************************************************
+ * Name: sched_note_semstats
+ *
+ * Description:
+ *   Copy one entry of the semaphore contention summary.  Used by the
+ *   procfs semload file.
+ *
+ * Input Parameters:
+ *   index - Index of the summary table entry to copy
+ *   stats - Location to return the copy
+ *
+ * Returned Value:
+ *   Zero on success; -ENOENT if the index lies beyond the summary table.
+ *
+ ****************************************************************************/
+
+int sched_note_semstats(int index, FAR struct note_semstat_s *stats)
+{
+  irqstate_t flags;
+
+  if (index < 0 || index >= CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE_NENTRIES)
+    {
+      return -ENOENT;
+    }
+
+  flags = enter_critical_section();
+  *stats = g_note_semstats[index];
+  leave_critical_section(flags);
+  return OK;
+}
+#endif /* CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE */
+
 #ifdef CONFIG_SCHED_INSTRUMENTATION_FILTER
 
 /****************************************************************************
@@ -50,6 +50,15 @@
 #  include <nuttx/board.h>
 #endif
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+#  include <nuttx/arch.h>
+#  include <nuttx/sched_note.h>
+#endif
+
+#ifdef CONFIG_LIB_USERSHARE
+#  include <nuttx/usershare.h>
+#endif
+
 #include "sched/sched.h"
 #include "wdog/wdog.h"
 #include "clock/clock.h"
@@ -157,6 +166,45 @@ static inline void nxsched_process_scheduler(void)
 #  define nxsched_process_scheduler()
 #endif
 
+/****************************************************************************
+ * Name:  nxsched_process_profile
+ *
+ * Description:
+ *   Sample the program counter of the context that was interrupted by the
+ *   system timer interrupt and stream it into the note buffer.  The system
+ *   timer rate is decimated by CONFIG_SCHED_INSTRUMENTATION_PROFILE_PERIOD
+ *   to bound the instrumentation overhead.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+static inline void nxsched_process_profile(void)
+{
+#if CONFIG_SCHED_INSTRUMENTATION_PROFILE_PERIOD > 1
+  static unsigned int tick;
+
+  /* Decimate the system timer to the configured sample rate */
+
+  if (++tick < CONFIG_SCHED_INSTRUMENTATION_PROFILE_PERIOD)
+    {
+      return;
+    }
+
+  tick = 0;
+#endif
+
+  sched_note_profile(this_task(), up_profile_getpc());
+}
+#else
+#  define nxsched_process_profile()
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -217,6 +265,22 @@ void nxsched_process_timer(void)
     }
 #endif
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_PROFILE
+  /* Sample the program counter of the interrupted context (before any
+   * timer-initiated context switches can occur)
+   */
+
+  nxsched_process_profile();
+#endif
+
+#ifdef CONFIG_LIB_USERSHARE
+  /* Refresh the time of day published in the user-space shared
+   * information structure.
+   */
+
+  nxsched_usershare_tick();
+#endif
+
   /* Check if the currently executing task has exceeded its
    * timeslice.
    */
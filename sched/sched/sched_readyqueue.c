@@ -0,0 +1,258 @@
+/****************************************************************************
+ * sched/sched/sched_readyqueue.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <strings.h>
+#include <queue.h>
+#include <assert.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_READYQ_BITMAP
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Number of 32-bit words needed to hold one bit for each priority level
+ * in the range 0 (IDLE) through SCHED_PRIORITY_MAX.
+ */
+
+#define PRIOMAP_NWORDS (((SCHED_PRIORITY_MAX + 1) + 31) >> 5)
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* Each set bit indicates that at least one TCB at that priority resides in
+ * the g_readytorun list.
+ */
+
+static uint32_t g_readyq_priomap[PRIOMAP_NWORDS];
+
+/* For each occupied priority level, the last TCB in the g_readytorun list
+ * at that priority.  NULL if the priority level is unoccupied.
+ */
+
+static FAR struct tcb_s *g_readyq_tail[SCHED_PRIORITY_MAX + 1];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_readyq_higher_tail
+ *
+ * Description:
+ *   Find the last TCB in the g_readytorun list whose priority is strictly
+ *   greater than sched_priority.  That is the tail TCB of the lowest
+ *   occupied priority level above sched_priority, found by scanning the
+ *   priority bitmap with find-first-set.
+ *
+ * Input Parameters:
+ *   sched_priority - The priority level to search above
+ *
+ * Returned Value:
+ *   The TCB after which a task of priority sched_priority must be
+ *   inserted; NULL if no higher priority task is ready-to-run.
+ *
+ ****************************************************************************/
+
+static FAR struct tcb_s *nxsched_readyq_higher_tail(uint8_t sched_priority)
+{
+  uint32_t bitmap;
+  int ndx = sched_priority >> 5;
+
+  /* Isolate the bits of this word above sched_priority.  The double shift
+   * avoids undefined behavior when sched_priority lies on the top bit of
+   * the word.
+   */
+
+  bitmap = (g_readyq_priomap[ndx] >> (sched_priority & 31)) >> 1;
+  if (bitmap != 0)
+    {
+      return g_readyq_tail[sched_priority + ffs(bitmap)];
+    }
+
+  /* Then scan upward through the remaining words of the bitmap */
+
+  for (ndx++; ndx < PRIOMAP_NWORDS; ndx++)
+    {
+      bitmap = g_readyq_priomap[ndx];
+      if (bitmap != 0)
+        {
+          return g_readyq_tail[(ndx << 5) + ffs(bitmap) - 1];
+        }
+    }
+
+  return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_readyq_insert
+ *
+ * Description:
+ *   Add a TCB to the g_readytorun list in O(1) time.  The list is kept in
+ *   descending priority order with FIFO ordering among tasks of equal
+ *   priority, exactly as nxsched_add_prioritized() would order it, but the
+ *   insertion point is located via the priority bitmap and per-priority
+ *   tail pointers instead of a linear search.
+ *
+ * Input Parameters:
+ *   btcb - Points to the TCB to add to the ready-to-run list
+ *
+ * Returned Value:
+ *   true if the head of the g_readytorun list has changed.
+ *
+ * Assumptions:
+ * - The caller has established a critical section before calling this
+ *   function.
+ * - The caller has already removed the input btcb from whatever list it
+ *   was in.
+ * - The caller must set the task_state field of the TCB to match the
+ *   state associated with the list.
+ *
+ ****************************************************************************/
+
+bool nxsched_readyq_insert(FAR struct tcb_s *btcb)
+{
+  FAR struct tcb_s *prev;
+  uint8_t sched_priority = btcb->sched_priority;
+  bool ret = false;
+
+  DEBUGASSERT(btcb != NULL);
+
+  /* The new TCB goes after the last TCB of equal priority or, if its
+   * priority level is unoccupied, after the last TCB of higher priority.
+   */
+
+  prev = g_readyq_tail[sched_priority];
+  if (prev == NULL)
+    {
+      prev = nxsched_readyq_higher_tail(sched_priority);
+    }
+
+  if (prev == NULL)
+    {
+      /* There is no higher priority task:  The new TCB goes at the head of
+       * the list and becomes the new active task.
+       */
+
+      btcb->flink = (FAR struct tcb_s *)g_readytorun.head;
+      btcb->blink = NULL;
+
+      if (btcb->flink != NULL)
+        {
+          btcb->flink->blink = btcb;
+        }
+      else
+        {
+          g_readytorun.tail = (FAR dq_entry_t *)btcb;
+        }
+
+      g_readytorun.head = (FAR dq_entry_t *)btcb;
+      ret = true;
+    }
+  else
+    {
+      /* Insert the new TCB immediately after 'prev' */
+
+      btcb->flink = prev->flink;
+      btcb->blink = prev;
+
+      if (prev->flink != NULL)
+        {
+          prev->flink->blink = btcb;
+        }
+      else
+        {
+          g_readytorun.tail = (FAR dq_entry_t *)btcb;
+        }
+
+      prev->flink = btcb;
+    }
+
+  /* The new TCB is now the last TCB at its priority level */
+
+  g_readyq_tail[sched_priority]       = btcb;
+  g_readyq_priomap[sched_priority >> 5] |= (1ul << (sched_priority & 31));
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxsched_readyq_remove
+ *
+ * Description:
+ *   Remove a TCB from the g_readytorun list, updating the priority bitmap
+ *   and per-priority tail pointers.
+ *
+ * Input Parameters:
+ *   rtcb - Points to the TCB to remove.  It must reside in the
+ *          g_readytorun list.
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ * - The caller has established a critical section before calling this
+ *   function.
+ *
+ ****************************************************************************/
+
+void nxsched_readyq_remove(FAR struct tcb_s *rtcb)
+{
+  uint8_t sched_priority = rtcb->sched_priority;
+
+  /* If this TCB is the last one at its priority level, then the new tail
+   * for the level is its predecessor -- but only if the predecessor has
+   * the same priority.  Otherwise, the priority level becomes unoccupied.
+   */
+
+  if (g_readyq_tail[sched_priority] == rtcb)
+    {
+      FAR struct tcb_s *prev = (FAR struct tcb_s *)rtcb->blink;
+
+      if (prev != NULL && prev->sched_priority == sched_priority)
+        {
+          g_readyq_tail[sched_priority] = prev;
+        }
+      else
+        {
+          g_readyq_tail[sched_priority] = NULL;
+          g_readyq_priomap[sched_priority >> 5] &=
+            ~(1ul << (sched_priority & 31));
+        }
+    }
+
+  dq_rem((FAR dq_entry_t *)rtcb, (FAR dq_queue_t *)&g_readytorun);
+}
+
+#endif /* CONFIG_SCHED_READYQ_BITMAP */
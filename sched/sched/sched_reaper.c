@@ -0,0 +1,139 @@
+/****************************************************************************
+ * sched/sched/sched_reaper.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <queue.h>
+#include <assert.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+#include <nuttx/wqueue.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_DEFERRED_REAP
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The list of defunct TCBs awaiting release.  The TCB task list links are
+ * reused since a defunct TCB is no longer in any task list.  The list is
+ * protected by the critical section.
+ */
+
+static dq_queue_t g_reaperq;
+
+/* The work entry used to run the reaper on the low-priority work queue */
+
+static struct work_s g_reaper_work;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_reaper_work
+ *
+ * Description:
+ *   Release all TCBs on the reaper list.  This runs on the low-priority
+ *   work queue, well outside of the exit-critical path.
+ *
+ ****************************************************************************/
+
+static void nxsched_reaper_work(FAR void *arg)
+{
+  FAR struct tcb_s *tcb;
+  irqstate_t flags;
+
+  for (; ; )
+    {
+      /* Remove the next defunct TCB from the reaper list */
+
+      flags = enter_critical_section();
+      tcb   = (FAR struct tcb_s *)dq_remfirst(&g_reaperq);
+      if (tcb == NULL)
+        {
+          leave_critical_section(flags);
+          break;
+        }
+
+      /* Then free its stack and all other resources that it holds */
+
+      nxsched_release_tcb(tcb, tcb->flags & TCB_FLAG_TTYPE_MASK);
+      leave_critical_section(flags);
+    }
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsched_reap_tcb
+ *
+ * Description:
+ *   Queue a defunct TCB for deferred release.  The TCB must already have
+ *   been removed from all task lists and have completed all exit hook
+ *   processing; the only remaining work is to free the resources that it
+ *   holds (stack, kernel stack, TCB memory, PID hash slot, and any POSIX
+ *   timers).  That work is performed later on the low-priority work queue
+ *   so that the exiting context can hand off to the next runnable task
+ *   without paying for the deallocations.
+ *
+ * Input Parameters:
+ *   tcb - The defunct TCB to be released
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   The TCB is fully initialized (its thread type is taken from the TCB
+ *   flags).  Callers with partially initialized TCBs must use
+ *   nxsched_release_tcb() directly.
+ *
+ ****************************************************************************/
+
+void nxsched_reap_tcb(FAR struct tcb_s *tcb)
+{
+  irqstate_t flags;
+
+  DEBUGASSERT(tcb != NULL);
+
+  /* Add the defunct TCB to the reaper list */
+
+  flags = enter_critical_section();
+  dq_addlast((FAR dq_entry_t *)tcb, &g_reaperq);
+  leave_critical_section(flags);
+
+  /* And make sure that the reaper will run.  If the work entry is already
+   * queued, then the pending reaper pass will pick this TCB up too and
+   * work_queue() will simply re-queue the (idle) work entry.
+   */
+
+  work_queue(LPWORK, &g_reaper_work, nxsched_reaper_work, NULL, 0);
+}
+
+#endif /* CONFIG_SCHED_DEFERRED_REAP */
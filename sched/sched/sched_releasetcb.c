@@ -30,11 +30,16 @@
 
 #include <nuttx/arch.h>
 #include <nuttx/sched.h>
+#include <nuttx/spinlock.h>
 
 #include "sched/sched.h"
 #include "group/group.h"
 #include "timer/timer.h"
 
+#ifdef CONFIG_PTHREAD_CACHE
+#include "pthread/pthread.h"
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -48,15 +53,20 @@
 
 static void nxsched_releasepid(pid_t pid)
 {
+  FAR volatile struct pidhash_s *slot = &g_pidhash[PIDHASH(pid)];
+#ifdef CONFIG_SCHED_CPULOAD
   int hash_ndx = PIDHASH(pid);
+#endif
 
-  /* Make any pid associated with this hash available.  Note:
-   * no special precautions need be taken here because the
-   * following action is atomic
+  /* Make any pid associated with this hash available.  The TCB pointer
+   * must be invalidated BEFORE the pid is retired:  nxsched_get_tcb()
+   * examines the slot without locking and relies on this ordering to
+   * never return a stale TCB for a matching pid.
    */
 
-  g_pidhash[hash_ndx].tcb   = NULL;
-  g_pidhash[hash_ndx].pid   = INVALID_PROCESS_ID;
+  slot->tcb = NULL;
+  SP_DMB();
+  slot->pid = INVALID_PROCESS_ID;
 
 #ifdef CONFIG_SCHED_CPULOAD
   /* Decrement the total CPU load count held by this thread from the
@@ -97,6 +107,9 @@ static void nxsched_releasepid(pid_t pid)
 
 int nxsched_release_tcb(FAR struct tcb_s *tcb, uint8_t ttype)
 {
+#ifdef CONFIG_PTHREAD_CACHE
+  bool recycle = false;
+#endif
   int ret = OK;
 
   if (tcb)
@@ -131,7 +144,17 @@ int nxsched_release_tcb(FAR struct tcb_s *tcb, uint8_t ttype)
 
       if (tcb->stack_alloc_ptr)
         {
-          up_release_stack(tcb, ttype);
+#ifdef CONFIG_PTHREAD_CACHE
+          /* Try to keep the stack attached so that the TCB/stack pair can
+           * be recycled by a later pthread_create().
+           */
+
+          recycle = pthread_tcb_cache_claim(tcb, ttype);
+          if (!recycle)
+#endif
+            {
+              up_release_stack(tcb, ttype);
+            }
         }
 
 #ifdef CONFIG_PIC
@@ -166,9 +189,20 @@ int nxsched_release_tcb(FAR struct tcb_s *tcb, uint8_t ttype)
 
       group_leave(tcb);
 
-      /* And, finally, release the TCB itself */
+      /* And, finally, release the TCB itself (or save it, with its stack
+       * still attached, for re-use by a later pthread_create()).
+       */
 
-      kmm_free(tcb);
+#ifdef CONFIG_PTHREAD_CACHE
+      if (recycle)
+        {
+          pthread_tcb_cache_commit(tcb);
+        }
+      else
+#endif
+        {
+          kmm_free(tcb);
+        }
     }
 
   return ret;
@@ -82,6 +82,15 @@ void nxsched_remove_blocked(FAR struct tcb_s *btcb)
 
   dq_rem((FAR dq_entry_t *)btcb, TLIST_BLOCKED(task_state));
 
+#ifdef CONFIG_SCHED_EDF
+  /* An EDF task waking from a blocked state begins its next job */
+
+  if ((btcb->flags & TCB_FLAG_SCHED_EDF) != 0)
+    {
+      nxsched_edf_newjob(btcb);
+    }
+#endif
+
   /* Make sure the TCB's state corresponds to not being in
    * any list
    */
@@ -95,6 +95,14 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *rtcb)
       DEBUGASSERT(nxttcb != NULL);
 
       nxttcb->task_state = TSTATE_TASK_RUNNING;
+
+#ifdef CONFIG_SCHED_RUSAGE
+      /* The running task is giving up the CPU:  a voluntary context
+       * switch.
+       */
+
+      rtcb->nvcsw++;
+#endif
       doswitch = true;
     }
 
@@ -102,7 +110,11 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *rtcb)
    * is always the g_readytorun list.
    */
 
+#ifdef CONFIG_SCHED_READYQ_BITMAP
+  nxsched_readyq_remove(rtcb);
+#else
   dq_rem((FAR dq_entry_t *)rtcb, (FAR dq_queue_t *)&g_readytorun);
+#endif
 
   /* Since the TCB is not in any list, it is now invalid */
 
@@ -177,6 +189,14 @@ bool nxsched_remove_readytorun(FAR struct tcb_s *rtcb)
       nxttcb = (FAR struct tcb_s *)rtcb->flink;
       DEBUGASSERT(nxttcb != NULL);
 
+#ifdef CONFIG_SCHED_RUSAGE
+      /* The running task is giving up the CPU:  a voluntary context
+       * switch.
+       */
+
+      rtcb->nvcsw++;
+#endif
+
       /* If we are modifying the head of some assigned task list other than
        * our own, we will need to stop that CPU.
        */
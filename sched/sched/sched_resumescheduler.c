@@ -41,9 +41,11 @@
 
 #include <assert.h>
 
+#include <nuttx/arch.h>
 #include <nuttx/sched.h>
 #include <nuttx/clock.h>
 #include <nuttx/sched_note.h>
+#include <nuttx/usershare.h>
 
 #include "irq/irq.h"
 #include "sched/sched.h"
@@ -100,9 +102,15 @@ void nxsched_resume_scheduler(FAR struct tcb_s *tcb)
 #ifdef CONFIG_SCHED_CRITMONITOR
   nxsched_resume_critmon(tcb);
 #endif
+#ifdef CONFIG_STACK_GUARD
+  up_stack_guard(tcb);
+#endif
 #ifdef CONFIG_SCHED_INSTRUMENTATION
   sched_note_resume(tcb);
 #endif
+#ifdef CONFIG_LIB_USERSHARE
+  nxsched_usershare_switch(tcb);
+#endif
 
 #ifdef CONFIG_SMP
   /* NOTE: The following logic for adjusting global IRQ controls were
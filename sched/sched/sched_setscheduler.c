@@ -80,6 +80,7 @@ int nxsched_set_scheduler(pid_t pid, int policy,
 {
   FAR struct tcb_s *tcb;
   irqstate_t flags;
+  int priority = param->sched_priority;
   int ret;
 
   /* Check for supported scheduling policy */
@@ -90,6 +91,9 @@ int nxsched_set_scheduler(pid_t pid, int policy,
 #endif
 #ifdef CONFIG_SCHED_SPORADIC
       && policy != SCHED_SPORADIC
+#endif
+#ifdef CONFIG_SCHED_EDF
+      && policy != SCHED_EDF
 #endif
      )
     {
@@ -120,7 +124,7 @@ int nxsched_set_scheduler(pid_t pid, int policy,
   /* Further, disable timer interrupts while we set up scheduling policy. */
 
   flags = enter_critical_section();
-  tcb->flags &= ~TCB_FLAG_POLICY_MASK;
+  tcb->flags &= ~(TCB_FLAG_POLICY_MASK | TCB_FLAG_SCHED_EDF);
   switch (policy)
     {
       default:
@@ -258,6 +262,33 @@ int nxsched_set_scheduler(pid_t pid, int policy,
         break;
 #endif
 
+#ifdef CONFIG_SCHED_EDF
+      case SCHED_EDF:
+        {
+          /* Validate the deadline parameters and perform the admission
+           * test.
+           */
+
+          ret = nxsched_edf_set(tcb, param);
+          if (ret < 0)
+            {
+              goto errout_with_irq;
+            }
+
+          /* The task was admitted.  EDF tasks execute at the configured
+           * band priority with FIFO semantics; the EDF flag selects the
+           * deadline ordering within the band.
+           */
+
+          tcb->flags       |= TCB_FLAG_SCHED_FIFO | TCB_FLAG_SCHED_EDF;
+#if CONFIG_RR_INTERVAL > 0 || defined(CONFIG_SCHED_SPORADIC)
+          tcb->timeslice    = 0;
+#endif
+          priority          = CONFIG_SCHED_EDF_PRIORITY;
+        }
+        break;
+#endif
+
 #if 0 /* Not supported */
       case SCHED_OTHER:
         tcb->flags    |= TCB_FLAG_SCHED_OTHER;
@@ -269,11 +300,11 @@ int nxsched_set_scheduler(pid_t pid, int policy,
 
   /* Set the new priority */
 
-  ret = nxsched_reprioritize(tcb, param->sched_priority);
+  ret = nxsched_reprioritize(tcb, priority);
   sched_unlock();
   return ret;
 
-#ifdef CONFIG_SCHED_SPORADIC
+#if defined(CONFIG_SCHED_SPORADIC) || defined(CONFIG_SCHED_EDF)
 errout_with_irq:
   leave_critical_section(flags);
   sched_unlock();
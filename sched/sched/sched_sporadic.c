@@ -498,16 +498,25 @@ static void sporadic_budget_expire(wdparm_t arg)
   sporadic = tcb->sporadic;
   DEBUGASSERT(sporadic != NULL);
 
-  if (sporadic->suspended)
+  if (!sporadic->suspended)
+    {
+      /* No.. the thread consumed its entire execution budget while
+       * running.  Account for the exhaustion before dropping the
+       * priority.
+       */
+
+      sporadic->exhaustions++;
+    }
+  else
     {
       uint32_t unrealized;
 
-      /* The unrealized time is the interval from when the thread as
-       * suspended (or which the budget interval was started in the case
+      /* The unrealized time is the interval from when the thread was
+       * suspended (or when the budget interval was started in the case
        * that the thread was delayed for the entire interval).
        */
 
-      unrealized = sporadic->eventtime - clock_systime_ticks();
+      unrealized = clock_systime_ticks() - sporadic->eventtime;
       if (unrealized > 0)
         {
           /* Allocate a new replenishment timer.  This will limit us to the
@@ -964,6 +973,7 @@ int nxsched_reset_sporadic(FAR struct tcb_s *tcb)
   sporadic->nrepls       = 0;
   sporadic->repl_period  = 0;
   sporadic->budget       = 0;
+  sporadic->exhaustions  = 0;
   sporadic->eventtime    = 0;
   sporadic->active       = NULL;
   return OK;
@@ -0,0 +1,199 @@
+/****************************************************************************
+ * sched/sched/sched_usershare.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <time.h>
+#include <errno.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/sched.h>
+#include <nuttx/usershare.h>
+
+#include "clock/clock.h"
+#include "sched/sched.h"
+
+#ifdef CONFIG_LIB_USERSHARE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The time-of-day fields can only be maintained if the timer tick is the
+ * authoritative time source.
+ */
+
+#undef HAVE_USERSHARE_REALTIME
+#if !defined(CONFIG_RTC_HIRES) && !defined(CONFIG_SCHED_TICKLESS) && \
+    !defined(CONFIG_CLOCK_TIMEKEEPING)
+#  define HAVE_USERSHARE_REALTIME 1
+#endif
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* The registered user-space shared information structure, or NULL if no
+ * structure has been registered yet.  The structure lies in user-space
+ * memory; in the protected build the kernel can write it directly while
+ * user code can only read it.
+ */
+
+static FAR struct usershare_s *g_usershare_sched;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: usershare_register
+ *
+ * Description:
+ *   Register the user-space shared information structure with the kernel.
+ *   This is a system call.  The kernel will begin updating the structure
+ *   fields indicated by us_flags.
+ *
+ * Input Parameters:
+ *   share - The address of the structure in user-space memory.
+ *
+ * Returned Value:
+ *   Zero (OK) on success; a negated errno value is returned on failure.
+ *
+ ****************************************************************************/
+
+int usershare_register(FAR struct usershare_s *share)
+{
+  uint32_t flags;
+
+  if (share == NULL)
+    {
+      return -EINVAL;
+    }
+
+  /* Initialize the shared structure and report which fields will be
+   * maintained in this configuration.  The time-of-day fields can only be
+   * maintained if the timer tick is the authoritative time source; with a
+   * high resolution RTC, a tickless timer, or timekeeping, user code must
+   * continue to trap into the kernel for the time of day.
+   */
+
+  share->us_seq = 0;
+  share->us_pid = 0;
+
+  flags = USERSHARE_PID;
+#ifdef HAVE_USERSHARE_REALTIME
+  flags |= USERSHARE_REALTIME;
+#endif
+
+  share->us_flags = flags;
+
+  /* Make the structure visible to the update hooks only after it has been
+   * fully initialized.
+   */
+
+  g_usershare_sched = share;
+
+  /* Populate the time of day now rather than leaving it stale until the
+   * next timer tick.
+   */
+
+  nxsched_usershare_tick();
+  return OK;
+}
+
+/****************************************************************************
+ * Name: nxsched_usershare_tick
+ *
+ * Description:
+ *   Update the time-of-day fields of the registered user-space shared
+ *   information structure.  Called from the system timer processing logic
+ *   on each timer tick.
+ *
+ ****************************************************************************/
+
+void nxsched_usershare_tick(void)
+{
+#ifdef HAVE_USERSHARE_REALTIME
+  FAR struct usershare_s *share = g_usershare_sched;
+  struct timespec ts;
+
+  if (share == NULL)
+    {
+      return;
+    }
+
+  /* Compute CLOCK_REALTIME exactly as clock_gettime() would:  the elapsed
+   * time since power up plus the time of day at power up.
+   */
+
+  if (clock_systime_timespec(&ts) < 0)
+    {
+      return;
+    }
+
+  ts.tv_sec  += (uint32_t)g_basetime.tv_sec;
+  ts.tv_nsec += (uint32_t)g_basetime.tv_nsec;
+  if (ts.tv_nsec >= NSEC_PER_SEC)
+    {
+      ts.tv_sec++;
+      ts.tv_nsec -= NSEC_PER_SEC;
+    }
+
+  /* Publish the new time under the sequence count.  The count is odd
+   * while the fields are inconsistent.
+   */
+
+  share->us_seq++;
+  share->us_sec  = ts.tv_sec;
+  share->us_nsec = ts.tv_nsec;
+  share->us_seq++;
+#endif /* HAVE_USERSHARE_REALTIME */
+}
+
+/****************************************************************************
+ * Name: nxsched_usershare_switch
+ *
+ * Description:
+ *   Update the PID field of the registered user-space shared information
+ *   structure.  Called when a new task is about to be resumed.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the thread to be restarted.
+ *
+ ****************************************************************************/
+
+void nxsched_usershare_switch(FAR struct tcb_s *tcb)
+{
+  FAR struct usershare_s *share = g_usershare_sched;
+
+  if (share != NULL)
+    {
+      /* A PID is a single aligned word so no sequence count is needed */
+
+      share->us_pid = tcb->pid;
+    }
+}
+
+#endif /* CONFIG_LIB_USERSHARE */
@@ -44,6 +44,32 @@
 #  define CONFIG_SEM_PREALLOCHOLDERS 0
 #endif
 
+#ifndef CONFIG_SEM_TCB_HOLDERS
+#  define CONFIG_SEM_TCB_HOLDERS 0
+#endif
+
+#ifndef CONFIG_SEM_PI_CHAIN_MAX
+#  define CONFIG_SEM_PI_CHAIN_MAX 0
+#endif
+
+/* In both the pre-allocated pool and the per-TCB configurations, the
+ * holder records are kept in a singly linked list attached to the
+ * semaphore.
+ */
+
+#undef HAVE_HOLDER_LIST
+#if CONFIG_SEM_PREALLOCHOLDERS > 0 || CONFIG_SEM_TCB_HOLDERS > 0
+#  define HAVE_HOLDER_LIST 1
+#endif
+
+/* Count a priority boost event */
+
+#ifdef CONFIG_SEM_BOOST_STATS
+#  define nxsem_count_boost() (g_sem_boost_stats.nboosts++)
+#else
+#  define nxsem_count_boost()
+#endif
+
 /****************************************************************************
  * Private Type Declarations
  ****************************************************************************/
@@ -62,14 +88,50 @@ static struct semholder_s g_holderalloc[CONFIG_SEM_PREALLOCHOLDERS];
 static FAR struct semholder_s *g_freeholders;
 #endif
 
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+#ifdef CONFIG_SEM_BOOST_STATS
+struct sem_boost_stats_s g_sem_boost_stats;
+#endif
+
 /****************************************************************************
  * Name: nxsem_allocholder
  ****************************************************************************/
 
-static inline FAR struct semholder_s *nxsem_allocholder(sem_t *sem)
+static inline FAR struct semholder_s *nxsem_allocholder(sem_t *sem,
+                                               FAR struct tcb_s *htcb)
 {
   FAR struct semholder_s *pholder;
 
+#if CONFIG_SEM_TCB_HOLDERS > 0
+  int i;
+
+  /* Take a record from the holder thread's own embedded pool.  The scan
+   * is bounded by CONFIG_SEM_TCB_HOLDERS and no other thread can consume
+   * this thread's records.
+   */
+
+  pholder = NULL;
+  for (i = 0; i < CONFIG_SEM_TCB_HOLDERS; i++)
+    {
+      if (htcb->holdpool[i].htcb == NULL)
+        {
+          pholder          = &htcb->holdpool[i];
+          pholder->counts  = 0;
+          pholder->sem     = sem;
+          pholder->flink   = sem->hhead;
+          sem->hhead       = pholder;
+          break;
+        }
+    }
+
+  if (pholder == NULL)
+    {
+      serr("ERROR: Per-TCB holder records exhausted\n");
+    }
+#else
   /* Check if the "built-in" holder is being used.  We have this built-in
    * holder to optimize for the simplest case where semaphores are only
    * used to implement mutexes.
@@ -108,6 +170,7 @@ static inline FAR struct semholder_s *nxsem_allocholder(sem_t *sem)
       serr("ERROR: Insufficient pre-allocated holders\n");
       pholder          = NULL;
     }
+#endif /* CONFIG_SEM_TCB_HOLDERS > 0 */
 
   DEBUGASSERT(pholder != NULL);
   return pholder;
@@ -127,7 +190,7 @@ static FAR struct semholder_s *nxsem_findholder(sem_t *sem,
 {
   FAR struct semholder_s *pholder;
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef HAVE_HOLDER_LIST
   /* Try to find the holder in the list of holders associated with this
    * semaphore
    */
@@ -174,7 +237,7 @@ nxsem_findorallocateholder(sem_t *sem, FAR struct tcb_s *htcb)
   FAR struct semholder_s *pholder = nxsem_findholder(sem, htcb);
   if (!pholder)
     {
-      pholder = nxsem_allocholder(sem);
+      pholder = nxsem_allocholder(sem, htcb);
     }
 
   return pholder;
@@ -187,7 +250,7 @@ nxsem_findorallocateholder(sem_t *sem, FAR struct tcb_s *htcb)
 static inline void nxsem_freeholder(sem_t *sem,
                                     FAR struct semholder_s *pholder)
 {
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef HAVE_HOLDER_LIST
   FAR struct semholder_s *curr;
   FAR struct semholder_s *prev;
 #endif
@@ -196,8 +259,11 @@ static inline void nxsem_freeholder(sem_t *sem,
 
   pholder->htcb   = NULL;
   pholder->counts = 0;
+#if CONFIG_SEM_TCB_HOLDERS > 0
+  pholder->sem    = NULL;
+#endif
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef HAVE_HOLDER_LIST
   /* Search the list for the matching holder */
 
   for (prev = NULL, curr = sem->hhead;
@@ -217,10 +283,14 @@ static inline void nxsem_freeholder(sem_t *sem,
           sem->hhead = pholder->flink;
         }
 
-      /* And put it in the free list */
+#if CONFIG_SEM_PREALLOCHOLDERS > 0
+      /* And put it in the free list.  (A per-TCB record simply becomes
+       * available again in its owning TCB.)
+       */
 
       pholder->flink = g_freeholders;
       g_freeholders  = pholder;
+#endif
     }
 #endif
 }
@@ -254,7 +324,7 @@ static int nxsem_foreachholder(FAR sem_t *sem, holderhandler_t handler,
   FAR struct semholder_s *pholder;
   int ret = 0;
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef HAVE_HOLDER_LIST
   FAR struct semholder_s *next;
 
   for (pholder = sem->hhead; pholder && ret == 0; pholder = next)
@@ -301,7 +371,7 @@ static int nxsem_foreachholder(FAR sem_t *sem, holderhandler_t handler,
  * Name: nxsem_recoverholders
  ****************************************************************************/
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef HAVE_HOLDER_LIST
 static int nxsem_recoverholders(FAR struct semholder_s *pholder,
                                 FAR sem_t *sem, FAR void *arg)
 {
@@ -310,6 +380,95 @@ static int nxsem_recoverholders(FAR struct semholder_s *pholder,
 }
 #endif
 
+/****************************************************************************
+ * Name: nxsem_boostchain
+ *
+ * Description:
+ *   Propagate a priority boost along a chain of blocked holders:  if the
+ *   thread that was just boosted is itself blocked on another priority
+ *   inheritance semaphore, then the holder of that semaphore must inherit
+ *   the boosted priority as well, and so on.  The walk is bounded by
+ *   CONFIG_SEM_PI_CHAIN_MAX links and each step costs only a pointer
+ *   dereference and a priority comparison.
+ *
+ *   The chain is resolved through the first holder of each semaphore.
+ *   This fully resolves mutex-style locking chains where each semaphore
+ *   has exactly one holder; additional holders of a counting semaphore
+ *   were already boosted when the blocked thread first waited on it.
+ *
+ ****************************************************************************/
+
+#if CONFIG_SEM_PI_CHAIN_MAX > 0
+static void nxsem_boostchain(FAR struct tcb_s *htcb, uint8_t priority)
+{
+  int depth;
+
+  for (depth = 1; depth < CONFIG_SEM_PI_CHAIN_MAX; depth++)
+    {
+      FAR struct semholder_s *pholder;
+      FAR sem_t *bsem;
+
+      /* Stop when the boosted holder is not itself blocked on another
+       * priority inheritance semaphore.
+       */
+
+      if (htcb->task_state != TSTATE_WAIT_SEM)
+        {
+          break;
+        }
+
+      bsem = htcb->waitsem;
+      if (bsem == NULL || (bsem->flags & PRIOINHERIT_FLAGS_DISABLE) != 0)
+        {
+          break;
+        }
+
+      /* Find the first holder of the semaphore that is blocking the chain */
+
+#ifdef HAVE_HOLDER_LIST
+      pholder = bsem->hhead;
+#else
+      pholder = &bsem->holder[0];
+      if (pholder->htcb == NULL)
+        {
+          pholder = &bsem->holder[1];
+        }
+#endif
+
+      if (pholder == NULL || pholder->htcb == NULL ||
+          !nxsched_verify_tcb(pholder->htcb))
+        {
+          break;
+        }
+
+      /* Stop when the holder is already running at a sufficient priority */
+
+      htcb = pholder->htcb;
+      if (htcb->sched_priority >= priority)
+        {
+          break;
+        }
+
+      nxsched_set_priority(htcb, priority);
+      nxsem_count_boost();
+    }
+
+#ifdef CONFIG_SEM_BOOST_STATS
+  if (depth > 1)
+    {
+      g_sem_boost_stats.nchains++;
+    }
+
+  if (depth > g_sem_boost_stats.maxdepth)
+    {
+      g_sem_boost_stats.maxdepth = depth;
+    }
+#endif
+}
+#else
+#  define nxsem_boostchain(htcb,priority)
+#endif
+
 /****************************************************************************
  * Name: nxsem_boostholderprio
  ****************************************************************************/
@@ -378,6 +537,8 @@ static int nxsem_boostholderprio(FAR struct semholder_s *pholder,
            */
 
           nxsched_set_priority(htcb, rtcb->sched_priority);
+          nxsem_count_boost();
+          nxsem_boostchain(htcb, rtcb->sched_priority);
         }
       else
         {
@@ -416,6 +577,8 @@ static int nxsem_boostholderprio(FAR struct semholder_s *pholder,
        */
 
       nxsched_set_priority(htcb, rtcb->sched_priority);
+      nxsem_count_boost();
+      nxsem_boostchain(htcb, rtcb->sched_priority);
     }
 #endif
 
@@ -459,7 +622,7 @@ static int nxsem_verifyholder(FAR struct semholder_s *pholder,
 static int nxsem_dumpholder(FAR struct semholder_s *pholder, FAR sem_t *sem,
                             FAR void *arg)
 {
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef HAVE_HOLDER_LIST
   _info("  %08x: %08x %08x %04x\n",
         pholder, pholder->flink, pholder->htcb, pholder->counts);
 #else
@@ -898,7 +1061,7 @@ void nxsem_destroyholder(FAR sem_t *sem)
    * any stranded holders and hope the task knows what it is doing.
    */
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+#ifdef HAVE_HOLDER_LIST
   if (sem->hhead != NULL)
     {
       /* There may be an issue if there are multiple holders of
@@ -1200,4 +1363,42 @@ int nxsem_nfreeholders(void)
 }
 #endif
 
+/****************************************************************************
+ * Name: nxsem_recover_holders
+ *
+ * Description:
+ *   Called from nxsem_recover() when a task or thread is destroyed.  The
+ *   holder records of the exiting thread are embedded in its TCB; any
+ *   record still linked into a semaphore holder list must be removed
+ *   before the TCB memory is freed.  The counts held by the exiting
+ *   thread are lost, just as in the pool configuration.
+ *
+ * Input Parameters:
+ *   tcb - The TCB of the terminated task or thread
+ *
+ * Returned Value:
+ *   None
+ *
+ * Assumptions:
+ *   Interrupts are disabled.
+ *
+ ****************************************************************************/
+
+#if CONFIG_SEM_TCB_HOLDERS > 0
+void nxsem_recover_holders(FAR struct tcb_s *tcb)
+{
+  int i;
+
+  for (i = 0; i < CONFIG_SEM_TCB_HOLDERS; i++)
+    {
+      FAR struct semholder_s *pholder = &tcb->holdpool[i];
+
+      if (pholder->htcb != NULL && pholder->sem != NULL)
+        {
+          nxsem_freeholder(pholder->sem, pholder);
+        }
+    }
+}
+#endif
+
 #endif /* CONFIG_PRIORITY_INHERITANCE */
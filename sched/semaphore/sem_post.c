@@ -77,6 +77,20 @@ int nxsem_post(FAR sem_t *sem)
 
   if (sem != NULL)
     {
+#ifdef CONFIG_SEM_FASTPATH
+      /* If no threads are waiting on the semaphore, then return the count
+       * with a single atomic operation, avoiding the cost of the critical
+       * section entirely.  The critical section is needed only to wake up
+       * a waiting thread.
+       */
+
+      ret = nxsem_post_fast(sem);
+      if (ret != -EAGAIN)
+        {
+          return ret;
+        }
+#endif
+
       /* The following operations must be performed with interrupts
        * disabled because sem_post() may be called from an interrupt
        * handler.
@@ -110,7 +124,7 @@ int nxsem_post(FAR sem_t *sem)
        */
 
       nxsem_release_holder(sem);
-      sem->semcount++;
+      nxsem_count_add(sem, 1);
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
       /* Don't let any unblocked tasks run until we complete any priority
@@ -110,7 +110,7 @@ void nxsem_recover(FAR struct tcb_s *tcb)
        * place.
        */
 
-      sem->semcount++;
+      nxsem_count_add(sem, 1);
 
       /* Clear the semaphore to assure that it is not reused.  But leave the
        * state as TSTATE_WAIT_SEM.  This is necessary because this is a
@@ -121,5 +121,14 @@ void nxsem_recover(FAR struct tcb_s *tcb)
       tcb->waitsem = NULL;
     }
 
+#if defined(CONFIG_PRIORITY_INHERITANCE) && CONFIG_SEM_TCB_HOLDERS > 0
+  /* The holder records of the exiting thread are embedded in its TCB.
+   * Remove any record still linked into a semaphore holder list before
+   * the TCB memory is freed.
+   */
+
+  nxsem_recover_holders(tcb);
+#endif
+
   leave_critical_section(flags);
 }
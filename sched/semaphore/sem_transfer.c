@@ -0,0 +1,153 @@
+/****************************************************************************
+ * sched/semaphore/sem_transfer.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdbool.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/sched.h>
+
+#include "sched/sched.h"
+#include "semaphore/semaphore.h"
+
+#ifdef CONFIG_PTHREAD_WAITMORPH
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: nxsem_transfer
+ *
+ * Description:
+ *   Transfer the highest priority thread waiting on the semaphore 'from'
+ *   to the wait queue of the semaphore 'to' without waking it.  This is
+ *   the wait-morphing primitive used by pthread_cond_signal():  instead of
+ *   waking a waiter that would immediately block again on the mutex still
+ *   held by the signaler, the waiter is moved directly to the mutex wait
+ *   queue and is awakened only when the mutex is posted.
+ *
+ *   The transferred thread is marked with TCB_FLAG_SEM_TRANSFER so that
+ *   it can detect, after it is finally awakened, that it was granted the
+ *   destination semaphore directly and must not take it a second time.
+ *
+ *   This interface may not be used when priority inheritance is enabled:
+ *   the transfer bypasses the semaphore holder bookkeeping.
+ *
+ * Input Parameters:
+ *   from - The semaphore whose highest priority waiter is transferred.
+ *   to   - The semaphore that the waiter will block on.  A count must be
+ *          held on this semaphore by some other thread.
+ *
+ * Returned Value:
+ *   Zero (OK) if a waiter was transferred.  A negated errno value is
+ *   returned on any failure:
+ *
+ *     -ENOENT  No thread is waiting on 'from'.
+ *     -EINVAL  A count is available on 'to'; the waiter would block with
+ *              no holder left to post it.
+ *
+ * Assumptions:
+ *   This function may be called from an interrupt handler.
+ *
+ ****************************************************************************/
+
+int nxsem_transfer(FAR sem_t *from, FAR sem_t *to)
+{
+  FAR struct tcb_s *stcb;
+  irqstate_t flags;
+  int ret = -ENOENT;
+
+  DEBUGASSERT(from != NULL && to != NULL);
+
+  flags = enter_critical_section();
+
+  /* If no count is held on the destination semaphore, then the transferred
+   * thread could wait forever.  The caller must hold the destination
+   * semaphore (the mutex).
+   */
+
+  if (to->semcount > 0)
+    {
+      ret = -EINVAL;
+    }
+  else if (from->semcount < 0)
+    {
+      /* Find the highest priority thread waiting on 'from'.  The wait
+       * queue is prioritized so the first match is the one we want.
+       */
+
+      for (stcb = (FAR struct tcb_s *)g_waitingforsemaphore.head;
+           (stcb && stcb->waitsem != from);
+           stcb = stcb->flink);
+
+      if (stcb != NULL)
+        {
+          /* Re-target the wait.  The global wait queue is ordered only by
+           * priority so the thread's position in the queue is unchanged;
+           * only the semaphore counts and the TCB binding are updated.
+           */
+
+          nxsem_count_add(from, 1);
+          nxsem_count_add(to, -1);
+          stcb->waitsem = to;
+          stcb->flags  |= TCB_FLAG_SEM_TRANSFER;
+          ret = OK;
+        }
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
+
+/****************************************************************************
+ * Name: nxsem_transfer_received
+ *
+ * Description:
+ *   Test and clear the transfer marker on the calling thread.  A thread
+ *   that has returned from a semaphore wait calls this to learn whether
+ *   its wait was re-targeted by nxsem_transfer() while it was blocked.
+ *
+ * Returned Value:
+ *   True if the calling thread's wait was transferred.
+ *
+ ****************************************************************************/
+
+bool nxsem_transfer_received(void)
+{
+  FAR struct tcb_s *rtcb = this_task();
+  irqstate_t flags;
+  bool ret;
+
+  flags = enter_critical_section();
+  ret = (rtcb->flags & TCB_FLAG_SEM_TRANSFER) != 0;
+  rtcb->flags &= ~TCB_FLAG_SEM_TRANSFER;
+  leave_critical_section(flags);
+
+  return ret;
+}
+
+#endif /* CONFIG_PTHREAD_WAITMORPH */
@@ -79,8 +79,10 @@
 
 int nxsem_trywait(FAR sem_t *sem)
 {
+#ifndef CONFIG_SEM_FASTPATH
   FAR struct tcb_s *rtcb = this_task();
   irqstate_t flags;
+#endif
   int ret;
 
   /* This API should not be called from interrupt handlers */
@@ -89,6 +91,15 @@ int nxsem_trywait(FAR sem_t *sem)
 
   if (sem != NULL)
     {
+#ifdef CONFIG_SEM_FASTPATH
+      /* If the semaphore is available, then take a count with a single
+       * atomic operation, avoiding the cost of the critical section
+       * entirely.  There is never any need to block.
+       */
+
+      ret = nxsem_wait_fast(sem) ? OK : -EAGAIN;
+    }
+#else
       /* The following operations must be performed with interrupts disabled
        * because sem_post() may be called from an interrupt handler.
        */
@@ -101,7 +112,7 @@ int nxsem_trywait(FAR sem_t *sem)
         {
           /* It is, let the task take the semaphore */
 
-          sem->semcount--;
+          nxsem_count_add(sem, -1);
           rtcb->waitsem = NULL;
           ret = OK;
         }
@@ -116,6 +127,7 @@ int nxsem_trywait(FAR sem_t *sem)
 
       leave_critical_section(flags);
     }
+#endif /* CONFIG_SEM_FASTPATH */
   else
     {
       ret = -EINVAL;
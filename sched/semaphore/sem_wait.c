@@ -32,6 +32,11 @@
 #include <nuttx/arch.h>
 #include <nuttx/cancelpt.h>
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+#include <nuttx/clock.h>
+#include <nuttx/sched_note.h>
+#endif
+
 #include "sched/sched.h"
 #include "semaphore/semaphore.h"
 
@@ -71,12 +76,27 @@ int nxsem_wait(FAR sem_t *sem)
 {
   FAR struct tcb_s *rtcb = this_task();
   irqstate_t flags;
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+  clock_t start;
+#endif
   int ret = -EINVAL;
 
   /* This API should not be called from interrupt handlers */
 
   DEBUGASSERT(sem != NULL && up_interrupt_context() == false);
 
+#ifdef CONFIG_SEM_FASTPATH
+  /* If the semaphore is available, then take a count with a single atomic
+   * operation, avoiding the cost of the critical section entirely.  The
+   * critical section is needed only to block this thread.
+   */
+
+  if (sem != NULL && nxsem_wait_fast(sem))
+    {
+      return OK;
+    }
+#endif
+
   /* The following operations must be performed with interrupts
    * disabled because nxsem_post() may be called from an interrupt
    * handler.
@@ -94,7 +114,7 @@ int nxsem_wait(FAR sem_t *sem)
         {
           /* It is, let the task take the semaphore. */
 
-          sem->semcount--;
+          nxsem_count_add(sem, -1);
           nxsem_add_holder(sem);
           rtcb->waitsem = NULL;
           ret = OK;
@@ -114,7 +134,7 @@ int nxsem_wait(FAR sem_t *sem)
 
           /* Handle the POSIX semaphore (but don't set the owner yet) */
 
-          sem->semcount--;
+          nxsem_count_add(sem, -1);
 
           /* Save the waited on semaphore in the TCB */
 
@@ -150,6 +170,16 @@ int nxsem_wait(FAR sem_t *sem)
            */
 
           DEBUGASSERT(NULL != rtcb->flink);
+
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+          /* The wait is going to block.  Remember when so that the
+           * contention instrumentation (which costs nothing on the
+           * uncontended path) can report the blocked time.
+           */
+
+          start = clock_systime_ticks();
+#endif
+
           up_block_task(rtcb, TSTATE_WAIT_SEM);
 
           /* When we resume at this point, either (1) the semaphore has been
@@ -184,6 +214,15 @@ int nxsem_wait(FAR sem_t *sem)
 
           ret = rtcb->errcode != OK ? -rtcb->errcode : OK;
 
+#ifdef CONFIG_SCHED_INSTRUMENTATION_SEMAPHORE
+          /* Record the blocked wait in the note stream and in the
+           * contention summary.
+           */
+
+          sched_note_semwait(rtcb, sem,
+                             (uint32_t)(clock_systime_ticks() - start));
+#endif
+
 #ifdef CONFIG_PRIORITY_INHERITANCE
           sched_unlock();
 #endif
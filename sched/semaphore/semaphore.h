@@ -33,6 +33,7 @@
 #include <stdbool.h>
 #include <sched.h>
 #include <queue.h>
+#include <errno.h>
 
 /****************************************************************************
  * Public Function Prototypes
@@ -66,6 +67,15 @@ void nxsem_timeout(wdparm_t pid);
 
 void nxsem_recover(FAR struct tcb_s *tcb);
 
+/* Transfer a waiting thread from one semaphore wait queue to another
+ * (wait-morphing).
+ */
+
+#ifdef CONFIG_PTHREAD_WAITMORPH
+int nxsem_transfer(FAR sem_t *from, FAR sem_t *to);
+bool nxsem_transfer_received(void);
+#endif
+
 /* Special logic needed only by priority inheritance to manage collections of
  * holders of semaphores.
  */
@@ -79,6 +89,9 @@ void nxsem_boost_priority(FAR sem_t *sem);
 void nxsem_release_holder(FAR sem_t *sem);
 void nxsem_restore_baseprio(FAR struct tcb_s *stcb, FAR sem_t *sem);
 void nxsem_canceled(FAR struct tcb_s *stcb, FAR sem_t *sem);
+#if CONFIG_SEM_TCB_HOLDERS > 0
+void nxsem_recover_holders(FAR struct tcb_s *tcb);
+#endif
 #else
 #  define nxsem_initialize_holders()
 #  define nxsem_destroyholder(sem)
@@ -90,6 +103,83 @@ void nxsem_canceled(FAR struct tcb_s *stcb, FAR sem_t *sem);
 #  define nxsem_canceled(stcb,sem)
 #endif
 
+/* Atomic fast path support.  When CONFIG_SEM_FASTPATH is selected, all
+ * modifications of the semaphore count are performed with atomic
+ * operations so that uncontended wait and post operations can bypass the
+ * critical section entirely; the critical section is entered only to
+ * block or to wake up a waiting thread.
+ */
+
+#ifdef CONFIG_SEM_FASTPATH
+
+/* These macros are used in place of direct modification of the semaphore
+ * count in the blocking (slow) paths so that the count remains coherent
+ * with respect to the lock-free fast paths.
+ */
+
+#  define nxsem_count_add(sem,n) \
+     ((void)__atomic_add_fetch(&(sem)->semcount, (n), __ATOMIC_SEQ_CST))
+#  define nxsem_count_set(sem,v) \
+     __atomic_store_n(&(sem)->semcount, (v), __ATOMIC_SEQ_CST)
+
+/* Try to take a count from the semaphore without entering the critical
+ * section.  Returns true if a count was taken.  Returns false if the
+ * semaphore is unavailable; the caller must then fall back to the
+ * blocking (slow) path.
+ */
+
+static inline bool nxsem_wait_fast(FAR sem_t *sem)
+{
+  int16_t cur = __atomic_load_n(&sem->semcount, __ATOMIC_RELAXED);
+
+  while (cur > 0)
+    {
+      if (__atomic_compare_exchange_n(&sem->semcount, &cur, cur - 1,
+                                      false, __ATOMIC_SEQ_CST,
+                                      __ATOMIC_RELAXED))
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
+/* Try to return a count to the semaphore without entering the critical
+ * section.  This succeeds only if no threads are waiting (a negative
+ * count indicates the negated number of waiters).  Returns OK if the
+ * count was returned, -EOVERFLOW if the count is already at its maximum
+ * value, or -EAGAIN if there may be waiting threads; the caller must
+ * then fall back to the blocking (slow) path to perform the wakeup.
+ */
+
+static inline int nxsem_post_fast(FAR sem_t *sem)
+{
+  int16_t cur = __atomic_load_n(&sem->semcount, __ATOMIC_RELAXED);
+
+  while (cur >= 0)
+    {
+      if (cur >= SEM_VALUE_MAX)
+        {
+          return -EOVERFLOW;
+        }
+
+      if (__atomic_compare_exchange_n(&sem->semcount, &cur, cur + 1,
+                                      false, __ATOMIC_SEQ_CST,
+                                      __ATOMIC_RELAXED))
+        {
+          return OK;
+        }
+    }
+
+  return -EAGAIN;
+}
+
+#else
+#  define nxsem_count_add(sem,n) ((sem)->semcount += (n))
+#  define nxsem_count_set(sem,v) ((sem)->semcount = (v))
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
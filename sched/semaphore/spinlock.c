@@ -88,7 +88,19 @@ void spin_lock(FAR volatile spinlock_t *lock)
 
   while (up_testset(lock) == SP_LOCKED)
     {
-      SP_DSB();
+      /* The lock is held by another CPU.  Wait on a simple read of the
+       * lock until it appears to be free before retrying the atomic
+       * test-and-set.  Reading keeps the wait within the local cache and,
+       * on architectures that provide SP_WFE(), lets the CPU sleep until
+       * the holding CPU signals the release.
+       */
+
+      do
+        {
+          SP_DSB();
+          SP_WFE();
+        }
+      while (*lock == SP_LOCKED);
     }
 
 #ifdef CONFIG_SCHED_INSTRUMENTATION_SPINLOCKS
@@ -125,7 +137,16 @@ void spin_lock_wo_note(FAR volatile spinlock_t *lock)
 {
   while (up_testset(lock) == SP_LOCKED)
     {
-      SP_DSB();
+      /* Wait on a simple read of the lock before retrying the atomic
+       * test-and-set (see spin_lock()).
+       */
+
+      do
+        {
+          SP_DSB();
+          SP_WFE();
+        }
+      while (*lock == SP_LOCKED);
     }
 
   SP_DMB();
@@ -241,6 +262,7 @@ void spin_unlock(FAR volatile spinlock_t *lock)
   SP_DMB();
   *lock = SP_UNLOCKED;
   SP_DSB();
+  SP_SEV();
 }
 #endif
 
@@ -269,6 +291,7 @@ void spin_unlock_wo_note(FAR volatile spinlock_t *lock)
   SP_DMB();
   *lock = SP_UNLOCKED;
   SP_DSB();
+  SP_SEV();
 }
 
 /****************************************************************************
@@ -74,6 +74,16 @@ void nxsig_cleanup(FAR struct tcb_s *stcb)
       nxsig_release_pendingsigaction(sigq);
     }
 
+#ifdef CONFIG_SIG_PERTASK_SIGQ
+  /* Return any signal queue entry cached in the TCB to the free list */
+
+  if (stcb->sigqslot != NULL)
+    {
+      nxsig_release_pendingsigaction(stcb->sigqslot);
+      stcb->sigqslot = NULL;
+    }
+#endif
+
   /* Misc. signal-related clean-up */
 
   stcb->sigprocmask  = ALL_SIGNAL_SET;
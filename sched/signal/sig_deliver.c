@@ -81,6 +81,11 @@ void nxsig_deliver(FAR struct tcb_s *stcb)
         {
           /* All queued signal actions have been dispatched */
 
+#ifdef CONFIG_SIG_COALESCE_DELIVERY
+          /* Allow the next signal to schedule a new delivery */
+
+          stcb->flags &= ~TCB_FLAG_SIGDELIVER;
+#endif
           leave_critical_section(flags);
           break;
         }
@@ -191,8 +196,29 @@ void nxsig_deliver(FAR struct tcb_s *stcb)
 
       nxsig_unmask_pendingsignal();
 
+#ifdef CONFIG_SIG_PERTASK_SIGQ
+      /* Retain one generally available structure in the TCB so that the
+       * next signal sent to this task can bypass the free lists.  The
+       * interrupt-reserved and dynamically allocated structures are always
+       * returned to their proper homes.
+       */
+
+      flags = enter_critical_section();
+      if (stcb->sigqslot == NULL && sigq->type == SIG_ALLOC_FIXED)
+        {
+          stcb->sigqslot = sigq;
+          sigq           = NULL;
+        }
+
+      leave_critical_section(flags);
+      if (sigq != NULL)
+        {
+          nxsig_release_pendingsigaction(sigq);
+        }
+#else
       /* Then deallocate the signal structure */
 
       nxsig_release_pendingsigaction(sigq);
+#endif
     }
 }
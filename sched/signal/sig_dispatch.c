@@ -93,12 +93,29 @@ static int nxsig_queue_action(FAR struct tcb_s *stcb, siginfo_t *info)
 
   if ((sigact) && (sigact->act.sa_u._sa_sigaction))
     {
+#ifdef CONFIG_SIG_PERTASK_SIGQ
+      /* Try the per-task signal queue entry cached in the TCB first.  It
+       * was retained from a previous delivery to this task and avoids any
+       * access to the shared free lists.
+       */
+
+      flags = enter_critical_section();
+      sigq  = stcb->sigqslot;
+      stcb->sigqslot = NULL;
+      leave_critical_section(flags);
+
+      if (sigq == NULL)
+        {
+          sigq = nxsig_alloc_pendingsigaction();
+        }
+#else
       /* Allocate a new element for the signal queue. NOTE:
        * nxsig_alloc_pendingsigaction will force a system crash if it is
        * unable to allocate memory for the signal data.
        */
 
       sigq = nxsig_alloc_pendingsigaction();
+#endif
       if (!sigq)
         {
           ret = -ENOMEM;
@@ -400,7 +417,22 @@ int nxsig_tcbdispatch(FAR struct tcb_s *stcb, siginfo_t *info)
        * up_schedule_sigaction()
        */
 
+#ifdef CONFIG_SIG_COALESCE_DELIVERY
+      /* But not if a delivery is already scheduled or in progress on the
+       * recipient's thread.  nxsig_deliver() drains every queued signal
+       * action before it returns, so the action queued above will be
+       * handled by the in-flight trampoline entry without the cost of
+       * another context save/restore.
+       */
+
+      if ((stcb->flags & TCB_FLAG_SIGDELIVER) == 0)
+        {
+          stcb->flags |= TCB_FLAG_SIGDELIVER;
+          up_schedule_sigaction(stcb, nxsig_deliver);
+        }
+#else
       up_schedule_sigaction(stcb, nxsig_deliver);
+#endif
 
       /* Check if the task is waiting for an unmasked signal. If so, then
        * unblock it. This must be performed in a critical section because
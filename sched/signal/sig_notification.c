@@ -25,10 +25,12 @@
 #include <nuttx/config.h>
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <string.h>
 #include <signal.h>
 #include <debug.h>
 
+#include <nuttx/irq.h>
 #include <nuttx/signal.h>
 
 #include "sched/sched.h"
@@ -157,6 +159,92 @@ int nxsig_notification(pid_t pid, FAR struct sigevent *event,
   return event->sigev_notify == SIGEV_NONE ? OK : -ENOSYS;
 }
 
+/****************************************************************************
+ * Name: nxsig_notification_pending
+ *
+ * Description:
+ *   Check if a signal notification queued by a previous call to
+ *   nxsig_notification() with the same sigevent is still pending (i.e.,
+ *   queued but not yet delivered to or accepted by the client).  This may
+ *   be used to coalesce repeated notifications of the same event while an
+ *   earlier one has not yet been handled.
+ *
+ * Input Parameters:
+ *   pid   - The task/thread ID of the client thread that was signaled.
+ *   event - The instance of struct sigevent that describes how the client
+ *           was signaled.
+ *   code  - Source: SI_USER, SI_QUEUE, SI_TIMER, SI_ASYNCIO, or SI_MESGQ
+ *
+ * Returned Value:
+ *   true if a matching signal is still queued for the client; false
+ *   otherwise (including for non-signal notification methods).
+ *
+ ****************************************************************************/
+
+bool nxsig_notification_pending(pid_t pid, FAR struct sigevent *event,
+                                int code)
+{
+  FAR struct tcb_s *stcb;
+  FAR sigq_t *sigq;
+  FAR sigpendq_t *sigpend;
+  irqstate_t flags;
+  bool pending = false;
+
+  /* Only signal notifications leave queued state behind */
+
+  if (event->sigev_notify != SIGEV_SIGNAL)
+    {
+      return false;
+    }
+
+  /* The lists are modified from the interrupt level */
+
+  flags = enter_critical_section();
+
+  stcb = nxsched_get_tcb(pid);
+  if (stcb != NULL)
+    {
+      /* Search the list of queued signal actions awaiting delivery */
+
+      for (sigq = (FAR sigq_t *)stcb->sigpendactionq.head;
+           sigq != NULL;
+           sigq = sigq->flink)
+        {
+          if (sigq->info.si_signo == event->sigev_signo &&
+              sigq->info.si_code  == code &&
+              sigq->info.si_value.sival_ptr ==
+              event->sigev_value.sival_ptr)
+            {
+              pending = true;
+              break;
+            }
+        }
+
+      /* Then search the group list of blocked, pending signals */
+
+      if (!pending && stcb->group != NULL)
+        {
+          for (sigpend = (FAR sigpendq_t *)
+                 stcb->group->tg_sigpendingq.head;
+               sigpend != NULL;
+               sigpend = sigpend->flink)
+            {
+              if (sigpend->info.si_signo == event->sigev_signo &&
+                  sigpend->info.si_code  == code &&
+                  sigpend->info.si_value.sival_ptr ==
+                  event->sigev_value.sival_ptr)
+                {
+                  pending = true;
+                  break;
+                }
+            }
+        }
+    }
+
+  leave_critical_section(flags);
+  return pending;
+}
+
 /****************************************************************************
  * Name: nxsig_cancel_notification
  *
@@ -34,6 +34,7 @@
 #include <nuttx/arch.h>
 #include <nuttx/sched.h>
 #include <nuttx/signal.h>
+#include <nuttx/spinlock.h>
 
 #include "sched/sched.h"
 #include "pthread/pthread.h"
@@ -112,13 +113,18 @@ static int nxtask_assign_pid(FAR struct tcb_s *tcb)
 
       if (!g_pidhash[hash_ndx].tcb)
         {
-          /* Assign this PID to the task */
+          /* Assign this PID to the task.  The TCB pointer must be bound
+           * BEFORE the pid is published:  nxsched_get_tcb() examines the
+           * slot without locking and relies on this ordering so that a
+           * matching pid always finds the bound TCB.
+           */
 
           g_pidhash[hash_ndx].tcb   = tcb;
-          g_pidhash[hash_ndx].pid   = next_pid;
 #ifdef CONFIG_SCHED_CPULOAD
           g_pidhash[hash_ndx].ticks = 0;
 #endif
+          SP_DMB();
+          g_pidhash[hash_ndx].pid   = next_pid;
           tcb->pid = next_pid;
 
           sched_unlock();
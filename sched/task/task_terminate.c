@@ -194,9 +194,20 @@ int nxtask_terminate(pid_t pid, bool nonblocking)
 
   sched_note_stop(dtcb);
 
+#ifdef CONFIG_SCHED_DEFERRED_REAP
+  /* Hand the defunct TCB to the reaper.  Its stack and other resources
+   * will be freed later on the low-priority work queue so that this
+   * context can switch to the next runnable task without paying for the
+   * deallocations.
+   */
+
+  nxsched_reap_tcb(dtcb);
+  return OK;
+#else
   /* Deallocate its TCB */
 
   return nxsched_release_tcb(dtcb, dtcb->flags & TCB_FLAG_TTYPE_MASK);
+#endif
 
 errout_with_lock:
   leave_critical_section(flags);
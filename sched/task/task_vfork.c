@@ -111,6 +111,16 @@ static inline int nxvfork_setup_stackargs(FAR struct tcb_s *parent,
   if ((parent->flags & TCB_FLAG_TTYPE_MASK) != TCB_FLAG_TTYPE_PTHREAD)
     {
       FAR struct task_tcb_s *ptcb = (FAR struct task_tcb_s *)parent;
+#ifdef CONFIG_SCHED_VFORK_SHARED_ARGV
+      /* The parent is blocked in waitpid() until the child exits or execs,
+       * so the parent's argument strings remain valid for the entire
+       * lifetime of the child and may simply be referenced.  The child
+       * does not re-enter main(); the arguments are only used for
+       * reporting.
+       */
+
+      child->argv = ptcb->argv;
+#else
       uintptr_t offset;
       int argc;
 
@@ -148,6 +158,7 @@ static inline int nxvfork_setup_stackargs(FAR struct tcb_s *parent,
       /* Put a terminator entry at the end of the child argv[] array. */
 
       child->argv[argc] = NULL;
+#endif /* CONFIG_SCHED_VFORK_SHARED_ARGV */
     }
 
   return OK;
@@ -196,6 +207,13 @@ static inline int nxvfork_setup_arguments(FAR struct tcb_s *parent,
 
 static inline size_t nxvfork_sizeof_arguments(FAR struct tcb_s *parent)
 {
+#ifdef CONFIG_SCHED_VFORK_SHARED_ARGV
+  /* The child references the parent's argv[] directly; no space for an
+   * argument block is needed on the child's stack.
+   */
+
+  return 0;
+#else
   if ((parent->flags & TCB_FLAG_TTYPE_MASK) != TCB_FLAG_TTYPE_PTHREAD)
     {
       FAR struct task_tcb_s *ptcb = (FAR struct task_tcb_s *)parent;
@@ -217,6 +235,7 @@ static inline size_t nxvfork_sizeof_arguments(FAR struct tcb_s *parent)
     {
       return 0;
     }
+#endif /* CONFIG_SCHED_VFORK_SHARED_ARGV */
 }
 
 /****************************************************************************
@@ -59,6 +59,10 @@ struct posix_timer_s
   struct wdog_s    pt_wdog;        /* The watchdog that provides the timing */
   struct sigevent  pt_event;       /* Notification information */
   struct sigwork_s pt_work;
+#ifdef CONFIG_TIMER_EXPIRY_BATCH
+  int              pt_overrun;     /* Expirations coalesced so far */
+  int              pt_lastoverrun; /* Overrun count of last queued signal */
+#endif
 };
 
 /****************************************************************************
@@ -183,6 +183,10 @@ int timer_create(clockid_t clockid, FAR struct sigevent *evp,
   ret->pt_crefs = 1;
   ret->pt_owner = getpid();
   ret->pt_delay = 0;
+#ifdef CONFIG_TIMER_EXPIRY_BATCH
+  ret->pt_overrun     = 0;
+  ret->pt_lastoverrun = 0;
+#endif
 
   /* Was a struct sigevent provided? */
 
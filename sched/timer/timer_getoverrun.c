@@ -75,8 +75,24 @@
 
 int timer_getoverrun(timer_t timerid)
 {
+#ifdef CONFIG_TIMER_EXPIRY_BATCH
+  FAR struct posix_timer_s *timer = (FAR struct posix_timer_s *)timerid;
+
+  if (timer == NULL)
+    {
+      set_errno(EINVAL);
+      return ERROR;
+    }
+
+  /* Return the overrun count that was latched when the most recent
+   * expiration signal was queued.
+   */
+
+  return timer->pt_lastoverrun;
+#else
   set_errno(ENOSYS);
   return ERROR;
+#endif
 }
 
 #endif /* CONFIG_DISABLE_POSIX_TIMERS */
@@ -27,6 +27,7 @@
 #include <stdint.h>
 #include <time.h>
 #include <string.h>
+#include <limits.h>
 #include <errno.h>
 
 #include <nuttx/irq.h>
@@ -124,6 +125,35 @@ static void timer_timeout(wdparm_t itimer)
 {
   FAR struct posix_timer_s *timer = (FAR struct posix_timer_s *)itimer;
 
+#ifdef CONFIG_TIMER_EXPIRY_BATCH
+  /* Is the signal queued by a previous expiry of this timer still pending
+   * delivery?  If so, then do not queue another:  This expiry is batched
+   * into the pending signal and reported through the overrun count that
+   * timer_getoverrun() returns.  Dense timer sets then generate at most
+   * one queued signal per timer, no matter how far delivery lags behind.
+   */
+
+  if (nxsig_notification_pending(timer->pt_owner, &timer->pt_event,
+                                 SI_TIMER))
+    {
+      if (timer->pt_overrun < _POSIX_DELAYTIMER_MAX)
+        {
+          timer->pt_overrun++;
+        }
+
+      timer_restart(timer, itimer);
+      return;
+    }
+
+  /* No.. the previous signal (if any) has been delivered.  Latch the
+   * overrun count that it accumulated and start a fresh count for the
+   * signal queued below.
+   */
+
+  timer->pt_lastoverrun = timer->pt_overrun;
+  timer->pt_overrun     = 0;
+#endif
+
   /* Send the specified signal to the specified task.   Increment the
    * reference count on the timer first so that will not be deleted until
    * after the signal handler returns.
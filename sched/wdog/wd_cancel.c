@@ -55,6 +55,77 @@
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+int wd_cancel(FAR struct wdog_s *wdog)
+{
+  FAR sq_queue_t *slot;
+  FAR struct wdog_s *curr;
+  FAR struct wdog_s *prev;
+  irqstate_t flags;
+  int ret = -EINVAL;
+
+  /* Prohibit timer interactions with the timer wheel until the
+   * cancellation is complete
+   */
+
+  flags = enter_critical_section();
+
+  /* Make sure that the watchdog is initialized (non-NULL) and is still
+   * active.
+   */
+
+  if (wdog != NULL && WDOG_ISACTIVE(wdog))
+    {
+      /* An active watchdog hangs on exactly one wheel slot, determined by
+       * its expiration tick.  Only that slot needs to be searched.
+       */
+
+      slot = &g_wdwheel[WDWHEEL_SLOT((uint32_t)wdog->lag)];
+
+      prev = NULL;
+      curr = (FAR struct wdog_s *)slot->head;
+
+      while ((curr) && (curr != wdog))
+        {
+          prev = curr;
+          curr = curr->next;
+        }
+
+      /* Check if the watchdog was found in the slot.  If not, then an OS
+       * error has occurred because the watchdog is marked active!
+       */
+
+      DEBUGASSERT(curr);
+
+      /* Now, remove the watchdog from the wheel slot.  Slot lists are
+       * unsorted so no lag redistribution is needed.
+       */
+
+      if (prev)
+        {
+          /* Remove the watchdog from mid- or end-of-slot */
+
+          sq_remafter((FAR sq_entry_t *)prev, slot);
+        }
+      else
+        {
+          /* Remove the watchdog at the head of the slot */
+
+          sq_remfirst(slot);
+        }
+
+      /* Mark the watchdog inactive */
+
+      wdog->next = NULL;
+      WDOG_CLRACTIVE(wdog);
+
+      ret = OK;
+    }
+
+  leave_critical_section(flags);
+  return ret;
+}
+#else
 int wd_cancel(FAR struct wdog_s *wdog)
 {
   FAR struct wdog_s *curr;
@@ -137,3 +208,4 @@ int wd_cancel(FAR struct wdog_s *wdog)
   leave_critical_section(flags);
   return ret;
 }
+#endif /* CONFIG_WDOG_TIMERWHEEL */
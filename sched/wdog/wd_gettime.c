@@ -50,6 +50,30 @@
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+int wd_gettime(FAR struct wdog_s *wdog)
+{
+  irqstate_t flags;
+
+  /* Verify the wdog */
+
+  flags = enter_critical_section();
+  if (wdog != NULL && WDOG_ISACTIVE(wdog))
+    {
+      /* The lag field of an active watchdog holds its absolute expiration
+       * tick, so the remaining time is a simple subtraction.
+       */
+
+      int delay = (int32_t)((uint32_t)wdog->lag - g_wdwheeltick);
+
+      leave_critical_section(flags);
+      return delay > 0 ? delay : 0;
+    }
+
+  leave_critical_section(flags);
+  return 0;
+}
+#else
 int wd_gettime(FAR struct wdog_s *wdog)
 {
   irqstate_t flags;
@@ -83,3 +107,4 @@ int wd_gettime(FAR struct wdog_s *wdog)
   leave_critical_section(flags);
   return 0;
 }
+#endif /* CONFIG_WDOG_TIMERWHEEL */
@@ -39,6 +39,18 @@
 
 sq_queue_t g_wdactivelist;
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+/* The hashed timer wheel.  Each slot holds an unsorted list of the active
+ * watchdogs whose expiration tick hashes to that slot.
+ */
+
+sq_queue_t g_wdwheel[WDWHEEL_NSLOTS];
+
+/* The current tick counter for the timer wheel */
+
+uint32_t g_wdwheeltick;
+#endif
+
 /* This is wdog tickbase, for wd_gettime() may called many times
  * between 2 times of wd_timer(), we use it to update wd_gettime().
  */
@@ -72,7 +84,20 @@ clock_t g_wdtickbase;
 
 void wd_initialize(void)
 {
+#ifdef CONFIG_WDOG_TIMERWHEEL
+  int i;
+#endif
+
   /* Initialize watchdog lists */
 
   sq_init(&g_wdactivelist);
+
+#ifdef CONFIG_WDOG_TIMERWHEEL
+  /* Initialize the timer wheel slots */
+
+  for (i = 0; i < WDWHEEL_NSLOTS; i++)
+    {
+      sq_init(&g_wdwheel[i]);
+    }
+#endif
 }
@@ -0,0 +1,117 @@
+/****************************************************************************
+ * sched/wdog/wd_nextexpiry.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/wdog.h>
+
+#include "wdog/wdog.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_nextexpiry
+ *
+ * Description:
+ *   This function returns the time remaining before the next active
+ *   watchdog timer expires.  It may be used, for example, by an idle-time
+ *   power management governor to bound the wakeup latency of a sleep
+ *   state.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   The time in system ticks remaining until the next watchdog timer
+ *   expires.  Zero means that a watchdog expiration is already pending;
+ *   a negative value means that no watchdog timer is active.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_WDOG_TIMERWHEEL
+int wd_nextexpiry(void)
+{
+  FAR struct wdog_s *curr;
+  irqstate_t flags;
+  int delay = -1;
+  int remaining;
+  int slot;
+
+  /* The wheel slots are unsorted, so all active watchdogs must be
+   * examined.  The lag field of an active watchdog holds its absolute
+   * expiration tick.
+   */
+
+  flags = enter_critical_section();
+  for (slot = 0; slot < WDWHEEL_NSLOTS; slot++)
+    {
+      for (curr = (FAR struct wdog_s *)g_wdwheel[slot].head;
+           curr != NULL;
+           curr = curr->next)
+        {
+          remaining = (int32_t)((uint32_t)curr->lag - g_wdwheeltick);
+          if (remaining < 0)
+            {
+              remaining = 0;
+            }
+
+          if (delay < 0 || remaining < delay)
+            {
+              delay = remaining;
+            }
+        }
+    }
+
+  leave_critical_section(flags);
+  return delay;
+}
+#else
+int wd_nextexpiry(void)
+{
+  irqstate_t flags;
+  int delay = -1;
+
+  /* The active list is sorted by expiration time, so only the head entry
+   * needs to be examined.
+   */
+
+  flags = enter_critical_section();
+  if (g_wdactivelist.head != NULL)
+    {
+      delay = ((FAR struct wdog_s *)g_wdactivelist.head)->lag - wd_elapse();
+      if (delay < 0)
+        {
+          delay = 0;
+        }
+    }
+
+  leave_critical_section(flags);
+  return delay;
+}
+#endif /* CONFIG_WDOG_TIMERWHEEL */
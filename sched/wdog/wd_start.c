@@ -69,6 +69,7 @@
  *
  ****************************************************************************/
 
+#ifndef CONFIG_WDOG_TIMERWHEEL
 static inline void wd_expiration(void)
 {
   FAR struct wdog_s *wdog;
@@ -108,6 +109,7 @@ static inline void wd_expiration(void)
         }
     }
 }
+#endif /* !CONFIG_WDOG_TIMERWHEEL */
 
 /****************************************************************************
  * Public Functions
@@ -149,6 +151,63 @@ static inline void wd_expiration(void)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+int wd_start(FAR struct wdog_s *wdog, int32_t delay,
+             wdentry_t wdentry, wdparm_t arg)
+{
+  irqstate_t flags;
+
+  /* Verify the wdog and setup parameters */
+
+  if (wdog == NULL || delay < 0)
+    {
+      return -EINVAL;
+    }
+
+  /* Check if the watchdog has been started. If so, stop it.
+   * NOTE:  There is a race condition here... the caller may receive
+   * the watchdog between the time that wd_start is called and
+   * the critical section is established.
+   */
+
+  flags = enter_critical_section();
+  if (WDOG_ISACTIVE(wdog))
+    {
+      wd_cancel(wdog);
+    }
+
+  /* Save the data in the watchdog structure */
+
+  wdog->func = wdentry;         /* Function to execute when delay expires */
+  up_getpicbase(&wdog->picbase);
+  wdog->arg = arg;
+
+  /* Calculate delay+1, forcing the delay into a range that we can handle */
+
+  if (delay <= 0)
+    {
+      delay = 1;
+    }
+  else if (++delay <= 0)
+    {
+      delay--;
+    }
+
+  /* Save the absolute expiration tick in the lag field and hang the
+   * watchdog on the wheel slot in which that tick will be processed.
+   * Slot lists are unsorted so the insertion is O(1); wd_timer() checks
+   * the expiration tick of each entry when the slot comes around.
+   */
+
+  wdog->lag = (int)(g_wdwheeltick + (uint32_t)delay);
+  sq_addlast((FAR sq_entry_t *)wdog,
+             &g_wdwheel[WDWHEEL_SLOT((uint32_t)wdog->lag)]);
+  WDOG_SETACTIVE(wdog);
+
+  leave_critical_section(flags);
+  return OK;
+}
+#else
 int wd_start(FAR struct wdog_s *wdog, int32_t delay,
              wdentry_t wdentry, wdparm_t arg)
 {
@@ -311,6 +370,7 @@ int wd_start(FAR struct wdog_s *wdog, int32_t delay,
   leave_critical_section(flags);
   return OK;
 }
+#endif /* CONFIG_WDOG_TIMERWHEEL */
 
 /****************************************************************************
  * Name: wd_timer
@@ -368,10 +428,13 @@ unsigned int wd_timer(int ticks)
 
       wdog = (FAR struct wdog_s *)g_wdactivelist.head;
 
-#ifndef CONFIG_SCHED_TICKLESS_ALARM
+#if !defined(CONFIG_SCHED_TICKLESS_ALARM) && \
+    CONFIG_SCHED_TICKLESS_SLACK_USEC == 0
       /* There is logic to handle the case where ticks is greater than
        * the watchdog lag, but if the scheduling is working properly
-       * that should never happen.
+       * that should never happen.  With deadline coalescing, however,
+       * the timer is intentionally programmed beyond the nearest
+       * deadline and ticks may exceed the lag by up to the slack.
        */
 
       DEBUGASSERT(ticks <= wdog->lag);
@@ -400,6 +463,30 @@ unsigned int wd_timer(int ticks)
   ret = g_wdactivelist.head ?
           ((FAR struct wdog_s *)g_wdactivelist.head)->lag : 0;
 
+#if CONFIG_SCHED_TICKLESS_SLACK_USEC > 0
+  /* Coalesce nearby deadlines:  Extend the delay to the expiration of
+   * the last watchdog that is due within the configured slack of the
+   * nearest deadline so that all of them are served by a single wakeup.
+   * The processing loop above is driven strictly by elapsed time, so
+   * expiring late by no more than the slack is safe.
+   */
+
+  if (ret > 0)
+    {
+      unsigned int slack = USEC2TICK(CONFIG_SCHED_TICKLESS_SLACK_USEC);
+      unsigned int extra = 0;
+
+      for (wdog = ((FAR struct wdog_s *)g_wdactivelist.head)->next;
+           wdog != NULL && extra + wdog->lag <= slack;
+           wdog = wdog->next)
+        {
+          extra += wdog->lag;
+        }
+
+      ret += extra;
+    }
+#endif
+
 #ifdef CONFIG_SMP
   leave_critical_section(flags);
 #endif
@@ -409,6 +496,79 @@ unsigned int wd_timer(int ticks)
   return ret;
 }
 
+#elif defined(CONFIG_WDOG_TIMERWHEEL)
+void wd_timer(void)
+{
+  FAR sq_queue_t *slot;
+  FAR struct wdog_s *wdog;
+  FAR struct wdog_s *prev;
+  FAR struct wdog_s *next;
+  sq_queue_t expired;
+#ifdef CONFIG_SMP
+  irqstate_t flags;
+
+  /* We are in an interrupt handler as, as a consequence, interrupts are
+   * disabled.  But in the SMP case, interrupts MAY be disabled only on
+   * the local CPU since most architectures do not permit disabling
+   * interrupts on other CPUS.
+   *
+   * Hence, we must follow rules for critical sections even here in the
+   * SMP case.
+   */
+
+  flags = enter_critical_section();
+#endif
+
+  /* Advance the wheel and process the slot in which the new tick falls */
+
+  slot = &g_wdwheel[WDWHEEL_SLOT(++g_wdwheeltick)];
+  sq_init(&expired);
+
+  /* Move every watchdog in the slot whose expiration tick has been
+   * reached to a local list.  Watchdogs with expiration ticks a multiple
+   * of the wheel size in the future remain in the slot.
+   */
+
+  prev = NULL;
+  for (wdog = (FAR struct wdog_s *)slot->head; wdog != NULL; wdog = next)
+    {
+      next = wdog->next;
+      if ((int32_t)((uint32_t)wdog->lag - g_wdwheeltick) <= 0)
+        {
+          if (prev != NULL)
+            {
+              sq_remafter((FAR sq_entry_t *)prev, slot);
+            }
+          else
+            {
+              sq_remfirst(slot);
+            }
+
+          sq_addlast((FAR sq_entry_t *)wdog, &expired);
+        }
+      else
+        {
+          prev = wdog;
+        }
+    }
+
+  /* Now execute the expired watchdogs.  The watchdog functions may
+   * restart their watchdogs; those re-insertions go to live wheel slots
+   * and are not visited by this traversal.
+   */
+
+  while ((wdog = (FAR struct wdog_s *)sq_remfirst(&expired)) != NULL)
+    {
+      wdog->next = NULL;
+      WDOG_CLRACTIVE(wdog);
+      up_setpicbase(wdog->picbase);
+      wdog->func(wdog->arg);
+    }
+
+#ifdef CONFIG_SMP
+  leave_critical_section(flags);
+#endif
+}
 #else
 void wd_timer(void)
 {
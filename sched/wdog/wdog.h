@@ -38,6 +38,15 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+/* Number of slots in the hashed timer wheel.  This must be a power of two
+ * so that slot selection reduces to a simple mask operation.
+ */
+
+#  define WDWHEEL_NSLOTS     (1 << CONFIG_WDOG_TIMERWHEEL_BITS)
+#  define WDWHEEL_SLOT(tick) ((tick) & (WDWHEEL_NSLOTS - 1))
+#endif
+
 /****************************************************************************
  * Name: wd_elapse
  *
@@ -74,6 +83,23 @@ extern "C"
 
 extern sq_queue_t g_wdactivelist;
 
+#ifdef CONFIG_WDOG_TIMERWHEEL
+/* In the timer wheel configuration, active watchdogs instead hang in
+ * unsorted lists on the wheel slot in which their expiration tick will be
+ * processed.  The lag field of each active watchdog holds its absolute
+ * expiration tick rather than a delta.
+ */
+
+extern sq_queue_t g_wdwheel[WDWHEEL_NSLOTS];
+
+/* The current tick counter for the timer wheel.  It is advanced by one
+ * slot on each call to wd_timer().  Tick comparisons are performed with
+ * signed 32-bit differences so that counter wrap is harmless.
+ */
+
+extern uint32_t g_wdwheeltick;
+#endif
+
 /* This is wdog tickbase, for wd_gettime() may called many times
  * between 2 times of wd_timer(), we use it to update wd_gettime().
  */
@@ -0,0 +1,258 @@
+/****************************************************************************
+ * sched/wqueue/kwork_batch.c
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <nuttx/irq.h>
+#include <nuttx/clock.h>
+#include <nuttx/wqueue.h>
+
+#include "wqueue/wqueue.h"
+
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: work_qbatch
+ *
+ * Description:
+ *   Queue one batchable work entry on a work queue and decide whether the
+ *   worker thread must be signalled.
+ *
+ *   The entry is queued with a delay of CONFIG_SCHED_WORKQUEUE_BATCH_DELAY
+ *   ticks so that the worker thread's existing timed wakeup logic provides
+ *   the batch deadline.  The worker is signalled only (1) when this is the
+ *   first pending batched entry, so that the worker thread arms its timed
+ *   wakeup, or (2) when the number of pending batched entries reaches
+ *   CONFIG_SCHED_WORKQUEUE_BATCH_COUNT, in which case the whole batch is
+ *   made ready and processed in a single wakeup.  All intermediate entries
+ *   are queued without waking the worker at all.
+ *
+ * Input Parameters:
+ *   wqueue - The work queue
+ *   work   - The work structure to queue
+ *   worker - The worker callback to be invoked
+ *   arg    - The argument that will be passed to the worker callback
+ *
+ * Returned Value:
+ *   true if the worker thread must be signalled.
+ *
+ ****************************************************************************/
+
+static bool work_qbatch(FAR struct kwork_wqueue_s *wqueue,
+                        FAR struct work_s *work, worker_t worker,
+                        FAR void *arg)
+{
+  FAR struct work_s *entry;
+  irqstate_t flags;
+  bool signal = false;
+
+  /* Queue the entry with the batch coalescing delay.  The worker thread
+   * will not execute it before the delay elapses.
+   */
+
+  work_qqueue(wqueue, work, worker, arg,
+              CONFIG_SCHED_WORKQUEUE_BATCH_DELAY);
+
+  /* Then mark the entry as batched and update the batching state.  This
+   * must be done with interrupts disabled because batched work is queued
+   * from interrupt handlers.
+   */
+
+  flags = enter_critical_section();
+
+  work->batch = true;
+  wqueue->batch.npending++;
+
+  if (wqueue->batch.npending >= CONFIG_SCHED_WORKQUEUE_BATCH_COUNT)
+    {
+      /* The count threshold has been reached.  Make every pending batched
+       * entry ready by clearing its delay, then wake the worker thread
+       * once to process the whole batch.
+       */
+
+      for (entry = (FAR struct work_s *)wqueue->q.head;
+           entry != NULL;
+           entry = (FAR struct work_s *)entry->dq.flink)
+        {
+          if (entry->batch)
+            {
+              entry->delay = 0;
+            }
+        }
+
+      signal = true;
+    }
+  else if (wqueue->batch.npending == 1)
+    {
+      /* This is the only pending batched entry.  The worker thread may be
+       * waiting indefinitely (or with a longer timeout) for a signal, so
+       * wake it once to let it arm a timed wakeup at the batch deadline.
+       */
+
+      signal = true;
+    }
+
+  leave_critical_section(flags);
+  return signal;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: work_queue_batch
+ *
+ * Description:
+ *   Queue batchable kernel-mode work to be performed at a later time.  All
+ *   queued work will be performed on the worker thread of execution (not
+ *   the caller's).
+ *
+ *   Unlike work_queue(), the worker thread is not awakened for every
+ *   queued entry.  Batched entries are gathered until either a count
+ *   threshold or a tick deadline is reached and the worker thread then
+ *   processes them in a single wakeup.  This is intended for driver bottom
+ *   halves that queue many small, latency-tolerant work items per second.
+ *
+ *   The work structure is managed exactly as for work_queue().
+ *
+ * Input Parameters:
+ *   qid    - The work queue ID (index)
+ *   work   - The work structure to queue
+ *   worker - The worker callback to be invoked.  The callback will invoked
+ *            on the worker thread of execution.
+ *   arg    - The argument that will be passed to the worker callback when
+ *            it is invoked.
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int work_queue_batch(int qid, FAR struct work_s *work, worker_t worker,
+                     FAR void *arg)
+{
+  /* Queue the new work */
+
+#ifdef CONFIG_SCHED_HPWORK
+  if (qid == HPWORK)
+    {
+      /* Queue high priority work */
+
+      if (work_qbatch((FAR struct kwork_wqueue_s *)&g_hpwork, work, worker,
+                      arg))
+        {
+          return work_signal(HPWORK);
+        }
+
+      return OK;
+    }
+  else
+#endif
+#ifdef CONFIG_SCHED_LPWORK
+  if (qid == LPWORK)
+    {
+      /* Queue low priority work */
+
+      if (work_qbatch((FAR struct kwork_wqueue_s *)&g_lpwork, work, worker,
+                      arg))
+        {
+          return work_signal(LPWORK);
+        }
+
+      return OK;
+    }
+  else
+#endif
+    {
+      return -EINVAL;
+    }
+}
+
+/****************************************************************************
+ * Name: work_batch_stats
+ *
+ * Description:
+ *   Return the accumulated queue latency statistics for batched work
+ *   entries on one work queue.
+ *
+ * Input Parameters:
+ *   qid   - The work queue ID (index)
+ *   stats - Location to return the latency statistics
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int work_batch_stats(int qid, FAR struct work_latency_s *stats)
+{
+  FAR struct kwork_wqueue_s *wqueue;
+  irqstate_t flags;
+
+  DEBUGASSERT(stats != NULL);
+
+#ifdef CONFIG_SCHED_HPWORK
+  if (qid == HPWORK)
+    {
+      wqueue = (FAR struct kwork_wqueue_s *)&g_hpwork;
+    }
+  else
+#endif
+#ifdef CONFIG_SCHED_LPWORK
+  if (qid == LPWORK)
+    {
+      wqueue = (FAR struct kwork_wqueue_s *)&g_lpwork;
+    }
+  else
+#endif
+    {
+      return -EINVAL;
+    }
+
+  /* Copy out the statistics with interrupts disabled since they are
+   * updated by the worker threads and from interrupt handlers.
+   */
+
+  flags = enter_critical_section();
+
+  stats->nitems  = wqueue->batch.nitems;
+  stats->total   = wqueue->batch.total;
+  stats->maximum = wqueue->batch.maximum;
+
+  leave_critical_section(flags);
+  return OK;
+}
+
+#endif /* CONFIG_SCHED_WORKQUEUE_BATCH */
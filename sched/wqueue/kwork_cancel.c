@@ -90,6 +90,20 @@ static int work_qcancel(FAR struct kwork_wqueue_s *wqueue,
 
       dq_rem((FAR dq_entry_t *)work, &wqueue->q);
       work->worker = NULL;
+
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+      /* If this was a coalesced batch entry, it is no longer pending */
+
+      if (work->batch)
+        {
+          work->batch = false;
+          if (wqueue->batch.npending > 0)
+            {
+              wqueue->batch.npending--;
+            }
+        }
+#endif
+
       ret = OK;
     }
 
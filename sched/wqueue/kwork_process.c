@@ -63,6 +63,101 @@
 #  define MIN(a,b) ((a) < (b) ? (a) : (b))
 #endif
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: work_steal
+ *
+ * Description:
+ *   Remove and execute one ready entry from the high-priority work queue
+ *   on behalf of an otherwise idle low-priority worker thread.  This is
+ *   used only when every high-priority worker thread is busy so that
+ *   independent work items do not wait behind a long-running item.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   true if an entry was executed; false if no ready entry was found.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+static bool work_steal(void)
+{
+  FAR struct work_s *work;
+  worker_t worker;
+  irqstate_t flags;
+  FAR void *arg;
+  bool busy = true;
+  int i;
+
+  flags = enter_critical_section();
+
+  /* Steal only if every high-priority worker thread is occupied.  If any
+   * is idle, it has already been signalled and will drain the queue at
+   * its own (higher) priority.
+   */
+
+  for (i = 0; i < CONFIG_SCHED_HPNTHREADS; i++)
+    {
+      if (!g_hpwork.worker[i].busy)
+        {
+          busy = false;
+          break;
+        }
+    }
+
+  if (busy)
+    {
+      /* Find the first entry whose delay has elapsed */
+
+      for (work = (FAR struct work_s *)g_hpwork.q.head;
+           work != NULL;
+           work = (FAR struct work_s *)work->dq.flink)
+        {
+          if (clock_systime_ticks() - work->qtime >= work->delay)
+            {
+              /* Remove it and execute it with interrupts re-enabled */
+
+              dq_rem((FAR dq_entry_t *)work, &g_hpwork.q);
+
+              worker = work->worker;
+              if (worker != NULL)
+                {
+                  arg = work->arg;
+                  work->worker = NULL;
+
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+                  /* A stolen batch entry is no longer pending */
+
+                  if (work->batch)
+                    {
+                      work->batch = false;
+                      if (g_hpwork.batch.npending > 0)
+                        {
+                          g_hpwork.batch.npending--;
+                        }
+
+                      g_hpwork.batch.nitems++;
+                    }
+#endif
+
+                  leave_critical_section(flags);
+                  worker(arg);
+                  return true;
+                }
+            }
+        }
+    }
+
+  leave_critical_section(flags);
+  return false;
+}
+#endif /* CONFIG_SCHED_LPWORK_STEALING */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -149,6 +244,29 @@ void work_process(FAR struct kwork_wqueue_s *wqueue, int wndx)
 
               work->worker = NULL;
 
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+              /* If this is a coalesced batch entry, then update the
+               * pending batch count and the queue latency statistics
+               * before releasing the entry.
+               */
+
+              if (work->batch)
+                {
+                  work->batch = false;
+                  if (wqueue->batch.npending > 0)
+                    {
+                      wqueue->batch.npending--;
+                    }
+
+                  wqueue->batch.nitems++;
+                  wqueue->batch.total += elapsed;
+                  if (elapsed > wqueue->batch.maximum)
+                    {
+                      wqueue->batch.maximum = elapsed;
+                    }
+                }
+#endif
+
               /* Do the work.  Re-enable interrupts while the work is being
                * performed... we don't have any idea how long this will take!
                */
@@ -206,6 +324,24 @@ void work_process(FAR struct kwork_wqueue_s *wqueue, int wndx)
         }
     }
 
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+  /* All ready work in this queue has been processed.  If this is a low-
+   * priority worker thread, steal ready entries from the high-priority
+   * work queue while every high-priority worker thread is busy, rather
+   * than going idle with high-priority work still pending.
+   */
+
+  if (wqueue == (FAR struct kwork_wqueue_s *)&g_lpwork)
+    {
+      leave_critical_section(flags);
+      while (work_steal())
+        {
+        }
+
+      flags = enter_critical_section();
+    }
+#endif
+
   /* When multiple worker threads are created for this work queue, only
    * thread 0 (wndx = 0) will monitor the unexpired works.
    *
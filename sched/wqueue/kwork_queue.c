@@ -39,7 +39,7 @@
 #ifdef CONFIG_SCHED_WORKQUEUE
 
 /****************************************************************************
- * Private Functions
+ * Public Functions
  ****************************************************************************/
 
 /****************************************************************************
@@ -71,9 +71,9 @@
  *
  ****************************************************************************/
 
-static void work_qqueue(FAR struct kwork_wqueue_s *wqueue,
-                        FAR struct work_s *work, worker_t worker,
-                        FAR void *arg, clock_t delay)
+void work_qqueue(FAR struct kwork_wqueue_s *wqueue,
+                 FAR struct work_s *work, worker_t worker,
+                 FAR void *arg, clock_t delay)
 {
   irqstate_t flags;
 
@@ -101,6 +101,9 @@ static void work_qqueue(FAR struct kwork_wqueue_s *wqueue,
   work->worker = worker;           /* Work callback. non-NULL means queued */
   work->arg    = arg;              /* Callback argument */
   work->delay  = delay;            /* Delay until work performed */
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+  work->batch  = false;            /* Not a coalesced batch entry */
+#endif
 
   /* Now, time-tag that entry and put it in the work queue */
 
@@ -111,10 +114,6 @@ static void work_qqueue(FAR struct kwork_wqueue_s *wqueue,
   leave_critical_section(flags);
 }
 
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
-
 /****************************************************************************
  * Name: work_queue
  *
@@ -27,10 +27,12 @@
 #include <nuttx/config.h>
 
 #include <sys/types.h>
+#include <stdint.h>
 #include <stdbool.h>
 #include <queue.h>
 
 #include <nuttx/clock.h>
+#include <nuttx/wqueue.h>
 
 #ifdef CONFIG_SCHED_WORKQUEUE
 
@@ -55,11 +57,30 @@ struct kworker_s
   volatile bool     busy;   /* True: Worker is not available */
 };
 
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+/* This structure holds the batching state of one work queue:  The number of
+ * coalesced entries still pending plus the accumulated queue latency
+ * statistics for batched entries.  It is protected by the same critical
+ * section that protects the work queue itself.
+ */
+
+struct kwork_batch_s
+{
+  uint16_t          npending; /* Number of un-flushed batched entries */
+  uint32_t          nitems;   /* Number of batched entries processed */
+  clock_t           total;    /* Sum of all entry latencies, in ticks */
+  clock_t           maximum;  /* Largest single entry latency, in ticks */
+};
+#endif
+
 /* This structure defines the state of one kernel-mode work queue */
 
 struct kwork_wqueue_s
 {
   struct dq_queue_s q;         /* The queue of pending work */
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+  struct kwork_batch_s batch;  /* Work batching state */
+#endif
   struct kworker_s  worker[1]; /* Describes a worker thread */
 };
 
@@ -71,6 +92,9 @@ struct kwork_wqueue_s
 struct hp_wqueue_s
 {
   struct dq_queue_s q;         /* The queue of pending work */
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+  struct kwork_batch_s batch;  /* Work batching state */
+#endif
 
   /* Describes each thread in the high priority queue's thread pool */
 
@@ -86,6 +110,9 @@ struct hp_wqueue_s
 struct lp_wqueue_s
 {
   struct dq_queue_s q;      /* The queue of pending work */
+#ifdef CONFIG_SCHED_WORKQUEUE_BATCH
+  struct kwork_batch_s batch; /* Work batching state */
+#endif
 
   /* Describes each thread in the low priority queue's thread pool */
 
@@ -151,6 +178,34 @@ int work_start_highpri(void);
 int work_start_lowpri(void);
 #endif
 
+/****************************************************************************
+ * Name: work_qqueue
+ *
+ * Description:
+ *   Queue work to be performed at a later time.  All queued work will be
+ *   performed on the worker thread of execution (not the caller's).  This
+ *   is the common logic underlying work_queue() and work_queue_batch(); it
+ *   does not signal the worker thread.
+ *
+ * Input Parameters:
+ *   wqueue - The work queue
+ *   work   - The work structure to queue
+ *   worker - The worker callback to be invoked.  The callback will invoked
+ *            on the worker thread of execution.
+ *   arg    - The argument that will be passed to the worker callback when
+ *            it is invoked.
+ *   delay  - Delay (in clock ticks) from the time queue until the worker
+ *            is invoked. Zero means to perform the work immediately.
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void work_qqueue(FAR struct kwork_wqueue_s *wqueue,
+                 FAR struct work_s *work, worker_t worker,
+                 FAR void *arg, clock_t delay);
+
 /****************************************************************************
  * Name: work_process
  *
@@ -27,6 +27,10 @@
 #include <sys/types.h>
 #include <syscall.h>
 
+#ifdef CONFIG_SYSCALL_PERF
+#  include <nuttx/arch.h>
+#endif
+
 /* The content of this file is only meaningful during the kernel phase of
  * a kernel build.
  */
@@ -74,10 +78,91 @@
 #undef SYSCALL_LOOKUP1
 #undef SYSCALL_LOOKUP
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* When system call performance monitoring is enabled, the lookup table
+ * refers to generated wrapper functions that count the call and accumulate
+ * the time spent in the stub before and after delegating to the real stub.
+ * The counters are updated without locking; they are statistical in nature
+ * and small errors from concurrent updates are acceptable.
+ */
+
+#ifdef CONFIG_SYSCALL_PERF
+
+#define WRAP_NAME(f) CAT(WRAP_, f)
+
+/* The architecture dispatch logic subtracts CONFIG_SYS_RESERVED from the
+ * system call number before indexing g_stublookup, so the 'nbr' received
+ * here indexes g_syscall_perf directly.
+ */
+
+#define WRAP_BODY(f, call) \
+  { \
+    uint32_t start; \
+    uintptr_t ret; \
+    start = up_perf_gettime(); \
+    ret   = call; \
+    g_syscall_perf[nbr].count++; \
+    g_syscall_perf[nbr].time += up_perf_gettime() - start; \
+    return ret; \
+  }
+
+#define WRAP_FUNC0(f) \
+  static uintptr_t WRAP_NAME(f)(int nbr) \
+  WRAP_BODY(f, STUB_NAME(f)(nbr))
+#define WRAP_FUNC1(f) \
+  static uintptr_t WRAP_NAME(f)(int nbr, uintptr_t parm1) \
+  WRAP_BODY(f, STUB_NAME(f)(nbr, parm1))
+#define WRAP_FUNC2(f) \
+  static uintptr_t WRAP_NAME(f)(int nbr, uintptr_t parm1, uintptr_t parm2) \
+  WRAP_BODY(f, STUB_NAME(f)(nbr, parm1, parm2))
+#define WRAP_FUNC3(f) \
+  static uintptr_t WRAP_NAME(f)(int nbr, uintptr_t parm1, uintptr_t parm2, \
+                 uintptr_t parm3) \
+  WRAP_BODY(f, STUB_NAME(f)(nbr, parm1, parm2, parm3))
+#define WRAP_FUNC4(f) \
+  static uintptr_t WRAP_NAME(f)(int nbr, uintptr_t parm1, uintptr_t parm2, \
+                 uintptr_t parm3, uintptr_t parm4) \
+  WRAP_BODY(f, STUB_NAME(f)(nbr, parm1, parm2, parm3, parm4))
+#define WRAP_FUNC5(f) \
+  static uintptr_t WRAP_NAME(f)(int nbr, uintptr_t parm1, uintptr_t parm2, \
+                 uintptr_t parm3, uintptr_t parm4, uintptr_t parm5) \
+  WRAP_BODY(f, STUB_NAME(f)(nbr, parm1, parm2, parm3, parm4, parm5))
+#define WRAP_FUNC6(f) \
+  static uintptr_t WRAP_NAME(f)(int nbr, uintptr_t parm1, uintptr_t parm2, \
+                 uintptr_t parm3, uintptr_t parm4, uintptr_t parm5, \
+                 uintptr_t parm6) \
+  WRAP_BODY(f, STUB_NAME(f)(nbr, parm1, parm2, parm3, parm4, parm5, parm6))
+
+#define WRAP_FUNC(f, n) CAT(WRAP_FUNC, n)(f)
+
+#define SYSCALL_LOOKUP1(f,n) WRAP_FUNC(f, n)
+#define SYSCALL_LOOKUP(f,n)  WRAP_FUNC(f, n)
+#include <sys/syscall_lookup.h>
+#undef SYSCALL_LOOKUP1
+#undef SYSCALL_LOOKUP
+
+#define STUB_ENTRY(f) WRAP_NAME(f)
+#else
+#define STUB_ENTRY(f) STUB_NAME(f)
+#endif /* CONFIG_SYSCALL_PERF */
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
 
+#ifdef CONFIG_SYSCALL_PERF
+
+/* Per-syscall dispatch counts and accumulated stub execution times.  This
+ * table is indexed by the system call number less CONFIG_SYS_RESERVED.
+ */
+
+struct syscall_perf_s g_syscall_perf[SYS_nsyscalls];
+
+#endif
+
 /* Stub lookup tables.  This table is indexed by the system call number.
  * Given the system call number, the corresponding entry in this table
  * provides the address of the stub function.
@@ -85,8 +170,8 @@
 
 const uintptr_t g_stublookup[SYS_nsyscalls] =
 {
-#  define SYSCALL_LOOKUP1(f,n) (uintptr_t)STUB_NAME(f)
-#  define SYSCALL_LOOKUP(f,n)  , (uintptr_t)STUB_NAME(f)
+#  define SYSCALL_LOOKUP1(f,n) (uintptr_t)STUB_ENTRY(f)
+#  define SYSCALL_LOOKUP(f,n)  , (uintptr_t)STUB_ENTRY(f)
 #  include <sys/syscall_lookup.h>
 #  undef SYSCALL_LOOKUP1
 #  undef SYSCALL_LOOKUP
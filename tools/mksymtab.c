@@ -51,6 +51,7 @@
  ****************************************************************************/
 
 #define MAX_HEADER_FILES 500
+#define MAX_SYMBOLS      5000
 #define SYMTAB_NAME      "g_symtab"
 #define NSYMBOLS_NAME    "g_nsymbols"
 
@@ -58,6 +59,12 @@
  * Private Types
  ****************************************************************************/
 
+struct symbol_s
+{
+  const char *name;
+  const char *cond;
+};
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -65,6 +72,9 @@
 static const char *g_hdrfiles[MAX_HEADER_FILES];
 static int nhdrfiles;
 
+static struct symbol_s g_symbols[MAX_SYMBOLS];
+static int nsymfound;
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -117,6 +127,25 @@ static void add_hdrfile(const char *hdrfile)
     }
 }
 
+static void add_symbol(const char *name, const char *cond)
+{
+  if (nsymfound >= MAX_SYMBOLS)
+    {
+      fprintf(stderr, "ERROR:  Too many symbols.  Increase MAX_SYMBOLS\n");
+      exit(EXIT_FAILURE);
+    }
+
+  g_symbols[nsymfound].name = strdup(name);
+  g_symbols[nsymfound].cond = (cond && strlen(cond) > 0) ? strdup(cond) : NULL;
+  nsymfound++;
+}
+
+static int compare_symbols(const void *arg1, const void *arg2)
+{
+  return strcmp(((const struct symbol_s *)arg1)->name,
+                ((const struct symbol_s *)arg2)->name);
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -218,7 +247,9 @@ int main(int argc, char **argv, char **envp)
       exit(EXIT_FAILURE);
     }
 
-  /* Get all of the header files that we need to include */
+  /* Get all of the header files that we need to include and collect the
+   * symbols themselves.
+   */
 
   while ((ptr = read_line(instream)) != NULL)
     {
@@ -234,11 +265,19 @@ int main(int argc, char **argv, char **envp)
       /* Add the header file to the list of header files we need to include */
 
       add_hdrfile(g_parm[HEADER_INDEX]);
+
+      /* Remember the symbol name and any configuration that it depends on */
+
+      add_symbol(g_parm[NAME_INDEX], g_parm[COND_INDEX]);
     }
 
-  /* Back to the beginning */
+  /* Sort the symbols by name so that the generated table may be searched
+   * with a binary search (see CONFIG_SYMTAB_ORDEREDBYNAME).  Dropping the
+   * conditioned-out entries at compile time does not disturb the ordering
+   * of the entries that remain.
+   */
 
-  rewind(instream);
+  qsort(g_symbols, nsymfound, sizeof(struct symbol_s), compare_symbols);
 
   /* Output up-front file boilerplate */
 
@@ -259,35 +298,26 @@ int main(int argc, char **argv, char **envp)
   fprintf(outstream, "\nconst struct symtab_s %s[] =\n", symtab);
   fprintf(outstream, "{\n");
 
-  /* Parse each line in the CVS file */
+  /* Output each symbol table entry in sorted order */
 
   nextterm  = "";
   finalterm = "";
 
-  while ((ptr = read_line(instream)) != NULL)
+  for (i = 0; i < nsymfound; i++)
     {
-      /* Parse the line from the CVS file */
-
-      int nargs = parse_csvline(ptr);
-      if (nargs < PARM1_INDEX)
-        {
-          fprintf(stderr, "Only %d arguments found: %s\n", nargs, g_line);
-          exit(EXIT_FAILURE);
-        }
-
       /* Output any conditional compilation */
 
-      cond = (g_parm[COND_INDEX] && strlen(g_parm[COND_INDEX]) > 0);
+      cond = (g_symbols[i].cond != NULL);
       if (cond)
         {
-          fprintf(outstream, "%s#if %s\n", nextterm, g_parm[COND_INDEX]);
+          fprintf(outstream, "%s#if %s\n", nextterm, g_symbols[i].cond);
           nextterm  = "";
         }
 
       /* Output the symbol table entry */
 
       fprintf(outstream, "%s  { \"%s\", (FAR const void *)%s }",
-              nextterm, g_parm[NAME_INDEX], g_parm[NAME_INDEX]);
+              nextterm, g_symbols[i].name, g_symbols[i].name);
 
       if (cond)
         {